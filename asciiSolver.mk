@@ -0,0 +1,18 @@
+CC=g++
+CFLAGS=-c -Wall -O2
+LDFLAGS=
+SOURCES=src/asciiSolver.cpp src/Caesar.cpp src/CommonUtils.cpp src/Dictionary.cpp src/EnglishQuadgrams.cpp src/Radix.cpp src/Scorer.cpp src/ShiftKernel.cpp
+OBJECTS=$(SOURCES:.cpp=.o)
+EXECUTABLE=bin/asciiSolver
+
+all: $(SOURCES) $(EXECUTABLE)
+	
+$(EXECUTABLE): $(OBJECTS) 
+	$(CC) -std=c++17 -Iinclude/ $(LDFLAGS) $(OBJECTS) -o $@
+
+.cpp.o:
+	$(CC) -std=c++17 -Iinclude/ $(CFLAGS) $< -o $@
+	
+clean:
+	@echo " Cleaning..."; 
+	@echo " $(RM) $(EXECUTABLE)"; $(RM) $(EXECUTABLE)
\ No newline at end of file
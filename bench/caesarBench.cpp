@@ -0,0 +1,280 @@
+/*****************************************************************************
+ * File: caesarBench.cpp
+ *
+ * Description: Lines per second of Caesar solving, one line at a time as
+ *              caesarSolver used to (each of the 26 shifts built as its own
+ *              string and scored) against the batch solver (lines packed
+ *              into one block, every shift scored from the letters in one
+ *              call against the shared model). Both run across a worker pool
+ *              of 1, 4 and one per core, and the batch results are checked
+ *              against the per-line ones.
+ *
+ *              Then counts the heap allocations made solving the corpus
+ *              through the file pipeline as caesarSolver does, per line and
+ *              batched, to show that a warm batch pipeline does not allocate
+ *              per line.
+ *
+ *              The corpus is the lines of the file repeated, each copy
+ *              numbered so that every line is distinct. A second corpus of
+ *              rotated, partly uppercased copies checks that the batch
+ *              solver, which scores each family of rotations once, still
+ *              matches solving each line on its own.
+ *
+ *              Usage: caesarBench [file] [repetitions] [method]
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+
+// STL includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <new>
+#include <thread>
+#include <vector>
+
+// Project includes
+#include "Caesar.h"
+#include "CommonUtils.h"
+#include "ShiftKernel.h"
+
+static const unsigned int ALPHABET_LENGTH = 26;
+
+// Lines handed to a worker at once, as the file pipeline does
+static const std::size_t CHUNK_LINES = 256;
+
+// Lines solved at least when counting allocations
+static const std::size_t ALLOCATION_LINES = 200000;
+
+// Every allocation made through operator new
+static std::atomic<std::size_t> allocations(0);
+
+void* operator new(std::size_t size)
+{
+    allocations++;
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+// Solve one line as caesarSolver did before batching: build and score every
+// shifted candidate, keeping the first best
+std::string solveShifted(const Scorer& scorer, std::string_view line)
+{
+    std::string candidate;
+    double bestScore = 0.;
+    unsigned int best = 0;
+    for (unsigned int shift = 0; shift < ALPHABET_LENGTH; shift++) {
+        candidate.assign(line.begin(), line.end());
+        shiftLetters(&candidate[0], candidate.size(), shift);
+        const double score = scorer.score(candidate);
+        if (shift == 0 || score > bestScore) {
+            bestScore = score;
+            best = shift;
+        }
+    }
+    return CaesarSolver::decrypt(line, best);
+}
+
+// Run solveChunk(first, last) over every chunk of the lines across a pool of
+// the given size, and return lines per second
+template<typename SolveChunk>
+double timeChunks(std::size_t lines, unsigned int jobs, SolveChunk solveChunk)
+{
+    const auto start = std::chrono::steady_clock::now();
+    {
+        ThreadPool pool(jobs);
+        for (std::size_t first = 0; first < lines; first += CHUNK_LINES) {
+            const std::size_t last = std::min(first + CHUNK_LINES, lines);
+            pool.submit([&solveChunk, first, last] {
+                solveChunk(first, last);
+            });
+        }
+        pool.wait();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return lines / elapsed.count();
+}
+
+int main(int argc, char* argv[])
+{
+    const std::string filePath = (argc > 1) ? argv[1] : "cypher_text.txt";
+    const int repetitions = (argc > 2) ? std::stoi(argv[2]) : 200;
+    const std::string method = (argc > 3) ? argv[3] : "quad";
+
+    std::vector<std::string> fileLines;
+    std::ifstream inFile(filePath);
+    std::string line;
+    while (std::getline(inFile, line)) {
+        fileLines.push_back(line);
+    }
+    if (fileLines.empty()) {
+        std::cout << "Unable to read lines from \"" << filePath << "\"." << std::endl;
+        return 1;
+    }
+
+    // Number each copy so no two lines are alike and the batch solver cannot
+    // score a family of repeated lines once
+    std::vector<std::string> corpusLines;
+    for (int rep = 0; rep < repetitions; rep++) {
+        for (const auto& fileLine : fileLines) {
+            corpusLines.push_back(fileLine + " " + std::to_string(rep));
+        }
+    }
+    const std::vector<std::string_view> lines(corpusLines.begin(), corpusLines.end());
+
+    const auto scorer = makeScorer(method, Dictionary::builtin());
+    if (!scorer) {
+        std::cout << "Unknown scoring method \"" << method << "\". Use words, chi or quad." << std::endl;
+        return 1;
+    }
+    const CaesarSolver solver(makeScorer(method, Dictionary::builtin()));
+
+    std::vector<unsigned int> jobCounts = {1, 4};
+    const unsigned int cores = std::max(std::thread::hardware_concurrency(), 1u);
+    if (std::find(jobCounts.begin(), jobCounts.end(), cores) == jobCounts.end()) {
+        jobCounts.push_back(cores);
+    }
+
+    std::cout << lines.size() << " lines, " << method << " scoring, " << cores << " cores" << std::endl;
+    std::cout << "jobs   per line (lines/s)   batch (lines/s)   speedup" << std::endl;
+
+    bool identical = true;
+    std::vector<std::string> expected(lines.size());
+    std::vector<std::string> batchResults(lines.size());
+    for (const auto jobs : jobCounts) {
+        const double perLine = timeChunks(lines.size(), jobs, [&](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; i++) {
+                expected[i] = solveShifted(*scorer, lines[i]);
+            }
+        });
+
+        const double batch = timeChunks(lines.size(), jobs, [&](std::size_t first, std::size_t last) {
+            thread_local LineBlock cypherTexts;
+            thread_local LineBlock plainTexts;
+            cypherTexts.clear();
+            for (std::size_t i = first; i < last; i++) {
+                cypherTexts.append(lines[i]);
+            }
+            solver.solveBatch(cypherTexts, plainTexts);
+            for (std::size_t i = first; i < last; i++) {
+                batchResults[i].assign(plainTexts[i - first]);
+            }
+        });
+
+        identical = identical && (batchResults == expected);
+        std::printf("%4u   %18.0f   %15.0f   %6.2fx\n", jobs, perLine, batch, batch / perLine);
+    }
+
+    std::cout << "Batch results " << (identical ? "match" : "DIFFER FROM") << " the per-line results" << std::endl;
+
+    // Rotated and partly uppercased copies of the file's lines, so each batch
+    // holds families of rotations that the batch solver scores once. Its
+    // results must still match solving every line on its own.
+    std::vector<std::string> familyLines;
+    for (int rep = 0; rep < std::min(repetitions, 2 * static_cast<int>(ALPHABET_LENGTH)); rep++) {
+        for (std::size_t i = 0; i < fileLines.size(); i++) {
+            std::string rotated = CaesarSolver::decrypt(fileLines[i], (rep + i) % ALPHABET_LENGTH);
+            if ((rep + i) % 3 == 0) {
+                for (auto& c : rotated) {
+                    if (c >= 'a' && c <= 'z') {
+                        c = static_cast<char>(c - 'a' + 'A');
+                    }
+                }
+            }
+            familyLines.push_back(rotated);
+        }
+    }
+
+    bool familiesIdentical = true;
+    LineBlock cypherTexts;
+    LineBlock plainTexts;
+    for (std::size_t first = 0; first < familyLines.size(); first += CHUNK_LINES) {
+        const std::size_t last = std::min(first + CHUNK_LINES, familyLines.size());
+        cypherTexts.clear();
+        for (std::size_t i = first; i < last; i++) {
+            cypherTexts.append(familyLines[i]);
+        }
+        solver.solveBatch(cypherTexts, plainTexts);
+        for (std::size_t i = first; i < last; i++) {
+            const std::string alone = CaesarSolver::decrypt(familyLines[i], solver.solveShift(familyLines[i]));
+            familiesIdentical = familiesIdentical && (plainTexts[i - first] == alone);
+        }
+    }
+    std::cout << "Batch results over " << familyLines.size() << " rotated lines "
+              << (familiesIdentical ? "match" : "DIFFER FROM") << " the per-line results" << std::endl;
+    identical = identical && familiesIdentical;
+
+    // Allocations solving the corpus through the file pipeline on one worker,
+    // repeated to at least ALLOCATION_LINES lines. Counted within one run,
+    // from when the first quarter of the lines has been written (every
+    // buffer has grown by then) to the end.
+    std::string corpus;
+    std::size_t allocationLines = 0;
+    while (allocationLines < ALLOCATION_LINES) {
+        for (const auto corpusLine : lines) {
+            corpus.append(corpusLine.data(), corpusLine.size());
+            corpus.push_back('\n');
+        }
+        allocationLines += lines.size();
+    }
+
+    const auto steadyAllocations = [allocationLines](const auto& run) {
+        const std::size_t warmLines = allocationLines / 4;
+        std::size_t written = 0;
+        std::size_t warmAllocations = 0;
+        const std::size_t before = allocations;
+        run([&](std::string_view, const std::string&) {
+            if (++written == warmLines) {
+                warmAllocations = allocations;
+            }
+        });
+        std::printf("%10zu   %16.2f\n", allocations - before,
+                    1000. * (allocations - warmAllocations) / (allocationLines - warmLines));
+    };
+
+    std::printf("Allocations over %zu lines   total   steady per 1000 lines\n", allocationLines);
+    std::printf("  per line           ");
+    steadyAllocations([&](const LineEmitter& emit) {
+        solveText(corpus, [&solver](std::string_view encrypted) {
+            return solver.solve(encrypted);
+        }, emit, 1);
+    });
+    std::printf("  batch              ");
+    steadyAllocations([&](const LineEmitter& emit) {
+        solveTextBatches(corpus, [&solver](const std::vector<std::string_view>& batch, std::vector<std::string>& results) {
+            thread_local LineBlock cypherTexts;
+            thread_local LineBlock plainTexts;
+            cypherTexts.clear();
+            for (const auto encrypted : batch) {
+                cypherTexts.append(encrypted);
+            }
+            solver.solveBatch(cypherTexts, plainTexts);
+            for (std::size_t i = 0; i < plainTexts.size(); i++) {
+                results[i].assign(plainTexts[i]);
+            }
+        }, emit, 1);
+    });
+
+    return identical ? 0 : 1;
+}
@@ -0,0 +1,157 @@
+/*****************************************************************************
+ * File: dictionaryBench.cpp
+ *
+ * Description: Benchmark of the per-line Caesar solve time using the original
+ *              per-call std::map dictionary versus the shared Dictionary
+ *              index. Every line of the input file is lowercased, shifted 26
+ *              ways and each shift is scored word by word, as in
+ *              caesarSolver.
+ *
+ *              Given a word list, also times loading it and solving with it.
+ *
+ *              Usage: dictionaryBench [file] [repetitions] [wordlist]
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+
+// STL includes
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <map>
+#include <memory>
+#include <chrono>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+
+// Project includes
+#include "Dictionary.h"
+
+static const int ALPHABET_LENGTH = 26;
+
+// The original lookup: a fresh 100-entry map for every probe
+bool mapLookup(const std::string& word)
+{
+    std::map<std::string, int> dictionary = {{"the", 1}, {"be", 1}, {"to", 1}, {"of", 1},
+        {"and", 1}, {"a", 1}, {"in", 1}, {"that", 1}, {"have", 1}, {"i", 1}, {"it", 1},
+        {"for", 1}, {"not", 1}, {"on", 1}, {"with", 1}, {"he", 1}, {"as", 1}, {"you", 1},
+        {"do", 1}, {"at", 1}, {"this", 1}, {"but", 1}, {"his", 1}, {"by", 1}, {"from", 1},
+        {"they", 1}, {"we", 1}, {"say", 1}, {"her", 1}, {"she", 1}, {"or", 1}, {"an", 1},
+        {"will", 1}, {"my", 1}, {"one", 1}, {"all", 1}, {"would", 1}, {"there", 1},
+        {"their", 1}, {"what", 1}, {"so", 1}, {"up", 1}, {"out", 1}, {"if", 1},
+        {"about", 1}, {"who", 1}, {"get", 1}, {"which", 1}, {"go", 1}, {"me", 1},
+        {"when", 1}, {"make", 1}, {"can", 1}, {"like", 1}, {"time", 1}, {"no", 1},
+        {"just", 1}, {"him", 1}, {"know", 1}, {"take", 1}, {"person", 1}, {"into", 1},
+        {"year", 1}, {"your", 1}, {"good", 1}, {"some", 1}, {"could", 1}, {"them", 1},
+        {"see", 1}, {"other", 1}, {"than", 1}, {"then", 1}, {"now", 1}, {"look", 1},
+        {"only", 1}, {"come", 1}, {"its", 1}, {"over", 1}, {"think", 1}, {"also", 1},
+        {"back", 1}, {"after", 1}, {"use", 1}, {"two", 1}, {"how", 1}, {"our", 1},
+        {"work", 1}, {"first", 1}, {"well", 1}, {"way", 1}, {"even", 1}, {"new", 1},
+        {"want", 1}, {"because", 1}, {"any", 1}, {"these", 1}, {"give", 1}, {"day", 1},
+        {"most", 1}, {"us", 1}};
+    return dictionary.find(word) != dictionary.end();
+}
+
+bool indexLookup(const std::string& word)
+{
+    return Dictionary::builtin().contains(word);
+}
+
+// Solve one line the way caesarSolver does, with the given lookup. Returns the
+// best score so the work cannot be optimized away.
+template<typename Lookup>
+double solveLine(std::string line, Lookup lookup)
+{
+    std::transform(line.begin(), line.end(), line.begin(), ::tolower);
+
+    double bestScore = -1.;
+    for (int shift = 0; shift < ALPHABET_LENGTH; shift++) {
+        std::string shifted = line;
+        for (auto& c : shifted) {
+            if (c >= 'a' && c <= 'z') {
+                c = 'a' + (c - 'a' + shift) % ALPHABET_LENGTH;
+            }
+        }
+
+        std::stringstream strstr(shifted);
+        std::istream_iterator<std::string> it(strstr);
+        std::istream_iterator<std::string> end;
+        std::vector<std::string> words(it, end);
+
+        double score = 0.;
+        for (const std::string& word : words) {
+            if (lookup(word)) {
+                score += 1.;
+            }
+        }
+        score /= words.size();
+        bestScore = std::max(bestScore, score);
+    }
+    return bestScore;
+}
+
+// Time every line of the input, repeated, and return microseconds per line
+template<typename Lookup>
+double timeLines(const std::vector<std::string>& lines, int repetitions, Lookup lookup, double& checksum)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < repetitions; rep++) {
+        for (const auto& line : lines) {
+            checksum += solveLine(line, lookup);
+        }
+    }
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (lines.size() * repetitions);
+}
+
+int main(int argc, char* argv[])
+{
+    const std::string filePath = (argc > 1) ? argv[1] : "cypher_text.txt";
+    const int repetitions = (argc > 2) ? std::stoi(argv[2]) : 20;
+
+    std::vector<std::string> lines;
+    std::ifstream inFile(filePath);
+    std::string line;
+    while (std::getline(inFile, line)) {
+        lines.push_back(line);
+    }
+    if (lines.empty()) {
+        std::cout << "Unable to read lines from \"" << filePath << "\"." << std::endl;
+        return 1;
+    }
+
+    double mapChecksum = 0.;
+    double indexChecksum = 0.;
+    const auto mapTime = timeLines(lines, repetitions, mapLookup, mapChecksum);
+    const auto indexTime = timeLines(lines, repetitions, indexLookup, indexChecksum);
+
+    std::cout << lines.size() << " lines x " << repetitions << " repetitions" << std::endl;
+    std::cout << "std::map per lookup: " << mapTime << " us/line" << std::endl;
+    std::cout << "Dictionary index:    " << indexTime << " us/line" << std::endl;
+    std::cout << "Speedup:             " << mapTime / indexTime << "x" << std::endl;
+
+    if (argc > 3) {
+        const auto start = std::chrono::steady_clock::now();
+        const auto wordList = Dictionary::fromFile(argv[3]);
+        const std::chrono::duration<double, std::milli> loadTime = std::chrono::steady_clock::now() - start;
+        if (!wordList) {
+            std::cout << "Unable to open dictionary \"" << argv[3] << "\"." << std::endl;
+            return 1;
+        }
+
+        double fileChecksum = 0.;
+        const auto fileTime = timeLines(lines, repetitions, [&wordList](const std::string& word) {
+            return wordList->contains(word);
+        }, fileChecksum);
+        std::cout << "Word list load:      " << loadTime.count() << " ms for " << wordList->size() << " words" << std::endl;
+        std::cout << "Word list index:     " << fileTime << " us/line" << std::endl;
+    }
+
+    // Both lookups must agree on every score
+    return (mapChecksum == indexChecksum) ? 0 : 1;
+}
@@ -0,0 +1,170 @@
+/*****************************************************************************
+ * File: morseBench.cpp
+ *
+ * Description: Throughput of the Morse tree decoder against the original
+ *              decoder from morseSolver, which built each letter in a string
+ *              and looked it up in a std::map. The corpus is generated lines
+ *              of random words in the morseSolver format ('0' dash, '1' dot,
+ *              '-' between letters, ' ' between words), and the decoded
+ *              lines are checked against the original decoder.
+ *
+ *              Usage: morseBench [megabytes] [repetitions]
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+
+// STL includes
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <random>
+#include <chrono>
+
+// Project includes
+#include "Morse.h"
+
+// The original lookup from morseSolver, its map filled from the same codes
+char legacyMorse2char(std::string in)
+{
+    static std::map<std::string, char> morse = [] {
+        std::map<std::string, char> codes;
+        for (const auto& entry : MORSE_CODES) {
+            codes[std::string(entry.code)] = entry.character;
+        }
+        return codes;
+    }();
+
+    if(morse.find(in) != morse.end()) {
+        return morse.at(in);
+    } else {
+        return '*';
+    }
+}
+
+// The original message decoder from morseSolver
+std::string legacyDecodeMorse(std::string_view morseMessage)
+{
+    std::string output("");
+    std::string buffer("");
+
+    auto msg = morseMessage.data();
+    auto length = morseMessage.size();
+
+    for(unsigned int i = 0; i < length; i++) {
+        switch(msg[i]) {
+            case '0':
+                buffer += "-";
+                break;
+            case '1':
+                buffer += ".";
+                break;
+            case ' ':
+                if(!buffer.empty()) {
+                    output += legacyMorse2char(buffer);
+                }
+                buffer.clear();
+                output += " ";
+                break;
+            case '-':
+                output += legacyMorse2char(buffer);
+                buffer.clear();
+                break;
+            default:
+                buffer.clear();
+                output += "*";
+                break;
+        }
+    }
+
+    if(!buffer.empty()) {
+        output += legacyMorse2char(buffer);
+    }
+    return output;
+}
+
+// Decode every line, repeated, and return MB/s
+template<typename Func>
+double throughput(const std::vector<std::string>& lines, std::size_t bytes, int repetitions,
+                  std::vector<std::string>& output, Func func)
+{
+    output.resize(lines.size());
+    double seconds = 0.;
+    for (int rep = 0; rep < repetitions; rep++) {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < lines.size(); i++) {
+            func(lines[i], output[i]);
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        seconds += elapsed.count();
+    }
+    return (static_cast<double>(bytes) * repetitions) / seconds / 1e6;
+}
+
+int main(int argc, char* argv[])
+{
+    const std::size_t megabytes = (argc > 1) ? std::stoul(argv[1]) : 8;
+    const int repetitions = (argc > 2) ? std::stoi(argv[2]) : 5;
+
+    // Morse for each letter, written as morseSolver reads it
+    std::vector<std::string> letters;
+    for (char letter = 'a'; letter <= 'z'; letter++) {
+        for (const auto& entry : MORSE_CODES) {
+            if (entry.character == letter) {
+                std::string code(entry.code);
+                for (auto& element : code) {
+                    element = (element == '-') ? '0' : '1';
+                }
+                letters.push_back(code);
+            }
+        }
+    }
+
+    // Lines of about 10 words of 2 to 9 letters
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> pickLetter(0, letters.size() - 1);
+    std::uniform_int_distribution<int> pickLength(2, 9);
+    std::vector<std::string> lines;
+    std::size_t bytes = 0;
+    while (bytes < (megabytes << 20)) {
+        std::string line;
+        for (int word = 0; word < 10; word++) {
+            if (word > 0) {
+                line += ' ';
+            }
+            const int length = pickLength(generator);
+            for (int letter = 0; letter < length; letter++) {
+                if (letter > 0) {
+                    line += '-';
+                }
+                line += letters[pickLetter(generator)];
+            }
+        }
+        bytes += line.size() + 1;
+        lines.push_back(std::move(line));
+    }
+
+    std::vector<std::string> expected;
+    std::vector<std::string> output;
+    std::cout << lines.size() << " lines, " << bytes << " bytes x " << repetitions << " repetitions" << std::endl;
+    const auto before = throughput(lines, bytes, repetitions, expected,
+                                   [](const std::string& line, std::string& decoded) {
+        decoded = legacyDecodeMorse(line);
+    });
+    const auto after = throughput(lines, bytes, repetitions, output,
+                                  [](const std::string& line, std::string& decoded) {
+        decodeMorse(line, decoded);
+    });
+    std::cout << "Original map decoder: " << before << " MB/s" << std::endl;
+    std::cout << "Tree table decoder:   " << after << " MB/s (" << after / before << "x)" << std::endl;
+
+    if (output != expected) {
+        std::cout << "Tree decoder output does not match the original decoder!" << std::endl;
+        return 1;
+    }
+    return 0;
+}
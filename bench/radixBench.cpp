@@ -0,0 +1,273 @@
+/*****************************************************************************
+ * File: radixBench.cpp
+ *
+ * Description: Tokens per second of the table-driven radix decoders against
+ *              the original pow()-based hex2char(), oct2char() and
+ *              ascii2char() from the hex, octal and ascii solvers, on
+ *              generated tokens for the printable characters. The decoded
+ *              characters are checked against the original functions.
+ *
+ *              Also times whole-message decoding of a generated hex dump,
+ *              octal and decimal message against the original boost::split
+ *              solvers (hex at every instruction set this CPU supports, as
+ *              only hex messages are scanned with vector instructions), and
+ *              counts the heap allocations per line when each line of a
+ *              message is decoded into a reused buffer.
+ *
+ *              Usage: radixBench [tokens] [repetitions]
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+
+// STL includes
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+// Boost includes
+#include <boost/algorithm/string.hpp>
+
+// Project includes
+#include "CommonUtils.h"
+#include "Radix.h"
+
+// Every heap allocation made by the program
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    allocations++;
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+typedef void (*MessageDecoder)(std::string_view, std::string&);
+
+// The original hex lookup from hexSolver
+char legacyHex2char(const std::string& in)
+{
+    auto length = in.size() - 1;
+    auto cstr = in.c_str();
+    int val = 0;
+    int retVal = 0;
+    int power = 0;
+    for(int i = length; i >= 0; i--, power++) {
+        const auto character = cstr[i];
+        switch (character) {
+            case 'a': case 'b': case 'c': case 'd': case 'e': case 'f':
+                val = character - 'a' + 10;
+                break;
+            case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+                val = character - 'A' + 10;
+                break;
+            default:
+                val = character - '0';
+                break;
+        }
+        if(val > 0 && val < 16)
+            retVal += val * pow(16, power);
+    }
+    return (char)retVal;
+}
+
+// The original octal lookup from octSolver
+char legacyOct2char(const std::string& in)
+{
+    int retVal = 0;
+    int power = 0;
+    auto cstr = in.c_str();
+    for(int i = in.size() - 1; i >= 0; i--, power++) {
+        const int val = cstr[i] - '0';
+        if(val > 0 && val < 8)
+            retVal += val * pow(8, power);
+    }
+    return (char)retVal;
+}
+
+// The original decimal lookup from asciiSolver
+char legacyAscii2char(const std::string& in)
+{
+    int retVal = 0;
+    int power = 0;
+    auto cstr = in.c_str();
+    for(int i = in.size() - 1; i >= 0; i--, power++) {
+        const int val = cstr[i] - '0';
+        if(val > 0 && val < 10)
+            retVal += val * pow(10, power);
+    }
+    return (char)retVal;
+}
+
+// The original message solvers: split into a vector of token strings and
+// decode each one
+template<typename Decode>
+std::string legacyDecode(std::string_view message, const char* separators, Decode decode)
+{
+    std::vector<std::string> tokens;
+    boost::split(tokens, message, boost::is_any_of(separators), boost::token_compress_on);
+    std::vector<char> ret(tokens.size());
+    ret.clear();
+    for (auto tok : tokens) {
+        if(!tok.empty())
+            ret.push_back(decode(tok));
+    }
+    return std::string(ret.begin(), ret.end());
+}
+
+// Decode the message, repeated, and return MB/s
+template<typename Func>
+double messageRate(const std::string& message, int repetitions, std::string& output, Func func)
+{
+    double seconds = 0.;
+    for (int rep = 0; rep < repetitions; rep++) {
+        const auto start = std::chrono::steady_clock::now();
+        output = func(message);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        seconds += elapsed.count();
+    }
+    return (static_cast<double>(message.size()) * repetitions) / seconds / 1e6;
+}
+
+// Decode every token, repeated, and return millions of tokens per second
+template<typename Func>
+double tokenRate(const std::vector<std::string>& tokens, int repetitions, std::string& output, Func func)
+{
+    double seconds = 0.;
+    for (int rep = 0; rep < repetitions; rep++) {
+        output.clear();
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& token : tokens) {
+            output.push_back(func(token));
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        seconds += elapsed.count();
+    }
+    return (static_cast<double>(tokens.size()) * repetitions) / seconds / 1e6;
+}
+
+// Only hex messages are scanned with vector instructions, so only simd
+// decoders are timed at each instruction set
+template<typename Legacy, typename Table>
+bool compare(const char* name, const char* format, const char* separators, std::size_t count,
+             int repetitions, Legacy legacy, Table table, MessageDecoder decodeMessage, bool simd)
+{
+    // Codes of printable characters, as they appear in the puzzles
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> pick(32, 126);
+    std::vector<std::string> tokens(count);
+    char buffer[8];
+    for (auto& token : tokens) {
+        std::snprintf(buffer, sizeof(buffer), format, pick(generator));
+        token = buffer;
+    }
+
+    std::string expected;
+    std::string output;
+    const auto before = tokenRate(tokens, repetitions, expected, legacy);
+    const auto after = tokenRate(tokens, repetitions, output, table);
+    std::cout << name << ": original " << before << " M tokens/s, table " << after
+              << " M tokens/s (" << after / before << "x)" << std::endl;
+    if (output != expected) {
+        return false;
+    }
+
+    // The same codes as one message
+    std::string message;
+    for (const auto& token : tokens) {
+        message += token;
+        message += ' ';
+    }
+    const auto split = messageRate(message, repetitions, expected, [&](const std::string& text) {
+        return legacyDecode(text, separators, legacy);
+    });
+    std::cout << "  message, original split: " << split << " MB/s" << std::endl;
+
+    const char* names[] = {"scalar", "SSE", "AVX2"};
+    const auto best = simdLevel();
+    const int top = simd ? best : SIMD_SCALAR;
+    bool matches = true;
+    for (int level = SIMD_SCALAR; level <= top; level++) {
+        setSimdLevel(static_cast<SimdLevel>(level));
+        const auto bulk = messageRate(message, repetitions, output, [&](const std::string& text) {
+            std::string decoded;
+            decodeMessage(text, decoded);
+            return decoded;
+        });
+        matches = matches && (output == expected);
+        std::cout << "  message, " << (simd ? names[level] : "Tokens") << " scan: " << bulk << " MB/s" << std::endl;
+    }
+    setSimdLevel(best);
+
+    // The message as lines of 20 codes, decoded one at a time
+    std::vector<std::string_view> lines;
+    for (std::size_t start = 0; start < message.size();) {
+        std::size_t end = start;
+        for (int code = 0; code < 20 && end < message.size(); code++) {
+            end = message.find(' ', end) + 1;
+        }
+        lines.emplace_back(message.data() + start, end - start);
+        start = end;
+    }
+
+    std::size_t counted = allocations;
+    for (const auto line : lines) {
+        legacyDecode(line, separators, legacy);
+    }
+    const double legacyAllocations = static_cast<double>(allocations - counted) / lines.size();
+
+    // Once the buffer has grown to the longest line, no more are needed
+    std::string decoded;
+    for (const auto line : lines) {
+        decodeMessage(line, decoded);
+    }
+    counted = allocations;
+    for (const auto line : lines) {
+        decodeMessage(line, decoded);
+    }
+    const double reusedAllocations = static_cast<double>(allocations - counted) / lines.size();
+    std::cout << "  heap allocations per line: original " << legacyAllocations
+              << ", reused buffer " << reusedAllocations << std::endl;
+
+    return matches;
+}
+
+int main(int argc, char* argv[])
+{
+    const std::size_t count = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+    const int repetitions = (argc > 2) ? std::stoi(argv[2]) : 10;
+
+    std::cout << count << " tokens x " << repetitions << " repetitions" << std::endl;
+    bool matches = compare("hex  ", "%02X", ", \r\n", count, repetitions, legacyHex2char,
+                           [](const std::string& token) { return hex2char(token); }, decodeHex, true);
+    matches = compare("octal", "%o", ", \r\n", count, repetitions, legacyOct2char,
+                      [](const std::string& token) { return oct2char(token); }, decodeOct, false) && matches;
+    matches = compare("ascii", "%d", " \r\n", count, repetitions, legacyAscii2char,
+                      [](const std::string& token) { return ascii2char(token); }, decodeAscii, false) && matches;
+
+    if (!matches) {
+        std::cout << "Table decoder output does not match the original functions!" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,180 @@
+/*****************************************************************************
+ * File: shiftBench.cpp
+ *
+ * Description: Throughput of the letter shift kernels against the original
+ *              scalar loops from caesarSolver's shift() and keyShiftCypher's
+ *              solver(), on a generated buffer of lowercase text with spaces
+ *              and punctuation. Each kernel is run at every instruction set
+ *              this CPU supports and checked against the original loop, and
+ *              on the same text with some letters uppercased, whose case it
+ *              must keep. The general substitution kernel is timed with a
+ *              keyed alphabet and checked against a plain table lookup.
+ *
+ *              Usage: shiftBench [megabytes] [repetitions]
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+
+// STL includes
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+
+// Project includes
+#include "CommonUtils.h"
+#include "ShiftKernel.h"
+#include "Substitution.h"
+
+static const int ALPHABET_LENGTH = 26;
+
+// The original Caesar loop from caesarSolver's shift()
+void legacyCaesar(std::string& shifted, unsigned int shift)
+{
+    char* pChar = &shifted.front();
+    for (unsigned int count = 0; count < shifted.size(); count++) {
+        if (pChar[count] >= 'a' && pChar[count] <= 'z') {
+            pChar[count] += shift;
+            if ((unsigned int)(pChar[count]) > (unsigned int)('z')) {
+                pChar[count] -= ALPHABET_LENGTH;
+            }
+        }
+    }
+}
+
+// The original key shift loop from keyShiftCypher's solver()
+void legacyKeyShift(std::string& decrypted, const std::string& key)
+{
+    const int keylength = key.length();
+    int ignoreChars = 0;
+    for (unsigned int cryptIdx = 0; cryptIdx < decrypted.length(); cryptIdx++) {
+        auto c = decrypted.at(cryptIdx);
+        if (c >= 'a' && c <= 'z') {
+            const int keyIdx = (cryptIdx - ignoreChars) % keylength;
+            auto temp = ((c - key.at(keyIdx)) % ALPHABET_LENGTH);
+            if (temp < 0) {
+                temp += ALPHABET_LENGTH;
+            }
+            decrypted[cryptIdx] = temp + 'a';
+        } else {
+            ignoreChars++;
+        }
+    }
+}
+
+// Uppercase every third letter of text
+std::string mixCase(std::string text)
+{
+    for (std::size_t i = 0; i < text.size(); i += 3) {
+        if (text[i] >= 'a' && text[i] <= 'z') {
+            text[i] = static_cast<char>(text[i] - 'a' + 'A');
+        }
+    }
+    return text;
+}
+
+// Run func on a fresh copy of the input, repeated, and return GB/s
+template<typename Func>
+double throughput(const std::string& input, int repetitions, std::string& output, Func func)
+{
+    double seconds = 0.;
+    for (int rep = 0; rep < repetitions; rep++) {
+        output = input;
+        const auto start = std::chrono::steady_clock::now();
+        func(output);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        seconds += elapsed.count();
+    }
+    return (static_cast<double>(input.size()) * repetitions) / seconds / 1e9;
+}
+
+int main(int argc, char* argv[])
+{
+    const std::size_t megabytes = (argc > 1) ? std::stoul(argv[1]) : 64;
+    const int repetitions = (argc > 2) ? std::stoi(argv[2]) : 10;
+
+    // Mostly letters, with the spaces and punctuation of ordinary text
+    const std::string alphabet = "abcdefghijklmnopqrstuvwxyzetaoinshrd    ,.?'\"!";
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> pick(0, alphabet.size() - 1);
+    std::string input(megabytes << 20, ' ');
+    for (auto& c : input) {
+        c = alphabet[pick(generator)];
+    }
+
+    const unsigned int shift = 13;
+    const std::string key = "ghostinthewires";
+    std::vector<unsigned char> keyShifts;
+    for (const char k : key) {
+        keyShifts.push_back((ALPHABET_LENGTH - (k - 'a')) % ALPHABET_LENGTH);
+    }
+
+    std::string expectedCaesar;
+    std::string expectedKey;
+    std::cout << input.size() << " bytes x " << repetitions << " repetitions" << std::endl;
+    std::cout << "Caesar, original loop:      "
+              << throughput(input, repetitions, expectedCaesar, [&](std::string& s) { legacyCaesar(s, shift); })
+              << " GB/s" << std::endl;
+    std::cout << "Key shift, original loop:   "
+              << throughput(input, repetitions, expectedKey, [&](std::string& s) { legacyKeyShift(s, key); })
+              << " GB/s" << std::endl;
+
+    // Reference for the substitution kernel: each byte through the table
+    Substitution substitution;
+    substitutionFromKey("qwertyuiopasdfghjklzxcvbnm", substitution);
+    std::string expectedSubstitution = mixCase(input);
+    for (auto& c : expectedSubstitution) {
+        c = static_cast<char>(substitution.table[static_cast<unsigned char>(c)]);
+    }
+
+    const std::string mixedInput = mixCase(input);
+    const std::string mixedCaesar = mixCase(expectedCaesar);
+    const std::string mixedKey = mixCase(expectedKey);
+
+    const char* names[] = {"scalar", "SSE", "AVX2"};
+    const auto best = simdLevel();
+    bool matches = true;
+    for (int level = SIMD_SCALAR; level <= best; level++) {
+        setSimdLevel(static_cast<SimdLevel>(level));
+
+        std::string output;
+        const auto caesar = throughput(input, repetitions, output, [&](std::string& s) {
+            shiftLetters(&s[0], s.size(), shift);
+        });
+        matches = matches && (output == expectedCaesar);
+
+        const auto keyed = throughput(input, repetitions, output, [&](std::string& s) {
+            shiftLettersKeyed(&s[0], s.size(), keyShifts.data(), keyShifts.size());
+        });
+        matches = matches && (output == expectedKey);
+
+        const auto substituted = throughput(mixedInput, repetitions, output, [&](std::string& s) {
+            substituteLetters(&s[0], s.size(), substitution);
+        });
+        matches = matches && (output == expectedSubstitution);
+
+        output = mixedInput;
+        shiftLetters(&output[0], output.size(), shift);
+        matches = matches && (output == mixedCaesar);
+        output = mixedInput;
+        shiftLettersKeyed(&output[0], output.size(), keyShifts.data(), keyShifts.size());
+        matches = matches && (output == mixedKey);
+
+        std::cout << "Caesar, " << names[level] << " kernel:" << std::string(11 - std::string(names[level]).size(), ' ')
+                  << caesar << " GB/s" << std::endl;
+        std::cout << "Key shift, " << names[level] << " kernel:" << std::string(8 - std::string(names[level]).size(), ' ')
+                  << keyed << " GB/s" << std::endl;
+        std::cout << "Substitute, " << names[level] << " kernel:" << std::string(7 - std::string(names[level]).size(), ' ')
+                  << substituted << " GB/s" << std::endl;
+    }
+
+    if (!matches) {
+        std::cout << "Kernel output does not match the original loops!" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,18 @@
+CC=g++
+CFLAGS=-c -Wall -O2
+LDFLAGS=
+SOURCES=bench/dictionaryBench.cpp src/Dictionary.cpp src/CommonUtils.cpp
+OBJECTS=$(SOURCES:.cpp=.o)
+EXECUTABLE=bin/dictionaryBench
+
+all: $(SOURCES) $(EXECUTABLE)
+	
+$(EXECUTABLE): $(OBJECTS) 
+	$(CC) -std=c++17 -Iinclude/ $(LDFLAGS) $(OBJECTS) -o $@
+
+.cpp.o:
+	$(CC) -std=c++17 -Iinclude/ $(CFLAGS) $< -o $@
+	
+clean:
+	@echo " Cleaning..."; 
+	@echo " $(RM) $(EXECUTABLE)"; $(RM) $(EXECUTABLE)
\ No newline at end of file
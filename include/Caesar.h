@@ -0,0 +1,126 @@
+/*****************************************************************************
+ * File: Caesar.h
+ *
+ * Description: Caesar cypher solving engine. Brute-forces the 26 shifts of a
+ *              string in memory and returns the one most like English, so
+ *              any program can solve Caesar text without running
+ *              caesarSolver.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Project includes
+#include "CommonUtils.h"
+#include "Dictionary.h"
+#include "Scorer.h"
+
+// A Caesar shift tried by CaesarSolver::rank()
+struct CaesarCandidate {
+    // Added to every letter to decrypt, 0-25
+    unsigned int shift;
+
+    // Scorer's score of the decryption; higher is more like English
+    double score;
+
+    // Share of the belief among the shifts scored, 0-1: the softmax of the
+    // scores in units of their standard deviation
+    double confidence;
+};
+
+class CaesarSolver
+{
+public:
+    // Solver using the given scorer to pick among the 26 shifts. A null scorer
+    // picks the shift from the letter histogram instead (see bestShift()).
+    explicit CaesarSolver(std::unique_ptr<Scorer> scorer);
+
+    // Solver configured from the command line options:
+    //   -m <method>    words (default), chi, quad or hist
+    //   -d <file>      word list for the words method
+    //   -q <file>      quadgram counts for the quad method
+    //   -e <margin>    stop scoring shifts once the best leads by this much
+    //                  (in the method's score units; default 0, score all)
+    // Prints a message and returns null if an option is invalid.
+    static std::unique_ptr<CaesarSolver> fromOptions(const Options& options);
+
+    // Solve the cypher text and return the plain text, with the case and
+    // punctuation of the cypher text. The scorers fold case. Safe to call
+    // from several threads at once.
+    std::string solve(std::string_view cypherText) const;
+
+    // Solve every line of the block into plainTexts, in order, replacing what
+    // it held. Each line is scored against the one shared scoring model and
+    // decrypted straight into the output arena, so a reused output block
+    // does not allocate per line. When the solver solves families, lines
+    // that are rotations of each other are scored once per block, by their
+    // canonical form (see canonicalForm()). Safe to call from several threads at once with their
+    // own blocks.
+    void solveBatch(const LineBlock& cypherTexts, LineBlock& plainTexts) const;
+
+    // The count best shifts for the cypher text, best first; ties go to the
+    // lower shift. Shifts are scored in order of how well their letter
+    // frequencies match English. With a margin above 0, scoring stops as soon
+    // as the best shift so far leads the next by at least the margin, so clear
+    // cut texts score only a few shifts.
+    std::vector<CaesarCandidate> rank(std::string_view cypherText, std::size_t count) const;
+
+    // The shift solve() decrypts the cypher text with. Depends only on the
+    // letters, not their case.
+    unsigned int solveShift(std::string_view cypherText) const;
+
+    // Shift-invariant form of the text: letters lowercased and rotated so the
+    // first is 'a', other bytes kept, so texts that are Caesar rotations of
+    // each other in any case share it. Built in canonical, reusing its
+    // capacity. Returns the text's offset from it, the index of its first
+    // letter (0 without letters).
+    static unsigned int canonicalForm(std::string_view text, std::string& canonical);
+
+    // Whether a family of rotations can be solved once from its canonical
+    // form: true when every shift is scored by a scorer (no histogram, no
+    // early exit), so a text's scores do not depend on which rotation it is
+    bool solvesFamilies() const { return m_scorer && m_margin == 0.; }
+
+    // Score of every shift of the text, e.g. a canonical form. Only for
+    // solvers that solve families.
+    void scoreShifts(std::string_view text, std::array<double, 26>& scores) const;
+
+    // Shift, as solve() picks it, for a text at the given offset from a
+    // canonical form with the given shift scores. The text's shift t scores
+    // as the canonical form's shift t + offset; ties still go to the lowest
+    // t, so the choice matches scoring the text itself.
+    static unsigned int memberShift(const std::array<double, 26>& canonicalScores, unsigned int offset);
+
+    // rank() for a text at the given offset from a canonical form with the
+    // given shift scores, as memberShift() is to solveShift()
+    static std::vector<CaesarCandidate> memberRank(const std::array<double, 26>& canonicalScores,
+                                                   unsigned int offset, std::size_t count);
+
+    // The cypher text decrypted with the given shift, keeping case
+    static std::string decrypt(std::string_view cypherText, unsigned int shift);
+
+private:
+    // rank() into the given vector, reusing its capacity, optionally leaving
+    // the confidence at 0 to save its cost
+    void rankShifts(std::string_view cypherText, std::size_t count, bool withConfidence,
+                    std::vector<CaesarCandidate>& ranked) const;
+
+    // Data the scorer refers to, when loaded from files
+    std::unique_ptr<Dictionary> m_wordList;
+    std::unique_ptr<QuadgramScorer> m_quadgrams;
+
+    std::unique_ptr<Scorer> m_scorer;
+
+    // Early exit margin; 0 scores every shift
+    double m_margin = 0.;
+};
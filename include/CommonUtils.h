@@ -11,7 +11,22 @@
 #pragma once
 
 // Library includes
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 // Enum defining whether the program is to solve a file of cypher strings or 
 // an individual cypher string
@@ -21,9 +36,300 @@ enum Solver {
     SOLVE_STRING = 2
 };
 
+// Enum defining the widest vector instruction set the byte kernels may use
+enum SimdLevel {
+    SIMD_SCALAR = 0,
+    SIMD_SSE2 = 1,
+    SIMD_AVX2 = 2
+};
+
+// Command line options that take a value (e.g. "-d words.txt"), keyed by flag
+typedef std::map<std::string, std::string> Options;
+
 // Simple function to parse the command line. The program takes either
 // 1) a file path to a text file listing encrypted strigns
 // 2) an encrypted string
 // The out string is either the file path or encrypted string; its context is
 // determined by the returned solver enum.
-Solver parseCLI(const int argc, char* argv[], std::string &out);
\ No newline at end of file
+Solver parseCLI(const int argc, char* argv[], std::string &out);
+
+// As above, but also collects any other "-flag value" pairs into options so
+// individual programs can accept their own settings ahead of -f or -s.
+Solver parseCLI(const int argc, char* argv[], std::string &out, Options &options);
+
+// Set of separator bytes, built at compile time as a 256-bit bitmap:
+//   constexpr SeparatorSet CODE_SEPARATORS(", \r\n");
+class SeparatorSet
+{
+public:
+    constexpr explicit SeparatorSet(std::string_view separators)
+    {
+        for (const char c : separators) {
+            const auto byte = static_cast<unsigned char>(c);
+            m_bits[byte >> 6] |= std::uint64_t(1) << (byte & 63);
+        }
+    }
+
+    constexpr bool contains(char c) const
+    {
+        const auto byte = static_cast<unsigned char>(c);
+        return (m_bits[byte >> 6] >> (byte & 63)) & 1;
+    }
+
+private:
+    std::uint64_t m_bits[4] = {};
+};
+
+// The non-empty runs of text between separators, as views into the text, so
+// nothing is allocated or copied:
+//   for (const auto token : Tokens(text, CODE_SEPARATORS)) { ... }
+class Tokens
+{
+public:
+    class iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::string_view value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const std::string_view* pointer;
+        typedef const std::string_view& reference;
+
+        iterator() = default;
+        iterator(const char* next, const char* end, const SeparatorSet* separators)
+            : m_next(next), m_end(end), m_separators(separators)
+        {
+            advance();
+        }
+
+        reference operator*() const { return m_token; }
+        pointer operator->() const { return &m_token; }
+        iterator& operator++() { advance(); return *this; }
+        iterator operator++(int) { iterator previous = *this; advance(); return previous; }
+
+        // Past the last token the view is null, the same as the end iterator
+        bool operator==(const iterator& other) const { return m_token.data() == other.m_token.data(); }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+
+    private:
+        void advance()
+        {
+            while (m_next < m_end && m_separators->contains(*m_next)) {
+                m_next++;
+            }
+            if (m_next == m_end) {
+                m_token = std::string_view();
+                return;
+            }
+            const char* start = m_next;
+            while (m_next < m_end && !m_separators->contains(*m_next)) {
+                m_next++;
+            }
+            m_token = std::string_view(start, m_next - start);
+        }
+
+        const char* m_next = nullptr;
+        const char* m_end = nullptr;
+        const SeparatorSet* m_separators = nullptr;
+        std::string_view m_token;
+    };
+
+    Tokens(std::string_view text, const SeparatorSet& separators)
+        : m_text(text), m_separators(separators) {}
+
+    iterator begin() const { return iterator(m_text.data(), m_text.data() + m_text.size(), &m_separators); }
+    iterator end() const { return iterator(); }
+
+private:
+    std::string_view m_text;
+    const SeparatorSet& m_separators;
+};
+
+// The vector instruction set the byte kernels use: the best the CPU supports,
+// detected on first use, unless lowered with setSimdLevel().
+SimdLevel simdLevel();
+
+// Limit the byte kernels to the given instruction set, e.g. to compare
+// throughput. Levels the CPU does not support are clamped to the best it does.
+void setSimdLevel(SimdLevel level);
+
+// Return if the CPU supports SSSE3, which the SSE kernels need for byte
+// shuffles (pshufb). Not affected by setSimdLevel().
+bool hasSsse3();
+
+// Read-only view of a whole file, memory-mapped where the platform allows so
+// large inputs load without copying. An empty or unreadable file gives an
+// empty view; check isOpen() to tell the two apart.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& filePath);
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const { return m_open; }
+    bool isMapped() const { return m_mapped; }
+    std::string_view view() const { return std::string_view(m_data, m_size); }
+
+private:
+    void release();
+
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_open = false;
+    bool m_mapped = false;
+
+    // Fallback storage when the file cannot be mapped
+    std::string m_buffer;
+};
+
+// 64-bit hash of the text, eight bytes at a time
+inline std::uint64_t hashText(std::string_view text)
+{
+    const std::uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+    std::uint64_t hash = text.size() * multiplier;
+    std::size_t i = 0;
+    for (; i + 8 <= text.size(); i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, text.data() + i, sizeof(word));
+        hash = (hash ^ word) * multiplier;
+        hash ^= hash >> 29;
+    }
+    std::uint64_t tail = 0;
+    if (i < text.size()) {
+        std::memcpy(&tail, text.data() + i, text.size() - i);
+    }
+    hash = (hash ^ tail) * multiplier;
+    return hash ^ (hash >> 32);
+}
+
+// A block of lines stored back to back in one byte arena, with the offset at
+// which each starts plus one past the end of the last, so batch solvers walk
+// one contiguous buffer instead of a string per line. Clearing keeps the
+// capacity, so a reused block stops allocating once it has held its largest
+// batch.
+class LineBlock
+{
+public:
+    void clear();
+
+    // Append a copy of the line and return its bytes in the arena, to be
+    // changed in place. Valid until the next append() or clear().
+    char* append(std::string_view line);
+
+    std::size_t size() const { return m_offsets.size() - 1; }
+    bool empty() const { return size() == 0; }
+
+    std::string_view operator[](std::size_t index) const
+    {
+        return std::string_view(m_arena.data() + m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+    }
+
+    // The lines back to back, and where each starts
+    const std::string& arena() const { return m_arena; }
+    const std::vector<std::size_t>& offsets() const { return m_offsets; }
+
+private:
+    std::string m_arena;
+    std::vector<std::size_t> m_offsets{0};
+};
+
+// Number of worker threads requested with "-j <count>", or 0 (one per core)
+// if not given or not a positive number.
+unsigned int jobsOption(const Options &options);
+
+// Fixed set of worker threads sharing submitted tasks. Each worker has its own
+// queue; tasks are dealt round-robin across the queues and a worker that runs
+// out of work steals from the others.
+class ThreadPool
+{
+public:
+    // Start the given number of workers; 0 means one per hardware thread.
+    explicit ThreadPool(unsigned int threads = 0);
+
+    // Finish every queued task, then stop the workers
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Queue a task to run on one of the workers
+    void submit(std::function<void()> task);
+
+    // Block until every submitted task has finished
+    void wait();
+
+    unsigned int size() const { return static_cast<unsigned int>(m_threads.size()); }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void run(unsigned int index);
+
+    // Take the oldest task from the worker's own queue, else steal the newest
+    // from another worker's queue
+    bool takeTask(unsigned int index, std::function<void()>& task);
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread> m_threads;
+    std::atomic<unsigned int> m_nextQueue{0};
+
+    // Tasks queued and tasks not yet finished, guarded by m_mutex
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    std::size_t m_queued = 0;
+    std::size_t m_unfinished = 0;
+    bool m_stop = false;
+};
+
+// Per-line solve and output callbacks for solveStream() and solveFile()
+// Lines are passed as views, valid only for the duration of the call.
+typedef std::function<std::string(std::string_view)> LineSolver;
+typedef std::function<void(std::string_view, const std::string&)> LineEmitter;
+
+// Solve callback for a batch of consecutive lines, storing the result for
+// lines[i] in results[i]. results comes sized to the lines, its strings left
+// over from an earlier batch, so assigning into them reuses their capacity.
+typedef std::function<void(const std::vector<std::string_view>&, std::vector<std::string>&)> BatchSolver;
+
+// Solve each line of the input with solve() across a pool of the given number
+// of workers (0 means one per core), passing each line and its result to
+// emit() on the calling thread in input order. A reader thread hands lines to
+// the pool in chunks while the calling thread writes finished chunks out, and
+// only a bounded number of chunks is in flight at once, so memory use does
+// not grow with the input and output starts as soon as the first chunk is
+// solved.
+void solveStream(std::istream& input, const LineSolver& solve, const LineEmitter& emit,
+                 unsigned int jobs = 0);
+
+// As solveStream(), over lines already in memory, such as a mapped file. Lines
+// are found with memchr() and passed to solve() as slices of the text without
+// being copied.
+void solveText(std::string_view text, const LineSolver& solve, const LineEmitter& emit,
+               unsigned int jobs = 0);
+
+// As solveText(), but solve() is handed each chunk of lines at once (see
+// solveFileBatches()).
+void solveTextBatches(std::string_view text, const BatchSolver& solve, const LineEmitter& emit,
+                      unsigned int jobs = 0);
+
+// Solve the named file line by line as above. Regular files are memory-mapped
+// and solved with solveText(); standard input (path "-"), pipes and devices
+// are streamed with solveStream(). Prints a message and returns false if the
+// file cannot be opened.
+bool solveFile(const std::string& filePath, const LineSolver& solve, const LineEmitter& emit,
+               unsigned int jobs = 0);
+
+// As solveFile(), but solve() is handed each chunk of lines at once, so a
+// solver can run every line through one step before starting the next.
+bool solveFileBatches(const std::string& filePath, const BatchSolver& solve, const LineEmitter& emit,
+                      unsigned int jobs = 0);
@@ -0,0 +1,79 @@
+/*****************************************************************************
+ * File: Dictionary.h
+ *
+ * Description: Read-only word list used to score candidate decryptions. The
+ *              index is built once and probed with string views, so a lookup
+ *              never allocates. Word lists may be the built-in common words
+ *              or a memory-mapped file of any size.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Project includes
+#include "CommonUtils.h"
+
+class Dictionary
+{
+public:
+    // The built-in dictionary: the 100 most common English words. Built on
+    // first use and shared by every caller.
+    static const Dictionary& builtin();
+
+    // Memory-map a word list file and index it. Words are separated by any
+    // whitespace, so one word per line (LF or CRLF) works. Returns null if the
+    // file cannot be read.
+    static std::unique_ptr<Dictionary> fromFile(const std::string& filePath);
+
+    // Load the word list named by the given option, e.g. "-d", into wordList.
+    // Leaves wordList null if the option is not given. Returns false, having
+    // printed why, if the file cannot be read.
+    static bool fromOption(const Options& options, const std::string& flag, std::unique_ptr<Dictionary>& wordList);
+
+    // Return if the word is found in the dictionary. Letters match
+    // regardless of case.
+    bool contains(std::string_view word) const;
+
+    // Number of unique words in the dictionary
+    std::size_t size() const { return m_count; }
+
+private:
+    // Location of a word within m_text. A zero length marks a free slot.
+    struct Entry {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    // Index every word in the text. The text must outlive the dictionary.
+    explicit Dictionary(std::string_view text);
+    explicit Dictionary(MappedFile&& file);
+
+    void index();
+    std::string_view word(const Entry& entry) const
+    {
+        return m_text.substr(entry.offset, entry.length);
+    }
+
+    // Backing storage for file dictionaries; empty for the built-in one
+    MappedFile m_file;
+
+    // Whitespace-separated words the slots point into
+    std::string_view m_text;
+
+    // Open-addressed hash table of words. The size is a power of two kept at
+    // most half full.
+    std::vector<Entry> m_slots;
+    std::size_t m_mask = 0;
+    std::size_t m_count = 0;
+};
@@ -0,0 +1,28 @@
+/*****************************************************************************
+ * File: EnglishQuadgrams.h
+ *
+ * Description: Precomputed English quadgram counts, the model the built-in
+ *              quadgram scorer is built from. Kept in a file of its own as
+ *              the table runs to tens of thousands of entries.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <cstddef>
+#include <cstdint>
+
+// Four uppercase letters and the number of times they were seen in a row
+struct QuadgramCount {
+    char quadgram[5];
+    std::uint32_t count;
+};
+
+// Counts of the English quadgrams seen at least twice in the training text,
+// most common first
+extern const QuadgramCount ENGLISH_QUADGRAMS[];
+extern const std::size_t ENGLISH_QUADGRAM_COUNT;
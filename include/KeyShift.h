@@ -0,0 +1,59 @@
+/*****************************************************************************
+ * File: KeyShift.h
+ *
+ * Description: Key shift (Vigenere) decryption, with or without the key.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Project includes
+#include "Scorer.h"
+
+// Shift each alphabetic character of the encrypted string back by the
+// corresponding character of the key, and return the decrypted string with
+// the case of the encrypted one. Whitespace and punctuation do not use up a
+// key character.
+std::string keyShiftDecrypt(std::string_view encrypted, std::string_view key);
+
+// As above, but decrypts into the given string, reusing its storage
+void keyShiftDecrypt(std::string_view encrypted, std::string_view key, std::string& decrypted);
+
+// The shift (0-25) that undoes each letter of the key, in order. Letters match
+// regardless of case; anything else in the key is skipped.
+void keyShifts(std::string_view key, std::vector<unsigned char>& shifts);
+
+// A key tried by dictionaryAttack() and the score of its decryption
+struct KeyTrial {
+    std::string key;
+    double score;
+};
+
+// Decrypt with every key in the list, split across the given number of
+// workers (0 means one per core), and return the count best scoring keys,
+// best first. Each worker decrypts into one reused buffer, so with an
+// allocation-free scorer (e.g. QuadgramScorer) trials allocate nothing.
+std::vector<KeyTrial> dictionaryAttack(std::string_view encrypted, const std::vector<std::string_view>& keys,
+                                      const Scorer& scorer, std::size_t count, unsigned int jobs = 0);
+
+// Average index of coincidence of the columns the letters (0-25) fall into
+// with a key of the given length. Close to English (about 0.066) when the
+// period is a multiple of the key length, and to random text (0.038) when not.
+double indexOfCoincidence(const std::vector<unsigned char>& letters, unsigned int period);
+
+// Recover the key of a Vigenere (key shift) cypher without knowing it. Every
+// key length up to maxPeriod is tried, in parallel across the given number
+// of workers (0 means one per core) for texts long enough to be worth
+// starting threads for, and the shortest one whose columns have an
+// index of coincidence near the best is taken. Each column is then a Caesar
+// cypher, solved from its letter frequencies with bestShift(). Returns an
+// empty key if the text has too few letters.
+std::string recoverKey(std::string_view encrypted, unsigned int maxPeriod = 20, unsigned int jobs = 0);
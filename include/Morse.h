@@ -0,0 +1,130 @@
+/*****************************************************************************
+ * File: Morse.h
+ *
+ * Description: Morse code decoding.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <array>
+#include <string>
+#include <string_view>
+
+// Morse codes are decoded by walking an implicit binary tree: a letter starts
+// at index MORSE_ROOT and each dot doubles the index and each dash doubles it
+// and adds one, so every code of up to 7 dots and dashes has its own index
+// below 256 and a 256-entry table gives its character. Longer codes end up at
+// MORSE_TOO_LONG.
+const unsigned int MORSE_ROOT = 1;
+const unsigned int MORSE_TOO_LONG = 256;
+
+// Index of the code followed by one more dot or dash
+constexpr unsigned int morseStep(unsigned int code, bool dash)
+{
+    const unsigned int next = code * 2 + (dash ? 1 : 0);
+    return next < MORSE_TOO_LONG ? next : MORSE_TOO_LONG;
+}
+
+struct MorseCode {
+    std::string_view code;
+    char character;
+};
+
+constexpr MorseCode MORSE_CODES[] = {
+    {".-", 'a'},
+    {"-...", 'b'},
+    {"-.-.", 'c'},
+    {"-..", 'd'},
+    {".", 'e'},
+    {"..-.", 'f'},
+    {"--.", 'g'},
+    {"....", 'h'},
+    {"..", 'i'},
+    {".---", 'j'},
+    {"-.-", 'k'},
+    {".-..", 'l'},
+    {"--", 'm'},
+    {"-.", 'n'},
+    {"---", 'o'},
+    {".--.", 'p'},
+    {"--.-", 'q'},
+    {".-.", 'r'},
+    {"...", 's'},
+    {"-", 't'},
+    {"..-", 'u'},
+    {"...-", 'v'},
+    {".--", 'w'},
+    {"-..-", 'x'},
+    {"-.--", 'y'},
+    {"--..", 'z'},
+    {"-----", '0'},
+    {".----", '1'},
+    {"..---", '2'},
+    {"...--", '3'},
+    {"....-", '4'},
+    {".....", '5'},
+    {"-....", '6'},
+    {"--...", '7'},
+    {"---..", '8'},
+    {"----.", '9'},
+    {".-.-.-", '.'},
+    {"--..--", ','},
+    {"..--..", '?'},
+    {".----.", '\''},
+    {"-.-.--", '!'},
+    {"-..-.", '/'},
+    {"-.--.", '('},
+    {"-.--.-", ')'},
+    {".-...", '&'},
+    {"---...", ':'},
+    {"-.-.-.", ';'},
+    {"-...-", '='},
+    {".-.-.", '+'},
+    {"-....-", '-'},
+    {"..--.-", '_'},
+    {".-..-.", '"'},
+    {"...-..-", '$'},
+    {".--.-.", '@'},
+};
+
+// Character of each tree index, or '*' where there is no code
+constexpr std::array<char, MORSE_TOO_LONG + 1> makeMorseTable()
+{
+    std::array<char, MORSE_TOO_LONG + 1> table{};
+    for (auto& character : table) {
+        character = '*';
+    }
+    for (const auto& entry : MORSE_CODES) {
+        unsigned int code = MORSE_ROOT;
+        for (const char element : entry.code) {
+            code = morseStep(code, element == '-');
+        }
+        table[code] = entry.character;
+    }
+    return table;
+}
+
+inline constexpr std::array<char, MORSE_TOO_LONG + 1> MORSE_TABLE = makeMorseTable();
+
+// Character of a tree index, or '*' if it is not a Morse code
+constexpr char morseChar(unsigned int code)
+{
+    return MORSE_TABLE[code];
+}
+
+// Lookup the encoded text (dashes '-' and dots '.') and return the decoded
+// character, or '*' if it is not a Morse code
+char morse2char(std::string_view in);
+
+// Decode a Morse code message. Dashes are written '0', dots '1', letters are
+// separated by '-' and words by ' '. Unknown codes decode to '*'.
+std::string decodeMorse(std::string_view morseMessage);
+
+// As above, replacing the contents of output so its buffer can be reused.
+// Letters are decoded through the tree with no string operations.
+void decodeMorse(std::string_view morseMessage, std::string& output);
@@ -0,0 +1,75 @@
+/*****************************************************************************
+ * File: MorseSegmenter.h
+ *
+ * Description: Decoding of Morse code whose letter separators were dropped,
+ *              by searching for the split of the dots and dashes into
+ *              letters that reads most like English.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Project includes
+#include "CommonUtils.h"
+#include "Dictionary.h"
+#include "Scorer.h"
+
+class MorseSegmenter
+{
+public:
+    // Segmenter scoring letters with the quadgram model and words with the
+    // dictionary, which must outlive it, keeping the given number of best
+    // partial decodings at each point of a message.
+    MorseSegmenter(const QuadgramScorer& quadgrams, const Dictionary& dictionary, std::size_t beamWidth = 64);
+
+    // Segmenter configured from the command line options:
+    //   -d <file>      word list (default: the built-in common words)
+    //   -q <file>      quadgram counts (default: the built-in model)
+    //   -b <count>     beam width (default 64)
+    // Prints a message and returns null if an option is invalid.
+    static std::unique_ptr<MorseSegmenter> fromOptions(const Options& options);
+
+    // Decode a message in the morseSolver format ('0' dash, '1' dot, ' '
+    // between words) in which some or all of the '-' letter separators are
+    // missing. Runs of dots and dashes are split into letters a-z with a
+    // Viterbi search over the Morse tree: each partial decoding is scored by
+    // the log probability of its letters given the three before, plus a bonus
+    // for each complete dictionary word, and only the best beamWidth at each
+    // position are extended, so time grows linearly with the message.
+    // Separators that are present are kept as letter boundaries; other
+    // characters decode to '*'.
+    std::string segment(std::string_view morseMessage) const;
+
+private:
+    // A partial decoding ending at a letter boundary. Decoded characters are
+    // kept as a chain of nodes back to the start of the message.
+    struct Node {
+        int parent;
+        char character;
+    };
+
+    double wordBonus(const std::vector<Node>& nodes, int node) const;
+
+    // Word list, when loaded from a file
+    std::unique_ptr<Dictionary> m_wordList;
+    const Dictionary& m_dictionary;
+    // log10 P(letter | previous three letters), indexed like the quadgrams,
+    // and for the first letters of a message with one or two letters of
+    // context, and none
+    std::vector<float> m_next4;
+    std::vector<float> m_next3;
+    std::vector<float> m_next2;
+    std::vector<float> m_next1;
+
+    std::size_t m_beamWidth;
+};
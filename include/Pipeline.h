@@ -0,0 +1,63 @@
+/*****************************************************************************
+ * File: Pipeline.h
+ *
+ * Description: Chains of decoding stages (morse, morseseg, hex, oct, ascii,
+ *              caesar, keyshift, atbash, substitute) built from a comma
+ *              separated list such as "hex,caesar", so a message encoded in
+ *              several layers can be solved in one pass in memory.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Project includes
+#include "CommonUtils.h"
+
+// One decoding step, applied to a batch of messages in place
+class Stage
+{
+public:
+    virtual ~Stage() = default;
+
+    // Replace each message in the batch with its decoded form. Safe to call
+    // from several threads at once.
+    virtual void process(std::vector<std::string>& batch) const = 0;
+};
+
+class Pipeline
+{
+public:
+    // Pipeline of the stages named in spec, in order, each configured from the
+    // command line options:
+    //   caesar      -m, -d and -q as for caesarSolver
+    //   morseseg    Morse with missing letter separators; -d, -q and -b as
+    //               for "morseSolver -m segment"
+    //   keyshift    -k <key>; without a key, each message's key is recovered
+    //   substitute  -a <alphabet>, the letters plain a-z encrypt to
+    // Prints a message and returns null if a stage is unknown or an option is
+    // invalid.
+    static std::unique_ptr<Pipeline> fromSpec(const std::string& spec, const Options& options);
+
+    // Names of the stages a spec can use, comma separated
+    static std::string stageNames();
+
+    // Run every line through the first stage, then the whole batch through
+    // the next stage and so on, leaving the result for lines[i] in
+    // results[i]. Usable as a BatchSolver.
+    void process(const std::vector<std::string_view>& lines, std::vector<std::string>& results) const;
+
+    // Run a single message through the stages
+    std::string solve(std::string_view message) const;
+
+private:
+    std::vector<std::unique_ptr<Stage>> m_stages;
+};
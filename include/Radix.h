@@ -0,0 +1,90 @@
+/*****************************************************************************
+ * File: Radix.h
+ *
+ * Description: Decoding of messages written as hex, octal or decimal (ascii)
+ *              character codes.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <array>
+#include <string>
+#include <string_view>
+
+// Value of each byte as a digit of base 16 or below (either case for 'a'-'f'),
+// or 0xFF if the byte is not a digit
+constexpr std::array<unsigned char, 256> makeDigitValues()
+{
+    std::array<unsigned char, 256> values{};
+    for (int c = 0; c < 256; c++) {
+        values[c] = 0xFF;
+    }
+    for (int c = '0'; c <= '9'; c++) {
+        values[c] = static_cast<unsigned char>(c - '0');
+    }
+    for (int c = 'a'; c <= 'f'; c++) {
+        values[c] = static_cast<unsigned char>(c - 'a' + 10);
+        values[c - 'a' + 'A'] = static_cast<unsigned char>(c - 'a' + 10);
+    }
+    return values;
+}
+
+inline constexpr std::array<unsigned char, 256> DIGIT_VALUES = makeDigitValues();
+
+// Parse a number written in BASE (8, 10 or 16) into value, using integer
+// Horner steps and no branches per digit. Hex numbers may start with "0x".
+// Returns false if the text is empty or has a character that is not a digit
+// of the base; value is then meaningless.
+template<unsigned int BASE>
+constexpr bool parseRadix(std::string_view digits, unsigned int& value)
+{
+    static_assert(BASE >= 2 && BASE <= 16, "parseRadix supports bases 2 to 16");
+
+    if (BASE == 16 && digits.size() > 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')) {
+        digits.remove_prefix(2);
+    }
+
+    unsigned int result = 0;
+    unsigned int invalid = digits.empty();
+    for (const char c : digits) {
+        const unsigned int digit = DIGIT_VALUES[static_cast<unsigned char>(c)];
+        invalid |= (digit >= BASE);
+        result = result * BASE + digit;
+    }
+
+    value = result;
+    return !invalid;
+}
+
+// Lookup the encoded text and return the decoded character, or '*' if the
+// text is not a number in the base
+template<unsigned int BASE>
+inline char radix2char(std::string_view in)
+{
+    unsigned int value = 0;
+    return parseRadix<BASE>(in, value) ? static_cast<char>(value) : '*';
+}
+
+inline char hex2char(std::string_view in) { return radix2char<16>(in); }
+inline char oct2char(std::string_view in) { return radix2char<8>(in); }
+inline char ascii2char(std::string_view in) { return radix2char<10>(in); }
+
+// Decode a message of character codes separated by commas, spaces or line
+// breaks (spaces or line breaks only for ascii). Hex messages are scanned
+// for separators and bad digits 16 or 32 bytes at a time (see simdLevel()),
+// and runs of two digit codes with single separators ("4A 75 6E ...") are
+// converted 16 codes at a time. Nothing is allocated per code.
+std::string decodeHex(std::string_view hexMessage);
+std::string decodeOct(std::string_view octMessage);
+std::string decodeAscii(std::string_view asciiMessage);
+
+// As above, replacing the contents of decoded, so a caller decoding many
+// messages can reuse one buffer and allocate nothing once it is large enough
+void decodeHex(std::string_view hexMessage, std::string& decoded);
+void decodeOct(std::string_view octMessage, std::string& decoded);
+void decodeAscii(std::string_view asciiMessage, std::string& decoded);
@@ -0,0 +1,147 @@
+/*****************************************************************************
+ * File: ResultCache.h
+ *
+ * Description: Bounded cache of solved lines, so inputs that repeat a line
+ *              (chapter headings, retried files) solve it once. Split into
+ *              shards, each its own LRU list under its own lock, so workers
+ *              rarely wait on each other.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Project includes
+#include "CommonUtils.h"
+
+// Cache key for a line solved by the solver with the given ID, e.g. a method
+// name or pipeline spec, so solvers never share results. Solvers whose answer
+// does not depend on case pass foldCase so lines differing only in case share
+// an entry; the value cached must then be one that applies to either, such
+// as a shift rather than the decrypted text. Built in key, reusing its
+// capacity.
+inline void resultCacheKey(std::string_view solverId, std::string_view line, bool foldCase, std::string& key)
+{
+    key.assign(solverId.data(), solverId.size());
+    key.push_back('\n');
+    const std::size_t start = key.size();
+    key.append(line.data(), line.size());
+    if (foldCase) {
+        for (std::size_t i = start; i < key.size(); i++) {
+            if (key[i] >= 'A' && key[i] <= 'Z') {
+                key[i] = static_cast<char>(key[i] | 0x20);
+            }
+        }
+    }
+}
+
+// Values by key, evicting the least recently used entry of a shard once it
+// is full. The full key is kept with each entry so a hash collision is a miss
+// rather than a wrong answer. Safe to use from several threads at once.
+template<typename Value>
+class ResultCache
+{
+public:
+    // Cache of about the given number of entries, split across the shards
+    explicit ResultCache(std::size_t capacity, unsigned int shards = 16)
+    {
+        shards = std::max(shards, 1u);
+        const std::size_t perShard = std::max<std::size_t>((capacity + shards - 1) / shards, 1);
+        for (unsigned int i = 0; i < shards; i++) {
+            m_shards.emplace_back(new Shard(perShard));
+        }
+    }
+
+    // Copy the value cached for the key into value, marking it recently used.
+    // Returns false on a miss.
+    bool find(std::string_view key, Value& value)
+    {
+        const std::uint64_t hash = hashText(key);
+        Shard& shard = shardOf(hash);
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            const auto found = shard.index.find(hash);
+            if (found != shard.index.end() && found->second->key == key) {
+                shard.entries.splice(shard.entries.begin(), shard.entries, found->second);
+                value = found->second->value;
+                m_hits++;
+                return true;
+            }
+        }
+        m_misses++;
+        return false;
+    }
+
+    // Cache the value for the key, replacing any entry with the same hash
+    void insert(std::string_view key, const Value& value)
+    {
+        const std::uint64_t hash = hashText(key);
+        Shard& shard = shardOf(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const auto found = shard.index.find(hash);
+        if (found != shard.index.end()) {
+            found->second->key.assign(key.data(), key.size());
+            found->second->value = value;
+            shard.entries.splice(shard.entries.begin(), shard.entries, found->second);
+            return;
+        }
+
+        shard.entries.push_front(Entry{hash, std::string(key), value});
+        shard.index.emplace(hash, shard.entries.begin());
+        if (shard.entries.size() > shard.capacity) {
+            shard.index.erase(shard.entries.back().hash);
+            shard.entries.pop_back();
+        }
+    }
+
+    // Count lookups answered without the cache as hits, e.g. repeats of a
+    // line the caller is already solving
+    void addHits(std::size_t hits) { m_hits += hits; }
+
+    std::size_t hits() const { return m_hits; }
+    std::size_t misses() const { return m_misses; }
+
+private:
+    struct Entry {
+        std::uint64_t hash;
+        std::string key;
+        Value value;
+    };
+
+    struct Shard {
+        explicit Shard(std::size_t entries) : capacity(entries) {}
+
+        std::mutex mutex;
+        std::size_t capacity;
+
+        // Most recently used first
+        std::list<Entry> entries;
+        std::unordered_map<std::uint64_t, typename std::list<Entry>::iterator> index;
+    };
+
+    Shard& shardOf(std::uint64_t hash)
+    {
+        // The low bits pick the bucket within a shard's map
+        return *m_shards[(hash >> 48) % m_shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> m_shards;
+    std::atomic<std::size_t> m_hits{0};
+    std::atomic<std::size_t> m_misses{0};
+};
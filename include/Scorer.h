@@ -0,0 +1,125 @@
+/*****************************************************************************
+ * File: Scorer.h
+ *
+ * Description: Ways of scoring how much a candidate decryption looks like
+ *              English. Every scorer makes a single pass over the bytes of
+ *              the candidate without tokenizing or allocating, and folds
+ *              uppercase letters to lowercase as it goes. Higher scores are
+ *              more English-like.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Project includes
+#include "Dictionary.h"
+
+class Scorer
+{
+public:
+    virtual ~Scorer() = default;
+
+    // Score the candidate text; higher is more like English
+    virtual double score(std::string_view text) const = 0;
+
+    // Score of the text after adding each Caesar shift (0-25) to its letters,
+    // the same as score() of each shifted text. The default builds every
+    // shifted text in turn; scorers that can score straight from the letters
+    // override it to make one pass over the text and then loop over the
+    // shifts.
+    virtual void scoreShifts(std::string_view text, std::array<double, 26>& scores) const;
+};
+
+// Fraction of the words in the text found in a dictionary, e.g. if 9 of 10
+// words were found, return 0.9. Words are whitespace-separated; punctuation
+// at either end of a word (e.g. "ark?") is ignored and words that are only
+// punctuation are not counted.
+class WordScorer : public Scorer
+{
+public:
+    explicit WordScorer(const Dictionary& dictionary) : m_dictionary(dictionary) {}
+
+    double score(std::string_view text) const override;
+
+private:
+    const Dictionary& m_dictionary;
+};
+
+// Negated chi-squared statistic of the letter counts in the text against
+// English letter frequencies. Non-letters are ignored.
+class ChiSquaredScorer : public Scorer
+{
+public:
+    double score(std::string_view text) const override;
+
+    // Counts the letters once, then rotates the counts for each shift
+    void scoreShifts(std::string_view text, std::array<double, 26>& scores) const override;
+};
+
+// Mean log10 probability of the letter quadgrams in the text. Non-letters are
+// skipped, so quadgrams run across word boundaries and punctuation.
+class QuadgramScorer : public Scorer
+{
+public:
+    // Model built from the precomputed English counts in EnglishQuadgrams.h.
+    // Built on first use and shared by every caller.
+    static const QuadgramScorer& builtin();
+
+    // Model built from a file of "QUAD count" lines, e.g. "TION 13168375".
+    // Returns null if the file cannot be read or has no valid lines.
+    static std::unique_ptr<QuadgramScorer> fromFile(const std::string& filePath);
+
+    // Load the counts named by the given option, e.g. "-q", into quadgrams.
+    // Leaves quadgrams null if the option is not given. Returns false, having
+    // printed why, if the file cannot be read.
+    static bool fromOption(const Options& options, const std::string& flag, std::unique_ptr<QuadgramScorer>& quadgrams);
+
+    double score(std::string_view text) const override;
+
+    // Extracts the letters once, then walks them for each shift with the
+    // shift added on the fly
+    void scoreShifts(std::string_view text, std::array<double, 26>& scores) const override;
+
+    // log10 probability of each quadgram, indexed by its four letters in base
+    // 26 (first letter most significant). Quadgrams never seen share the
+    // lowest value.
+    const std::vector<float>& logProbs() const { return *m_logProbs; }
+
+private:
+    // Build the model from quadgram counts indexed as in m_logProbs
+    explicit QuadgramScorer(const std::vector<double>& counts);
+
+    // Indexed by the four letters in base 26, first letter most significant.
+    // Shared so copies of a scorer reuse the one table.
+    std::shared_ptr<const std::vector<float>> m_logProbs;
+};
+
+// English letter frequencies, a to z, as fractions summing to 1
+const std::array<double, 26>& englishFrequencies();
+
+// Log-likelihood (natural log) of the letters of the text under English
+// letter frequencies after adding each Caesar shift (0-25). Counts the letters
+// once into a 26-bin histogram, then correlates each rotation of it with
+// English log frequencies. All zero for text without letters.
+std::array<double, 26> shiftLikelihoods(std::string_view text);
+
+// Caesar shift (0-25) that, added to every letter of the text, makes it most
+// like English by shiftLikelihoods(), so no shifted candidate is ever built.
+// The lowest shift wins a tie; returns 0 for text without letters.
+int bestShift(std::string_view text);
+
+// Create the scorer selected on the command line: "words" (the default),
+// "chi" or "quad". Returns null for an unknown name. The word scorer refers
+// to the given dictionary, which must outlive it.
+std::unique_ptr<Scorer> makeScorer(const std::string& name, const Dictionary& dictionary,
+                                   const QuadgramScorer& quadgrams = QuadgramScorer::builtin());
@@ -0,0 +1,40 @@
+/*****************************************************************************
+ * File: ShiftKernel.h
+ *
+ * Description: In-place byte kernels that rotate the letters of a buffer
+ *              through the alphabet, as used by the Caesar and key shift
+ *              decryptions, or pass them through any substitution. Case and
+ *              all other bytes are kept. The kernels process 16 (SSE) or 32
+ *              (AVX2) bytes per step, chosen at run time by simdLevel(), with
+ *              a translation table lookup as the scalar fallback.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <cstddef>
+
+// Project includes
+#include "Substitution.h"
+
+// Add shift (taken modulo 26) to every letter, wrapping past 'z' back to 'a'
+// and past 'Z' back to 'A'. Case and every other byte are kept.
+void shiftLetters(char* data, std::size_t length, unsigned int shift);
+
+// Add keyShifts[k] (each 0-25) to each letter of either case, wrapping as
+// above.
+// The key index k starts at keyIndex and advances by one, wrapping at
+// keyLength, for every letter; other bytes do not use up a key position.
+// Returns the key index following the last letter, so a long input can be
+// processed in pieces.
+std::size_t shiftLettersKeyed(char* data, std::size_t length,
+                              const unsigned char* keyShifts, std::size_t keyLength,
+                              std::size_t keyIndex = 0);
+
+// Replace every letter through the substitution, keeping its case; other
+// bytes are kept. Vectorised with byte shuffles of the letter map.
+void substituteLetters(char* data, std::size_t length, const Substitution& substitution);
@@ -0,0 +1,99 @@
+/*****************************************************************************
+ * File: Substitution.h
+ *
+ * Description: Monoalphabetic substitutions (Caesar rotations, Atbash, or a
+ *              given cypher alphabet) as translation tables, the rotations
+ *              and Atbash built at compile time.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <array>
+#include <string>
+#include <string_view>
+
+const unsigned int SUBSTITUTION_LETTERS = 26;
+
+// A substitution replaces each letter of either case with the letter its
+// index (0-25) maps to, in the same case, and keeps every other byte. It is
+// held twice: as a 256-byte translation table for scalar lookups, and as the
+// letter map alone, padded to 32 bytes, for the vector kernels to shuffle
+// with.
+struct Substitution {
+    std::array<unsigned char, 256> table;
+    std::array<unsigned char, 32> letters;
+};
+
+// Substitution mapping letter i to letters[i]; letters must hold 0-25
+constexpr Substitution makeSubstitution(const std::array<unsigned char, SUBSTITUTION_LETTERS>& letters)
+{
+    Substitution substitution{};
+    for (unsigned int c = 0; c < 256; c++) {
+        substitution.table[c] = static_cast<unsigned char>(c);
+    }
+    for (unsigned int letter = 0; letter < SUBSTITUTION_LETTERS; letter++) {
+        substitution.table['a' + letter] = static_cast<unsigned char>('a' + letters[letter]);
+        substitution.table['A' + letter] = static_cast<unsigned char>('A' + letters[letter]);
+        substitution.letters[letter] = letters[letter];
+    }
+    return substitution;
+}
+
+// Caesar rotation adding shift to every letter
+constexpr Substitution makeRotation(unsigned int shift)
+{
+    std::array<unsigned char, SUBSTITUTION_LETTERS> letters{};
+    for (unsigned int letter = 0; letter < SUBSTITUTION_LETTERS; letter++) {
+        letters[letter] = static_cast<unsigned char>((letter + shift) % SUBSTITUTION_LETTERS);
+    }
+    return makeSubstitution(letters);
+}
+
+constexpr std::array<Substitution, SUBSTITUTION_LETTERS> makeRotations()
+{
+    std::array<Substitution, SUBSTITUTION_LETTERS> rotations{};
+    for (unsigned int shift = 0; shift < SUBSTITUTION_LETTERS; shift++) {
+        rotations[shift] = makeRotation(shift);
+    }
+    return rotations;
+}
+
+// Atbash, the alphabet reversed: a and z swap, b and y, and so on. Its own
+// inverse.
+constexpr Substitution makeAtbash()
+{
+    std::array<unsigned char, SUBSTITUTION_LETTERS> letters{};
+    for (unsigned int letter = 0; letter < SUBSTITUTION_LETTERS; letter++) {
+        letters[letter] = static_cast<unsigned char>(SUBSTITUTION_LETTERS - 1 - letter);
+    }
+    return makeSubstitution(letters);
+}
+
+// The substitution undoing the given one
+constexpr Substitution invertSubstitution(const Substitution& substitution)
+{
+    std::array<unsigned char, SUBSTITUTION_LETTERS> letters{};
+    for (unsigned int letter = 0; letter < SUBSTITUTION_LETTERS; letter++) {
+        letters[substitution.letters[letter]] = static_cast<unsigned char>(letter);
+    }
+    return makeSubstitution(letters);
+}
+
+// Every Caesar rotation, indexed by shift
+inline constexpr std::array<Substitution, SUBSTITUTION_LETTERS> ROTATIONS = makeRotations();
+
+inline constexpr Substitution ATBASH = makeAtbash();
+
+// The decryption for a cypher alphabet, where key[i] is the letter plain
+// letter 'a' + i encrypts to, e.g. "zyxw..." for Atbash. Letters match
+// regardless of case. Returns false unless the key is the 26 letters each
+// used once.
+bool substitutionFromKey(std::string_view key, Substitution& decryption);
+
+// The cypher alphabet of a decryption, as substitutionFromKey() takes it
+std::string substitutionKey(const Substitution& decryption);
@@ -0,0 +1,74 @@
+/*****************************************************************************
+ * File: SubstitutionSolver.h
+ *
+ * Description: Breaks general monoalphabetic substitution cyphers by hill
+ *              climbing over keys, scored with quadgrams.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#pragma once
+
+// Library includes
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+// Project includes
+#include "CommonUtils.h"
+#include "Scorer.h"
+#include "Substitution.h"
+
+struct SubstitutionSolution {
+    // Decryption of the best key found, and the text decrypted with it
+    Substitution decryption;
+    std::string text;
+
+    // Mean log10 quadgram probability of the decrypted text
+    double score;
+
+    // Restarts run, and how many of them climbed to the best key
+    unsigned int restarts;
+    unsigned int agreeing;
+};
+
+class SubstitutionSolver
+{
+public:
+    // Solver scoring keys with the given quadgrams. Runs up to maxRestarts
+    // climbs from random keys across the given number of workers (0 means
+    // one per core), stopping early once agreement of them have reached the
+    // same best key.
+    SubstitutionSolver(const QuadgramScorer& quadgrams, unsigned int maxRestarts = 100,
+                       unsigned int agreement = 3, unsigned int jobs = 0);
+
+    // Solver configured from the command line options:
+    //   -q <file>      quadgram counts (default built in)
+    //   -r <count>     most restarts (default 100)
+    //   -c <count>     restarts that must agree to stop early (default 3)
+    //   -j <count>     worker threads
+    // Prints a message and returns null if an option is invalid.
+    static std::unique_ptr<SubstitutionSolver> fromOptions(const Options& options);
+
+    // Find the key most like English. Each climb starts from a random key and
+    // swaps pairs of letters while that improves the score, rescoring only
+    // the quadgrams containing the swapped letters, then kicks the key with
+    // random swaps and climbs again to escape local bests. The restarts run
+    // on the solver's own workers, so calls from several threads take turns.
+    SubstitutionSolution solve(std::string_view cypherText) const;
+
+private:
+    // Quadgrams loaded from a file, if any
+    std::unique_ptr<QuadgramScorer> m_quadgramFile;
+
+    const QuadgramScorer& m_quadgrams;
+    unsigned int m_maxRestarts;
+    unsigned int m_agreement;
+
+    // Workers for the restarts, started once and reused for every text
+    std::unique_ptr<ThreadPool> m_pool;
+    std::unique_ptr<std::mutex> m_solving;
+};
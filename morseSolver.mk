@@ -1,17 +1,17 @@
 CC=g++
-CFLAGS=-c -Wall
+CFLAGS=-c -Wall -O2
 LDFLAGS=
-SOURCES=src/morseSolver.cpp src/CommonUtils.cpp
+SOURCES=src/morseSolver.cpp src/CommonUtils.cpp src/Dictionary.cpp src/EnglishQuadgrams.cpp src/Morse.cpp src/MorseSegmenter.cpp src/Scorer.cpp
 OBJECTS=$(SOURCES:.cpp=.o)
 EXECUTABLE=bin/morseSolver
 
 all: $(SOURCES) $(EXECUTABLE)
 	
 $(EXECUTABLE): $(OBJECTS) 
-	$(CC) -std=c++11 -Iinclude/ $(LDFLAGS) $(OBJECTS) -o $@
+	$(CC) -std=c++17 -Iinclude/ $(LDFLAGS) $(OBJECTS) -o $@
 
 .cpp.o:
-	$(CC) -std=c++11 -Iinclude/ $(CFLAGS) $< -o $@
+	$(CC) -std=c++17 -Iinclude/ $(CFLAGS) $< -o $@
 	
 clean:
 	@echo " Cleaning..."; 
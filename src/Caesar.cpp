@@ -0,0 +1,319 @@
+/*****************************************************************************
+ * File: Caesar.cpp
+ *
+ * Description: See Caesar.h
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#include "Caesar.h"
+
+// STL includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+
+// Project includes
+#include "ShiftKernel.h"
+
+namespace {
+
+const int ALPHABET_LENGTH = 26;
+
+// Orders candidates best first; ties go to the lower shift
+bool better(const CaesarCandidate& a, const CaesarCandidate& b)
+{
+    return a.score > b.score || (a.score == b.score && a.shift < b.shift);
+}
+
+// Set the confidence of the ranked candidates: the softmax of the scored
+// shifts' scores in units of their spread, so the confidence does not depend
+// on the scale of the scoring method. first is the best score.
+void setConfidence(const double* scores, std::size_t scored, double first, std::vector<CaesarCandidate>& ranked)
+{
+    double mean = 0.;
+    for (std::size_t i = 0; i < scored; i++) {
+        mean += scores[i];
+    }
+    mean /= scored;
+    double variance = 0.;
+    for (std::size_t i = 0; i < scored; i++) {
+        variance += (scores[i] - mean) * (scores[i] - mean);
+    }
+    const double spread = std::sqrt(variance / scored);
+    double total = 0.;
+    for (std::size_t i = 0; i < scored; i++) {
+        total += (spread > 0.) ? std::exp((scores[i] - first) / spread) : 1.;
+    }
+    for (auto& candidate : ranked) {
+        candidate.confidence = ((spread > 0.) ? std::exp((candidate.score - first) / spread) : 1.) / total;
+    }
+}
+
+} // namespace
+
+CaesarSolver::CaesarSolver(std::unique_ptr<Scorer> scorer)
+    : m_scorer(std::move(scorer))
+{
+}
+
+std::unique_ptr<CaesarSolver> CaesarSolver::fromOptions(const Options& options)
+{
+    // Load a larger word list for scoring if one is given
+    std::unique_ptr<Dictionary> wordList;
+    if (!Dictionary::fromOption(options, "-d", wordList)) {
+        return nullptr;
+    }
+    if (wordList) {
+        std::cout << "Loaded " << wordList->size() << " words from '" << options.at("-d") << "'." << std::endl;
+    }
+
+    // Load quadgram counts for the quadgram scorer if given
+    std::unique_ptr<QuadgramScorer> quadgrams;
+    if (!QuadgramScorer::fromOption(options, "-q", quadgrams)) {
+        return nullptr;
+    }
+
+    // Choose how candidates are scored: words (default), chi, quad or hist
+    const auto methodOption = options.find("-m");
+    const std::string method = (methodOption != options.end()) ? methodOption->second : "words";
+    auto scorer = makeScorer(method,
+                             wordList ? *wordList : Dictionary::builtin(),
+                             quadgrams ? *quadgrams : QuadgramScorer::builtin());
+    if (!scorer && method != "hist") {
+        std::cout << "Unknown scoring method \"" << method << "\". Use words, chi, quad or hist." << std::endl;
+        return nullptr;
+    }
+
+    // Early exit margin, if given
+    double margin = 0.;
+    const auto marginOption = options.find("-e");
+    if (marginOption != options.end()) {
+        char* end = nullptr;
+        margin = std::strtod(marginOption->second.c_str(), &end);
+        if (end == marginOption->second.c_str() || *end != '\0' || !(margin >= 0.)) {
+            std::cout << "Invalid margin \"" << marginOption->second << "\". Use a number of at least 0." << std::endl;
+            return nullptr;
+        }
+    }
+
+    std::unique_ptr<CaesarSolver> solver(new CaesarSolver(std::move(scorer)));
+    solver->m_margin = margin;
+    solver->m_wordList = std::move(wordList);
+    solver->m_quadgrams = std::move(quadgrams);
+    return solver;
+}
+
+// Brute force Caesar-cypher solver for a given string.
+std::string CaesarSolver::solve(std::string_view cypherText) const
+{
+    return decrypt(cypherText, solveShift(cypherText));
+}
+
+void CaesarSolver::solveBatch(const LineBlock& cypherTexts, LineBlock& plainTexts) const
+{
+    plainTexts.clear();
+
+    // Early exits and the histogram score shifts in an order that depends on
+    // the text, so solve those lines one by one
+    if (!solvesFamilies()) {
+        for (std::size_t line = 0; line < cypherTexts.size(); line++) {
+            const std::string_view cypherText = cypherTexts[line];
+            char* plainText = plainTexts.append(cypherText);
+            shiftLetters(plainText, cypherText.size(), solveShift(cypherText));
+        }
+        return;
+    }
+
+    // Otherwise group the lines into families by canonical form, found in an
+    // open-addressed table of family numbers plus one, and score each family
+    // once. The buffers keep their capacity from batch to batch.
+    thread_local std::string canonical;
+    thread_local LineBlock families;
+    thread_local std::vector<std::array<double, ALPHABET_LENGTH>> familyScores;
+    thread_local std::vector<std::uint32_t> slots;
+    std::size_t tableSize = 16;
+    while (tableSize < 2 * cypherTexts.size()) {
+        tableSize *= 2;
+    }
+    slots.assign(tableSize, 0);
+    families.clear();
+    familyScores.clear();
+
+    for (std::size_t line = 0; line < cypherTexts.size(); line++) {
+        const std::string_view cypherText = cypherTexts[line];
+        const unsigned int offset = canonicalForm(cypherText, canonical);
+
+        std::size_t slot = hashText(canonical) & (tableSize - 1);
+        while (slots[slot] != 0 && families[slots[slot] - 1] != canonical) {
+            slot = (slot + 1) & (tableSize - 1);
+        }
+        if (slots[slot] == 0) {
+            families.append(canonical);
+            familyScores.emplace_back();
+            scoreShifts(canonical, familyScores.back());
+            slots[slot] = static_cast<std::uint32_t>(families.size());
+        }
+
+        char* plainText = plainTexts.append(cypherText);
+        shiftLetters(plainText, cypherText.size(), memberShift(familyScores[slots[slot] - 1], offset));
+    }
+}
+
+void CaesarSolver::scoreShifts(std::string_view text, std::array<double, ALPHABET_LENGTH>& scores) const
+{
+    m_scorer->scoreShifts(text, scores);
+}
+
+unsigned int CaesarSolver::canonicalForm(std::string_view text, std::string& canonical)
+{
+    canonical.assign(text.data(), text.size());
+    unsigned int offset = 0;
+    bool found = false;
+    for (auto& c : canonical) {
+        const char lower = static_cast<char>(c | 0x20);
+        if (lower < 'a' || lower > 'z') {
+            continue;
+        }
+        if (!found) {
+            offset = static_cast<unsigned int>(lower - 'a');
+            found = true;
+        }
+        const unsigned int letter = (static_cast<unsigned int>(lower - 'a') + ALPHABET_LENGTH - offset) % ALPHABET_LENGTH;
+        c = static_cast<char>('a' + letter);
+    }
+    return offset;
+}
+
+unsigned int CaesarSolver::memberShift(const std::array<double, ALPHABET_LENGTH>& canonicalScores, unsigned int offset)
+{
+    unsigned int best = 0;
+    for (unsigned int shift = 1; shift < ALPHABET_LENGTH; shift++) {
+        if (canonicalScores[(shift + offset) % ALPHABET_LENGTH] > canonicalScores[(best + offset) % ALPHABET_LENGTH]) {
+            best = shift;
+        }
+    }
+    return best;
+}
+
+std::vector<CaesarCandidate> CaesarSolver::memberRank(const std::array<double, ALPHABET_LENGTH>& canonicalScores,
+                                                      unsigned int offset, std::size_t count)
+{
+    std::array<double, ALPHABET_LENGTH> scores;
+    std::vector<CaesarCandidate> ranked;
+    for (unsigned int shift = 0; shift < ALPHABET_LENGTH; shift++) {
+        scores[shift] = canonicalScores[(shift + offset) % ALPHABET_LENGTH];
+        ranked.push_back(CaesarCandidate{shift, scores[shift], 0.});
+    }
+    std::sort(ranked.begin(), ranked.end(), better);
+    ranked.resize(std::min<std::size_t>(count, ALPHABET_LENGTH));
+    setConfidence(scores.data(), ALPHABET_LENGTH, *std::max_element(scores.begin(), scores.end()), ranked);
+    return ranked;
+}
+
+unsigned int CaesarSolver::solveShift(std::string_view cypherText) const
+{
+    // Fast path - pick the shift from the letter histogram
+    if (!m_scorer) {
+        return static_cast<unsigned int>(bestShift(cypherText));
+    }
+
+    // Return the shift that is most like English
+    thread_local std::vector<CaesarCandidate> best;
+    rankShifts(cypherText, 1, false, best);
+    return best.front().shift;
+}
+
+std::vector<CaesarCandidate> CaesarSolver::rank(std::string_view cypherText, std::size_t count) const
+{
+    std::vector<CaesarCandidate> ranked;
+    rankShifts(cypherText, count, true, ranked);
+    return ranked;
+}
+
+void CaesarSolver::rankShifts(std::string_view cypherText, std::size_t count, bool withConfidence,
+                              std::vector<CaesarCandidate>& heap) const
+{
+    // The histogram scores every shift at once. When stopping early, try the
+    // shifts whose letter frequencies look most like English first.
+    std::array<double, ALPHABET_LENGTH> likelihoods = {};
+    if (!m_scorer || m_margin > 0.) {
+        likelihoods = shiftLikelihoods(cypherText);
+    }
+    std::array<unsigned int, ALPHABET_LENGTH> order;
+    for (unsigned int shift = 0; shift < ALPHABET_LENGTH; shift++) {
+        order[shift] = shift;
+    }
+    if (m_scorer && m_margin > 0.) {
+        std::sort(order.begin(), order.end(), [&likelihoods](unsigned int a, unsigned int b) {
+            return likelihoods[a] > likelihoods[b] || (likelihoods[a] == likelihoods[b] && a < b);
+        });
+    }
+
+    // Without an early exit, score every shift in one call; otherwise score
+    // them one at a time into a reused buffer. Keep the best count in a heap
+    // with the worst of them on top, and every score for the confidence. The
+    // histogram method's scores are the likelihoods themselves.
+    std::array<double, ALPHABET_LENGTH> allScores = likelihoods;
+    if (m_scorer && m_margin == 0.) {
+        m_scorer->scoreShifts(cypherText, allScores);
+    }
+    thread_local std::string candidate;
+    std::array<double, ALPHABET_LENGTH> scores;
+    heap.clear();
+    double first = std::numeric_limits<double>::lowest();
+    double second = first;
+    std::size_t scored = 0;
+    for (const auto shift : order) {
+        double score = allScores[shift];
+        if (m_scorer && m_margin > 0.) {
+            candidate.assign(cypherText.begin(), cypherText.end());
+            shiftLetters(&candidate[0], candidate.size(), shift);
+            score = m_scorer->score(candidate);
+        }
+        scores[scored++] = score;
+
+        const CaesarCandidate tried{shift, score, 0.};
+        if (heap.size() < count) {
+            heap.push_back(tried);
+            std::push_heap(heap.begin(), heap.end(), better);
+        }
+        else if (count > 0 && better(tried, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), better);
+            heap.back() = tried;
+            std::push_heap(heap.begin(), heap.end(), better);
+        }
+
+        // Stop once the best so far is clear of the rest
+        if (score > first) {
+            second = first;
+            first = score;
+        }
+        else if (score > second) {
+            second = score;
+        }
+        if (m_margin > 0. && scored >= 2 && first - second >= m_margin) {
+            break;
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), better);
+    if (withConfidence) {
+        setConfidence(scores.data(), scored, first, heap);
+    }
+}
+
+std::string CaesarSolver::decrypt(std::string_view cypherText, unsigned int shift)
+{
+    // Shift the letters of either case in one pass, keeping case and
+    // punctuation; the kernel leaves a zero shift alone (to test for really
+    // lousy encryption)
+    std::string decrypted(cypherText);
+    shiftLetters(&decrypted[0], decrypted.size(), shift);
+    return decrypted;
+}
@@ -10,25 +10,568 @@
  ****************************************************************************/
 #include "CommonUtils.h"
 
+// STL includes
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+// System includes
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 // Simple function to parse the command line. The program takes either
 // 1) a file path to a text file listing encrypted strigns
 // 2) an encrypted string
 // The out string is either the file path or encrypted string; its context is
 // determined by the returned solver enum.
 Solver parseCLI(const int argc, char* argv[], std::string &out)
+{
+    Options options;
+    auto status = parseCLI(argc, argv, out, options);
+
+    // Without the option map, only "-f <file>" or "-s <string>" is accepted
+    if (!options.empty()) {
+        status = UNDEFINED;
+    }
+
+    return status;
+}
+
+// As above, but also collects any other "-flag value" pairs into options so
+// individual programs can accept their own settings ahead of -f or -s.
+Solver parseCLI(const int argc, char* argv[], std::string &out, Options &options)
 {
     Solver status = UNDEFINED;
 
-    if (argc == 3) {
-        if (std::string(argv[1]) == "-f") {
-            status = SOLVE_FILE;
-            out = std::string(argv[2]);
+    for (int i = 1; i < argc; i++) {
+        const std::string arg(argv[i]);
+
+        // Every argument is a flag followed by its value
+        if (arg.size() < 2 || arg[0] != '-' || i + 1 >= argc) {
+            return UNDEFINED;
         }
-        else if (std::string(argv[1]) == "-s") {
-            status = SOLVE_STRING;
-            out = std::string(argv[2]);
+
+        if (arg == "-f" || arg == "-s") {
+            // Only one thing to solve per run
+            if (status != UNDEFINED) {
+                return UNDEFINED;
+            }
+            status = (arg == "-f") ? SOLVE_FILE : SOLVE_STRING;
+            out = std::string(argv[++i]);
+        }
+        else {
+            options[arg] = std::string(argv[++i]);
         }
     }
 
     return status;
 }
+
+namespace {
+
+// Best instruction set supported by this CPU
+SimdLevel detectSimdLevel()
+{
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    if (__builtin_cpu_supports("avx2")) {
+        return SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SIMD_SSE2;
+    }
+#endif
+    return SIMD_SCALAR;
+}
+
+std::atomic<int> activeSimdLevel(-1);
+
+} // namespace
+
+SimdLevel simdLevel()
+{
+    int level = activeSimdLevel.load(std::memory_order_relaxed);
+    if (level < 0) {
+        level = detectSimdLevel();
+        activeSimdLevel.store(level, std::memory_order_relaxed);
+    }
+    return static_cast<SimdLevel>(level);
+}
+
+void setSimdLevel(SimdLevel level)
+{
+    activeSimdLevel.store(std::min(level, detectSimdLevel()), std::memory_order_relaxed);
+}
+
+bool hasSsse3()
+{
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    static const bool supported = __builtin_cpu_supports("ssse3");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+MappedFile::MappedFile(const std::string& filePath)
+{
+#ifndef _WIN32
+    const int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat info;
+        if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+            m_open = true;
+            m_size = static_cast<std::size_t>(info.st_size);
+            if (m_size > 0) {
+                void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data != MAP_FAILED) {
+                    m_data = static_cast<const char*>(data);
+                    m_mapped = true;
+                }
+            }
+        }
+        close(fd);
+        if (m_mapped || (m_open && m_size == 0)) {
+            return;
+        }
+        m_open = false;
+        m_size = 0;
+    }
+#endif
+
+    // Mapping unavailable; read the file into memory instead
+    std::ifstream inFile(filePath, std::ios::binary);
+    if (inFile.is_open()) {
+        m_buffer.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+        m_open = true;
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other) {
+        release();
+        m_size = other.m_size;
+        m_open = other.m_open;
+        m_mapped = other.m_mapped;
+        m_buffer = std::move(other.m_buffer);
+        m_data = m_mapped ? other.m_data : m_buffer.data();
+
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_open = false;
+        other.m_mapped = false;
+    }
+    return *this;
+}
+
+void MappedFile::release()
+{
+#ifndef _WIN32
+    if (m_mapped) {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+    m_open = false;
+    m_mapped = false;
+    m_buffer.clear();
+}
+
+void LineBlock::clear()
+{
+    m_arena.clear();
+    m_offsets.resize(1);
+}
+
+char* LineBlock::append(std::string_view line)
+{
+    const std::size_t start = m_arena.size();
+    m_arena.append(line.data(), line.size());
+    m_offsets.push_back(m_arena.size());
+    return &m_arena[start];
+}
+
+// Number of worker threads requested with "-j <count>", or 0 (one per core)
+// if not given or not a positive number.
+unsigned int jobsOption(const Options &options)
+{
+    const auto it = options.find("-j");
+    if (it == options.end()) {
+        return 0;
+    }
+
+    const int jobs = std::atoi(it->second.c_str());
+    return (jobs > 0) ? static_cast<unsigned int>(jobs) : 0;
+}
+
+ThreadPool::ThreadPool(unsigned int threads)
+{
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (unsigned int i = 0; i < threads; i++) {
+        m_queues.emplace_back(new Queue());
+    }
+    for (unsigned int i = 0; i < threads; i++) {
+        m_threads.emplace_back(&ThreadPool::run, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    auto& queue = *m_queues[m_nextQueue++ % m_queues.size()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queued++;
+        m_unfinished++;
+    }
+    m_wake.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_unfinished == 0; });
+}
+
+bool ThreadPool::takeTask(unsigned int index, std::function<void()>& task)
+{
+    const auto count = m_queues.size();
+    for (std::size_t offset = 0; offset < count; offset++) {
+        auto& queue = *m_queues[(index + offset) % count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            continue;
+        }
+        if (offset == 0) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        } else {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::run(unsigned int index)
+{
+    while (true) {
+        // Sleep until there is a task to take or the pool is stopping
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this] { return m_queued > 0 || m_stop; });
+            if (m_queued == 0) {
+                return;
+            }
+            m_queued--;
+        }
+
+        // A task is reserved for this worker; find it in any queue
+        std::function<void()> task;
+        while (!takeTask(index, task)) {
+            std::this_thread::yield();
+        }
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_unfinished == 0) {
+                m_done.notify_all();
+            }
+        }
+    }
+}
+
+namespace {
+
+// A run of consecutive input lines, solved as one pool task. Chunks are
+// recycled once written, so their strings and vectors keep their capacity
+// and a warm pipeline reads and solves without allocating.
+struct Chunk {
+    // Copies of the lines when the input is a stream, else empty. May hold
+    // more strings than lines, left over from earlier use.
+    std::vector<std::string> storage;
+
+    std::vector<std::string_view> lines;
+    std::vector<std::string> results;
+    bool finished = false;
+};
+
+// Lines per pool task
+const std::size_t CHUNK_LINES = 256;
+
+// Run the read, solve and write stages. fill() adds up to CHUNK_LINES lines to
+// the chunk and returns false once the input is exhausted.
+void runPipeline(const std::function<bool(Chunk&)>& fill, const BatchSolver& solve,
+                 const LineEmitter& emit, unsigned int jobs)
+{
+    ThreadPool pool(jobs);
+
+    // Every chunk the pipeline uses, made up front: the reader waits for a
+    // written one when all are in flight. Bounds the memory in use, and
+    // which chunks exist never depends on how far the reader gets ahead.
+    const std::size_t maxChunks = pool.size() * 4;
+    std::vector<std::shared_ptr<Chunk>> spare;
+    for (std::size_t i = 0; i < maxChunks; i++) {
+        spare.push_back(std::make_shared<Chunk>());
+    }
+
+    // Chunks in input order, from the reader to the writer
+    std::deque<std::shared_ptr<Chunk>> inFlight;
+    bool endOfInput = false;
+    std::mutex mutex;
+    std::condition_variable changed;
+
+    // What a solve task refers to
+    struct Stage {
+        const BatchSolver& solve;
+        std::mutex& mutex;
+        std::condition_variable& changed;
+    };
+    const Stage stage{solve, mutex, changed};
+
+    // Reader stage: gather lines into chunks and queue them to be solved
+    std::thread reader([&] {
+        bool more = true;
+        while (more) {
+            std::shared_ptr<Chunk> chunk;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [&] { return !spare.empty(); });
+                chunk = std::move(spare.back());
+                spare.pop_back();
+            }
+            chunk->lines.clear();
+            chunk->finished = false;
+            more = fill(*chunk);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (chunk->lines.empty()) {
+                    spare.push_back(std::move(chunk));
+                    continue;
+                }
+                inFlight.push_back(chunk);
+            }
+
+            // Solve stage. The task captures two pointers, small enough for
+            // std::function to hold without allocating; the chunk outlives
+            // it, held by inFlight until written.
+            Chunk* const solving = chunk.get();
+            pool.submit([&stage, solving] {
+                solving->results.resize(solving->lines.size());
+                stage.solve(solving->lines, solving->results);
+
+                std::lock_guard<std::mutex> lock(stage.mutex);
+                solving->finished = true;
+                stage.changed.notify_all();
+            });
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        endOfInput = true;
+        changed.notify_all();
+    });
+
+    // Writer stage: emit each chunk once it and every earlier one are solved
+    while (true) {
+        std::shared_ptr<Chunk> chunk;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [&] {
+                return inFlight.empty() ? endOfInput : inFlight.front()->finished;
+            });
+            if (inFlight.empty()) {
+                break;
+            }
+            chunk = inFlight.front();
+            inFlight.pop_front();
+        }
+
+        for (std::size_t i = 0; i < chunk->lines.size(); i++) {
+            emit(chunk->lines[i], chunk->results[i]);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            spare.push_back(std::move(chunk));
+        }
+        changed.notify_all();
+    }
+
+    reader.join();
+}
+
+void streamBatches(std::istream& input, const BatchSolver& solve, const LineEmitter& emit,
+                   unsigned int jobs)
+{
+    runPipeline([&input](Chunk& chunk) {
+        bool more = true;
+        std::size_t count = 0;
+        while (count < CHUNK_LINES) {
+            // Read into the chunk's strings, reusing their capacity
+            if (count == chunk.storage.size()) {
+                chunk.storage.emplace_back();
+            }
+            if (!std::getline(input, chunk.storage[count])) {
+                more = false;
+                break;
+            }
+            count++;
+
+            // Send a partial chunk when no more input is waiting, so
+            // interactive input is answered right away
+            if (input.rdbuf()->in_avail() <= 0) {
+                break;
+            }
+        }
+
+        chunk.lines.assign(chunk.storage.begin(), chunk.storage.begin() + count);
+        return more;
+    }, solve, emit, jobs);
+}
+
+void textBatches(std::string_view text, const BatchSolver& solve, const LineEmitter& emit,
+                 unsigned int jobs)
+{
+    const char* next = text.data();
+    const char* const end = text.data() + text.size();
+
+    runPipeline([&next, end](Chunk& chunk) {
+        chunk.lines.reserve(CHUNK_LINES);
+        while (chunk.lines.size() < CHUNK_LINES && next < end) {
+            // As with std::getline, a final line needs no newline
+            auto newline = static_cast<const char*>(std::memchr(next, '\n', end - next));
+            if (!newline) {
+                newline = end;
+            }
+            chunk.lines.emplace_back(next, newline - next);
+            next = (newline < end) ? newline + 1 : end;
+        }
+        return next < end;
+    }, solve, emit, jobs);
+}
+
+// Solve a batch by solving each of its lines in turn
+BatchSolver eachLine(const LineSolver& solve)
+{
+    return [&solve](const std::vector<std::string_view>& lines, std::vector<std::string>& results) {
+        for (std::size_t i = 0; i < lines.size(); i++) {
+            results[i] = solve(lines[i]);
+        }
+    };
+}
+
+} // namespace
+
+// Solve each line of the input with solve() across a pool of the given number
+// of workers (0 means one per core), passing each line and its result to
+// emit() on the calling thread in input order.
+void solveStream(std::istream& input, const LineSolver& solve, const LineEmitter& emit,
+                 unsigned int jobs)
+{
+    streamBatches(input, eachLine(solve), emit, jobs);
+}
+
+// As solveStream(), over lines already in memory, such as a mapped file.
+void solveText(std::string_view text, const LineSolver& solve, const LineEmitter& emit,
+               unsigned int jobs)
+{
+    textBatches(text, eachLine(solve), emit, jobs);
+}
+
+// As solveText(), solving a chunk of lines at a time with one call.
+void solveTextBatches(std::string_view text, const BatchSolver& solve, const LineEmitter& emit,
+                      unsigned int jobs)
+{
+    textBatches(text, solve, emit, jobs);
+}
+
+// Solve the named file line by line. Regular files are memory-mapped;
+// standard input, pipes and devices are streamed.
+bool solveFile(const std::string& filePath, const LineSolver& solve, const LineEmitter& emit,
+               unsigned int jobs)
+{
+    return solveFileBatches(filePath, eachLine(solve), emit, jobs);
+}
+
+// As solveFile(), solving a chunk of lines at a time with one call.
+bool solveFileBatches(const std::string& filePath, const BatchSolver& solve, const LineEmitter& emit,
+                      unsigned int jobs)
+{
+    if (filePath == "-") {
+        // Synced with C stdio, std::cin buffers nothing and in_avail() is
+        // always 0, so every line would be sent as a chunk of its own.
+        // Unsynced, it reads ahead and in_avail() reports the input waiting.
+        // Unsynced streams are not safe to share between threads, so untie
+        // std::cin, or the reader thread would flush std::cout while the
+        // calling thread writes to it.
+        std::cout.flush();
+        std::ios::sync_with_stdio(false);
+        std::cin.tie(nullptr);
+        streamBatches(std::cin, solve, emit, jobs);
+        return true;
+    }
+
+    std::error_code error;
+    if (std::filesystem::is_regular_file(filePath, error)) {
+        MappedFile file(filePath);
+        if (file.isOpen()) {
+            textBatches(file.view(), solve, emit, jobs);
+            return true;
+        }
+    }
+    else {
+        std::ifstream inFile(filePath);
+        if (inFile.is_open()) {
+            streamBatches(inFile, solve, emit, jobs);
+            return true;
+        }
+    }
+
+    std::cout << "Unable to open file \"" << filePath << "\". Please check your inputs and try again." << std::endl;
+    return false;
+}
@@ -0,0 +1,187 @@
+/*****************************************************************************
+ * File: Dictionary.cpp
+ *
+ * Description: See Dictionary.h
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#include "Dictionary.h"
+
+// STL includes
+#include <iostream>
+#include <limits>
+#include <utility>
+
+namespace {
+
+// Start with the 100 most common words according to
+// https://www.englishclub.com/vocabulary/common-words-100.htm
+constexpr std::string_view COMMON_WORDS =
+    "the be to of and a in that have i "
+    "it for not on with he as you do at "
+    "this but his by from they we say her she "
+    "or an will my one all would there their what "
+    "so up out if about who get which go me "
+    "when make can like time no just him know take "
+    "person into year your good some could them see other "
+    "than then now look only come its over think also "
+    "back after use two how our work first well way "
+    "even new want because any these give day most us";
+
+// Return if the character separates words
+inline bool isSeparator(const char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\f' || c == '\v';
+}
+
+// Fold uppercase ASCII letters to lowercase
+inline unsigned char fold(const char c)
+{
+    return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c + ('a' - 'A'))
+                                  : static_cast<unsigned char>(c);
+}
+
+// FNV-1a hash of the case-folded word bytes
+std::size_t hashWord(std::string_view word)
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const char c : word) {
+        hash ^= fold(c);
+        hash *= 1099511628211ULL;
+    }
+    return static_cast<std::size_t>(hash);
+}
+
+// Case-insensitive comparison of two words
+bool sameWord(std::string_view a, std::string_view b)
+{
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); i++) {
+        if (fold(a[i]) != fold(b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Call func(offset, length) for every whitespace-separated word in the text
+template<typename Func>
+void forEachWord(std::string_view text, Func func)
+{
+    const std::size_t size = text.size();
+    std::size_t pos = 0;
+    while (pos < size) {
+        while (pos < size && isSeparator(text[pos])) {
+            pos++;
+        }
+        const std::size_t start = pos;
+        while (pos < size && !isSeparator(text[pos])) {
+            pos++;
+        }
+        if (pos > start) {
+            func(start, pos - start);
+        }
+    }
+}
+
+} // namespace
+
+const Dictionary& Dictionary::builtin()
+{
+    static const Dictionary dictionary(COMMON_WORDS);
+    return dictionary;
+}
+
+std::unique_ptr<Dictionary> Dictionary::fromFile(const std::string& filePath)
+{
+    MappedFile file(filePath);
+
+    // Word offsets are stored in 32 bits
+    if (!file.isOpen() || file.view().size() > std::numeric_limits<std::uint32_t>::max()) {
+        return nullptr;
+    }
+
+    return std::unique_ptr<Dictionary>(new Dictionary(std::move(file)));
+}
+
+bool Dictionary::fromOption(const Options& options, const std::string& flag, std::unique_ptr<Dictionary>& wordList)
+{
+    wordList.reset();
+    const auto wordFile = options.find(flag);
+    if (wordFile == options.end()) {
+        return true;
+    }
+
+    wordList = fromFile(wordFile->second);
+    if (!wordList) {
+        std::cout << "Unable to open dictionary \"" << wordFile->second << "\". Please check your inputs and try again." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+Dictionary::Dictionary(std::string_view text)
+    : m_text(text)
+{
+    index();
+}
+
+Dictionary::Dictionary(MappedFile&& file)
+    : m_file(std::move(file))
+{
+    m_text = m_file.view();
+    index();
+}
+
+void Dictionary::index()
+{
+    // Size the table to at least twice the word count so probe chains stay short
+    std::size_t words = 0;
+    forEachWord(m_text, [&words](std::size_t, std::size_t) { words++; });
+
+    std::size_t capacity = 16;
+    while (capacity < words * 2) {
+        capacity <<= 1;
+    }
+    m_slots.assign(capacity, Entry{0, 0});
+    m_mask = capacity - 1;
+
+    forEachWord(m_text, [this](std::size_t offset, std::size_t length) {
+        const Entry entry{static_cast<std::uint32_t>(offset), static_cast<std::uint32_t>(length)};
+        const auto text = word(entry);
+
+        // Linear probe for either the word itself (duplicate) or a free slot
+        std::size_t slot = hashWord(text) & m_mask;
+        while (m_slots[slot].length != 0) {
+            if (sameWord(word(m_slots[slot]), text)) {
+                return;
+            }
+            slot = (slot + 1) & m_mask;
+        }
+        m_slots[slot] = entry;
+        m_count++;
+    });
+}
+
+// Return if the word is found in the dictionary
+bool Dictionary::contains(std::string_view word) const
+{
+    if (word.empty()) {
+        return false;
+    }
+
+    std::size_t slot = hashWord(word) & m_mask;
+    while (m_slots[slot].length != 0) {
+        const auto& entry = m_slots[slot];
+        if (entry.length == word.size() && sameWord(this->word(entry), word)) {
+            return true;
+        }
+        slot = (slot + 1) & m_mask;
+    }
+    return false;
+}
@@ -0,0 +1,5466 @@
+/*****************************************************************************
+ * File: EnglishQuadgrams.cpp
+ *
+ * Description: See EnglishQuadgrams.h
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#include "EnglishQuadgrams.h"
+
+// Generated offline from about 1.1 million letters of English prose (Isaac
+// Newton's Opticks, the Vim user manual and the common free software license
+// texts): every run of four letters, counted with case, spaces and
+// punctuation dropped, keeping the quadgrams seen at least twice. Most
+// common first.
+const QuadgramCount ENGLISH_QUADGRAMS[] = {
+    {"TION", 4984}, {"THER", 4480}, {"OFTH", 4391}, {"FTHE", 4265}, {"NTHE", 3499}, {"THES", 3204},
+    {"THAT", 3125}, {"OTHE", 3075}, {"ETHE", 3063}, {"THIS", 2825}, {"HERE", 2542}, {"TTHE", 2375},
+    {"WITH", 2241}, {"THEC", 2151}, {"INTH", 2097}, {"IGHT", 1998}, {"STHE", 1979}, {"FILE", 1972},
+    {"DTHE", 1826}, {"COMM", 1755}, {"THEF", 1733}, {"ANDT", 1721}, {"NDTH", 1712}, {"IONS", 1711},
+    {"MAND", 1669}, {"CTIO", 1589}, {"SOFT", 1563}, {"TOTH", 1544}, {"ATIO", 1543}, {"THEL", 1533},
+    {"THEP", 1499}, {"LINE", 1486}, {"OMMA", 1471}, {"MMAN", 1458}, {"THEM", 1450}, {"RTHE", 1423},
+    {"INGT", 1399}, {"HICH", 1359}, {"WHIC", 1358}, {"RACT", 1336}, {"EFOR", 1273}, {"SAND", 1269},
+    {"TING", 1263}, {"FROM", 1253}, {"MENT", 1253}, {"THEI", 1236}, {"EAND", 1235}, {"HECO", 1187},
+    {"NGTH", 1186}, {"ERTH", 1184}, {"ENSE", 1168}, {"WILL", 1165}, {"COLO", 1161}, {"ATTH", 1158},
+    {"THET", 1152}, {"ONTH", 1095}, {"YTHE", 1080}, {"HESE", 1068}, {"LICE", 1067}, {"ICEN", 1060},
+    {"CENS", 1057}, {"SION", 1047}, {"PART", 1038}, {"THEN", 1007}, {"HTHE", 1001}, {"LOUR", 997},
+    {"OLOU", 997}, {"ESOF", 991}, {"HEFI", 982}, {"ANDS", 979}, {"IONO", 977}, {"LIGH", 973},
+    {"WORK", 965}, {"WHEN", 962}, {"REFR", 955}, {"DIST", 946}, {"EFRA", 940}, {"HELI", 936},
+    {"TAND", 928}, {"EOFT", 916}, {"THED", 913}, {"ECOM", 895}, {"CONT", 890}, {"THEO", 885},
+    {"RING", 878}, {"GTHE", 871}, {"FORE", 864}, {"ANGE", 847}, {"STAN", 847}, {"TEXT", 847},
+    {"ESTH", 846}, {"SETH", 840}, {"THEE", 838}, {"ETHI", 824}, {"ONOF", 823}, {"YOUC", 821},
+    {"CHAN", 818}, {"INGS", 809}, {"EVER", 801}, {"ABLE", 798}, {"ECTI", 793}, {"BYTH", 792},
+    {"COMP", 792}, {"MTHE", 776}, {"EREF", 771}, {"ECON", 768}, {"FORM", 767}, {"ACTI", 764},
+    {"INGA", 763}, {"THAN", 761}, {"ORTH", 750}, {"DING", 749}, {"OURS", 746}, {"HATT", 745},
+    {"THEW", 742}, {"ERSI", 740}, {"EYOU", 737}, {"FRAC", 732}, {"ROMT", 722}, {"SPEC", 722},
+    {"MPLE", 720}, {"ENTH", 716}, {"HESA", 713}, {"EDTH", 712}, {"RIGH", 705}, {"OMTH", 701},
+    {"COPY", 694}, {"HAVE", 692}, {"NOTH", 691}, {"STRI", 688}, {"EDIN", 684}, {"OUCA", 684},
+    {"TOFT", 684}, {"VERS", 681}, {"RETH", 679}, {"SING", 678}, {"UCAN", 677}, {"NTER", 676},
+    {"IONA", 670}, {"OUND", 664}, {"RAYS", 662}, {"ENTS", 659}, {"THEY", 658}, {"THEB", 654},
+    {"STHA", 652}, {"ETHA", 651}, {"FORT", 651}, {"THTH", 651}, {"LLOW", 650}, {"MORE", 645},
+    {"HANG", 643}, {"EDTO", 642}, {"THEG", 642}, {"IRST", 639}, {"OVER", 639}, {"THEA", 639},
+    {"CHAR", 637}, {"FIRS", 636}, {"FFER", 635}, {"HEIR", 635}, {"ITHT", 633}, {"ENCE", 630},
+    {"SAME", 630}, {"EFIL", 629}, {"ALLY", 628}, {"ANDA", 627}, {"ACTE", 621}, {"OULD", 614},
+    {"EDBY", 609}, {"ITIO", 609}, {"HEPR", 608}, {"TERM", 607}, {"INDO", 604}, {"LECT", 604},
+    {"THIN", 604}, {"MAKE", 603}, {"ESAM", 601}, {"ANCE", 600}, {"FYOU", 599}, {"ANDI", 593},
+    {"SYOU", 591}, {"YOUR", 590}, {"IBUT", 588}, {"RIBU", 588}, {"TRIB", 587}, {"EINT", 584},
+    {"EDIT", 582}, {"ERED", 582}, {"HISL", 581}, {"INTE", 580}, {"SINT", 578}, {"HOSE", 577},
+    {"SOME", 576}, {"ERIN", 575}, {"VERY", 575}, {"ISLI", 574}, {"ATED", 570}, {"CTED", 570},
+    {"RSIO", 570}, {"EPRO", 569}, {"UNDE", 569}, {"USET", 569}, {"DAND", 568}, {"IFTH", 568},
+    {"NDER", 568}, {"NOFT", 567}, {"TYPE", 567}, {"INES", 564}, {"TIME", 563}, {"IONT", 560},
+    {"HERA", 558}, {"RAND", 558}, {"OUGH", 555}, {"ATER", 549}, {"IFYO", 547}, {"SFOR", 547},
+    {"ANOT", 544}, {"USED", 544}, {"NAME", 543}, {"STAR", 543}, {"PROG", 541}, {"PROP", 540},
+    {"ROGR", 535}, {"UMEN", 535}, {"PRES", 531}, {"TYOU", 531}, {"RECT", 528}, {"WIND", 528},
+    {"NDOW", 527}, {"RENT", 525}, {"DINT", 524}, {"ENTI", 524}, {"NDIN", 524}, {"APPE", 523},
+    {"OGRA", 518}, {"ALSO", 516}, {"AMPL", 515}, {"EXAM", 515}, {"INTO", 515}, {"IONI", 514},
+    {"ORMA", 514}, {"SARE", 514}, {"MBER", 513}, {"SIDE", 513}, {"SLIC", 513}, {"TART", 513},
+    {"ECOL", 511}, {"LASS", 508}, {"WHER", 505}, {"GRAM", 502}, {"NYOU", 501}, {"ATCH", 500},
+    {"HATI", 498}, {"TANC", 498}, {"XAMP", 498}, {"ERAL", 494}, {"HING", 494}, {"EFLE", 489},
+    {"REFL", 488}, {"ESIN", 486}, {"YOUM", 478}, {"YOUW", 478}, {"GLAS", 477}, {"SCRI", 477},
+    {"FTHI", 473}, {"THOS", 473}, {"GREE", 470}, {"ILES", 470}, {"PTIO", 470}, {"EFIR", 469},
+    {"INCL", 469}, {"ECUR", 467}, {"ISTA", 467}, {"ILET", 465}, {"SNOT", 464}, {"REAT", 463},
+    {"LIST", 461}, {"ERAY", 460}, {"LTHE", 460}, {"ODIF", 460}, {"PECI", 460}, {"SUCH", 460},
+    {"ELIN", 458}, {"DITI", 457}, {"EUSE", 457}, {"HECU", 457}, {"ESAN", 456}, {"SECO", 456},
+    {"ISTR", 455}, {"READ", 455}, {"DTHA", 453}, {"ETER", 453}, {"INGI", 452}, {"COND", 451},
+    {"EREA", 447}, {"MODI", 447}, {"ANDC", 443}, {"IBRA", 443}, {"PLAC", 443}, {"ERAN", 442},
+    {"OPTI", 441}, {"RANG", 441}, {"SECT", 438}, {"CLUD", 435}, {"TERS", 434}, {"ARTO", 433},
+    {"TERT", 433}, {"UMBE", 433}, {"LIKE", 431}, {"MATC", 431}, {"EPAR", 430}, {"HETH", 430},
+    {"URSO", 428}, {"HEDI", 427}, {"NAND", 427}, {"LLTH", 426}, {"ONLY", 425}, {"RARY", 425},
+    {"ITHA", 424}, {"LACE", 424}, {"RISM", 424}, {"TOBE", 424}, {"HITE", 423}, {"TTER", 423},
+    {"EREN", 422}, {"HETE", 422}, {"NUMB", 422}, {"SWIT", 421}, {"TAIN", 421}, {"MOVE", 420},
+    {"DIFF", 419}, {"INED", 419}, {"CTER", 418}, {"EDIS", 417}, {"ESTO", 417}, {"HEFO", 417},
+    {"THEV", 416}, {"NCLU", 415}, {"PRIS", 415}, {"FTER", 412}, {"DWIT", 411}, {"INGO", 410},
+    {"RESS", 410}, {"TSOF", 410}, {"UBLI", 410}, {"FORA", 409}, {"EFIN", 408}, {"HARA", 408},
+    {"WHIT", 408}, {"ARAC", 405}, {"CONS", 404}, {"TRAN", 404}, {"IBLE", 403}, {"ANDB", 402},
+    {"EWOR", 401}, {"RTHA", 400}, {"BRAR", 399}, {"ESSI", 399}, {"LIBR", 399}, {"EWIT", 398},
+    {"COVE", 397}, {"ISTH", 397}, {"NOTI", 397}, {"ONSO", 396}, {"AFTE", 395}, {"IREC", 395},
+    {"RTOF", 395}, {"ALLT", 394}, {"HEPA", 394}, {"INST", 394}, {"ITHO", 394}, {"HENT", 393},
+    {"LLBE", 393}, {"THOU", 393}, {"FUNC", 392}, {"EROF", 390}, {"DIRE", 388}, {"ITIN", 388},
+    {"ESEC", 387}, {"FERE", 386}, {"PEAR", 386}, {"DEFI", 385}, {"DERT", 385}, {"PPEA", 385},
+    {"DENT", 384}, {"WORD", 384}, {"ISTO", 383}, {"MADE", 383}, {"CRIP", 382}, {"ERMI", 382},
+    {"RIPT", 382}, {"ARTI", 381}, {"NCTI", 379}, {"USIN", 379}, {"BEIN", 377}, {"HEMA", 377},
+    {"RANS", 377}, {"YAND", 377}, {"EREI", 376}, {"MOST", 376}, {"WRIT", 376}, {"CODE", 374},
+    {"RSOR", 374}, {"ROUG", 373}, {"WANT", 373}, {"ARTS", 372}, {"EARE", 372}, {"EMEN", 372},
+    {"UNCT", 372}, {"ECHA", 371}, {"LETH", 371}, {"ENTA", 370}, {"SITI", 370}, {"ANDO", 369},
+    {"LESS", 369}, {"PUBL", 369}, {"EVIM", 368}, {"DBYT", 367}, {"TENT", 367}, {"ICAT", 366},
+    {"NTTO", 366}, {"REFO", 366}, {"TOMA", 365}, {"INAL", 364}, {"HERI", 363}, {"DIFI", 362},
+    {"THRO", 362}, {"ANDW", 361}, {"HISI", 359}, {"AUSE", 357}, {"NING", 357}, {"UPON", 357},
+    {"INGE", 356}, {"UTTH", 356}, {"EDAN", 355}, {"PLUG", 355}, {"PORT", 355}, {"CHTH", 354},
+    {"EWHI", 354}, {"ANDL", 353}, {"ENOT", 353}, {"ONTR", 353}, {"WERE", 353}, {"NESS", 352},
+    {"HEIN", 351}, {"HROU", 351}, {"EENT", 350}, {"MUST", 350}, {"TALL", 350}, {"TEDT", 350},
+    {"GENE", 349}, {"ECTE", 348}, {"MEAN", 348}, {"VARI", 348}, {"ABOU", 347}, {"MODE", 347},
+    {"SSIO", 347}, {"CEOF", 346}, {"ESPE", 346}, {"OUSE", 346}, {"TFOR", 346}, {"OFAN", 344},
+    {"OURC", 343}, {"ENTE", 342}, {"LATE", 342}, {"LETE", 342}, {"ATTE", 341}, {"NEAN", 340},
+    {"POSI", 340}, {"MEDI", 339}, {"STIN", 339}, {"BACK", 338}, {"SWHI", 338}, {"BOUT", 337},
+    {"CURS", 337}, {"ONSI", 337}, {"EATE", 335}, {"FINE", 335}, {"HEMO", 334}, {"RTHI", 333},
+    {"EPLA", 332}, {"IFFE", 332}, {"FIND", 330}, {"INSE", 329}, {"KING", 329}, {"TETH", 329},
+    {"BEFO", 328}, {"LUGI", 328}, {"OSIT", 328}, {"CATI", 327}, {"CAUS", 327}, {"SERV", 327},
+    {"IFIE", 326}, {"SEVE", 326}, {"UGIN", 326}, {"YRIG", 326}, {"IDEN", 325}, {"LUDE", 325},
+    {"YOUA", 325}, {"ANTT", 324}, {"CALL", 323}, {"ITIS", 323}, {"ONAN", 323}, {"DOES", 322},
+    {"ONST", 322}, {"PING", 322}, {"ETWE", 321}, {"NFOR", 321}, {"CETH", 320}, {"THEH", 320},
+    {"DFOR", 318}, {"ERET", 318}, {"IFIC", 318}, {"NTHA", 318}, {"TURE", 318}, {"ASTH", 317},
+    {"IOUS", 317}, {"TORY", 317}, {"TWAR", 317}, {"VETH", 317}, {"ALLE", 316}, {"CUME", 316},
+    {"DOCU", 316}, {"JECT", 316}, {"OCUM", 316}, {"OFTW", 316}, {"OLLO", 316}, {"REST", 316},
+    {"FLEC", 315}, {"FOLL", 315}, {"PARA", 315}, {"ETEX", 314}, {"FREE", 314}, {"ILLB", 314},
+    {"TERI", 313}, {"HOUT", 312}, {"NEXT", 312}, {"APER", 311}, {"EOTH", 311}, {"OPYR", 311},
+    {"BETW", 310}, {"EGRE", 310}, {"TICE", 310}, {"TORE", 310}, {"TWEE", 310}, {"WHAT", 310},
+    {"ATIS", 309}, {"ECTO", 309}, {"HISC", 309}, {"ONEA", 309}, {"RMAT", 309}, {"ANDD", 308},
+    {"AREN", 308}, {"ELET", 308}, {"POSE", 308}, {"PYRI", 308}, {"SERT", 308}, {"UGHT", 308},
+    {"WEEN", 308}, {"ISCO", 307}, {"NTHI", 307}, {"ORAN", 306}, {"STOF", 306}, {"ITHE", 305},
+    {"PEND", 305}, {"TEDI", 305}, {"ORET", 304}, {"RINT", 304}, {"SWHE", 304}, {"CTRL", 303},
+    {"NSOF", 303}, {"TOCO", 303}, {"THEU", 302}, {"EPRE", 301}, {"SUSE", 301}, {"ONTA", 300},
+    {"ANDR", 299}, {"BLUE", 298}, {"TCHA", 298}, {"BUTI", 297}, {"HELE", 297}, {"TINT", 297},
+    {"ELIB", 296}, {"NGLE", 296}, {"EDWI", 295}, {"GHTH", 295}, {"INGC", 295}, {"ITEM", 295},
+    {"NCEO", 295}, {"OUTO", 295}, {"WARE", 295}, {"REAS", 294}, {"SCOM", 294}, {"ORRE", 293},
+    {"REIN", 293}, {"SPAC", 293}, {"TEDA", 292}, {"VERA", 292}, {"ANBE", 291}, {"ANDP", 291},
+    {"INCI", 291}, {"TTHI", 291}, {"ECIF", 290}, {"EING", 290}, {"EACH", 289}, {"ISNO", 289},
+    {"NSER", 289}, {"SEAR", 289}, {"TERN", 288}, {"CHES", 287}, {"GETH", 287}, {"HOLE", 287},
+    {"ICAL", 287}, {"NGES", 287}, {"ANDF", 286}, {"ENER", 286}, {"ERES", 286}, {"FTWA", 286},
+    {"INDE", 286}, {"ELIG", 285}, {"FOUN", 285}, {"GREA", 285}, {"HESP", 285}, {"HESU", 285},
+    {"REEN", 285}, {"GHTS", 284}, {"ONVE", 284}, {"OTIC", 284}, {"BJEC", 283}, {"INGW", 283},
+    {"NDRE", 283}, {"NTAI", 283}, {"SORT", 283}, {"TERA", 283}, {"CONV", 282}, {"NDOF", 282},
+    {"ATYO", 281}, {"ENDI", 281}, {"ESTA", 281}, {"INDI", 281}, {"SOTH", 281}, {"TTHA", 281},
+    {"ENYO", 280}, {"NGAN", 280}, {"OREX", 279}, {"WOUL", 279}, {"HERS", 278}, {"ONDI", 278},
+    {"OUMA", 278}, {"CTOR", 277}, {"ONSA", 277}, {"SOUR", 277}, {"YOUT", 277}, {"CIDE", 276},
+    {"NERA", 276}, {"RESE", 276}, {"BUTE", 275}, {"ENTT", 275}, {"FALL", 275}, {"NSTA", 275},
+    {"ETOT", 274}, {"ISTI", 274}, {"NGIN", 274}, {"ORDI", 274}, {"REVI", 274}, {"CESS", 273},
+    {"DTHI", 273}, {"HELP", 273}, {"HENY", 273}, {"HERW", 273}, {"NDCO", 272}, {"NDIT", 272},
+    {"OMET", 272}, {"ORDE", 272}, {"SYNT", 272}, {"TWIT", 272}, {"WING", 272}, {"EQUA", 271},
+    {"MATI", 271}, {"TIVE", 271}, {"WARD", 271}, {"ASSE", 270}, {"ECUT", 270}, {"ISIS", 270},
+    {"NTAX", 270}, {"UARE", 270}, {"YNTA", 270}, {"MINA", 269}, {"OTHA", 269}, {"URCE", 269},
+    {"CANB", 268}, {"ETTH", 268}, {"NTIN", 268}, {"OPER", 268}, {"COME", 267}, {"QUAL", 267},
+    {"ULAR", 267}, {"ANDM", 266}, {"EARC", 266}, {"ICHT", 266}, {"NEOF", 266}, {"OFIN", 266},
+    {"ESSA", 265}, {"ESSO", 265}, {"HATY", 265}, {"HEVI", 265}, {"LETO", 265}, {"PACE", 265},
+    {"VERT", 265}, {"ARCH", 264}, {"ERST", 264}, {"EXEC", 264}, {"HANT", 264}, {"ORTI", 264},
+    {"REXA", 263}, {"ANIN", 262}, {"BLIC", 262}, {"EXPE", 262}, {"INCH", 262}, {"LYTH", 262},
+    {"PAPE", 262}, {"ROFT", 262}, {"USRT", 262}, {"EDON", 261}, {"EWHE", 261}, {"LAST", 261},
+    {"PLET", 261}, {"TEST", 260}, {"XECU", 260}, {"ANYO", 259}, {"ENTO", 259}, {"ETYP", 259},
+    {"INGF", 259}, {"ONTO", 259}, {"USER", 259}, {"AMET", 258}, {"ANGI", 258}, {"NSTH", 258},
+    {"ORKS", 258}, {"OWIN", 258}, {"RATI", 258}, {"RECO", 258}, {"SOFA", 258}, {"THRE", 258},
+    {"ERTO", 257}, {"ESSE", 257}, {"INAT", 257}, {"REES", 257}, {"REIS", 257}, {"ANDE", 256},
+    {"CIRC", 256}, {"DELE", 256}, {"ERMS", 256}, {"ETWO", 256}, {"IMES", 256}, {"IONW", 256},
+    {"ISIN", 256}, {"ELLO", 255}, {"ESCR", 255}, {"OFCO", 255}, {"RITE", 255}, {"TEDB", 255},
+    {"TINC", 255}, {"HEST", 254}, {"METH", 254}, {"THUS", 254}, {"EANO", 253}, {"APPL", 252},
+    {"HATA", 252}, {"HERT", 252}, {"PERI", 252}, {"TOFA", 252}, {"ASTO", 250}, {"DONT", 250},
+    {"FIED", 250}, {"TIES", 250}, {"VERE", 250}, {"ANTH", 249}, {"RANT", 249}, {"RATE", 249},
+    {"RYOU", 249}, {"AINS", 248}, {"EFRO", 248}, {"ERAT", 248}, {"ERWI", 248}, {"ENDO", 247},
+    {"KETH", 247}, {"SINC", 247}, {"ALLO", 246}, {"HAND", 246}, {"NGTO", 246}, {"ORIN", 246},
+    {"PROV", 246}, {"SSES", 246}, {"URRE", 246}, {"ENAM", 245}, {"ERCO", 245}, {"RTIC", 245},
+    {"EEND", 244}, {"HESI", 244}, {"ITTH", 244}, {"TWHI", 244}, {"ENTL", 243}, {"FOLD", 243},
+    {"HATS", 243}, {"LONG", 243}, {"NDEN", 243}, {"PASS", 243}, {"RALL", 243}, {"STAL", 243},
+    {"AINT", 242}, {"ATES", 242}, {"DOFT", 242}, {"EDOC", 242}, {"INGL", 242}, {"ROPO", 242},
+    {"UMAY", 242}, {"AUTO", 241}, {"EPRI", 241}, {"OWTH", 241}, {"LEAS", 240}, {"MENU", 240},
+    {"OTHI", 240}, {"WATE", 240}, {"YTHI", 240}, {"EFOL", 239}, {"HENE", 239}, {"NCID", 239},
+    {"REDI", 239}, {"TOFI", 239}, {"EOFA", 238}, {"HALL", 238}, {"OBJE", 238}, {"EMAN", 237},
+    {"AKES", 236}, {"ARDS", 236}, {"BECA", 236}, {"HIST", 236}, {"ORMO", 236}, {"TABL", 236},
+    {"AREA", 235}, {"HEWO", 235}, {"TERO", 235}, {"TLIN", 235}, {"VIOL", 235}, {"LOWI", 234},
+    {"NTRI", 234}, {"STOT", 234}, {"ILIT", 233}, {"NCES", 233}, {"OFLI", 233}, {"STOR", 233},
+    {"TCOM", 233}, {"YOFT", 233}, {"ARTH", 232}, {"BLET", 232}, {"ERVA", 232}, {"ESEN", 232},
+    {"NDSO", 232}, {"OESN", 232}, {"ABOV", 231}, {"BOVE", 231}, {"EQUI", 231}, {"RMIN", 231},
+    {"BODI", 230}, {"ODIE", 230}, {"UTIO", 230}, {"XPER", 230}, {"OREA", 229}, {"HEEX", 228},
+    {"HEMI", 228}, {"IESO", 228}, {"INFO", 228}, {"ININ", 228}, {"UCHA", 228}, {"DIES", 227},
+    {"EANS", 227}, {"ECOP", 227}, {"LITY", 227}, {"MAYB", 227}, {"OLET", 227}, {"ACES", 226},
+    {"ARED", 226}, {"AYBE", 226}, {"EVIO", 226}, {"RTXT", 226}, {"SIBL", 226}, {"YELL", 226},
+    {"DOTH", 225}, {"HEDO", 225}, {"HEEN", 225}, {"PERM", 225}, {"ATIN", 224}, {"EALL", 224},
+    {"ISMA", 224}, {"LEOF", 224}, {"PECT", 224}, {"RTIO", 224}, {"CTIN", 223}, {"INEA", 223},
+    {"NTOT", 223}, {"SEAN", 223}, {"SFRO", 223}, {"STRE", 223}, {"SUAL", 223}, {"CHIN", 222},
+    {"CIFI", 222}, {"ESET", 222}, {"HEGL", 222}, {"NATE", 222}, {"RFOR", 222}, {"RREN", 222},
+    {"RSOF", 222}, {"RTSO", 222}, {"TATI", 222}, {"TSTH", 222}, {"ARIA", 221}, {"OMPO", 221},
+    {"ONIS", 221}, {"ORCO", 221}, {"SEOF", 221}, {"SRTX", 221}, {"UNTI", 221}, {"CREA", 220},
+    {"ECTR", 220}, {"ERVE", 220}, {"CEPT", 219}, {"ONIN", 219}, {"TRIN", 219}, {"CURR", 218},
+    {"ICUL", 218}, {"IONF", 218}, {"SSIN", 218}, {"STHI", 218}, {"TAKE", 218}, {"YOUD", 218},
+    {"YOUH", 218}, {"DYOU", 217}, {"ESWH", 217}, {"MAGE", 217}, {"NTTH", 217}, {"OUWA", 217},
+    {"SUPP", 217}, {"UFFE", 217}, {"AKIN", 216}, {"CASE", 216}, {"HENA", 216}, {"HEOT", 216},
+    {"TREF", 216}, {"CLES", 215}, {"EINC", 215}, {"INGM", 215}, {"MUCH", 215}, {"OMAK", 215},
+    {"SENT", 215}, {"SPAR", 215}, {"UWAN", 215}, {"FRAN", 214}, {"LOOK", 214}, {"MANY", 214},
+    {"OUAR", 214}, {"YING", 214}, {"BECO", 213}, {"INIT", 213}, {"IOLE", 213}, {"NUSE", 213},
+    {"ARGU", 212}, {"ELEC", 212}, {"HATW", 212}, {"NALL", 212}, {"NGCO", 212}, {"SEDT", 212},
+    {"WTHE", 212}, {"ERSO", 211}, {"GIVE", 211}, {"ICHI", 211}, {"LEAN", 211}, {"OUNT", 211},
+    {"PONT", 211}, {"REMA", 211}, {"ESYO", 210}, {"NETH", 210}, {"REOF", 210}, {"SELE", 210},
+    {"VIDE", 210}, {"CULA", 209}, {"LATI", 209}, {"LISH", 209}, {"NSAN", 209}, {"EGLA", 208},
+    {"INAN", 208}, {"NEED", 208}, {"ONES", 208}, {"OUHA", 208}, {"REQU", 208}, {"DOWS", 207},
+    {"REAN", 207}, {"ESUN", 206}, {"GHTO", 206}, {"LOCA", 206}, {"BSER", 205}, {"STTH", 205},
+    {"SWIL", 205}, {"VATI", 205}, {"COPI", 204}, {"EPAP", 204}, {"HEOR", 204}, {"IMEN", 204},
+    {"ONSE", 204}, {"SCON", 204}, {"UHAV", 204}, {"VIMW", 204}, {"EONE", 203}, {"NGIB", 203},
+    {"NINT", 203}, {"OGET", 203}, {"EWIN", 202}, {"GHTA", 202}, {"LETY", 202}, {"ROVI", 202},
+    {"SSOF", 202}, {"UTOF", 202}, {"VIEW", 202}, {"YCON", 202}, {"CHAP", 201}, {"EAST", 201},
+    {"USES", 201}, {"EDFO", 200}, {"EITH", 200}, {"NUAL", 200}, {"OBSE", 200}, {"SINE", 200},
+    {"EDIA", 199}, {"ENSI", 199}, {"FICA", 199}, {"HISS", 199}, {"HREE", 199}, {"NDLI", 199},
+    {"NTEN", 199}, {"OVET", 199}, {"RALP", 199}, {"TWOR", 199}, {"YREF", 199}, {"EXTT", 198},
+    {"GHTT", 198}, {"NDTO", 198}, {"NINC", 198}, {"OINT", 198}, {"ORTO", 198}, {"RSTO", 198},
+    {"SHAL", 198}, {"ALIN", 197}, {"DNOT", 197}, {"EVEN", 197}, {"GAIN", 197}, {"ISTE", 197},
+    {"AFIL", 196}, {"ANGL", 196}, {"HATC", 196}, {"LITT", 196}, {"NTIT", 196}, {"ROUN", 196},
+    {"AGAI", 195}, {"AVET", 195}, {"NTOF", 195}, {"TURN", 195}, {"TWHE", 195}, {"ERIM", 194},
+    {"ITYO", 194}, {"LEXI", 194}, {"ONAL", 194}, {"RESP", 194}, {"SEDO", 194}, {"CLIC", 193},
+    {"ESTR", 193}, {"GUME", 193}, {"ISSI", 193}, {"NDBY", 193}, {"NSEA", 193}, {"OUTT", 193},
+    {"RGUM", 193}, {"THIR", 193}, {"TNOT", 193}, {"DWOR", 192}, {"HEWH", 192}, {"ITTE", 192},
+    {"ODUC", 192}, {"RODU", 192}, {"STAT", 192}, {"TCON", 192}, {"ALCO", 191}, {"FLEX", 191},
+    {"HEDE", 191}, {"IMAG", 191}, {"LESO", 191}, {"RCOM", 191}, {"RDER", 191}, {"SPRO", 191},
+    {"UALL", 191}, {"UPPO", 191}, {"VIMT", 191}, {"CORR", 190}, {"EFOU", 190}, {"MOTI", 190},
+    {"SETT", 190}, {"ALIT", 189}, {"ARET", 189}, {"ARRA", 189}, {"DEDT", 189}, {"OFIT", 189},
+    {"TVIM", 189}, {"UTOR", 189}, {"VIMS", 189}, {"DFRO", 188}, {"FORI", 188}, {"INEO", 188},
+    {"MAIN", 188}, {"TOGE", 188}, {"HERC", 187}, {"MALL", 187}, {"NDST", 187}, {"NSID", 187},
+    {"OFAL", 187}, {"RENO", 187}, {"DVER", 186}, {"ESAR", 186}, {"ESST", 186}, {"OTIO", 186},
+    {"RDIN", 186}, {"SHOW", 186}, {"TOUS", 186}, {"ALLI", 185}, {"NCET", 185}, {"NDIF", 185},
+    {"NTRA", 185}, {"OSET", 185}, {"RENC", 185}, {"SIST", 185}, {"DCON", 184}, {"EXPL", 184},
+    {"FACE", 184}, {"INET", 184}, {"METE", 184}, {"RIME", 184}, {"SEST", 184}, {"TFRO", 184},
+    {"AGES", 183}, {"BUFF", 183}, {"GINA", 183}, {"PPLI", 183}, {"RESU", 183}, {"RFAC", 183},
+    {"ALMO", 182}, {"COUL", 182}, {"ENDE", 182}, {"HIRD", 182}, {"TEMS", 182}, {"ANDY", 181},
+    {"COUN", 181}, {"DSTH", 181}, {"EDEF", 181}, {"EFUL", 181}, {"NDWH", 181}, {"ONTI", 181},
+    {"BLES", 180}, {"BUTO", 180}, {"CIAL", 180}, {"FECT", 180}, {"HELA", 180}, {"HEME", 180},
+    {"HISW", 180}, {"ILEI", 180}, {"ITLE", 180}, {"MAPP", 180}, {"NTED", 180}, {"SUBS", 180},
+    {"TONE", 180}, {"TWIL", 180}, {"YTHA", 180}, {"EINS", 179}, {"ERGE", 179}, {"ESNO", 179},
+    {"IATE", 179}, {"PERA", 179}, {"TILL", 179}, {"DISP", 178}, {"DLIN", 178}, {"EXIO", 178},
+    {"REPR", 178}, {"TCHE", 178}, {"TITL", 178}, {"XION", 178}, {"BREA", 177}, {"ERTE", 177},
+    {"GHTW", 177}, {"MISS", 177}, {"NGWI", 177}, {"SEDI", 177}, {"BILI", 176}, {"ESOR", 176},
+    {"HINT", 176}, {"LEFO", 176}, {"LLIN", 176}, {"OCAL", 176}, {"OVID", 176}, {"PROD", 176},
+    {"TTLE", 176}, {"DETH", 175}, {"ETIM", 175}, {"ITTL", 175}, {"NDED", 175}, {"NDIS", 175},
+    {"SSTH", 175}, {"WHOL", 175}, {"ACOM", 174}, {"ASIN", 174}, {"DONE", 174}, {"EMOR", 174},
+    {"GROU", 174}, {"ISUS", 174}, {"LICL", 174}, {"MAKI", 174}, {"OMME", 174}, {"OPOR", 174},
+    {"PPIN", 174}, {"SAGE", 174}, {"SEQU", 174}, {"THIC", 174}, {"THOR", 174}, {"TTIN", 174},
+    {"EESO", 173}, {"ICHA", 173}, {"ICLI", 173}, {"ITHI", 173}, {"NCOM", 173}, {"OMPL", 173},
+    {"SSAG", 173}, {"NGET", 172}, {"PPOS", 172}, {"AMES", 171}, {"BERE", 171}, {"INGB", 171},
+    {"ISHE", 171}, {"KNOW", 171}, {"LEIN", 171}, {"LICA", 171}, {"MANU", 171}, {"ONFI", 171},
+    {"ONOT", 171}, {"PREV", 171}, {"QUIR", 171}, {"RRAN", 171}, {"TFIL", 171}, {"VIMR", 171},
+    {"ECAU", 170}, {"EXCE", 170}, {"INGU", 170}, {"LIQU", 170}, {"OUWI", 170}, {"TOSE", 170},
+    {"VALU", 170}, {"VING", 170}, {"ANUA", 169}, {"EBYT", 169}, {"HECH", 169}, {"HICK", 169},
+    {"PLIC", 169}, {"SEPA", 169}, {"YOTH", 169}, {"EREC", 168}, {"IEST", 168}, {"ILLU", 168},
+    {"IONB", 168}, {"MIGH", 168}, {"ESWI", 167}, {"IDES", 167}, {"REGI", 167}, {"ALPU", 166},
+    {"EEDI", 166}, {"FORC", 166}, {"REDA", 166}, {"APPI", 165}, {"COMB", 165}, {"FITS", 165},
+    {"ONEO", 165}, {"APTE", 164}, {"AREI", 164}, {"AWOR", 164}, {"EDIF", 164}, {"EISA", 164},
+    {"FANY", 164}, {"HEPL", 164}, {"INGR", 164}, {"NEST", 164}, {"NSET", 164}, {"OCOM", 164},
+    {"PARE", 164}, {"PERF", 164}, {"RCLE", 164}, {"RECE", 164}, {"STER", 164}, {"ACCO", 163},
+    {"ARAT", 163}, {"DERS", 163}, {"DPAR", 163}, {"DWHE", 163}, {"EANY", 163}, {"EQUE", 163},
+    {"HAPT", 163}, {"HERP", 163}, {"ITWI", 163}, {"LEST", 163}, {"LING", 163}, {"MARK", 163},
+    {"NOTA", 163}, {"ORES", 163}, {"PTER", 163}, {"ACED", 162}, {"ALTO", 162}, {"DTOT", 162},
+    {"ESFO", 162}, {"GIBL", 162}, {"ISRE", 162}, {"BUTT", 161}, {"ELEN", 161}, {"FLIG", 161},
+    {"LAND", 161}, {"NORM", 161}, {"PATT", 161}, {"POIN", 161}, {"SURE", 161}, {"ERRO", 160},
+    {"IABL", 160}, {"ILLA", 160}, {"NGSO", 160}, {"NOTE", 160}, {"NWHI", 160}, {"OMPA", 160},
+    {"REAL", 160}, {"REDT", 160}, {"REMO", 160}, {"SPLA", 160}, {"ASON", 159}, {"ATIC", 159},
+    {"EDLI", 159}, {"FTHA", 159}, {"HESO", 159}, {"LTER", 159}, {"NDAN", 159}, {"NOTT", 159},
+    {"UIRE", 159}, {"DENC", 158}, {"EASO", 158}, {"EXTE", 158}, {"IONC", 158}, {"IRCL", 158},
+    {"LPUB", 158}, {"RCON", 158}, {"SBUT", 158}, {"TOAN", 158}, {"WAYS", 158}, {"ATEN", 157},
+    {"AYSA", 157}, {"CONC", 157}, {"CTIV", 157}, {"HEOB", 157}, {"MITT", 157}, {"NDIC", 157},
+    {"SENS", 157}, {"BEEN", 156}, {"EASE", 156}, {"HENI", 156}, {"HEUS", 156}, {"HISA", 156},
+    {"IMWI", 156}, {"MESS", 156}, {"NTAN", 156}, {"NTLY", 156}, {"ONOR", 156}, {"STBE", 156},
+    {"TICA", 156}, {"TTOT", 156}, {"TYOF", 156}, {"CONF", 155}, {"CUTE", 155}, {"RTOT", 155},
+    {"TATE", 155}, {"DIUM", 154}, {"EDIU", 154}, {"FOUR", 154}, {"IMIT", 154}, {"NCEI", 154},
+    {"NDAR", 154}, {"NEAR", 154}, {"NSEI", 154}, {"NTIM", 154}, {"ONWH", 154}, {"VENT", 154},
+    {"ARER", 153}, {"ENEX", 153}, {"ERUS", 153}, {"ERYO", 153}, {"HOUL", 153}, {"IENT", 153},
+    {"OFRE", 153}, {"OMAT", 153}, {"QUEN", 153}, {"SHOU", 153}, {"DIFY", 152}, {"GHTI", 152},
+    {"HEGR", 152}, {"LANG", 152}, {"NTOA", 152}, {"RERE", 152}, {"RROR", 152}, {"ADDI", 151},
+    {"ALUE", 151}, {"CENT", 151}, {"CKNE", 151}, {"DONO", 151}, {"EATT", 151}, {"EDCO", 151},
+    {"ERMA", 151}, {"ERSE", 151}, {"LESA", 151}, {"NATI", 151}, {"OBLI", 151}, {"REAR", 151},
+    {"TECO", 151}, {"EMAT", 150}, {"EREB", 150}, {"NITI", 150}, {"OMBI", 150}, {"ONET", 150},
+    {"OPIE", 150}, {"CECO", 149}, {"CHCO", 149}, {"ENUM", 149}, {"ERFO", 149}, {"ERRE", 149},
+    {"ERTA", 149}, {"ERTI", 149}, {"GAND", 149}, {"IMPL", 149}, {"IVES", 149}, {"KNES", 149},
+    {"MATT", 149}, {"MEOF", 149}, {"NDOR", 149}, {"ORIG", 149}, {"UBST", 149}, {"UTHO", 149},
+    {"AGRE", 148}, {"ALRE", 148}, {"BERO", 148}, {"ELAS", 148}, {"ESUL", 148}, {"HENC", 148},
+    {"HEPO", 148}, {"IDED", 148}, {"NSIN", 148}, {"ONCO", 148}, {"REDW", 148}, {"RMAL", 148},
+    {"RVER", 148}, {"SEIT", 148}, {"STRA", 148}, {"UWIL", 148}, {"AVEA", 147}, {"BEUS", 147},
+    {"DERI", 147}, {"EMOD", 147}, {"ENCO", 147}, {"ESPA", 147}, {"MBIN", 147}, {"OFTE", 147},
+    {"OSED", 147}, {"OUTA", 147}, {"STIT", 147}, {"STOB", 147}, {"STOP", 147}, {"TEND", 147},
+    {"TIST", 147}, {"VIOU", 147}, {"ANGU", 146}, {"DIAM", 146}, {"DISC", 146}, {"EORI", 146},
+    {"GETT", 146}, {"ICKN", 146}, {"ITAN", 146}, {"LETT", 146}, {"LLED", 146}, {"NENT", 146},
+    {"NONE", 146}, {"OURE", 146}, {"TUSE", 146}, {"UMIN", 146}, {"YYOU", 146}, {"ALIS", 145},
+    {"ATIT", 145}, {"BOTH", 145}, {"ECOD", 145}, {"ESHA", 145}, {"HATO", 145}, {"MSOF", 145},
+    {"NGIT", 145}, {"RVIM", 145}, {"SCAN", 145}, {"ULDB", 145}, {"ADTH", 144}, {"AKET", 144},
+    {"AREF", 144}, {"CTLY", 144}, {"EDAS", 144}, {"EDWO", 144}, {"FRIN", 144}, {"HEWI", 144},
+    {"LDBE", 144}, {"LNOT", 144}, {"LYIN", 144}, {"OREI", 144}, {"URFA", 144}, {"USEA", 144},
+    {"YFOR", 144}, {"DINA", 143}, {"EOUT", 143}, {"IONM", 143}, {"ITIE", 143}, {"NGED", 143},
+    {"RPRO", 143}, {"TRAC", 143}, {"TSIN", 143}, {"ANEX", 142}, {"ANTI", 142}, {"ARES", 142},
+    {"ARGE", 142}, {"EMOV", 142}, {"ERPE", 142}, {"GWIT", 142}, {"HISM", 142}, {"IDER", 142},
+    {"NDDI", 142}, {"PERP", 142}, {"PERT", 142}, {"RVAT", 142}, {"USTB", 142}, {"ARLY", 141},
+    {"ATCO", 141}, {"DEGR", 141}, {"ECTS", 141}, {"EETH", 141}, {"ENTR", 141}, {"EPAT", 141},
+    {"HEBO", 141}, {"HEYA", 141}, {"HOFT", 141}, {"IDDL", 141}, {"IGIN", 141}, {"INGP", 141},
+    {"IONE", 141}, {"MIDD", 141}, {"PLAN", 141}, {"RIGI", 141}, {"SABO", 141}, {"SETO", 141},
+    {"SEYO", 141}, {"SINA", 141}, {"SURF", 141}, {"TERU", 141}, {"TINU", 141}, {"YOUN", 141},
+    {"DDLE", 140}, {"EDFR", 140}, {"ITES", 140}, {"LENA", 140}, {"LIMI", 140}, {"NYOT", 140},
+    {"RANY", 140}, {"REBY", 140}, {"RIES", 140}, {"ROMA", 140}, {"RWIT", 140}, {"SULT", 140},
+    {"SVIM", 140}, {"TEAN", 140}, {"ANDV", 139}, {"DARK", 139}, {"EEXP", 139}, {"EMID", 139},
+    {"ERIS", 139}, {"EUND", 139}, {"HALF", 139}, {"ILEA", 139}, {"ITSE", 139}, {"LLNO", 139},
+    {"NOTB", 139}, {"RCOL", 139}, {"RIAB", 139}, {"RSTH", 139}, {"WISE", 139}, {"ALLB", 138},
+    {"ANSM", 138}, {"BLIS", 138}, {"CAND", 138}, {"ECTT", 138}, {"ENUS", 138}, {"ESIT", 138},
+    {"HARE", 138}, {"HIGH", 138}, {"IAME", 138}, {"MMEN", 138}, {"NEDI", 138}, {"NSMI", 138},
+    {"OWER", 138}, {"UNDA", 138}, {"ANNE", 137}, {"ATUR", 137}, {"CEIV", 137}, {"ELIC", 137},
+    {"LMOD", 137}, {"SFIL", 137}, {"STIL", 137}, {"WARR", 137}, {"WHIL", 137}, {"ASTR", 136},
+    {"EDVE", 136}, {"ESCO", 136}, {"ESPO", 136}, {"EWIL", 136}, {"FINI", 136}, {"FORW", 136},
+    {"LAIN", 136}, {"OLOR", 136}, {"OREC", 136}, {"PLAY", 136}, {"RSAN", 136}, {"TTED", 136},
+    {"WELL", 136}, {"XTTH", 136}, {"AINE", 135}, {"ATEL", 135}, {"BODY", 135}, {"CHAS", 135},
+    {"EART", 135}, {"ERSA", 135}, {"EWHO", 135}, {"HISP", 135}, {"ISPL", 135}, {"JUST", 135},
+    {"NDPR", 135}, {"NNER", 135}, {"NVIM", 135}, {"ONTE", 135}, {"ORDS", 135}, {"ORME", 135},
+    {"PFIL", 135}, {"PLAI", 135}, {"RCEC", 135}, {"RONG", 135}, {"RTED", 135}, {"SEEM", 135},
+    {"SIGN", 135}, {"TODE", 135}, {"TWAS", 135}, {"XPLA", 135}, {"ASED", 134}, {"ASSI", 134},
+    {"ECOV", 134}, {"EMAI", 134}, {"ETHO", 134}, {"GINS", 134}, {"HISF", 134}, {"NDWI", 134},
+    {"NTSE", 134}, {"OWAR", 134}, {"PIES", 134}, {"RDIS", 134}, {"TELL", 134}, {"TELY", 134},
+    {"TMOD", 134}, {"TOIN", 134}, {"AYSW", 133}, {"BYRE", 133}, {"CANU", 133}, {"ECOR", 133},
+    {"EINA", 133}, {"ENTC", 133}, {"ERWA", 133}, {"ETAN", 133}, {"ETUR", 133}, {"HESC", 133},
+    {"IOND", 133}, {"ISAL", 133}, {"LTOT", 133}, {"ROTH", 133}, {"RPAR", 133}, {"RSIN", 133},
+    {"TANY", 133}, {"TDIS", 133}, {"TEDF", 133}, {"THOF", 133}, {"TPAR", 133}, {"AKEA", 132},
+    {"ALLA", 132}, {"ALTE", 132}, {"ANUS", 132}, {"ARAL", 132}, {"ATTR", 132}, {"CORD", 132},
+    {"DEBY", 132}, {"EBUT", 132}, {"GCOM", 132}, {"GING", 132}, {"ISWI", 132}, {"NTCO", 132},
+    {"OUDO", 132}, {"PLAT", 132}, {"SMAD", 132}, {"STLI", 132}, {"SWER", 132}, {"URTH", 132},
+    {"YWOR", 132}, {"ANTY", 131}, {"CHEC", 131}, {"EADT", 131}, {"EASI", 131}, {"ECIA", 131},
+    {"FANI", 131}, {"OWAN", 131}, {"REME", 131}, {"RPOS", 131}, {"ATOR", 130}, {"CEAN", 130},
+    {"CTTH", 130}, {"DEDI", 130}, {"EABO", 130}, {"EIGH", 130}, {"EIVE", 130}, {"ERWH", 130},
+    {"HECK", 130}, {"ICES", 130}, {"ILEN", 130}, {"NGOF", 130}, {"NTSO", 130}, {"OPEN", 130},
+    {"ORYO", 130}, {"WAND", 130}, {"ATHE", 129}, {"DCOM", 129}, {"DDIS", 129}, {"DEFA", 129},
+    {"ECIR", 129}, {"EMOS", 129}, {"EOBJ", 129}, {"ETTE", 129}, {"FTHO", 129}, {"HEFR", 129},
+    {"HOWT", 129}, {"LOAD", 129}, {"NGUA", 129}, {"OONE", 129}, {"REPE", 129}, {"STEM", 129},
+    {"TICL", 129}, {"TTRA", 129}, {"TUAL", 129}, {"ANDN", 128}, {"ANSP", 128}, {"BYCO", 128},
+    {"CCES", 128}, {"EROR", 128}, {"GUAG", 128}, {"HEIM", 128}, {"HORT", 128}, {"IDTH", 128},
+    {"IKET", 128}, {"LEFT", 128}, {"LOSE", 128}, {"METI", 128}, {"MPIL", 128}, {"NDLE", 128},
+    {"NDSE", 128}, {"OMPI", 128}, {"OPYO", 128}, {"SMAL", 128}, {"TERW", 128}, {"UAGE", 128},
+    {"ULTI", 128}, {"UTIN", 128}, {"ANYT", 127}, {"AUTH", 127}, {"EDAT", 127}, {"EIFY", 127},
+    {"EXPR", 127}, {"IESA", 127}, {"INCT", 127}, {"NDAT", 127}, {"NSES", 127}, {"RWHI", 127},
+    {"ADEB", 126}, {"DERA", 126}, {"DUCE", 126}, {"ENTW", 126}, {"ESER", 126}, {"ICHW", 126},
+    {"ICLE", 126}, {"ILEW", 126}, {"LYAN", 126}, {"NPRO", 126}, {"NVEY", 126}, {"OCON", 126},
+    {"OMES", 126}, {"ORKI", 126}, {"OURT", 126}, {"PRIN", 126}, {"RPEN", 126}, {"RUNT", 126},
+    {"URSA", 126}, {"USEF", 126}, {"ANDG", 125}, {"CLAI", 125}, {"EEDT", 125}, {"HEWA", 125},
+    {"INCO", 125}, {"LAIM", 125}, {"NDYO", 125}, {"NFIG", 125}, {"RITI", 125}, {"SCHA", 125},
+    {"YOUS", 125}, {"ALON", 124}, {"ANTS", 124}, {"AVER", 124}, {"EAPP", 124}, {"GHTB", 124},
+    {"INGV", 124}, {"ISAN", 124}, {"LENS", 124}, {"NCEA", 124}, {"NDFO", 124}, {"ONYO", 124},
+    {"PURP", 124}, {"RAMS", 124}, {"RTEX", 124}, {"RWHE", 124}, {"SCOP", 124}, {"SDIS", 124},
+    {"TERC", 124}, {"UTOC", 124}, {"XCEP", 124}, {"GVIM", 123}, {"ISTS", 123}, {"KAND", 123},
+    {"LETI", 123}, {"MEAS", 123}, {"NDMO", 123}, {"RINC", 123}, {"RMSO", 123}, {"SALL", 123},
+    {"TITU", 123}, {"TOWA", 123}, {"TSAN", 123}, {"ASSA", 122}, {"BLIQ", 122}, {"CESO", 122},
+    {"CHIS", 122}, {"DESC", 122}, {"DTHO", 122}, {"ERPR", 122}, {"LYRE", 122}, {"MPOS", 122},
+    {"MWIL", 122}, {"NANY", 122}, {"ODEF", 122}, {"PAGE", 122}, {"SOFR", 122}, {"TYPI", 122},
+    {"UREO", 122}, {"UTED", 122}, {"XPRE", 122}, {"YARE", 122}, {"DENS", 121}, {"EGNU", 121},
+    {"GETA", 121}, {"HTOF", 121}, {"ISCA", 121}, {"LUMI", 121}, {"NESO", 121}, {"ONFO", 121},
+    {"PPEN", 121}, {"RRES", 121}, {"STOA", 121}, {"TOMO", 121}, {"USEO", 121}, {"ANDU", 120},
+    {"EDGE", 120}, {"ERIG", 120}, {"ERME", 120}, {"ESEA", 120}, {"FREF", 120}, {"HEBL", 120},
+    {"HERO", 120}, {"NWIT", 120}, {"ORSO", 120}, {"REED", 120}, {"RMIS", 120}, {"RTIN", 120},
+    {"SEET", 120}, {"SEIN", 120}, {"TERF", 120}, {"UNDT", 120}, {"VETO", 120}, {"ATIV", 119},
+    {"DWHI", 119}, {"ELOW", 119}, {"EPER", 119}, {"EPLU", 119}, {"ETHR", 119}, {"ETRA", 119},
+    {"GINT", 119}, {"HEBR", 119}, {"INDT", 119}, {"INEI", 119}, {"INVA", 119}, {"NCHA", 119},
+    {"NDON", 119}, {"PATE", 119}, {"RYTH", 119}, {"SONE", 119}, {"TRUM", 119}, {"URED", 119},
+    {"ELES", 118}, {"ENGT", 118}, {"GTHA", 118}, {"HISD", 118}, {"ILLN", 118}, {"OUMU", 118},
+    {"REFE", 118}, {"REPL", 118}, {"RETU", 118}, {"RMAN", 118}, {"STOM", 118}, {"TMAT", 118},
+    {"UMUS", 118}, {"UTET", 118}, {"VIMI", 118}, {"YSTE", 118}, {"YWHE", 118}, {"DUND", 117},
+    {"ENDS", 117}, {"ERNA", 117}, {"ESOU", 117}, {"ITED", 117}, {"LEIS", 117}, {"LLEL", 117},
+    {"NESA", 117}, {"ONWI", 117}, {"POSS", 117}, {"ROMO", 117}, {"RWIS", 117}, {"SPON", 117},
+    {"SSTA", 117}, {"VOID", 117}, {"AMEO", 116}, {"AYSO", 116}, {"EFAU", 116}, {"ETIN", 116},
+    {"FULL", 116}, {"HENO", 116}, {"HENU", 116}, {"HEOP", 116}, {"HLIG", 116}, {"ICET", 116},
+    {"ISSE", 116}, {"LENG", 116}, {"LEYO", 116}, {"NEWI", 116}, {"ONCE", 116}, {"ORED", 116},
+    {"OURO", 116}, {"ROUP", 116}, {"SHOR", 116}, {"STRO", 116}, {"SYST", 116}, {"TOPR", 116},
+    {"YWHI", 116}, {"AULT", 115}, {"BEDI", 115}, {"BELO", 115}, {"EDOF", 115}, {"EFER", 115},
+    {"ESBE", 115}, {"ESEE", 115}, {"EXTS", 115}, {"FAUL", 115}, {"JUMP", 115}, {"LANE", 115},
+    {"NDAL", 115}, {"OURA", 115}, {"RETO", 115}, {"SATT", 115}, {"SVER", 115}, {"TRON", 115},
+    {"BEAM", 114}, {"DEAN", 114}, {"DOWN", 114}, {"EFRE", 114}, {"ENTF", 114}, {"EXTC", 114},
+    {"HEGN", 114}, {"LCOM", 114}, {"NCHE", 114}, {"NSPA", 114}, {"NTST", 114}, {"ONAS", 114},
+    {"POUN", 114}, {"PUTT", 114}, {"PYOF", 114}, {"RKIN", 114}, {"ATWH", 113}, {"EBLU", 113},
+    {"EDIR", 113}, {"EPEN", 113}, {"GLOB", 113}, {"HADO", 113}, {"HATM", 113}, {"HATP", 113},
+    {"IMIN", 113}, {"INGD", 113}, {"INVI", 113}, {"LEAR", 113}, {"LECO", 113}, {"LYTO", 113},
+    {"NISH", 113}, {"NTLI", 113}, {"REDO", 113}, {"SOFS", 113}, {"THEK", 113}, {"ALLS", 112},
+    {"ANYC", 112}, {"ANYP", 112}, {"EFUN", 112}, {"ELEA", 112}, {"MANN", 112}, {"MSCR", 112},
+    {"NEDT", 112}, {"RSTA", 112}, {"TISA", 112}, {"TODO", 112}, {"USEI", 112}, {"ACOP", 111},
+    {"ANDH", 111}, {"BASE", 111}, {"EARS", 111}, {"EIRC", 111}, {"FFEC", 111}, {"HTHI", 111},
+    {"INEW", 111}, {"ITHS", 111}, {"KTHE", 111}, {"NGON", 111}, {"NORE", 111}, {"OUSL", 111},
+    {"SIMP", 111}, {"SORI", 111}, {"WAYT", 111}, {"YPIN", 111}, {"ANST", 110}, {"EBRE", 110},
+    {"EMAD", 110}, {"EMEA", 110}, {"ESID", 110}, {"HEHE", 110}, {"HESH", 110}, {"ISFI", 110},
+    {"IVEL", 110}, {"LERA", 110}, {"LUDI", 110}, {"MPOU", 110}, {"NCON", 110}, {"NDMA", 110},
+    {"OFWH", 110}, {"OLDE", 110}, {"OMEO", 110}, {"RARE", 110}, {"REIT", 110}, {"ROPE", 110},
+    {"SMAN", 110}, {"SONT", 110}, {"SUNS", 110}, {"TEDW", 110}, {"UDIN", 110}, {"VISU", 110},
+    {"YWIT", 110}, {"AINI", 109}, {"ECHO", 109}, {"EMAP", 109}, {"EMER", 109}, {"EOFI", 109},
+    {"EYAR", 109}, {"FINC", 109}, {"IGHL", 109}, {"IMSC", 109}, {"INCE", 109}, {"ISUA", 109},
+    {"ITET", 109}, {"OAND", 109}, {"OWTO", 109}, {"QUIC", 109}, {"REDB", 109}, {"RREC", 109},
+    {"SHAD", 109}, {"STEA", 109}, {"TALS", 109}, {"YCOM", 109}, {"ECEI", 108}, {"EITS", 108},
+    {"EREM", 108}, {"ETOP", 108}, {"GHLI", 108}, {"HTHA", 108}, {"HTTO", 108}, {"LEWI", 108},
+    {"NDOT", 108}, {"OROT", 108}, {"OSEA", 108}, {"PLES", 108}, {"SEFU", 108}, {"SSET", 108},
+    {"SUCC", 108}, {"TAPP", 108}, {"TARE", 108}, {"TERE", 108}, {"TITS", 108}, {"UCCE", 108},
+    {"UNIX", 108}, {"YONE", 108}, {"ACCE", 107}, {"ATEA", 107}, {"EDSO", 107}, {"ESEV", 107},
+    {"ESMA", 107}, {"HETW", 107}, {"LEWH", 107}, {"LOWE", 107}, {"MTHA", 107}, {"PLIE", 107},
+    {"REYO", 107}, {"SESA", 107}, {"SSIB", 107}, {"UENC", 107}, {"UICK", 107}, {"UNDO", 107},
+    {"USUA", 107}, {"ANYS", 106}, {"ASPE", 106}, {"DLIG", 106}, {"EDWH", 106}, {"EIMA", 106},
+    {"EOPT", 106}, {"ESNT", 106}, {"ETTI", 106}, {"FCOL", 106}, {"FORS", 106}, {"GIST", 106},
+    {"NGLI", 106}, {"OSEO", 106}, {"OSSI", 106}, {"OTBE", 106}, {"RECI", 106}, {"REDE", 106},
+    {"TERV", 106}, {"TOIT", 106}, {"YPRO", 106}, {"BETH", 105}, {"BLER", 105}, {"CTRU", 105},
+    {"EBOD", 105}, {"EEYE", 105}, {"EISN", 105}, {"EIST", 105}, {"ETIT", 105}, {"GESO", 105},
+    {"HECI", 105}, {"ITAT", 105}, {"ITEA", 105}, {"IVEN", 105}, {"NDVI", 105}, {"ORAT", 105},
+    {"RIOU", 105}, {"RREF", 105}, {"SELF", 105}, {"URET", 105}, {"XIST", 105}, {"YINT", 105},
+    {"BLAC", 104}, {"DBYA", 104}, {"EDBE", 104}, {"GATE", 104}, {"HEAT", 104}, {"HILE", 104},
+    {"ITUT", 104}, {"LACK", 104}, {"LOWS", 104}, {"NSTE", 104}, {"RUSR", 104}, {"RWOR", 104},
+    {"TCHI", 104}, {"YSTA", 104}, {"ALWA", 103}, {"AREE", 103}, {"ARIO", 103}, {"ASBE", 103},
+    {"AVAI", 103}, {"CCOR", 103}, {"CLOS", 103}, {"EREO", 103}, {"GRAN", 103}, {"GTOT", 103},
+    {"HEFU", 103}, {"HTAN", 103}, {"HTHO", 103}, {"ISDE", 103}, {"ISPR", 103}, {"NFIN", 103},
+    {"NTIL", 103}, {"OTTH", 103}, {"SEDF", 103}, {"SITE", 103}, {"UALT", 103}, {"URES", 103},
+    {"USTA", 103}, {"VAIL", 103}, {"ACKT", 102}, {"AREC", 102}, {"AYST", 102}, {"CLEA", 102},
+    {"DEVE", 102}, {"DPRO", 102}, {"ENDT", 102}, {"ETAL", 102}, {"HEUN", 102}, {"HEYW", 102},
+    {"LLUS", 102}, {"MERG", 102}, {"ORTS", 102}, {"PAND", 102}, {"RESO", 102}, {"SEDA", 102},
+    {"SSED", 102}, {"STON", 102}, {"UDON", 102}, {"VISI", 102}, {"ACKA", 101}, {"ADOW", 101},
+    {"BINE", 101}, {"BLEF", 101}, {"BOOK", 101}, {"DICU", 101}, {"EADI", 101}, {"ERFI", 101},
+    {"ERPA", 101}, {"ESTI", 101}, {"GEOF", 101}, {"HEVA", 101}, {"IONN", 101}, {"ITTO", 101},
+    {"LOWA", 101}, {"NNOT", 101}, {"NOTS", 101}, {"ONIT", 101}, {"OUCO", 101}, {"RFIL", 101},
+    {"ROMI", 101}, {"RUSE", 101}, {"TOON", 101}, {"TPRO", 101}, {"UGHA", 101}, {"WHOS", 101},
+    {"ACON", 100}, {"ARAN", 100}, {"DEIN", 100}, {"EXTI", 100}, {"FART", 100}, {"FFIC", 100},
+    {"HANI", 100}, {"LWAY", 100}, {"ORAL", 100}, {"OTAL", 100}, {"SAPP", 100}, {"SHED", 100},
+    {"SINS", 100}, {"UTOM", 100}, {"AILA", 99}, {"ASSO", 99}, {"BLEO", 99}, {"CANT", 99},
+    {"CATE", 99}, {"DABO", 99}, {"ECAN", 99}, {"EDUN", 99}, {"ERIT", 99}, {"ESUP", 99},
+    {"EWAS", 99}, {"EXIS", 99}, {"FERS", 99}, {"IRCU", 99}, {"ISAS", 99}, {"ITST", 99},
+    {"NGST", 99}, {"NSIB", 99}, {"RCHA", 99}, {"SREF", 99}, {"TMAY", 99}, {"BSTA", 98},
+    {"DESI", 98}, {"DITT", 98}, {"EADO", 98}, {"EASU", 98}, {"EENA", 98}, {"ESUB", 98},
+    {"HOLD", 98}, {"ILAB", 98}, {"IONP", 98}, {"ITSO", 98}, {"IVED", 98}, {"NOWT", 98},
+    {"NTHO", 98}, {"NVER", 98}, {"PILE", 98}, {"QUIT", 98}, {"RGEN", 98}, {"SOFC", 98},
+    {"TEAD", 98}, {"THAV", 98}, {"TSCO", 98}, {"TSEE", 98}, {"TSTA", 98}, {"UDED", 98},
+    {"USLY", 98}, {"YDIS", 98}, {"ASST", 97}, {"EBET", 97}, {"ECTA", 97}, {"ENIT", 97},
+    {"ESAS", 97}, {"ESFR", 97}, {"ESOM", 97}, {"GFOR", 97}, {"HERF", 97}, {"ISMS", 97},
+    {"LABL", 97}, {"LDER", 97}, {"NABL", 97}, {"NALS", 97}, {"NDSI", 97}, {"OREM", 97},
+    {"PLIT", 97}, {"SHEL", 97}, {"TEDO", 97}, {"THAS", 97}, {"UALM", 97}, {"VELY", 97},
+    {"ARIS", 96}, {"BERS", 96}, {"DFIL", 96}, {"DUSE", 96}, {"EADY", 96}, {"EASY", 96},
+    {"ECTL", 96}, {"EDOR", 96}, {"EGIS", 96}, {"EORD", 96}, {"GHTE", 96}, {"HAPP", 96},
+    {"HEAN", 96}, {"HEEY", 96}, {"HISB", 96}, {"HPAR", 96}, {"HTIN", 96}, {"HTWH", 96},
+    {"IBIL", 96}, {"MAYC", 96}, {"NSOR", 96}, {"ORTE", 96}, {"RATO", 96}, {"RWAR", 96},
+    {"UTAB", 96}, {"UTAN", 96}, {"XTEN", 96}, {"ADER", 95}, {"ARTE", 95}, {"CANS", 95},
+    {"DRED", 95}, {"DTHR", 95}, {"EIND", 95}, {"ELLI", 95}, {"EREP", 95}, {"ESUC", 95},
+    {"EVEL", 95}, {"HATE", 95}, {"ILEF", 95}, {"INAR", 95}, {"INEN", 95}, {"IRCO", 95},
+    {"LITI", 95}, {"NDBE", 95}, {"ONSW", 95}, {"PTHE", 95}, {"RMED", 95}, {"RONT", 95},
+    {"SDEF", 95}, {"SIVE", 95}, {"TLIG", 95}, {"TMAK", 95}, {"TRIC", 95}, {"TSEL", 95},
+    {"WYOU", 95}, {"YUSE", 95}, {"ACHA", 94}, {"ANEW", 94}, {"ATET", 94}, {"BEGI", 94},
+    {"CEST", 94}, {"CKTO", 94}, {"DIAT", 94}, {"EGIN", 94}, {"ENTB", 94}, {"ERCA", 94},
+    {"ESAL", 94}, {"HEHO", 94}, {"IMPO", 94}, {"INFI", 94}, {"IRED", 94}, {"MING", 94},
+    {"NDDE", 94}, {"NGFO", 94}, {"NVAR", 94}, {"ONGE", 94}, {"OREF", 94}, {"OSES", 94},
+    {"RTAI", 94}, {"SPLI", 94}, {"SSAN", 94}, {"STRU", 94}, {"TOCH", 94}, {"TORI", 94},
+    {"UTWH", 94}, {"YOUU", 94}, {"AMEA", 93}, {"AMEP", 93}, {"ASSU", 93}, {"CANA", 93},
+    {"CHPA", 93}, {"EFFE", 93}, {"ESIS", 93}, {"GEST", 93}, {"IEDV", 93}, {"IONL", 93},
+    {"MECO", 93}, {"MOUS", 93}, {"NCRE", 93}, {"NITS", 93}, {"NSEQ", 93}, {"OTIN", 93},
+    {"REVE", 93}, {"RNIN", 93}, {"SMAY", 93}, {"SUFF", 93}, {"TLEA", 93}, {"YSOF", 93},
+    {"AREM", 92}, {"ATAN", 92}, {"CERT", 92}, {"EITI", 92}, {"ESHO", 92}, {"EYWO", 92},
+    {"HISO", 92}, {"IONY", 92}, {"IQUE", 92}, {"LORS", 92}, {"NDSA", 92}, {"NECO", 92},
+    {"OFSU", 92}, {"OMAN", 92}, {"OUNE", 92}, {"REEK", 92}, {"ROPA", 92}, {"RYST", 92},
+    {"SACO", 92}, {"STCO", 92}, {"TRAT", 92}, {"UTES", 92}, {"BLEI", 91}, {"CEBE", 91},
+    {"DATE", 91}, {"DOFA", 91}, {"EAMO", 91}, {"ENAN", 91}, {"HATH", 91}, {"INSI", 91},
+    {"ITEN", 91}, {"LLCO", 91}, {"NSTR", 91}, {"PACK", 91}, {"PPLY", 91}, {"PROB", 91},
+    {"RDST", 91}, {"RFRO", 91}, {"SLAT", 91}, {"SSER", 91}, {"TAGS", 91}, {"TANT", 91},
+    {"TCOL", 91}, {"TEDL", 91}, {"UNEE", 91}, {"ABBR", 90}, {"ANNO", 90}, {"ATOF", 90},
+    {"BBRE", 90}, {"BREV", 90}, {"DEOF", 90}, {"ELIS", 90}, {"ENES", 90}, {"EREW", 90},
+    {"ERVI", 90}, {"EVAL", 90}, {"HASA", 90}, {"KEYS", 90}, {"LESI", 90}, {"MONE", 90},
+    {"NTOR", 90}, {"OFAC", 90}, {"OFRA", 90}, {"SAVE", 90}, {"SESO", 90}, {"SMIT", 90},
+    {"SMOR", 90}, {"TERR", 90}, {"ACET", 89}, {"APRO", 89}, {"ASUR", 89}, {"CESA", 89},
+    {"DCHA", 89}, {"DISA", 89}, {"EHEL", 89}, {"ENIN", 89}, {"FIGU", 89}, {"GENT", 89},
+    {"ISDI", 89}, {"ISEX", 89}, {"ITSP", 89}, {"LARG", 89}, {"MERC", 89}, {"MOVI", 89},
+    {"MSAN", 89}, {"NDSU", 89}, {"NOTC", 89}, {"NSLA", 89}, {"NTIO", 89}, {"OCHA", 89},
+    {"ONEC", 89}, {"OPRI", 89}, {"OSTR", 89}, {"OVES", 89}, {"PATH", 89}, {"POND", 89},
+    {"RMOR", 89}, {"SEXP", 89}, {"SORA", 89}, {"TEIT", 89}, {"TENE", 89}, {"TUTE", 89},
+    {"USTH", 89}, {"WHET", 89}, {"ANSL", 88}, {"AREO", 88}, {"ATAL", 88}, {"CRIB", 88},
+    {"DINS", 88}, {"DSOF", 88}, {"ELAT", 88}, {"EOFC", 88}, {"ERLI", 88}, {"FICI", 88},
+    {"HFOR", 88}, {"ISSO", 88}, {"LREA", 88}, {"LUST", 88}, {"NATU", 88}, {"NGRE", 88},
+    {"NINS", 88}, {"NLYT", 88}, {"NSEE", 88}, {"NSIT", 88}, {"NSTO", 88}, {"OTTO", 88},
+    {"RISE", 88}, {"SEFO", 88}, {"SERI", 88}, {"SESS", 88}, {"SHIN", 88}, {"YNOT", 88},
+    {"ACEA", 87}, {"ADDA", 87}, {"ANAL", 87}, {"APAR", 87}, {"ARTW", 87}, {"BLEA", 87},
+    {"EEXT", 87}, {"FWHI", 87}, {"HEBE", 87}, {"HEMT", 87}, {"ICHC", 87}, {"IGUR", 87},
+    {"ILLS", 87}, {"LARL", 87}, {"LESE", 87}, {"LUEA", 87}, {"NARY", 87}, {"NDPA", 87},
+    {"NTWO", 87}, {"ODET", 87}, {"OFOR", 87}, {"ONEI", 87}, {"ORWH", 87}, {"OWOR", 87},
+    {"PETH", 87}, {"RTIE", 87}, {"SALT", 87}, {"SPER", 87}, {"SPOS", 87}, {"STOO", 87},
+    {"TIFY", 87}, {"TOWH", 87}, {"ACKS", 86}, {"ADIN", 86}, {"ARYT", 86}, {"AVOI", 86},
+    {"BLOC", 86}, {"CTCO", 86}, {"DVIM", 86}, {"EARL", 86}, {"EINF", 86}, {"EITE", 86},
+    {"EMBE", 86}, {"ERSU", 86}, {"ESUR", 86}, {"EVAR", 86}, {"GRAP", 86}, {"HEED", 86},
+    {"INEB", 86}, {"LOCK", 86}, {"MATE", 86}, {"NESI", 86}, {"NGAS", 86}, {"NSEN", 86},
+    {"NTAT", 86}, {"OFEA", 86}, {"ONCA", 86}, {"ONMA", 86}, {"OVIN", 86}, {"OWYO", 86},
+    {"PEAT", 86}, {"QUAR", 86}, {"RAMM", 86}, {"RAPH", 86}, {"REAK", 86}, {"REND", 86},
+    {"RYTO", 86}, {"SOFL", 86}, {"TEVE", 86}, {"TTEX", 86}, {"TTOM", 86}, {"VIMF", 86},
+    {"ACTU", 85}, {"ATEO", 85}, {"AYTH", 85}, {"DEPE", 85}, {"DUCT", 85}, {"EDEN", 85},
+    {"EMAY", 85}, {"ENOR", 85}, {"ENTM", 85}, {"ERBE", 85}, {"GFRO", 85}, {"GHTC", 85},
+    {"GNUG", 85}, {"HEBA", 85}, {"HTBE", 85}, {"IESI", 85}, {"IFIT", 85}, {"LEGA", 85},
+    {"LINK", 85}, {"MOFT", 85}, {"MYOU", 85}, {"NGER", 85}, {"OMON", 85}, {"ORKA", 85},
+    {"OSEE", 85}, {"OSTA", 85}, {"SPRE", 85}, {"STCH", 85}, {"SWEL", 85}, {"TCOP", 85},
+    {"TICU", 85}, {"TISN", 85}, {"VEST", 85}, {"XTCH", 85}, {"YPET", 85}, {"YSWH", 85},
+    {"BUTW", 84}, {"CFIL", 84}, {"DAFT", 84}, {"EALI", 84}, {"EANG", 84}, {"ECES", 84},
+    {"ECTC", 84}, {"ENSA", 84}, {"EWAY", 84}, {"EXTA", 84}, {"GHTL", 84}, {"GOOD", 84},
+    {"HERB", 84}, {"HOUG", 84}, {"ICTI", 84}, {"LDIN", 84}, {"NCEB", 84}, {"NDEX", 84},
+    {"NGFR", 84}, {"NWHE", 84}, {"OFFE", 84}, {"OFSE", 84}, {"OGEN", 84}, {"OMMO", 84},
+    {"ONSF", 84}, {"OYOU", 84}, {"PROC", 84}, {"RAMI", 84}, {"RINS", 84}, {"RITT", 84},
+    {"ROFA", 84}, {"SALS", 84}, {"SBET", 84}, {"SBYT", 84}, {"SLIG", 84}, {"TDOE", 84},
+    {"TECT", 84}, {"THOL", 84}, {"TSEC", 84}, {"TSTO", 84}, {"TTEN", 84}, {"UALI", 84},
+    {"VIMV", 84}, {"ALTH", 83}, {"ARTA", 83}, {"BOAR", 83}, {"CUTA", 83}, {"DBYC", 83},
+    {"DDIT", 83}, {"EADD", 83}, {"EARA", 83}, {"EEME", 83}, {"EEXE", 83}, {"EPEA", 83},
+    {"ERAS", 83}, {"ERFE", 83}, {"ERIV", 83}, {"ETAI", 83}, {"INAC", 83}, {"INUE", 83},
+    {"KEEP", 83}, {"LESC", 83}, {"LLYT", 83}, {"MPLI", 83}, {"NBEU", 83}, {"NEVE", 83},
+    {"NGVI", 83}, {"OARD", 83}, {"ORSE", 83}, {"OVED", 83}, {"PAGA", 83}, {"RIAN", 83},
+    {"SIFY", 83}, {"SWAP", 83}, {"TESP", 83}, {"TOFO", 83}, {"XTUR", 83}, {"AGAT", 82},
+    {"AMEC", 82}, {"ANIS", 82}, {"ARIN", 82}, {"BLEM", 82}, {"CANN", 82}, {"DATI", 82},
+    {"DATT", 82}, {"DONL", 82}, {"DSFO", 82}, {"EEXA", 82}, {"ESTE", 82}, {"FSUC", 82},
+    {"GESA", 82}, {"GURE", 82}, {"ILER", 82}, {"ISON", 82}, {"MIXT", 82}, {"NGMO", 82},
+    {"NGOR", 82}, {"NTIS", 82}, {"ODEI", 82}, {"ONBE", 82}, {"PLEA", 82}, {"PROM", 82},
+    {"REDC", 82}, {"RSID", 82}, {"RSTP", 82}, {"STHR", 82}, {"TTOB", 82}, {"WASA", 82},
+    {"AGEO", 81}, {"ANYW", 81}, {"ASMA", 81}, {"CLIN", 81}, {"CRYS", 81}, {"DATA", 81},
+    {"DMOR", 81}, {"DSIN", 81}, {"DSOM", 81}, {"ECIP", 81}, {"EDES", 81}, {"EMTH", 81},
+    {"EWRI", 81}, {"FRAY", 81}, {"GTHI", 81}, {"ICKS", 81}, {"IMRC", 81}, {"ITOR", 81},
+    {"LESW", 81}, {"LETA", 81}, {"LVER", 81}, {"MMON", 81}, {"OMOV", 81}, {"ONDA", 81},
+    {"OPAG", 81}, {"PHER", 81}, {"RTMO", 81}, {"SCRE", 81}, {"TBUT", 81}, {"TCOD", 81},
+    {"TESO", 81}, {"TITY", 81}, {"TONT", 81}, {"VIMD", 81}, {"WEVE", 81}, {"ABIL", 80},
+    {"APFI", 80}, {"DIFT", 80}, {"DLET", 80}, {"EAUT", 80}, {"ENEA", 80}, {"ERBY", 80},
+    {"ERCI", 80}, {"ERTM", 80}, {"ETOA", 80}, {"EXTF", 80}, {"FCON", 80}, {"FTEN", 80},
+    {"GEAN", 80}, {"HYOU", 80}, {"INEC", 80}, {"IXTU", 80}, {"MSTH", 80}, {"NGWH", 80},
+    {"NTSA", 80}, {"NTSU", 80}, {"OADE", 80}, {"OMIN", 80}, {"ONEW", 80}, {"ONON", 80},
+    {"OPOS", 80}, {"ORFO", 80}, {"ORIF", 80}, {"OSEC", 80}, {"OWEV", 80}, {"OWSE", 80},
+    {"PTTH", 80}, {"RCOP", 80}, {"RGET", 80}, {"SSOM", 80}, {"TERB", 80}, {"TICK", 80},
+    {"TSOR", 80}, {"ULDN", 80}, {"URPO", 80}, {"UTIT", 80}, {"ARYA", 79}, {"ARYI", 79},
+    {"AVES", 79}, {"CETO", 79}, {"CTUA", 79}, {"DCOL", 79}, {"DEFO", 79}, {"EBAC", 79},
+    {"EMAR", 79}, {"EONT", 79}, {"ERCE", 79}, {"HORS", 79}, {"IBIT", 79}, {"ICHM", 79},
+    {"INAS", 79}, {"ITHM", 79}, {"NDFI", 79}, {"NGSU", 79}, {"NSEF", 79}, {"OFFI", 79},
+    {"OLDS", 79}, {"ORVI", 79}, {"OURD", 79}, {"OUTI", 79}, {"OUTS", 79}, {"REGA", 79},
+    {"RIBE", 79}, {"SENO", 79}, {"SISA", 79}, {"SSOR", 79}, {"STOC", 79}, {"TCAN", 79},
+    {"THEX", 79}, {"TIAL", 79}, {"TOAP", 79}, {"TREA", 79}, {"TWOU", 79}, {"VEAN", 79},
+    {"YAPP", 79}, {"ADDE", 78}, {"AMEN", 78}, {"AROU", 78}, {"DITA", 78}, {"DSTO", 78},
+    {"EEQU", 78}, {"EIFT", 78}, {"EMIN", 78}, {"EPOI", 78}, {"HESW", 78}, {"HIBI", 78},
+    {"ICIE", 78}, {"ISFO", 78}, {"ITCH", 78}, {"MPUT", 78}, {"NCOD", 78}, {"NDNO", 78},
+    {"NGEA", 78}, {"NSFO", 78}, {"NTRO", 78}, {"ODEA", 78}, {"OFAR", 78}, {"OING", 78},
+    {"OLUM", 78}, {"ORPO", 78}, {"OTRE", 78}, {"ROWS", 78}, {"SATI", 78}, {"SEWH", 78},
+    {"SMAT", 78}, {"STOS", 78}, {"TABS", 78}, {"TBEC", 78}, {"TOST", 78}, {"VIMC", 78},
+    {"XTFO", 78}, {"ALAN", 77}, {"ANYL", 77}, {"AYCO", 77}, {"DARE", 77}, {"DMAK", 77},
+    {"DOWT", 77}, {"DTOA", 77}, {"EEDO", 77}, {"GLES", 77}, {"HEPU", 77}, {"HOWE", 77},
+    {"IANT", 77}, {"IDEA", 77}, {"ILLT", 77}, {"INCR", 77}, {"INTA", 77}, {"ISME", 77},
+    {"KEYW", 77}, {"NDAS", 77}, {"NEDW", 77}, {"NEIT", 77}, {"NGLY", 77}, {"NGSA", 77},
+    {"NNIN", 77}, {"ODEL", 77}, {"ORER", 77}, {"OSTO", 77}, {"OUST", 77}, {"OUTW", 77},
+    {"OUTY", 77}, {"OVEA", 77}, {"SBEI", 77}, {"SSUC", 77}, {"STED", 77}, {"SWAS", 77},
+    {"TOEX", 77}, {"TYAN", 77}, {"UALS", 77}, {"URSW", 77}, {"USTR", 77}, {"ANTE", 76},
+    {"DOUT", 76}, {"DWIL", 76}, {"EKEY", 76}, {"FERI", 76}, {"HANO", 76}, {"HATL", 76},
+    {"HEAC", 76}, {"HISE", 76}, {"INIS", 76}, {"ISCL", 76}, {"ITCO", 76}, {"LEVE", 76},
+    {"MINE", 76}, {"NEAL", 76}, {"NGEN", 76}, {"OUUS", 76}, {"ROWN", 76}, {"RSAR", 76},
+    {"SORO", 76}, {"URSE", 76}, {"ATUS", 75}, {"DTOG", 75}, {"DTOS", 75}, {"ECUL", 75},
+    {"EDNO", 75}, {"EMPT", 75}, {"FORD", 75}, {"HTTH", 75}, {"ILAT", 75}, {"INOR", 75},
+    {"INWH", 75}, {"ITYA", 75}, {"IVER", 75}, {"LELI", 75}, {"LLIT", 75}, {"LOWT", 75},
+    {"NALT", 75}, {"NELI", 75}, {"NIFE", 75}, {"ONDO", 75}, {"RIAL", 75}, {"RTER", 75},
+    {"RTTH", 75}, {"SCLA", 75}, {"SOFI", 75}, {"TEME", 75}, {"TISS", 75}, {"UMPT", 75},
+    {"UNDI", 75}, {"UREA", 75}, {"AYIN", 74}, {"CIES", 74}, {"DALL", 74}, {"DITS", 74},
+    {"EACO", 74}, {"EATA", 74}, {"ELIK", 74}, {"ELSE", 74}, {"EPTI", 74}, {"ERDI", 74},
+    {"ESCA", 74}, {"ESYN", 74}, {"ETAB", 74}, {"ETOF", 74}, {"ETOS", 74}, {"HANA", 74},
+    {"HATD", 74}, {"HETO", 74}, {"IMTH", 74}, {"INGN", 74}, {"ITHC", 74}, {"NBUT", 74},
+    {"OBAL", 74}, {"ODEC", 74}, {"OFWA", 74}, {"OLIS", 74}, {"ONAB", 74}, {"ONAR", 74},
+    {"ORCE", 74}, {"OREP", 74}, {"REUS", 74}, {"RVAL", 74}, {"SLIK", 74}, {"SLIN", 74},
+    {"TINS", 74}, {"TISI", 74}, {"TSUS", 74}, {"UEAN", 74}, {"UUSE", 74}, {"ACEO", 73},
+    {"ADOF", 73}, {"ALFO", 73}, {"AMEI", 73}, {"BINA", 73}, {"CHFO", 73}, {"DBUT", 73},
+    {"EARG", 73}, {"EOFS", 73}, {"HATF", 73}, {"HEAI", 73}, {"IRDP", 73}, {"ISAB", 73},
+    {"ISPO", 73}, {"ITOF", 73}, {"LDNO", 73}, {"LEME", 73}, {"MINT", 73}, {"NTIF", 73},
+    {"OGRE", 73}, {"OUTP", 73}, {"RKTH", 73}, {"RMIT", 73}, {"ROLL", 73}, {"RTWI", 73},
+    {"RYAN", 73}, {"SERE", 73}, {"SHER", 73}, {"TIFT", 73}, {"TINA", 73}, {"TLIK", 73},
+    {"TMOS", 73}, {"VELO", 73}, {"WAPF", 73}, {"YINC", 73}, {"ANTA", 72}, {"ASWE", 72},
+    {"AWAY", 72}, {"CANC", 72}, {"DETE", 72}, {"DREF", 72}, {"EEXC", 72}, {"ENOW", 72},
+    {"ESEL", 72}, {"EWAT", 72}, {"EYEL", 72}, {"HETI", 72}, {"HETR", 72}, {"IGNE", 72},
+    {"INTS", 72}, {"LFOR", 72}, {"LLAP", 72}, {"NDOU", 72}, {"NYTH", 72}, {"OCOP", 72},
+    {"ODIN", 72}, {"OPRO", 72}, {"OSER", 72}, {"PECU", 72}, {"RESI", 72}, {"RMOF", 72},
+    {"RMSA", 72}, {"RTAN", 72}, {"SANE", 72}, {"SBEE", 72}, {"SEEN", 72}, {"SIFT", 72},
+    {"SNOW", 72}, {"SONA", 72}, {"STPR", 72}, {"TAXF", 72}, {"TOAV", 72}, {"TOPT", 72},
+    {"TORA", 72}, {"TSOM", 72}, {"UNLE", 72}, {"UTYP", 72}, {"AREG", 71}, {"ASTE", 71},
+    {"BROA", 71}, {"CAME", 71}, {"CIFY", 71}, {"DEND", 71}, {"EDAR", 71}, {"EGET", 71},
+    {"ENTP", 71}, {"EONL", 71}, {"EPOS", 71}, {"ESAT", 71}, {"ETOO", 71}, {"EVIS", 71},
+    {"HEBU", 71}, {"IDEO", 71}, {"INSO", 71}, {"IRIT", 71}, {"ITMA", 71}, {"KIND", 71},
+    {"LEPA", 71}, {"LETS", 71}, {"LOBA", 71}, {"LTHI", 71}, {"LYWH", 71}, {"NCLI", 71},
+    {"NDSF", 71}, {"NDUS", 71}, {"NEDB", 71}, {"NNUM", 71}, {"NSED", 71}, {"NSIS", 71},
+    {"NYCO", 71}, {"OAPP", 71}, {"OBEA", 71}, {"OFVI", 71}, {"OLDI", 71}, {"OMPU", 71},
+    {"ONEN", 71}, {"ORUN", 71}, {"REAC", 71}, {"RELA", 71}, {"ROAD", 71}, {"RYIN", 71},
+    {"SALI", 71}, {"SEFR", 71}, {"SEOR", 71}, {"SPHE", 71}, {"SPIR", 71}, {"SWIN", 71},
+    {"TONL", 71}, {"TORS", 71}, {"TOTA", 71}, {"TSRE", 71}, {"ULUM", 71}, {"VIMU", 71},
+    {"XFIL", 71}, {"YCHA", 71}, {"ANSA", 70}, {"APRI", 70}, {"ARIE", 70}, {"AYTO", 70},
+    {"BERI", 70}, {"CEED", 70}, {"CEIN", 70}, {"CIPI", 70}, {"COPE", 70}, {"DLEO", 70},
+    {"EADA", 70}, {"EAIR", 70}, {"EATI", 70}, {"ENEW", 70}, {"ENTD", 70}, {"EORA", 70},
+    {"EREG", 70}, {"ERHA", 70}, {"ERIA", 70}, {"ERIF", 70}, {"ERUN", 70}, {"ESWA", 70},
+    {"EVIA", 70}, {"EXTW", 70}, {"FEET", 70}, {"FIFT", 70}, {"GULA", 70}, {"GYOU", 70},
+    {"HEAR", 70}, {"HELL", 70}, {"HONE", 70}, {"INSA", 70}, {"ISMO", 70}, {"ITSA", 70},
+    {"LLUM", 70}, {"META", 70}, {"MITA", 70}, {"NETO", 70}, {"OFGL", 70}, {"OTCO", 70},
+    {"PERC", 70}, {"POLI", 70}, {"PPER", 70}, {"RELI", 70}, {"RIVA", 70}, {"RMOD", 70},
+    {"SONL", 70}, {"URSI", 70}, {"AFEW", 69}, {"AINC", 69}, {"AREL", 69}, {"ASTT", 69},
+    {"BYWH", 69}, {"CULU", 69}, {"DDED", 69}, {"DEST", 69}, {"DSAN", 69}, {"ECEN", 69},
+    {"ELLS", 69}, {"ENST", 69}, {"EOPE", 69}, {"FGLA", 69}, {"FORY", 69}, {"GATI", 69},
+    {"HASB", 69}, {"HCOM", 69}, {"HEAD", 69}, {"ILEY", 69}, {"IPTI", 69}, {"ISET", 69},
+    {"ITWO", 69}, {"LPRO", 69}, {"LSOT", 69}, {"MEST", 69}, {"METO", 69}, {"MPOR", 69},
+    {"NALI", 69}, {"NAST", 69}, {"NOTR", 69}, {"OOKI", 69}, {"OURF", 69}, {"PIRI", 69},
+    {"RAGR", 69}, {"RCUM", 69}, {"REDS", 69}, {"SEME", 69}, {"SERA", 69}, {"SESI", 69},
+    {"SMIS", 69}, {"TEDR", 69}, {"THPA", 69}, {"URIN", 69}, {"VEDT", 69}, {"VIAT", 69},
+    {"AGEI", 68}, {"ALLC", 68}, {"AMED", 68}, {"AMEM", 68}, {"ANRE", 68}, {"ATEC", 68},
+    {"AYNO", 68}, {"BUTA", 68}, {"DOWA", 68}, {"EMAK", 68}, {"ESIG", 68}, {"ETOM", 68},
+    {"FAIN", 68}, {"HEDA", 68}, {"ILEC", 68}, {"IMER", 68}, {"ITSC", 68}, {"IVAT", 68},
+    {"KFOR", 68}, {"LEIF", 68}, {"LLRE", 68}, {"LLYA", 68}, {"NOFA", 68}, {"NPUT", 68},
+    {"NSWI", 68}, {"NTFO", 68}, {"OEDI", 68}, {"OMIT", 68}, {"ONPR", 68}, {"ORAS", 68},
+    {"POWE", 68}, {"RIOR", 68}, {"RTHR", 68}, {"SAST", 68}, {"SBEF", 68}, {"SCRO", 68},
+    {"SEAC", 68}, {"SESE", 68}, {"TITI", 68}, {"XCLU", 68}, {"AREU", 67}, {"ARKS", 67},
+    {"ATLE", 67}, {"AWIN", 67}, {"CKAG", 67}, {"ESON", 67}, {"GSOU", 67}, {"IESW", 67},
+    {"INYO", 67}, {"ITYT", 67}, {"LEAD", 67}, {"LENT", 67}, {"MAYA", 67}, {"MSWI", 67},
+    {"MUSE", 67}, {"NCEF", 67}, {"NDFR", 67}, {"NETW", 67}, {"NIVE", 67}, {"NLES", 67},
+    {"NSAR", 67}, {"OFAS", 67}, {"ONIF", 67}, {"OPYI", 67}, {"ORKT", 67}, {"ORSA", 67},
+    {"OWST", 67}, {"RSWH", 67}, {"SDON", 67}, {"SEDB", 67}, {"SERS", 67}, {"SOON", 67},
+    {"SSTO", 67}, {"SUSR", 67}, {"TIFI", 67}, {"TLIC", 67}, {"TOAD", 67}, {"TPER", 67},
+    {"TPUT", 67}, {"TTOA", 67}, {"TTOS", 67}, {"VERI", 67}, {"WAST", 67}, {"XTIN", 67},
+    {"ANTO", 66}, {"ANYM", 66}, {"ASEA", 66}, {"ASEC", 66}, {"CREE", 66}, {"CROS", 66},
+    {"DERE", 66}, {"DRAW", 66}, {"DTEX", 66}, {"EDFI", 66}, {"EGIO", 66}, {"EHOL", 66},
+    {"EKNI", 66}, {"ELYT", 66}, {"ERAC", 66}, {"GION", 66}, {"GTHO", 66}, {"HEOU", 66},
+    {"HERR", 66}, {"IPTS", 66}, {"IRIN", 66}, {"LUMN", 66}, {"OINC", 66}, {"OLEN", 66},
+    {"ONGL", 66}, {"OWWH", 66}, {"PERS", 66}, {"RLIN", 66}, {"RNAT", 66}, {"RRIG", 66},
+    {"SANY", 66}, {"SBEC", 66}, {"SEND", 66}, {"SFOL", 66}, {"SHAR", 66}, {"SSEE", 66},
+    {"TAIL", 66}, {"TBEI", 66}, {"THIT", 66}, {"TOED", 66}, {"USEC", 66}, {"UTEA", 66},
+    {"YFRO", 66}, {"ALLM", 65}, {"ALOR", 65}, {"ASES", 65}, {"ASTA", 65}, {"ASTC", 65},
+    {"BROW", 65}, {"BSTI", 65}, {"CEDI", 65}, {"CEIS", 65}, {"CKTH", 65}, {"CODI", 65},
+    {"COLU", 65}, {"CROL", 65}, {"DALS", 65}, {"DINC", 65}, {"DIVI", 65}, {"EACT", 65},
+    {"EALS", 65}, {"EANE", 65}, {"EDOM", 65}, {"EOFF", 65}, {"EREQ", 65}, {"ETES", 65},
+    {"ETOD", 65}, {"EUSI", 65}, {"EXCL", 65}, {"GHTN", 65}, {"HEKN", 65}, {"HISR", 65},
+    {"HWAS", 65}, {"IDET", 65}, {"IMCO", 65}, {"IMUS", 65}, {"ITWA", 65}, {"LCOP", 65},
+    {"LEUS", 65}, {"LYCO", 65}, {"MENA", 65}, {"MINI", 65}, {"NEIN", 65}, {"ONED", 65},
+    {"OREO", 65}, {"ORWA", 65}, {"ORWI", 65}, {"PPRO", 65}, {"RDPA", 65}, {"REWI", 65},
+    {"RSTT", 65}, {"RTOC", 65}, {"SCOV", 65}, {"SHAV", 65}, {"SITS", 65}, {"SOFE", 65},
+    {"SOFO", 65}, {"SSIV", 65}, {"STPA", 65}, {"TAST", 65}, {"TSNO", 65}, {"TVER", 65},
+    {"TWIN", 65}, {"WIDT", 65}, {"YTOT", 65}, {"AGET", 64}, {"AKEN", 64}, {"AMEW", 64},
+    {"ARKE", 64}, {"ASIL", 64}, {"ATEM", 64}, {"EAFT", 64}, {"EGUI", 64}, {"EIMP", 64},
+    {"ERCH", 64}, {"ERFR", 64}, {"ERYT", 64}, {"FFIL", 64}, {"GEME", 64}, {"GNOR", 64},
+    {"HATB", 64}, {"HEAP", 64}, {"HOBS", 64}, {"ILIN", 64}, {"INPA", 64}, {"IPIE", 64},
+    {"ISDO", 64}, {"ITBE", 64}, {"ITHV", 64}, {"IVID", 64}, {"KAGE", 64}, {"LYON", 64},
+    {"MWIT", 64}, {"NDCH", 64}, {"NEDA", 64}, {"NGDI", 64}, {"NOTO", 64}, {"NSEV", 64},
+    {"NSYO", 64}, {"NTYO", 64}, {"OAST", 64}, {"ORLI", 64}, {"OUBL", 64}, {"PENS", 64},
+    {"PIEN", 64}, {"PREC", 64}, {"RATT", 64}, {"SETW", 64}, {"SUND", 64}, {"TBYT", 64},
+    {"THOB", 64}, {"TODI", 64}, {"UBLE", 64}, {"UGEN", 64}, {"VERG", 64}, {"WTHA", 64},
+    {"YOUE", 64}, {"YSTO", 64}, {"AKEI", 63}, {"ATMA", 63}, {"BRIG", 63}, {"CEWH", 63},
+    {"CHWA", 63}, {"DBLU", 63}, {"DTOB", 63}, {"DTOC", 63}, {"EDAL", 63}, {"EDRA", 63},
+    {"EENC", 63}, {"EIRP", 63}, {"EIRS", 63}, {"EMST", 63}, {"ERAR", 63}, {"EREY", 63},
+    {"ESBY", 63}, {"ESES", 63}, {"FLIN", 63}, {"GOFT", 63}, {"HANY", 63}, {"HEMS", 63},
+    {"IHAV", 63}, {"ILLI", 63}, {"INER", 63}, {"INSU", 63}, {"ISWH", 63}, {"LEDI", 63},
+    {"LLOF", 63}, {"LREF", 63}, {"MAYN", 63}, {"NEIS", 63}, {"NGRA", 63}, {"NSEO", 63},
+    {"NSWH", 63}, {"OLLE", 63}, {"ONDE", 63}, {"ORKB", 63}, {"OURR", 63}, {"OUSC", 63},
+    {"PROT", 63}, {"RBUT", 63}, {"RLOC", 63}, {"SFOU", 63}, {"SLAS", 63}, {"TETO", 63},
+    {"THAL", 63}, {"TSPA", 63}, {"ALLP", 62}, {"ANYA", 62}, {"AREP", 62}, {"ARYO", 62},
+    {"AYSI", 62}, {"CCOM", 62}, {"DEDB", 62}, {"DICA", 62}, {"EBUF", 62}, {"ECRE", 62},
+    {"EEVE", 62}, {"EGAL", 62}, {"EMOT", 62}, {"EMTO", 62}, {"EREX", 62}, {"FORO", 62},
+    {"HARG", 62}, {"HEON", 62}, {"HERD", 62}, {"HERM", 62}, {"INEF", 62}, {"INGG", 62},
+    {"INGY", 62}, {"LAPP", 62}, {"LDIS", 62}, {"LEVI", 62}, {"LLIG", 62}, {"LOFT", 62},
+    {"LONE", 62}, {"MESI", 62}, {"MFOR", 62}, {"MPTO", 62}, {"NACO", 62}, {"NBEF", 62},
+    {"NDDO", 62}, {"NGAC", 62}, {"NGMA", 62}, {"NGYO", 62}, {"NITE", 62}, {"NOTW", 62},
+    {"NOWY", 62}, {"NTSI", 62}, {"OPUP", 62}, {"ORON", 62}, {"OURI", 62}, {"POPU", 62},
+    {"RAST", 62}, {"REBE", 62}, {"RELE", 62}, {"RICT", 62}, {"RINA", 62}, {"RMER", 62},
+    {"ROBL", 62}, {"RSTC", 62}, {"SCOL", 62}, {"SINV", 62}, {"SONO", 62}, {"SORS", 62},
+    {"SPOT", 62}, {"STAK", 62}, {"SUPO", 62}, {"TEPA", 62}, {"TESA", 62}, {"TLYT", 62},
+    {"TSWI", 62}, {"UALC", 62}, {"YOUF", 62}, {"YPEP", 62}, {"AIRA", 61}, {"ARTY", 61},
+    {"ASET", 61}, {"ATHI", 61}, {"ATIM", 61}, {"AXFI", 61}, {"BYAN", 61}, {"CEFO", 61},
+    {"CHIT", 61}, {"DETA", 61}, {"DEXP", 61}, {"EADE", 61}, {"ENAB", 61}, {"ENTY", 61},
+    {"EOFR", 61}, {"ERSC", 61}, {"ESRE", 61}, {"EWER", 61}, {"EXHI", 61}, {"EXTR", 61},
+    {"GOTO", 61}, {"HATV", 61}, {"HECE", 61}, {"HEYC", 61}, {"HEYE", 61}, {"ILLG", 61},
+    {"INLI", 61}, {"INRE", 61}, {"LLMA", 61}, {"MALM", 61}, {"MITS", 61}, {"MMER", 61},
+    {"MTHI", 61}, {"MVIM", 61}, {"NADD", 61}, {"NDYE", 61}, {"NGEI", 61}, {"NGFI", 61},
+    {"NTWI", 61}, {"NUGE", 61}, {"ODIS", 61}, {"OFSO", 61}, {"ORAP", 61}, {"ORKW", 61},
+    {"ORTA", 61}, {"OSEP", 61}, {"OURW", 61}, {"PUTE", 61}, {"RALS", 61}, {"TANE", 61},
+    {"TISF", 61}, {"TOAS", 61}, {"TSPE", 61}, {"UTEC", 61}, {"UTPU", 61}, {"VIMA", 61},
+    {"XHIB", 61}, {"YBEC", 61}, {"AFUN", 60}, {"AGEA", 60}, {"AINA", 60}, {"AMEF", 60},
+    {"ATLI", 60}, {"ATMO", 60}, {"BBLE", 60}, {"BEMA", 60}, {"BERT", 60}, {"BUBB", 60},
+    {"CCUR", 60}, {"CKSI", 60}, {"DPRE", 60}, {"ECAM", 60}, {"EGRO", 60}, {"ESSU", 60},
+    {"FORV", 60}, {"FURT", 60}, {"FYTH", 60}, {"GHTF", 60}, {"HCON", 60}, {"HERL", 60},
+    {"IFYA", 60}, {"IMAL", 60}, {"INDA", 60}, {"IONU", 60}, {"IQUI", 60}, {"ISOF", 60},
+    {"LSOR", 60}, {"NDBL", 60}, {"NGEM", 60}, {"PLEI", 60}, {"RARI", 60}, {"RCHI", 60},
+    {"ROPT", 60}, {"ROSS", 60}, {"RTSA", 60}, {"RULE", 60}, {"SASI", 60}, {"SEIS", 60},
+    {"SMAK", 60}, {"STEN", 60}, {"THOD", 60}, {"TOPA", 60}, {"TORT", 60}, {"TPLU", 60},
+    {"TUPO", 60}, {"UBBL", 60}, {"USTO", 60}, {"VERB", 60}, {"WASS", 60}, {"YWIL", 60},
+    {"ADIS", 59}, {"ALPR", 59}, {"AMOF", 59}, {"APPR", 59}, {"ASHE", 59}, {"CING", 59},
+    {"CLUS", 59}, {"CTAN", 59}, {"DESO", 59}, {"EARO", 59}, {"EBRO", 59}, {"EDED", 59},
+    {"EDMA", 59}, {"EGUL", 59}, {"ELOP", 59}, {"EMED", 59}, {"EPUB", 59}, {"ERWO", 59},
+    {"ESEP", 59}, {"ETEC", 59}, {"ETOB", 59}, {"EXTO", 59}, {"FORF", 59}, {"GIBI", 59},
+    {"HEGU", 59}, {"HEHA", 59}, {"ILLM", 59}, {"INAF", 59}, {"INFR", 59}, {"ISHD", 59},
+    {"ISST", 59}, {"KEST", 59}, {"KINT", 59}, {"LIES", 59}, {"LLEC", 59}, {"LUEO", 59},
+    {"LYFO", 59}, {"MERE", 59}, {"MEYO", 59}, {"NAPP", 59}, {"NDAB", 59}, {"NDAF", 59},
+    {"NDIG", 59}, {"NGAL", 59}, {"NSTI", 59}, {"NTMA", 59}, {"NTOB", 59}, {"ONUN", 59},
+    {"PYIN", 59}, {"REDL", 59}, {"REGU", 59}, {"RIND", 59}, {"ROCE", 59}, {"ROTE", 59},
+    {"RRED", 59}, {"RWAY", 59}, {"SETE", 59}, {"SETI", 59}, {"SIZE", 59}, {"SWHA", 59},
+    {"TALI", 59}, {"TEDS", 59}, {"TOEN", 59}, {"TPRI", 59}, {"TSHO", 59}, {"TTOC", 59},
+    {"TWAN", 59}, {"UDES", 59}, {"ULES", 59}, {"URPL", 59}, {"XTER", 59}, {"YOUG", 59},
+    {"YPED", 59}, {"ATAB", 58}, {"DGES", 58}, {"DPRI", 58}, {"DTOM", 58}, {"ELTO", 58},
+    {"EMEM", 58}, {"ENSO", 58}, {"EOBL", 58}, {"ETET", 58}, {"FEAT", 58}, {"GFIL", 58},
+    {"HAST", 58}, {"HELO", 58}, {"IBED", 58}, {"IFOR", 58}, {"ILED", 58}, {"ILEE", 58},
+    {"ISPA", 58}, {"KEIT", 58}, {"KTHA", 58}, {"LASH", 58}, {"LLUP", 58}, {"LYOU", 58},
+    {"NEXP", 58}, {"NGEO", 58}, {"NORD", 58}, {"NTAL", 58}, {"OINS", 58}, {"ONLI", 58},
+    {"ONSS", 58}, {"OPIO", 58}, {"ORBY", 58}, {"ORUS", 58}, {"OSEL", 58}, {"PIOU", 58},
+    {"REPA", 58}, {"ROPR", 58}, {"SAFT", 58}, {"SDIF", 58}, {"SEAS", 58}, {"TSET", 58},
+    {"TSID", 58}, {"UCED", 58}, {"UCOU", 58}, {"UFFI", 58}, {"UMAN", 58}, {"VEIN", 58},
+    {"WSTH", 58}, {"YPES", 58}, {"YREA", 58}, {"ACHO", 57}, {"AMIN", 57}, {"APAT", 57},
+    {"ASAB", 57}, {"ASIS", 57}, {"ASIT", 57}, {"ATAR", 57}, {"ATHA", 57}, {"CHMA", 57},
+    {"COLL", 57}, {"DARD", 57}, {"DBET", 57}, {"DIND", 57}, {"DSET", 57}, {"EDBU", 57},
+    {"EMET", 57}, {"EMUS", 57}, {"ERBU", 57}, {"ERIC", 57}, {"ERNE", 57}, {"ERPL", 57},
+    {"EVIE", 57}, {"EYEA", 57}, {"EYMA", 57}, {"FAIR", 57}, {"FONE", 57}, {"GSOF", 57},
+    {"IATI", 57}, {"IGNO", 57}, {"ILEO", 57}, {"IPLE", 57}, {"IRRE", 57}, {"ITFO", 57},
+    {"IVEW", 57}, {"LBET", 57}, {"LCOL", 57}, {"LELT", 57}, {"LSOF", 57}, {"MANI", 57},
+    {"NDSP", 57}, {"NETR", 57}, {"NMAK", 57}, {"OAVO", 57}, {"OFYO", 57}, {"ORLE", 57},
+    {"PENA", 57}, {"REAB", 57}, {"RFEC", 57}, {"RSTL", 57}, {"RSTR", 57}, {"RWIL", 57},
+    {"SEAL", 57}, {"SERM", 57}, {"SEXA", 57}, {"SOAS", 57}, {"SWOR", 57}, {"TATT", 57},
+    {"TEAS", 57}, {"TISE", 57}, {"TOLO", 57}, {"TWOP", 57}, {"UDEA", 57}, {"YPER", 57},
+    {"YSTH", 57}, {"ADEI", 56}, {"AGEW", 56}, {"AILS", 56}, {"ASTI", 56}, {"AXIS", 56},
+    {"CABL", 56}, {"CANR", 56}, {"CORP", 56}, {"DDIN", 56}, {"DITO", 56}, {"EDAB", 56},
+    {"EDTE", 56}, {"EMOU", 56}, {"ERMO", 56}, {"ERNO", 56}, {"FAST", 56}, {"GROW", 56},
+    {"HATR", 56}, {"IALL", 56}, {"ICHF", 56}, {"IFYT", 56}, {"ILLR", 56}, {"IMET", 56},
+    {"INAD", 56}, {"ISHI", 56}, {"ISIT", 56}, {"ITEP", 56}, {"IVEA", 56}, {"IVET", 56},
+    {"KESU", 56}, {"LTIN", 56}, {"LUTE", 56}, {"LYAS", 56}, {"MEIN", 56}, {"MEMB", 56},
+    {"MESA", 56}, {"NEOR", 56}, {"NEQU", 56}, {"NGTE", 56}, {"NOFF", 56}, {"NOTP", 56},
+    {"NTOO", 56}, {"OADD", 56}, {"OKIN", 56}, {"ONSU", 56}, {"ORIT", 56}, {"OUTH", 56},
+    {"RAPP", 56}, {"RCAS", 56}, {"REXP", 56}, {"RSET", 56}, {"RSMA", 56}, {"SCAL", 56},
+    {"SETS", 56}, {"SOFW", 56}, {"SOPT", 56}, {"SREQ", 56}, {"SRES", 56}, {"SSPE", 56},
+    {"TENC", 56}, {"TLED", 56}, {"TOFF", 56}, {"TOFW", 56}, {"TRAR", 56}, {"TSFO", 56},
+    {"TXTT", 56}, {"UENT", 56}, {"UEOF", 56}, {"UISH", 56}, {"UITE", 56}, {"UNIC", 56},
+    {"VENI", 56}, {"YOUO", 56}, {"ATEI", 55}, {"AWHI", 55}, {"CEDA", 55}, {"CEFR", 55},
+    {"CTHE", 55}, {"DOUB", 55}, {"DRES", 55}, {"EITW", 55}, {"ENUI", 55}, {"ERSW", 55},
+    {"FAND", 55}, {"FIES", 55}, {"FIRM", 55}, {"FOCU", 55}, {"FORU", 55}, {"GETO", 55},
+    {"GOIN", 55}, {"HARD", 55}, {"HESY", 55}, {"HIND", 55}, {"HUSI", 55}, {"INOU", 55},
+    {"ISMI", 55}, {"ITDO", 55}, {"LEON", 55}, {"LERE", 55}, {"LIED", 55}, {"LLSE", 55},
+    {"LUPO", 55}, {"MSTO", 55}, {"MULT", 55}, {"NDCA", 55}, {"NDHE", 55}, {"NSEW", 55},
+    {"NTOS", 55}, {"NTYP", 55}, {"OCAT", 55}, {"OCUS", 55}, {"OMEN", 55}, {"ORIS", 55},
+    {"OSTC", 55}, {"OTHO", 55}, {"PEPL", 55}, {"PLYT", 55}, {"RCFI", 55}, {"REEO", 55},
+    {"REOR", 55}, {"REWH", 55}, {"RIFT", 55}, {"RTOR", 55}, {"RTRA", 55}, {"STOG", 55},
+    {"TCHT", 55}, {"TDIR", 55}, {"TELE", 55}, {"TEOF", 55}, {"TFOL", 55}, {"TGLA", 55},
+    {"TILI", 55}, {"TOGO", 55}, {"TOOL", 55}, {"TSTR", 55}, {"TSUP", 55}, {"TXTF", 55},
+    {"ULTS", 55}, {"VEBE", 55}, {"YVIM", 55}, {"AIME", 54}, {"ALEN", 54}, {"ANEN", 54},
+    {"ANSE", 54}, {"ARDI", 54}, {"BLEW", 54}, {"BUTY", 54}, {"CEDE", 54}, {"DEEP", 54},
+    {"DETO", 54}, {"DHAV", 54}, {"DIGO", 54}, {"DITE", 54}, {"EANI", 54}, {"EBOT", 54},
+    {"ECTG", 54}, {"EDYO", 54}, {"EGAT", 54}, {"EGEN", 54}, {"EHAV", 54}, {"ERRI", 54},
+    {"FIVE", 54}, {"FLAG", 54}, {"FORP", 54}, {"FVIM", 54}, {"GESI", 54}, {"GHTM", 54},
+    {"GRAY", 54}, {"HEIT", 54}, {"HTLI", 54}, {"ILEB", 54}, {"ILLE", 54}, {"ILTH", 54},
+    {"IMIL", 54}, {"ISBE", 54}, {"IXTH", 54}, {"LLHA", 54}, {"LVIM", 54}, {"LYUS", 54},
+    {"MILA", 54}, {"MIST", 54}, {"MPRE", 54}, {"MPTY", 54}, {"MRCF", 54}, {"NCEW", 54},
+    {"NFRO", 54}, {"NGAF", 54}, {"NGIS", 54}, {"NSOM", 54}, {"OANY", 54}, {"OOKS", 54},
+    {"OUMI", 54}, {"OURL", 54}, {"OUSA", 54}, {"OWHE", 54}, {"QUOT", 54}, {"RECA", 54},
+    {"RWAS", 54}, {"SADD", 54}, {"SILY", 54}, {"SIMI", 54}, {"SQUA", 54}, {"SSAR", 54},
+    {"TACT", 54}, {"TOTE", 54}, {"TTOD", 54}, {"UCHT", 54}, {"UCTI", 54}, {"ULDS", 54},
+    {"UMIG", 54}, {"UNTE", 54}, {"UTNO", 54}, {"VESA", 54}, {"ARAG", 53}, {"AREW", 53},
+    {"BEAB", 53}, {"BLEC", 53}, {"CEDB", 53}, {"CEIT", 53}, {"CHLI", 53}, {"COUR", 53},
+    {"DAMA", 53}, {"DECI", 53}, {"DLEA", 53}, {"DSON", 53}, {"DVIO", 53}, {"EBEE", 53},
+    {"EDVI", 53}, {"EERR", 53}, {"EISI", 53}, {"ENON", 53}, {"ENOU", 53}, {"ERSF", 53},
+    {"ERYL", 53}, {"ETRE", 53}, {"GEFO", 53}, {"HENS", 53}, {"HEYM", 53}, {"HORI", 53},
+    {"ICHS", 53}, {"IGGE", 53}, {"ISMT", 53}, {"ITRE", 53}, {"KEAN", 53}, {"LIAB", 53},
+    {"MERS", 53}, {"MPAN", 53}, {"NSLI", 53}, {"NTFI", 53}, {"NTFR", 53}, {"ODEW", 53},
+    {"OFAI", 53}, {"OLUT", 53}, {"OOTH", 53}, {"ORFI", 53}, {"OVEM", 53}, {"OWHI", 53},
+    {"PREF", 53}, {"PTOT", 53}, {"RBYT", 53}, {"RETA", 53}, {"RITS", 53}, {"RKBA", 53},
+    {"RMES", 53}, {"RNED", 53}, {"ROVE", 53}, {"RTIS", 53}, {"SANO", 53}, {"SEEA", 53},
+    {"SEIF", 53}, {"SEMA", 53}, {"SETF", 53}, {"SORC", 53}, {"SSEC", 53}, {"STDI", 53},
+    {"STST", 53}, {"TBEA", 53}, {"TERD", 53}, {"TRIE", 53}, {"TRUE", 53}, {"UCHM", 53},
+    {"URAT", 53}, {"YHAV", 53}, {"YOUP", 53}, {"YSAN", 53}, {"YTRA", 53}, {"ALAR", 52},
+    {"ALLU", 52}, {"ASNO", 52}, {"ASSW", 52}, {"CTUR", 52}, {"DHER", 52}, {"EABL", 52},
+    {"ECAS", 52}, {"EFOC", 52}, {"ELAN", 52}, {"ESUS", 52}, {"ETXT", 52}, {"GWHE", 52},
+    {"HEVE", 52}, {"HOMO", 52}, {"ICAB", 52}, {"ICOU", 52}, {"ILAR", 52}, {"ILST", 52},
+    {"IREM", 52}, {"ISIO", 52}, {"LBAR", 52}, {"LCHA", 52}, {"LFIL", 52}, {"LLAN", 52},
+    {"LOPE", 52}, {"MEPA", 52}, {"MINO", 52}, {"MWHI", 52}, {"NALP", 52}, {"NANO", 52},
+    {"NECE", 52}, {"NERR", 52}, {"NGSE", 52}, {"NGSW", 52}, {"NOTM", 52}, {"NPLA", 52},
+    {"NSUC", 52}, {"ODEO", 52}, {"OITS", 52}, {"OLON", 52}, {"ONSY", 52}, {"ORPR", 52},
+    {"PERL", 52}, {"POUR", 52}, {"RAMA", 52}, {"REET", 52}, {"RIED", 52}, {"RORM", 52},
+    {"RPOR", 52}, {"TAFT", 52}, {"TENA", 52}, {"THEQ", 52}, {"TLET", 52}, {"TPAS", 52},
+    {"TPOS", 52}, {"TROL", 52}, {"TSYO", 52}, {"UALB", 52}, {"UANT", 52}, {"UTER", 52},
+    {"YOUI", 52}, {"ACOV", 51}, {"AGRA", 51}, {"ALMA", 51}, {"AMER", 51}, {"ARYF", 51},
+    {"ARYS", 51}, {"ASFO", 51}, {"BEDE", 51}, {"BOTT", 51}, {"BRAM", 51}, {"CAST", 51},
+    {"CHMO", 51}, {"CIEN", 51}, {"CISE", 51}, {"DEDA", 51}, {"DERO", 51}, {"DESA", 51},
+    {"DUPO", 51}, {"EALO", 51}, {"EAVE", 51}, {"ELOC", 51}, {"ERON", 51}, {"ETOR", 51},
+    {"EYIN", 51}, {"FEST", 51}, {"FITI", 51}, {"GGRE", 51}, {"HEAB", 51}, {"HETA", 51},
+    {"HUST", 51}, {"IFYI", 51}, {"ILLC", 51}, {"ILLH", 51}, {"ILVE", 51}, {"INEL", 51},
+    {"INPU", 51}, {"ISBO", 51}, {"ITER", 51}, {"KNIV", 51}, {"KTOT", 51}, {"KWIT", 51},
+    {"LEOR", 51}, {"LLYI", 51}, {"LYWI", 51}, {"MEMO", 51}, {"MSTA", 51}, {"NDUN", 51},
+    {"NEYO", 51}, {"NFUS", 51}, {"NVEX", 51}, {"NWRI", 51}, {"OBLE", 51}, {"OFON", 51},
+    {"OMUC", 51}, {"ONEL", 51}, {"ONFU", 51}, {"ONSB", 51}, {"OOKA", 51}, {"OPYA", 51},
+    {"ORMI", 51}, {"OTEC", 51}, {"OTET", 51}, {"PLEM", 51}, {"PONA", 51}, {"PTIC", 51},
+    {"PUTA", 51}, {"RDTH", 51}, {"REEP", 51}, {"RIAT", 51}, {"SCAS", 51}, {"SILV", 51},
+    {"SSUM", 51}, {"STEX", 51}, {"STMA", 51}, {"STOI", 51}, {"SUME", 51}, {"TABO", 51},
+    {"TEDU", 51}, {"TEMP", 51}, {"TWOC", 51}, {"UALR", 51}, {"UNDS", 51}, {"VEAL", 51},
+    {"WITC", 51}, {"YEAR", 51}, {"YSIN", 51}, {"YSUC", 51}, {"AMAN", 50}, {"ANER", 50},
+    {"ANES", 50}, {"ARDT", 50}, {"ASYO", 50}, {"ATDI", 50}, {"ATON", 50}, {"BETO", 50},
+    {"BLEL", 50}, {"BUTN", 50}, {"CESI", 50}, {"DAST", 50}, {"DECO", 50}, {"DGRE", 50},
+    {"DICT", 50}, {"DSTA", 50}, {"EARI", 50}, {"ECKI", 50}, {"EETA", 50}, {"ELPF", 50},
+    {"ELVE", 50}, {"ELYA", 50}, {"ERFA", 50}, {"ERIE", 50}, {"ERNS", 50}, {"ESOL", 50},
+    {"ETEA", 50}, {"ETED", 50}, {"ETOC", 50}, {"EXPA", 50}, {"FUSE", 50}, {"GGER", 50},
+    {"GSTH", 50}, {"GUIS", 50}, {"HAIR", 50}, {"HEAU", 50}, {"HTNO", 50}, {"HTSO", 50},
+    {"HWHI", 50}, {"IALD", 50}, {"IFAN", 50}, {"IMTO", 50}, {"INOT", 50}, {"INTR", 50},
+    {"ISCH", 50}, {"ITEL", 50}, {"KBAS", 50}, {"KSTH", 50}, {"LEDA", 50}, {"LESY", 50},
+    {"LYIF", 50}, {"MEWH", 50}, {"MOGE", 50}, {"MVER", 50}, {"NDGR", 50}, {"NGSI", 50},
+    {"NGUI", 50}, {"NIFT", 50}, {"NOWW", 50}, {"NSEC", 50}, {"NTEL", 50}, {"OLEL", 50},
+    {"OMOG", 50}, {"ONBU", 50}, {"ONSP", 50}, {"OPRE", 50}, {"ORNO", 50}, {"OUDI", 50},
+    {"OUTM", 50}, {"PORA", 50}, {"RAIN", 50}, {"RCAN", 50}, {"RKST", 50}, {"SMEA", 50},
+    {"TANO", 50}, {"TERP", 50}, {"TMOV", 50}, {"UATI", 50}, {"UCHC", 50}, {"VEME", 50},
+    {"VEWO", 50}, {"ABLY", 49}, {"ANIF", 49}, {"ASYT", 49}, {"ATPA", 49}, {"ATST", 49},
+    {"AYSB", 49}, {"CULT", 49}, {"DANY", 49}, {"DROP", 49}, {"DTYP", 49}, {"DYEL", 49},
+    {"EALT", 49}, {"EBEC", 49}, {"EBRI", 49}, {"EENO", 49}, {"EINV", 49}, {"EIRD", 49},
+    {"EITA", 49}, {"EMIX", 49}, {"ENAT", 49}, {"EPTT", 49}, {"ERBA", 49}, {"ESTT", 49},
+    {"FCOM", 49}, {"FERT", 49}, {"FWAT", 49}, {"GBUT", 49}, {"ICHP", 49}, {"IEDB", 49},
+    {"IGAT", 49}, {"INDS", 49}, {"INON", 49}, {"INPR", 49}, {"ISAT", 49}, {"LELA", 49},
+    {"LLVI", 49}, {"LUSI", 49}, {"MITE", 49}, {"MOOL", 49}, {"MRUN", 49}, {"NGAR", 49},
+    {"NGUS", 49}, {"NISM", 49}, {"NLIN", 49}, {"NLYW", 49}, {"NSHO", 49}, {"OLEI", 49},
+    {"ONSC", 49}, {"ONSH", 49}, {"ORAF", 49}, {"OROF", 49}, {"PTIN", 49}, {"QUAN", 49},
+    {"RIFY", 49}, {"RMUS", 49}, {"RNAM", 49}, {"RNUM", 49}, {"RONE", 49}, {"RPLA", 49},
+    {"RVED", 49}, {"SITY", 49}, {"SOFP", 49}, {"SOLI", 49}, {"SSHO", 49}, {"TEDP", 49},
+    {"TELI", 49}, {"TGET", 49}, {"THVI", 49}, {"TIRE", 49}, {"TITW", 49}, {"TOAC", 49},
+    {"TOAL", 49}, {"TREM", 49}, {"TRES", 49}, {"TSUC", 49}, {"TTOE", 49}, {"TUND", 49},
+    {"TWHA", 49}, {"TYTH", 49}, {"UOTE", 49}, {"USAN", 49}, {"USOF", 49}, {"VEIT", 49},
+    {"XTTO", 49}, {"XTWI", 49}, {"YDEF", 49}, {"YOUL", 49}, {"YWER", 49}, {"ADET", 48},
+    {"AGEF", 48}, {"ALLD", 48}, {"ANYR", 48}, {"ASTL", 48}, {"AVEB", 48}, {"AWHO", 48},
+    {"CEYO", 48}, {"CTGL", 48}, {"DISS", 48}, {"EBYA", 48}, {"ECAL", 48}, {"EDAC", 48},
+    {"EDPA", 48}, {"EEDG", 48}, {"EENI", 48}, {"EHAL", 48}, {"ENDA", 48}, {"ENTN", 48},
+    {"ENTU", 48}, {"EPTA", 48}, {"ESHE", 48}, {"ESMO", 48}, {"ETAG", 48}, {"EWHA", 48},
+    {"FACO", 48}, {"HASI", 48}, {"HATU", 48}, {"HOTH", 48}, {"HVIM", 48}, {"ISSU", 48},
+    {"ITHW", 48}, {"ITYI", 48}, {"KLIN", 48}, {"LLAT", 48}, {"LLYS", 48}, {"LMOS", 48},
+    {"LPER", 48}, {"LVES", 48}, {"NDEA", 48}, {"NDEF", 48}, {"NESW", 48}, {"NEWH", 48},
+    {"NLYI", 48}, {"NOTF", 48}, {"NOUS", 48}, {"NSAT", 48}, {"NUSU", 48}, {"NWIL", 48},
+    {"ODES", 48}, {"OFAF", 48}, {"OMEW", 48}, {"ONEF", 48}, {"ONGA", 48}, {"OSEY", 48},
+    {"OWED", 48}, {"POST", 48}, {"RDSA", 48}, {"RSHA", 48}, {"SEEX", 48}, {"SGET", 48},
+    {"SHEW", 48}, {"SREP", 48}, {"SSOL", 48}, {"SSUP", 48}, {"STAB", 48}, {"TENS", 48},
+    {"TOFS", 48}, {"TTIM", 48}, {"TTOU", 48}, {"TWOO", 48}, {"UEST", 48}, {"UPER", 48},
+    {"VENO", 48}, {"XPAN", 48}, {"ADED", 47}, {"AIMS", 47}, {"ALLF", 47}, {"AMIS", 47},
+    {"AMMO", 47}, {"AREB", 47}, {"ARTT", 47}, {"ATRE", 47}, {"AYOU", 47}, {"BEST", 47},
+    {"BLED", 47}, {"CHON", 47}, {"DBEC", 47}, {"DBEF", 47}, {"DOWW", 47}, {"DPLA", 47},
+    {"EDHE", 47}, {"EDMO", 47}, {"EFIT", 47}, {"EFRI", 47}, {"EGLO", 47}, {"EIRR", 47},
+    {"ENAA", 47}, {"EPOW", 47}, {"ERAP", 47}, {"ERDE", 47}, {"ERIO", 47}, {"ESEM", 47},
+    {"ESIF", 47}, {"EYWE", 47}, {"GHTR", 47}, {"GREP", 47}, {"GTEX", 47}, {"HEIG", 47},
+    {"HELD", 47}, {"HERU", 47}, {"HEXP", 47}, {"HINE", 47}, {"IEDW", 47}, {"ISAD", 47},
+    {"ISVE", 47}, {"ITSR", 47}, {"ITSS", 47}, {"IXED", 47}, {"KSIN", 47}, {"KYOU", 47},
+    {"LESM", 47}, {"LLYR", 47}, {"LYBE", 47}, {"MEET", 47}, {"MESO", 47}, {"NABO", 47},
+    {"NERT", 47}, {"NEXA", 47}, {"NGBU", 47}, {"NINA", 47}, {"NISA", 47}, {"NORA", 47},
+    {"NTAC", 47}, {"NTIR", 47}, {"NUSI", 47}, {"ONEE", 47}, {"ONME", 47}, {"OPYT", 47},
+    {"ORAC", 47}, {"OURP", 47}, {"OUWO", 47}, {"PYTH", 47}, {"RAMT", 47}, {"RESA", 47},
+    {"RORS", 47}, {"RTWO", 47}, {"SEDW", 47}, {"SEPR", 47}, {"SEVI", 47}, {"SEXC", 47},
+    {"SUBJ", 47}, {"TEDM", 47}, {"THAP", 47}, {"TIND", 47}, {"TLIM", 47}, {"TLYA", 47},
+    {"TWRI", 47}, {"UALA", 47}, {"ULDH", 47}, {"USRL", 47}, {"UTMO", 47}, {"YADD", 47},
+    {"YLIN", 47}, {"YMOD", 47}, {"ACKW", 46}, {"AFOR", 46}, {"ALDI", 46}, {"ALSE", 46},
+    {"AMBE", 46}, {"ASAL", 46}, {"ASCR", 46}, {"ATEP", 46}, {"ATFI", 46}, {"BEYO", 46},
+    {"BRAT", 46}, {"CARE", 46}, {"CCEP", 46}, {"CKIF", 46}, {"DILA", 46}, {"DOIN", 46},
+    {"DOWI", 46}, {"EATU", 46}, {"EDET", 46}, {"ENVI", 46}, {"ERYS", 46}, {"ESTW", 46},
+    {"EYON", 46}, {"FEAC", 46}, {"FORB", 46}, {"FRON", 46}, {"FTEX", 46}, {"GHTP", 46},
+    {"GRES", 46}, {"HEFA", 46}, {"HEPE", 46}, {"HPRO", 46}, {"HTED", 46}, {"IMPR", 46},
+    {"IMRU", 46}, {"INMA", 46}, {"IONH", 46}, {"ISED", 46}, {"ISHA", 46}, {"LEMA", 46},
+    {"LHAV", 46}, {"LLST", 46}, {"LLYO", 46}, {"LYBY", 46}, {"MPAR", 46}, {"NCAV", 46},
+    {"NCIP", 46}, {"NEBR", 46}, {"NFIL", 46}, {"NGAP", 46}, {"NGSY", 46}, {"NOTD", 46},
+    {"NTSC", 46}, {"NYON", 46}, {"OBET", 46}, {"OLAT", 46}, {"OMTO", 46}, {"ONSM", 46},
+    {"OOLE", 46}, {"ORDA", 46}, {"OREN", 46}, {"ORIZ", 46}, {"ORTW", 46}, {"OUTF", 46},
+    {"OWRI", 46}, {"PPOR", 46}, {"PTTO", 46}, {"RDAN", 46}, {"RSEC", 46}, {"RTSW", 46},
+    {"RYLI", 46}, {"RYWH", 46}, {"SELI", 46}, {"SESW", 46}, {"SINF", 46}, {"SOLV", 46},
+    {"SOMU", 46}, {"SRLO", 46}, {"STUR", 46}, {"TEOR", 46}, {"TEXP", 46}, {"THSO", 46},
+    {"TILT", 46}, {"TOFR", 46}, {"TSWH", 46}, {"TTAB", 46}, {"TTHR", 46}, {"TWOS", 46},
+    {"UDET", 46}, {"UOUS", 46}, {"URSB", 46}, {"VEON", 46}, {"VESO", 46}, {"WVER", 46},
+    {"XTTE", 46}, {"YBRA", 46}, {"YCOP", 46}, {"YOND", 46}, {"YPAR", 46}, {"YSAR", 46},
+    {"ACEI", 45}, {"ALPA", 45}, {"ANAN", 45}, {"ANON", 45}, {"ARGS", 45}, {"ASPA", 45},
+    {"AVED", 45}, {"AVEO", 45}, {"AVIN", 45}, {"CESW", 45}, {"CHOF", 45}, {"CKAN", 45},
+    {"CKCO", 45}, {"DCAN", 45}, {"DDEF", 45}, {"DEDF", 45}, {"EAMS", 45}, {"ECLI", 45},
+    {"EDEL", 45}, {"EDRE", 45}, {"EDSE", 45}, {"EHAI", 45}, {"EITT", 45}, {"ELEF", 45},
+    {"EOBS", 45}, {"ESSW", 45}, {"EXTL", 45}, {"FSET", 45}, {"GIND", 45}, {"HEKE", 45},
+    {"ICHB", 45}, {"INPL", 45}, {"IONR", 45}, {"IPTT", 45}, {"IRDE", 45}, {"ISAC", 45},
+    {"ISHT", 45}, {"IVEO", 45}, {"IVEP", 45}, {"LDHA", 45}, {"LINT", 45}, {"LOTH", 45},
+    {"LYDI", 45}, {"NAAR", 45}, {"NFRI", 45}, {"NICO", 45}, {"NMAY", 45}, {"NPAR", 45},
+    {"NSCO", 45}, {"NSMA", 45}, {"NSWE", 45}, {"NTON", 45}, {"NTRE", 45}, {"OANO", 45},
+    {"OTOF", 45}, {"OTON", 45}, {"PERW", 45}, {"PREP", 45}, {"RALI", 45}, {"RBAT", 45},
+    {"RICA", 45}, {"RITO", 45}, {"RPRE", 45}, {"SAUT", 45}, {"SCAR", 45}, {"SGRA", 45},
+    {"SKEY", 45}, {"SMUC", 45}, {"SOLU", 45}, {"TBET", 45}, {"TINF", 45}, {"TOLI", 45},
+    {"TPRE", 45}, {"TSAR", 45}, {"TTHO", 45}, {"TWID", 45}, {"UBJE", 45}, {"VEYO", 45},
+    {"VIBR", 45}, {"WALL", 45}, {"ABPA", 44}, {"ADIF", 44}, {"AMOR", 44}, {"ATVI", 44},
+    {"BATI", 44}, {"BESO", 44}, {"BPAG", 44}, {"BYSO", 44}, {"DBEA", 44}, {"DCOD", 44},
+    {"DLES", 44}, {"DSEE", 44}, {"DTOD", 44}, {"EBEA", 44}, {"ECOU", 44}, {"EEAR", 44},
+    {"ELAW", 44}, {"EMSE", 44}, {"ENDU", 44}, {"ERNU", 44}, {"ESBU", 44}, {"ESSF", 44},
+    {"EXTB", 44}, {"FACI", 44}, {"GANY", 44}, {"GETC", 44}, {"GHTV", 44}, {"GLIN", 44},
+    {"GREG", 44}, {"HACO", 44}, {"HECL", 44}, {"HEDB", 44}, {"HIFT", 44}, {"IFES", 44},
+    {"INTI", 44}, {"IRAN", 44}, {"ISES", 44}, {"IVEI", 44}, {"LBEC", 44}, {"LEDE", 44},
+    {"LEDT", 44}, {"LEFI", 44}, {"LLFI", 44}, {"LMAN", 44}, {"LSOB", 44}, {"LSOM", 44},
+    {"MATS", 44}, {"MECH", 44}, {"NALC", 44}, {"NARE", 44}, {"NDIR", 44}, {"NDOE", 44},
+    {"NDWA", 44}, {"NGPR", 44}, {"NOWI", 44}, {"NTOP", 44}, {"OFAB", 44}, {"OMEM", 44},
+    {"OREB", 44}, {"ORST", 44}, {"ORYT", 44}, {"OUAL", 44}, {"OUIN", 44}, {"PTAN", 44},
+    {"RALC", 44}, {"RAMO", 44}, {"REEX", 44}, {"REFI", 44}, {"RGIN", 44}, {"RIVE", 44},
+    {"RKSI", 44}, {"ROMP", 44}, {"ROMS", 44}, {"RPLE", 44}, {"RSEL", 44}, {"RSOM", 44},
+    {"RSON", 44}, {"RSTS", 44}, {"RUNN", 44}, {"RYNE", 44}, {"SABL", 44}, {"SANA", 44},
+    {"SESU", 44}, {"SNEX", 44}, {"SOFG", 44}, {"SPRI", 44}, {"SRTO", 44}, {"SSEN", 44},
+    {"SSHA", 44}, {"STIC", 44}, {"TABP", 44}, {"TCOV", 44}, {"TEIN", 44}, {"TICI", 44},
+    {"TISR", 44}, {"TMEA", 44}, {"TOPO", 44}, {"TRLW", 44}, {"TTHU", 44}, {"TUSI", 44},
+    {"UNNI", 44}, {"UNSL", 44}, {"UNUS", 44}, {"URAN", 44}, {"VIME", 44}, {"XTRE", 44},
+    {"YACO", 44}, {"YMAK", 44}, {"YSEC", 44}, {"ACHI", 43}, {"ALID", 43}, {"AMEL", 43},
+    {"ANFI", 43}, {"ATWO", 43}, {"AVEI", 43}, {"BESU", 43}, {"CHAM", 43}, {"CTOF", 43},
+    {"DDEN", 43}, {"DEDO", 43}, {"DEWH", 43}, {"DSOO", 43}, {"EBEF", 43}, {"EDEG", 43},
+    {"EEDE", 43}, {"EGAR", 43}, {"EINI", 43}, {"ELLU", 43}, {"ERSP", 43}, {"ESSC", 43},
+    {"FUSI", 43}, {"GEIN", 43}, {"GLEO", 43}, {"GNAT", 43}, {"GNED", 43}, {"GTHR", 43},
+    {"HANB", 43}, {"HAVI", 43}, {"HECA", 43}, {"HTWA", 43}, {"ICKL", 43}, {"IESB", 43},
+    {"IFOU", 43}, {"ILLF", 43}, {"IMME", 43}, {"INNE", 43}, {"INUA", 43}, {"ISIB", 43},
+    {"ITIA", 43}, {"LART", 43}, {"LBOD", 43}, {"LECH", 43}, {"LITS", 43}, {"LLER", 43},
+    {"LLYW", 43}, {"LPAR", 43}, {"MEFO", 43}, {"MINU", 43}, {"MPRO", 43}, {"NEWV", 43},
+    {"NGBY", 43}, {"NICE", 43}, {"NOME", 43}, {"NOTL", 43}, {"NREF", 43}, {"NTDI", 43},
+    {"NUNI", 43}, {"NYOF", 43}, {"ONDT", 43}, {"ORDW", 43}, {"ORKO", 43}, {"ORVE", 43},
+    {"PNOR", 43}, {"PONI", 43}, {"PTED", 43}, {"PYAN", 43}, {"RCEP", 43}, {"RDTO", 43},
+    {"RERT", 43}, {"RISA", 43}, {"RKAN", 43}, {"RMAK", 43}, {"SITU", 43}, {"SSRE", 43},
+    {"STOW", 43}, {"TEDC", 43}, {"TIPL", 43}, {"TLEP", 43}, {"TLOO", 43}, {"TLYI", 43},
+    {"TOYO", 43}, {"TRYT", 43}, {"TYFO", 43}, {"URNE", 43}, {"UTON", 43}, {"UTYO", 43},
+    {"VECO", 43}, {"WASN", 43}, {"WRAP", 43}, {"YAST", 43}, {"YCAN", 43}, {"YFIL", 43},
+    {"YPRE", 43}, {"ACOL", 42}, {"ALBY", 42}, {"ALLW", 42}, {"ALME", 42}, {"ANAP", 42},
+    {"ANSW", 42}, {"ARYW", 42}, {"ATAT", 42}, {"BAND", 42}, {"BETT", 42}, {"CALM", 42},
+    {"CESF", 42}, {"CHWE", 42}, {"DBYS", 42}, {"DEYO", 42}, {"EDAF", 42}, {"EDLE", 42},
+    {"EDPR", 42}, {"EDUP", 42}, {"EEMA", 42}, {"EFIF", 42}, {"ENED", 42}, {"EORM", 42},
+    {"EREV", 42}, {"EROU", 42}, {"ERSH", 42}, {"ERTT", 42}, {"ESDI", 42}, {"ESIM", 42},
+    {"ESPR", 42}, {"ETEN", 42}, {"ETOG", 42}, {"EYET", 42}, {"EYTH", 42}, {"HEQU", 42},
+    {"HNOM", 42}, {"HTSE", 42}, {"IMEA", 42}, {"IMED", 42}, {"IMVI", 42}, {"ITRI", 42},
+    {"LEDG", 42}, {"LESF", 42}, {"LYDE", 42}, {"LYFR", 42}, {"LYOR", 42}, {"MEFI", 42},
+    {"MIXD", 42}, {"MPAT", 42}, {"MSIN", 42}, {"MWHE", 42}, {"NARG", 42}, {"NDPU", 42},
+    {"NDSH", 42}, {"NGEX", 42}, {"NGOU", 42}, {"NIFO", 42}, {"NLIK", 42}, {"NOPT", 42},
+    {"NORL", 42}, {"NOUG", 42}, {"NOWA", 42}, {"NTAB", 42}, {"NYPA", 42}, {"ODOT", 42},
+    {"OFBO", 42}, {"OFFS", 42}, {"OFIL", 42}, {"OLEA", 42}, {"OLVE", 42}, {"ORAR", 42},
+    {"ORAW", 42}, {"ORNE", 42}, {"OSEW", 42}, {"OUSP", 42}, {"RCHE", 42}, {"RISI", 42},
+    {"RNTH", 42}, {"RPER", 42}, {"RSBE", 42}, {"RSTI", 42}, {"RTOA", 42}, {"RYIS", 42},
+    {"RYOR", 42}, {"SARY", 42}, {"SETC", 42}, {"SHIF", 42}, {"SSOT", 42}, {"SSTI", 42},
+    {"STOD", 42}, {"STOU", 42}, {"SUPE", 42}, {"TBEF", 42}, {"TEAC", 42}, {"TEDE", 42},
+    {"TESI", 42}, {"TOAF", 42}, {"TOCM", 42}, {"TOCT", 42}, {"TOSO", 42}, {"TRUC", 42},
+    {"TWER", 42}, {"URNI", 42}, {"USTE", 42}, {"UTFO", 42}, {"UTIF", 42}, {"VALI", 42},
+    {"VEDI", 42}, {"VEYI", 42}, {"WTHI", 42}, {"XTAN", 42}, {"YANY", 42}, {"YPEO", 42},
+    {"YSOM", 42}, {"ADDT", 41}, {"AMAG", 41}, {"ANOP", 41}, {"ANYF", 41}, {"ARCO", 41},
+    {"ASAN", 41}, {"ASAS", 41}, {"ASSB", 41}, {"ATAG", 41}, {"AVIM", 41}, {"BUTB", 41},
+    {"BYPR", 41}, {"CANF", 41}, {"CTXT", 41}, {"DAPP", 41}, {"DEAS", 41}, {"DFUN", 41},
+    {"DORA", 41}, {"DPER", 41}, {"DUAL", 41}, {"DVAN", 41}, {"EBAS", 41}, {"ECED", 41},
+    {"ECIE", 41}, {"EFIX", 41}, {"EHIN", 41}, {"EHOW", 41}, {"ERPO", 41}, {"ERSY", 41},
+    {"ERYN", 41}, {"ETCO", 41}, {"ETRW", 41}, {"ETTO", 41}, {"EUNI", 41}, {"EWOU", 41},
+    {"FFSE", 41}, {"FINA", 41}, {"GINF", 41}, {"GINN", 41}, {"GITA", 41}, {"GLIS", 41},
+    {"GOUT", 41}, {"HAPR", 41}, {"HEMB", 41}, {"HEND", 41}, {"IALO", 41}, {"ICEI", 41},
+    {"IDEW", 41}, {"IFFI", 41}, {"IQUO", 41}, {"ITCA", 41}, {"ITEI", 41}, {"ITNO", 41},
+    {"LDTH", 41}, {"LEEX", 41}, {"LEIT", 41}, {"LSOC", 41}, {"LTHO", 41}, {"LUCI", 41},
+    {"MEIS", 41}, {"MFIL", 41}, {"MMOO", 41}, {"MTOT", 41}, {"NBET", 41}, {"NCOL", 41},
+    {"NDSW", 41}, {"NGIF", 41}, {"NGSM", 41}, {"NSEY", 41}, {"NTBU", 41}, {"NTIA", 41},
+    {"OCMD", 41}, {"ONBY", 41}, {"ONGW", 41}, {"ONRE", 41}, {"ORDT", 41}, {"OTES", 41},
+    {"OTOT", 41}, {"OTYP", 41}, {"OWDE", 41}, {"OWNE", 41}, {"OWSY", 41}, {"PATI", 41},
+    {"PHNO", 41}, {"QUOR", 41}, {"RABL", 41}, {"RDIR", 41}, {"RNOT", 41}, {"RORA", 41},
+    {"RREG", 41}, {"RSWI", 41}, {"SEWI", 41}, {"SGIV", 41}, {"SSWH", 41}, {"SUBL", 41},
+    {"TBOD", 41}, {"TERY", 41}, {"TOJU", 41}, {"TOPE", 41}, {"TORD", 41}, {"TOSH", 41},
+    {"TPLA", 41}, {"TRIG", 41}, {"TYOR", 41}, {"UCHP", 41}, {"UGET", 41}, {"ULDA", 41},
+    {"USIO", 41}, {"VALS", 41}, {"XTYO", 41}, {"ABIT", 40}, {"ACEB", 40}, {"ACOU", 40},
+    {"AMEB", 40}, {"ANYI", 40}, {"ARSI", 40}, {"ATEV", 40}, {"ATHO", 40}, {"ATSU", 40},
+    {"ATWA", 40}, {"AVEN", 40}, {"AVIT", 40}, {"AYSE", 40}, {"BASI", 40}, {"BEAL", 40},
+    {"BEPR", 40}, {"BYIT", 40}, {"CALT", 40}, {"CEAS", 40}, {"CKIN", 40}, {"DALI", 40},
+    {"DEWI", 40}, {"EBEG", 40}, {"EDOE", 40}, {"EFAR", 40}, {"ELPN", 40}, {"ENFO", 40},
+    {"ENPR", 40}, {"ERAB", 40}, {"ESQU", 40}, {"ESSR", 40}, {"ETFT", 40}, {"ETHU", 40},
+    {"ETIO", 40}, {"ETLI", 40}, {"ETOE", 40}, {"FSEC", 40}, {"FTPL", 40}, {"GAFI", 40},
+    {"GITS", 40}, {"HENM", 40}, {"HEYB", 40}, {"HISN", 40}, {"HOME", 40}, {"HOWS", 40},
+    {"IABI", 40}, {"IKEA", 40}, {"IMFI", 40}, {"IMVE", 40}, {"INEX", 40}, {"INSP", 40},
+    {"IONV", 40}, {"ITAB", 40}, {"ITAL", 40}, {"ITEC", 40}, {"LEBE", 40}, {"LEVA", 40},
+    {"LUEW", 40}, {"LUSE", 40}, {"LWOR", 40}, {"LYSE", 40}, {"MDOE", 40}, {"MEOT", 40},
+    {"MESY", 40}, {"MINF", 40}, {"NANE", 40}, {"NATT", 40}, {"NCEN", 40}, {"NCER", 40},
+    {"NDAP", 40}, {"NEAC", 40}, {"NERE", 40}, {"NERI", 40}, {"NEWF", 40}, {"NGNO", 40},
+    {"NIFY", 40}, {"NMOD", 40}, {"NSAL", 40}, {"OBAC", 40}, {"OCTX", 40}, {"OEST", 40},
+    {"OFMA", 40}, {"OIDT", 40}, {"OLID", 40}, {"ONDP", 40}, {"ONGT", 40}, {"ORKE", 40},
+    {"ORKM", 40}, {"ORMS", 40}, {"ORSH", 40}, {"OSPE", 40}, {"OTSO", 40}, {"OUGE", 40},
+    {"OWSO", 40}, {"PERB", 40}, {"PREA", 40}, {"REDM", 40}, {"REEM", 40}, {"RLAN", 40},
+    {"RSPE", 40}, {"RUCT", 40}, {"SACT", 40}, {"SASA", 40}, {"SESF", 40}, {"SFRE", 40},
+    {"SNOE", 40}, {"SOVE", 40}, {"SREM", 40}, {"TFTH", 40}, {"TISU", 40}, {"TLES", 40},
+    {"TOSP", 40}, {"TRAY", 40}, {"TREE", 40}, {"TSMA", 40}, {"TWOT", 40}, {"UCID", 40},
+    {"ULTT", 40}, {"UPPE", 40}, {"URAL", 40}, {"UROW", 40}, {"URST", 40}, {"USCH", 40},
+    {"USHO", 40}, {"UTSI", 40}, {"VANI", 40}, {"VIMP", 40}, {"VITY", 40}, {"WRON", 40},
+    {"YCOL", 40}, {"YDIF", 40}, {"YITS", 40}, {"YPEA", 40}, {"YWAY", 40}, {"AIRI", 39},
+    {"ALFA", 39}, {"ANSO", 39}, {"ANUM", 39}, {"ASIC", 39}, {"BELI", 39}, {"BESE", 39},
+    {"BLEB", 39}, {"BYBR", 39}, {"CAVE", 39}, {"CHOI", 39}, {"CKLY", 39}, {"CLIP", 39},
+    {"DADD", 39}, {"DASI", 39}, {"DCOP", 39}, {"DLIK", 39}, {"DOIT", 39}, {"DSUC", 39},
+    {"DTOI", 39}, {"EANA", 39}, {"EASA", 39}, {"EEPR", 39}, {"EOUS", 39}, {"EQUO", 39},
+    {"ERGI", 39}, {"ERNI", 39}, {"ERSS", 39}, {"ERTY", 39}, {"ESSD", 39}, {"EWTH", 39},
+    {"EYBE", 39}, {"EYWI", 39}, {"FERR", 39}, {"FORG", 39}, {"FOTH", 39}, {"GARD", 39},
+    {"GEDI", 39}, {"GESW", 39}, {"GOES", 39}, {"HEEA", 39}, {"HEHI", 39}, {"IDAN", 39},
+    {"IDIN", 39}, {"INGH", 39}, {"ISEF", 39}, {"ISTT", 39}, {"ISWA", 39}, {"LAUT", 39},
+    {"LGET", 39}, {"LLMO", 39}, {"LLSU", 39}, {"MANE", 39}, {"MMED", 39}, {"MSEL", 39},
+    {"NESE", 39}, {"NGAT", 39}, {"NGEL", 39}, {"NGUN", 39}, {"NICA", 39}, {"NMAN", 39},
+    {"NTOW", 39}, {"NYLA", 39}, {"OBEC", 39}, {"OBEI", 39}, {"OCCU", 39}, {"OFAT", 39},
+    {"OFPR", 39}, {"OICE", 39}, {"ONFR", 39}, {"ONLA", 39}, {"ONNU", 39}, {"ORDO", 39},
+    {"OREV", 39}, {"ORPU", 39}, {"ORSU", 39}, {"ORTR", 39}, {"OSEN", 39}, {"OSOM", 39},
+    {"OUCH", 39}, {"OWLE", 39}, {"PAIN", 39}, {"PEOF", 39}, {"PLEW", 39}, {"PRIA", 39},
+    {"QUEL", 39}, {"RANC", 39}, {"RCEA", 39}, {"RDSI", 39}, {"REAM", 39}, {"RONI", 39},
+    {"RSCO", 39}, {"RUNI", 39}, {"SEEI", 39}, {"SERG", 39}, {"SMOS", 39}, {"SWOU", 39},
+    {"TACC", 39}, {"TGRE", 39}, {"TIBL", 39}, {"TISO", 39}, {"TNOW", 39}, {"TOPU", 39},
+    {"TSCR", 39}, {"TTRI", 39}, {"UNTO", 39}, {"URRI", 39}, {"UTHE", 39}, {"VAPO", 39},
+    {"WASI", 39}, {"WIDE", 39}, {"YBEA", 39}, {"YEXP", 39}, {"YPEI", 39}, {"YSUB", 39},
+    {"ACHC", 38}, {"ACID", 38}, {"ALFI", 38}, {"ALLN", 38}, {"ANIT", 38}, {"ARIT", 38},
+    {"ASAR", 38}, {"ATAC", 38}, {"AYED", 38}, {"BEEX", 38}, {"BSTO", 38}, {"CANG", 38},
+    {"CHOO", 38}, {"COGN", 38}, {"CTTO", 38}, {"DIVE", 38}, {"DMOV", 38}, {"DORS", 38},
+    {"DOWO", 38}, {"ECOG", 38}, {"EHEA", 38}, {"EINO", 38}, {"EISS", 38}, {"ELOO", 38},
+    {"ENMA", 38}, {"EORS", 38}, {"EORT", 38}, {"EPAG", 38}, {"EREE", 38}, {"EREL", 38},
+    {"FALI", 38}, {"FANO", 38}, {"FICU", 38}, {"FILL", 38}, {"GEIT", 38}, {"GNIZ", 38},
+    {"HEMW", 38}, {"HOIC", 38}, {"IALC", 38}, {"IEDT", 38}, {"ILEU", 38}, {"ILLD", 38},
+    {"IMEY", 38}, {"INNO", 38}, {"ISHO", 38}, {"ISPE", 38}, {"LBEA", 38}, {"LEAV", 38},
+    {"LEWO", 38}, {"LSOW", 38}, {"LYPR", 38}, {"MAGN", 38}, {"MCOP", 38}, {"MEMA", 38},
+    {"MUSR", 38}, {"NASI", 38}, {"NCEM", 38}, {"NDTR", 38}, {"NEFO", 38}, {"NITA", 38},
+    {"NLAS", 38}, {"NOWL", 38}, {"NPRE", 38}, {"NSOU", 38}, {"NTOM", 38}, {"NTSY", 38},
+    {"OFPA", 38}, {"OGNI", 38}, {"OHAV", 38}, {"OMER", 38}, {"ONEX", 38}, {"ONTC", 38},
+    {"ORAB", 38}, {"OREW", 38}, {"ORKF", 38}, {"ORSC", 38}, {"ORYI", 38}, {"OSTU", 38},
+    {"OTEX", 38}, {"OUNO", 38}, {"PELL", 38}, {"RADI", 38}, {"RCEF", 38}, {"REDF", 38},
+    {"REFU", 38}, {"REON", 38}, {"RGER", 38}, {"RSFO", 38}, {"RTHO", 38}, {"RTUR", 38},
+    {"RYCO", 38}, {"RYSE", 38}, {"SARI", 38}, {"SBOO", 38}, {"SCHE", 38}, {"SETA", 38},
+    {"SETL", 38}, {"SLES", 38}, {"SMAP", 38}, {"SOFM", 38}, {"SORB", 38}, {"SORW", 38},
+    {"SREC", 38}, {"STHO", 38}, {"STHU", 38}, {"STSO", 38}, {"SWHO", 38}, {"TANG", 38},
+    {"TBUF", 38}, {"TENO", 38}, {"TISM", 38}, {"TOGR", 38}, {"TORC", 38}, {"TOUT", 38},
+    {"TREC", 38}, {"TSHA", 38}, {"TTOR", 38}, {"TYET", 38}, {"UDIS", 38}, {"UETH", 38},
+    {"UNIF", 38}, {"URNA", 38}, {"UROF", 38}, {"USYO", 38}, {"VEFO", 38}, {"VERN", 38},
+    {"VERW", 38}, {"VIMH", 38}, {"VIMO", 38}, {"WAYA", 38}, {"YBUT", 38}, {"YNEA", 38},
+    {"YPEC", 38}, {"ACHT", 37}, {"ACIL", 37}, {"ACKC", 37}, {"AGGR", 37}, {"AGOO", 37},
+    {"ALDE", 37}, {"AMAP", 37}, {"AMOD", 37}, {"ANCH", 37}, {"ANET", 37}, {"ANYN", 37},
+    {"APOU", 37}, {"AQUA", 37}, {"ARDL", 37}, {"ASEO", 37}, {"ATEX", 37}, {"ATIB", 37},
+    {"BEHA", 37}, {"CERN", 37}, {"CHCA", 37}, {"CHTO", 37}, {"CILI", 37}, {"CITY", 37},
+    {"CTST", 37}, {"DELI", 37}, {"DEMA", 37}, {"DENO", 37}, {"DOSO", 37}, {"EATH", 37},
+    {"EAVA", 37}, {"EBEI", 37}, {"EEFF", 37}, {"EENB", 37}, {"EENP", 37}, {"EILL", 37},
+    {"EIRE", 37}, {"EIRI", 37}, {"ENET", 37}, {"ENIF", 37}, {"ENRE", 37}, {"ENTV", 37},
+    {"EOFO", 37}, {"ERDO", 37}, {"ERTU", 37}, {"ESAV", 37}, {"ESVI", 37}, {"ETIC", 37},
+    {"ETIS", 37}, {"EUSU", 37}, {"EWCO", 37}, {"EXAC", 37}, {"FIER", 37}, {"GHAP", 37},
+    {"GNUL", 37}, {"GONE", 37}, {"HESF", 37}, {"HEYD", 37}, {"HTIS", 37}, {"HTRE", 37},
+    {"HTVI", 37}, {"ICHH", 37}, {"ICIT", 37}, {"IESF", 37}, {"IGEN", 37}, {"IMDO", 37},
+    {"IRON", 37}, {"ISAV", 37}, {"ISNE", 37}, {"ITWH", 37}, {"KSIL", 37}, {"LAYE", 37},
+    {"LBYB", 37}, {"LELO", 37}, {"LEMO", 37}, {"LEQU", 37}, {"LFOF", 37}, {"LLDI", 37},
+    {"LMEA", 37}, {"LOWO", 37}, {"LPNO", 37}, {"LTIP", 37}, {"LUES", 37}, {"LYYO", 37},
+    {"MCOM", 37}, {"MONS", 37}, {"NCOR", 37}, {"NDNE", 37}, {"NDTA", 37}, {"NEXE", 37},
+    {"NGME", 37}, {"NINF", 37}, {"NIZE", 37}, {"NOTU", 37}, {"NPER", 37}, {"NSEP", 37},
+    {"NTEX", 37}, {"NTRY", 37}, {"NUIT", 37}, {"NYCH", 37}, {"OFAP", 37}, {"OFNA", 37},
+    {"OMEF", 37}, {"ONEB", 37}, {"OREL", 37}, {"OTLI", 37}, {"OWIT", 37}, {"OWNT", 37},
+    {"PANY", 37}, {"PCOM", 37}, {"PFOR", 37}, {"PUTI", 37}, {"RCIA", 37}, {"RCUR", 37},
+    {"RDIF", 37}, {"RDSO", 37}, {"REEL", 37}, {"RKER", 37}, {"RLES", 37}, {"RLIC", 37},
+    {"RPLU", 37}, {"RTST", 37}, {"RWRI", 37}, {"RYON", 37}, {"SEDU", 37}, {"SEEW", 37},
+    {"SFIN", 37}, {"SHTH", 37}, {"SMUS", 37}, {"SOBE", 37}, {"SOIN", 37}, {"SORD", 37},
+    {"SOUT", 37}, {"STTO", 37}, {"TACO", 37}, {"TBAC", 37}, {"TBES", 37}, {"TCOU", 37},
+    {"TECH", 37}, {"THAD", 37}, {"THCO", 37}, {"TLIS", 37}, {"TLOC", 37}, {"TNAM", 37},
+    {"TOHA", 37}, {"TOSA", 37}, {"TTOG", 37}, {"TTYP", 37}, {"TXTE", 37}, {"UGHI", 37},
+    {"ULTO", 37}, {"UREC", 37}, {"URNS", 37}, {"UTTI", 37}, {"UTTO", 37}, {"VANT", 37},
+    {"VEOR", 37}, {"WERT", 37}, {"XACT", 37}, {"YMAP", 37}, {"YOFA", 37}, {"ACER", 36},
+    {"ACTL", 36}, {"ALOT", 36}, {"AMAT", 36}, {"ANYD", 36}, {"ARRI", 36}, {"ATIF", 36},
+    {"AYIS", 36}, {"BEHI", 36}, {"BEMO", 36}, {"BEOF", 36}, {"BYIN", 36}, {"CANP", 36},
+    {"CESB", 36}, {"CIPA", 36}, {"CKSL", 36}, {"CKSP", 36}, {"DDEL", 36}, {"DEIS", 36},
+    {"DFOL", 36}, {"DTOP", 36}, {"EDDI", 36}, {"EENM", 36}, {"EISF", 36}, {"EISU", 36},
+    {"ELLA", 36}, {"ELON", 36}, {"ERCU", 36}, {"ESOT", 36}, {"ESPL", 36}, {"ESTS", 36},
+    {"ETOW", 36}, {"FEAS", 36}, {"GCHA", 36}, {"GMOR", 36}, {"GOTH", 36}, {"GWHI", 36},
+    {"IEWI", 36}, {"IKEW", 36}, {"ILEM", 36}, {"ILLW", 36}, {"IMDI", 36}, {"IMTW", 36},
+    {"INNI", 36}, {"INUT", 36}, {"ISAP", 36}, {"ISOR", 36}, {"ITSB", 36}, {"ITSI", 36},
+    {"IZED", 36}, {"LBES", 36}, {"LENO", 36}, {"LESH", 36}, {"LESU", 36}, {"LICK", 36},
+    {"LIGE", 36}, {"LLAL", 36}, {"LSEE", 36}, {"LSET", 36}, {"LUSR", 36}, {"LYMA", 36},
+    {"MCAN", 36}, {"MEND", 36}, {"MTWT", 36}, {"MWAS", 36}, {"NBEC", 36}, {"NBYT", 36},
+    {"NDIV", 36}, {"NGTA", 36}, {"NGUP", 36}, {"NLYO", 36}, {"NMEN", 36}, {"NNAM", 36},
+    {"NOET", 36}, {"NSAS", 36}, {"NTBE", 36}, {"NTUN", 36}, {"NYWA", 36}, {"OETF", 36},
+    {"OGIV", 36}, {"OILO", 36}, {"OJUM", 36}, {"OMEA", 36}, {"OMOR", 36}, {"ORKU", 36},
+    {"ORLU", 36}, {"OSEI", 36}, {"OUSH", 36}, {"QUES", 36}, {"RADD", 36}, {"RALT", 36},
+    {"RANO", 36}, {"RECH", 36}, {"REEF", 36}, {"RGEA", 36}, {"RICK", 36}, {"RSAL", 36},
+    {"SAID", 36}, {"SCTR", 36}, {"SELV", 36}, {"SISW", 36}, {"SITW", 36}, {"SLOW", 36},
+    {"SOFF", 36}, {"SOMA", 36}, {"SUNT", 36}, {"SYNC", 36}, {"TABI", 36}, {"TAGA", 36},
+    {"TALO", 36}, {"TATU", 36}, {"TEYO", 36}, {"TFIN", 36}, {"THAC", 36}, {"THON", 36},
+    {"TORO", 36}, {"TOTY", 36}, {"TRLV", 36}, {"TSDE", 36}, {"TSIT", 36}, {"TTOP", 36},
+    {"TWTS", 36}, {"UCHD", 36}, {"UEDI", 36}, {"UELY", 36}, {"UMST", 36}, {"URSM", 36},
+    {"USCO", 36}, {"USEE", 36}, {"VALE", 36}, {"WTSN", 36}, {"WWIN", 36}, {"XTLI", 36},
+    {"XTMA", 36}, {"YATT", 36}, {"YIFT", 36}, {"ABST", 35}, {"ACEW", 35}, {"ACHE", 35},
+    {"ACKU", 35}, {"ADEA", 35}, {"AIRW", 35}, {"ALPE", 35}, {"ANMA", 35}, {"ANOR", 35},
+    {"ANTF", 35}, {"APHS", 35}, {"ASOF", 35}, {"ATEW", 35}, {"AYSF", 35}, {"AYSS", 35},
+    {"CANE", 35}, {"CARR", 35}, {"CFOR", 35}, {"CUTI", 35}, {"DACO", 35}, {"DEIT", 35},
+    {"DEXE", 35}, {"DHEL", 35}, {"DINP", 35}, {"DTOE", 35}, {"DTOF", 35}, {"EAFE", 35},
+    {"EAMA", 35}, {"EATO", 35}, {"EBIG", 35}, {"ECIS", 35}, {"ECTM", 35}, {"EEIN", 35},
+    {"EEPI", 35}, {"EISP", 35}, {"EMIT", 35}, {"ENAD", 35}, {"EOFL", 35}, {"EPAS", 35},
+    {"EPUR", 35}, {"EPUT", 35}, {"EWVE", 35}, {"EWWI", 35}, {"EXIT", 35}, {"EYCO", 35},
+    {"FAIL", 35}, {"FARA", 35}, {"FELL", 35}, {"GDIS", 35}, {"GEIS", 35}, {"GEMA", 35},
+    {"GPRO", 35}, {"GSUR", 35}, {"HENW", 35}, {"HINP", 35}, {"HMOR", 35}, {"ICOD", 35},
+    {"IGNA", 35}, {"ILLL", 35}, {"IMYO", 35}, {"IRDI", 35}, {"ITHR", 35}, {"ITSH", 35},
+    {"IXIN", 35}, {"KSLA", 35}, {"LARE", 35}, {"LEND", 35}, {"LLGE", 35}, {"LLSO", 35},
+    {"LLTO", 35}, {"LPHU", 35}, {"LSOU", 35}, {"LTOF", 35}, {"MHAS", 35}, {"NACC", 35},
+    {"NDAC", 35}, {"NDRA", 35}, {"NECT", 35}, {"NFIR", 35}, {"NIMA", 35}, {"NLYA", 35},
+    {"NMOV", 35}, {"NOWS", 35}, {"NPAS", 35}, {"NRES", 35}, {"NSBE", 35}, {"NTAG", 35},
+    {"NTAS", 35}, {"NTNO", 35}, {"NVEN", 35}, {"OBLO", 35}, {"OCES", 35}, {"OFOT", 35},
+    {"OLIN", 35}, {"OMPR", 35}, {"OPPE", 35}, {"OREG", 35}, {"ORPE", 35}, {"ORSP", 35},
+    {"OUDE", 35}, {"OWSH", 35}, {"OWSI", 35}, {"PEST", 35}, {"PHUR", 35}, {"PRET", 35},
+    {"PVIM", 35}, {"RACO", 35}, {"RAFT", 35}, {"RAUT", 35}, {"RCHF", 35}, {"REAF", 35},
+    {"RGED", 35}, {"RLUS", 35}, {"RLYA", 35}, {"RMEN", 35}, {"RMTH", 35}, {"RNAL", 35},
+    {"ROBA", 35}, {"RYFI", 35}, {"SDES", 35}, {"SEDE", 35}, {"SFIR", 35}, {"SGRE", 35},
+    {"SHES", 35}, {"SICA", 35}, {"STIF", 35}, {"STWO", 35}, {"SULP", 35}, {"TBED", 35},
+    {"TEMI", 35}, {"TEQU", 35}, {"THOT", 35}, {"THWH", 35}, {"TISC", 35}, {"TMOR", 35},
+    {"TOBL", 35}, {"TOGI", 35}, {"TOSU", 35}, {"TOWR", 35}, {"TRAI", 35}, {"TREP", 35},
+    {"TSVI", 35}, {"UCHL", 35}, {"UETO", 35}, {"UITA", 35}, {"ULPH", 35}, {"USTL", 35},
+    {"UTAT", 35}, {"UWOU", 35}, {"VESI", 35}, {"WCOM", 35}, {"WENT", 35}, {"XTHE", 35},
+    {"YMAY", 35}, {"ADAR", 34}, {"AGEP", 34}, {"AIND", 34}, {"AMOU", 34}, {"ANAT", 34},
+    {"APLU", 34}, {"ARAS", 34}, {"ASEX", 34}, {"ASRE", 34}, {"ASWA", 34}, {"ATAS", 34},
+    {"ATSO", 34}, {"BERA", 34}, {"BLON", 34}, {"BYTE", 34}, {"CANM", 34}, {"CEMA", 34},
+    {"CHDI", 34}, {"CHWI", 34}, {"CHYO", 34}, {"CPRO", 34}, {"CTIL", 34}, {"DBUF", 34},
+    {"DEOR", 34}, {"DERW", 34}, {"DRAY", 34}, {"DSWI", 34}, {"DTHU", 34}, {"EACC", 34},
+    {"EASS", 34}, {"EDOU", 34}, {"EEPE", 34}, {"EEWH", 34}, {"EHIS", 34}, {"ELPT", 34},
+    {"EMIS", 34}, {"EMSI", 34}, {"ENLI", 34}, {"ENOF", 34}, {"ERBO", 34}, {"ERTR", 34},
+    {"ERYF", 34}, {"ESAB", 34}, {"ESDO", 34}, {"ESFI", 34}, {"ETAR", 34}, {"ETWI", 34},
+    {"FSEV", 34}, {"FSOM", 34}, {"GANO", 34}, {"GMEN", 34}, {"GOBA", 34}, {"GSAN", 34},
+    {"HAMB", 34}, {"HASM", 34}, {"HTCO", 34}, {"HTST", 34}, {"HTTP", 34}, {"HUSY", 34},
+    {"ICHD", 34}, {"IECE", 34}, {"ILEV", 34}, {"IMEP", 34}, {"INEM", 34}, {"IPBO", 34},
+    {"IRIS", 34}, {"ITSF", 34}, {"ITSU", 34}, {"KEYM", 34}, {"LIPB", 34}, {"LITE", 34},
+    {"LLAS", 34}, {"LWIT", 34}, {"MEPL", 34}, {"MOFA", 34}, {"NBOT", 34}, {"NCTL", 34},
+    {"NDFA", 34}, {"NDHO", 34}, {"NDSC", 34}, {"NEFI", 34}, {"NEWT", 34}, {"NGSP", 34},
+    {"NOFI", 34}, {"NORT", 34}, {"NOWN", 34}, {"NSPE", 34}, {"NTWH", 34}, {"NYSE", 34},
+    {"OADI", 34}, {"OBES", 34}, {"OEXP", 34}, {"OMOF", 34}, {"ORIE", 34}, {"OSSE", 34},
+    {"OSTP", 34}, {"OTIM", 34}, {"OTWO", 34}, {"OWWI", 34}, {"PBOA", 34}, {"PIEC", 34},
+    {"PONS", 34}, {"PORE", 34}, {"PPED", 34}, {"RBET", 34}, {"RCHP", 34}, {"REGR", 34},
+    {"REWE", 34}, {"RYUS", 34}, {"SASS", 34}, {"SENC", 34}, {"SIND", 34}, {"SIXT", 34},
+    {"SJUS", 34}, {"SORF", 34}, {"SQUI", 34}, {"SSTR", 34}, {"STFI", 34}, {"STFO", 34},
+    {"SUBT", 34}, {"TEMA", 34}, {"TEMT", 34}, {"THNO", 34}, {"TORV", 34}, {"TRED", 34},
+    {"TSAL", 34}, {"TSUN", 34}, {"TTWO", 34}, {"UCHI", 34}, {"UCON", 34}, {"UPTH", 34},
+    {"UPTO", 34}, {"USEV", 34}, {"UTEI", 34}, {"VEDE", 34}, {"VIMY", 34}, {"WFIL", 34},
+    {"WSYO", 34}, {"XXXX", 34}, {"YALL", 34}, {"YTIM", 34}, {"YTYP", 34}, {"ACCU", 33},
+    {"ADAN", 33}, {"AIRT", 33}, {"ARLI", 33}, {"ARYG", 33}, {"ASHO", 33}, {"ATCA", 33},
+    {"ATEF", 33}, {"ATSA", 33}, {"ATTA", 33}, {"AYCH", 33}, {"BABL", 33}, {"BESI", 33},
+    {"BUTS", 33}, {"BYDE", 33}, {"CEWI", 33}, {"CHOR", 33}, {"CKUP", 33}, {"CURA", 33},
+    {"DBEI", 33}, {"DERF", 33}, {"DIDN", 33}, {"DILU", 33}, {"DLIB", 33}, {"EATM", 33},
+    {"EDWA", 33}, {"EEOF", 33}, {"EETI", 33}, {"EGIV", 33}, {"EHIG", 33}, {"EIRO", 33},
+    {"ELYO", 33}, {"EOFE", 33}, {"ERFU", 33}, {"ERYW", 33}, {"ESAF", 33}, {"ESLI", 33},
+    {"ETFO", 33}, {"ETYO", 33}, {"EWMO", 33}, {"FFIR", 33}, {"FNAT", 33}, {"FORN", 33},
+    {"FTWI", 33}, {"FYIN", 33}, {"GCTR", 33}, {"GERT", 33}, {"GINC", 33}, {"HENB", 33},
+    {"HINI", 33}, {"HITS", 33}, {"ICHE", 33}, {"ICON", 33}, {"IEDI", 33}, {"ILLO", 33},
+    {"ILUT", 33}, {"INUS", 33}, {"IRES", 33}, {"IRPA", 33}, {"ISEA", 33}, {"ISFR", 33},
+    {"ISMW", 33}, {"ITAS", 33}, {"ITEW", 33}, {"ITUA", 33}, {"IZES", 33}, {"LATT", 33},
+    {"LEBY", 33}, {"LESB", 33}, {"LFIN", 33}, {"LFTH", 33}, {"LSOA", 33}, {"LSOI", 33},
+    {"LSVI", 33}, {"NBED", 33}, {"NIST", 33}, {"NTWA", 33}, {"NYSU", 33}, {"OADA", 33},
+    {"OBAB", 33}, {"OBEE", 33}, {"OBEU", 33}, {"OCHE", 33}, {"ODEN", 33}, {"OFAM", 33},
+    {"OFTA", 33}, {"ONAP", 33}, {"ONDS", 33}, {"ONEY", 33}, {"ORCA", 33}, {"OSEF", 33},
+    {"OSTE", 33}, {"OURM", 33}, {"PENT", 33}, {"RATH", 33}, {"RETE", 33}, {"RFIC", 33},
+    {"RFRE", 33}, {"RMOV", 33}, {"RPRI", 33}, {"RRAY", 33}, {"SACC", 33}, {"SALO", 33},
+    {"SNOR", 33}, {"SOUN", 33}, {"SREA", 33}, {"SRED", 33}, {"STSE", 33}, {"SVAR", 33},
+    {"TALW", 33}, {"TFAL", 33}, {"TKEY", 33}, {"TMUS", 33}, {"TNUM", 33}, {"TOBJ", 33},
+    {"TOPP", 33}, {"TOWO", 33}, {"TSEA", 33}, {"TSPR", 33}, {"TUAT", 33}, {"TURA", 33},
+    {"TUTO", 33}, {"TWAY", 33}, {"USEM", 33}, {"USEW", 33}, {"VEPR", 33}, {"VERP", 33},
+    {"WASB", 33}, {"WDER", 33}, {"WORA", 33}, {"XTFI", 33}, {"XTRA", 33}, {"YANK", 33},
+    {"YBEI", 33}, {"YLAT", 33}, {"YSEE", 33}, {"YSET", 33}, {"YUPO", 33}, {"ABAC", 32},
+    {"ACEM", 32}, {"ADVA", 32}, {"AINB", 32}, {"ASUB", 32}, {"ATPR", 32}, {"AVAR", 32},
+    {"AYAN", 32}, {"BLAN", 32}, {"BYAP", 32}, {"CEON", 32}, {"CKWA", 32}, {"DAGA", 32},
+    {"DDAN", 32}, {"DIGR", 32}, {"DNOW", 32}, {"DSUB", 32}, {"EARD", 32}, {"EARN", 32},
+    {"EBLA", 32}, {"EDEE", 32}, {"EDST", 32}, {"ELLV", 32}, {"EMUC", 32}, {"EOFW", 32},
+    {"EPTE", 32}, {"EROO", 32}, {"ESAC", 32}, {"ESEI", 32}, {"ETOI", 32}, {"EWLI", 32},
+    {"EXTM", 32}, {"EYDO", 32}, {"FFOR", 32}, {"FIXD", 32}, {"FORR", 32}, {"GACO", 32},
+    {"GALL", 32}, {"GETM", 32}, {"HALI", 32}, {"HART", 32}, {"HEER", 32}, {"HENV", 32},
+    {"HILS", 32}, {"HISH", 32}, {"HRED", 32}, {"IBLY", 32}, {"IDEI", 32}, {"IERT", 32},
+    {"IGRA", 32}, {"IKEM", 32}, {"INEY", 32}, {"INKE", 32}, {"INSH", 32}, {"INWA", 32},
+    {"IRME", 32}, {"IRTH", 32}, {"ISBY", 32}, {"ISSH", 32}, {"ITON", 32}, {"ITSD", 32},
+    {"IVEC", 32}, {"LARI", 32}, {"LBEI", 32}, {"LCON", 32}, {"LICI", 32}, {"LLBA", 32},
+    {"LLYD", 32}, {"LLYU", 32}, {"LOVE", 32}, {"LSEA", 32}, {"LSOS", 32}, {"LTOA", 32},
+    {"LUEI", 32}, {"LYUP", 32}, {"MAYD", 32}, {"MAYP", 32}, {"MWIN", 32}, {"NADI", 32},
+    {"NDCR", 32}, {"NEAT", 32}, {"NEEN", 32}, {"NEXC", 32}, {"NINE", 32}, {"NSON", 32},
+    {"NTDO", 32}, {"NTOI", 32}, {"OALL", 32}, {"OFTI", 32}, {"OLDA", 32}, {"ONIC", 32},
+    {"ONNE", 32}, {"ONNO", 32}, {"OOSE", 32}, {"OPES", 32}, {"OPPO", 32}, {"ORMD", 32},
+    {"ORSI", 32}, {"ORTU", 32}, {"ORYA", 32}, {"OTHT", 32}, {"PAST", 32}, {"PLEV", 32},
+    {"PLEY", 32}, {"POWD", 32}, {"REAP", 32}, {"RMOT", 32}, {"ROGE", 32}, {"RSFR", 32},
+    {"RTVI", 32}, {"RYWI", 32}, {"SASE", 32}, {"SASP", 32}, {"SATA", 32}, {"SAVA", 32},
+    {"SCEN", 32}, {"SEAP", 32}, {"SEMI", 32}, {"SILL", 32}, {"SPAS", 32}, {"SSFO", 32},
+    {"STSU", 32}, {"TALA", 32}, {"TAXH", 32}, {"TCHO", 32}, {"TEPR", 32}, {"TIMC", 32},
+    {"TLYB", 32}, {"TOBS", 32}, {"TORU", 32}, {"TOTR", 32}, {"TTOW", 32}, {"TUDE", 32},
+    {"TWOL", 32}, {"TYTO", 32}, {"ULLY", 32}, {"UMTH", 32}, {"UNDR", 32}, {"URCO", 32},
+    {"UREI", 32}, {"URVI", 32}, {"USEY", 32}, {"VERR", 32}, {"VEYA", 32}, {"WAYI", 32},
+    {"XTSE", 32}, {"YBES", 32}, {"YIFY", 32}, {"YSBE", 32}, {"YUSI", 32}, {"AAND", 31},
+    {"AGST", 31}, {"ALSP", 31}, {"AMEE", 31}, {"AMON", 31}, {"ANDJ", 31}, {"ANUN", 31},
+    {"ARCE", 31}, {"ASAC", 31}, {"ASEN", 31}, {"ATDO", 31}, {"ATFO", 31}, {"ATSP", 31},
+    {"AYSC", 31}, {"BYEX", 31}, {"CEAL", 31}, {"CHED", 31}, {"CHPR", 31}, {"CHRE", 31},
+    {"CUSO", 31}, {"DAUT", 31}, {"DERD", 31}, {"DGET", 31}, {"DINF", 31}, {"DMAT", 31},
+    {"DPOS", 31}, {"DTOR", 31}, {"EACI", 31}, {"EAGA", 31}, {"EEAC", 31}, {"EEST", 31},
+    {"EGRA", 31}, {"EHAS", 31}, {"EMWI", 31}, {"ENAS", 31}, {"EOFG", 31}, {"ERSM", 31},
+    {"ESPH", 31}, {"ESWE", 31}, {"ETHP", 31}, {"ETOU", 31}, {"EWAL", 31}, {"EWFI", 31},
+    {"FLUI", 31}, {"FPRO", 31}, {"FTIM", 31}, {"GEDT", 31}, {"GENC", 31}, {"GEWH", 31},
+    {"GEYO", 31}, {"GOLD", 31}, {"GPLA", 31}, {"GWIL", 31}, {"HECR", 31}, {"HEGE", 31},
+    {"HERV", 31}, {"HEYH", 31}, {"HFIL", 31}, {"HISV", 31}, {"HOOS", 31}, {"HUND", 31},
+    {"IFTW", 31}, {"IMHA", 31}, {"IMOR", 31}, {"IMSE", 31}, {"INEG", 31}, {"INEU", 31},
+    {"IPTF", 31}, {"ISLO", 31}, {"ITEO", 31}, {"KESI", 31}, {"KSLI", 31}, {"LAME", 31},
+    {"LANK", 31}, {"LELE", 31}, {"LSTH", 31}, {"LSTO", 31}, {"LTIS", 31}, {"LUET", 31},
+    {"LUID", 31}, {"LUTI", 31}, {"MACH", 31}, {"MEPR", 31}, {"MESF", 31}, {"MOFL", 31},
+    {"NCOP", 31}, {"NDEV", 31}, {"NDTY", 31}, {"NESP", 31}, {"NGCH", 31}, {"NGEC", 31},
+    {"NGVE", 31}, {"NLIG", 31}, {"NMAP", 31}, {"NONT", 31}, {"NORO", 31}, {"NSHA", 31},
+    {"NSHI", 31}, {"NSPI", 31}, {"NUTE", 31}, {"NWAT", 31}, {"OFAW", 31}, {"OLBA", 31},
+    {"OMEC", 31}, {"ONNA", 31}, {"OOLB", 31}, {"OPAR", 31}, {"OPLE", 31}, {"ORFR", 31},
+    {"ORLD", 31}, {"ORWO", 31}, {"OSEB", 31}, {"OSIN", 31}, {"OSTI", 31}, {"OTAN", 31},
+    {"OUKN", 31}, {"OUPR", 31}, {"OURB", 31}, {"OURV", 31}, {"OVIS", 31}, {"OWNI", 31},
+    {"PENE", 31}, {"PERH", 31}, {"PICT", 31}, {"PUTS", 31}, {"RACC", 31}, {"RAPA", 31},
+    {"RAVI", 31}, {"RDLE", 31}, {"REEA", 31}, {"REEQ", 31}, {"RIFI", 31}, {"RIMA", 31},
+    {"RKAS", 31}, {"RKSO", 31}, {"RKWI", 31}, {"RNEW", 31}, {"ROMW", 31}, {"RSBU", 31},
+    {"RTEN", 31}, {"RTLE", 31}, {"RTOD", 31}, {"RYPR", 31}, {"SCOR", 31}, {"SDOE", 31},
+    {"SEBE", 31}, {"SECH", 31}, {"SIHA", 31}, {"SISC", 31}, {"SOFB", 31}, {"SORR", 31},
+    {"SSEL", 31}, {"STEP", 31}, {"STLY", 31}, {"SUSI", 31}, {"SWRI", 31}, {"THTO", 31},
+    {"THWA", 31}, {"TIMP", 31}, {"TNES", 31}, {"TOFC", 31}, {"TTOI", 31}, {"UITY", 31},
+    {"UNDB", 31}, {"URFI", 31}, {"URLI", 31}, {"VERD", 31}, {"VIRT", 31}, {"WASM", 31},
+    {"WORL", 31}, {"XAND", 31}, {"YINS", 31}, {"YLON", 31}, {"ACIN", 30}, {"ACTS", 30},
+    {"ALLR", 30}, {"ALSA", 30}, {"ANIM", 30}, {"ARTV", 30}, {"ASDE", 30}, {"ASIM", 30},
+    {"ATAP", 30}, {"ATWE", 30}, {"AVEM", 30}, {"AYSD", 30}, {"BEDO", 30}, {"BETR", 30},
+    {"BIGN", 30}, {"CALS", 30}, {"CEIF", 30}, {"CEOR", 30}, {"CHBE", 30}, {"CHEM", 30},
+    {"CITE", 30}, {"CTAL", 30}, {"CTYO", 30}, {"CUMS", 30}, {"DBAC", 30}, {"DBYR", 30},
+    {"DDOE", 30}, {"DDTH", 30}, {"DMOS", 30}, {"DSOT", 30}, {"DYET", 30}, {"EARB", 30},
+    {"ECLA", 30}, {"EDIM", 30}, {"EEMS", 30}, {"EENS", 30}, {"ENAW", 30}, {"EORL", 30},
+    {"EROG", 30}, {"ERSB", 30}, {"ERYC", 30}, {"ERYR", 30}, {"ESLE", 30}, {"ETAK", 30},
+    {"EVIB", 30}, {"EYCA", 30}, {"EYHA", 30}, {"FACT", 30}, {"FAFI", 30}, {"FARG", 30},
+    {"FBOD", 30}, {"FLAM", 30}, {"FOFT", 30}, {"FORH", 30}, {"GETS", 30}, {"GHTD", 30},
+    {"GNES", 30}, {"GRAV", 30}, {"GVER", 30}, {"HINA", 30}, {"HISG", 30}, {"HORD", 30},
+    {"HSTA", 30}, {"IALI", 30}, {"ICEO", 30}, {"ILOF", 30}, {"IMAN", 30}, {"IMIS", 30},
+    {"INBO", 30}, {"INKI", 30}, {"ISEN", 30}, {"ITAP", 30}, {"ITEB", 30}, {"ITUD", 30},
+    {"ITUN", 30}, {"KEIN", 30}, {"LEDO", 30}, {"LEDW", 30}, {"LEMS", 30}, {"LLFO", 30},
+    {"LLOT", 30}, {"LOWG", 30}, {"LTHA", 30}, {"LYUN", 30}, {"MAIL", 30}, {"MESM", 30},
+    {"MITI", 30}, {"MOUN", 30}, {"MSWH", 30}, {"NCAN", 30}, {"NDSY", 30}, {"NECH", 30},
+    {"NEWC", 30}, {"NEWM", 30}, {"NGEF", 30}, {"NOFS", 30}, {"NUND", 30}, {"OBST", 30},
+    {"ODYO", 30}, {"OEVE", 30}, {"OFFO", 30}, {"OFSI", 30}, {"OMPT", 30}, {"ONEP", 30},
+    {"ONUS", 30}, {"OOFT", 30}, {"OOKT", 30}, {"ORGE", 30}, {"OROR", 30}, {"OTDI", 30},
+    {"OUTC", 30}, {"OUTL", 30}, {"OWAT", 30}, {"OWIF", 30}, {"OWMA", 30}, {"PEOP", 30},
+    {"RDEX", 30}, {"REDU", 30}, {"RELO", 30}, {"REWA", 30}, {"RGLA", 30}, {"RHAS", 30},
+    {"RIMP", 30}, {"RKEY", 30}, {"RKLI", 30}, {"RKSW", 30}, {"RKUN", 30}, {"RRIN", 30},
+    {"RSAS", 30}, {"RSUP", 30}, {"RSWE", 30}, {"RTOW", 30}, {"RVES", 30}, {"SBAC", 30},
+    {"SCOU", 30}, {"SECA", 30}, {"SEON", 30}, {"SESP", 30}, {"SINP", 30}, {"SMIG", 30},
+    {"SORL", 30}, {"SSBE", 30}, {"STFR", 30}, {"STIM", 30}, {"STWH", 30}, {"TACH", 30},
+    {"TEAL", 30}, {"TEON", 30}, {"TFIR", 30}, {"TILE", 30}, {"TISP", 30}, {"TOAI", 30},
+    {"TOFE", 30}, {"TONO", 30}, {"TOOR", 30}, {"TORP", 30}, {"TRAD", 30}, {"TRET", 30},
+    {"TSYN", 30}, {"TTOO", 30}, {"TVAL", 30}, {"UALP", 30}, {"UFRE", 30}, {"ULDD", 30},
+    {"UMAK", 30}, {"USEP", 30}, {"USTI", 30}, {"UTAL", 30}, {"UTBE", 30}, {"UTCO", 30},
+    {"VACU", 30}, {"VITR", 30}, {"WASP", 30}, {"WLED", 30}, {"YGEN", 30}, {"YOUK", 30},
+    {"YPLA", 30}, {"YREC", 30}, {"YSCR", 30}, {"YSTR", 30}, {"ACKI", 29}, {"ACTO", 29},
+    {"AINO", 29}, {"AKEC", 29}, {"ALCH", 29}, {"ALPL", 29}, {"ALSI", 29}, {"ALVA", 29},
+    {"ANAR", 29}, {"ANCO", 29}, {"ANOB", 29}, {"AREV", 29}, {"ARKC", 29}, {"ASBY", 29},
+    {"ASWH", 29}, {"ATNO", 29}, {"ATWI", 29}, {"AWTH", 29}, {"AYDI", 29}, {"BIGG", 29},
+    {"BLEP", 29}, {"CCEE", 29}, {"CEBY", 29}, {"CHAL", 29}, {"CHHA", 29}, {"CHIV", 29},
+    {"CUMF", 29}, {"DANO", 29}, {"DARY", 29}, {"DEAR", 29}, {"DFRI", 29}, {"DGEO", 29},
+    {"DINO", 29}, {"DORD", 29}, {"DPUT", 29}, {"DTOW", 29}, {"EABB", 29}, {"EAPE", 29},
+    {"EAXI", 29}, {"EBEL", 29}, {"EDEX", 29}, {"EDRO", 29}, {"EECH", 29}, {"EFEE", 29},
+    {"EINE", 29}, {"ENDC", 29}, {"ENWH", 29}, {"EOFB", 29}, {"EPOR", 29}, {"EPTH", 29},
+    {"ERRU", 29}, {"ESEX", 29}, {"EXTH", 29}, {"EXTY", 29}, {"EYST", 29}, {"FEVE", 29},
+    {"FTWO", 29}, {"GARO", 29}, {"GCON", 29}, {"GERA", 29}, {"GEWI", 29}, {"GEXP", 29},
+    {"GONT", 29}, {"GSMA", 29}, {"GSTA", 29}, {"GTOA", 29}, {"HCOL", 29}, {"HEIS", 29},
+    {"HERN", 29}, {"HEWR", 29}, {"HOPT", 29}, {"HPAT", 29}, {"HTFO", 29}, {"HVER", 29},
+    {"IAND", 29}, {"IKEI", 29}, {"ILTE", 29}, {"INAP", 29}, {"INEE", 29}, {"INWI", 29},
+    {"IRTU", 29}, {"ISAW", 29}, {"ISIM", 29}, {"ISMB", 29}, {"ISVI", 29}, {"ISWO", 29},
+    {"ITHG", 29}, {"IUMS", 29}, {"IZAT", 29}, {"JOIN", 29}, {"LDEV", 29}, {"LEBR", 29},
+    {"LLIS", 29}, {"LLON", 29}, {"LLSV", 29}, {"LLWH", 29}, {"LLYC", 29}, {"LLYF", 29},
+    {"LORI", 29}, {"LVAR", 29}, {"LWHE", 29}, {"LWHI", 29}, {"LYWA", 29}, {"MELI", 29},
+    {"MESW", 29}, {"MFER", 29}, {"MINS", 29}, {"MORA", 29}, {"NAFI", 29}, {"NCED", 29},
+    {"NDBU", 29}, {"NEBE", 29}, {"NETS", 29}, {"NKIN", 29}, {"NSEL", 29}, {"NTHR", 29},
+    {"NTOU", 29}, {"NULE", 29}, {"NYLI", 29}, {"OAIR", 29}, {"OBEO", 29}, {"OBER", 29},
+    {"OCOL", 29}, {"OFGR", 29}, {"OFMO", 29}, {"OLES", 29}, {"OMEB", 29}, {"ONGI", 29},
+    {"ONTW", 29}, {"ORHA", 29}, {"OSTL", 29}, {"OSTS", 29}, {"OTAT", 29}, {"OUTE", 29},
+    {"OWUS", 29}, {"PECO", 29}, {"RASI", 29}, {"RAWN", 29}, {"RAWO", 29}, {"RCAU", 29},
+    {"RCHO", 29}, {"RDPR", 29}, {"REUN", 29}, {"RHAP", 29}, {"RIET", 29}, {"RKCO", 29},
+    {"RKSA", 29}, {"RLIS", 29}, {"RMOS", 29}, {"RMST", 29}, {"RSCH", 29}, {"RSEA", 29},
+    {"RSEV", 29}, {"RSRE", 29}, {"RSUC", 29}, {"RUND", 29}, {"RWIN", 29}, {"RYRE", 29},
+    {"SASW", 29}, {"SDIR", 29}, {"SEES", 29}, {"SERC", 29}, {"SHIP", 29}, {"SKIP", 29},
+    {"SLYT", 29}, {"SONW", 29}, {"SORE", 29}, {"SSIM", 29}, {"STWI", 29}, {"SUIT", 29},
+    {"TAUT", 29}, {"TCAU", 29}, {"TEEN", 29}, {"TEWH", 29}, {"TFOU", 29}, {"THSE", 29},
+    {"TITE", 29}, {"TOOP", 29}, {"TOPI", 29}, {"TSBE", 29}, {"TSEV", 29}, {"TTOF", 29},
+    {"TUNI", 29}, {"TURT", 29}, {"TWOF", 29}, {"TXTS", 29}, {"TYIN", 29}, {"UALO", 29},
+    {"UECO", 29}, {"UKNO", 29}, {"UMFE", 29}, {"UPPL", 29}, {"URCH", 29}, {"URTL", 29},
+    {"USIT", 29}, {"USTS", 29}, {"UTLI", 29}, {"UTWA", 29}, {"UTWI", 29}, {"VEAR", 29},
+    {"WASD", 29}, {"WNIN", 29}, {"WUSE", 29}, {"XCOM", 29}, {"XPEC", 29}, {"XTED", 29},
+    {"XTIS", 29}, {"YBET", 29}, {"YMEA", 29}, {"YTOS", 29}, {"AFFI", 28}, {"AIRB", 28},
+    {"AKEY", 28}, {"ALPH", 28}, {"ALSU", 28}, {"ANEA", 28}, {"APRE", 28}, {"ASHA", 28},
+    {"ASIE", 28}, {"ASMU", 28}, {"ATRA", 28}, {"AVEC", 28}, {"AXHI", 28}, {"AYOF", 28},
+    {"AYSM", 28}, {"BYMA", 28}, {"CARC", 28}, {"CEVI", 28}, {"CHBY", 28}, {"CHME", 28},
+    {"CHTI", 28}, {"DACC", 28}, {"DASA", 28}, {"DBYO", 28}, {"DIMI", 28}, {"DOFF", 28},
+    {"DREA", 28}, {"DSAT", 28}, {"DSCA", 28}, {"DSEA", 28}, {"DSYN", 28}, {"DTWO", 28},
+    {"DWAS", 28}, {"DWHA", 28}, {"EAWO", 28}, {"EBES", 28}, {"ECID", 28}, {"ECLO", 28},
+    {"EDEC", 28}, {"EESA", 28}, {"EFLA", 28}, {"EIRF", 28}, {"EISO", 28}, {"EITC", 28},
+    {"EJUS", 28}, {"ELLT", 28}, {"ENEE", 28}, {"ENMO", 28}, {"EOPL", 28}, {"ESGR", 28},
+    {"ESSP", 28}, {"ETMA", 28}, {"EWAR", 28}, {"EXER", 28}, {"EYES", 28}, {"FILT", 28},
+    {"FIXE", 28}, {"FULT", 28}, {"GANE", 28}, {"GEDB", 28}, {"GINW", 28}, {"HEPH", 28},
+    {"HMOD", 28}, {"HNOT", 28}, {"HOWM", 28}, {"HTON", 28}, {"HWER", 28}, {"HWIT", 28},
+    {"ICKT", 28}, {"IMEI", 28}, {"INWR", 28}, {"IPRO", 28}, {"IROR", 28}, {"ISKE", 28},
+    {"ITHF", 28}, {"ITSN", 28}, {"IUMI", 28}, {"KEVI", 28}, {"KEWI", 28}, {"KUND", 28},
+    {"LAYO", 28}, {"LEPR", 28}, {"LINC", 28}, {"LLPR", 28}, {"LOWF", 28}, {"LYAF", 28},
+    {"MAPS", 28}, {"MERA", 28}, {"MESU", 28}, {"MFRO", 28}, {"MPAS", 28}, {"MPIN", 28},
+    {"MYEY", 28}, {"NARI", 28}, {"NCLO", 28}, {"NDDA", 28}, {"NDMI", 28}, {"NDPL", 28},
+    {"NDTE", 28}, {"NERO", 28}, {"NERS", 28}, {"NEWL", 28}, {"NGAB", 28}, {"NGAG", 28},
+    {"NKED", 28}, {"NMAT", 28}, {"NOTG", 28}, {"NSPR", 28}, {"NSUN", 28}, {"NTME", 28},
+    {"NTPR", 28}, {"NTSP", 28}, {"NVAL", 28}, {"NWAR", 28}, {"NYME", 28}, {"OFAD", 28},
+    {"OFME", 28}, {"OFUS", 28}, {"OKAT", 28}, {"OLEF", 28}, {"OMOT", 28}, {"ONVI", 28},
+    {"OOPE", 28}, {"OPOF", 28}, {"OPUT", 28}, {"OPYM", 28}, {"ORAG", 28}, {"ORBI", 28},
+    {"OREE", 28}, {"ORGL", 28}, {"OTMA", 28}, {"OTUS", 28}, {"OUED", 28}, {"OUSI", 28},
+    {"OWGR", 28}, {"PLEC", 28}, {"POFT", 28}, {"PRED", 28}, {"RALO", 28}, {"RAYI", 28},
+    {"RCIS", 28}, {"RDET", 28}, {"RDWI", 28}, {"REEI", 28}, {"RESC", 28}, {"RGRE", 28},
+    {"RIDE", 28}, {"RIEN", 28}, {"ROFC", 28}, {"ROOT", 28}, {"RSUB", 28}, {"RSYO", 28},
+    {"RYFA", 28}, {"RYFO", 28}, {"RYLO", 28}, {"RYOF", 28}, {"SBOD", 28}, {"SGRO", 28},
+    {"SIBI", 28}, {"SISN", 28}, {"SMAR", 28}, {"SOCO", 28}, {"SPUB", 28}, {"SSIS", 28},
+    {"SSUB", 28}, {"STOE", 28}, {"SWAY", 28}, {"TALR", 28}, {"TATO", 28}, {"TBER", 28},
+    {"TDIF", 28}, {"TINE", 28}, {"TISB", 28}, {"TOUN", 28}, {"TOVE", 28}, {"TOVI", 28},
+    {"TSCA", 28}, {"TSFR", 28}, {"TSUR", 28}, {"TTAK", 28}, {"TVAR", 28}, {"TWEL", 28},
+    {"TXTM", 28}, {"UBSE", 28}, {"UITI", 28}, {"UNOW", 28}, {"UREW", 28}, {"URNT", 28},
+    {"UTCH", 28}, {"UTEV", 28}, {"VENA", 28}, {"VIMM", 28}, {"WASC", 28}, {"WFRO", 28},
+    {"WPRO", 28}, {"WSER", 28}, {"XHIG", 28}, {"XING", 28}, {"YALT", 28}, {"YEYE", 28},
+    {"YSOR", 28}, {"YTHO", 28}, {"YWAN", 28}, {"ADAB", 27}, {"ADEO", 27}, {"AGSF", 27},
+    {"AKER", 27}, {"ALBO", 27}, {"ALIC", 27}, {"ANSF", 27}, {"ANYE", 27}, {"ASAP", 27},
+    {"ASCO", 27}, {"ATSE", 27}, {"AVEF", 27}, {"AYRE", 27}, {"BEPL", 27}, {"BLEU", 27},
+    {"BLIG", 27}, {"BYYO", 27}, {"CEND", 27}, {"CHSO", 27}, {"COPP", 27}, {"DABL", 27},
+    {"DBOD", 27}, {"DECL", 27}, {"DMET", 27}, {"DMOD", 27}, {"DOMT", 27}, {"DSTR", 27},
+    {"DSWH", 27}, {"DTAB", 27}, {"DWRI", 27}, {"EBLO", 27}, {"EBRA", 27}, {"EBYS", 27},
+    {"ECTF", 27}, {"ECTW", 27}, {"EDCH", 27}, {"EEDS", 27}, {"EEIT", 27}, {"EFAC", 27},
+    {"EIRA", 27}, {"EITF", 27}, {"ENBY", 27}, {"EOVE", 27}, {"ERLA", 27}, {"ESEF", 27},
+    {"ESTB", 27}, {"ESYS", 27}, {"ETFR", 27}, {"ETRU", 27}, {"EWED", 27}, {"FIRE", 27},
+    {"FORL", 27}, {"GANI", 27}, {"GEPT", 27}, {"GETI", 27}, {"GINO", 27}, {"GUSE", 27},
+    {"HAPS", 27}, {"HEAX", 27}, {"HECT", 27}, {"HIVE", 27}, {"HTBY", 27}, {"IDPA", 27},
+    {"IEWD", 27}, {"IFTE", 27}, {"INLE", 27}, {"INMO", 27}, {"IOLA", 27}, {"ITYW", 27},
+    {"IVAL", 27}, {"IVEY", 27}, {"KCOV", 27}, {"KEMA", 27}, {"KESA", 27}, {"KLIK", 27},
+    {"KWAR", 27}, {"KWHE", 27}, {"LARC", 27}, {"LARP", 27}, {"LEAL", 27}, {"LEAT", 27},
+    {"LEBU", 27}, {"LETB", 27}, {"LIGA", 27}, {"LLDE", 27}, {"LLYP", 27}, {"LMAK", 27},
+    {"LYIT", 27}, {"MAPC", 27}, {"MEME", 27}, {"MERI", 27}, {"MERO", 27}, {"MESE", 27},
+    {"MEWI", 27}, {"NCEY", 27}, {"NDOI", 27}, {"NDSS", 27}, {"NDWE", 27}, {"NEDO", 27},
+    {"NESH", 27}, {"NFOL", 27}, {"NGBE", 27}, {"NGSS", 27}, {"NITT", 27}, {"NITW", 27},
+    {"NLIS", 27}, {"NLYF", 27}, {"NMUS", 27}, {"NOUT", 27}, {"NSEB", 27}, {"NTIG", 27},
+    {"NVIS", 27}, {"NYWO", 27}, {"OACH", 27}, {"ODEY", 27}, {"OFCH", 27}, {"OFFR", 27},
+    {"OIND", 27}, {"OLOA", 27}, {"OMEP", 27}, {"ONEM", 27}, {"ORIM", 27}, {"OTAP", 27},
+    {"OUMO", 27}, {"OVEO", 27}, {"OWNS", 27}, {"PNAM", 27}, {"PRIO", 27}, {"RAGE", 27},
+    {"RCEI", 27}, {"REOU", 27}, {"RFER", 27}, {"RITH", 27}, {"ROUT", 27}, {"SBEL", 27},
+    {"SCAP", 27}, {"SDEL", 27}, {"SELY", 27}, {"SEUN", 27}, {"SISD", 27}, {"SLIS", 27},
+    {"SMEN", 27}, {"SMOD", 27}, {"SMOV", 27}, {"SMTH", 27}, {"SOUS", 27}, {"SSOU", 27},
+    {"SSYN", 27}, {"STVI", 27}, {"SUBD", 27}, {"TADD", 27}, {"TASE", 27}, {"TDON", 27},
+    {"TEDN", 27}, {"TENU", 27}, {"TERL", 27}, {"TLEO", 27}, {"TLYO", 27}, {"TMIG", 27},
+    {"TOFL", 27}, {"TOUC", 27}, {"TPAT", 27}, {"TREQ", 27}, {"TSLI", 27}, {"TUNA", 27},
+    {"UALW", 27}, {"UART", 27}, {"ULAT", 27}, {"UNCO", 27}, {"UPFI", 27}, {"UREM", 27},
+    {"URIS", 27}, {"URWH", 27}, {"VESE", 27}, {"WFOR", 27}, {"WGRE", 27}, {"WISH", 27},
+    {"WONT", 27}, {"XERC", 27}, {"XTUS", 27}, {"YFRE", 27}, {"YMAT", 27}, {"YMIX", 27},
+    {"YSHA", 27}, {"YTHR", 27}, {"ACEN", 26}, {"ADIR", 26}, {"ALOG", 26}, {"ALST", 26},
+    {"AMST", 26}, {"AMTH", 26}, {"ANAC", 26}, {"ANAG", 26}, {"ANYB", 26}, {"AQUE", 26},
+    {"ARDA", 26}, {"ARST", 26}, {"ATSI", 26}, {"BLEQ", 26}, {"CANO", 26}, {"CHFA", 26},
+    {"DASW", 26}, {"DDIR", 26}, {"DDON", 26}, {"DEWA", 26}, {"DIMA", 26}, {"DINI", 26},
+    {"DITW", 26}, {"DRIG", 26}, {"DSAL", 26}, {"DTIM", 26}, {"EAFI", 26}, {"EALR", 26},
+    {"EAPR", 26}, {"EBUB", 26}, {"EBYM", 26}, {"ECTY", 26}, {"EDIL", 26}, {"EEFO", 26},
+    {"EESC", 26}, {"EETO", 26}, {"EHER", 26}, {"EIGN", 26}, {"EIRM", 26}, {"EISE", 26},
+    {"ELLE", 26}, {"ELYI", 26}, {"EMAL", 26}, {"EMON", 26}, {"EMSA", 26}, {"ENSW", 26},
+    {"EPES", 26}, {"ERLE", 26}, {"ERNT", 26}, {"ERUL", 26}, {"ESTF", 26}, {"ETEL", 26},
+    {"FABO", 26}, {"FAUT", 26}, {"FERA", 26}, {"FERM", 26}, {"FLOW", 26}, {"GECO", 26},
+    {"GEOR", 26}, {"GINI", 26}, {"GOVE", 26}, {"GSIN", 26}, {"HATN", 26}, {"HCHA", 26},
+    {"HESQ", 26}, {"HTSU", 26}, {"ICKE", 26}, {"IDUA", 26}, {"IESC", 26}, {"IFCO", 26},
+    {"IGIT", 26}, {"ILEP", 26}, {"IMCA", 26}, {"ITDI", 26}, {"ITFR", 26}, {"ITHB", 26},
+    {"ITSL", 26}, {"IUMA", 26}, {"IZON", 26}, {"KEYB", 26}, {"KNIF", 26}, {"LARA", 26},
+    {"LAYS", 26}, {"LCOD", 26}, {"LDSA", 26}, {"LETW", 26}, {"LLWI", 26}, {"MDIS", 26},
+    {"MESP", 26}, {"MIXE", 26}, {"MIXI", 26}, {"MPER", 26}, {"NCHT", 26}, {"NCOU", 26},
+    {"NDEP", 26}, {"NDPE", 26}, {"NEMA", 26}, {"NEMO", 26}, {"NEOU", 26}, {"NESB", 26},
+    {"NGCT", 26}, {"NGPO", 26}, {"NGSB", 26}, {"NGWA", 26}, {"NHOW", 26}, {"NIFI", 26},
+    {"NONL", 26}, {"NTIE", 26}, {"NTMO", 26}, {"NTOC", 26}, {"NTOG", 26}, {"NTSF", 26},
+    {"NUME", 26}, {"NYIN", 26}, {"NYMO", 26}, {"OBAR", 26}, {"ODEM", 26}, {"OFEV", 26},
+    {"OITA", 26}, {"OKEE", 26}, {"OONA", 26}, {"ORBO", 26}, {"ORLO", 26}, {"OTEL", 26},
+    {"OUPS", 26}, {"OVEI", 26}, {"OWCO", 26}, {"OWFR", 26}, {"PAKE", 26}, {"PERO", 26},
+    {"PMEN", 26}, {"PONE", 26}, {"PYOU", 26}, {"QUIS", 26}, {"QUIV", 26}, {"RALB", 26},
+    {"RAME", 26}, {"RCED", 26}, {"RCEO", 26}, {"RDEG", 26}, {"REFA", 26}, {"REMU", 26},
+    {"RHOW", 26}, {"RINP", 26}, {"RIOL", 26}, {"RIZO", 26}, {"RNOR", 26}, {"RPUB", 26},
+    {"RSIF", 26}, {"RSIT", 26}, {"RSPR", 26}, {"RTOS", 26}, {"RTSI", 26}, {"RYAS", 26},
+    {"SBAS", 26}, {"SCLE", 26}, {"SICO", 26}, {"SIER", 26}, {"SNAM", 26}, {"SNTW", 26},
+    {"SOFN", 26}, {"SPLU", 26}, {"SREL", 26}, {"STAS", 26}, {"STSA", 26}, {"STYP", 26},
+    {"TAGE", 26}, {"TALT", 26}, {"TARG", 26}, {"TCLA", 26}, {"TDEF", 26}, {"TEDD", 26},
+    {"TEDH", 26}, {"TESU", 26}, {"TEWI", 26}, {"TFUN", 26}, {"TIMA", 26}, {"TOFG", 26},
+    {"TOOD", 26}, {"TOOT", 26}, {"TOPS", 26}, {"TORF", 26}, {"TRIO", 26}, {"TRLO", 26},
+    {"TSAS", 26}, {"TSWE", 26}, {"TYDI", 26}, {"UCHB", 26}, {"UEIN", 26}, {"UIVA", 26},
+    {"UNIT", 26}, {"UNSH", 26}, {"UORS", 26}, {"USTT", 26}, {"UTAS", 26}, {"UTEO", 26},
+    {"UTMA", 26}, {"UTOT", 26}, {"VEDA", 26}, {"VESS", 26}, {"VIDU", 26}, {"WASO", 26},
+    {"WAYO", 26}, {"WLIN", 26}, {"WOPR", 26}, {"WWHE", 26}, {"WWHI", 26}, {"YFIN", 26},
+    {"YOFS", 26}, {"YPAT", 26}, {"YPUB", 26}, {"YRAY", 26}, {"YSMA", 26}, {"YTER", 26},
+    {"YVER", 26}, {"ZATI", 26}, {"ZERO", 26}, {"ABSO", 25}, {"ABUF", 25}, {"ACHL", 25},
+    {"ACKN", 25}, {"ADES", 25}, {"AFFE", 25}, {"AGEM", 25}, {"AGEN", 25}, {"AGNI", 25},
+    {"AKEV", 25}, {"ALWI", 25}, {"ANPA", 25}, {"ASEP", 25}, {"ATTI", 25}, {"AYYO", 25},
+    {"BEAN", 25}, {"BEAS", 25}, {"BENO", 25}, {"BITE", 25}, {"BUFN", 25}, {"BYVI", 25},
+    {"CALB", 25}, {"CALI", 25}, {"CHDE", 25}, {"CIPL", 25}, {"CRYP", 25}, {"CTSA", 25},
+    {"CURE", 25}, {"CUST", 25}, {"DBYI", 25}, {"DECR", 25}, {"DEDW", 25}, {"DFOU", 25},
+    {"DIGI", 25}, {"DSAR", 25}, {"DSHA", 25}, {"DSHO", 25}, {"EARW", 25}, {"EAVI", 25},
+    {"ECKT", 25}, {"EDAP", 25}, {"EENW", 25}, {"EEPT", 25}, {"EETF", 25}, {"EEXI", 25},
+    {"EHEI", 25}, {"EICO", 25}, {"ELFT", 25}, {"ELIM", 25}, {"ELIQ", 25}, {"ENBE", 25},
+    {"ENDD", 25}, {"EOFP", 25}, {"EORC", 25}, {"EPHN", 25}, {"EROP", 25}, {"ESAI", 25},
+    {"ESCT", 25}, {"ETRI", 25}, {"EUNU", 25}, {"EXCI", 25}, {"FANE", 25}, {"FITW", 25},
+    {"FOOB", 25}, {"GELS", 25}, {"GEON", 25}, {"GHER", 25}, {"GSTO", 25}, {"HEDR", 25},
+    {"HEEM", 25}, {"HENR", 25}, {"HEPI", 25}, {"HINC", 25}, {"HMAN", 25}, {"HPAS", 25},
+    {"HTWI", 25}, {"HWIL", 25}, {"IALS", 25}, {"ICAN", 25}, {"ICHY", 25}, {"ICIN", 25},
+    {"ICTU", 25}, {"INCA", 25}, {"INSW", 25}, {"IONG", 25}, {"IPLA", 25}, {"ISEC", 25},
+    {"ISEM", 25}, {"ISTW", 25}, {"ITNE", 25}, {"ITSW", 25}, {"KEYO", 25}, {"KINA", 25},
+    {"LAWS", 25}, {"LBER", 25}, {"LESP", 25}, {"LETX", 25}, {"LFOL", 25}, {"LOTO", 25},
+    {"LOWL", 25}, {"LPFI", 25}, {"LSUP", 25}, {"LYLI", 25}, {"MATH", 25}, {"MMIN", 25},
+    {"MSAR", 25}, {"MSOR", 25}, {"NACI", 25}, {"NALO", 25}, {"NAWA", 25}, {"NDBA", 25},
+    {"NDCL", 25}, {"NERV", 25}, {"NESC", 25}, {"NESU", 25}, {"NEUS", 25}, {"NGDE", 25},
+    {"NGFU", 25}, {"NOFL", 25}, {"NSAB", 25}, {"NTAP", 25}, {"OBED", 25}, {"OFDE", 25},
+    {"OFDI", 25}, {"OFIR", 25}, {"OGOT", 25}, {"OMWH", 25}, {"ONCL", 25}, {"ONMU", 25},
+    {"ORBE", 25}, {"ORDC", 25}, {"ORGA", 25}, {"OUFO", 25}, {"OWIS", 25}, {"OWSA", 25},
+    {"PATC", 25}, {"PLUS", 25}, {"RDLI", 25}, {"RDSB", 25}, {"REDH", 25}, {"RFIR", 25},
+    {"RFUN", 25}, {"RINF", 25}, {"RLIE", 25}, {"ROPS", 25}, {"RPUR", 25}, {"RREA", 25},
+    {"RSHI", 25}, {"RSTB", 25}, {"RSTM", 25}, {"RSYS", 25}, {"RTUN", 25}, {"RYPT", 25},
+    {"SAWH", 25}, {"SCAU", 25}, {"SEAT", 25}, {"SERP", 25}, {"SETR", 25}, {"SISM", 25},
+    {"SLYA", 25}, {"SOBS", 25}, {"SORP", 25}, {"SSAT", 25}, {"SSWI", 25}, {"STUS", 25},
+    {"SYTR", 25}, {"TABT", 25}, {"TAXI", 25}, {"TERH", 25}, {"TGRO", 25}, {"THFO", 25},
+    {"THMA", 25}, {"THSI", 25}, {"TITT", 25}, {"TLYW", 25}, {"TOKE", 25}, {"TOME", 25},
+    {"TORW", 25}, {"TROU", 25}, {"TSTE", 25}, {"TSTI", 25}, {"TYWH", 25}, {"UCHS", 25},
+    {"UGPL", 25}, {"ULDC", 25}, {"UMER", 25}, {"UMOF", 25}, {"UNMO", 25}, {"URFR", 25},
+    {"URPR", 25}, {"USEB", 25}, {"USLI", 25}, {"USTC", 25}, {"UTBY", 25}, {"UTST", 25},
+    {"VERO", 25}, {"WEAK", 25}, {"WERS", 25}, {"XCIT", 25}, {"XPLO", 25}, {"YDON", 25},
+    {"YEXI", 25}, {"YONT", 25}, {"YSEL", 25}, {"YSWI", 25}, {"YTOU", 25}, {"ABAN", 24},
+    {"ACTA", 24}, {"ADDR", 24}, {"AGIV", 24}, {"AILI", 24}, {"AIRO", 24}, {"ALBI", 24},
+    {"ALLV", 24}, {"ALOF", 24}, {"AMTO", 24}, {"ARDE", 24}, {"ARIL", 24}, {"ARKL", 24},
+    {"ASEI", 24}, {"ATAD", 24}, {"ATOT", 24}, {"ATTO", 24}, {"AYAL", 24}, {"AYSU", 24},
+    {"BARA", 24}, {"BEUN", 24}, {"BITA", 24}, {"BLEN", 24}, {"CAPE", 24}, {"CHAC", 24},
+    {"CHSH", 24}, {"CKER", 24}, {"CONN", 24}, {"CURY", 24}, {"DCTR", 24}, {"DDAR", 24},
+    {"DDRE", 24}, {"DEAL", 24}, {"DEMO", 24}, {"DERC", 24}, {"DINW", 24}, {"DMAN", 24},
+    {"DOPE", 24}, {"DORI", 24}, {"DUSI", 24}, {"EAKI", 24}, {"EATD", 24}, {"EELI", 24},
+    {"EELS", 24}, {"EENY", 24}, {"EEPA", 24}, {"EIFI", 24}, {"ENCR", 24}, {"ENDW", 24},
+    {"EOPP", 24}, {"EORB", 24}, {"EPIN", 24}, {"ERAG", 24}, {"ERTS", 24}, {"ESED", 24},
+    {"ESHI", 24}, {"ESME", 24}, {"ESTP", 24}, {"ETME", 24}, {"ETST", 24}, {"EUPO", 24},
+    {"FOOT", 24}, {"FULW", 24}, {"FWAR", 24}, {"GEAS", 24}, {"GETL", 24}, {"GETR", 24},
+    {"GHIT", 24}, {"GINV", 24}, {"GITI", 24}, {"GMOD", 24}, {"GSFI", 24}, {"GUOU", 24},
+    {"HANE", 24}, {"HENP", 24}, {"HILO", 24}, {"HISU", 24}, {"HUSE", 24}, {"HYSI", 24},
+    {"IALP", 24}, {"IEDA", 24}, {"IESY", 24}, {"IGUO", 24}, {"ILOS", 24}, {"IMEF", 24},
+    {"IMON", 24}, {"IMPE", 24}, {"INEH", 24}, {"INEP", 24}, {"INFL", 24}, {"INSC", 24},
+    {"ISEI", 24}, {"ISEO", 24}, {"ISNT", 24}, {"ITIF", 24}, {"ITUS", 24}, {"IZET", 24},
+    {"KESY", 24}, {"LBED", 24}, {"LDAN", 24}, {"LEUN", 24}, {"LIER", 24}, {"LLNE", 24},
+    {"LLOV", 24}, {"LLYB", 24}, {"LLYE", 24}, {"LOBE", 24}, {"LOSO", 24}, {"LOWR", 24},
+    {"LPLU", 24}, {"LPOS", 24}, {"LTTO", 24}, {"LUEG", 24}, {"LYWO", 24}, {"MAPF", 24},
+    {"MEVI", 24}, {"MEWA", 24}, {"MPLY", 24}, {"MTOB", 24}, {"NASA", 24}, {"NAUT", 24},
+    {"NBEA", 24}, {"NCEL", 24}, {"NDCT", 24}, {"NDFU", 24}, {"NDLA", 24}, {"NDME", 24},
+    {"NDPO", 24}, {"NEBY", 24}, {"NEDF", 24}, {"NEIF", 24}, {"NEWE", 24}, {"NGEW", 24},
+    {"NGPA", 24}, {"NLYB", 24}, {"NMOR", 24}, {"NNEC", 24}, {"NOMO", 24}, {"NOPE", 24},
+    {"NREA", 24}, {"NRED", 24}, {"NREP", 24}, {"NSRE", 24}, {"NTSW", 24}, {"NTYF", 24},
+    {"NUGP", 24}, {"NVIE", 24}, {"OFUN", 24}, {"OIST", 24}, {"OKTH", 24}, {"OLLB", 24},
+    {"OMEI", 24}, {"ONAT", 24}, {"ONDC", 24}, {"ONDL", 24}, {"ONGS", 24}, {"ONHA", 24},
+    {"ONWA", 24}, {"ONWE", 24}, {"OPAK", 24}, {"OPTH", 24}, {"ORAM", 24}, {"OREY", 24},
+    {"ORKC", 24}, {"OSEM", 24}, {"OSOP", 24}, {"OUEX", 24}, {"OVIM", 24}, {"OWHA", 24},
+    {"OWOF", 24}, {"PDAT", 24}, {"PHIL", 24}, {"PHYS", 24}, {"PSTO", 24}, {"PTIS", 24},
+    {"PWIT", 24}, {"RASH", 24}, {"RCHC", 24}, {"RCOR", 24}, {"RDEF", 24}, {"REDG", 24},
+    {"REDP", 24}, {"REPO", 24}, {"REPU", 24}, {"RIGG", 24}, {"RILY", 24}, {"RIST", 24},
+    {"RMIX", 24}, {"RSCR", 24}, {"RSEM", 24}, {"RSUS", 24}, {"RVAR", 24}, {"RYGE", 24},
+    {"SARG", 24}, {"SATE", 24}, {"SAXI", 24}, {"SEBO", 24}, {"SEFI", 24}, {"SEOB", 24},
+    {"SESB", 24}, {"SETB", 24}, {"SINI", 24}, {"SISU", 24}, {"SLET", 24}, {"SNEW", 24},
+    {"SOFV", 24}, {"SOPH", 24}, {"SORM", 24}, {"SSUR", 24}, {"STIS", 24}, {"TADI", 24},
+    {"TAFI", 24}, {"TAGR", 24}, {"TAPR", 24}, {"TASI", 24}, {"TASP", 24}, {"TATA", 24},
+    {"TAXC", 24}, {"TDOW", 24}, {"TEFI", 24}, {"THYO", 24}, {"TIMO", 24}, {"TISD", 24},
+    {"TLEN", 24}, {"TMAN", 24}, {"TMEN", 24}, {"TOCA", 24}, {"TOFP", 24}, {"TOFU", 24},
+    {"TOHI", 24}, {"TREG", 24}, {"TSFI", 24}, {"TSGR", 24}, {"TSMO", 24}, {"TTUR", 24},
+    {"TWHO", 24}, {"TWOI", 24}, {"TXTA", 24}, {"TXTI", 24}, {"UATE", 24}, {"UCHO", 24},
+    {"UCOM", 24}, {"UFOR", 24}, {"UNIN", 24}, {"UNTH", 24}, {"URSF", 24}, {"UTOL", 24},
+    {"VEAT", 24}, {"VEDF", 24}, {"VISE", 24}, {"VOLU", 24}, {"WEDT", 24}, {"YAFT", 24},
+    {"YIND", 24}, {"YLIT", 24}, {"YMOV", 24}, {"YSIC", 24}, {"YSUP", 24}, {"YTEX", 24},
+    {"YTWO", 24}, {"YUND", 24}, {"ABOR", 23}, {"ACRO", 23}, {"ADEM", 23}, {"ADIC", 23},
+    {"AFEE", 23}, {"AGIT", 23}, {"AKEF", 23}, {"ALAT", 23}, {"ALVE", 23}, {"AMSO", 23},
+    {"ANAD", 23}, {"ANYV", 23}, {"ARRE", 23}, {"ASAT", 23}, {"ASIF", 23}, {"ASYR", 23},
+    {"ATEY", 23}, {"BEND", 23}, {"BEON", 23}, {"BLEE", 23}, {"BOUN", 23}, {"BSOL", 23},
+    {"BYBE", 23}, {"BYME", 23}, {"BYSU", 23}, {"CALP", 23}, {"CEDT", 23}, {"CHFI", 23},
+    {"CKNO", 23}, {"CTLI", 23}, {"CTMO", 23}, {"DAYS", 23}, {"DBYM", 23}, {"DCRY", 23},
+    {"DEIF", 23}, {"DEXC", 23}, {"DGLA", 23}, {"DNEX", 23}, {"DREP", 23}, {"DSYO", 23},
+    {"DTOL", 23}, {"DTOU", 23}, {"DTRA", 23}, {"EDSU", 23}, {"EDUS", 23}, {"EEAS", 23},
+    {"EIFA", 23}, {"EIRL", 23}, {"EISD", 23}, {"ELEG", 23}, {"ELYU", 23}, {"EMSW", 23},
+    {"ENAC", 23}, {"EOLD", 23}, {"EORE", 23}, {"EPAI", 23}, {"ERAD", 23}, {"ERAF", 23},
+    {"ERDA", 23}, {"ERWR", 23}, {"ERYD", 23}, {"ERYU", 23}, {"ESIR", 23}, {"ESSL", 23},
+    {"ESUF", 23}, {"ESWO", 23}, {"ETCH", 23}, {"ETLO", 23}, {"ETNO", 23}, {"ETON", 23},
+    {"ETTY", 23}, {"EXTU", 23}, {"EYAC", 23}, {"EYBO", 23}, {"EYTO", 23}, {"FCHA", 23},
+    {"FGRE", 23}, {"FONT", 23}, {"GARE", 23}, {"GEVI", 23}, {"GLEC", 23}, {"GLEL", 23},
+    {"GLEW", 23}, {"HANN", 23}, {"HANW", 23}, {"HARI", 23}, {"HEFL", 23}, {"HEUP", 23},
+    {"HITA", 23}, {"HITH", 23}, {"HTER", 23}, {"HTSI", 23}, {"ICEA", 23}, {"ICEW", 23},
+    {"ICHO", 23}, {"IDON", 23}, {"IENC", 23}, {"IESR", 23}, {"IFNO", 23}, {"IKEL", 23},
+    {"ILLP", 23}, {"ILYO", 23}, {"IMWH", 23}, {"INAW", 23}, {"INEQ", 23}, {"INFU", 23},
+    {"INTT", 23}, {"IPTA", 23}, {"ISLA", 23}, {"ISSP", 23}, {"ISYO", 23}, {"ITBY", 23},
+    {"ITHP", 23}, {"ITMO", 23}, {"ITOU", 23}, {"KEDE", 23}, {"KEFI", 23}, {"LBEE", 23},
+    {"LBIN", 23}, {"LECA", 23}, {"LIAN", 23}, {"LIFY", 23}, {"LITA", 23}, {"LLAU", 23},
+    {"LLDO", 23}, {"LLEN", 23}, {"LOSS", 23}, {"LRIG", 23}, {"LSCR", 23}, {"LYEX", 23},
+    {"LYMO", 23}, {"MALS", 23}, {"MAPA", 23}, {"MEEX", 23}, {"MOTE", 23}, {"NANG", 23},
+    {"NASS", 23}, {"NCRY", 23}, {"NDEI", 23}, {"NDHA", 23}, {"NDNA", 23}, {"NDUP", 23},
+    {"NDWO", 23}, {"NEAS", 23}, {"NEWP", 23}, {"NGBO", 23}, {"NGLA", 23}, {"NGOT", 23},
+    {"NGPL", 23}, {"NMAD", 23}, {"NNEL", 23}, {"NOBJ", 23}, {"NOTN", 23}, {"NRUN", 23},
+    {"NSSE", 23}, {"NSSO", 23}, {"NTCL", 23}, {"NTSS", 23}, {"NUET", 23}, {"NYDI", 23},
+    {"NYEL", 23}, {"NYPO", 23}, {"NYRE", 23}, {"ODYA", 23}, {"OFAU", 23}, {"OLDL", 23},
+    {"OMED", 23}, {"OMEL", 23}, {"ONBO", 23}, {"ONDF", 23}, {"OOBA", 23}, {"ORTC", 23},
+    {"ORYS", 23}, {"OTHR", 23}, {"OTPR", 23}, {"OULI", 23}, {"OUTD", 23}, {"OWBE", 23},
+    {"OWRE", 23}, {"PLEF", 23}, {"RASA", 23}, {"RBEC", 23}, {"RCIR", 23}, {"RCOU", 23},
+    {"RDSE", 23}, {"REDV", 23}, {"RELY", 23}, {"REMI", 23}, {"RETI", 23}, {"RETT", 23},
+    {"REVO", 23}, {"RGAN", 23}, {"RKIS", 23}, {"RREM", 23}, {"RTAR", 23}, {"RTOE", 23},
+    {"RUMS", 23}, {"RUPO", 23}, {"RVET", 23}, {"SBYA", 23}, {"SDEP", 23}, {"SEED", 23},
+    {"SESH", 23}, {"SETN", 23}, {"SEXE", 23}, {"SFUN", 23}, {"SHAP", 23}, {"SINO", 23},
+    {"SIRE", 23}, {"SITO", 23}, {"SRAY", 23}, {"SSCR", 23}, {"SSIG", 23}, {"STCA", 23},
+    {"SYRE", 23}, {"TCHF", 23}, {"TDEL", 23}, {"TEDV", 23}, {"TEPS", 23}, {"TEWA", 23},
+    {"THAB", 23}, {"THME", 23}, {"THOP", 23}, {"THOW", 23}, {"THST", 23}, {"TICO", 23},
+    {"TINP", 23}, {"TISV", 23}, {"TKNO", 23}, {"TMES", 23}, {"TNEE", 23}, {"TORM", 23},
+    {"TSON", 23}, {"TSOT", 23}, {"TSST", 23}, {"UCEA", 23}, {"ULDM", 23}, {"ULDT", 23},
+    {"UNIQ", 23}, {"UNLI", 23}, {"UPDA", 23}, {"URSC", 23}, {"USTM", 23}, {"USTP", 23},
+    {"UTUR", 23}, {"VELI", 23}, {"VEMA", 23}, {"VICE", 23}, {"WAYY", 23}, {"WERC", 23},
+    {"WEWI", 23}, {"WMOR", 23}, {"WNTH", 23}, {"WOCO", 23}, {"WORT", 23}, {"WOTH", 23},
+    {"XCEE", 23}, {"XPLI", 23}, {"XTHA", 23}, {"XTHI", 23}, {"XTOB", 23}, {"YASI", 23},
+    {"YBOA", 23}, {"YEVE", 23}, {"YORI", 23}, {"YOUB", 23}, {"YSCO", 23}, {"YSEN", 23},
+    {"YTOA", 23}, {"YTOB", 23}, {"YTOP", 23}, {"ADIL", 22}, {"AINW", 22}, {"ALES", 22},
+    {"ALFW", 22}, {"ALWO", 22}, {"AMEV", 22}, {"ANAB", 22}, {"ANAM", 22}, {"ANAS", 22},
+    {"ANEM", 22}, {"ANSI", 22}, {"ARMO", 22}, {"ARNI", 22}, {"AROF", 22}, {"ARSE", 22},
+    {"ASAD", 22}, {"ATBO", 22}, {"ATGR", 22}, {"AXRE", 22}, {"AYAD", 22}, {"BENT", 22},
+    {"BLEV", 22}, {"BORD", 22}, {"BRAC", 22}, {"BRIN", 22}, {"BTAI", 22}, {"BUTF", 22},
+    {"BYAL", 22}, {"BYSE", 22}, {"CATT", 22}, {"CHAT", 22}, {"CHNO", 22}, {"CKWH", 22},
+    {"CLAS", 22}, {"DANA", 22}, {"DBEL", 22}, {"DBYY", 22}, {"DEAT", 22}, {"DEAV", 22},
+    {"DFAL", 22}, {"DINV", 22}, {"DNUM", 22}, {"DOWF", 22}, {"DUNI", 22}, {"DVIS", 22},
+    {"DYAN", 22}, {"EAPA", 22}, {"EASF", 22}, {"EAWA", 22}, {"ECAR", 22}, {"EDAG", 22},
+    {"EDYE", 22}, {"EENL", 22}, {"EFAI", 22}, {"EGAN", 22}, {"EINP", 22}, {"EIRT", 22},
+    {"ELPS", 22}, {"EMAC", 22}, {"EMAS", 22}, {"ENAL", 22}, {"ENDF", 22}, {"ENSU", 22},
+    {"ENUT", 22}, {"ENYE", 22}, {"ERHE", 22}, {"ERHO", 22}, {"ERLO", 22}, {"ERYE", 22},
+    {"ESDE", 22}, {"ESIX", 22}, {"FCOP", 22}, {"FFRE", 22}, {"FOPT", 22}, {"FREA", 22},
+    {"FUTU", 22}, {"GANG", 22}, {"GLYA", 22}, {"GORR", 22}, {"GRAD", 22}, {"GSPE", 22},
+    {"GTAB", 22}, {"GTYP", 22}, {"HCAS", 22}, {"HEOL", 22}, {"HFRO", 22}, {"HLIN", 22},
+    {"HSOM", 22}, {"HTOR", 22}, {"ICEF", 22}, {"IGHE", 22}, {"IGNI", 22}, {"IGOA", 22},
+    {"IMAT", 22}, {"IMRE", 22}, {"IMST", 22}, {"INVE", 22}, {"IPTN", 22}, {"ISGI", 22},
+    {"ISLE", 22}, {"ISPU", 22}, {"ITHN", 22}, {"ITHU", 22}, {"ITHY", 22}, {"ITTI", 22},
+    {"ITYF", 22}, {"IUMT", 22}, {"KCHA", 22}, {"KEAC", 22}, {"KWHI", 22}, {"LDCO", 22},
+    {"LEEN", 22}, {"LERS", 22}, {"LIFT", 22}, {"LLEA", 22}, {"LLLI", 22}, {"LOOP", 22},
+    {"LOST", 22}, {"LPLA", 22}, {"LSAN", 22}, {"LYAT", 22}, {"MACR", 22}, {"MASS", 22},
+    {"MAYI", 22}, {"MEOR", 22}, {"MUNI", 22}, {"NAFT", 22}, {"NALA", 22}, {"NALF", 22},
+    {"NALV", 22}, {"NDAG", 22}, {"NDIM", 22}, {"NDLO", 22}, {"NECA", 22}, {"NEDL", 22},
+    {"NEHA", 22}, {"NEWO", 22}, {"NGEY", 22}, {"NGSC", 22}, {"NGWO", 22}, {"NIQU", 22},
+    {"NISN", 22}, {"NNOR", 22}, {"NNOW", 22}, {"NSIO", 22}, {"NTPA", 22}, {"NTTU", 22},
+    {"NTVE", 22}, {"OAFI", 22}, {"OBEM", 22}, {"OBEP", 22}, {"OBTA", 22}, {"OEND", 22},
+    {"OFOP", 22}, {"OKED", 22}, {"OLDT", 22}, {"OMAP", 22}, {"ONSD", 22}, {"OOKO", 22},
+    {"ORKL", 22}, {"ORKY", 22}, {"ORMT", 22}, {"ORNI", 22}, {"ORRI", 22}, {"ORYN", 22},
+    {"OTED", 22}, {"OTHS", 22}, {"OTSU", 22}, {"OTXT", 22}, {"OUWE", 22}, {"OVEC", 22},
+    {"OVEF", 22}, {"OWMO", 22}, {"OYAL", 22}, {"PINT", 22}, {"PTFO", 22}, {"RABO", 22},
+    {"RBYA", 22}, {"RCUL", 22}, {"RDCO", 22}, {"RDON", 22}, {"REAG", 22}, {"REGO", 22},
+    {"RESH", 22}, {"RHER", 22}, {"RKME", 22}, {"RKYO", 22}, {"RMAY", 22}, {"ROFF", 22},
+    {"ROKE", 22}, {"ROOM", 22}, {"RORC", 22}, {"RORO", 22}, {"ROYA", 22}, {"RSAT", 22},
+    {"RSIS", 22}, {"RSLE", 22}, {"RSNO", 22}, {"RSOT", 22}, {"RSTF", 22}, {"RTAB", 22},
+    {"RTCO", 22}, {"RTOB", 22}, {"RTOI", 22}, {"RVIE", 22}, {"RYYO", 22}, {"SCUR", 22},
+    {"SEDS", 22}, {"SEMO", 22}, {"SENE", 22}, {"SHUT", 22}, {"SISE", 22}, {"SISS", 22},
+    {"SITC", 22}, {"SMSA", 22}, {"SMTO", 22}, {"SOFY", 22}, {"SSIT", 22}, {"STAG", 22},
+    {"STBO", 22}, {"STBY", 22}, {"SUNI", 22}, {"SUNL", 22}, {"TANI", 22}, {"TAXR", 22},
+    {"TBOO", 22}, {"TCHW", 22}, {"TIGU", 22}, {"TISW", 22}, {"TLEF", 22}, {"TLYF", 22},
+    {"TOAB", 22}, {"TOAT", 22}, {"TODA", 22}, {"TOLE", 22}, {"TSAP", 22}, {"TSPL", 22},
+    {"TSSU", 22}, {"TWOB", 22}, {"TWOM", 22}, {"TYCO", 22}, {"TYEL", 22}, {"TYWI", 22},
+    {"UEGR", 22}, {"UEMA", 22}, {"UNDW", 22}, {"UNFO", 22}, {"UNMA", 22}, {"URSP", 22},
+    {"USPE", 22}, {"UTRE", 22}, {"UWER", 22}, {"VESY", 22}, {"VEYT", 22}, {"VIMB", 22},
+    {"WARN", 22}, {"WASE", 22}, {"WEAR", 22}, {"WIFT", 22}, {"WOFT", 22}, {"WOLI", 22},
+    {"WSOF", 22}, {"YBOD", 22}, {"YLOO", 22}, {"YVAR", 22}, {"ACTT", 21}, {"AFAI", 21},
+    {"ALIK", 21}, {"ALPO", 21}, {"ALTY", 21}, {"AMIX", 21}, {"AMME", 21}, {"AMSA", 21},
+    {"ANDQ", 21}, {"ANEO", 21}, {"ARTB", 21}, {"ASHI", 21}, {"ATHT", 21}, {"ATME", 21},
+    {"ATPL", 21}, {"BALP", 21}, {"BEAC", 21}, {"BEAT", 21}, {"BECH", 21}, {"BTHE", 21},
+    {"BYUS", 21}, {"CIMA", 21}, {"CKFO", 21}, {"CKWI", 21}, {"DASE", 21}, {"DEAC", 21},
+    {"DEUS", 21}, {"DFIN", 21}, {"DITC", 21}, {"DMAY", 21}, {"DOAN", 21}, {"DPAT", 21},
+    {"DREC", 21}, {"DSEC", 21}, {"DSOR", 21}, {"DSPE", 21}, {"DSTI", 21}, {"DWAR", 21},
+    {"EAGG", 21}, {"EASP", 21}, {"EDDE", 21}, {"EDHI", 21}, {"EDSI", 21}, {"EECO", 21},
+    {"EEDA", 21}, {"EINW", 21}, {"EISM", 21}, {"EITB", 21}, {"ELIT", 21}, {"ELLW", 21},
+    {"ELYF", 21}, {"ELYW", 21}, {"EMPL", 21}, {"ENCL", 21}, {"ENIE", 21}, {"ENIS", 21},
+    {"ENWI", 21}, {"EOFV", 21}, {"EONA", 21}, {"ERER", 21}, {"ERGL", 21}, {"ERSN", 21},
+    {"ERYM", 21}, {"ESAP", 21}, {"ESTN", 21}, {"ESUM", 21}, {"ETFI", 21}, {"ETOY", 21},
+    {"EUNL", 21}, {"EUPP", 21}, {"EWIS", 21}, {"EWPR", 21}, {"EXPO", 21}, {"EYEW", 21},
+    {"GEDW", 21}, {"GENO", 21}, {"GESU", 21}, {"GESY", 21}, {"GFUN", 21}, {"GNIF", 21},
+    {"GNOT", 21}, {"GROS", 21}, {"GSTR", 21}, {"GWOR", 21}, {"HANC", 21}, {"HERH", 21},
+    {"HESM", 21}, {"HEWE", 21}, {"HEYS", 21}, {"HINK", 21}, {"HSOF", 21}, {"HTIM", 21},
+    {"HTML", 21}, {"HTWO", 21}, {"ICEP", 21}, {"ICKA", 21}, {"IEWW", 21}, {"IFAS", 21},
+    {"ILEH", 21}, {"IMFO", 21}, {"INAB", 21}, {"INNA", 21}, {"IPAL", 21}, {"IPTO", 21},
+    {"IRSI", 21}, {"IRWA", 21}, {"ISSA", 21}, {"ISTU", 21}, {"ITEF", 21}, {"ITIT", 21},
+    {"ITSM", 21}, {"IVEF", 21}, {"IVIN", 21}, {"JACE", 21}, {"KCOL", 21}, {"KSFO", 21},
+    {"LAYA", 21}, {"LDLE", 21}, {"LEGI", 21}, {"LFAN", 21}, {"LLBO", 21}, {"LSTA", 21},
+    {"LSTT", 21}, {"LYAV", 21}, {"MAGI", 21}, {"MAYM", 21}, {"MAYR", 21}, {"MONG", 21},
+    {"MPON", 21}, {"MSUC", 21}, {"NACT", 21}, {"NARR", 21}, {"NDAM", 21}, {"NDBO", 21},
+    {"NDOP", 21}, {"NDTW", 21}, {"NDVA", 21}, {"NDWR", 21}, {"NENO", 21}, {"NENU", 21},
+    {"NEPA", 21}, {"NESD", 21}, {"NESF", 21}, {"NGGL", 21}, {"NGMI", 21}, {"NIZA", 21},
+    {"NLYC", 21}, {"NOMA", 21}, {"NOWB", 21}, {"NQUI", 21}, {"NSFR", 21}, {"NSIF", 21},
+    {"NSNO", 21}, {"NSUS", 21}, {"NWAS", 21}, {"NYTI", 21}, {"OFPO", 21}, {"OKNO", 21},
+    {"ONEU", 21}, {"ONEV", 21}, {"ONGF", 21}, {"ONHE", 21}, {"ONSN", 21}, {"OORT", 21},
+    {"OPAQ", 21}, {"ORAD", 21}, {"ORAU", 21}, {"ORHO", 21}, {"ORRA", 21}, {"ORSM", 21},
+    {"ORYW", 21}, {"OTFO", 21}, {"OTWH", 21}, {"OTWI", 21}, {"OUFI", 21}, {"OUOF", 21},
+    {"OUOR", 21}, {"OUTR", 21}, {"OVEB", 21}, {"OWFO", 21}, {"OWNA", 21}, {"OWON", 21},
+    {"OWSC", 21}, {"PAIR", 21}, {"PAQU", 21}, {"PEDE", 21}, {"PETU", 21}, {"PILA", 21},
+    {"POPT", 21}, {"RACK", 21}, {"RAMW", 21}, {"RAPO", 21}, {"RDED", 21}, {"RDWO", 21},
+    {"REEC", 21}, {"REWO", 21}, {"RHAL", 21}, {"RKFO", 21}, {"RKON", 21}, {"ROPI", 21},
+    {"RREP", 21}, {"RSCA", 21}, {"RSHO", 21}, {"RSPA", 21}, {"RTIT", 21}, {"RTRE", 21},
+    {"RUSI", 21}, {"RYIF", 21}, {"SAGR", 21}, {"SAWO", 21}, {"SAYI", 21}, {"SBEA", 21},
+    {"SITM", 21}, {"SIXF", 21}, {"SOLE", 21}, {"SPUT", 21}, {"SREG", 21}, {"SSCT", 21},
+    {"SSDI", 21}, {"SSOC", 21}, {"STAC", 21}, {"STTI", 21}, {"STUF", 21}, {"STWA", 21},
+    {"STYO", 21}, {"SYTO", 21}, {"TABA", 21}, {"TARY", 21}, {"TCRE", 21}, {"TDOT", 21},
+    {"TEMO", 21}, {"TEMW", 21}, {"THBE", 21}, {"TINO", 21}, {"TMAP", 21}, {"TMOT", 21},
+    {"TOKN", 21}, {"TONA", 21}, {"TRYI", 21}, {"TSEN", 21}, {"TSSE", 21}, {"TUFF", 21},
+    {"TUTI", 21}, {"TWOW", 21}, {"TXTW", 21}, {"UDEI", 21}, {"UFNE", 21}, {"UINS", 21},
+    {"ULTV", 21}, {"UMPS", 21}, {"UNAT", 21}, {"UPRE", 21}, {"URDL", 21}, {"URSY", 21},
+    {"URTE", 21}, {"USEN", 21}, {"USIV", 21}, {"USPA", 21}, {"USTD", 21}, {"UTEL", 21},
+    {"WEIG", 21}, {"WNER", 21}, {"XREG", 21}, {"XTSA", 21}, {"XTSO", 21}, {"YALS", 21},
+    {"YAVA", 21}, {"YBED", 21}, {"YEAN", 21}, {"YEDI", 21}, {"YETT", 21}, {"YFAL", 21},
+    {"YGRE", 21}, {"YLIG", 21}, {"YMOR", 21}, {"YNAM", 21}, {"YNOW", 21}, {"YOFF", 21},
+    {"YPEF", 21}, {"YPEV", 21}, {"YSAT", 21}, {"YTOD", 21}, {"YWOU", 21}, {"ACKE", 20},
+    {"AGEC", 20}, {"AGED", 20}, {"AILT", 20}, {"ALEX", 20}, {"ALIF", 20}, {"ALRI", 20},
+    {"AMMI", 20}, {"ANBY", 20}, {"ANPR", 20}, {"ARBY", 20}, {"ARON", 20}, {"ARSA", 20},
+    {"ARTU", 20}, {"ASDI", 20}, {"ASEL", 20}, {"ASMO", 20}, {"ATEB", 20}, {"ATOB", 20},
+    {"ATVE", 20}, {"BEGA", 20}, {"BENE", 20}, {"BEPA", 20}, {"BUTC", 20}, {"BUTM", 20},
+    {"BYLI", 20}, {"BYPU", 20}, {"CALC", 20}, {"CCON", 20}, {"CEFI", 20}, {"CIDP", 20},
+    {"CIND", 20}, {"CLAR", 20}, {"CLOU", 20}, {"CRAS", 20}, {"CTAT", 20}, {"CTSO", 20},
+    {"DANE", 20}, {"DBYV", 20}, {"DEFE", 20}, {"DERP", 20}, {"DFIR", 20}, {"DHOW", 20},
+    {"DIFA", 20}, {"DITF", 20}, {"DMAP", 20}, {"DMIN", 20}, {"DONA", 20}, {"DORM", 20},
+    {"DORT", 20}, {"DREG", 20}, {"DSIT", 20}, {"DTOO", 20}, {"EADS", 20}, {"EAKE", 20},
+    {"EBYR", 20}, {"ECIM", 20}, {"EDHA", 20}, {"EDHO", 20}, {"EDIC", 20}, {"EGAC", 20},
+    {"EGOI", 20}, {"EHOM", 20}, {"ELEV", 20}, {"EMFO", 20}, {"EMSO", 20}, {"EPIT", 20},
+    {"ERYB", 20}, {"ERYP", 20}, {"ESEW", 20}, {"ESIZ", 20}, {"ETPA", 20}, {"ETSA", 20},
+    {"EWAN", 20}, {"FINV", 20}, {"FITT", 20}, {"FNOT", 20}, {"FSIX", 20}, {"GEFR", 20},
+    {"GERE", 20}, {"GESC", 20}, {"GHAL", 20}, {"GHAN", 20}, {"GIFY", 20}, {"GOAN", 20},
+    {"HADI", 20}, {"HANS", 20}, {"HASN", 20}, {"HEBI", 20}, {"HEEF", 20}, {"HFAL", 20},
+    {"HINN", 20}, {"HMET", 20}, {"HTAS", 20}, {"IANC", 20}, {"IDNO", 20}, {"IEDF", 20},
+    {"IESS", 20}, {"IETA", 20}, {"IEVE", 20}, {"IHAD", 20}, {"ILEL", 20}, {"IMAD", 20},
+    {"INAM", 20}, {"INAV", 20}, {"INCS", 20}, {"INEV", 20}, {"INTF", 20}, {"IREA", 20},
+    {"ISMU", 20}, {"ISOP", 20}, {"ITHD", 20}, {"ITLI", 20}, {"ITLO", 20}, {"ITVI", 20},
+    {"IXFE", 20}, {"KERS", 20}, {"KMEA", 20}, {"KSPA", 20}, {"LAYI", 20}, {"LBUT", 20},
+    {"LDAL", 20}, {"LDIF", 20}, {"LDMA", 20}, {"LDST", 20}, {"LEAB", 20}, {"LETM", 20},
+    {"LEWA", 20}, {"LFUN", 20}, {"LLAF", 20}, {"LLCA", 20}, {"LLCH", 20}, {"LLLO", 20},
+    {"LLOP", 20}, {"LLPA", 20}, {"LLPO", 20}, {"LLUC", 20}, {"LORE", 20}, {"LOUD", 20},
+    {"LOWW", 20}, {"LPFO", 20}, {"LTIM", 20}, {"LVED", 20}, {"LWIN", 20}, {"LYAL", 20},
+    {"LYVI", 20}, {"MEBU", 20}, {"MEFR", 20}, {"MESL", 20}, {"MESR", 20}, {"MEWO", 20},
+    {"MPTI", 20}, {"NANA", 20}, {"NATA", 20}, {"NAWI", 20}, {"NBES", 20}, {"NDET", 20},
+    {"NDSM", 20}, {"NDTI", 20}, {"NGCA", 20}, {"NGEB", 20}, {"NGGR", 20}, {"NISS", 20},
+    {"NPUB", 20}, {"NSAC", 20}, {"NSBU", 20}, {"NSCR", 20}, {"NSDI", 20}, {"NSYN", 20},
+    {"NTAK", 20}, {"NTAR", 20}, {"NTHU", 20}, {"NTSH", 20}, {"NTUS", 20}, {"OCIA", 20},
+    {"OCKS", 20}, {"ODOF", 20}, {"ODOS", 20}, {"OFOL", 20}, {"OFVA", 20}, {"OFWO", 20},
+    {"OKLI", 20}, {"OKSL", 20}, {"OLEO", 20}, {"OLOO", 20}, {"ONHO", 20}, {"ONPE", 20},
+    {"ONSG", 20}, {"ONSR", 20}, {"OOKL", 20}, {"ORPA", 20}, {"OSMA", 20}, {"OSTD", 20},
+    {"OTSE", 20}, {"OUAD", 20}, {"OUPE", 20}, {"OUSS", 20}, {"OWNW", 20}, {"OWSS", 20},
+    {"PALE", 20}, {"PEDT", 20}, {"PETE", 20}, {"PITC", 20}, {"PSTH", 20}, {"PTAS", 20},
+    {"PTCO", 20}, {"PTFI", 20}, {"RALR", 20}, {"RANE", 20}, {"RBAC", 20}, {"RBYC", 20},
+    {"RCET", 20}, {"RCEV", 20}, {"RDEN", 20}, {"REDY", 20}, {"REEV", 20}, {"REOB", 20},
+    {"RERA", 20}, {"REVA", 20}, {"RISH", 20}, {"RISK", 20}, {"RITW", 20}, {"RKWH", 20},
+    {"RNAN", 20}, {"RORF", 20}, {"RORI", 20}, {"RORL", 20}, {"RPET", 20}, {"RRET", 20},
+    {"RROW", 20}, {"RSBY", 20}, {"RWER", 20}, {"RYUN", 20}, {"SALR", 20}, {"SBES", 20},
+    {"SDID", 20}, {"SDOC", 20}, {"SEBU", 20}, {"SECI", 20}, {"SELL", 20}, {"SEOP", 20},
+    {"SHAN", 20}, {"SHAS", 20}, {"SHTO", 20}, {"SIDA", 20}, {"SINL", 20}, {"SINW", 20},
+    {"SITT", 20}, {"SLOO", 20}, {"SMBE", 20}, {"SNTM", 20}, {"SOBY", 20}, {"SOCI", 20},
+    {"SSBY", 20}, {"STEL", 20}, {"STSC", 20}, {"STSI", 20}, {"TBEL", 20}, {"TBLU", 20},
+    {"TCAS", 20}, {"TCLE", 20}, {"TCUR", 20}, {"TERG", 20}, {"THPR", 20}, {"THSU", 20},
+    {"TITD", 20}, {"TITM", 20}, {"TLYR", 20}, {"TNEX", 20}, {"TOFN", 20}, {"TOTW", 20},
+    {"TRLA", 20}, {"TSAX", 20}, {"TSEX", 20}, {"TSPO", 20}, {"TTAC", 20}, {"TTOH", 20},
+    {"TWOA", 20}, {"TXTU", 20}, {"TYLI", 20}, {"ULDU", 20}, {"ULER", 20}, {"UNCH", 20},
+    {"UNDH", 20}, {"UPAN", 20}, {"URBE", 20}, {"VAND", 20}, {"VEDB", 20}, {"VEOF", 20},
+    {"VESU", 20}, {"VIMK", 20}, {"WASR", 20}, {"WVIM", 20}, {"XFEE", 20}, {"XFOR", 20},
+    {"XTCO", 20}, {"XTFR", 20}, {"XTMO", 20}, {"YBEP", 20}, {"YBYT", 20}, {"YETH", 20},
+    {"YINA", 20}, {"YMED", 20}, {"YNUM", 20}, {"YOBL", 20}, {"YORA", 20}, {"YORD", 20},
+    {"YPUT", 20}, {"YTOM", 20}, {"YTOR", 20}, {"YWAR", 20}, {"ZETH", 20}, {"ACKL", 19},
+    {"AGEY", 19}, {"AINL", 19}, {"AKED", 19}, {"ALUA", 19}, {"AMEG", 19}, {"ANED", 19},
+    {"ANHA", 19}, {"ANTL", 19}, {"ARKR", 19}, {"ARRO", 19}, {"ARTL", 19}, {"ARYB", 19},
+    {"ARYM", 19}, {"ARYP", 19}, {"ASAW", 19}, {"ASCE", 19}, {"ASTF", 19}, {"AUGR", 19},
+    {"AXMA", 19}, {"AYAT", 19}, {"BEEQ", 19}, {"BSTH", 19}, {"BYAC", 19}, {"BYAT", 19},
+    {"BYTY", 19}, {"CELE", 19}, {"CEMO", 19}, {"CEOU", 19}, {"CESE", 19}, {"CHEN", 19},
+    {"CHGR", 19}, {"CHSE", 19}, {"CLEW", 19}, {"COMI", 19}, {"COST", 19}, {"CTFO", 19},
+    {"CTIS", 19}, {"CTON", 19}, {"CTRO", 19}, {"CTSI", 19}, {"DAPA", 19}, {"DCHE", 19},
+    {"DCLO", 19}, {"DEBU", 19}, {"DESE", 19}, {"DHIS", 19}, {"DILY", 19}, {"DITD", 19},
+    {"DITM", 19}, {"DLOO", 19}, {"DMEN", 19}, {"DNEW", 19}, {"DORR", 19}, {"DPAP", 19},
+    {"DRIN", 19}, {"DSID", 19}, {"DSPA", 19}, {"DSUS", 19}, {"DTRY", 19}, {"DVIE", 19},
+    {"EAGR", 19}, {"EASW", 19}, {"ECER", 19}, {"EEAN", 19}, {"EEMT", 19}, {"EHOR", 19},
+    {"ELAR", 19}, {"ELYP", 19}, {"ENAO", 19}, {"ENBL", 19}, {"EPAC", 19}, {"ERCL", 19},
+    {"ERGR", 19}, {"ERLY", 19}, {"ERSD", 19}, {"ESCE", 19}, {"ESEO", 19}, {"ESSB", 19},
+    {"ETEE", 19}, {"ETSC", 19}, {"ETSO", 19}, {"ETTA", 19}, {"ETVI", 19}, {"EXTP", 19},
+    {"FATE", 19}, {"FERL", 19}, {"FERO", 19}, {"FFTH", 19}, {"FLAT", 19}, {"FMER", 19},
+    {"FNAM", 19}, {"FPAR", 19}, {"FRED", 19}, {"FVAR", 19}, {"GACY", 19}, {"GATH", 19},
+    {"GCOR", 19}, {"GEDO", 19}, {"GEOU", 19}, {"GESE", 19}, {"GLEA", 19}, {"GLET", 19},
+    {"GSBE", 19}, {"GSUC", 19}, {"GUPO", 19}, {"HEEL", 19}, {"HISY", 19}, {"HMEA", 19},
+    {"HTOT", 19}, {"HTPA", 19}, {"HTSG", 19}, {"HTSW", 19}, {"HWAT", 19}, {"ICKC", 19},
+    {"ICOM", 19}, {"ICRO", 19}, {"IEWE", 19}, {"IEWO", 19}, {"IGRE", 19}, {"IKEC", 19},
+    {"IKEF", 19}, {"INIM", 19}, {"INQU", 19}, {"INTQ", 19}, {"INTY", 19}, {"IORT", 19},
+    {"IPTL", 19}, {"IRFI", 19}, {"IRPR", 19}, {"IRWH", 19}, {"ISCR", 19}, {"ITYS", 19},
+    {"IVEM", 19}, {"KEYT", 19}, {"KSPO", 19}, {"LACI", 19}, {"LBEG", 19}, {"LBEU", 19},
+    {"LDUS", 19}, {"LEHA", 19}, {"LETC", 19}, {"LINS", 19}, {"LITW", 19}, {"LKEY", 19},
+    {"LLBY", 19}, {"LLME", 19}, {"LLWO", 19}, {"LMAT", 19}, {"LSUB", 19}, {"LTIT", 19},
+    {"LTOO", 19}, {"LUMW", 19}, {"LYST", 19}, {"MAYS", 19}, {"MBUT", 19}, {"METR", 19},
+    {"MICR", 19}, {"MMUN", 19}, {"MNUM", 19}, {"NABB", 19}, {"NAIR", 19}, {"NAMA", 19},
+    {"NAOF", 19}, {"NBLU", 19}, {"NCHI", 19}, {"NCHO", 19}, {"NDAD", 19}, {"NDBR", 19},
+    {"NDGO", 19}, {"NEBU", 19}, {"NEON", 19}, {"NEUN", 19}, {"NEWA", 19}, {"NFLE", 19},
+    {"NIEN", 19}, {"NIND", 19}, {"NLYS", 19}, {"NOCO", 19}, {"NOWU", 19}, {"NREM", 19},
+    {"NTSM", 19}, {"NTYD", 19}, {"NUMN", 19}, {"OABO", 19}, {"OACC", 19}, {"OBVI", 19},
+    {"ODEE", 19}, {"ODYI", 19}, {"ODYW", 19}, {"OFDA", 19}, {"OFHO", 19}, {"OFPE", 19},
+    {"OFSP", 19}, {"OGLA", 19}, {"OGOB", 19}, {"OIDA", 19}, {"OMMU", 19}, {"ONEH", 19},
+    {"ONPU", 19}, {"ORFU", 19}, {"ORHE", 19}, {"OSOF", 19}, {"OTBY", 19}, {"OTEA", 19},
+    {"OTPE", 19}, {"OTSP", 19}, {"OUSB", 19}, {"OUSV", 19}, {"OWHO", 19}, {"PANI", 19},
+    {"PLEO", 19}, {"PLEU", 19}, {"PLIA", 19}, {"POTH", 19}, {"PROJ", 19}, {"PSIN", 19},
+    {"PTOA", 19}, {"PTOF", 19}, {"PUTF", 19}, {"QAND", 19}, {"RADE", 19}, {"RAFE", 19},
+    {"RAWH", 19}, {"RCES", 19}, {"REIG", 19}, {"RENE", 19}, {"RFIN", 19}, {"RKOR", 19},
+    {"RKSF", 19}, {"RMEA", 19}, {"ROFW", 19}, {"RORT", 19}, {"RRUN", 19}, {"RSEE", 19},
+    {"RSYN", 19}, {"RTOU", 19}, {"RTSE", 19}, {"RTUE", 19}, {"RTYP", 19}, {"RTYT", 19},
+    {"RUMP", 19}, {"RVIC", 19}, {"RWHA", 19}, {"RYDI", 19}, {"RYIT", 19}, {"SAGO", 19},
+    {"SBRO", 19}, {"SCAT", 19}, {"SEWO", 19}, {"SFER", 19}, {"SLON", 19}, {"SMIX", 19},
+    {"SOFD", 19}, {"SONS", 19}, {"SOWO", 19}, {"SRAR", 19}, {"SSCO", 19}, {"SSID", 19},
+    {"STIO", 19}, {"SUPT", 19}, {"TASA", 19}, {"TASW", 19}, {"TAXM", 19}, {"TBEM", 19},
+    {"TBEP", 19}, {"TCTR", 19}, {"TEAR", 19}, {"TENI", 19}, {"TEXA", 19}, {"TEXC", 19},
+    {"THAM", 19}, {"THMO", 19}, {"THWI", 19}, {"TITA", 19}, {"TITB", 19}, {"TLAN", 19},
+    {"TLYD", 19}, {"TOOV", 19}, {"TOPL", 19}, {"TRIA", 19}, {"TSAM", 19}, {"TSSO", 19},
+    {"TVIS", 19}, {"TWIC", 19}, {"TXTR", 19}, {"TYFR", 19}, {"TYIS", 19}, {"TYPR", 19},
+    {"UGRO", 19}, {"UISI", 19}, {"ULDL", 19}, {"UMNU", 19}, {"UNTR", 19}, {"URTO", 19},
+    {"USCL", 19}, {"UTHI", 19}, {"UTYE", 19}, {"UUND", 19}, {"VEAC", 19}, {"VEDC", 19},
+    {"VEIS", 19}, {"VERC", 19}, {"VESW", 19}, {"VOLA", 19}, {"WICE", 19}, {"WINT", 19},
+    {"WMAK", 19}, {"WOFI", 19}, {"WOOR", 19}, {"WOPA", 19}, {"WSHU", 19}, {"XCES", 19},
+    {"YACC", 19}, {"YANA", 19}, {"YBEE", 19}, {"YEXE", 19}, {"YGRA", 19}, {"YISN", 19},
+    {"YMUS", 19}, {"YNEW", 19}, {"YPOT", 19}, {"YSDI", 19}, {"YSIS", 19}, {"YSPA", 19},
+    {"ABLA", 18}, {"ADVE", 18}, {"AFOL", 18}, {"AGEB", 18}, {"AGLO", 18}, {"AGNA", 18},
+    {"AHEA", 18}, {"AINP", 18}, {"ALAS", 18}, {"ALDA", 18}, {"ALTA", 18}, {"ANAU", 18},
+    {"ANMO", 18}, {"APOP", 18}, {"ARKI", 18}, {"ARPU", 18}, {"ARWH", 18}, {"ASYN", 18},
+    {"ATAF", 18}, {"ATDE", 18}, {"ATEQ", 18}, {"ATIL", 18}, {"ATOP", 18}, {"ATSH", 18},
+    {"BART", 18}, {"BUFR", 18}, {"BVIO", 18}, {"BYAS", 18}, {"BYDI", 18}, {"CALA", 18},
+    {"CALD", 18}, {"CHBR", 18}, {"CHDA", 18}, {"CHVE", 18}, {"CIAT", 18}, {"CRET", 18},
+    {"CSTA", 18}, {"CTHI", 18}, {"CVIM", 18}, {"CYOU", 18}, {"DBES", 18}, {"DBOO", 18},
+    {"DBYE", 18}, {"DDAT", 18}, {"DDIL", 18}, {"DECH", 18}, {"DEDU", 18}, {"DEPR", 18},
+    {"DESU", 18}, {"DEVI", 18}, {"DEXA", 18}, {"DHOL", 18}, {"DKEY", 18}, {"DMAR", 18},
+    {"DOFP", 18}, {"DOFS", 18}, {"DOMA", 18}, {"DOPT", 18}, {"DOVE", 18}, {"DRET", 18},
+    {"DYOF", 18}, {"EALA", 18}, {"EASM", 18}, {"EBEN", 18}, {"EBYP", 18}, {"ECKO", 18},
+    {"ECTU", 18}, {"EDER", 18}, {"EDFU", 18}, {"EDIG", 18}, {"EEKP", 18}, {"EENE", 18},
+    {"EENF", 18}, {"EFTO", 18}, {"EISC", 18}, {"ELAY", 18}, {"ELOA", 18}, {"ELYB", 18},
+    {"ENEV", 18}, {"ENGL", 18}, {"EOFM", 18}, {"EORF", 18}, {"EORN", 18}, {"EORO", 18},
+    {"EREU", 18}, {"ERSL", 18}, {"ERUP", 18}, {"ERYI", 18}, {"ESAG", 18}, {"ESIL", 18},
+    {"ESRA", 18}, {"ESSS", 18}, {"ETAC", 18}, {"ETAS", 18}, {"ETSS", 18}, {"ETUA", 18},
+    {"EXTN", 18}, {"FANA", 18}, {"FCOV", 18}, {"FERF", 18}, {"FEWE", 18}, {"FICE", 18},
+    {"FIGR", 18}, {"FITN", 18}, {"FLOA", 18}, {"FNET", 18}, {"FTRA", 18}, {"FVIT", 18},
+    {"FWHA", 18}, {"FWHE", 18}, {"FWIT", 18}, {"FWOR", 18}, {"FYIT", 18}, {"GCOL", 18},
+    {"GEBE", 18}, {"GESB", 18}, {"GEWA", 18}, {"GNET", 18}, {"GONL", 18}, {"GRMI", 18},
+    {"GSOM", 18}, {"HASE", 18}, {"HCOP", 18}, {"HEAM", 18}, {"HEEV", 18}, {"HEMF", 18},
+    {"HERG", 18}, {"HEYT", 18}, {"HTAL", 18}, {"HTAT", 18}, {"HUMA", 18}, {"HYPO", 18},
+    {"ICFO", 18}, {"ICIA", 18}, {"IDOF", 18}, {"IERS", 18}, {"IFIN", 18}, {"ILYA", 18},
+    {"IMUM", 18}, {"INAG", 18}, {"INNU", 18}, {"INPO", 18}, {"INSX", 18}, {"INTW", 18},
+    {"IPTW", 18}, {"IRBE", 18}, {"IREL", 18}, {"IRET", 18}, {"IRSE", 18}, {"ISAG", 18},
+    {"ISAM", 18}, {"ISEL", 18}, {"ISQU", 18}, {"ISSC", 18}, {"ISUN", 18}, {"ITDE", 18},
+    {"ITWE", 18}, {"KATT", 18}, {"KEAS", 18}, {"KECO", 18}, {"KENA", 18}, {"KENO", 18},
+    {"KEYI", 18}, {"KIFA", 18}, {"LAGS", 18}, {"LALS", 18}, {"LAYT", 18}, {"LDDO", 18},
+    {"LDME", 18}, {"LDWI", 18}, {"LERP", 18}, {"LIDP", 18}, {"LIND", 18}, {"LINI", 18},
+    {"LIVE", 18}, {"LLOO", 18}, {"LMOR", 18}, {"LOBL", 18}, {"LORC", 18}, {"LPRE", 18},
+    {"LSOD", 18}, {"LUAT", 18}, {"LUND", 18}, {"LYHA", 18}, {"LYTR", 18}, {"MALC", 18},
+    {"MANM", 18}, {"MARE", 18}, {"MAYH", 18}, {"MEPE", 18}, {"MESB", 18}, {"MIND", 18},
+    {"MISC", 18}, {"MITO", 18}, {"MITW", 18}, {"MONL", 18}, {"MONY", 18}, {"MPST", 18},
+    {"MTHR", 18}, {"MTOA", 18}, {"MTOC", 18}, {"MUND", 18}, {"NAPR", 18}, {"NDEC", 18},
+    {"NDEG", 18}, {"NEDE", 18}, {"NESY", 18}, {"NEXI", 18}, {"NGAW", 18}, {"NGDO", 18},
+    {"NGMU", 18}, {"NGNE", 18}, {"NGSF", 18}, {"NITY", 18}, {"NIXT", 18}, {"NKEY", 18},
+    {"NLEN", 18}, {"NLET", 18}, {"NLOA", 18}, {"NMED", 18}, {"NORI", 18}, {"NOVE", 18},
+    {"NOWC", 18}, {"NOWE", 18}, {"NSFE", 18}, {"NSTT", 18}, {"NSUB", 18}, {"NTPE", 18},
+    {"NWOR", 18}, {"NYPE", 18}, {"OADT", 18}, {"OALS", 18}, {"OAUT", 18}, {"ODED", 18},
+    {"OEXE", 18}, {"OFAV", 18}, {"OFHA", 18}, {"OFTR", 18}, {"OIDS", 18}, {"OITI", 18},
+    {"OLDM", 18}, {"OLIT", 18}, {"OMAR", 18}, {"ONAC", 18}, {"ONAV", 18}, {"ONDM", 18},
+    {"ONER", 18}, {"OPAS", 18}, {"OPLA", 18}, {"ORBA", 18}, {"OUDS", 18}, {"OUUN", 18},
+    {"OVEW", 18}, {"OWSW", 18}, {"PESO", 18}, {"PEVI", 18}, {"PRIE", 18}, {"PTXT", 18},
+    {"PTYL", 18}, {"PYMO", 18}, {"RATA", 18}, {"RCLA", 18}, {"RDYO", 18}, {"RETR", 18},
+    {"RETW", 18}, {"RFUL", 18}, {"RIZE", 18}, {"RKCH", 18}, {"RKSB", 18}, {"RLET", 18},
+    {"RLIK", 18}, {"RMSW", 18}, {"ROFL", 18}, {"ROME", 18}, {"RONL", 18}, {"ROUB", 18},
+    {"RREV", 18}, {"RSHE", 18}, {"RSOU", 18}, {"RSTE", 18}, {"RSTU", 18}, {"RSUR", 18},
+    {"RYMU", 18}, {"SABA", 18}, {"SALW", 18}, {"SAPR", 18}, {"SBYR", 18}, {"SCER", 18},
+    {"SEEC", 18}, {"SEEH", 18}, {"SETU", 18}, {"SFAL", 18}, {"SGEN", 18}, {"SISH", 18},
+    {"SLEN", 18}, {"SSHE", 18}, {"SSMA", 18}, {"SSWA", 18}, {"STDO", 18}, {"STPO", 18},
+    {"SUNA", 18}, {"TAGN", 18}, {"TANA", 18}, {"TAPA", 18}, {"TAVA", 18}, {"TBEN", 18},
+    {"TBYR", 18}, {"TBYW", 18}, {"TCHS", 18}, {"TEFO", 18}, {"TFRI", 18}, {"TGIV", 18},
+    {"TIVI", 18}, {"TMUC", 18}, {"TOFD", 18}, {"TORH", 18}, {"TSAC", 18}, {"TSAT", 18},
+    {"TSDI", 18}, {"TTEL", 18}, {"TWEN", 18}, {"TWOG", 18}, {"UALF", 18}, {"UCHF", 18},
+    {"UEWH", 18}, {"ULTL", 18}, {"ULWH", 18}, {"UMES", 18}, {"UMPI", 18}, {"UNAN", 18},
+    {"UPIN", 18}, {"URMO", 18}, {"UROP", 18}, {"USEH", 18}, {"USSE", 18}, {"UTSE", 18},
+    {"VEAP", 18}, {"VIMG", 18}, {"VIMN", 18}, {"WCOL", 18}, {"WEHA", 18}, {"WOST", 18},
+    {"XPOR", 18}, {"XTON", 18}, {"YAGR", 18}, {"YCLE", 18}, {"YCOV", 18}, {"YLIC", 18},
+    {"YOBS", 18}, {"YREM", 18}, {"YSPE", 18}, {"YTOG", 18}, {"YTOW", 18}, {"ACIR", 17},
+    {"ACLE", 17}, {"ADVI", 17}, {"ADYE", 17}, {"AGIN", 17}, {"AIRS", 17}, {"AKEO", 17},
+    {"AKEP", 17}, {"ALIB", 17}, {"ALLH", 17}, {"ALTI", 17}, {"AMSW", 17}, {"ANOF", 17},
+    {"ANYK", 17}, {"APCO", 17}, {"ARCS", 17}, {"ARNA", 17}, {"ARRY", 17}, {"ARYC", 17},
+    {"ASAM", 17}, {"ASCH", 17}, {"ASIH", 17}, {"ASLE", 17}, {"ASLO", 17}, {"ASNE", 17},
+    {"ASOL", 17}, {"ASSS", 17}, {"ASTW", 17}, {"ATBE", 17}, {"AVEP", 17}, {"AYHA", 17},
+    {"AYMA", 17}, {"AYSH", 17}, {"AYSP", 17}, {"BELE", 17}, {"BERW", 17}, {"BITT", 17},
+    {"BLIM", 17}, {"BSEQ", 17}, {"BYAD", 17}, {"BYAG", 17}, {"BYMI", 17}, {"BYOT", 17},
+    {"BYST", 17}, {"CEDW", 17}, {"CEME", 17}, {"CENO", 17}, {"CERE", 17}, {"CHOP", 17},
+    {"CHST", 17}, {"CIDS", 17}, {"CKLI", 17}, {"DARG", 17}, {"DBYP", 17}, {"DDIF", 17},
+    {"DEDS", 17}, {"DEME", 17}, {"DERN", 17}, {"DEYE", 17}, {"DIDT", 17}, {"DISN", 17},
+    {"DIUS", 17}, {"DLEV", 17}, {"DNAR", 17}, {"DOBS", 17}, {"DORO", 17}, {"DPAS", 17},
+    {"DRAN", 17}, {"DSAS", 17}, {"DSUP", 17}, {"DVAR", 17}, {"EAFO", 17}, {"EAME", 17},
+    {"EANU", 17}, {"EBYW", 17}, {"ECIN", 17}, {"ECOA", 17}, {"ECOS", 17}, {"ECTB", 17},
+    {"EDBA", 17}, {"EENR", 17}, {"EEPS", 17}, {"EEYO", 17}, {"EFTC", 17}, {"EGVI", 17},
+    {"EINN", 17}, {"EIRW", 17}, {"EISL", 17}, {"EKIN", 17}, {"ELFA", 17}, {"EMAG", 17},
+    {"EMBY", 17}, {"EMIG", 17}, {"ENAI", 17}, {"ENFI", 17}, {"EOFU", 17}, {"ERNM", 17},
+    {"ERTW", 17}, {"ERYG", 17}, {"ESBA", 17}, {"ESCI", 17}, {"ESOP", 17}, {"ESTD", 17},
+    {"ETSE", 17}, {"FLIA", 17}, {"FMOD", 17}, {"FOCI", 17}, {"FSAL", 17}, {"GEDA", 17},
+    {"GITW", 17}, {"GNAM", 17}, {"GPAR", 17}, {"GREY", 17}, {"GSWH", 17}, {"GSYO", 17},
+    {"GUES", 17}, {"HAFT", 17}, {"HASS", 17}, {"HEAL", 17}, {"HEMM", 17}, {"HEMU", 17},
+    {"HENL", 17}, {"HEOF", 17}, {"HEXA", 17}, {"HORA", 17}, {"HRIN", 17}, {"HSID", 17},
+    {"HSUC", 17}, {"HTMO", 17}, {"ICHL", 17}, {"ICPA", 17}, {"IDAD", 17}, {"IDSA", 17},
+    {"IESU", 17}, {"IEWT", 17}, {"IFSU", 17}, {"IITH", 17}, {"ILYT", 17}, {"INDW", 17},
+    {"IOBS", 17}, {"IONX", 17}, {"IPAN", 17}, {"IRAT", 17}, {"IRDO", 17}, {"IRFO", 17},
+    {"ISAF", 17}, {"ISEE", 17}, {"ISFY", 17}, {"ISTY", 17}, {"ITAG", 17}, {"ITEX", 17},
+    {"IUSE", 17}, {"KASA", 17}, {"KCON", 17}, {"LDAT", 17}, {"LEDB", 17}, {"LEDH", 17},
+    {"LINA", 17}, {"LLEX", 17}, {"LLFA", 17}, {"LLGR", 17}, {"LLOR", 17}, {"LLYM", 17},
+    {"LLYY", 17}, {"LSID", 17}, {"LTTH", 17}, {"LTVA", 17}, {"LTYF", 17}, {"LUEM", 17},
+    {"LYAP", 17}, {"LYBR", 17}, {"LYDO", 17}, {"LYFI", 17}, {"LYGR", 17}, {"LYNO", 17},
+    {"LYTE", 17}, {"MAPB", 17}, {"MBLE", 17}, {"MENS", 17}, {"MEON", 17}, {"MSAL", 17},
+    {"MSPE", 17}, {"MSYO", 17}, {"MTHO", 17}, {"NAFO", 17}, {"NAKE", 17}, {"NCTA", 17},
+    {"NDJU", 17}, {"NDVE", 17}, {"NEDC", 17}, {"NEDS", 17}, {"NERM", 17}, {"NGAM", 17},
+    {"NGEV", 17}, {"NGHE", 17}, {"NGLO", 17}, {"NGOB", 17}, {"NGSH", 17}, {"NHAS", 17},
+    {"NISI", 17}, {"NITR", 17}, {"NITU", 17}, {"NIXA", 17}, {"NLIC", 17}, {"NMSW", 17},
+    {"NOBL", 17}, {"NOFC", 17}, {"NOLO", 17}, {"NONC", 17}, {"NORR", 17}, {"NSCA", 17},
+    {"NSOT", 17}, {"NSUR", 17}, {"NTBY", 17}, {"NTOE", 17}, {"NTUP", 17}, {"NTYA", 17},
+    {"NUED", 17}, {"NUES", 17}, {"NULL", 17}, {"NUSR", 17}, {"NYAN", 17}, {"NYEX", 17},
+    {"NYPR", 17}, {"NYWH", 17}, {"OBEF", 17}, {"OBLU", 17}, {"OBSC", 17}, {"OCEE", 17},
+    {"ODAY", 17}, {"OFFA", 17}, {"OFSA", 17}, {"OHER", 17}, {"OHIB", 17}, {"OKAN", 17},
+    {"OLDO", 17}, {"OLLA", 17}, {"OMAL", 17}, {"ONAD", 17}, {"ONSL", 17}, {"OODW", 17},
+    {"ORDU", 17}, {"ORIU", 17}, {"ORMU", 17}, {"ORRU", 17}, {"ORTL", 17}, {"ORTT", 17},
+    {"OSHA", 17}, {"OSPH", 17}, {"OSTF", 17}, {"OSWI", 17}, {"OTHW", 17}, {"OTRA", 17},
+    {"OUPN", 17}, {"OURG", 17}, {"OUSM", 17}, {"OUSO", 17}, {"OUTB", 17}, {"OVIE", 17},
+    {"OWSU", 17}, {"PEAN", 17}, {"PERD", 17}, {"PLEE", 17}, {"PLEL", 17}, {"PLEP", 17},
+    {"PLYI", 17}, {"PONO", 17}, {"PROH", 17}, {"PTWH", 17}, {"RAMF", 17}, {"RAWI", 17},
+    {"RAYA", 17}, {"RDOC", 17}, {"RDSW", 17}, {"REGE", 17}, {"REIF", 17}, {"REIM", 17},
+    {"RENA", 17}, {"RINE", 17}, {"RISN", 17}, {"RIUM", 17}, {"RKSP", 17}, {"RLYO", 17},
+    {"RNET", 17}, {"ROHI", 17}, {"ROMB", 17}, {"RTAK", 17}, {"RTAT", 17}, {"RTFO", 17},
+    {"RTHP", 17}, {"RTIM", 17}, {"RTTO", 17}, {"RUNS", 17}, {"RWHO", 17}, {"SAFE", 17},
+    {"SAMA", 17}, {"SAMP", 17}, {"SASO", 17}, {"SDOW", 17}, {"SEBY", 17}, {"SETD", 17},
+    {"SFAR", 17}, {"SHIG", 17}, {"SINM", 17}, {"SKIN", 17}, {"SLEA", 17}, {"SLOA", 17},
+    {"SMIN", 17}, {"SMST", 17}, {"SOIF", 17}, {"SORH", 17}, {"SOWH", 17}, {"SSUF", 17},
+    {"STDE", 17}, {"SVIE", 17}, {"TBEE", 17}, {"TBEO", 17}, {"TBYA", 17}, {"TEFF", 17},
+    {"TEFR", 17}, {"TESC", 17}, {"TEXI", 17}, {"TFOO", 17}, {"THAR", 17}, {"THEJ", 17},
+    {"TINI", 17}, {"TINV", 17}, {"TLEC", 17}, {"TLEM", 17}, {"TMOU", 17}, {"TOAR", 17},
+    {"TORB", 17}, {"TOSW", 17}, {"TRIK", 17}, {"TRLP", 17}, {"TRLX", 17}, {"TRUL", 17},
+    {"TRYO", 17}, {"TSIF", 17}, {"TSUB", 17}, {"TTEM", 17}, {"UADD", 17}, {"UALD", 17},
+    {"UDEF", 17}, {"UDEL", 17}, {"UEIS", 17}, {"UEWI", 17}, {"ULDI", 17}, {"ULDP", 17},
+    {"ULIK", 17}, {"UMMA", 17}, {"UOFT", 17}, {"UPLI", 17}, {"UPNA", 17}, {"UPWI", 17},
+    {"UREB", 17}, {"URLA", 17}, {"URSS", 17}, {"URWO", 17}, {"USSI", 17}, {"UTFR", 17},
+    {"UTSA", 17}, {"UYOU", 17}, {"VEAS", 17}, {"VEDO", 17}, {"VEPO", 17}, {"VERV", 17},
+    {"VEXO", 17}, {"WAVE", 17}, {"WERO", 17}, {"WWIT", 17}, {"XISO", 17}, {"XTAF", 17},
+    {"XTWR", 17}, {"YANO", 17}, {"YBER", 17}, {"YDOE", 17}, {"YEND", 17}, {"YETI", 17},
+    {"YKIN", 17}, {"YLIS", 17}, {"YPEN", 17}, {"YPTI", 17}, {"YREP", 17}, {"YSAF", 17},
+    {"YTOO", 17}, {"YWHO", 17}, {"ABLU", 16}, {"ACIT", 16}, {"ACOR", 16}, {"ACUU", 16},
+    {"ADDN", 16}, {"ADDS", 16}, {"ADEF", 16}, {"ADEW", 16}, {"ADIU", 16}, {"AJOR", 16},
+    {"ALBE", 16}, {"ALFT", 16}, {"ALIZ", 16}, {"ALOO", 16}, {"AMYO", 16}, {"ANIE", 16},
+    {"ANIZ", 16}, {"ANKS", 16}, {"ANKT", 16}, {"APAC", 16}, {"ARKT", 16}, {"ARSB", 16},
+    {"ARYL", 16}, {"ASAF", 16}, {"ASEB", 16}, {"ASGR", 16}, {"ASPR", 16}, {"ASSP", 16},
+    {"ASUS", 16}, {"ASVE", 16}, {"ATLA", 16}, {"AVIO", 16}, {"AYAP", 16}, {"AYPU", 16},
+    {"BALV", 16}, {"BEHE", 16}, {"BITS", 16}, {"BLEY", 16}, {"BLOB", 16}, {"BRAI", 16},
+    {"BUTD", 16}, {"BVIM", 16}, {"CALF", 16}, {"CEAB", 16}, {"CEAF", 16}, {"CEAP", 16},
+    {"CESH", 16}, {"CESM", 16}, {"CESP", 16}, {"CHAF", 16}, {"CHDO", 16}, {"CHOT", 16},
+    {"CHOU", 16}, {"CKST", 16}, {"CTIC", 16}, {"CTWH", 16}, {"CUOU", 16}, {"CUUM", 16},
+    {"DANI", 16}, {"DASM", 16}, {"DDOW", 16}, {"DFAI", 16}, {"DHAS", 16}, {"DIAL", 16},
+    {"DISK", 16}, {"DOFI", 16}, {"DOMI", 16}, {"DORN", 16}, {"DOWB", 16}, {"DREL", 16},
+    {"DREM", 16}, {"DSPR", 16}, {"DUNT", 16}, {"DWAT", 16}, {"DWID", 16}, {"EADP", 16},
+    {"EAMB", 16}, {"EATL", 16}, {"EBOR", 16}, {"EBYO", 16}, {"EDAU", 16}, {"EDBL", 16},
+    {"EDDO", 16}, {"EDEV", 16}, {"EDEY", 16}, {"EDID", 16}, {"EDME", 16}, {"EDOI", 16},
+    {"EDRI", 16}, {"EDTW", 16}, {"EEDN", 16}, {"EELE", 16}, {"EEOR", 16}, {"EFIG", 16},
+    {"EISR", 16}, {"EISW", 16}, {"EITU", 16}, {"ELDI", 16}, {"ELIA", 16}, {"ELPC", 16},
+    {"EMSF", 16}, {"EMUL", 16}, {"EMWH", 16}, {"ENAR", 16}, {"ENDP", 16}, {"ENOM", 16},
+    {"EORP", 16}, {"EPIC", 16}, {"EPTF", 16}, {"EROT", 16}, {"EROY", 16}, {"ERPU", 16},
+    {"ESAD", 16}, {"ESEB", 16}, {"ESMU", 16}, {"ESTL", 16}, {"ESTV", 16}, {"ETDI", 16},
+    {"ETOL", 16}, {"EVAN", 16}, {"EWEL", 16}, {"EYAN", 16}, {"EYAP", 16}, {"FASE", 16},
+    {"FAWO", 16}, {"FCOU", 16}, {"FDAT", 16}, {"FDEF", 16}, {"FDIS", 16}, {"FFOL", 16},
+    {"FIGI", 16}, {"FINT", 16}, {"FPER", 16}, {"FTAR", 16}, {"FULF", 16}, {"FWIN", 16},
+    {"FYAN", 16}, {"GATT", 16}, {"GEIF", 16}, {"GESS", 16}, {"GGLA", 16}, {"GHEL", 16},
+    {"GINE", 16}, {"GINM", 16}, {"GLIG", 16}, {"GMAT", 16}, {"GOFA", 16}, {"GSCO", 16},
+    {"GSFO", 16}, {"GSWI", 16}, {"GSYN", 16}, {"GTAG", 16}, {"GUSI", 16}, {"HALO", 16},
+    {"HAPE", 16}, {"HASC", 16}, {"HASP", 16}, {"HBEI", 16}, {"HENH", 16}, {"HESB", 16},
+    {"HETY", 16}, {"HEYF", 16}, {"HFOL", 16}, {"HITT", 16}, {"HLIK", 16}, {"HREA", 16},
+    {"HTAR", 16}, {"HTES", 16}, {"HWHE", 16}, {"HYPE", 16}, {"IABB", 16}, {"IDNT", 16},
+    {"IDST", 16}, {"IEDO", 16}, {"IESM", 16}, {"IFEA", 16}, {"ILTO", 16}, {"IMEO", 16},
+    {"IMTU", 16}, {"INBE", 16}, {"INRU", 16}, {"INTL", 16}, {"IPTC", 16}, {"ISCE", 16},
+    {"ISEV", 16}, {"ISGR", 16}, {"ISHU", 16}, {"ISIF", 16}, {"ISMM", 16}, {"ISTC", 16},
+    {"ITBA", 16}, {"ITEY", 16}, {"ITFI", 16}, {"ITHL", 16}, {"ITPA", 16}, {"KSOF", 16},
+    {"LAID", 16}, {"LANA", 16}, {"LATA", 16}, {"LBEM", 16}, {"LBEP", 16}, {"LDRE", 16},
+    {"LDSE", 16}, {"LEAF", 16}, {"LEFR", 16}, {"LENE", 16}, {"LEPO", 16}, {"LESV", 16},
+    {"LEWR", 16}, {"LICT", 16}, {"LLBU", 16}, {"LLPE", 16}, {"LLYV", 16}, {"LOAT", 16},
+    {"LOFV", 16}, {"LONT", 16}, {"LOSI", 16}, {"LPTX", 16}, {"LTEX", 16}, {"LTSV", 16},
+    {"LUEB", 16}, {"LYAC", 16}, {"MAJO", 16}, {"MANA", 16}, {"MARI", 16}, {"MARY", 16},
+    {"MAYO", 16}, {"MCON", 16}, {"MEDA", 16}, {"MELE", 16}, {"MGET", 16}, {"MNTH", 16},
+    {"MONI", 16}, {"MOSP", 16}, {"MOTH", 16}, {"MTOS", 16}, {"MTUT", 16}, {"MUTU", 16},
+    {"NAGI", 16}, {"NAPA", 16}, {"NAWH", 16}, {"NBEI", 16}, {"NBYR", 16}, {"NCAS", 16},
+    {"NDEL", 16}, {"NDEM", 16}, {"NDGL", 16}, {"NDSL", 16}, {"NEGE", 16}, {"NEMP", 16},
+    {"NEPR", 16}, {"NESM", 16}, {"NETI", 16}, {"NFUN", 16}, {"NGVA", 16}, {"NHAL", 16},
+    {"NHAV", 16}, {"NISO", 16}, {"NISU", 16}, {"NIXF", 16}, {"NKLI", 16}, {"NKTH", 16},
+    {"NOUR", 16}, {"NPOS", 16}, {"NPRI", 16}, {"NREG", 16}, {"NSEM", 16}, {"NTES", 16},
+    {"NUIN", 16}, {"NYKI", 16}, {"NYNE", 16}, {"OACO", 16}, {"OANE", 16}, {"OBYT", 16},
+    {"OFFT", 16}, {"OFOU", 16}, {"OFSH", 16}, {"OFWI", 16}, {"OLDF", 16}, {"OLEM", 16},
+    {"OLEW", 16}, {"OLIC", 16}, {"OLTH", 16}, {"OMYO", 16}, {"ONGC", 16}, {"ONMS", 16},
+    {"ONVA", 16}, {"OOKE", 16}, {"OOKF", 16}, {"OPIC", 16}, {"OPYD", 16}, {"ORBU", 16},
+    {"ORGR", 16}, {"ORKR", 16}, {"ORWE", 16}, {"OSAV", 16}, {"OSHO", 16}, {"OSTT", 16},
+    {"OSUC", 16}, {"OTAS", 16}, {"OTEI", 16}, {"OTEN", 16}, {"OTNE", 16}, {"OTTE", 16},
+    {"OTTR", 16}, {"OUSR", 16}, {"OWWA", 16}, {"PENU", 16}, {"PHSA", 16}, {"PLED", 16},
+    {"POTA", 16}, {"PRAC", 16}, {"PTHI", 16}, {"PTNA", 16}, {"PTOP", 16}, {"PTST", 16},
+    {"PUSE", 16}, {"PYDI", 16}, {"RALW", 16}, {"RAMY", 16}, {"RASP", 16}, {"RBEF", 16},
+    {"RCEN", 16}, {"RDAT", 16}, {"RDRI", 16}, {"RDSF", 16}, {"RECU", 16}, {"RERO", 16},
+    {"REWR", 16}, {"RGRA", 16}, {"RISC", 16}, {"RITY", 16}, {"RKED", 16}, {"RLIB", 16},
+    {"RLIG", 16}, {"RLIM", 16}, {"RLON", 16}, {"RLOS", 16}, {"RLXC", 16}, {"RLYW", 16},
+    {"RMAP", 16}, {"RNON", 16}, {"RNOW", 16}, {"RORB", 16}, {"ROTO", 16}, {"RRID", 16},
+    {"RSOA", 16}, {"RSTD", 16}, {"RTAS", 16}, {"RTLY", 16}, {"RTOO", 16}, {"RTSB", 16},
+    {"RTUP", 16}, {"RUPT", 16}, {"SADI", 16}, {"SAGA", 16}, {"SASF", 16}, {"SATH", 16},
+    {"SAWT", 16}, {"SBEY", 16}, {"SDEC", 16}, {"SEDV", 16}, {"SELS", 16}, {"SEPO", 16},
+    {"SIMA", 16}, {"SISB", 16}, {"SITA", 16}, {"SLAN", 16}, {"SOBL", 16}, {"SOYO", 16},
+    {"SPIC", 16}, {"SQRT", 16}, {"SSEP", 16}, {"SSFR", 16}, {"STCR", 16}, {"STNO", 16},
+    {"STUN", 16}, {"STYL", 16}, {"SUBM", 16}, {"SUSP", 16}, {"SWAT", 16}, {"TABC", 16},
+    {"TCHX", 16}, {"TCMD", 16}, {"TCRY", 16}, {"TDEG", 16}, {"TEIS", 16}, {"TEMF", 16},
+    {"THCH", 16}, {"THFI", 16}, {"THTE", 16}, {"THTW", 16}, {"TISL", 16}, {"TMAD", 16},
+    {"TOAG", 16}, {"TOFM", 16}, {"TOOM", 16}, {"TORN", 16}, {"TQUA", 16}, {"TROD", 16},
+    {"TRUN", 16}, {"TSBU", 16}, {"TTPS", 16}, {"TVIO", 16}, {"TYLE", 16}, {"UCHE", 16},
+    {"UCTU", 16}, {"UGHW", 16}, {"UMOD", 16}, {"UMWA", 16}, {"UNDC", 16}, {"UNEQ", 16},
+    {"UNIV", 16}, {"UPME", 16}, {"UPWA", 16}, {"UREP", 16}, {"URSH", 16}, {"USEL", 16},
+    {"USEU", 16}, {"USEX", 16}, {"USMA", 16}, {"USVE", 16}, {"USWH", 16}, {"UTSO", 16},
+    {"UTUA", 16}, {"VENP", 16}, {"VENS", 16}, {"VEWH", 16}, {"VEWI", 16}, {"VEYE", 16},
+    {"WAYB", 16}, {"WMOD", 16}, {"WOIN", 16}, {"WSIN", 16}, {"WTOA", 16}, {"WTOC", 16},
+    {"WTYP", 16}, {"WWHA", 16}, {"XGRO", 16}, {"XMAT", 16}, {"XTWH", 16}, {"YALI", 16},
+    {"YASS", 16}, {"YBLA", 16}, {"YEXC", 16}, {"YIMP", 16}, {"YITI", 16}, {"YITW", 16},
+    {"YKNO", 16}, {"YMUC", 16}, {"YOFL", 16}, {"YORT", 16}, {"YSTI", 16}, {"YTUR", 16},
+    {"ABET", 15}, {"ACHF", 15}, {"ACKG", 15}, {"ADAT", 15}, {"ADDF", 15}, {"ADDO", 15},
+    {"ADEC", 15}, {"ADEU", 15}, {"ADIT", 15}, {"ADUA", 15}, {"AGEV", 15}, {"AINR", 15},
+    {"AKEB", 15}, {"ALAU", 15}, {"ALDO", 15}, {"AMAR", 15}, {"AMEY", 15}, {"ANEV", 15},
+    {"ANKL", 15}, {"APBU", 15}, {"APHI", 15}, {"APIN", 15}, {"APLA", 15}, {"ARDB", 15},
+    {"ARIF", 15}, {"ARKA", 15}, {"ARYY", 15}, {"ASCA", 15}, {"ASEY", 15}, {"ASSC", 15},
+    {"ASTS", 15}, {"ATBY", 15}, {"ATYP", 15}, {"AVEL", 15}, {"BEVI", 15}, {"BING", 15},
+    {"BROU", 15}, {"BSCU", 15}, {"BYGR", 15}, {"BYOU", 15}, {"CCOU", 15}, {"CEDO", 15},
+    {"CELI", 15}, {"CEPL", 15}, {"CEPR", 15}, {"CHAD", 15}, {"CHNE", 15}, {"CHRO", 15},
+    {"CHSU", 15}, {"CHWH", 15}, {"CINS", 15}, {"CKGR", 15}, {"CKON", 15}, {"CLEV", 15},
+    {"CORN", 15}, {"CPAR", 15}, {"CTIT", 15}, {"DEFR", 15}, {"DFAR", 15}, {"DGEM", 15},
+    {"DGIV", 15}, {"DHAL", 15}, {"DILL", 15}, {"DINE", 15}, {"DJUM", 15}, {"DMAD", 15},
+    {"DOFC", 15}, {"DOFE", 15}, {"DOFL", 15}, {"DOTR", 15}, {"DOWM", 15}, {"DPUB", 15},
+    {"DSBU", 15}, {"DSMA", 15}, {"DSOL", 15}, {"DSPI", 15}, {"DSUR", 15}, {"DUPL", 15},
+    {"DWER", 15}, {"DYEX", 15}, {"DYWH", 15}, {"EATS", 15}, {"EBUG", 15}, {"EBYD", 15},
+    {"EDBO", 15}, {"EDOT", 15}, {"EDSP", 15}, {"EERE", 15}, {"EFTA", 15}, {"EHAR", 15},
+    {"EHTT", 15}, {"EIRV", 15}, {"EITO", 15}, {"ELCH", 15}, {"ELPO", 15}, {"EMES", 15},
+    {"EMYO", 15}, {"ENBU", 15}, {"ENNO", 15}, {"ENSB", 15}, {"ENUN", 15}, {"EOFD", 15},
+    {"EOFH", 15}, {"EOFY", 15}, {"EORR", 15}, {"EORY", 15}, {"EPTW", 15}, {"ERBL", 15},
+    {"EROB", 15}, {"ESPI", 15}, {"ESSM", 15}, {"ETAT", 15}, {"ETBE", 15}, {"ETPO", 15},
+    {"ETSI", 15}, {"EVID", 15}, {"EVOL", 15}, {"EYEB", 15}, {"EYEN", 15}, {"EYMU", 15},
+    {"FEND", 15}, {"FFRO", 15}, {"FICF", 15}, {"FITE", 15}, {"FITO", 15}, {"FLIC", 15},
+    {"FLOO", 15}, {"FMAT", 15}, {"FWAY", 15}, {"GALI", 15}, {"GCAS", 15}, {"GCOP", 15},
+    {"GEAF", 15}, {"GERW", 15}, {"GETP", 15}, {"GEVE", 15}, {"GGET", 15}, {"GHTG", 15},
+    {"GLEB", 15}, {"GRED", 15}, {"HADD", 15}, {"HANU", 15}, {"HARR", 15}, {"HBRO", 15},
+    {"HEDT", 15}, {"HEMC", 15}, {"HETU", 15}, {"HGRE", 15}, {"HHAV", 15}, {"HIDD", 15},
+    {"HINB", 15}, {"HINS", 15}, {"HIPO", 15}, {"HMAY", 15}, {"HMUS", 15}, {"HNEW", 15},
+    {"HOCO", 15}, {"HOUS", 15}, {"HOWA", 15}, {"HOWC", 15}, {"HOWI", 15}, {"HRES", 15},
+    {"HTAB", 15}, {"HTMA", 15}, {"HTMI", 15}, {"HTOP", 15}, {"ICHR", 15}, {"ICIP", 15},
+    {"ICKF", 15}, {"ICST", 15}, {"IDDE", 15}, {"IESP", 15}, {"IFYS", 15}, {"IKED", 15},
+    {"IKES", 15}, {"IMSA", 15}, {"IMSO", 15}, {"INCU", 15}, {"INDU", 15}, {"IRLI", 15},
+    {"ISBA", 15}, {"ISHR", 15}, {"ISMH", 15}, {"ISTF", 15}, {"ISTG", 15}, {"ITAF", 15},
+    {"ITME", 15}, {"ITMU", 15}, {"IVEU", 15}, {"IVIT", 15}, {"KBUT", 15}, {"KEAL", 15},
+    {"KSWH", 15}, {"KSWI", 15}, {"KTHI", 15}, {"KUPF", 15}, {"LBEF", 15}, {"LDAM", 15},
+    {"LEED", 15}, {"LEHE", 15}, {"LESD", 15}, {"LEYE", 15}, {"LLES", 15}, {"LLWA", 15},
+    {"LLYL", 15}, {"LNUM", 15}, {"LOBU", 15}, {"LPHA", 15}, {"LSTI", 15}, {"LTAN", 15},
+    {"LUEC", 15}, {"LYLO", 15}, {"LYPE", 15}, {"MALI", 15}, {"MAPT", 15}, {"MAYT", 15},
+    {"MBRA", 15}, {"MEAR", 15}, {"MEDE", 15}, {"MEPO", 15}, {"MERP", 15}, {"MEVE", 15},
+    {"MNOT", 15}, {"MONC", 15}, {"MORG", 15}, {"MSET", 15}, {"MSIF", 15}, {"NABE", 15},
+    {"NAGA", 15}, {"NANI", 15}, {"NANU", 15}, {"NASE", 15}, {"NBOD", 15}, {"NCEC", 15},
+    {"NCUR", 15}, {"NDES", 15}, {"NDHI", 15}, {"NDIA", 15}, {"NDRI", 15}, {"NDSB", 15},
+    {"NEFU", 15}, {"NEND", 15}, {"NEWW", 15}, {"NFOF", 15}, {"NGHO", 15}, {"NHEA", 15},
+    {"NISC", 15}, {"NISD", 15}, {"NLIM", 15}, {"NLYR", 15}, {"NOCH", 15}, {"NOFO", 15},
+    {"NOFW", 15}, {"NOWH", 15}, {"NSPL", 15}, {"NTPO", 15}, {"NUAT", 15}, {"NVIR", 15},
+    {"NWHO", 15}, {"NYRA", 15}, {"OALI", 15}, {"OATT", 15}, {"OBEL", 15}, {"OBUT", 15},
+    {"OCRE", 15}, {"ODEB", 15}, {"ODEU", 15}, {"OESI", 15}, {"OFHI", 15}, {"OFOB", 15},
+    {"OHIG", 15}, {"OINF", 15}, {"OKFO", 15}, {"OMAC", 15}, {"OMEE", 15}, {"OMST", 15},
+    {"ONAM", 15}, {"ONAW", 15}, {"ONMO", 15}, {"ONWO", 15}, {"OODO", 15}, {"OOTS", 15},
+    {"OPHY", 15}, {"ORCR", 15}, {"OREU", 15}, {"ORII", 15}, {"OROU", 15}, {"ORTF", 15},
+    {"ORWR", 15}, {"ORYL", 15}, {"OSEV", 15}, {"OTAK", 15}, {"OTWA", 15}, {"OUSF", 15},
+    {"OWDO", 15}, {"OWLI", 15}, {"OWNC", 15}, {"OWTY", 15}, {"PANT", 15}, {"PBUF", 15},
+    {"PEDA", 15}, {"PEDI", 15}, {"PIED", 15}, {"PIPE", 15}, {"PLEB", 15}, {"PLEN", 15},
+    {"PUPM", 15}, {"PUSC", 15}, {"PWIN", 15}, {"QUEC", 15}, {"RADU", 15}, {"RAGA", 15},
+    {"RALA", 15}, {"RAMB", 15}, {"RASS", 15}, {"RAYC", 15}, {"RBEI", 15}, {"RBIT", 15},
+    {"RCIN", 15}, {"RDFO", 15}, {"RDOR", 15}, {"RDUN", 15}, {"REBO", 15}, {"REDD", 15},
+    {"REDR", 15}, {"REEW", 15}, {"REOP", 15}, {"REXC", 15}, {"RFOU", 15}, {"RGEF", 15},
+    {"RGEO", 15}, {"RGLI", 15}, {"RGUE", 15}, {"RINW", 15}, {"RISD", 15}, {"RISR", 15},
+    {"RISU", 15}, {"RLDW", 15}, {"RLEF", 15}, {"RLYB", 15}, {"RNMA", 15}, {"RNSI", 15},
+    {"ROUS", 15}, {"RPUS", 15}, {"RRIE", 15}, {"RRIV", 15}, {"RSAC", 15}, {"RSDI", 15},
+    {"RSLI", 15}, {"RTHU", 15}, {"RTLI", 15}, {"RTOP", 15}, {"RVIN", 15}, {"RYHA", 15},
+    {"RYRA", 15}, {"RYSU", 15}, {"SADV", 15}, {"SASU", 15}, {"SBRE", 15}, {"SBYS", 15},
+    {"SBYW", 15}, {"SDER", 15}, {"SEAF", 15}, {"SECR", 15}, {"SEFF", 15}, {"SEGR", 15},
+    {"SEHO", 15}, {"SERD", 15}, {"SESM", 15}, {"SETP", 15}, {"SEWA", 15}, {"SHRE", 15},
+    {"SISF", 15}, {"SISI", 15}, {"SLOC", 15}, {"SMAB", 15}, {"SNEE", 15}, {"SOEV", 15},
+    {"SOOF", 15}, {"SOPE", 15}, {"SOWN", 15}, {"SRIN", 15}, {"SRUN", 15}, {"SSNE", 15},
+    {"STNU", 15}, {"SURR", 15}, {"SYEL", 15}, {"TAIR", 15}, {"TBEG", 15}, {"TEAM", 15},
+    {"TEBU", 15}, {"TEDY", 15}, {"TEEX", 15}, {"TESH", 15}, {"TFRE", 15}, {"THAW", 15},
+    {"THCA", 15}, {"THUN", 15}, {"TILA", 15}, {"TILY", 15}, {"TOCR", 15}, {"TOTI", 15},
+    {"TOUG", 15}, {"TRLC", 15}, {"TSHE", 15}, {"TSOU", 15}, {"TSSI", 15}, {"TTES", 15},
+    {"TTOL", 15}, {"TXTY", 15}, {"UBTI", 15}, {"UCHN", 15}, {"UCHR", 15}, {"UFIN", 15},
+    {"UING", 15}, {"ULLC", 15}, {"ULTA", 15}, {"ULTF", 15}, {"UMBR", 15}, {"UNTT", 15},
+    {"URSD", 15}, {"USIF", 15}, {"UTAR", 15}, {"UTDE", 15}, {"UTEN", 15}, {"UTTY", 15},
+    {"VEMO", 15}, {"VESP", 15}, {"VTHE", 15}, {"WASV", 15}, {"WCHA", 15}, {"WERI", 15},
+    {"WMOV", 15}, {"WORE", 15}, {"WSTA", 15}, {"WTEX", 15}, {"WWIL", 15}, {"XAMI", 15},
+    {"XCTR", 15}, {"XSTA", 15}, {"XTBE", 15}, {"XTNO", 15}, {"YABO", 15}, {"YBEU", 15},
+    {"YCHO", 15}, {"YCOU", 15}, {"YDIL", 15}, {"YENT", 15}, {"YINO", 15}, {"YIST", 15},
+    {"YMAN", 15}, {"YOFM", 15}, {"YOVE", 15}, {"YPEG", 15}, {"YPOR", 15}, {"YRES", 15},
+    {"YSAS", 15}, {"YSWE", 15}, {"YTOE", 15}, {"ZING", 15}, {"ZONT", 15}, {"ABSA", 14},
+    {"ABSE", 14}, {"ABTA", 14}, {"ACEP", 14}, {"ACHS", 14}, {"ACHV", 14}, {"ACYS", 14},
+    {"ADEN", 14}, {"ADPO", 14}, {"AFOU", 14}, {"AKEU", 14}, {"AMAS", 14}, {"AMIF", 14},
+    {"AMWH", 14}, {"ANTB", 14}, {"ANTR", 14}, {"AOFT", 14}, {"APOR", 14}, {"APTT", 14},
+    {"APUB", 14}, {"AREY", 14}, {"ARIM", 14}, {"ARYH", 14}, {"ASEQ", 14}, {"ASSH", 14},
+    {"ASTU", 14}, {"ATPO", 14}, {"AWNO", 14}, {"AXGR", 14}, {"AYFI", 14}, {"BEPE", 14},
+    {"BITI", 14}, {"BITM", 14}, {"BURN", 14}, {"CCHA", 14}, {"CEAT", 14}, {"CESY", 14},
+    {"CHER", 14}, {"CHLE", 14}, {"CKPA", 14}, {"CMDB", 14}, {"COAS", 14}, {"CSYN", 14},
+    {"CYSC", 14}, {"DCAU", 14}, {"DDOT", 14}, {"DEFG", 14}, {"DEON", 14}, {"DERB", 14},
+    {"DFRE", 14}, {"DHEN", 14}, {"DISU", 14}, {"DLEG", 14}, {"DLIM", 14}, {"DMED", 14},
+    {"DOFO", 14}, {"DOWU", 14}, {"DPLU", 14}, {"DSBY", 14}, {"DSCO", 14}, {"DSOA", 14},
+    {"DTEL", 14}, {"DTHW", 14}, {"DUCI", 14}, {"DURI", 14}, {"DWAN", 14}, {"DWAY", 14},
+    {"DWIN", 14}, {"EALC", 14}, {"EANT", 14}, {"EARR", 14}, {"EASC", 14}, {"EBEH", 14},
+    {"ECHE", 14}, {"ECRY", 14}, {"EDNE", 14}, {"EDPE", 14}, {"EDUC", 14}, {"EEIG", 14},
+    {"EFEA", 14}, {"EGRM", 14}, {"EHAD", 14}, {"EIDE", 14}, {"EISB", 14}, {"EITM", 14},
+    {"ELFI", 14}, {"ELFO", 14}, {"ELTH", 14}, {"ELYR", 14}, {"EMBL", 14}, {"EMLI", 14},
+    {"EMOO", 14}, {"EMSS", 14}, {"ENUE", 14}, {"EPCO", 14}, {"EPOP", 14}, {"ERAI", 14},
+    {"ERMU", 14}, {"ERWE", 14}, {"ESAY", 14}, {"ESNE", 14}, {"ESSN", 14}, {"ESTY", 14},
+    {"ETBY", 14}, {"ETOH", 14}, {"ETUP", 14}, {"ETWH", 14}, {"EUNT", 14}, {"EWTE", 14},
+    {"EYED", 14}, {"EYRE", 14}, {"FAPA", 14}, {"FBOT", 14}, {"FEXI", 14}, {"FING", 14},
+    {"FRAI", 14}, {"FSOF", 14}, {"FUME", 14}, {"FYSU", 14}, {"FYYO", 14}, {"GABO", 14},
+    {"GANT", 14}, {"GBOD", 14}, {"GBYT", 14}, {"GEQU", 14}, {"GERO", 14}, {"GERS", 14},
+    {"GITO", 14}, {"GITT", 14}, {"GLAN", 14}, {"GLEI", 14}, {"GLIC", 14}, {"GMIS", 14},
+    {"GRAT", 14}, {"GSAR", 14}, {"GTHS", 14}, {"GUIO", 14}, {"GUNI", 14}, {"GWIN", 14},
+    {"HAMO", 14}, {"HBLU", 14}, {"HCAN", 14}, {"HCOU", 14}, {"HCTR", 14}, {"HDIF", 14},
+    {"HEEC", 14}, {"HENF", 14}, {"HENN", 14}, {"HERK", 14}, {"HERY", 14}, {"HEWS", 14},
+    {"HEYO", 14}, {"HGRO", 14}, {"HIDE", 14}, {"HLES", 14}, {"HOFA", 14}, {"HOFI", 14},
+    {"HOWY", 14}, {"HREF", 14}, {"HRON", 14}, {"HSEC", 14}, {"HSET", 14}, {"HSHO", 14},
+    {"HTEN", 14}, {"HTFA", 14}, {"HTOB", 14}, {"IALM", 14}, {"ICKW", 14}, {"ICUO", 14},
+    {"IDFO", 14}, {"IESD", 14}, {"IEWS", 14}, {"IFYY", 14}, {"IMRM", 14}, {"IMWO", 14},
+    {"INBU", 14}, {"INBY", 14}, {"INME", 14}, {"INOB", 14}, {"INOP", 14}, {"INVO", 14},
+    {"IPOF", 14}, {"IRMA", 14}, {"ISAR", 14}, {"ISAU", 14}, {"ISFA", 14}, {"ISJU", 14},
+    {"ISKA", 14}, {"ISRU", 14}, {"ITBU", 14}, {"ITHH", 14}, {"ITSV", 14}, {"ITYB", 14},
+    {"ITYP", 14}, {"IZIN", 14}, {"KAST", 14}, {"KDIR", 14}, {"KEDW", 14}, {"KETO", 14},
+    {"KIFT", 14}, {"LADD", 14}, {"LANO", 14}, {"LARR", 14}, {"LBLO", 14}, {"LEMU", 14},
+    {"LERO", 14}, {"LETP", 14}, {"LEXP", 14}, {"LFWA", 14}, {"LIZE", 14}, {"LLAM", 14},
+    {"LLEG", 14}, {"LLGO", 14}, {"LLLE", 14}, {"LLTE", 14}, {"LMOV", 14}, {"LOGI", 14},
+    {"LOWM", 14}, {"LREC", 14}, {"LRES", 14}, {"LSBE", 14}, {"LSEI", 14}, {"LSHA", 14},
+    {"LTSI", 14}, {"LUEH", 14}, {"LWIL", 14}, {"LXCT", 14}, {"LYBU", 14}, {"LYOF", 14},
+    {"LYSP", 14}, {"MANC", 14}, {"MANP", 14}, {"MAPN", 14}, {"MART", 14}, {"MEBE", 14},
+    {"MEIT", 14}, {"MERT", 14}, {"METS", 14}, {"MISA", 14}, {"MNOW", 14}, {"MOFC", 14},
+    {"MOON", 14}, {"MPLA", 14}, {"MPTT", 14}, {"MREC", 14}, {"MTIM", 14}, {"MTOD", 14},
+    {"NALD", 14}, {"NALE", 14}, {"NASH", 14}, {"NBEP", 14}, {"NBLA", 14}, {"NCHF", 14},
+    {"NCHR", 14}, {"NDAU", 14}, {"NEIG", 14}, {"NELE", 14}, {"NFRE", 14}, {"NGBA", 14},
+    {"NGEQ", 14}, {"NGIM", 14}, {"NGIV", 14}, {"NGNA", 14}, {"NGOI", 14}, {"NGPE", 14},
+    {"NGRI", 14}, {"NHIS", 14}, {"NISG", 14}, {"NLOO", 14}, {"NLYL", 14}, {"NLYM", 14},
+    {"NOFV", 14}, {"NOOT", 14}, {"NSDE", 14}, {"NSEH", 14}, {"NTBO", 14}, {"NTDE", 14},
+    {"NTNE", 14}, {"NTSR", 14}, {"NTTE", 14}, {"NWOU", 14}, {"NYBO", 14}, {"NYSO", 14},
+    {"NYVE", 14}, {"OAGR", 14}, {"OARE", 14}, {"OBSW", 14}, {"OBUL", 14}, {"OCAU", 14},
+    {"OCOU", 14}, {"ODEP", 14}, {"ODEV", 14}, {"ODOI", 14}, {"ODYT", 14}, {"OENT", 14},
+    {"OESA", 14}, {"OFFF", 14}, {"OFMY", 14}, {"OFST", 14}, {"OFTT", 14}, {"OJEC", 14},
+    {"OLAR", 14}, {"OLDC", 14}, {"OLDV", 14}, {"OMAI", 14}, {"OMAS", 14}, {"OMPE", 14},
+    {"OMSU", 14}, {"OMTI", 14}, {"ONAF", 14}, {"ONBL", 14}, {"ONDW", 14}, {"ONGO", 14},
+    {"OODI", 14}, {"OOUT", 14}, {"OOVE", 14}, {"OPPD", 14}, {"OQUI", 14}, {"ORMM", 14},
+    {"OROP", 14}, {"ORSL", 14}, {"ORSW", 14}, {"ORYF", 14}, {"OSSO", 14}, {"OTAB", 14},
+    {"OTHN", 14}, {"OTIF", 14}, {"OTRY", 14}, {"OUFR", 14}, {"OUJU", 14}, {"OULE", 14},
+    {"OUSW", 14}, {"OWLY", 14}, {"PARI", 14}, {"PICU", 14}, {"PINS", 14}, {"PPAR", 14},
+    {"PRIC", 14}, {"PROF", 14}, {"PROX", 14}, {"PTHA", 14}, {"PTIT", 14}, {"PTYO", 14},
+    {"PUTO", 14}, {"PWAR", 14}, {"RARG", 14}, {"RBOS", 14}, {"RCTR", 14}, {"RDEL", 14},
+    {"RDOF", 14}, {"REAV", 14}, {"REXE", 14}, {"RFIT", 14}, {"RGES", 14}, {"RHEL", 14},
+    {"RICE", 14}, {"RLEN", 14}, {"ROFE", 14}, {"ROJE", 14}, {"ROML", 14}, {"RORG", 14},
+    {"RPAT", 14}, {"RRUP", 14}, {"RSEN", 14}, {"RTOM", 14}, {"RUME", 14}, {"RUTH", 14},
+    {"RYVI", 14}, {"SAFI", 14}, {"SALA", 14}, {"SALE", 14}, {"SANU", 14}, {"SASC", 14},
+    {"SASH", 14}, {"SBOT", 14}, {"SCIR", 14}, {"SCRA", 14}, {"SCTH", 14}, {"SDEG", 14},
+    {"SECL", 14}, {"SFIT", 14}, {"SGOT", 14}, {"SHON", 14}, {"SIFA", 14}, {"SIFI", 14},
+    {"SITH", 14}, {"SITN", 14}, {"SLYI", 14}, {"SMED", 14}, {"SNON", 14}, {"SNTS", 14},
+    {"SOFH", 14}, {"SOLA", 14}, {"SORU", 14}, {"SOSE", 14}, {"SSCA", 14}, {"SSLY", 14},
+    {"STAP", 14}, {"STGE", 14}, {"SUSU", 14}, {"SVOI", 14}, {"TARS", 14}, {"TASS", 14},
+    {"TAXG", 14}, {"TCAL", 14}, {"TCTH", 14}, {"TDID", 14}, {"TEAW", 14}, {"TESF", 14},
+    {"TEXE", 14}, {"THAF", 14}, {"TIGA", 14}, {"TINL", 14}, {"TISG", 14}, {"TLAT", 14},
+    {"TMED", 14}, {"TMIN", 14}, {"TOER", 14}, {"TOVA", 14}, {"TQUI", 14}, {"TRLR", 14},
+    {"TRLT", 14}, {"TRUT", 14}, {"TSIS", 14}, {"TSLO", 14}, {"TUNL", 14}, {"TUSR", 14},
+    {"TXTC", 14}, {"UBDU", 14}, {"UCES", 14}, {"UCIN", 14}, {"UDEO", 14}, {"UDOT", 14},
+    {"UFRO", 14}, {"UMET", 14}, {"UMPB", 14}, {"UNTA", 14}, {"UREL", 14}, {"URPE", 14},
+    {"URSR", 14}, {"URSU", 14}, {"USEG", 14}, {"UTDO", 14}, {"UTIS", 14}, {"UWIS", 14},
+    {"VARY", 14}, {"VECH", 14}, {"WECA", 14}, {"WELV", 14}, {"WHOM", 14}, {"WILD", 14},
+    {"WOBE", 14}, {"WOGL", 14}, {"WSAN", 14}, {"WSCO", 14}, {"XCHA", 14}, {"XITE", 14},
+    {"XTVI", 14}, {"YBRO", 14}, {"YFAC", 14}, {"YFIR", 14}, {"YHAS", 14}, {"YHEA", 14},
+    {"YINF", 14}, {"YNCH", 14}, {"YOUJ", 14}, {"YOUY", 14}, {"YPRI", 14}, {"YSCA", 14},
+    {"ABEA", 13}, {"ABLO", 13}, {"ACAN", 13}, {"ACEF", 13}, {"ACKB", 13}, {"ACKO", 13},
+    {"ACUO", 13}, {"ADJA", 13}, {"ADME", 13}, {"ADON", 13}, {"ADOU", 13}, {"AFRO", 13},
+    {"AGNE", 13}, {"AHOL", 13}, {"AIDT", 13}, {"AILE", 13}, {"AIMI", 13}, {"AINF", 13},
+    {"AINM", 13}, {"AIVE", 13}, {"AKEE", 13}, {"ALAC", 13}, {"ALFU", 13}, {"ALKE", 13},
+    {"ALLG", 13}, {"ALNO", 13}, {"ALNU", 13}, {"ALOB", 13}, {"ALVI", 13}, {"AMAC", 13},
+    {"AMBL", 13}, {"AMSP", 13}, {"ANDZ", 13}, {"ANIC", 13}, {"ANSC", 13}, {"ANSH", 13},
+    {"ANWH", 13}, {"APHY", 13}, {"ARDC", 13}, {"ARDV", 13}, {"ARUS", 13}, {"ARVE", 13},
+    {"ARYU", 13}, {"ASTP", 13}, {"ASWI", 13}, {"ATEE", 13}, {"ATRI", 13}, {"AVAL", 13},
+    {"AWAR", 13}, {"AXIM", 13}, {"AXIT", 13}, {"AYMO", 13}, {"AYWI", 13}, {"BEWR", 13},
+    {"BGET", 13}, {"BLYA", 13}, {"BOWS", 13}, {"BROK", 13}, {"BSEN", 13}, {"BTAB", 13},
+    {"BULE", 13}, {"BUTH", 13}, {"BYAB", 13}, {"BYTU", 13}, {"CALE", 13}, {"CANH", 13},
+    {"CESC", 13}, {"CHFR", 13}, {"CHMU", 13}, {"CHUS", 13}, {"CKET", 13}, {"CKYO", 13},
+    {"COAL", 13}, {"COHE", 13}, {"COLD", 13}, {"CTAG", 13}, {"CTFI", 13}, {"CTSU", 13},
+    {"DATL", 13}, {"DBYW", 13}, {"DCAS", 13}, {"DEDE", 13}, {"DEMN", 13}, {"DERR", 13},
+    {"DERV", 13}, {"DERY", 13}, {"DESB", 13}, {"DGRO", 13}, {"DIDE", 13}, {"DISI", 13},
+    {"DJAC", 13}, {"DJUS", 13}, {"DMOT", 13}, {"DMUC", 13}, {"DNOR", 13}, {"DOFR", 13},
+    {"DONC", 13}, {"DOWC", 13}, {"DQUI", 13}, {"DRUN", 13}, {"DSEP", 13}, {"DSIM", 13},
+    {"DSOB", 13}, {"DTHS", 13}, {"DTON", 13}, {"EADM", 13}, {"EAFU", 13}, {"EASH", 13},
+    {"EAWH", 13}, {"EBOO", 13}, {"EBYI", 13}, {"EDAM", 13}, {"EDTI", 13}, {"EEFR", 13},
+    {"EEKA", 13}, {"EENG", 13}, {"EEVI", 13}, {"EFFO", 13}, {"EHYP", 13}, {"EINL", 13},
+    {"EINR", 13}, {"EIRN", 13}, {"ELFM", 13}, {"ELYC", 13}, {"ELYD", 13}, {"EMAX", 13},
+    {"EMBO", 13}, {"EMNI", 13}, {"ENAF", 13}, {"ENDM", 13}, {"ENEI", 13}, {"ENIC", 13},
+    {"ENPA", 13}, {"ENPO", 13}, {"EORU", 13}, {"ESAW", 13}, {"ESOB", 13}, {"ETBU", 13},
+    {"ETDO", 13}, {"ETHT", 13}, {"ETSG", 13}, {"EUSR", 13}, {"EWON", 13}, {"EWRO", 13},
+    {"EWST", 13}, {"EXTG", 13}, {"EYSE", 13}, {"FADD", 13}, {"FAMI", 13}, {"FAPR", 13},
+    {"FARE", 13}, {"FBUT", 13}, {"FEWM", 13}, {"FGRA", 13}, {"FIGB", 13}, {"FINS", 13},
+    {"FITB", 13}, {"FIXT", 13}, {"FKEY", 13}, {"FSHA", 13}, {"FTED", 13}, {"FULI", 13},
+    {"GALE", 13}, {"GALR", 13}, {"GANA", 13}, {"GBAC", 13}, {"GETB", 13}, {"GETW", 13},
+    {"GHTU", 13}, {"GHWH", 13}, {"GLED", 13}, {"GMOT", 13}, {"GNIT", 13}, {"GONA", 13},
+    {"GPOW", 13}, {"GPRE", 13}, {"GREF", 13}, {"GSYS", 13}, {"GTOF", 13}, {"GTOG", 13},
+    {"GTOO", 13}, {"GUIV", 13}, {"HADT", 13}, {"HANF", 13}, {"HATG", 13}, {"HBET", 13},
+    {"HDIS", 13}, {"HEAF", 13}, {"HEEQ", 13}, {"HEMD", 13}, {"HESS", 13}, {"HEYR", 13},
+    {"HFLO", 13}, {"HICA", 13}, {"HINF", 13}, {"HITI", 13}, {"HOLL", 13}, {"HOPE", 13},
+    {"HPRI", 13}, {"HSOU", 13}, {"HTOG", 13}, {"HTSH", 13}, {"HUNI", 13}, {"HURE", 13},
+    {"HUSA", 13}, {"HYTH", 13}, {"ICHG", 13}, {"ICLY", 13}, {"ICTE", 13}, {"IDIA", 13},
+    {"IDIT", 13}, {"IFAB", 13}, {"IFLI", 13}, {"IGOB", 13}, {"ILEG", 13}, {"IMEW", 13},
+    {"IMFT", 13}, {"IMKN", 13}, {"IMNO", 13}, {"IMPI", 13}, {"IMSY", 13}, {"INCF", 13},
+    {"INDB", 13}, {"INHE", 13}, {"INIF", 13}, {"INMI", 13}, {"INSF", 13}, {"INSN", 13},
+    {"IONK", 13}, {"IORI", 13}, {"IPTV", 13}, {"IRDA", 13}, {"ISFU", 13}, {"ISOB", 13},
+    {"ITAC", 13}, {"ITIG", 13}, {"ITIV", 13}, {"IWAS", 13}, {"IXAN", 13}, {"IXDW", 13},
+    {"KEDT", 13}, {"KERA", 13}, {"KERE", 13}, {"KEYA", 13}, {"KFRO", 13}, {"KGRO", 13},
+    {"KIFY", 13}, {"KSIF", 13}, {"KSTO", 13}, {"KTOW", 13}, {"LACT", 13}, {"LARV", 13},
+    {"LAWO", 13}, {"LBEL", 13}, {"LBYT", 13}, {"LDON", 13}, {"LDOT", 13}, {"LELS", 13},
+    {"LETR", 13}, {"LGAR", 13}, {"LHEL", 13}, {"LLIF", 13}, {"LLRU", 13}, {"LLSI", 13},
+    {"LLTA", 13}, {"LLUN", 13}, {"LNOW", 13}, {"LOCI", 13}, {"LONL", 13}, {"LOWC", 13},
+    {"LOWN", 13}, {"LPAT", 13}, {"LPHI", 13}, {"LRUN", 13}, {"LTKE", 13}, {"LUGT", 13},
+    {"LYEN", 13}, {"LYSI", 13}, {"LYSU", 13}, {"MABC", 13}, {"MAXI", 13}, {"MDBU", 13},
+    {"MEBI", 13}, {"MELA", 13}, {"MESC", 13}, {"MEUS", 13}, {"MIDI", 13}, {"MKDI", 13},
+    {"MMAY", 13}, {"MONT", 13}, {"MORW", 13}, {"MREM", 13}, {"MRMU", 13}, {"MSBE", 13},
+    {"MSFO", 13}, {"MSHO", 13}, {"MSYN", 13}, {"MTOU", 13}, {"MYSE", 13}, {"NALW", 13},
+    {"NASP", 13}, {"NATO", 13}, {"NAVA", 13}, {"NAVE", 13}, {"NBEH", 13}, {"NBEM", 13},
+    {"NBER", 13}, {"NCAU", 13}, {"NCEV", 13}, {"NCTE", 13}, {"NDOA", 13}, {"NDOB", 13},
+    {"NDUC", 13}, {"NEFF", 13}, {"NELC", 13}, {"NETE", 13}, {"NEVI", 13}, {"NEWS", 13},
+    {"NFOT", 13}, {"NGUL", 13}, {"NLYU", 13}, {"NOTV", 13}, {"NOTY", 13}, {"NOWP", 13},
+    {"NPAG", 13}, {"NQUA", 13}, {"NREL", 13}, {"NSAD", 13}, {"NSBY", 13}, {"NSHE", 13},
+    {"NSST", 13}, {"NTTA", 13}, {"NUPO", 13}, {"NVAC", 13}, {"NWHA", 13}, {"NWHY", 13},
+    {"NYTE", 13}, {"OASS", 13}, {"OBRE", 13}, {"OCIT", 13}, {"OEAC", 13}, {"OERR", 13},
+    {"OFEI", 13}, {"OFEX", 13}, {"OFLE", 13}, {"OITY", 13}, {"OLLY", 13}, {"OMEV", 13},
+    {"OMMI", 13}, {"OMOD", 13}, {"ONDB", 13}, {"ONTF", 13}, {"ONTM", 13}, {"OPAN", 13},
+    {"OPET", 13}, {"ORDP", 13}, {"ORMW", 13}, {"ORSF", 13}, {"ORYC", 13}, {"ORYV", 13},
+    {"OSCR", 13}, {"OSOA", 13}, {"OSUB", 13}, {"OSUR", 13}, {"OTAC", 13}, {"OTSA", 13},
+    {"OURN", 13}, {"OUWR", 13}, {"OVEP", 13}, {"OWAB", 13}, {"OWNL", 13}, {"PEER", 13},
+    {"PEFO", 13}, {"PEIN", 13}, {"PEIS", 13}, {"PERE", 13}, {"PROA", 13}, {"PUTR", 13},
+    {"PWHI", 13}, {"QUAF", 13}, {"RAMU", 13}, {"RATL", 13}, {"RBLO", 13}, {"RBOD", 13},
+    {"RBYR", 13}, {"RBYS", 13}, {"RDEC", 13}, {"RDFR", 13}, {"RDLY", 13}, {"RDSU", 13},
+    {"REBU", 13}, {"RESW", 13}, {"RETY", 13}, {"RHEA", 13}, {"RIKE", 13}, {"RINI", 13},
+    {"RISO", 13}, {"RKEX", 13}, {"RKSE", 13}, {"RLYI", 13}, {"RNSE", 13}, {"RNST", 13},
+    {"ROAC", 13}, {"ROBS", 13}, {"ROFS", 13}, {"ROMY", 13}, {"RONA", 13}, {"RONM", 13},
+    {"ROPX", 13}, {"RORW", 13}, {"RRAD", 13}, {"RREL", 13}, {"RRIS", 13}, {"RSMI", 13},
+    {"RTBE", 13}, {"RTIF", 13}, {"RTII", 13}, {"RTON", 13}, {"RTSS", 13}, {"RUBY", 13},
+    {"RUMO", 13}, {"RVEI", 13}, {"RVIO", 13}, {"RYEX", 13}, {"RYSM", 13}, {"RYWA", 13},
+    {"SABI", 13}, {"SAFU", 13}, {"SASL", 13}, {"SAVI", 13}, {"SBYP", 13}, {"SEAB", 13},
+    {"SEDH", 13}, {"SEEF", 13}, {"SEER", 13}, {"SEHA", 13}, {"SENA", 13}, {"SESG", 13},
+    {"SETM", 13}, {"SEYE", 13}, {"SFIE", 13}, {"SGLO", 13}, {"SHCO", 13}, {"SIDI", 13},
+    {"SINR", 13}, {"SISO", 13}, {"SISP", 13}, {"SMES", 13}, {"SMWA", 13}, {"SMWH", 13},
+    {"SNEA", 13}, {"SNUM", 13}, {"SODO", 13}, {"SOIS", 13}, {"SPEA", 13}, {"SPEN", 13},
+    {"SSAL", 13}, {"SSOO", 13}, {"STLU", 13}, {"STOV", 13}, {"STPL", 13}, {"STUP", 13},
+    {"SYET", 13}, {"TACL", 13}, {"TALK", 13}, {"TARO", 13}, {"TBEU", 13}, {"TBOT", 13},
+    {"TCHG", 13}, {"TCHM", 13}, {"TEAF", 13}, {"TEET", 13}, {"TEIF", 13}, {"TEOP", 13},
+    {"TESY", 13}, {"TETE", 13}, {"TGOO", 13}, {"THBL", 13}, {"THCT", 13}, {"TISK", 13},
+    {"TKEE", 13}, {"TLAW", 13}, {"TLOA", 13}, {"TLYS", 13}, {"TLYU", 13}, {"TMET", 13},
+    {"TNOC", 13}, {"TOBR", 13}, {"TOEA", 13}, {"TONM", 13}, {"TOOK", 13}, {"TRAL", 13},
+    {"TSGO", 13}, {"TSUF", 13}, {"TTON", 13}, {"TURB", 13}, {"UAFO", 13}, {"UBER", 13},
+    {"UDEP", 13}, {"UEFO", 13}, {"UESS", 13}, {"UGHO", 13}, {"UGTY", 13}, {"ULDO", 13},
+    {"ULDW", 13}, {"ULGA", 13}, {"UMTO", 13}, {"UNDF", 13}, {"UNTW", 13}, {"URAC", 13},
+    {"URDI", 13}, {"URWI", 13}, {"USUS", 13}, {"UTAF", 13}, {"UTFI", 13}, {"VABL", 13},
+    {"VEPA", 13}, {"VETE", 13}, {"VEUN", 13}, {"VIDI", 13}, {"VULG", 13}, {"WAIV", 13},
+    {"WASF", 13}, {"WASG", 13}, {"WAYF", 13}, {"WDTH", 13}, {"WEDI", 13}, {"WHOW", 13},
+    {"WINE", 13}, {"WNTO", 13}, {"WSET", 13}, {"WTOD", 13}, {"XDWI", 13}, {"XIMU", 13},
+    {"XTIF", 13}, {"XTIT", 13}, {"YBEG", 13}, {"YBEL", 13}, {"YBEM", 13}, {"YBEO", 13},
+    {"YDES", 13}, {"YFOU", 13}, {"YGET", 13}, {"YGOO", 13}, {"YHAP", 13}, {"YHOM", 13},
+    {"YITT", 13}, {"YMAD", 13}, {"YMEN", 13}, {"YORF", 13}, {"YPIC", 13}, {"YTOC", 13},
+    {"YWAS", 13}, {"YWHA", 13}, {"ABRI", 12}, {"ABSI", 12}, {"ADBE", 12}, {"ADIA", 12},
+    {"ADRA", 12}, {"AFRE", 12}, {"AGEH", 12}, {"AGLA", 12}, {"AIGH", 12}, {"AKEM", 12},
+    {"ALBL", 12}, {"ALCL", 12}, {"ALSB", 12}, {"ALSC", 12}, {"ALTK", 12}, {"ALTS", 12},
+    {"AMEH", 12}, {"AMEK", 12}, {"AMSI", 12}, {"ANCY", 12}, {"ANFO", 12}, {"ANOC", 12},
+    {"ANYG", 12}, {"APOS", 12}, {"APTH", 12}, {"ARFO", 12}, {"ARMA", 12}, {"ARTC", 12},
+    {"ARTM", 12}, {"ARTR", 12}, {"ARVI", 12}, {"ASEW", 12}, {"ASLI", 12}, {"ASTD", 12},
+    {"ATAV", 12}, {"ATSW", 12}, {"AUGH", 12}, {"AUNI", 12}, {"AVEH", 12}, {"AVEW", 12},
+    {"AWSO", 12}, {"AYBY", 12}, {"BEAD", 12}, {"BEAP", 12}, {"BEIM", 12}, {"BETA", 12},
+    {"BEVE", 12}, {"BEWH", 12}, {"BLIN", 12}, {"BORI", 12}, {"BORT", 12}, {"BRES", 12},
+    {"BSIN", 12}, {"BSWH", 12}, {"BTIL", 12}, {"BUIL", 12}, {"BYMO", 12}, {"CALV", 12},
+    {"CANI", 12}, {"CEAD", 12}, {"CEBU", 12}, {"CHCH", 12}, {"CHEL", 12}, {"CHEX", 12},
+    {"CHFE", 12}, {"CHFU", 12}, {"CINN", 12}, {"CKOF", 12}, {"CKRE", 12}, {"CLEO", 12},
+    {"CLET", 12}, {"CQUA", 12}, {"CROW", 12}, {"CTMA", 12}, {"CTUP", 12}, {"DAFI", 12},
+    {"DALO", 12}, {"DASS", 12}, {"DATO", 12}, {"DAWH", 12}, {"DBEM", 12}, {"DCAR", 12},
+    {"DDTO", 12}, {"DECA", 12}, {"DEOU", 12}, {"DERU", 12}, {"DIMP", 12}, {"DINY", 12},
+    {"DISE", 12}, {"DITB", 12}, {"DLAS", 12}, {"DORC", 12}, {"DOWH", 12}, {"DOWL", 12},
+    {"DPOI", 12}, {"DSEN", 12}, {"DSEV", 12}, {"DSIF", 12}, {"DSOU", 12}, {"DSPO", 12},
+    {"DTRU", 12}, {"DUED", 12}, {"DUPW", 12}, {"DURA", 12}, {"DYIS", 12}, {"DYTO", 12},
+    {"EADF", 12}, {"EADV", 12}, {"EAKO", 12}, {"EAKT", 12}, {"EANR", 12}, {"EAOF", 12},
+    {"EARF", 12}, {"EATP", 12}, {"EATW", 12}, {"EAVO", 12}, {"EBAR", 12}, {"EBYC", 12},
+    {"EBYL", 12}, {"EDLY", 12}, {"EDOP", 12}, {"EELA", 12}, {"EENU", 12}, {"EFEC", 12},
+    {"EFTP", 12}, {"EFTS", 12}, {"EGIB", 12}, {"EGOO", 12}, {"EITD", 12}, {"ELDT", 12},
+    {"ELER", 12}, {"ELLB", 12}, {"ELLC", 12}, {"ELOS", 12}, {"ELPI", 12}, {"ELPW", 12},
+    {"ELUM", 12}, {"EMIC", 12}, {"ENAK", 12}, {"ENCH", 12}, {"ENHA", 12}, {"ENWR", 12},
+    {"EOPA", 12}, {"EORG", 12}, {"EPIE", 12}, {"ERDT", 12}, {"ERDW", 12}, {"ERMG", 12},
+    {"ERRA", 12}, {"ERSR", 12}, {"ERYH", 12}, {"ESBR", 12}, {"ESCH", 12}, {"ESOA", 12},
+    {"ESSH", 12}, {"ESTM", 12}, {"ETBA", 12}, {"ETCA", 12}, {"ETEF", 12}, {"ETEM", 12},
+    {"ETEO", 12}, {"ETSM", 12}, {"ETWA", 12}, {"EWDI", 12}, {"EWDT", 12}, {"EWEA", 12},
+    {"EWOF", 12}, {"EXCH", 12}, {"EXIB", 12}, {"EXIN", 12}, {"FAMA", 12}, {"FASH", 12},
+    {"FASP", 12}, {"FERC", 12}, {"FERU", 12}, {"FHIS", 12}, {"FIBR", 12}, {"FITA", 12},
+    {"FNUM", 12}, {"FSOU", 12}, {"FSTR", 12}, {"FSUL", 12}, {"FTHP", 12}, {"FTTA", 12},
+    {"FTYP", 12}, {"GATA", 12}, {"GEBY", 12}, {"GECH", 12}, {"GERB", 12}, {"GERI", 12},
+    {"GESF", 12}, {"GESH", 12}, {"GETE", 12}, {"GHTX", 12}, {"GHTY", 12}, {"GILL", 12},
+    {"GMAD", 12}, {"GMAP", 12}, {"GNOW", 12}, {"GNUF", 12}, {"GOBL", 12}, {"GRIN", 12},
+    {"GSET", 12}, {"GSSH", 12}, {"GTOE", 12}, {"GTOM", 12}, {"GVAR", 12}, {"HADA", 12},
+    {"HBEF", 12}, {"HDON", 12}, {"HEIC", 12}, {"HEIF", 12}, {"HEMP", 12}, {"HENG", 12},
+    {"HEWT", 12}, {"HISK", 12}, {"HMAK", 12}, {"HMAT", 12}, {"HOWW", 12}, {"HSAN", 12},
+    {"HTCY", 12}, {"HTDE", 12}, {"HTEX", 12}, {"HTLA", 12}, {"HTOW", 12}, {"HTPR", 12},
+    {"HTSF", 12}, {"HTTR", 12}, {"IBRE", 12}, {"IDEB", 12}, {"IDEF", 12}, {"IDEY", 12},
+    {"IEDS", 12}, {"IELD", 12}, {"IESE", 12}, {"IETY", 12}, {"IFEX", 12}, {"IFNE", 12},
+    {"IFON", 12}, {"IGNS", 12}, {"IKEO", 12}, {"IMEX", 12}, {"INLY", 12}, {"INSM", 12},
+    {"IREN", 12}, {"IREP", 12}, {"IRVI", 12}, {"ISEB", 12}, {"ISGE", 12}, {"ISTM", 12},
+    {"ISVO", 12}, {"ITFA", 12}, {"ITHX", 12}, {"ITIC", 12}, {"ITMI", 12}, {"IUMB", 12},
+    {"IUMC", 12}, {"IXDB", 12}, {"IXDI", 12}, {"IXFI", 12}, {"IZEO", 12}, {"JAND", 12},
+    {"KEAM", 12}, {"KELY", 12}, {"KEND", 12}, {"KEUP", 12}, {"KLOC", 12}, {"KOFT", 12},
+    {"KSON", 12}, {"KUPO", 12}, {"LABO", 12}, {"LAGT", 12}, {"LARS", 12}, {"LBAC", 12},
+    {"LCAL", 12}, {"LCOR", 12}, {"LDCA", 12}, {"LDFO", 12}, {"LDSW", 12}, {"LEBL", 12},
+    {"LEHO", 12}, {"LEOP", 12}, {"LERT", 12}, {"LETF", 12}, {"LEXT", 12}, {"LFAL", 12},
+    {"LIMA", 12}, {"LLAR", 12}, {"LLRI", 12}, {"LLSC", 12}, {"LLTR", 12}, {"LLYG", 12},
+    {"LNES", 12}, {"LOFA", 12}, {"LOFF", 12}, {"LOGY", 12}, {"LOOR", 12}, {"LORA", 12},
+    {"LPRI", 12}, {"LREM", 12}, {"LSHO", 12}, {"LSIN", 12}, {"LSPE", 12}, {"LTOR", 12},
+    {"LTOS", 12}, {"LURE", 12}, {"LWAN", 12}, {"LYCA", 12}, {"LYEV", 12}, {"LYPA", 12},
+    {"LYSO", 12}, {"LYVA", 12}, {"MAFT", 12}, {"MASI", 12}, {"MAYF", 12}, {"MAYW", 12},
+    {"MBOT", 12}, {"MDIF", 12}, {"MEAL", 12}, {"MEDO", 12}, {"MEDT", 12}, {"MEGE", 12},
+    {"MEIF", 12}, {"MELY", 12}, {"MENO", 12}, {"MEQU", 12}, {"METX", 12}, {"MEXE", 12},
+    {"MFIN", 12}, {"MFTP", 12}, {"MITL", 12}, {"MKNO", 12}, {"MOME", 12}, {"MORY", 12},
+    {"MOZI", 12}, {"MPLU", 12}, {"MSDE", 12}, {"MSOM", 12}, {"MSSO", 12}, {"MTOG", 12},
+    {"MWOR", 12}, {"NATH", 12}, {"NAWO", 12}, {"NCTU", 12}, {"NDAW", 12}, {"NDGI", 12},
+    {"NDNU", 12}, {"NDOS", 12}, {"NDQU", 12}, {"NEAB", 12}, {"NEAF", 12}, {"NEDH", 12},
+    {"NENE", 12}, {"NEWR", 12}, {"NGAD", 12}, {"NGEE", 12}, {"NHER", 12}, {"NMOS", 12},
+    {"NNES", 12}, {"NNEW", 12}, {"NOBS", 12}, {"NORW", 12}, {"NOSE", 12}, {"NOWR", 12},
+    {"NPAC", 12}, {"NRAN", 12}, {"NREC", 12}, {"NSEG", 12}, {"NSFI", 12}, {"NSGE", 12},
+    {"NSWA", 12}, {"NTNU", 12}, {"NTSB", 12}, {"NUFR", 12}, {"NUST", 12}, {"NWER", 12},
+    {"NYAS", 12}, {"NYFI", 12}, {"OALT", 12}, {"OARG", 12}, {"OBEW", 12}, {"ODOA", 12},
+    {"ODOW", 12}, {"ODTH", 12}, {"OENS", 12}, {"OESC", 12}, {"OESW", 12}, {"OFBU", 12},
+    {"OFGO", 12}, {"OFRO", 12}, {"OIFY", 12}, {"OITT", 12}, {"OKOF", 12}, {"OLEG", 12},
+    {"OMAD", 12}, {"ONFL", 12}, {"ONIZ", 12}, {"ONKE", 12}, {"ONOP", 12}, {"ONTS", 12},
+    {"OOLS", 12}, {"OOMA", 12}, {"OPAT", 12}, {"OPSO", 12}, {"OPYL", 12}, {"ORDL", 12},
+    {"OROB", 12}, {"ORSS", 12}, {"ORSY", 12}, {"ORTN", 12}, {"ORYU", 12}, {"OTYE", 12},
+    {"OUNG", 12}, {"OUPA", 12}, {"OURH", 12}, {"OYEL", 12}, {"OZIL", 12}, {"PEAK", 12},
+    {"PERG", 12}, {"PICA", 12}, {"PLEH", 12}, {"PLER", 12}, {"PLOR", 12}, {"POTW", 12},
+    {"PTOR", 12}, {"RACH", 12}, {"RAIG", 12}, {"RAMC", 12}, {"RANK", 12}, {"RBOL", 12},
+    {"RCRY", 12}, {"RDBY", 12}, {"RDVE", 12}, {"REBL", 12}, {"REDN", 12}, {"REER", 12},
+    {"REIL", 12}, {"REMP", 12}, {"RKLO", 12}, {"RKNE", 12}, {"RKRE", 12}, {"RLAT", 12},
+    {"RLOO", 12}, {"RLYS", 12}, {"RLYT", 12}, {"RMET", 12}, {"RMGE", 12}, {"RMSE", 12},
+    {"RNER", 12}, {"RNIS", 12}, {"ROCA", 12}, {"ROFI", 12}, {"ROIL", 12}, {"ROMD", 12},
+    {"ROPP", 12}, {"ROPV", 12}, {"RORD", 12}, {"ROSO", 12}, {"ROWE", 12}, {"ROXY", 12},
+    {"RSDE", 12}, {"RSEP", 12}, {"RSEX", 12}, {"RSFI", 12}, {"RSMO", 12}, {"RSSE", 12},
+    {"RSSU", 12}, {"RSTW", 12}, {"RSUN", 12}, {"RTCU", 12}, {"RTEE", 12}, {"RTWH", 12},
+    {"RTYS", 12}, {"RUED", 12}, {"RUMT", 12}, {"RUNA", 12}, {"RVEA", 12}, {"RWAT", 12},
+    {"RYEL", 12}, {"RYNA", 12}, {"SANI", 12}, {"SAPA", 12}, {"SASM", 12}, {"SATR", 12},
+    {"SBUF", 12}, {"SCHO", 12}, {"SDEN", 12}, {"SEHE", 12}, {"SEOT", 12}, {"SESC", 12},
+    {"SESY", 12}, {"SEXH", 12}, {"SHUM", 12}, {"SILE", 12}, {"SINB", 12}, {"SISV", 12},
+    {"SLEC", 12}, {"SMSW", 12}, {"SNEC", 12}, {"SOFU", 12}, {"SOIT", 12}, {"SOLO", 12},
+    {"SORK", 12}, {"SOTO", 12}, {"SOUG", 12}, {"SPAT", 12}, {"SPOR", 12}, {"SRAN", 12},
+    {"SRIG", 12}, {"SSAS", 12}, {"SSAV", 12}, {"SSON", 12}, {"SSPA", 12}, {"SSUE", 12},
+    {"STOY", 12}, {"STRY", 12}, {"STTE", 12}, {"SUMM", 12}, {"SUNM", 12}, {"TABW", 12},
+    {"TAMO", 12}, {"TARI", 12}, {"TASH", 12}, {"TAUG", 12}, {"TBYI", 12}, {"TBYM", 12},
+    {"TCHC", 12}, {"TCIR", 12}, {"TCOR", 12}, {"TESE", 12}, {"TETR", 12}, {"TEVI", 12},
+    {"TEYE", 12}, {"THEZ", 12}, {"THFL", 12}, {"THLI", 12}, {"TICP", 12}, {"TIFA", 12},
+    {"TITF", 12}, {"TLAS", 12}, {"TLEI", 12}, {"TNEA", 12}, {"TORL", 12}, {"TSAY", 12},
+    {"TSBR", 12}, {"TSEM", 12}, {"TSER", 12}, {"TSKI", 12}, {"TSOE", 12}, {"TTAG", 12},
+    {"TVAN", 12}, {"TWAT", 12}, {"TYRE", 12}, {"UBTE", 12}, {"UCTS", 12}, {"UEHA", 12},
+    {"UEOR", 12}, {"UESA", 12}, {"UEXE", 12}, {"UGHP", 12}, {"UGHS", 12}, {"ULDR", 12},
+    {"UMEX", 12}, {"UMIS", 12}, {"UMNO", 12}, {"UMNS", 12}, {"UMOV", 12}, {"UMSA", 12},
+    {"UNDM", 12}, {"UNDN", 12}, {"UNDP", 12}, {"UNPA", 12}, {"URAS", 12}, {"UREF", 12},
+    {"UREV", 12}, {"URGE", 12}, {"UROR", 12}, {"UTHA", 12}, {"UTIL", 12}, {"UTOI", 12},
+    {"UTOS", 12}, {"UTTW", 12}, {"VEAB", 12}, {"VEFR", 12}, {"VEHE", 12}, {"VENW", 12},
+    {"VERU", 12}, {"VESB", 12}, {"VESF", 12}, {"VETI", 12}, {"VIML", 12}, {"VITI", 12},
+    {"WABO", 12}, {"WARM", 12}, {"WASL", 12}, {"WATC", 12}, {"WERF", 12}, {"WEUS", 12},
+    {"WGNU", 12}, {"WMAN", 12}, {"WNEX", 12}, {"WNLO", 12}, {"WONE", 12}, {"WOOF", 12},
+    {"WORR", 12}, {"WROT", 12}, {"XLIN", 12}, {"XTOF", 12}, {"XWIN", 12}, {"XYOU", 12},
+    {"YACT", 12}, {"YARI", 12}, {"YFOL", 12}, {"YINV", 12}, {"YLEF", 12}, {"YLET", 12},
+    {"YMOT", 12}, {"YOFC", 12}, {"YRED", 12}, {"YREL", 12}, {"YSBY", 12}, {"YSMO", 12},
+    {"YTOF", 12}, {"YUNL", 12}, {"ZEOF", 12}, {"ZILL", 12}, {"ABCD", 11}, {"ABTH", 11},
+    {"ADAS", 11}, {"ADMI", 11}, {"ADNO", 11}, {"ADUE", 11}, {"ADYH", 11}, {"ADYT", 11},
+    {"AGBH", 11}, {"AGEE", 11}, {"AILU", 11}, {"AINN", 11}, {"AINU", 11}, {"ALCA", 11},
+    {"ALET", 11}, {"ALHE", 11}, {"ALLL", 11}, {"ALRA", 11}, {"ALSH", 11}, {"AMEU", 11},
+    {"ANEI", 11}, {"ANGO", 11}, {"ANPU", 11}, {"ANSY", 11}, {"APSC", 11}, {"APTO", 11},
+    {"AQUI", 11}, {"ARAR", 11}, {"ARDY", 11}, {"AREX", 11}, {"ARFI", 11}, {"ARIG", 11},
+    {"ARNE", 11}, {"ARSO", 11}, {"ARWI", 11}, {"ASLA", 11}, {"ASOR", 11}, {"ASPO", 11},
+    {"ASSF", 11}, {"ATHF", 11}, {"ATXT", 11}, {"AVEE", 11}, {"AVEU", 11}, {"AVEY", 11},
+    {"AVOL", 11}, {"AWIT", 11}, {"AYAR", 11}, {"BALL", 11}, {"BEAG", 11}, {"BEGR", 11},
+    {"BERC", 11}, {"BERN", 11}, {"BETI", 11}, {"BITO", 11}, {"BLYC", 11}, {"BLYI", 11},
+    {"BSAN", 11}, {"BSEC", 11}, {"BTRA", 11}, {"BUND", 11}, {"BYON", 11}, {"BYSI", 11},
+    {"BYVA", 11}, {"CARD", 11}, {"CCEL", 11}, {"CEAR", 11}, {"CEWA", 11}, {"CFRE", 11},
+    {"CHHI", 11}, {"CHIE", 11}, {"CHLO", 11}, {"CHOA", 11}, {"CHOC", 11}, {"CHTE", 11},
+    {"CINT", 11}, {"CIPR", 11}, {"CISI", 11}, {"CLEF", 11}, {"CLOT", 11}, {"CONE", 11},
+    {"CORE", 11}, {"CYEA", 11}, {"DAMO", 11}, {"DANG", 11}, {"DAPR", 11}, {"DARI", 11},
+    {"DASY", 11}, {"DAWO", 11}, {"DBER", 11}, {"DBLA", 11}, {"DBYL", 11}, {"DCIR", 11},
+    {"DDAD", 11}, {"DEBE", 11}, {"DEDC", 11}, {"DEGM", 11}, {"DFIG", 11}, {"DFIX", 11},
+    {"DIRV", 11}, {"DISR", 11}, {"DLEF", 11}, {"DMEE", 11}, {"DNES", 11}, {"DOCO", 11},
+    {"DORE", 11}, {"DRAR", 11}, {"DSCR", 11}, {"DSFR", 11}, {"DSHE", 11}, {"DSUF", 11},
+    {"DTAK", 11}, {"DWHO", 11}, {"DYHA", 11}, {"DYTH", 11}, {"EABA", 11}, {"EABI", 11},
+    {"EABS", 11}, {"EALW", 11}, {"EAMI", 11}, {"EATN", 11}, {"EBOA", 11}, {"EBOW", 11},
+    {"ECKF", 11}, {"ECKS", 11}, {"ECLE", 11}, {"ECRO", 11}, {"EDGR", 11}, {"EDIV", 11},
+    {"EDOB", 11}, {"EDOW", 11}, {"EDPL", 11}, {"EDWE", 11}, {"EEAL", 11}, {"EEFI", 11},
+    {"EEIS", 11}, {"EEMD", 11}, {"EEXH", 11}, {"EFLU", 11}, {"EFTT", 11}, {"EINY", 11},
+    {"EIRB", 11}, {"EITL", 11}, {"EITR", 11}, {"ELIE", 11}, {"ELLP", 11}, {"EMCO", 11},
+    {"EMFR", 11}, {"EMMA", 11}, {"EMSU", 11}, {"EMVI", 11}, {"ENLO", 11}, {"ENOP", 11},
+    {"ENTG", 11}, {"ENUC", 11}, {"ENUO", 11}, {"ENWE", 11}, {"EOUR", 11}, {"EPOL", 11},
+    {"ERMT", 11}, {"ESEQ", 11}, {"ESKI", 11}, {"ESLA", 11}, {"ESSY", 11}, {"ESTU", 11},
+    {"ETCM", 11}, {"ETCT", 11}, {"ETCU", 11}, {"ETEI", 11}, {"ETFA", 11}, {"ETMO", 11},
+    {"ETRY", 11}, {"ETUN", 11}, {"ETUS", 11}, {"EUPT", 11}, {"EWRA", 11}, {"EXCO", 11},
+    {"EXHA", 11}, {"EYSA", 11}, {"FACH", 11}, {"FADI", 11}, {"FALA", 11}, {"FANT", 11},
+    {"FAVA", 11}, {"FEAN", 11}, {"FEEF", 11}, {"FEQU", 11}, {"FHOW", 11}, {"FICL", 11},
+    {"FICP", 11}, {"FIDE", 11}, {"FNEW", 11}, {"FOGE", 11}, {"FPAT", 11}, {"FTHF", 11},
+    {"GAGA", 11}, {"GAPA", 11}, {"GASI", 11}, {"GAST", 11}, {"GASY", 11}, {"GDIR", 11},
+    {"GEAT", 11}, {"GEDF", 11}, {"GEJU", 11}, {"GEPR", 11}, {"GETY", 11}, {"GEUS", 11},
+    {"GEXE", 11}, {"GHYO", 11}, {"GIFT", 11}, {"GIMA", 11}, {"GIVI", 11}, {"GLYR", 11},
+    {"GNUO", 11}, {"GOBS", 11}, {"GOFF", 11}, {"GOPT", 11}, {"GREW", 11}, {"GSHA", 11},
+    {"GSUP", 11}, {"GSWE", 11}, {"GTWO", 11}, {"GUIT", 11}, {"HABE", 11}, {"HABO", 11},
+    {"HARS", 11}, {"HASF", 11}, {"HAWO", 11}, {"HDAM", 11}, {"HEAS", 11}, {"HEAV", 11},
+    {"HECP", 11}, {"HEGP", 11}, {"HITW", 11}, {"HLSE", 11}, {"HNOW", 11}, {"HONT", 11},
+    {"HORW", 11}, {"HOST", 11}, {"HOWN", 11}, {"HREV", 11}, {"HROW", 11}, {"HTAP", 11},
+    {"HTCF", 11}, {"HTDI", 11}, {"HTHR", 11}, {"HTNE", 11}, {"IALA", 11}, {"IALT", 11},
+    {"ICKI", 11}, {"ICTR", 11}, {"IDEE", 11}, {"IDEL", 11}, {"IERI", 11}, {"IESH", 11},
+    {"IESN", 11}, {"IETH", 11}, {"IEWR", 11}, {"IFEN", 11}, {"IFIA", 11}, {"IFIF", 11},
+    {"IFVI", 11}, {"IFWE", 11}, {"IGIL", 11}, {"IINT", 11}, {"ILAN", 11}, {"ILUR", 11},
+    {"ILYU", 11}, {"IMMA", 11}, {"INFA", 11}, {"INGQ", 11}, {"INHI", 11}, {"INRA", 11},
+    {"INUN", 11}, {"IONJ", 11}, {"IPPE", 11}, {"IRDF", 11}, {"IRER", 11}, {"IRMO", 11},
+    {"IRRI", 11}, {"IRTY", 11}, {"ISEQ", 11}, {"ISGO", 11}, {"ISMD", 11}, {"ISUP", 11},
+    {"ISWR", 11}, {"ITAW", 11}, {"IUME", 11}, {"IUMW", 11}, {"IVIE", 11}, {"IYOU", 11},
+    {"JORC", 11}, {"JUDG", 11}, {"KEMO", 11}, {"KEPR", 11}, {"KEXC", 11}, {"KNEW", 11},
+    {"KOFA", 11}, {"KPRO", 11}, {"KRIN", 11}, {"KSAN", 11}, {"KSOR", 11}, {"KVIM", 11},
+    {"LAMI", 11}, {"LARM", 11}, {"LCLI", 11}, {"LDIR", 11}, {"LDLO", 11}, {"LDOC", 11},
+    {"LDOE", 11}, {"LDSU", 11}, {"LDWO", 11}, {"LEMI", 11}, {"LFRO", 11}, {"LIFO", 11},
+    {"LIGN", 11}, {"LLIC", 11}, {"LMED", 11}, {"LOPT", 11}, {"LORT", 11}, {"LRED", 11},
+    {"LSOP", 11}, {"LSUC", 11}, {"LSUR", 11}, {"LSYO", 11}, {"LTAK", 11}, {"LTCO", 11},
+    {"LTLY", 11}, {"LTYP", 11}, {"LUEF", 11}, {"LUMA", 11}, {"LUMT", 11}, {"LYAD", 11},
+    {"LYNE", 11}, {"LYOV", 11}, {"LYPL", 11}, {"MAPI", 11}, {"MAST", 11}, {"MBEF", 11},
+    {"MBEI", 11}, {"MEBA", 11}, {"MEKI", 11}, {"MISR", 11}, {"MLIB", 11}, {"MOFS", 11},
+    {"MOIS", 11}, {"MORT", 11}, {"MPAC", 11}, {"MPBA", 11}, {"MPLO", 11}, {"MREF", 11},
+    {"MSAB", 11}, {"MSEV", 11}, {"MTOE", 11}, {"MTOR", 11}, {"MUSI", 11}, {"MWHA", 11},
+    {"NAGE", 11}, {"NAGG", 11}, {"NASC", 11}, {"NASU", 11}, {"NAVI", 11}, {"NAVO", 11},
+    {"NBEG", 11}, {"NBEL", 11}, {"NBYD", 11}, {"NBYS", 11}, {"NCAL", 11}, {"NCAT", 11},
+    {"NCFR", 11}, {"NDGE", 11}, {"NDMU", 11}, {"NDRU", 11}, {"NDUE", 11}, {"NEAM", 11},
+    {"NEDR", 11}, {"NEHI", 11}, {"NEME", 11}, {"NERC", 11}, {"NESR", 11}, {"NETX", 11},
+    {"NFER", 11}, {"NFIT", 11}, {"NFOG", 11}, {"NGAV", 11}, {"NGEJ", 11}, {"NGHA", 11},
+    {"NGPU", 11}, {"NGTW", 11}, {"NHUN", 11}, {"NIFS", 11}, {"NINP", 11}, {"NISP", 11},
+    {"NITF", 11}, {"NLYD", 11}, {"NMIX", 11}, {"NOFM", 11}, {"NOFP", 11}, {"NONH", 11},
+    {"NOWM", 11}, {"NPLU", 11}, {"NSAV", 11}, {"NSEU", 11}, {"NSEX", 11}, {"NSNE", 11},
+    {"NTAU", 11}, {"NTCA", 11}, {"NTGE", 11}, {"NTOL", 11}, {"NTOV", 11}, {"NTSN", 11},
+    {"NTVA", 11}, {"NUOR", 11}, {"NWES", 11}, {"NYAT", 11}, {"NYMA", 11}, {"OAVA", 11},
+    {"OCAN", 11}, {"OCKT", 11}, {"OCTA", 11}, {"OFBY", 11}, {"OFEQ", 11}, {"OFLA", 11},
+    {"OFNO", 11}, {"OFTO", 11}, {"OFTY", 11}, {"OFVE", 11}, {"OINI", 11}, {"OINP", 11},
+    {"OKEN", 11}, {"OLAS", 11}, {"OLCO", 11}, {"OLIM", 11}, {"OLLI", 11}, {"OMBE", 11},
+    {"ONAG", 11}, {"ONDR", 11}, {"ONJU", 11}, {"ONSV", 11}, {"ONTL", 11}, {"OOKW", 11},
+    {"OPAC", 11}, {"OPEO", 11}, {"OPIT", 11}, {"OPSI", 11}, {"OPYF", 11}, {"ORCI", 11},
+    {"ORCL", 11}, {"ORVA", 11}, {"ORYP", 11}, {"OSOR", 11}, {"OSST", 11}, {"OTCH", 11},
+    {"OTEF", 11}, {"OTFI", 11}, {"OTHC", 11}, {"OTMO", 11}, {"OTST", 11}, {"OUCR", 11},
+    {"OUPU", 11}, {"OWBY", 11}, {"OWNO", 11}, {"OWPR", 11}, {"PALL", 11}, {"PBAC", 11},
+    {"PENI", 11}, {"PILI", 11}, {"PLIN", 11}, {"PLYA", 11}, {"POTS", 11}, {"PTEX", 11},
+    {"PTLO", 11}, {"PTWI", 11}, {"PUTC", 11}, {"PWHE", 11}, {"QUET", 11}, {"RACE", 11},
+    {"RAIL", 11}, {"RALF", 11}, {"RAMV", 11}, {"RAPR", 11}, {"RASE", 11}, {"RAWA", 11},
+    {"RBLU", 11}, {"RBUB", 11}, {"RCER", 11}, {"RDBO", 11}, {"RDSS", 11}, {"RDWH", 11},
+    {"REBR", 11}, {"RECK", 11}, {"REMB", 11}, {"REPT", 11}, {"RERI", 11}, {"RFOL", 11},
+    {"RGVI", 11}, {"RINN", 11}, {"RINR", 11}, {"RISP", 11}, {"RISS", 11}, {"RKFR", 11},
+    {"RKSS", 11}, {"RKSU", 11}, {"RLYE", 11}, {"RMON", 11}, {"RNEA", 11}, {"RNTO", 11},
+    {"RONO", 11}, {"ROSE", 11}, {"RPAS", 11}, {"RPOL", 11}, {"RRUL", 11}, {"RSED", 11},
+    {"RSEO", 11}, {"RSES", 11}, {"RSQU", 11}, {"RSSO", 11}, {"RSVI", 11}, {"RTBY", 11},
+    {"RTHC", 11}, {"RTIL", 11}, {"RTOG", 11}, {"RTWE", 11}, {"RULY", 11}, {"RWAN", 11},
+    {"RYBE", 11}, {"RYGN", 11}, {"RYOB", 11}, {"RYPA", 11}, {"RYSO", 11}, {"RYTI", 11},
+    {"RYTR", 11}, {"SALM", 11}, {"SATO", 11}, {"SCLO", 11}, {"SDIV", 11}, {"SDRA", 11},
+    {"SEAG", 11}, {"SEAU", 11}, {"SEBA", 11}, {"SEBR", 11}, {"SEDY", 11}, {"SEEO", 11},
+    {"SEEV", 11}, {"SEMB", 11}, {"SEPE", 11}, {"SEPL", 11}, {"SEPU", 11}, {"SERH", 11},
+    {"SERW", 11}, {"SEUS", 11}, {"SEWE", 11}, {"SEXT", 11}, {"SFLO", 11}, {"SGLA", 11},
+    {"SHAT", 11}, {"SHEE", 11}, {"SIAN", 11}, {"SIFO", 11}, {"SISR", 11}, {"SLEF", 11},
+    {"SLEG", 11}, {"SNOS", 11}, {"SOCA", 11}, {"SOGR", 11}, {"SONB", 11}, {"SOSO", 11},
+    {"SPAN", 11}, {"SPEL", 11}, {"SSEA", 11}, {"SSEV", 11}, {"STAF", 11}, {"STBU", 11},
+    {"STEF", 11}, {"STEI", 11}, {"STMO", 11}, {"STOL", 11}, {"STTA", 11}, {"SURI", 11},
+    {"SWHY", 11}, {"SWIF", 11}, {"TACE", 11}, {"TAKI", 11}, {"TALB", 11}, {"TARA", 11},
+    {"TASM", 11}, {"TAWI", 11}, {"TCFR", 11}, {"TCUT", 11}, {"TCYE", 11}, {"TDES", 11},
+    {"TEAT", 11}, {"TEAV", 11}, {"TEBO", 11}, {"TEML", 11}, {"TENB", 11}, {"TEPL", 11},
+    {"TERJ", 11}, {"TFAR", 11}, {"TGOE", 11}, {"THFR", 11}, {"THIG", 11}, {"THSA", 11},
+    {"THVA", 11}, {"TIGN", 11}, {"TITH", 11}, {"TLEB", 11}, {"TLEE", 11}, {"TLEG", 11},
+    {"TLEW", 11}, {"TLEY", 11}, {"TLUM", 11}, {"TOCL", 11}, {"TOFV", 11}, {"TOGU", 11},
+    {"TOMY", 11}, {"TONI", 11}, {"TOOB", 11}, {"TOPW", 11}, {"TOSI", 11}, {"TPVI", 11},
+    {"TREL", 11}, {"TRIV", 11}, {"TRLI", 11}, {"TSAB", 11}, {"TSHI", 11}, {"TSIX", 11},
+    {"TUNE", 11}, {"TUPI", 11}, {"TUSO", 11}, {"TWOE", 11}, {"TYIF", 11}, {"UBDI", 11},
+    {"UCET", 11}, {"UCHG", 11}, {"UCHH", 11}, {"UCRE", 11}, {"UDEM", 11}, {"UDID", 11},
+    {"UEDW", 11}, {"UGHY", 11}, {"UIRI", 11}, {"ULDE", 11}, {"ULLI", 11}, {"UMNT", 11},
+    {"UMWH", 11}, {"UNDU", 11}, {"UNRE", 11}, {"UNSD", 11}, {"UNTS", 11}, {"UPRO", 11},
+    {"URAG", 11}, {"URAU", 11}, {"UREY", 11}, {"URPA", 11}, {"URVE", 11}, {"USFO", 11},
+    {"USTG", 11}, {"UTDI", 11}, {"UTEP", 11}, {"UTUS", 11}, {"UWRI", 11}, {"VARA", 11},
+    {"VARN", 11}, {"VEAD", 11}, {"VEEX", 11}, {"VEFE", 11}, {"VEGE", 11}, {"VENC", 11},
+    {"VENE", 11}, {"VEVI", 11}, {"VICI", 11}, {"VIRO", 11}, {"WCTR", 11}, {"WEST", 11},
+    {"WGET", 11}, {"WHYT", 11}, {"WIFY", 11}, {"WNAN", 11}, {"WNCO", 11}, {"WNWA", 11},
+    {"WPRE", 11}, {"WRED", 11}, {"WSHO", 11}, {"WTAB", 11}, {"WTOT", 11}, {"XINC", 11},
+    {"XISA", 11}, {"XTBA", 11}, {"XTPA", 11}, {"YAFF", 11}, {"YAVE", 11}, {"YCAU", 11},
+    {"YCRE", 11}, {"YDIV", 11}, {"YFAI", 11}, {"YGNU", 11}, {"YISA", 11}, {"YNEE", 11},
+    {"YOFI", 11}, {"YOPT", 11}, {"YPEW", 11}, {"YREQ", 11}, {"YRET", 11}, {"YSEQ", 11},
+    {"YSFO", 11}, {"YSID", 11}, {"YSIM", 11}, {"YSOU", 11}, {"YSSH", 11}, {"YSST", 11},
+    {"ABEI", 10}, {"ABER", 10}, {"ABIS", 10}, {"ACEC", 10}, {"ACQU", 10}, {"ADEG", 10},
+    {"ADOR", 10}, {"AESC", 10}, {"AGEG", 10}, {"AGEU", 10}, {"AJEC", 10}, {"AKTH", 10},
+    {"ALBU", 10}, {"ALEV", 10}, {"ALFR", 10}, {"ALNE", 10}, {"ALOC", 10}, {"AMCO", 10},
+    {"AMID", 10}, {"AMUS", 10}, {"ANDK", 10}, {"ANLO", 10}, {"ANTC", 10}, {"ANTU", 10},
+    {"ANTW", 10}, {"ANVI", 10}, {"AOFW", 10}, {"APFO", 10}, {"APIS", 10}, {"ARAB", 10},
+    {"ARDD", 10}, {"ARDM", 10}, {"ARDO", 10}, {"ARGR", 10}, {"ARKU", 10}, {"AROR", 10},
+    {"ARTF", 10}, {"ARYD", 10}, {"ARYE", 10}, {"ARYR", 10}, {"ASER", 10}, {"ASPL", 10},
+    {"ASPU", 10}, {"ATBR", 10}, {"ATOO", 10}, {"ATQU", 10}, {"ATSC", 10}, {"AVOU", 10},
+    {"AXFO", 10}, {"AXIO", 10}, {"AYFR", 10}, {"BARS", 10}, {"BCAN", 10}, {"BDIR", 10},
+    {"BEAV", 10}, {"BEDA", 10}, {"BEPO", 10}, {"BEPU", 10}, {"BERF", 10}, {"BINI", 10},
+    {"BISE", 10}, {"BITC", 10}, {"BRAN", 10}, {"BUTP", 10}, {"BYTW", 10}, {"CALH", 10},
+    {"CANL", 10}, {"CATC", 10}, {"CAVI", 10}, {"CEDS", 10}, {"CELL", 10}, {"CESD", 10},
+    {"CFRA", 10}, {"CHAW", 10}, {"CHOS", 10}, {"CHWO", 10}, {"CITI", 10}, {"CITL", 10},
+    {"CKED", 10}, {"CKSU", 10}, {"CLEB", 10}, {"CMAI", 10}, {"COIN", 10}, {"CRAT", 10},
+    {"CTAR", 10}, {"CTAS", 10}, {"CTFR", 10}, {"CTME", 10}, {"CTRI", 10}, {"CTTE", 10},
+    {"CTWO", 10}, {"CTYP", 10}, {"CUBE", 10}, {"CUMV", 10}, {"CWHI", 10}, {"CWOR", 10},
+    {"DACK", 10}, {"DACT", 10}, {"DALM", 10}, {"DASH", 10}, {"DATH", 10}, {"DBEU", 10},
+    {"DCOR", 10}, {"DCOV", 10}, {"DCRO", 10}, {"DEAD", 10}, {"DEAF", 10}, {"DEDM", 10},
+    {"DEDY", 10}, {"DENL", 10}, {"DERH", 10}, {"DERL", 10}, {"DESP", 10}, {"DESW", 10},
+    {"DEUN", 10}, {"DHOM", 10}, {"DIDA", 10}, {"DIFO", 10}, {"DINM", 10}, {"DIRT", 10},
+    {"DITY", 10}, {"DLEB", 10}, {"DLED", 10}, {"DLEP", 10}, {"DLOA", 10}, {"DLOC", 10},
+    {"DNEA", 10}, {"DOIF", 10}, {"DOMO", 10}, {"DONB", 10}, {"DORP", 10}, {"DOTO", 10},
+    {"DOWP", 10}, {"DPAI", 10}, {"DRAF", 10}, {"DSBE", 10}, {"DSMO", 10}, {"DSOI", 10},
+    {"DSRE", 10}, {"DTOH", 10}, {"DTOJ", 10}, {"DTUR", 10}, {"DTWI", 10}, {"DWEL", 10},
+    {"DYDE", 10}, {"EADC", 10}, {"EAKA", 10}, {"EAKS", 10}, {"EATB", 10}, {"EATG", 10},
+    {"EATR", 10}, {"EBIT", 10}, {"EBYB", 10}, {"ECPR", 10}, {"ECUB", 10}, {"EDAW", 10},
+    {"EDFA", 10}, {"EDLA", 10}, {"EDMU", 10}, {"EDSY", 10}, {"EEBE", 10}, {"EEDF", 10},
+    {"EEKD", 10}, {"EFAN", 10}, {"EFTH", 10}, {"EFTM", 10}, {"EGMI", 10}, {"EGPL", 10},
+    {"EIHA", 10}, {"EINM", 10}, {"ELFW", 10}, {"ELOG", 10}, {"ELTE", 10}, {"ELUC", 10},
+    {"ELYS", 10}, {"EMDE", 10}, {"EMEC", 10}, {"EMPO", 10}, {"EMSD", 10}, {"EMSL", 10},
+    {"ENAP", 10}, {"ENCY", 10}, {"ENDB", 10}, {"ENEN", 10}, {"ENEO", 10}, {"ENHE", 10},
+    {"ENLY", 10}, {"ENNE", 10}, {"ENSP", 10}, {"ENUA", 10}, {"ENWO", 10}, {"EOIL", 10},
+    {"EOUG", 10}, {"ERCT", 10}, {"ESJU", 10}, {"ESMI", 10}, {"ESTC", 10}, {"ESVA", 10},
+    {"ETBL", 10}, {"ETPR", 10}, {"EUNE", 10}, {"EVAP", 10}, {"EVES", 10}, {"EWID", 10},
+    {"EWRM", 10}, {"EXTV", 10}, {"EYEF", 10}, {"EYEI", 10}, {"FALS", 10}, {"FAME", 10},
+    {"FASO", 10}, {"FATT", 10}, {"FEEY", 10}, {"FEIT", 10}, {"FERD", 10}, {"FERW", 10},
+    {"FERY", 10}, {"FEWC", 10}, {"FFFR", 10}, {"FFIN", 10}, {"FHOM", 10}, {"FIAB", 10},
+    {"FICC", 10}, {"FICQ", 10}, {"FICW", 10}, {"FIGA", 10}, {"FIXI", 10}, {"FOBJ", 10},
+    {"FOFI", 10}, {"FPRE", 10}, {"FSCR", 10}, {"FSTA", 10}, {"FTCL", 10}, {"FTHR", 10},
+    {"FTMO", 10}, {"FUNU", 10}, {"FWIL", 10}, {"FYOR", 10}, {"GACC", 10}, {"GALN", 10},
+    {"GALO", 10}, {"GAPR", 10}, {"GBET", 10}, {"GBHC", 10}, {"GCOU", 10}, {"GESL", 10},
+    {"GGES", 10}, {"GHAS", 10}, {"GHIN", 10}, {"GHPR", 10}, {"GITM", 10}, {"GLEP", 10},
+    {"GNIN", 10}, {"GOOU", 10}, {"GORD", 10}, {"GPER", 10}, {"GTHT", 10}, {"GTOI", 10},
+    {"GTOR", 10}, {"GTOW", 10}, {"GUID", 10}, {"HADN", 10}, {"HASO", 10}, {"HATK", 10},
+    {"HATQ", 10}, {"HBUT", 10}, {"HBYT", 10}, {"HEDW", 10}, {"HEEI", 10}, {"HEET", 10},
+    {"HFEL", 10}, {"HIRT", 10}, {"HMEN", 10}, {"HODO", 10}, {"HODS", 10}, {"HOHA", 10},
+    {"HONL", 10}, {"HOWD", 10}, {"HSOT", 10}, {"HSTR", 10}, {"HTSC", 10}, {"HTXY", 10},
+    {"HUSF", 10}, {"IALF", 10}, {"IANG", 10}, {"ICEB", 10}, {"ICED", 10}, {"ICQU", 10},
+    {"IDEM", 10}, {"IDME", 10}, {"IDPO", 10}, {"IEDL", 10}, {"IEDM", 10}, {"IEWA", 10},
+    {"IFAT", 10}, {"IFDI", 10}, {"IFFO", 10}, {"IKEB", 10}, {"ILIF", 10}, {"ILTI", 10},
+    {"IMAR", 10}, {"IMSI", 10}, {"INKO", 10}, {"INOF", 10}, {"INPE", 10}, {"INTU", 10},
+    {"INUI", 10}, {"IOPT", 10}, {"IPRE", 10}, {"IPTY", 10}, {"IRNA", 10}, {"IRTE", 10},
+    {"IRTI", 10}, {"ISHB", 10}, {"ISHC", 10}, {"ISKI", 10}, {"ISMF", 10}, {"ISSY", 10},
+    {"ITLY", 10}, {"ITYE", 10}, {"KCOM", 10}, {"KEDV", 10}, {"KELI", 10}, {"KENE", 10},
+    {"KENT", 10}, {"KERI", 10}, {"KERT", 10}, {"KESO", 10}, {"KESS", 10}, {"KESV", 10},
+    {"KEUS", 10}, {"KORA", 10}, {"KSAS", 10}, {"KTOG", 10}, {"KWAS", 10}, {"LACC", 10},
+    {"LAFT", 10}, {"LBEB", 10}, {"LDDE", 10}, {"LDED", 10}, {"LDEL", 10}, {"LDEX", 10},
+    {"LDLI", 10}, {"LDMO", 10}, {"LDSC", 10}, {"LDSO", 10}, {"LEAG", 10}, {"LEAU", 10},
+    {"LEDF", 10}, {"LEGR", 10}, {"LENC", 10}, {"LEPE", 10}, {"LERI", 10}, {"LERU", 10},
+    {"LESN", 10}, {"LFWH", 10}, {"LGRO", 10}, {"LICS", 10}, {"LIDA", 10}, {"LIDF", 10},
+    {"LIEV", 10}, {"LIFA", 10}, {"LINV", 10}, {"LITB", 10}, {"LITC", 10}, {"LLAC", 10},
+    {"LLHO", 10}, {"LLSH", 10}, {"LLYN", 10}, {"LMEN", 10}, {"LMOT", 10}, {"LOWB", 10},
+    {"LOWD", 10}, {"LPON", 10}, {"LPSY", 10}, {"LPUR", 10}, {"LPWI", 10}, {"LRAY", 10},
+    {"LSEL", 10}, {"LSES", 10}, {"LSWI", 10}, {"LSYN", 10}, {"LTAB", 10}, {"LTOG", 10},
+    {"LTOP", 10}, {"LTRA", 10}, {"LUEN", 10}, {"LUME", 10}, {"LUSA", 10}, {"LYCH", 10},
+    {"MACC", 10}, {"MALF", 10}, {"MANT", 10}, {"MASW", 10}, {"MATW", 10}, {"MAUS", 10},
+    {"MBEC", 10}, {"MBYT", 10}, {"MDBY", 10}, {"MESH", 10}, {"MEVA", 10}, {"MEXC", 10},
+    {"MGRE", 10}, {"MHOW", 10}, {"MIFA", 10}, {"MIFY", 10}, {"MINC", 10}, {"MISI", 10},
+    {"MMAR", 10}, {"MMIT", 10}, {"MMUS", 10}, {"MORS", 10}, {"MPEN", 10}, {"MSDO", 10},
+    {"MSLI", 10}, {"MTOO", 10}, {"MVEN", 10}, {"MWOU", 10}, {"NABI", 10}, {"NADV", 10},
+    {"NAMI", 10}, {"NANT", 10}, {"NASY", 10}, {"NBEE", 10}, {"NBUF", 10}, {"NCHB", 10},
+    {"NCTT", 10}, {"NDKE", 10}, {"NDPT", 10}, {"NDRO", 10}, {"NDUM", 10}, {"NEDM", 10},
+    {"NEEX", 10}, {"NEGL", 10}, {"NELA", 10}, {"NEXH", 10}, {"NGAU", 10}, {"NGEP", 10},
+    {"NGFA", 10}, {"NGRU", 10}, {"NGWR", 10}, {"NIED", 10}, {"NISE", 10}, {"NITO", 10},
+    {"NJUM", 10}, {"NJUS", 10}, {"NMAR", 10}, {"NNAB", 10}, {"NOFE", 10}, {"NONB", 10},
+    {"NONF", 10}, {"NONS", 10}, {"NOPA", 10}, {"NORG", 10}, {"NPOW", 10}, {"NSAP", 10},
+    {"NSIG", 10}, {"NSIM", 10}, {"NSOL", 10}, {"NSOP", 10}, {"NSUM", 10}, {"NTKN", 10},
+    {"NTLA", 10}, {"NTLE", 10}, {"NTOD", 10}, {"NTSD", 10}, {"NTVI", 10}, {"NUCO", 10},
+    {"NUIS", 10}, {"NUTH", 10}, {"NYFO", 10}, {"NYFU", 10}, {"NYIT", 10}, {"NYOB", 10},
+    {"NYSP", 10}, {"OALO", 10}, {"OASK", 10}, {"OASP", 10}, {"OCKA", 10}, {"OEQU", 10},
+    {"OFBE", 10}, {"OFBL", 10}, {"OFDO", 10}, {"OFIS", 10}, {"OFLO", 10}, {"OFPH", 10},
+    {"OGIC", 10}, {"OIFT", 10}, {"OIMP", 10}, {"OINW", 10}, {"OLEB", 10}, {"OLEP", 10},
+    {"OLOS", 10}, {"OMEX", 10}, {"OMNI", 10}, {"OMOS", 10}, {"OMSO", 10}, {"ONCH", 10},
+    {"ONOW", 10}, {"OOBS", 10}, {"OORB", 10}, {"OPLU", 10}, {"OPPA", 10}, {"OPST", 10},
+    {"OPTO", 10}, {"OPVI", 10}, {"ORBL", 10}, {"OREQ", 10}, {"ORFA", 10}, {"ORGO", 10},
+    {"ORHI", 10}, {"ORKN", 10}, {"ORKP", 10}, {"ORML", 10}, {"ORPL", 10}, {"ORTY", 10},
+    {"ORYE", 10}, {"ORYM", 10}, {"OSAY", 10}, {"OSOO", 10}, {"OSTB", 10}, {"OTDE", 10},
+    {"OTFR", 10}, {"OTGR", 10}, {"OTOR", 10}, {"OUAS", 10}, {"OUON", 10}, {"OUPT", 10},
+    {"OUWH", 10}, {"OUYO", 10}, {"OWAS", 10}, {"OWBU", 10}, {"OWIL", 10}, {"OWMU", 10},
+    {"OWNM", 10}, {"OWNU", 10}, {"OWPO", 10}, {"OWRA", 10}, {"OWSB", 10}, {"OWSD", 10},
+    {"OWSM", 10}, {"OWSV", 10}, {"OWUP", 10}, {"OWVE", 10}, {"OWVI", 10}, {"PANE", 10},
+    {"PEDB", 10}, {"PESA", 10}, {"PHAB", 10}, {"PITA", 10}, {"PITE", 10}, {"PLYW", 10},
+    {"PPAG", 10}, {"PRIV", 10}, {"PSCR", 10}, {"PSWW", 10}, {"PTAL", 10}, {"PTYS", 10},
+    {"PWIL", 10}, {"PYLE", 10}, {"QTHE", 10}, {"QUDO", 10}, {"RAFI", 10}, {"RAJE", 10},
+    {"RALM", 10}, {"RANA", 10}, {"RASW", 10}, {"RATC", 10}, {"RAYO", 10}, {"RAYT", 10},
+    {"RBEH", 10}, {"RBOT", 10}, {"RBRA", 10}, {"RCRE", 10}, {"RDAS", 10}, {"RDDE", 10},
+    {"RDID", 10}, {"RDIM", 10}, {"RDOE", 10}, {"REEE", 10}, {"RFAI", 10}, {"RFIG", 10},
+    {"RFOC", 10}, {"RFUR", 10}, {"RHOL", 10}, {"RISW", 10}, {"RKMA", 10}, {"RKPR", 10},
+    {"RKRI", 10}, {"RKRO", 10}, {"RKTO", 10}, {"RLAS", 10}, {"RLYU", 10}, {"RMAI", 10},
+    {"RMDB", 10}, {"RMSY", 10}, {"RNYO", 10}, {"ROLT", 10}, {"ROMH", 10}, {"ROMR", 10},
+    {"ROMV", 10}, {"RORP", 10}, {"RPOI", 10}, {"RSAG", 10}, {"RSER", 10}, {"RSST", 10},
+    {"RTAL", 10}, {"RTRI", 10}, {"RTUA", 10}, {"RTYO", 10}, {"RTYR", 10}, {"RUNC", 10},
+    {"RVEL", 10}, {"RWOU", 10}, {"RYAL", 10}, {"RYBL", 10}, {"RYCL", 10}, {"RYDO", 10},
+    {"RYGR", 10}, {"RYMA", 10}, {"RYPO", 10}, {"SABB", 10}, {"SAFA", 10}, {"SAMI", 10},
+    {"SANG", 10}, {"SASB", 10}, {"SASD", 10}, {"SATW", 10}, {"SBED", 10}, {"SBEG", 10},
+    {"SBLU", 10}, {"SBYC", 10}, {"SCRY", 10}, {"SDOS", 10}, {"SEDG", 10}, {"SEDL", 10},
+    {"SEEB", 10}, {"SETY", 10}, {"SFUL", 10}, {"SHDI", 10}, {"SINN", 10}, {"SINY", 10},
+    {"SITR", 10}, {"SLIM", 10}, {"SLYP", 10}, {"SLYR", 10}, {"SMET", 10}, {"SMOT", 10},
+    {"SMOU", 10}, {"SOAD", 10}, {"SOBJ", 10}, {"SOHA", 10}, {"SOLD", 10}, {"SOLL", 10},
+    {"SONI", 10}, {"SORY", 10}, {"SPUR", 10}, {"SQUE", 10}, {"SSAF", 10}, {"SSPL", 10},
+    {"SSPR", 10}, {"STNA", 10}, {"STNE", 10}, {"SUNF", 10}, {"SVIS", 10}, {"SWWW", 10},
+    {"TABE", 10}, {"TAGO", 10}, {"TALE", 10}, {"TANS", 10}, {"TARR", 10}, {"TASC", 10},
+    {"TATX", 10}, {"TAXE", 10}, {"TAXS", 10}, {"TBAS", 10}, {"TCAR", 10}, {"TDOS", 10},
+    {"TEAB", 10}, {"TEBE", 10}, {"TEFU", 10}, {"TEMD", 10}, {"TEMY", 10}, {"TENF", 10},
+    {"TEPO", 10}, {"TESS", 10}, {"TEUN", 10}, {"TEWO", 10}, {"TFIF", 10}, {"TFIV", 10},
+    {"TFLA", 10}, {"TGOT", 10}, {"THIF", 10}, {"TINW", 10}, {"TLEH", 10}, {"TLEL", 10},
+    {"TLYM", 10}, {"TMAI", 10}, {"TMAR", 10}, {"TOEM", 10}, {"TOHO", 10}, {"TOIM", 10},
+    {"TOMI", 10}, {"TONC", 10}, {"TOOF", 10}, {"TOSC", 10}, {"TPOI", 10}, {"TPSW", 10},
+    {"TRAJ", 10}, {"TRAS", 10}, {"TRLN", 10}, {"TRYA", 10}, {"TSDO", 10}, {"TSED", 10},
+    {"TSNE", 10}, {"TUSL", 10}, {"TWON", 10}, {"TYSH", 10}, {"UAND", 10}, {"UBTR", 10},
+    {"UDEN", 10}, {"UEAT", 10}, {"UEBY", 10}, {"UIDE", 10}, {"UIDS", 10}, {"UIOP", 10},
+    {"ULIF", 10}, {"ULIN", 10}, {"ULLN", 10}, {"UMEO", 10}, {"UMVE", 10}, {"UNDY", 10},
+    {"UNGI", 10}, {"UNSO", 10}, {"UONL", 10}, {"UORG", 10}, {"UPVI", 10}, {"URDE", 10},
+    {"URDO", 10}, {"URSL", 10}, {"USBO", 10}, {"USRA", 10}, {"USRI", 10}, {"UTPA", 10},
+    {"UTRY", 10}, {"UTVI", 10}, {"UWHE", 10}, {"UWIT", 10}, {"VALO", 10}, {"VANC", 10},
+    {"VEFI", 10}, {"VEMU", 10}, {"VENL", 10}, {"VERL", 10}, {"VERM", 10}, {"VEUS", 10},
+    {"VIOR", 10}, {"VOUR", 10}, {"WAIT", 10}, {"WASW", 10}, {"WAYW", 10}, {"WBEC", 10},
+    {"WCON", 10}, {"WHOC", 10}, {"WHOH", 10}, {"WLIG", 10}, {"WMEN", 10}, {"WMUC", 10},
+    {"WOOB", 10}, {"WRMU", 10}, {"WWGN", 10}, {"WWWG", 10}, {"XCNT", 10}, {"XIOM", 10},
+    {"XITV", 10}, {"XPAR", 10}, {"XSYN", 10}, {"XTAD", 10}, {"XTBO", 10}, {"XTGO", 10},
+    {"XTNE", 10}, {"XTOD", 10}, {"YATY", 10}, {"YBAC", 10}, {"YDAR", 10}, {"YDEG", 10},
+    {"YDIR", 10}, {"YETA", 10}, {"YETS", 10}, {"YFUN", 10}, {"YGLA", 10}, {"YHIS", 10},
+    {"YHOW", 10}, {"YIFI", 10}, {"YLIB", 10}, {"YLIK", 10}, {"YORC", 10}, {"YORL", 10},
+    {"YSAM", 10}, {"YSER", 10}, {"YSHO", 10}, {"YSIT", 10}, {"YSOT", 10}, {"YSPL", 10},
+    {"YSWO", 10}, {"YTEI", 10}, {"YTOI", 10}, {"YUNI", 10}, {"YVAN", 10}, {"YWIN", 10},
+    {"ABCI", 9}, {"ABRO", 9}, {"ACEL", 9}, {"ACHP", 9}, {"ACKF", 9}, {"ACLO", 9},
+    {"ADCO", 9}, {"AFAR", 9}, {"AGIC", 9}, {"AGSI", 9}, {"AGTH", 9}, {"AHAL", 9},
+    {"AHIN", 9}, {"AINH", 9}, {"AINY", 9}, {"AIRF", 9}, {"ALAD", 9}, {"ALAM", 9},
+    {"ALCI", 9}, {"ALFS", 9}, {"ALSY", 9}, {"ALUS", 9}, {"ALWH", 9}, {"AMIT", 9},
+    {"AMNO", 9}, {"AMRE", 9}, {"AMSN", 9}, {"ANDX", 9}, {"ANEB", 9}, {"ANGM", 9},
+    {"ANKA", 9}, {"ANWA", 9}, {"APAB", 9}, {"APAP", 9}, {"APED", 9}, {"APHA", 9},
+    {"APOI", 9}, {"ARDF", 9}, {"ARDP", 9}, {"ARDW", 9}, {"AREH", 9}, {"ARGI", 9},
+    {"ARKO", 9}, {"ASEU", 9}, {"ASFI", 9}, {"ASSY", 9}, {"ASTM", 9}, {"ATAI", 9},
+    {"ATCR", 9}, {"ATUN", 9}, {"AUSA", 9}, {"AUSI", 9}, {"AXKE", 9}, {"AXSY", 9},
+    {"AYFO", 9}, {"AYIF", 9}, {"AYUS", 9}, {"AYVI", 9}, {"AYWH", 9}, {"BACC", 9},
+    {"BARF", 9}, {"BARI", 9}, {"BARM", 9}, {"BEBR", 9}, {"BECL", 9}, {"BEDB", 9},
+    {"BEEA", 9}, {"BEEP", 9}, {"BEOP", 9}, {"BESH", 9}, {"BETU", 9}, {"BITW", 9},
+    {"BMAT", 9}, {"BORA", 9}, {"BOST", 9}, {"BUFL", 9}, {"BUGG", 9}, {"BUSI", 9},
+    {"BUTU", 9}, {"BYAR", 9}, {"BYHE", 9}, {"BYLA", 9}, {"BYLO", 9}, {"BYTR", 9},
+    {"CAPI", 9}, {"CEDV", 9}, {"CEEX", 9}, {"CEIP", 9}, {"CEXA", 9}, {"CHAB", 9},
+    {"CHBO", 9}, {"CHHE", 9}, {"CHHO", 9}, {"CHIF", 9}, {"CHMI", 9}, {"CHOB", 9},
+    {"CHOG", 9}, {"CHWR", 9}, {"CINF", 9}, {"CIST", 9}, {"CKFI", 9}, {"CLEI", 9},
+    {"CMAT", 9}, {"CRTH", 9}, {"CTAC", 9}, {"CTBE", 9}, {"CTWI", 9}, {"CURI", 9},
+    {"CURL", 9}, {"CUSG", 9}, {"CUSS", 9}, {"CUTS", 9}, {"CUTT", 9}, {"CWHE", 9},
+    {"CWIL", 9}, {"CWIN", 9}, {"DADI", 9}, {"DAQU", 9}, {"DBEE", 9}, {"DBEG", 9},
+    {"DBEH", 9}, {"DBEN", 9}, {"DBRE", 9}, {"DBRI", 9}, {"DBYF", 9}, {"DDEG", 9},
+    {"DDES", 9}, {"DDNE", 9}, {"DDOI", 9}, {"DEAO", 9}, {"DEEM", 9}, {"DEIG", 9},
+    {"DELA", 9}, {"DEOP", 9}, {"DERM", 9}, {"DETC", 9}, {"DEXI", 9}, {"DEXO", 9},
+    {"DIDF", 9}, {"DIME", 9}, {"DIMM", 9}, {"DINL", 9}, {"DINR", 9}, {"DLAN", 9},
+    {"DLEN", 9}, {"DLIS", 9}, {"DLIV", 9}, {"DLOS", 9}, {"DMIX", 9}, {"DOFB", 9},
+    {"DOIL", 9}, {"DONY", 9}, {"DOSU", 9}, {"DOYO", 9}, {"DPUR", 9}, {"DSEL", 9},
+    {"DSLI", 9}, {"DSQU", 9}, {"DSSO", 9}, {"DTHT", 9}, {"DTIL", 9}, {"DVAL", 9},
+    {"DWEA", 9}, {"DYOR", 9}, {"EADB", 9}, {"EADU", 9}, {"EAFF", 9}, {"EAMM", 9},
+    {"EAPL", 9}, {"EAUG", 9}, {"EBEY", 9}, {"EBIN", 9}, {"EBYG", 9}, {"ECEO", 9},
+    {"ECHN", 9}, {"ECKW", 9}, {"ECTH", 9}, {"EDEA", 9}, {"EDEP", 9}, {"EDIE", 9},
+    {"EDKE", 9}, {"EDOA", 9}, {"EDPO", 9}, {"EDSH", 9}, {"EDVA", 9}, {"EEEX", 9},
+    {"EEMI", 9}, {"EEMP", 9}, {"EEON", 9}, {"EESI", 9}, {"EETW", 9}, {"EFAL", 9},
+    {"EFOO", 9}, {"EGHE", 9}, {"EHAN", 9}, {"EHID", 9}, {"EIMM", 9}, {"EIRH", 9},
+    {"EISG", 9}, {"EISH", 9}, {"EITY", 9}, {"ELDA", 9}, {"ELPL", 9}, {"ELPP", 9},
+    {"EMBU", 9}, {"EMCA", 9}, {"EMSC", 9}, {"ENEC", 9}, {"ENEF", 9}, {"ENFR", 9},
+    {"ENLA", 9}, {"ENME", 9}, {"ENOO", 9}, {"ENPU", 9}, {"ENSF", 9}, {"ENSS", 9},
+    {"ENUF", 9}, {"EOFN", 9}, {"EORW", 9}, {"EPEL", 9}, {"EPHY", 9}, {"EPTO", 9},
+    {"ERAW", 9}, {"ERBR", 9}, {"ERCR", 9}, {"EREH", 9}, {"ERKE", 9}, {"ERKN", 9},
+    {"ERNF", 9}, {"ERSV", 9}, {"ERTC", 9}, {"ERYA", 9}, {"ESGE", 9}, {"ESOO", 9},
+    {"ESOV", 9}, {"ETAV", 9}, {"ETRO", 9}, {"ETSB", 9}, {"EWCH", 9}, {"EWFR", 9},
+    {"EWVI", 9}, {"EXOF", 9}, {"EXXX", 9}, {"EYFA", 9}, {"EYSH", 9}, {"EYSO", 9},
+    {"EYVA", 9}, {"FABL", 9}, {"FACC", 9}, {"FAFO", 9}, {"FANC", 9}, {"FATA", 9},
+    {"FAWI", 9}, {"FCUR", 9}, {"FEIG", 9}, {"FERN", 9}, {"FESS", 9}, {"FFLA", 9},
+    {"FFOU", 9}, {"FGOL", 9}, {"FICB", 9}, {"FICS", 9}, {"FITH", 9}, {"FMAN", 9},
+    {"FMAR", 9}, {"FRES", 9}, {"FSUB", 9}, {"FTAB", 9}, {"FTAN", 9}, {"FTEL", 9},
+    {"FVER", 9}, {"FWRI", 9}, {"FYAV", 9}, {"GACH", 9}, {"GALP", 9}, {"GANS", 9},
+    {"GAPP", 9}, {"GAUT", 9}, {"GDEF", 9}, {"GDIF", 9}, {"GEDL", 9}, {"GELI", 9},
+    {"GEYE", 9}, {"GGIN", 9}, {"GICA", 9}, {"GISA", 9}, {"GLYB", 9}, {"GLYT", 9},
+    {"GMAN", 9}, {"GMED", 9}, {"GMIN", 9}, {"GMUC", 9}, {"GOON", 9}, {"GORS", 9},
+    {"GPUB", 9}, {"GRIG", 9}, {"GSEE", 9}, {"GSIM", 9}, {"GSIS", 9}, {"GWAS", 9},
+    {"HADB", 9}, {"HADS", 9}, {"HAPA", 9}, {"HBYR", 9}, {"HDAR", 9}, {"HDES", 9},
+    {"HDPL", 9}, {"HEAG", 9}, {"HEES", 9}, {"HEFE", 9}, {"HELU", 9}, {"HESD", 9},
+    {"HESL", 9}, {"HEYG", 9}, {"HEYN", 9}, {"HEYP", 9}, {"HGLA", 9}, {"HHAS", 9},
+    {"HODI", 9}, {"HODT", 9}, {"HONA", 9}, {"HORO", 9}, {"HSUB", 9}, {"HTSP", 9},
+    {"HUSW", 9}, {"HVAR", 9}, {"HVIS", 9}, {"HWIN", 9}, {"HWOR", 9}, {"HWRA", 9},
+    {"IAMO", 9}, {"IANS", 9}, {"IBET", 9}, {"IBGE", 9}, {"ICCO", 9}, {"ICER", 9},
+    {"ICEY", 9}, {"ICHV", 9}, {"ICIR", 9}, {"ICKP", 9}, {"ICTT", 9}, {"ICWI", 9},
+    {"IDAT", 9}, {"IDID", 9}, {"IEDP", 9}, {"IFAL", 9}, {"IGBE", 9}, {"IGTH", 9},
+    {"IHEL", 9}, {"IKEY", 9}, {"IKIN", 9}, {"ILYF", 9}, {"IMAS", 9}, {"IMCH", 9},
+    {"IMDE", 9}, {"IMEC", 9}, {"IMEV", 9}, {"IMWA", 9}, {"INCP", 9}, {"INDF", 9},
+    {"INEJ", 9}, {"INFE", 9}, {"INGK", 9}, {"INHO", 9}, {"INKS", 9}, {"INKT", 9},
+    {"INLO", 9}, {"INTB", 9}, {"IPTH", 9}, {"IPTP", 9}, {"IPTU", 9}, {"IRBU", 9},
+    {"IREX", 9}, {"IRMI", 9}, {"IROW", 9}, {"IRPO", 9}, {"IRSP", 9}, {"ISCU", 9},
+    {"ISER", 9}, {"ISEY", 9}, {"ISGL", 9}, {"ISNA", 9}, {"ISRA", 9}, {"ISWE", 9},
+    {"ISYE", 9}, {"ITAU", 9}, {"ITHZ", 9}, {"ITOO", 9}, {"ITTA", 9}, {"ITUP", 9},
+    {"ITYM", 9}, {"IVEB", 9}, {"IXDA", 9}, {"IXDS", 9}, {"JAVA", 9}, {"KARE", 9},
+    {"KEAW", 9}, {"KECH", 9}, {"KEDA", 9}, {"KEDI", 9}, {"KEEX", 9}, {"KEPT", 9},
+    {"KINC", 9}, {"KNOT", 9}, {"KOUT", 9}, {"KROO", 9}, {"KSAB", 9}, {"KSCO", 9},
+    {"KTON", 9}, {"LANY", 9}, {"LASA", 9}, {"LAWE", 9}, {"LCAU", 9}, {"LDBY", 9},
+    {"LDEF", 9}, {"LDEN", 9}, {"LDFI", 9}, {"LEAC", 9}, {"LEDS", 9}, {"LEIL", 9},
+    {"LENU", 9}, {"LERF", 9}, {"LERW", 9}, {"LESL", 9}, {"LETL", 9}, {"LEWE", 9},
+    {"LFTO", 9}, {"LFWI", 9}, {"LGRE", 9}, {"LIBG", 9}, {"LJUM", 9}, {"LLPL", 9},
+    {"LLVE", 9}, {"LLWR", 9}, {"LOFI", 9}, {"LOPI", 9}, {"LORD", 9}, {"LORW", 9},
+    {"LPOI", 9}, {"LPPA", 9}, {"LREP", 9}, {"LSEN", 9}, {"LSER", 9}, {"LSFO", 9},
+    {"LSOO", 9}, {"LSPL", 9}, {"LTED", 9}, {"LTRY", 9}, {"LUEE", 9}, {"LUEL", 9},
+    {"LUEY", 9}, {"LYBL", 9}, {"LYPU", 9}, {"LYTW", 9}, {"MALA", 9}, {"MALT", 9},
+    {"MALV", 9}, {"MAPL", 9}, {"MAPU", 9}, {"MASH", 9}, {"MATA", 9}, {"MATO", 9},
+    {"MBET", 9}, {"MEBR", 9}, {"MEGR", 9}, {"MELT", 9}, {"MEMU", 9}, {"MEXA", 9},
+    {"MINR", 9}, {"MISN", 9}, {"MLET", 9}, {"MMAK", 9}, {"MMAT", 9}, {"MMEA", 9},
+    {"MNIF", 9}, {"MOND", 9}, {"MRCE", 9}, {"MSCO", 9}, {"MSEE", 9}, {"MSTI", 9},
+    {"MUSC", 9}, {"MYOB", 9}, {"NADU", 9}, {"NALY", 9}, {"NARA", 9}, {"NCEE", 9},
+    {"NDAY", 9}, {"NDBI", 9}, {"NDSD", 9}, {"NDTU", 9}, {"NEAP", 9}, {"NEEL", 9},
+    {"NEFR", 9}, {"NEGA", 9}, {"NFLI", 9}, {"NFOA", 9}, {"NFOU", 9}, {"NFUL", 9},
+    {"NGOP", 9}, {"NGQU", 9}, {"NGSL", 9}, {"NHEL", 9}, {"NISR", 9}, {"NITB", 9},
+    {"NKNO", 9}, {"NMAU", 9}, {"NNOE", 9}, {"NOEV", 9}, {"NORB", 9}, {"NORF", 9},
+    {"NPAT", 9}, {"NRET", 9}, {"NSCH", 9}, {"NSTU", 9}, {"NSUP", 9}, {"NTBL", 9},
+    {"NTCH", 9}, {"NTCT", 9}, {"NTEE", 9}, {"NULI", 9}, {"NWIN", 9}, {"NYNU", 9},
+    {"NYPL", 9}, {"NYRI", 9}, {"OASI", 9}, {"OBEN", 9}, {"OBEV", 9}, {"OCHO", 9},
+    {"OCIF", 9}, {"OCLE", 9}, {"OCOR", 9}, {"OCTR", 9}, {"ODID", 9}, {"ODWH", 9},
+    {"OESO", 9}, {"OEXC", 9}, {"OFAG", 9}, {"OFES", 9}, {"OFSC", 9}, {"OGGL", 9},
+    {"OGRO", 9}, {"OHEL", 9}, {"OHOL", 9}, {"OIDO", 9}, {"OINA", 9}, {"OLLT", 9},
+    {"OLOG", 9}, {"OMAH", 9}, {"OMIS", 9}, {"OMYD", 9}, {"ONCR", 9}, {"ONGH", 9},
+    {"ONIA", 9}, {"ONOU", 9}, {"ONTN", 9}, {"ONUM", 9}, {"ONYA", 9}, {"OOBJ", 9},
+    {"OOFO", 9}, {"OOKM", 9}, {"OOKU", 9}, {"OONL", 9}, {"OOPT", 9}, {"OOTO", 9},
+    {"OPIS", 9}, {"OPPI", 9}, {"OPSA", 9}, {"OPUR", 9}, {"OPWI", 9}, {"ORAY", 9},
+    {"ORCH", 9}, {"ORDY", 9}, {"OREH", 9}, {"ORID", 9}, {"ORLA", 9}, {"ORNA", 9},
+    {"ORPI", 9}, {"ORYB", 9}, {"OSAT", 9}, {"OSGE", 9}, {"OSIG", 9}, {"OSIO", 9},
+    {"OSSB", 9}, {"OSTV", 9}, {"OSTW", 9}, {"OTER", 9}, {"OTEV", 9}, {"OTMU", 9},
+    {"OTNO", 9}, {"OTOA", 9}, {"OUAC", 9}, {"OUBT", 9}, {"OUEN", 9}, {"OUPI", 9},
+    {"OUTU", 9}, {"OVAR", 9}, {"OWAL", 9}, {"OWES", 9}, {"OWID", 9}, {"OWME", 9},
+    {"OWNR", 9}, {"OWTE", 9}, {"PANS", 9}, {"PARS", 9}, {"PDIR", 9}, {"PEAC", 9},
+    {"PEGE", 9}, {"PESH", 9}, {"PHIC", 9}, {"PLEX", 9}, {"PLOS", 9}, {"PONW", 9},
+    {"POSG", 9}, {"PQRS", 9}, {"PSET", 9}, {"PTSE", 9}, {"PTUS", 9}, {"PTVA", 9},
+    {"PWWW", 9}, {"PYFR", 9}, {"PYOR", 9}, {"RAFO", 9}, {"RANI", 9}, {"RASO", 9},
+    {"RBEL", 9}, {"RBID", 9}, {"RBLA", 9}, {"RBUF", 9}, {"RCEL", 9}, {"RCHH", 9},
+    {"RCOD", 9}, {"RDAM", 9}, {"RDAR", 9}, {"RDCH", 9}, {"RDIL", 9}, {"RDIT", 9},
+    {"REAU", 9}, {"RECR", 9}, {"REFF", 9}, {"REHA", 9}, {"REHE", 9}, {"RFOO", 9},
+    {"RHAN", 9}, {"RHAV", 9}, {"RINV", 9}, {"RITA", 9}, {"RKEN", 9}, {"RKSL", 9},
+    {"RKUP", 9}, {"RKWA", 9}, {"RLEG", 9}, {"RLWT", 9}, {"RMLY", 9}, {"RMUN", 9},
+    {"RMWI", 9}, {"ROWI", 9}, {"RROU", 9}, {"RRYP", 9}, {"RSDO", 9}, {"RSEY", 9},
+    {"RSIX", 9}, {"RSMU", 9}, {"RSTN", 9}, {"RSTV", 9}, {"RTDE", 9}, {"RTES", 9},
+    {"RTHS", 9}, {"RTHT", 9}, {"RTMA", 9}, {"RTNO", 9}, {"RTPA", 9}, {"RTSP", 9},
+    {"RTYW", 9}, {"RUBB", 9}, {"RUNE", 9}, {"RUUM", 9}, {"RYBY", 9}, {"RYME", 9},
+    {"SADE", 9}, {"SASY", 9}, {"SAVO", 9}, {"SAWA", 9}, {"SBLA", 9}, {"SBYM", 9},
+    {"SCTO", 9}, {"SEDM", 9}, {"SEEL", 9}, {"SEFA", 9}, {"SEPI", 9}, {"SEVA", 9},
+    {"SFEL", 9}, {"SHDA", 9}, {"SHDP", 9}, {"SHEN", 9}, {"SHOL", 9}, {"SIGH", 9},
+    {"SITB", 9}, {"SJUM", 9}, {"SMSI", 9}, {"SMSO", 9}, {"SOAL", 9}, {"SODI", 9},
+    {"SOHO", 9}, {"SPLE", 9}, {"SPOI", 9}, {"SSOA", 9}, {"SSOI", 9}, {"SSUI", 9},
+    {"SSWE", 9}, {"SSWO", 9}, {"STME", 9}, {"STSH", 9}, {"STVA", 9}, {"SUMI", 9},
+    {"SVIO", 9}, {"SWAN", 9}, {"TALM", 9}, {"TALP", 9}, {"TAVE", 9}, {"TAVO", 9},
+    {"TAXK", 9}, {"TBEB", 9}, {"TCHB", 9}, {"TDET", 9}, {"TEMB", 9}, {"TEMM", 9},
+    {"TEMU", 9}, {"TESB", 9}, {"TFAI", 9}, {"TFEE", 9}, {"TFUR", 9}, {"TGEN", 9},
+    {"THAG", 9}, {"TICS", 9}, {"TISH", 9}, {"TLIB", 9}, {"TLYV", 9}, {"TNEC", 9},
+    {"TNON", 9}, {"TOCC", 9}, {"TOFB", 9}, {"TOFY", 9}, {"TOGG", 9}, {"TONU", 9},
+    {"TOOS", 9}, {"TOQU", 9}, {"TOTU", 9}, {"TOYE", 9}, {"TPUR", 9}, {"TPWW", 9},
+    {"TRLD", 9}, {"TRLU", 9}, {"TROK", 9}, {"TROY", 9}, {"TRUU", 9}, {"TRYE", 9},
+    {"TRYF", 9}, {"TSAV", 9}, {"TSBA", 9}, {"TSES", 9}, {"TSOL", 9}, {"TSOP", 9},
+    {"TSRA", 9}, {"TSWO", 9}, {"TTOV", 9}, {"TTPW", 9}, {"TUNT", 9}, {"TURP", 9},
+    {"TWEA", 9}, {"TXTO", 9}, {"TYBE", 9}, {"TYMA", 9}, {"TYST", 9}, {"UDEW", 9},
+    {"UEDA", 9}, {"UESO", 9}, {"UILT", 9}, {"UJUS", 9}, {"ULAN", 9}, {"ULDF", 9},
+    {"ULEO", 9}, {"ULFO", 9}, {"ULTH", 9}, {"UMSP", 9}, {"UMWI", 9}, {"UNAL", 9},
+    {"UNTC", 9}, {"UNVI", 9}, {"UPAS", 9}, {"UPYO", 9}, {"USAS", 9}, {"USNO", 9},
+    {"USOR", 9}, {"UTAC", 9}, {"UTLO", 9}, {"UTTE", 9}, {"UWOR", 9}, {"VEAV", 9},
+    {"VEDW", 9}, {"VERF", 9}, {"VESC", 9}, {"VETW", 9}, {"VEUP", 9}, {"VEXS", 9},
+    {"VEYS", 9}, {"VOKE", 9}, {"WASH", 9}, {"WBUT", 9}, {"WDEL", 9}, {"WERP", 9},
+    {"WESH", 9}, {"WNUP", 9}, {"WOMO", 9}, {"WOND", 9}, {"WOWI", 9}, {"WSFO", 9},
+    {"WSIZ", 9}, {"WSOM", 9}, {"WSTO", 9}, {"WSWH", 9}, {"WWAN", 9}, {"XBLO", 9},
+    {"XDBO", 9}, {"XHAL", 9}, {"XKEY", 9}, {"XOFA", 9}, {"XTEX", 9}, {"XTST", 9},
+    {"XTTY", 9}, {"XVIM", 9}, {"YALO", 9}, {"YARG", 9}, {"YATO", 9}, {"YAWO", 9},
+    {"YBEF", 9}, {"YBEH", 9}, {"YCOO", 9}, {"YDEL", 9}, {"YDEP", 9}, {"YETO", 9},
+    {"YGIV", 9}, {"YHAD", 9}, {"YHAR", 9}, {"YHER", 9}, {"YIEL", 9}, {"YIFN", 9},
+    {"YILL", 9}, {"YISU", 9}, {"YNIC", 9}, {"YONL", 9}, {"YORN", 9}, {"YORS", 9},
+    {"YPEL", 9}, {"YPOI", 9}, {"YPUR", 9}, {"YSUS", 9}, {"YSWA", 9}, {"YTHU", 9},
+    {"YVIE", 9}, {"AACC", 8}, {"ABAB", 8}, {"ABBB", 8}, {"ABCA", 8}, {"ACEE", 8},
+    {"ACEY", 8}, {"ACHD", 8}, {"ACHM", 8}, {"ACHR", 8}, {"ACKP", 8}, {"ACKR", 8},
+    {"ACRA", 8}, {"ADDM", 8}, {"ADOC", 8}, {"ADOT", 8}, {"ADST", 8}, {"ADUS", 8},
+    {"ADYD", 8}, {"ADYS", 8}, {"AFLA", 8}, {"AFUL", 8}, {"AGEL", 8}, {"AGER", 8},
+    {"AGME", 8}, {"AHEL", 8}, {"AHUR", 8}, {"AIDI", 8}, {"AILM", 8}, {"AKOF", 8},
+    {"ALED", 8}, {"ALIG", 8}, {"ALKS", 8}, {"AMBI", 8}, {"AMDO", 8}, {"AMEX", 8},
+    {"AMIL", 8}, {"AMSS", 8}, {"AMUC", 8}, {"ANHU", 8}, {"ANID", 8}, {"ANJU", 8},
+    {"ANOV", 8}, {"ANTD", 8}, {"ANTP", 8}, {"ANUL", 8}, {"ANUP", 8}, {"APAS", 8},
+    {"APNA", 8}, {"APNO", 8}, {"APSE", 8}, {"APST", 8}, {"APUN", 8}, {"ARAW", 8},
+    {"ARAY", 8}, {"ARBA", 8}, {"ARDN", 8}, {"ARKB", 8}, {"ARLE", 8}, {"AROS", 8},
+    {"ASBR", 8}, {"ASBU", 8}, {"ASCI", 8}, {"ASEM", 8}, {"ASFA", 8}, {"ASID", 8},
+    {"ASIG", 8}, {"ASOB", 8}, {"ASOU", 8}, {"ASSD", 8}, {"ASUP", 8}, {"ATBL", 8},
+    {"ATHR", 8}, {"ATLO", 8}, {"ATMI", 8}, {"ATMU", 8}, {"ATUT", 8}, {"AWEX", 8},
+    {"AWIF", 8}, {"AWRI", 8}, {"AXCL", 8}, {"AXCO", 8}, {"AYAS", 8}, {"AYBU", 8},
+    {"AYEX", 8}, {"AYIT", 8}, {"AYLI", 8}, {"AYOR", 8}, {"AYWA", 8}, {"BALC", 8},
+    {"BALS", 8}, {"BARR", 8}, {"BDUP", 8}, {"BEGO", 8}, {"BELA", 8}, {"BEMU", 8},
+    {"BERD", 8}, {"BERM", 8}, {"BESA", 8}, {"BEWE", 8}, {"BFOR", 8}, {"BLEH", 8},
+    {"BLOW", 8}, {"BLUI", 8}, {"BLYB", 8}, {"BRIE", 8}, {"BRIS", 8}, {"BTEN", 8},
+    {"BYFE", 8}, {"BYOR", 8}, {"CACC", 8}, {"CALO", 8}, {"CANJ", 8}, {"CCUL", 8},
+    {"CDIS", 8}, {"CELY", 8}, {"CETE", 8}, {"CEWO", 8}, {"CHEV", 8}, {"CHOM", 8},
+    {"CIAN", 8}, {"CIFR", 8}, {"CKIT", 8}, {"CKMO", 8}, {"CKOR", 8}, {"CKOU", 8},
+    {"CKSA", 8}, {"CLIS", 8}, {"CMDC", 8}, {"COON", 8}, {"CQUI", 8}, {"CRIT", 8},
+    {"CSEA", 8}, {"CSIT", 8}, {"CTIF", 8}, {"CTII", 8}, {"CTOP", 8}, {"CTRE", 8},
+    {"CTSE", 8}, {"CTSF", 8}, {"CTSP", 8}, {"DAGR", 8}, {"DAIR", 8}, {"DASP", 8},
+    {"DBEY", 8}, {"DBLO", 8}, {"DBOT", 8}, {"DBYD", 8}, {"DCAL", 8}, {"DDAL", 8},
+    {"DDDE", 8}, {"DDEC", 8}, {"DDER", 8}, {"DDIV", 8}, {"DDOC", 8}, {"DEBL", 8},
+    {"DECE", 8}, {"DEDL", 8}, {"DEEF", 8}, {"DEFS", 8}, {"DENY", 8}, {"DESS", 8},
+    {"DEWO", 8}, {"DFIT", 8}, {"DFLA", 8}, {"DHOT", 8}, {"DIEN", 8}, {"DIFE", 8},
+    {"DIFN", 8}, {"DIRC", 8}, {"DITH", 8}, {"DLEI", 8}, {"DLIC", 8}, {"DLYI", 8},
+    {"DMIT", 8}, {"DNAM", 8}, {"DOBJ", 8}, {"DONI", 8}, {"DONW", 8}, {"DOON", 8},
+    {"DOWZ", 8}, {"DSHI", 8}, {"DSLO", 8}, {"DSST", 8}, {"DTOK", 8}, {"DUMP", 8},
+    {"DUNC", 8}, {"DWOU", 8}, {"DXYZ", 8}, {"DYIN", 8}, {"EAGO", 8}, {"EALE", 8},
+    {"EALM", 8}, {"EAQU", 8}, {"EARY", 8}, {"EASB", 8}, {"EAUN", 8}, {"EBEM", 8},
+    {"EBUL", 8}, {"ECCO", 8}, {"EDCA", 8}, {"EDTY", 8}, {"EEHT", 8}, {"EEIF", 8},
+    {"EENV", 8}, {"EERT", 8}, {"EESS", 8}, {"EESW", 8}, {"EFAS", 8}, {"EGOV", 8},
+    {"EHET", 8}, {"EIFD", 8}, {"EIFO", 8}, {"EIPT", 8}, {"EITP", 8}, {"EJOI", 8},
+    {"EKEE", 8}, {"EKNO", 8}, {"EKPT", 8}, {"ELEM", 8}, {"ELLD", 8}, {"ELOF", 8},
+    {"ELPG", 8}, {"ELYE", 8}, {"ELYM", 8}, {"EMDI", 8}, {"EMRE", 8}, {"EMSY", 8},
+    {"ENLE", 8}, {"ENMI", 8}, {"ENUB", 8}, {"EPAL", 8}, {"EPEO", 8}, {"EPET", 8},
+    {"EPRG", 8}, {"EPSI", 8}, {"EPTC", 8}, {"ERJA", 8}, {"ERNW", 8}, {"EROI", 8},
+    {"EROW", 8}, {"ESAU", 8}, {"ESEH", 8}, {"ESLO", 8}, {"ESWR", 8}, {"ETAD", 8},
+    {"ETGE", 8}, {"ETHF", 8}, {"ETLA", 8}, {"ETOJ", 8}, {"ETSH", 8}, {"ETSW", 8},
+    {"ETUT", 8}, {"EVET", 8}, {"EVIC", 8}, {"EWAI", 8}, {"EWAV", 8}, {"EWEI", 8},
+    {"EWTA", 8}, {"EXLA", 8}, {"EXMO", 8}, {"EXON", 8}, {"EXSI", 8}, {"EXTD", 8},
+    {"EYDI", 8}, {"EYIT", 8}, {"EYME", 8}, {"EYSI", 8}, {"EYSU", 8}, {"FABU", 8},
+    {"FADE", 8}, {"FAVE", 8}, {"FBLU", 8}, {"FBYT", 8}, {"FDEG", 8}, {"FERB", 8},
+    {"FERV", 8}, {"FEXP", 8}, {"FFUN", 8}, {"FGET", 8}, {"FHAS", 8}, {"FICT", 8},
+    {"FIGE", 8}, {"FIGT", 8}, {"FITC", 8}, {"FLIS", 8}, {"FMYE", 8}, {"FPLU", 8},
+    {"FPOL", 8}, {"FRAM", 8}, {"FRUN", 8}, {"FSPA", 8}, {"FSPE", 8}, {"FSYN", 8},
+    {"FTAL", 8}, {"FTES", 8}, {"FTSI", 8}, {"FTUR", 8}, {"FULA", 8}, {"FULB", 8},
+    {"FVIO", 8}, {"GAMA", 8}, {"GBIG", 8}, {"GCAN", 8}, {"GEDE", 8}, {"GEDS", 8},
+    {"GERP", 8}, {"GERR", 8}, {"GETG", 8}, {"GGLE", 8}, {"GINB", 8}, {"GITE", 8},
+    {"GLEQ", 8}, {"GMAI", 8}, {"GNOM", 8}, {"GNTH", 8}, {"GNUA", 8}, {"GQUI", 8},
+    {"GSAS", 8}, {"GSCA", 8}, {"GSEL", 8}, {"GSEV", 8}, {"GSNO", 8}, {"GSOR", 8},
+    {"GSWA", 8}, {"GTEL", 8}, {"GUNC", 8}, {"GUND", 8}, {"GUSR", 8}, {"GWAT", 8},
+    {"GWHA", 8}, {"GWRO", 8}, {"HAGR", 8}, {"HAHO", 8}, {"HALA", 8}, {"HAMA", 8},
+    {"HARC", 8}, {"HARP", 8}, {"HASU", 8}, {"HBOT", 8}, {"HCIR", 8}, {"HEDN", 8},
+    {"HEFF", 8}, {"HEGI", 8}, {"HEGO", 8}, {"HEML", 8}, {"HEMV", 8}, {"HEOC", 8},
+    {"HEOI", 8}, {"HESN", 8}, {"HIMA", 8}, {"HINL", 8}, {"HLIC", 8}, {"HMAD", 8},
+    {"HMIG", 8}, {"HNUM", 8}, {"HOMA", 8}, {"HORE", 8}, {"HOTA", 8}, {"HPAI", 8},
+    {"HPLA", 8}, {"HPUT", 8}, {"HSEE", 8}, {"HSHE", 8}, {"HTOA", 8}, {"HTUP", 8},
+    {"HTYE", 8}, {"HURD", 8}, {"HUSC", 8}, {"HUSU", 8}, {"HUTA", 8}, {"IALE", 8},
+    {"IALK", 8}, {"ICEG", 8}, {"ICEL", 8}, {"ICIS", 8}, {"ICOL", 8}, {"ICSE", 8},
+    {"ICTH", 8}, {"IDCO", 8}, {"IDGE", 8}, {"IDTO", 8}, {"IDWH", 8}, {"IEND", 8},
+    {"IERW", 8}, {"IFAF", 8}, {"IFDE", 8}, {"IFHA", 8}, {"IFLE", 8}, {"IFRO", 8},
+    {"IFWI", 8}, {"IGAN", 8}, {"IGEX", 8}, {"IGNT", 8}, {"IGNU", 8}, {"IKER", 8},
+    {"IKEU", 8}, {"ILDC", 8}, {"ILOR", 8}, {"IMAF", 8}, {"IMAP", 8}, {"IMEB", 8},
+    {"INCV", 8}, {"INDR", 8}, {"INJU", 8}, {"INSB", 8}, {"INSS", 8}, {"IOFT", 8},
+    {"IRAC", 8}, {"IRCE", 8}, {"IRDB", 8}, {"ISBL", 8}, {"ISFN", 8}, {"ISHM", 8},
+    {"ISOM", 8}, {"ISTB", 8}, {"ISTL", 8}, {"ITAD", 8}, {"ITEV", 8}, {"ITPO", 8},
+    {"ITVE", 8}, {"ITYC", 8}, {"ITYR", 8}, {"IUMP", 8}, {"IWOU", 8}, {"IXAH", 8},
+    {"IXOR", 8}, {"JOHN", 8}, {"JSON", 8}, {"JUNE", 8}, {"KEAG", 8}, {"KEFO", 8},
+    {"KENI", 8}, {"KESE", 8}, {"KEYC", 8}, {"KEYD", 8}, {"KISA", 8}, {"KMAY", 8},
+    {"KNER", 8}, {"KOFO", 8}, {"KSAR", 8}, {"KSBA", 8}, {"KSID", 8}, {"KSTA", 8},
+    {"KSUB", 8}, {"KUSE", 8}, {"LAGA", 8}, {"LATO", 8}, {"LAWI", 8}, {"LBEH", 8},
+    {"LBUF", 8}, {"LCAS", 8}, {"LDAS", 8}, {"LDES", 8}, {"LDPR", 8}, {"LECI", 8},
+    {"LEGE", 8}, {"LEIM", 8}, {"LEKE", 8}, {"LELP", 8}, {"LENI", 8}, {"LEOT", 8},
+    {"LFEA", 8}, {"LIDE", 8}, {"LIDI", 8}, {"LIME", 8}, {"LKNO", 8}, {"LKSA", 8},
+    {"LLAB", 8}, {"LLAD", 8}, {"LLOB", 8}, {"LLOC", 8}, {"LLSP", 8}, {"LLYH", 8},
+    {"LMAP", 8}, {"LNAM", 8}, {"LOGF", 8}, {"LONC", 8}, {"LOPM", 8}, {"LORN", 8},
+    {"LORP", 8}, {"LPCT", 8}, {"LPOP", 8}, {"LROU", 8}, {"LSOG", 8}, {"LSOH", 8},
+    {"LSOL", 8}, {"LSPA", 8}, {"LTFR", 8}, {"LTOC", 8}, {"LTST", 8}, {"LUEP", 8},
+    {"LUER", 8}, {"LUEV", 8}, {"LUIS", 8}, {"LUSH", 8}, {"LVIS", 8}, {"LWAS", 8},
+    {"LYAR", 8}, {"LYIS", 8}, {"MABL", 8}, {"MACO", 8}, {"MALO", 8}, {"MBED", 8},
+    {"MBEG", 8}, {"MBEL", 8}, {"MCHI", 8}, {"MCOL", 8}, {"MCUS", 8}, {"MDID", 8},
+    {"MDIR", 8}, {"MEAC", 8}, {"MECA", 8}, {"MEEN", 8}, {"MEHO", 8}, {"MEOP", 8},
+    {"MEOU", 8}, {"MESD", 8}, {"MEXP", 8}, {"MIFN", 8}, {"MIFT", 8}, {"MISD", 8},
+    {"MISF", 8}, {"MITH", 8}, {"MMAI", 8}, {"MNIT", 8}, {"MNOF", 8}, {"MNOR", 8},
+    {"MREA", 8}, {"MSAD", 8}, {"MSAS", 8}, {"MSCA", 8}, {"MSRE", 8}, {"MTOM", 8},
+    {"MWHO", 8}, {"MYDA", 8}, {"NADA", 8}, {"NAFU", 8}, {"NAQU", 8}, {"NARC", 8},
+    {"NASW", 8}, {"NBAC", 8}, {"NBOW", 8}, {"NCAR", 8}, {"NCEG", 8}, {"NCEP", 8},
+    {"NCSE", 8}, {"NDAH", 8}, {"NDFL", 8}, {"NDID", 8}, {"NDSN", 8}, {"NDSQ", 8},
+    {"NEAG", 8}, {"NENC", 8}, {"NEPL", 8}, {"NESL", 8}, {"NETA", 8}, {"NFOO", 8},
+    {"NGBI", 8}, {"NGBL", 8}, {"NGEU", 8}, {"NGGE", 8}, {"NGKE", 8}, {"NGRO", 8},
+    {"NGSD", 8}, {"NGWE", 8}, {"NHAN", 8}, {"NIDE", 8}, {"NIES", 8}, {"NIFA", 8},
+    {"NIMP", 8}, {"NINI", 8}, {"NINO", 8}, {"NINV", 8}, {"NIPU", 8}, {"NISF", 8},
+    {"NITC", 8}, {"NITD", 8}, {"NIXI", 8}, {"NIXS", 8}, {"NIZI", 8}, {"NJUN", 8},
+    {"NLYN", 8}, {"NMET", 8}, {"NMIN", 8}, {"NONI", 8}, {"NORC", 8}, {"NPOL", 8},
+    {"NREQ", 8}, {"NRGE", 8}, {"NSAF", 8}, {"NSAM", 8}, {"NSGI", 8}, {"NSME", 8},
+    {"NSMO", 8}, {"NSQU", 8}, {"NTIC", 8}, {"NTSL", 8}, {"NTYS", 8}, {"NUEN", 8},
+    {"NUNA", 8}, {"NUNT", 8}, {"NUSA", 8}, {"NUSS", 8}, {"NUTO", 8}, {"NVOK", 8},
+    {"NWEW", 8}, {"NYAL", 8}, {"NYNO", 8}, {"NYTA", 8}, {"OADF", 8}, {"OADS", 8},
+    {"OAFT", 8}, {"OARI", 8}, {"OBAS", 8}, {"OBEH", 8}, {"OBRO", 8}, {"OBSI", 8},
+    {"OCKO", 8}, {"ODEG", 8}, {"ODIR", 8}, {"OESS", 8}, {"OEXH", 8}, {"OFCU", 8},
+    {"OFEN", 8}, {"OFIG", 8}, {"OFMU", 8}, {"OFPU", 8}, {"OFRU", 8}, {"OFTU", 8},
+    {"OFUR", 8}, {"OHAL", 8}, {"OHAN", 8}, {"OINE", 8}, {"OINV", 8}, {"OITE", 8},
+    {"OKMA", 8}, {"OKUP", 8}, {"OLIG", 8}, {"OLVA", 8}, {"OMAY", 8}, {"OMEH", 8},
+    {"OMVI", 8}, {"ONAU", 8}, {"ONGR", 8}, {"ONGV", 8}, {"ONOB", 8}, {"ONTB", 8},
+    {"ONWR", 8}, {"OOBL", 8}, {"OODA", 8}, {"OODB", 8}, {"OODF", 8}, {"OODT", 8},
+    {"OOKB", 8}, {"OOLI", 8}, {"OOMT", 8}, {"OONT", 8}, {"OORE", 8}, {"OOTX", 8},
+    {"OPHE", 8}, {"OPIN", 8}, {"OPME", 8}, {"ORBR", 8}, {"ORBS", 8}, {"ORDR", 8},
+    {"ORIR", 8}, {"ORMC", 8}, {"ORRY", 8}, {"ORTM", 8}, {"ORUP", 8}, {"ORYH", 8},
+    {"OSTN", 8}, {"OTBU", 8}, {"OTCA", 8}, {"OTDO", 8}, {"OTEQ", 8}, {"OTEW", 8},
+    {"OTHU", 8}, {"OTOC", 8}, {"OTOP", 8}, {"OTOU", 8}, {"OTUR", 8}, {"OUAN", 8},
+    {"OUBE", 8}, {"OUBY", 8}, {"OUNC", 8}, {"OUNI", 8}, {"OURU", 8}, {"OUSD", 8},
+    {"OVEE", 8}, {"OVEN", 8}, {"OVEY", 8}, {"OWAP", 8}, {"OWCT", 8}, {"OWOU", 8},
+    {"OWSF", 8}, {"OWWE", 8}, {"OYAN", 8}, {"PACI", 8}, {"PALA", 8}, {"PCON", 8},
+    {"PCTR", 8}, {"PECH", 8}, {"PENF", 8}, {"PESC", 8}, {"PICK", 8}, {"PIFY", 8},
+    {"PIST", 8}, {"PITS", 8}, {"PLIS", 8}, {"POPE", 8}, {"PRIM", 8}, {"PROO", 8},
+    {"PSAN", 8}, {"PSTA", 8}, {"PSYN", 8}, {"PTSA", 8}, {"PTSI", 8}, {"PTSO", 8},
+    {"PTSU", 8}, {"PULS", 8}, {"PUNI", 8}, {"PUTB", 8}, {"QRST", 8}, {"RALE", 8},
+    {"RAMD", 8}, {"RAPI", 8}, {"RASB", 8}, {"RAVE", 8}, {"RAWS", 8}, {"RAYB", 8},
+    {"RBEP", 8}, {"RBRE", 8}, {"RBRO", 8}, {"RCEB", 8}, {"RCEX", 8}, {"RCHD", 8},
+    {"RCHT", 8}, {"RDIA", 8}, {"RDMO", 8}, {"RDSY", 8}, {"RDTR", 8}, {"REAW", 8},
+    {"REEU", 8}, {"RELS", 8}, {"RELU", 8}, {"REOV", 8}, {"RERU", 8}, {"REYE", 8},
+    {"RFIV", 8}, {"RGEM", 8}, {"RGLO", 8}, {"RGSS", 8}, {"RGUI", 8}, {"RIEF", 8},
+    {"RJAC", 8}, {"RKOF", 8}, {"RKSC", 8}, {"RLEA", 8}, {"RLIA", 8}, {"RMCO", 8},
+    {"RMSH", 8}, {"RNFO", 8}, {"RNOF", 8}, {"RNSU", 8}, {"ROFO", 8}, {"ROLC", 8},
+    {"ROMF", 8}, {"ROMM", 8}, {"ROMN", 8}, {"RONC", 8}, {"ROOF", 8}, {"RQUI", 8},
+    {"RSAP", 8}, {"RSOI", 8}, {"RSPI", 8}, {"RUES", 8}, {"RUMA", 8}, {"RUNL", 8},
+    {"RUNM", 8}, {"RYBR", 8}, {"RYFU", 8}, {"RYMO", 8}, {"RYSC", 8}, {"RYSI", 8},
+    {"RYTE", 8}, {"SAAC", 8}, {"SADJ", 8}, {"SAMO", 8}, {"SANS", 8}, {"SARO", 8},
+    {"SAYT", 8}, {"SBEH", 8}, {"SBRI", 8}, {"SBYH", 8}, {"SBYV", 8}, {"SDED", 8},
+    {"SDET", 8}, {"SDIC", 8}, {"SDOI", 8}, {"SEAM", 8}, {"SEDP", 8}, {"SEEE", 8},
+    {"SETV", 8}, {"SFNA", 8}, {"SHBL", 8}, {"SHEA", 8}, {"SHEI", 8}, {"SHIS", 8},
+    {"SHIT", 8}, {"SIFS", 8}, {"SIMM", 8}, {"SITD", 8}, {"SKAS", 8}, {"SKEE", 8},
+    {"SKYO", 8}, {"SLIB", 8}, {"SLIT", 8}, {"SMAG", 8}, {"SMEE", 8}, {"SMER", 8},
+    {"SMOF", 8}, {"SNEV", 8}, {"SNTA", 8}, {"SOAP", 8}, {"SOCH", 8}, {"SOHE", 8},
+    {"SORG", 8}, {"SOSP", 8}, {"SOST", 8}, {"SPTA", 8}, {"SREI", 8}, {"SRSH", 8},
+    {"SSAI", 8}, {"SSBO", 8}, {"SSDO", 8}, {"SSSU", 8}, {"SSUS", 8}, {"SSYO", 8},
+    {"SSYS", 8}, {"STAD", 8}, {"STAI", 8}, {"STAY", 8}, {"STEV", 8}, {"STGI", 8},
+    {"STIR", 8}, {"STLA", 8}, {"STOK", 8}, {"STPE", 8}, {"STSP", 8}, {"STWE", 8},
+    {"SUBR", 8}, {"SUDD", 8}, {"SUMO", 8}, {"SUNC", 8}, {"SVAL", 8}, {"SWEN", 8},
+    {"SWID", 8}, {"SWRO", 8}, {"TAGC", 8}, {"TALN", 8}, {"TAME", 8}, {"TAOR", 8},
+    {"TBEY", 8}, {"TBLO", 8}, {"TBYP", 8}, {"TDEP", 8}, {"TEAP", 8}, {"TEBY", 8},
+    {"TEHT", 8}, {"TEMC", 8}, {"TENW", 8}, {"TEOB", 8}, {"TESW", 8}, {"TFAS", 8},
+    {"THDI", 8}, {"THRI", 8}, {"THSP", 8}, {"THVE", 8}, {"TIHA", 8}, {"TINM", 8},
+    {"TITC", 8}, {"TITR", 8}, {"TKIN", 8}, {"TLER", 8}, {"TLYH", 8}, {"TMAG", 8},
+    {"TMIX", 8}, {"TNEW", 8}, {"TNOR", 8}, {"TNUL", 8}, {"TOBU", 8}, {"TOGA", 8},
+    {"TOMT", 8}, {"TOOI", 8}, {"TOOU", 8}, {"TORR", 8}, {"TOSM", 8}, {"TOWN", 8},
+    {"TPUB", 8}, {"TRIM", 8}, {"TRIT", 8}, {"TRLE", 8}, {"TRLY", 8}, {"TSBO", 8},
+    {"TSBY", 8}, {"TSEP", 8}, {"TSLE", 8}, {"TSNA", 8}, {"TSOW", 8}, {"TSPU", 8},
+    {"TSRI", 8}, {"TSVE", 8}, {"TTOK", 8}, {"TTOY", 8}, {"TTXT", 8}, {"TWOD", 8},
+    {"TXTV", 8}, {"TYAR", 8}, {"TYHA", 8}, {"TYSP", 8}, {"UALE", 8}, {"UASS", 8},
+    {"UBYE", 8}, {"UCHW", 8}, {"UCTR", 8}, {"UDDE", 8}, {"UDEC", 8}, {"UDOW", 8},
+    {"UELI", 8}, {"UERE", 8}, {"UGGE", 8}, {"UGGI", 8}, {"UGHN", 8}, {"UINT", 8},
+    {"UIVE", 8}, {"ULDG", 8}, {"ULLA", 8}, {"ULLE", 8}, {"ULLO", 8}, {"ULTR", 8},
+    {"UMCU", 8}, {"UMPF", 8}, {"UNCA", 8}, {"UNCE", 8}, {"UNDD", 8}, {"UORB", 8},
+    {"UPEN", 8}, {"UPIT", 8}, {"UPLE", 8}, {"UPTE", 8}, {"URDA", 8}, {"URDR", 8},
+    {"UREN", 8}, {"URLO", 8}, {"URLY", 8}, {"URND", 8}, {"URRU", 8}, {"URSN", 8},
+    {"URWA", 8}, {"USAR", 8}, {"USBY", 8}, {"USEZ", 8}, {"USON", 8}, {"USPR", 8},
+    {"USRS", 8}, {"USSU", 8}, {"USTF", 8}, {"USWI", 8}, {"UTEW", 8}, {"UTOO", 8},
+    {"VARS", 8}, {"VEAF", 8}, {"VEBU", 8}, {"VEDN", 8}, {"VENM", 8}, {"VENN", 8},
+    {"VESM", 8}, {"VOCA", 8}, {"VTOS", 8}, {"VVIM", 8}, {"WASU", 8}, {"WEDB", 8},
+    {"WEDP", 8}, {"WEFI", 8}, {"WEMA", 8}, {"WETT", 8}, {"WEXC", 8}, {"WFUN", 8},
+    {"WINS", 8}, {"WITI", 8}, {"WNOU", 8}, {"WNSY", 8}, {"WOAN", 8}, {"WOCH", 8},
+    {"WOCT", 8}, {"WOSO", 8}, {"WREF", 8}, {"WROU", 8}, {"WSEE", 8}, {"WSON", 8},
+    {"WSWI", 8}, {"WTOU", 8}, {"WTOW", 8}, {"XAHU", 8}, {"XEDA", 8}, {"XIBI", 8},
+    {"XLAN", 8}, {"XMOD", 8}, {"XONT", 8}, {"XSID", 8}, {"XTAB", 8}, {"XTEA", 8},
+    {"XTSI", 8}, {"YARR", 8}, {"YASP", 8}, {"YAUT", 8}, {"YBOT", 8}, {"YBYS", 8},
+    {"YDET", 8}, {"YDOI", 8}, {"YEDB", 8}, {"YELE", 8}, {"YEQU", 8}, {"YETF", 8},
+    {"YEXT", 8}, {"YISI", 8}, {"YISM", 8}, {"YLAW", 8}, {"YLEA", 8}, {"YLES", 8},
+    {"YLIA", 8}, {"YOBJ", 8}, {"YORO", 8}, {"YORW", 8}, {"YPEE", 8}, {"YPEM", 8},
+    {"YPOW", 8}, {"YSFA", 8}, {"YSFL", 8}, {"YSHE", 8}, {"YSPR", 8}, {"YSUF", 8},
+    {"YTAB", 8}, {"YTRE", 8}, {"YUNC", 8}, {"YVIS", 8}, {"ZEDT", 8}, {"ZIPP", 8},
+    {"AARR", 7}, {"ABCH", 7}, {"ABEL", 7}, {"ABIN", 7}, {"ABYO", 7}, {"ACCI", 7},
+    {"ACHW", 7}, {"ACPR", 7}, {"ACTY", 7}, {"ADDC", 7}, {"ADTO", 7}, {"ADWI", 7},
+    {"AFES", 7}, {"AFOO", 7}, {"AGSO", 7}, {"AING", 7}, {"AJOB", 7}, {"ALEA", 7},
+    {"ALER", 7}, {"ALGE", 7}, {"ALIM", 7}, {"ALOP", 7}, {"ALSF", 7}, {"ALTR", 7},
+    {"ALYS", 7}, {"AMAJ", 7}, {"AMEQ", 7}, {"AMFI", 7}, {"AMFO", 7}, {"AMSE", 7},
+    {"AMWI", 7}, {"ANCA", 7}, {"ANEQ", 7}, {"ANIP", 7}, {"ANQU", 7}, {"APEA", 7},
+    {"APHT", 7}, {"APSI", 7}, {"ARBE", 7}, {"ARBL", 7}, {"ARBR", 7}, {"ARNO", 7},
+    {"ARTP", 7}, {"ARYN", 7}, {"ASAU", 7}, {"ASDO", 7}, {"ASEE", 7}, {"ASEF", 7},
+    {"ASFR", 7}, {"ASGI", 7}, {"ASHB", 7}, {"ASHT", 7}, {"ASKY", 7}, {"ASSM", 7},
+    {"ASTB", 7}, {"ASUA", 7}, {"ASVI", 7}, {"ATAO", 7}, {"ATHV", 7}, {"ATNE", 7},
+    {"ATNU", 7}, {"ATPT", 7}, {"ATRU", 7}, {"AUGM", 7}, {"AVEG", 7}, {"AVIE", 7},
+    {"AVOR", 7}, {"AWST", 7}, {"AYDO", 7}, {"AYPE", 7}, {"BALI", 7}, {"BARE", 7},
+    {"BARO", 7}, {"BCHA", 7}, {"BCIN", 7}, {"BEAR", 7}, {"BEBE", 7}, {"BEDT", 7},
+    {"BEFI", 7}, {"BEMI", 7}, {"BERB", 7}, {"BESP", 7}, {"BIGC", 7}, {"BIND", 7},
+    {"BINF", 7}, {"BLYT", 7}, {"BOFT", 7}, {"BUFW", 7}, {"BULL", 7}, {"BUTL", 7},
+    {"BUTV", 7}, {"BYEL", 7}, {"BYEV", 7}, {"BYHO", 7}, {"BYOF", 7}, {"BYPA", 7},
+    {"BYSA", 7}, {"CANW", 7}, {"CAPA", 7}, {"CASI", 7}, {"CASU", 7}, {"CBUF", 7},
+    {"CCID", 7}, {"CDCO", 7}, {"CECA", 7}, {"CEGR", 7}, {"CEMU", 7}, {"CETA", 7},
+    {"CEUN", 7}, {"CEWE", 7}, {"CHAG", 7}, {"CHCL", 7}, {"CHKE", 7}, {"CHVI", 7},
+    {"CKBE", 7}, {"CKBO", 7}, {"CLYD", 7}, {"CMDF", 7}, {"CNOW", 7}, {"COLS", 7},
+    {"COVY", 7}, {"CTHR", 7}, {"CTSH", 7}, {"CTSR", 7}, {"CUIT", 7}, {"CURV", 7},
+    {"CUSE", 7}, {"CUSW", 7}, {"DAFE", 7}, {"DAHA", 7}, {"DAME", 7}, {"DANH", 7},
+    {"DAPO", 7}, {"DASB", 7}, {"DASC", 7}, {"DASF", 7}, {"DBAR", 7}, {"DBAS", 7},
+    {"DBEV", 7}, {"DBYN", 7}, {"DDAP", 7}, {"DDAS", 7}, {"DDEP", 7}, {"DDNO", 7},
+    {"DEAM", 7}, {"DECT", 7}, {"DEGE", 7}, {"DEIM", 7}, {"DELY", 7}, {"DENB", 7},
+    {"DENE", 7}, {"DEXH", 7}, {"DFTP", 7}, {"DGOE", 7}, {"DGTH", 7}, {"DHEA", 7},
+    {"DHIN", 7}, {"DISD", 7}, {"DISM", 7}, {"DISO", 7}, {"DJOI", 7}, {"DLEC", 7},
+    {"DLEW", 7}, {"DMUS", 7}, {"DNEE", 7}, {"DNON", 7}, {"DOAC", 7}, {"DOAF", 7},
+    {"DOFM", 7}, {"DOFV", 7}, {"DOMN", 7}, {"DOOR", 7}, {"DOSF", 7}, {"DOWG", 7},
+    {"DOWV", 7}, {"DQUA", 7}, {"DREQ", 7}, {"DSDI", 7}, {"DSEX", 7}, {"DSFI", 7},
+    {"DSIX", 7}, {"DSIZ", 7}, {"DSSE", 7}, {"DSWE", 7}, {"DTER", 7}, {"DTHB", 7},
+    {"DTHP", 7}, {"DUNL", 7}, {"DXST", 7}, {"DYBE", 7}, {"DYFO", 7}, {"EABC", 7},
+    {"EABR", 7}, {"EAKN", 7}, {"EAPO", 7}, {"EARU", 7}, {"EASL", 7}, {"EBER", 7},
+    {"EBIS", 7}, {"ECAY", 7}, {"ECPO", 7}, {"ECRA", 7}, {"EDAD", 7}, {"EDEM", 7},
+    {"EDMY", 7}, {"EDOV", 7}, {"EDPI", 7}, {"EDTA", 7}, {"EEAB", 7}, {"EEFE", 7},
+    {"EEKI", 7}, {"EEKL", 7}, {"EEKT", 7}, {"EELY", 7}, {"EESY", 7}, {"EETD", 7},
+    {"EETT", 7}, {"EEWI", 7}, {"EFCO", 7}, {"EFEN", 7}, {"EFTE", 7}, {"EFTL", 7},
+    {"EFUR", 7}, {"EGLI", 7}, {"EHOP", 7}, {"EHTM", 7}, {"EIAB", 7}, {"EINB", 7},
+    {"EIRG", 7}, {"EISV", 7}, {"EIVI", 7}, {"EJEC", 7}, {"EJUN", 7}, {"ELLF", 7},
+    {"ELLM", 7}, {"ELPA", 7}, {"ELPE", 7}, {"ELPM", 7}, {"ELST", 7}, {"ELYL", 7},
+    {"ELYN", 7}, {"EMDO", 7}, {"EMIF", 7}, {"EMMO", 7}, {"EMPE", 7}, {"ENBO", 7},
+    {"ENCA", 7}, {"ENDN", 7}, {"ENDR", 7}, {"ENGO", 7}, {"ENIL", 7}, {"ENIM", 7},
+    {"ENOV", 7}, {"ENQU", 7}, {"ENSH", 7}, {"ENUY", 7}, {"ENWA", 7}, {"EONO", 7},
+    {"EONU", 7}, {"EPLY", 7}, {"EPOU", 7}, {"EPTS", 7}, {"EPUL", 7}, {"ERDB", 7},
+    {"ERND", 7}, {"ERTN", 7}, {"ESCL", 7}, {"ESCY", 7}, {"ESEG", 7}, {"ESOI", 7},
+    {"ETAF", 7}, {"ETAP", 7}, {"ETIL", 7}, {"ETSF", 7}, {"ETSY", 7}, {"ETWR", 7},
+    {"EUNM", 7}, {"EUPA", 7}, {"EUPD", 7}, {"EVAC", 7}, {"EVIR", 7}, {"EVOC", 7},
+    {"EWEM", 7}, {"EWMA", 7}, {"EWME", 7}, {"EWRE", 7}, {"EXAD", 7}, {"EXOR", 7},
+    {"EYEG", 7}, {"EYIS", 7}, {"EYNO", 7}, {"EYPR", 7}, {"FAPP", 7}, {"FATH", 7},
+    {"FBEI", 7}, {"FFFI", 7}, {"FFFO", 7}, {"FFLU", 7}, {"FHAL", 7}, {"FICK", 7},
+    {"FIGS", 7}, {"FIGW", 7}, {"FITF", 7}, {"FITP", 7}, {"FITR", 7}, {"FLEA", 7},
+    {"FLUS", 7}, {"FMAP", 7}, {"FMOR", 7}, {"FMOT", 7}, {"FMUS", 7}, {"FNEC", 7},
+    {"FOIL", 7}, {"FOIN", 7}, {"FPRI", 7}, {"FPUR", 7}, {"FRAG", 7}, {"FREQ", 7},
+    {"FRET", 7}, {"FSEN", 7}, {"FSFO", 7}, {"FTLI", 7}, {"FTOF", 7}, {"FTPV", 7},
+    {"FULO", 7}, {"FYAC", 7}, {"FYEL", 7}, {"GADD", 7}, {"GAGI", 7}, {"GAPL", 7},
+    {"GAVI", 7}, {"GBEF", 7}, {"GBYI", 7}, {"GEAB", 7}, {"GEAL", 7}, {"GEBU", 7},
+    {"GEEC", 7}, {"GEHE", 7}, {"GEND", 7}, {"GENU", 7}, {"GEPA", 7}, {"GESM", 7},
+    {"GETF", 7}, {"GEUN", 7}, {"GGRO", 7}, {"GHAH", 7}, {"GHBO", 7}, {"GINP", 7},
+    {"GKEY", 7}, {"GLIK", 7}, {"GMAC", 7}, {"GMAS", 7}, {"GMEA", 7}, {"GMIX", 7},
+    {"GMUS", 7}, {"GNEX", 7}, {"GNUM", 7}, {"GOAL", 7}, {"GOFE", 7}, {"GOFO", 7},
+    {"GORC", 7}, {"GORP", 7}, {"GRET", 7}, {"GSDE", 7}, {"GSEN", 7}, {"GSFR", 7},
+    {"GSPR", 7}, {"GSUS", 7}, {"GTHB", 7}, {"GTOD", 7}, {"GTOP", 7}, {"GUAR", 7},
+    {"GUET", 7}, {"GUIF", 7}, {"GUII", 7}, {"GUNP", 7}, {"HAIL", 7}, {"HASH", 7},
+    {"HASW", 7}, {"HBLA", 7}, {"HDAN", 7}, {"HECS", 7}, {"HEFK", 7}, {"HEGV", 7},
+    {"HEID", 7}, {"HEMR", 7}, {"HEMY", 7}, {"HEPC", 7}, {"HESK", 7}, {"HESR", 7},
+    {"HEWN", 7}, {"HEXC", 7}, {"HEXL", 7}, {"HFEA", 7}, {"HFIG", 7}, {"HFUN", 7},
+    {"HGET", 7}, {"HHAD", 7}, {"HHOL", 7}, {"HIEV", 7}, {"HITB", 7}, {"HMAP", 7},
+    {"HOLI", 7}, {"HOPA", 7}, {"HOUR", 7}, {"HPRE", 7}, {"HSAR", 7}, {"HSCR", 7},
+    {"HTBU", 7}, {"HTCA", 7}, {"HTDO", 7}, {"HTFE", 7}, {"HTGR", 7}, {"HTHT", 7},
+    {"HTIT", 7}, {"HTLE", 7}, {"HTOI", 7}, {"HTOM", 7}, {"HTRA", 7}, {"HTRI", 7},
+    {"HTSR", 7}, {"HTWE", 7}, {"HUSD", 7}, {"HUSO", 7}, {"HUSR", 7}, {"IALR", 7},
+    {"IBES", 7}, {"IBIN", 7}, {"ICBU", 7}, {"ICDO", 7}, {"ICFI", 7}, {"ICHN", 7},
+    {"ICKO", 7}, {"ICOP", 7}, {"ICTY", 7}, {"IDFI", 7}, {"IDWI", 7}, {"IEDE", 7},
+    {"IESL", 7}, {"IFFL", 7}, {"IFHE", 7}, {"IFRE", 7}, {"IFST", 7}, {"IGRO", 7},
+    {"IKEE", 7}, {"IKEP", 7}, {"IKNE", 7}, {"ILSA", 7}, {"ILSS", 7}, {"ILSY", 7},
+    {"ILYB", 7}, {"ILYS", 7}, {"IMBL", 7}, {"IMBO", 7}, {"IMEL", 7}, {"IMFR", 7},
+    {"IMIF", 7}, {"IMKE", 7}, {"IMMI", 7}, {"IMMU", 7}, {"IMOF", 7}, {"IMPA", 7},
+    {"IMPU", 7}, {"IMTA", 7}, {"INAU", 7}, {"INBR", 7}, {"INDH", 7}, {"INDM", 7},
+    {"INDP", 7}, {"INKW", 7}, {"INSY", 7}, {"INTM", 7}, {"IORB", 7}, {"IORP", 7},
+    {"IPED", 7}, {"IPIT", 7}, {"IPUL", 7}, {"IRAR", 7}, {"IRCA", 7}, {"IRDC", 7},
+    {"IRDS", 7}, {"IREW", 7}, {"IRID", 7}, {"IRLE", 7}, {"IROT", 7}, {"IRSO", 7},
+    {"IRSU", 7}, {"IRUS", 7}, {"IRVA", 7}, {"IRVE", 7}, {"ISBU", 7}, {"ISMP", 7},
+    {"ISOT", 7}, {"ISOU", 7}, {"ISTN", 7}, {"ITCT", 7}, {"ITEE", 7}, {"ITGE", 7},
+    {"ITGO", 7}, {"ITHJ", 7}, {"ITKE", 7}, {"ITOS", 7}, {"ITPE", 7}, {"ITTR", 7},
+    {"IVIM", 7}, {"IXEL", 7}, {"IZEI", 7}, {"JURI", 7}, {"KASI", 7}, {"KATH", 7},
+    {"KEBO", 7}, {"KEDU", 7}, {"KEOT", 7}, {"KESM", 7}, {"KETT", 7}, {"KFIX", 7},
+    {"KHAS", 7}, {"KILL", 7}, {"KINO", 7}, {"KINS", 7}, {"KITS", 7}, {"KLIC", 7},
+    {"KLYT", 7}, {"KMUS", 7}, {"KOFF", 7}, {"KONE", 7}, {"KREG", 7}, {"KSER", 7},
+    {"KSJU", 7}, {"KSYO", 7}, {"KUPT", 7}, {"KVIE", 7}, {"LAPU", 7}, {"LARF", 7},
+    {"LARO", 7}, {"LARU", 7}, {"LATH", 7}, {"LATL", 7}, {"LBEN", 7}, {"LDDI", 7},
+    {"LDPU", 7}, {"LDSH", 7}, {"LDSI", 7}, {"LDTO", 7}, {"LDVE", 7}, {"LDVI", 7},
+    {"LEAP", 7}, {"LEBA", 7}, {"LEBI", 7}, {"LEBO", 7}, {"LECR", 7}, {"LEDV", 7},
+    {"LEDX", 7}, {"LEHI", 7}, {"LELY", 7}, {"LEPL", 7}, {"LEPU", 7}, {"LETG", 7},
+    {"LETU", 7}, {"LEXC", 7}, {"LFAS", 7}, {"LFIG", 7}, {"LIMB", 7}, {"LITH", 7},
+    {"LLEM", 7}, {"LLET", 7}, {"LLEV", 7}, {"LLOS", 7}, {"LLQU", 7}, {"LLSA", 7},
+    {"LLSW", 7}, {"LLTI", 7}, {"LLTY", 7}, {"LNEE", 7}, {"LOIT", 7}, {"LOON", 7},
+    {"LOPA", 7}, {"LOWY", 7}, {"LOYE", 7}, {"LPAG", 7}, {"LPCO", 7}, {"LPTO", 7},
+    {"LQUA", 7}, {"LQUO", 7}, {"LSAR", 7}, {"LSEC", 7}, {"LSEX", 7}, {"LSIT", 7},
+    {"LSON", 7}, {"LSSE", 7}, {"LSTR", 7}, {"LTAL", 7}, {"LTOI", 7}, {"LUED", 7},
+    {"LVEF", 7}, {"LVTO", 7}, {"LWTH", 7}, {"LYCL", 7}, {"LYOB", 7}, {"LYSC", 7},
+    {"LYTI", 7}, {"LYTY", 7}, {"LYWR", 7}, {"MANO", 7}, {"MCHA", 7}, {"MDTH", 7},
+    {"MEAT", 7}, {"MEJU", 7}, {"MENC", 7}, {"MENE", 7}, {"MEOB", 7}, {"MERF", 7},
+    {"MESG", 7}, {"MEXT", 7}, {"MILE", 7}, {"MILL", 7}, {"MISO", 7}, {"MISV", 7},
+    {"MITM", 7}, {"MKVI", 7}, {"MMAS", 7}, {"MNAN", 7}, {"MODU", 7}, {"MOFF", 7},
+    {"MRCI", 7}, {"MSAT", 7}, {"MSEC", 7}, {"MSER", 7}, {"MSPT", 7}, {"MSSE", 7},
+    {"MSUB", 7}, {"MSWE", 7}, {"MTHU", 7}, {"MTOF", 7}, {"MUTA", 7}, {"MWER", 7},
+    {"MYLI", 7}, {"MYNI", 7}, {"NACE", 7}, {"NAGR", 7}, {"NAUS", 7}, {"NBRE", 7},
+    {"NCEH", 7}, {"NCHS", 7}, {"NCIN", 7}, {"NCOV", 7}, {"NCTF", 7}, {"NCTH", 7},
+    {"NDAQ", 7}, {"NDCU", 7}, {"NDFE", 7}, {"NDGT", 7}, {"NDIL", 7}, {"NDJO", 7},
+    {"NDMN", 7}, {"NDOM", 7}, {"NDUL", 7}, {"NERB", 7}, {"NESV", 7}, {"NEUP", 7},
+    {"NEWB", 7}, {"NEWD", 7}, {"NEYE", 7}, {"NFLA", 7}, {"NFOS", 7}, {"NGSN", 7},
+    {"NGTY", 7}, {"NIHA", 7}, {"NILL", 7}, {"NIOB", 7}, {"NITM", 7}, {"NIUS", 7},
+    {"NKWI", 7}, {"NLEG", 7}, {"NLYE", 7}, {"NMEA", 7}, {"NMYE", 7}, {"NNAT", 7},
+    {"NOFD", 7}, {"NOLD", 7}, {"NONA", 7}, {"NOPR", 7}, {"NORP", 7}, {"NOTK", 7},
+    {"NRIG", 7}, {"NSLO", 7}, {"NSPO", 7}, {"NSSI", 7}, {"NSSU", 7}, {"NSTY", 7},
+    {"NSVA", 7}, {"NTLO", 7}, {"NTMU", 7}, {"NTPL", 7}, {"NTTY", 7}, {"NTWE", 7},
+    {"NTWR", 7}, {"NTYE", 7}, {"NUAF", 7}, {"NUNM", 7}, {"NUSC", 7}, {"NUYO", 7},
+    {"NYAD", 7}, {"NYDE", 7}, {"NYTO", 7}, {"NYUS", 7}, {"OADM", 7}, {"OADU", 7},
+    {"OADV", 7}, {"OAFU", 7}, {"OASE", 7}, {"OATA", 7}, {"OAWA", 7}, {"OBEG", 7},
+    {"OCAR", 7}, {"OCKI", 7}, {"OCLO", 7}, {"OCTH", 7}, {"ODFO", 7}, {"ODUL", 7},
+    {"OEXA", 7}, {"OEXI", 7}, {"OEXT", 7}, {"OFCA", 7}, {"OFFL", 7}, {"OFFU", 7},
+    {"OFIV", 7}, {"OFNU", 7}, {"OFPL", 7}, {"OFUP", 7}, {"OFYE", 7}, {"OGFI", 7},
+    {"OHOW", 7}, {"OIGN", 7}, {"OILT", 7}, {"OKES", 7}, {"OLDB", 7}, {"OLDR", 7},
+    {"OLED", 7}, {"OLIF", 7}, {"OLSA", 7}, {"OLVI", 7}, {"OLWI", 7}, {"OMAM", 7},
+    {"OMBO", 7}, {"OMCO", 7}, {"OMNO", 7}, {"OMSA", 7}, {"OMWI", 7}, {"ONBA", 7},
+    {"ONDN", 7}, {"ONDU", 7}, {"ONLE", 7}, {"ONTP", 7}, {"ONTT", 7}, {"OOAN", 7},
+    {"OODE", 7}, {"OONB", 7}, {"OONF", 7}, {"OONP", 7}, {"OOPI", 7}, {"OPAL", 7},
+    {"OPHI", 7}, {"OPII", 7}, {"OPIP", 7}, {"OPOP", 7}, {"OPXI", 7}, {"OPYC", 7},
+    {"ORDF", 7}, {"ORDM", 7}, {"ORFE", 7}, {"OROV", 7}, {"ORTB", 7}, {"ORTD", 7},
+    {"ORYY", 7}, {"OSCO", 7}, {"OSHE", 7}, {"OSHI", 7}, {"OSPA", 7}, {"OSYN", 7},
+    {"OTAD", 7}, {"OTAG", 7}, {"OTGE", 7}, {"OTGO", 7}, {"OTLO", 7}, {"OTRI", 7},
+    {"OTWR", 7}, {"OUBA", 7}, {"OUIF", 7}, {"OULO", 7}, {"OUPL", 7}, {"OUPX", 7},
+    {"OVAP", 7}, {"OVIO", 7}, {"OVYG", 7}, {"OWLO", 7}, {"OWNF", 7}, {"OWSR", 7},
+    {"PEDC", 7}, {"PEED", 7}, {"PERV", 7}, {"PEYO", 7}, {"PGRA", 7}, {"PHIN", 7},
+    {"PICS", 7}, {"PILL", 7}, {"PIME", 7}, {"PIXE", 7}, {"PKEY", 7}, {"PLOI", 7},
+    {"PLOY", 7}, {"PMAP", 7}, {"POTI", 7}, {"PPLE", 7}, {"PSCO", 7}, {"PSOF", 7},
+    {"PTAG", 7}, {"PTIF", 7}, {"PULA", 7}, {"PUPI", 7}, {"PUPP", 7}, {"PUPS", 7},
+    {"PYMA", 7}, {"QUAT", 7}, {"QUEO", 7}, {"RABS", 7}, {"RAFU", 7}, {"RALD", 7},
+    {"RAMN", 7}, {"RAPL", 7}, {"RAPS", 7}, {"RASC", 7}, {"RASM", 7}, {"RATY", 7},
+    {"RAWT", 7}, {"RAYF", 7}, {"RAYW", 7}, {"RBEA", 7}, {"RBED", 7}, {"RBYP", 7},
+    {"RCEW", 7}, {"RCHS", 7}, {"RCLO", 7}, {"RCOV", 7}, {"RCUI", 7}, {"RCUS", 7},
+    {"RDCA", 7}, {"RDEA", 7}, {"RDMA", 7}, {"RDOV", 7}, {"RDOW", 7}, {"RDSC", 7},
+    {"RDWA", 7}, {"REGN", 7}, {"REHI", 7}, {"REJE", 7}, {"REUP", 7}, {"RFEE", 7},
+    {"RGEP", 7}, {"RGEV", 7}, {"RGSC", 7}, {"RHIS", 7}, {"RHOM", 7}, {"RIBI", 7},
+    {"RICF", 7}, {"RICP", 7}, {"RIFA", 7}, {"RIFO", 7}, {"RIMM", 7}, {"RIRI", 7},
+    {"RITB", 7}, {"RITM", 7}, {"RIVI", 7}, {"RKBU", 7}, {"RKNI", 7}, {"RKSJ", 7},
+    {"RKUS", 7}, {"RLCO", 7}, {"RLDA", 7}, {"RLIT", 7}, {"RLOW", 7}, {"RLVT", 7},
+    {"RMAR", 7}, {"RMAS", 7}, {"RMIG", 7}, {"RMRE", 7}, {"RMSD", 7}, {"RMWH", 7},
+    {"RNIA", 7}, {"ROLO", 7}, {"ROLS", 7}, {"ROMC", 7}, {"RORV", 7}, {"ROSC", 7},
+    {"ROWC", 7}, {"ROWO", 7}, {"RPAP", 7}, {"RPIM", 7}, {"RPUT", 7}, {"RRON", 7},
+    {"RSIM", 7}, {"RSOL", 7}, {"RSPH", 7}, {"RTAC", 7}, {"RTFR", 7}, {"RTHF", 7},
+    {"RTSF", 7}, {"RTTE", 7}, {"RUEI", 7}, {"RUMI", 7}, {"RUNP", 7}, {"RUSH", 7},
+    {"RVIT", 7}, {"RYAP", 7}, {"RYBU", 7}, {"RYEA", 7}, {"RYFR", 7}, {"RYHE", 7},
+    {"RYHI", 7}, {"RYNO", 7}, {"RYSA", 7}, {"SABC", 7}, {"SAFR", 7}, {"SAGB", 7},
+    {"SBAN", 7}, {"SBEM", 7}, {"SBEP", 7}, {"SBIG", 7}, {"SCEA", 7}, {"SCII", 7},
+    {"SCIN", 7}, {"SCIS", 7}, {"SCYO", 7}, {"SDAT", 7}, {"SDEE", 7}, {"SEAD", 7},
+    {"SECU", 7}, {"SEDR", 7}, {"SEGI", 7}, {"SELO", 7}, {"SEMY", 7}, {"SERO", 7},
+    {"SERR", 7}, {"SESR", 7}, {"SEWR", 7}, {"SFAS", 7}, {"SFIV", 7}, {"SFLU", 7},
+    {"SFOO", 7}, {"SGOO", 7}, {"SGOV", 7}, {"SHWH", 7}, {"SHYO", 7}, {"SIFW", 7},
+    {"SIME", 7}, {"SIRI", 7}, {"SISL", 7}, {"SKAN", 7}, {"SLYY", 7}, {"SMBY", 7},
+    {"SMFO", 7}, {"SMIF", 7}, {"SNAR", 7}, {"SNES", 7}, {"SNOD", 7}, {"SNTC", 7},
+    {"SNTH", 7}, {"SNTI", 7}, {"SNTR", 7}, {"SOAN", 7}, {"SONM", 7}, {"SOOB", 7},
+    {"SOPO", 7}, {"SSBU", 7}, {"SSCL", 7}, {"SSDE", 7}, {"SSIF", 7}, {"SSIL", 7},
+    {"SSLE", 7}, {"SSLI", 7}, {"SSLO", 7}, {"SSOB", 7}, {"SSQR", 7}, {"SSSO", 7},
+    {"STET", 7}, {"STMU", 7}, {"STOH", 7}, {"STSS", 7}, {"STSY", 7}, {"STTW", 7},
+    {"STTY", 7}, {"SUGG", 7}, {"SVUL", 7}, {"SWES", 7}, {"SWEW", 7}, {"TABR", 7},
+    {"TABY", 7}, {"TACK", 7}, {"TADV", 7}, {"TAGF", 7}, {"TAGT", 7}, {"TALC", 7},
+    {"TAQU", 7}, {"TASF", 7}, {"TAXO", 7}, {"TBEW", 7}, {"TBRA", 7}, {"TBRE", 7},
+    {"TBYC", 7}, {"TBYS", 7}, {"TCLO", 7}, {"TDAN", 7}, {"TDER", 7}, {"TDOC", 7},
+    {"TEAG", 7}, {"TEDG", 7}, {"TENL", 7}, {"TENV", 7}, {"TERX", 7}, {"TFEL", 7},
+    {"TGLO", 7}, {"TGUI", 7}, {"THBO", 7}, {"THCR", 7}, {"THDE", 7}, {"THGR", 7},
+    {"THLE", 7}, {"THPO", 7}, {"THPU", 7}, {"THTA", 7}, {"THTT", 7}, {"TIAT", 7},
+    {"TIED", 7}, {"TIFL", 7}, {"TINN", 7}, {"TINY", 7}, {"TJUS", 7}, {"TLON", 7},
+    {"TLYP", 7}, {"TNAT", 7}, {"TNOL", 7}, {"TOAU", 7}, {"TOBA", 7}, {"TOBO", 7},
+    {"TOCE", 7}, {"TOGL", 7}, {"TOOH", 7}, {"TOOO", 7}, {"TOTO", 7}, {"TOYA", 7},
+    {"TRLF", 7}, {"TRLG", 7}, {"TRLL", 7}, {"TSAF", 7}, {"TSIM", 7}, {"TSIZ", 7},
+    {"TSOV", 7}, {"TSQR", 7}, {"TSSH", 7}, {"TSYS", 7}, {"TTYG", 7}, {"TUPT", 7},
+    {"TXTB", 7}, {"TXTL", 7}, {"TXTN", 7}, {"TYFI", 7}, {"TYRI", 7}, {"TYSU", 7},
+    {"UAFF", 7}, {"UARA", 7}, {"UBAC", 7}, {"UBRO", 7}, {"UBUF", 7}, {"UCTF", 7},
+    {"UEAL", 7}, {"UEBE", 7}, {"UEEN", 7}, {"UEON", 7}, {"UEPA", 7}, {"UESU", 7},
+    {"UEXP", 7}, {"UFLI", 7}, {"UGHF", 7}, {"UGME", 7}, {"UINC", 7}, {"UISN", 7},
+    {"UITH", 7}, {"UITO", 7}, {"UITT", 7}, {"ULEA", 7}, {"ULEI", 7}, {"ULIB", 7},
+    {"ULLL", 7}, {"ULLP", 7}, {"ULLT", 7}, {"ULUS", 7}, {"UMAD", 7}, {"UMOR", 7},
+    {"UMPR", 7}, {"UMSI", 7}, {"UMSO", 7}, {"UNCR", 7}, {"UNDL", 7}, {"UNET", 7},
+    {"UNEX", 7}, {"UNKN", 7}, {"UNME", 7}, {"UNPO", 7}, {"UNSI", 7}, {"UNSR", 7},
+    {"UOPE", 7}, {"UPGR", 7}, {"UPIS", 7}, {"UPOR", 7}, {"URBA", 7}, {"URBY", 7},
+    {"URDP", 7}, {"URER", 7}, {"URYA", 7}, {"USBE", 7}, {"USFI", 7}, {"USHE", 7},
+    {"USTU", 7}, {"USTW", 7}, {"USWA", 7}, {"UTEM", 7}, {"UTEX", 7}, {"UTFA", 7},
+    {"UTFE", 7}, {"UTOD", 7}, {"UTPE", 7}, {"UTPR", 7}, {"UTRA", 7}, {"UTSU", 7},
+    {"UTWE", 7}, {"UUMS", 7}, {"VEAW", 7}, {"VEHI", 7}, {"VELT", 7}, {"VEOU", 7},
+    {"VEPE", 7}, {"VESD", 7}, {"VIII", 7}, {"VIRI", 7}, {"VIVI", 7}, {"VOLV", 7},
+    {"VYGL", 7}, {"WATT", 7}, {"WDIR", 7}, {"WEBS", 7}, {"WECO", 7}, {"WENE", 7},
+    {"WERR", 7}, {"WETH", 7}, {"WEWA", 7}, {"WFRE", 7}, {"WIST", 7}, {"WITS", 7},
+    {"WITW", 7}, {"WLET", 7}, {"WMES", 7}, {"WODI", 7}, {"WOFO", 7}, {"WOOD", 7},
+    {"WPOS", 7}, {"WSEC", 7}, {"WSUC", 7}, {"WSYS", 7}, {"XADE", 7}, {"XDEL", 7},
+    {"XDIN", 7}, {"XDST", 7}, {"XEDO", 7}, {"XEDT", 7}, {"XEDW", 7}, {"XELS", 7},
+    {"XGRE", 7}, {"XITC", 7}, {"XITI", 7}, {"XTAS", 7}, {"XTBU", 7}, {"XTCA", 7},
+    {"XTHO", 7}, {"XTWO", 7}, {"XWHE", 7}, {"YASA", 7}, {"YASY", 7}, {"YATA", 7},
+    {"YBRI", 7}, {"YCAL", 7}, {"YDER", 7}, {"YDOW", 7}, {"YEBY", 7}, {"YETW", 7},
+    {"YEWA", 7}, {"YEWI", 7}, {"YFER", 7}, {"YFUR", 7}, {"YGRO", 7}, {"YISR", 7},
+    {"YITA", 7}, {"YITF", 7}, {"YITO", 7}, {"YITU", 7}, {"YJUS", 7}, {"YMET", 7},
+    {"YOFR", 7}, {"YORB", 7}, {"YPEB", 7}, {"YPEH", 7}, {"YPOS", 7}, {"YRUN", 7},
+    {"YSEA", 7}, {"YSEP", 7}, {"YSFR", 7}, {"YSON", 7}, {"YSPU", 7}, {"YSYN", 7},
+    {"YTAK", 7}, {"YTES", 7}, {"YTOL", 7}, {"YWEL", 7}, {"ZONA", 7}, {"AARE", 6},
+    {"ABKE", 6}, {"ABLI", 6}, {"ABOO", 6}, {"ABRE", 6}, {"ABWI", 6}, {"ACBI", 6},
+    {"ACFI", 6}, {"ACIO", 6}, {"ACTM", 6}, {"ADAP", 6}, {"ADDP", 6}, {"ADEE", 6},
+    {"ADFA", 6}, {"ADJU", 6}, {"ADSO", 6}, {"ADYI", 6}, {"AEND", 6}, {"AFAS", 6},
+    {"AFIF", 6}, {"AFIT", 6}, {"AFIX", 6}, {"AFTB", 6}, {"AGSC", 6}, {"AGSM", 6},
+    {"AGSP", 6}, {"AHIG", 6}, {"AIDO", 6}, {"AINV", 6}, {"AIRD", 6}, {"AIRM", 6},
+    {"AITS", 6}, {"AKEW", 6}, {"ALCT", 6}, {"ALEG", 6}, {"ALEO", 6}, {"ALOW", 6},
+    {"ALTC", 6}, {"ALYO", 6}, {"AMIC", 6}, {"AMSB", 6}, {"AMSC", 6}, {"AMSH", 6},
+    {"AMUN", 6}, {"AMVI", 6}, {"ANAF", 6}, {"ANCI", 6}, {"ANEC", 6}, {"ANHO", 6},
+    {"ANKI", 6}, {"ANMM", 6}, {"AORD", 6}, {"APAL", 6}, {"APIE", 6}, {"APIL", 6},
+    {"APPA", 6}, {"APUR", 6}, {"APVI", 6}, {"ARAM", 6}, {"ARAP", 6}, {"ARCA", 6},
+    {"AREK", 6}, {"ARFR", 6}, {"ARKN", 6}, {"ARSP", 6}, {"ARSU", 6}, {"ARUN", 6},
+    {"ARWA", 6}, {"ASFE", 6}, {"ASFU", 6}, {"ASHC", 6}, {"ASIO", 6}, {"ASME", 6},
+    {"ASSG", 6}, {"ASSQ", 6}, {"ASSV", 6}, {"ASUI", 6}, {"ASYM", 6}, {"ATEG", 6},
+    {"ATFU", 6}, {"ATKI", 6}, {"ATPU", 6}, {"ATRY", 6}, {"ATSN", 6}, {"ATSS", 6},
+    {"ATSY", 6}, {"ATTW", 6}, {"AUBU", 6}, {"AUND", 6}, {"AVAC", 6}, {"AXEN", 6},
+    {"AYBA", 6}, {"AYPL", 6}, {"AYPR", 6}, {"AYSN", 6}, {"BAGE", 6}, {"BDUC", 6},
+    {"BEAW", 6}, {"BEBU", 6}, {"BEED", 6}, {"BEFA", 6}, {"BEIL", 6}, {"BEOB", 6},
+    {"BERV", 6}, {"BERY", 6}, {"BHCI", 6}, {"BIEN", 6}, {"BINV", 6}, {"BITB", 6},
+    {"BITU", 6}, {"BJOB", 6}, {"BKEY", 6}, {"BMEN", 6}, {"BOLA", 6}, {"BOLD", 6},
+    {"BOLI", 6}, {"BOOL", 6}, {"BPER", 6}, {"BREW", 6}, {"BWIL", 6}, {"BYAM", 6},
+    {"BYCA", 6}, {"BYFI", 6}, {"BYFR", 6}, {"BYIM", 6}, {"BYLE", 6}, {"BYNE", 6},
+    {"BYNO", 6}, {"BYPE", 6}, {"BYSH", 6}, {"BYSP", 6}, {"CALW", 6}, {"CBUT", 6},
+    {"CDOM", 6}, {"CEAC", 6}, {"CEAW", 6}, {"CECH", 6}, {"CEKE", 6}, {"CELS", 6},
+    {"CESV", 6}, {"CHGL", 6}, {"CHGO", 6}, {"CHOH", 6}, {"CHPL", 6}, {"CHRI", 6},
+    {"CHSY", 6}, {"CHTT", 6}, {"CHVA", 6}, {"CHYM", 6}, {"CIDB", 6}, {"CIOU", 6},
+    {"CISA", 6}, {"CKDI", 6}, {"CKSE", 6}, {"CKSO", 6}, {"CKSW", 6}, {"CLAN", 6},
+    {"CNEW", 6}, {"CONI", 6}, {"CORC", 6}, {"CPER", 6}, {"CREF", 6}, {"CREP", 6},
+    {"CSEC", 6}, {"CSOF", 6}, {"CSTH", 6}, {"CSUB", 6}, {"CTBY", 6}, {"CTHA", 6},
+    {"CTNE", 6}, {"CTSY", 6}, {"CTUM", 6}, {"CUND", 6}, {"DABR", 6}, {"DAFF", 6},
+    {"DASR", 6}, {"DAYL", 6}, {"DBEB", 6}, {"DBED", 6}, {"DBEW", 6}, {"DBIN", 6},
+    {"DBYB", 6}, {"DBYU", 6}, {"DCLE", 6}, {"DCPR", 6}, {"DCRE", 6}, {"DCUT", 6},
+    {"DDAC", 6}, {"DDEA", 6}, {"DDEE", 6}, {"DDFU", 6}, {"DDMA", 6}, {"DDRA", 6},
+    {"DDYO", 6}, {"DEAB", 6}, {"DEAP", 6}, {"DEEN", 6}, {"DEFC", 6}, {"DEFL", 6},
+    {"DEFN", 6}, {"DENA", 6}, {"DEPL", 6}, {"DEPT", 6}, {"DEQU", 6}, {"DESN", 6},
+    {"DFLO", 6}, {"DFUL", 6}, {"DHEI", 6}, {"DHIG", 6}, {"DHIM", 6}, {"DICE", 6},
+    {"DICO", 6}, {"DINB", 6}, {"DINN", 6}, {"DISF", 6}, {"DISH", 6}, {"DITV", 6},
+    {"DLEM", 6}, {"DLIQ", 6}, {"DLYW", 6}, {"DMUL", 6}, {"DMYE", 6}, {"DMYS", 6},
+    {"DOAU", 6}, {"DOBU", 6}, {"DOBY", 6}, {"DOFD", 6}, {"DOFH", 6}, {"DOFW", 6},
+    {"DOIS", 6}, {"DORU", 6}, {"DOWD", 6}, {"DOWY", 6}, {"DPOP", 6}, {"DPOW", 6},
+    {"DREN", 6}, {"DSAU", 6}, {"DSDO", 6}, {"DSER", 6}, {"DSIS", 6}, {"DSNO", 6},
+    {"DSSH", 6}, {"DSUN", 6}, {"DSVI", 6}, {"DTDA", 6}, {"DTEN", 6}, {"DUEP", 6},
+    {"DULE", 6}, {"DURE", 6}, {"DUSR", 6}, {"DVAP", 6}, {"DYRE", 6}, {"DYSE", 6},
+    {"EAAN", 6}, {"EABE", 6}, {"EABU", 6}, {"EAES", 6}, {"EAIN", 6}, {"EAIS", 6},
+    {"EALP", 6}, {"EANP", 6}, {"EAPT", 6}, {"EAUS", 6}, {"EAWI", 6}, {"EBAL", 6},
+    {"EBYE", 6}, {"ECKE", 6}, {"ECSY", 6}, {"ECTP", 6}, {"EDLO", 6}, {"EDNU", 6},
+    {"EDSC", 6}, {"EDTD", 6}, {"EDUR", 6}, {"EDXY", 6}, {"EEKG", 6}, {"EEMO", 6},
+    {"EENH", 6}, {"EEOU", 6}, {"EESE", 6}, {"EESF", 6}, {"EEUS", 6}, {"EFGE", 6},
+    {"EFID", 6}, {"EFKE", 6}, {"EGCO", 6}, {"EGFO", 6}, {"EGMA", 6}, {"EGOL", 6},
+    {"EGRI", 6}, {"EGTO", 6}, {"EHIT", 6}, {"EHUM", 6}, {"EHUN", 6}, {"EIRU", 6},
+    {"EISK", 6}, {"EITN", 6}, {"EIUS", 6}, {"EIWA", 6}, {"EKAB", 6}, {"EKDE", 6},
+    {"ELAI", 6}, {"ELCO", 6}, {"ELPH", 6}, {"ELPY", 6}, {"ELSI", 6}, {"ELSO", 6},
+    {"ELSU", 6}, {"ELTI", 6}, {"ELUN", 6}, {"ELYH", 6}, {"EMMC", 6}, {"EMNO", 6},
+    {"EMSB", 6}, {"EMUT", 6}, {"EMYH", 6}, {"ENDV", 6}, {"ENGI", 6}, {"ENHI", 6},
+    {"ENIO", 6}, {"ENMY", 6}, {"ENOB", 6}, {"ENOC", 6}, {"ENOS", 6}, {"ENSC", 6},
+    {"ENSM", 6}, {"ENSY", 6}, {"EOBT", 6}, {"EONC", 6}, {"EORV", 6}, {"EPOD", 6},
+    {"EPRA", 6}, {"EPTB", 6}, {"EPUP", 6}, {"ERAM", 6}, {"EREJ", 6}, {"ERFL", 6},
+    {"ERGO", 6}, {"ERIL", 6}, {"ERKI", 6}, {"ERPT", 6}, {"ERTF", 6}, {"ERVD", 6},
+    {"ESCC", 6}, {"ESFA", 6}, {"ESIC", 6}, {"ESOH", 6}, {"ETCI", 6}, {"ETGU", 6},
+    {"ETIF", 6}, {"EURL", 6}, {"EVED", 6}, {"EWEW", 6}, {"EWEX", 6}, {"EWVA", 6},
+    {"EXYZ", 6}, {"EYAL", 6}, {"EYOR", 6}, {"EYSF", 6}, {"EYWA", 6}, {"FACA", 6},
+    {"FAFU", 6}, {"FAGA", 6}, {"FAMO", 6}, {"FASA", 6}, {"FAVO", 6}, {"FAWH", 6},
+    {"FCIR", 6}, {"FEAR", 6}, {"FERP", 6}, {"FETH", 6}, {"FEWL", 6}, {"FEWT", 6},
+    {"FFAI", 6}, {"FFWI", 6}, {"FFYO", 6}, {"FIFY", 6}, {"FINF", 6}, {"FIST", 6},
+    {"FITD", 6}, {"FONL", 6}, {"FOUL", 6}, {"FPOS", 6}, {"FRIC", 6}, {"FRIE", 6},
+    {"FRIG", 6}, {"FTBY", 6}, {"FTCO", 6}, {"FTTH", 6}, {"FULC", 6}, {"FULE", 6},
+    {"FULN", 6}, {"FUNI", 6}, {"FUPT", 6}, {"FWHO", 6}, {"FYAR", 6}, {"FYAS", 6},
+    {"FYBO", 6}, {"FYSI", 6}, {"GABL", 6}, {"GAFT", 6}, {"GALW", 6}, {"GARB", 6},
+    {"GASP", 6}, {"GASS", 6}, {"GAWA", 6}, {"GAWO", 6}, {"GBYE", 6}, {"GEAP", 6},
+    {"GEEN", 6}, {"GETN", 6}, {"GETV", 6}, {"GEXA", 6}, {"GEXC", 6}, {"GFIR", 6},
+    {"GFOL", 6}, {"GGLO", 6}, {"GHOW", 6}, {"GIFI", 6}, {"GINL", 6}, {"GINU", 6},
+    {"GINY", 6}, {"GLOA", 6}, {"GLOC", 6}, {"GMAR", 6}, {"GMES", 6}, {"GMLO", 6},
+    {"GMOS", 6}, {"GNAC", 6}, {"GOAW", 6}, {"GOFS", 6}, {"GOMA", 6}, {"GPLU", 6},
+    {"GPUT", 6}, {"GREN", 6}, {"GSCR", 6}, {"GSEC", 6}, {"GSOT", 6}, {"GSPA", 6},
+    {"GSST", 6}, {"GSUB", 6}, {"GTHW", 6}, {"GTOC", 6}, {"GUNT", 6}, {"GUPA", 6},
+    {"GVIE", 6}, {"GWAR", 6}, {"GWRI", 6}, {"HABI", 6}, {"HADF", 6}, {"HADM", 6},
+    {"HALS", 6}, {"HANV", 6}, {"HASD", 6}, {"HAWH", 6}, {"HBOD", 6}, {"HCAU", 6},
+    {"HCOV", 6}, {"HDIN", 6}, {"HDIR", 6}, {"HEBS", 6}, {"HEDF", 6}, {"HEDP", 6},
+    {"HEDU", 6}, {"HEJO", 6}, {"HEWC", 6}, {"HEYK", 6}, {"HEYV", 6}, {"HHEL", 6},
+    {"HHER", 6}, {"HHIT", 6}, {"HIDI", 6}, {"HIFY", 6}, {"HIHA", 6}, {"HITF", 6},
+    {"HITO", 6}, {"HKEY", 6}, {"HLET", 6}, {"HLON", 6}, {"HMAR", 6}, {"HNOL", 6},
+    {"HOEV", 6}, {"HOOL", 6}, {"HOTT", 6}, {"HOVE", 6}, {"HOWF", 6}, {"HPOL", 6},
+    {"HPUR", 6}, {"HSEV", 6}, {"HSHA", 6}, {"HSHI", 6}, {"HSMA", 6}, {"HSYN", 6},
+    {"HTLO", 6}, {"HTLY", 6}, {"HTPE", 6}, {"HTSA", 6}, {"HUSM", 6}, {"HUSN", 6},
+    {"HVIO", 6}, {"HWAR", 6}, {"HWOU", 6}, {"HYMI", 6}, {"IALB", 6}, {"IALW", 6},
+    {"IBVI", 6}, {"ICEM", 6}, {"ICHK", 6}, {"ICHU", 6}, {"ICSA", 6}, {"ICSY", 6},
+    {"IDBE", 6}, {"IDEC", 6}, {"IDEG", 6}, {"IDEV", 6}, {"IDMA", 6}, {"IDOR", 6},
+    {"IDSP", 6}, {"IDTR", 6}, {"IDUP", 6}, {"IEFI", 6}, {"IEFL", 6}, {"IEWF", 6},
+    {"IFAP", 6}, {"IFAV", 6}, {"IFFM", 6}, {"IFSO", 6}, {"IFTA", 6}, {"IFTI", 6},
+    {"IFTY", 6}, {"IFYW", 6}, {"IGCH", 6}, {"IGIB", 6}, {"IGOM", 6}, {"IIIT", 6},
+    {"IKEN", 6}, {"ILDM", 6}, {"ILEX", 6}, {"ILLJ", 6}, {"ILLK", 6}, {"IMAU", 6},
+    {"IMBA", 6}, {"IMEM", 6}, {"IMGU", 6}, {"IMIG", 6}, {"IMTR", 6}, {"IMUN", 6},
+    {"INDN", 6}, {"INRI", 6}, {"INRO", 6}, {"INSG", 6}, {"INTC", 6}, {"IORA", 6},
+    {"IPTM", 6}, {"IRAS", 6}, {"IRDM", 6}, {"IRDW", 6}, {"IREI", 6}, {"IRHE", 6},
+    {"IRTO", 6}, {"IRTR", 6}, {"IRUP", 6}, {"IRWE", 6}, {"ISAA", 6}, {"ISDR", 6},
+    {"ISHP", 6}, {"ISHW", 6}, {"ISHY", 6}, {"ISMR", 6}, {"ISRI", 6}, {"ISTD", 6},
+    {"ISVA", 6}, {"ITAR", 6}, {"ITCR", 6}, {"ITFE", 6}, {"ITPR", 6}, {"ITSY", 6},
+    {"ITVA", 6}, {"IUMM", 6}, {"IVEE", 6}, {"IVEH", 6}, {"IVEV", 6}, {"IXDE", 6},
+    {"IXES", 6}, {"IXFO", 6}, {"IXIT", 6}, {"IXWI", 6}, {"IZEA", 6}, {"JOBS", 6},
+    {"JUNV", 6}, {"KCHE", 6}, {"KCIR", 6}, {"KEAB", 6}, {"KEAP", 6}, {"KEAR", 6},
+    {"KECA", 6}, {"KECE", 6}, {"KECI", 6}, {"KEDD", 6}, {"KEDO", 6}, {"KEFR", 6},
+    {"KEQU", 6}, {"KESC", 6}, {"KETE", 6}, {"KETS", 6}, {"KEWH", 6}, {"KEYE", 6},
+    {"KFIN", 6}, {"KINI", 6}, {"KKKK", 6}, {"KLET", 6}, {"KMAR", 6}, {"KMOD", 6},
+    {"KNEE", 6}, {"KOND", 6}, {"KPAP", 6}, {"KSPE", 6}, {"KSPR", 6}, {"KSUS", 6},
+    {"LAGI", 6}, {"LALW", 6}, {"LAMA", 6}, {"LAMO", 6}, {"LANC", 6}, {"LARB", 6},
+    {"LARY", 6}, {"LASI", 6}, {"LAWF", 6}, {"LAWT", 6}, {"LAYB", 6}, {"LAYC", 6},
+    {"LBEO", 6}, {"LBOT", 6}, {"LCIS", 6}, {"LDAR", 6}, {"LDCH", 6}, {"LDCL", 6},
+    {"LDNE", 6}, {"LDOW", 6}, {"LDPA", 6}, {"LDTR", 6}, {"LDVA", 6}, {"LEDD", 6},
+    {"LEDU", 6}, {"LEEC", 6}, {"LEER", 6}, {"LEFA", 6}, {"LEFU", 6}, {"LEPH", 6},
+    {"LERN", 6}, {"LEXA", 6}, {"LEXE", 6}, {"LFAR", 6}, {"LGOT", 6}, {"LHAP", 6},
+    {"LHOM", 6}, {"LIBV", 6}, {"LICD", 6}, {"LIDG", 6}, {"LIDO", 6}, {"LIGI", 6},
+    {"LISA", 6}, {"LITF", 6}, {"LITO", 6}, {"LLFU", 6}, {"LLHE", 6}, {"LLJU", 6},
+    {"LLKN", 6}, {"LLNA", 6}, {"LLPU", 6}, {"LMAC", 6}, {"LMET", 6}, {"LNEC", 6},
+    {"LOBR", 6}, {"LOCC", 6}, {"LOFM", 6}, {"LOFS", 6}, {"LONA", 6}, {"LORO", 6},
+    {"LORX", 6}, {"LPOL", 6}, {"LPTH", 6}, {"LPYO", 6}, {"LRIN", 6}, {"LSOE", 6},
+    {"LSPO", 6}, {"LTOE", 6}, {"LTOW", 6}, {"LTSA", 6}, {"LUMB", 6}, {"LVAB", 6},
+    {"LVET", 6}, {"LWRI", 6}, {"LYED", 6}, {"LYHO", 6}, {"LYIM", 6}, {"LYJU", 6},
+    {"LYKN", 6}, {"MABO", 6}, {"MALD", 6}, {"MALN", 6}, {"MAMA", 6}, {"MANS", 6},
+    {"MANV", 6}, {"MASE", 6}, {"MASP", 6}, {"MATF", 6}, {"MATL", 6}, {"MAUT", 6},
+    {"MAYE", 6}, {"MAYU", 6}, {"MAYV", 6}, {"MBEN", 6}, {"MBIE", 6}, {"MBYR", 6},
+    {"MCOU", 6}, {"MCSI", 6}, {"MDEL", 6}, {"MDOC", 6}, {"MDTO", 6}, {"MEAP", 6},
+    {"MEHA", 6}, {"MEIW", 6}, {"MERB", 6}, {"MERH", 6}, {"MERU", 6}, {"MGUE", 6},
+    {"MICI", 6}, {"MIFO", 6}, {"MINL", 6}, {"MISE", 6}, {"MISM", 6}, {"MISW", 6},
+    {"MLAT", 6}, {"MLOR", 6}, {"MLPO", 6}, {"MMCS", 6}, {"MMOD", 6}, {"MNAM", 6},
+    {"MOFW", 6}, {"MOKE", 6}, {"MONA", 6}, {"MOOT", 6}, {"MPET", 6}, {"MPFO", 6},
+    {"MPTS", 6}, {"MPTW", 6}, {"MSHA", 6}, {"MSLO", 6}, {"MSME", 6}, {"MSNE", 6},
+    {"MSNO", 6}, {"MSON", 6}, {"MSTR", 6}, {"MTAK", 6}, {"MTOH", 6}, {"MTYP", 6},
+    {"MUPO", 6}, {"MYHO", 6}, {"NALB", 6}, {"NASO", 6}, {"NBEN", 6}, {"NBYA", 6},
+    {"NCMA", 6}, {"NCTN", 6}, {"NCTO", 6}, {"NDAI", 6}, {"NDAV", 6}, {"NDDR", 6},
+    {"NDIX", 6}, {"NDLU", 6}, {"NDLY", 6}, {"NDOC", 6}, {"NDSG", 6}, {"NDSK", 6},
+    {"NDSV", 6}, {"NDTT", 6}, {"NEDV", 6}, {"NEDY", 6}, {"NEJU", 6}, {"NELO", 6},
+    {"NERW", 6}, {"NGCI", 6}, {"NGTR", 6}, {"NIAC", 6}, {"NIMU", 6}, {"NION", 6},
+    {"NIRO", 6}, {"NIXO", 6}, {"NIXV", 6}, {"NKAN", 6}, {"NKOF", 6}, {"NKSA", 6},
+    {"NKTO", 6}, {"NLYH", 6}, {"NMER", 6}, {"NMIS", 6}, {"NMMC", 6}, {"NMOT", 6},
+    {"NNEX", 6}, {"NOAL", 6}, {"NOBT", 6}, {"NOFH", 6}, {"NOFY", 6}, {"NOLI", 6},
+    {"NONP", 6}, {"NORS", 6}, {"NORV", 6}, {"NOSU", 6}, {"NOUN", 6}, {"NOVV", 6},
+    {"NOWF", 6}, {"NOWO", 6}, {"NOWV", 6}, {"NPAN", 6}, {"NRVI", 6}, {"NSDO", 6},
+    {"NSIC", 6}, {"NSRA", 6}, {"NSSH", 6}, {"NSVE", 6}, {"NTFU", 6}, {"NTGR", 6},
+    {"NTKE", 6}, {"NTQS", 6}, {"NTXT", 6}, {"NTYW", 6}, {"NUBA", 6}, {"NUEA", 6},
+    {"NUNL", 6}, {"NVOL", 6}, {"NYAP", 6}, {"NYAR", 6}, {"NYGE", 6}, {"OABL", 6},
+    {"OATI", 6}, {"OBEB", 6}, {"OCAB", 6}, {"OCAS", 6}, {"OCER", 6}, {"OCKM", 6},
+    {"OCKW", 6}, {"OCOV", 6}, {"OCUR", 6}, {"ODAR", 6}, {"ODOU", 6}, {"ODTO", 6},
+    {"ODYB", 6}, {"ODYC", 6}, {"OFBR", 6}, {"OFCI", 6}, {"OFEL", 6}, {"OFFW", 6},
+    {"OFHE", 6}, {"OFKE", 6}, {"OFOI", 6}, {"OFQU", 6}, {"OFSY", 6}, {"OFTP", 6},
+    {"OGIN", 6}, {"OGMA", 6}, {"OGOA", 6}, {"OGOO", 6}, {"OGUA", 6}, {"OHAR", 6},
+    {"OHAS", 6}, {"OHIS", 6}, {"OIDM", 6}, {"OITF", 6}, {"OITO", 6}, {"OITW", 6},
+    {"OKWH", 6}, {"OLAN", 6}, {"OLDD", 6}, {"OLER", 6}, {"OLEV", 6}, {"OMAG", 6},
+    {"OMEG", 6}, {"OMLI", 6}, {"OMRE", 6}, {"ONEK", 6}, {"ONGU", 6}, {"ONPA", 6},
+    {"ONRA", 6}, {"ONTU", 6}, {"ONYI", 6}, {"OODS", 6}, {"OOHA", 6}, {"OOKD", 6},
+    {"OOMU", 6}, {"OONO", 6}, {"OORA", 6}, {"OORM", 6}, {"OOWH", 6}, {"OPLI", 6},
+    {"ORAI", 6}, {"ORCP", 6}, {"ORCU", 6}, {"ORDB", 6}, {"ORDH", 6}, {"ORDX", 6},
+    {"ORMF", 6}, {"ORMR", 6}, {"OROI", 6}, {"ORPD", 6}, {"ORQU", 6}, {"ORSR", 6},
+    {"ORTP", 6}, {"ORXM", 6}, {"OSOI", 6}, {"OSSC", 6}, {"OTBO", 6}, {"OTEE", 6},
+    {"OTEP", 6}, {"OTFU", 6}, {"OTHP", 6}, {"OTOB", 6}, {"OTOG", 6}, {"OTOS", 6},
+    {"OTPO", 6}, {"OTSI", 6}, {"OTUN", 6}, {"OTVE", 6}, {"OTWE", 6}, {"OULL", 6},
+    {"OUPC", 6}, {"OUPF", 6}, {"OUPO", 6}, {"OURK", 6}, {"OUSU", 6}, {"OUTG", 6},
+    {"OUTN", 6}, {"OVAL", 6}, {"OVEU", 6}, {"OVVI", 6}, {"OWBO", 6}, {"OWCH", 6},
+    {"OWFU", 6}, {"OWGE", 6}, {"OWNB", 6}, {"OWRO", 6}, {"OWSL", 6}, {"OWSP", 6},
+    {"OXYC", 6}, {"OXYS", 6}, {"OYER", 6}, {"PACH", 6}, {"PACT", 6}, {"PADI", 6},
+    {"PEAD", 6}, {"PEDS", 6}, {"PEDW", 6}, {"PEIF", 6}, {"PEMA", 6}, {"PEPR", 6},
+    {"PEVE", 6}, {"PEWH", 6}, {"PHEL", 6}, {"PINA", 6}, {"PIND", 6}, {"PINF", 6},
+    {"PITI", 6}, {"PLYD", 6}, {"POFS", 6}, {"POTO", 6}, {"POUT", 6}, {"PPOP", 6},
+    {"PPUT", 6}, {"PSFO", 6}, {"PSFS", 6}, {"PSOM", 6}, {"PSYO", 6}, {"PSYS", 6},
+    {"PTBU", 6}, {"PTFR", 6}, {"PTID", 6}, {"PTPL", 6}, {"PTSY", 6}, {"PTWR", 6},
+    {"PURS", 6}, {"PUTL", 6}, {"PUTM", 6}, {"PVII", 6}, {"PYTE", 6}, {"QCOM", 6},
+    {"QSHA", 6}, {"QUEI", 6}, {"RABA", 6}, {"RABB", 6}, {"RABE", 6}, {"RABU", 6},
+    {"RAFA", 6}, {"RAGM", 6}, {"RAIR", 6}, {"RAMR", 6}, {"RARR", 6}, {"RASL", 6},
+    {"RBAG", 6}, {"RBIG", 6}, {"RBOW", 6}, {"RBYI", 6}, {"RCEU", 6}, {"RCPR", 6},
+    {"RCSO", 6}, {"RDBE", 6}, {"RDDI", 6}, {"RDEB", 6}, {"RDES", 6}, {"RDNE", 6},
+    {"RDOU", 6}, {"RDPL", 6}, {"RDRA", 6}, {"RDSD", 6}, {"RDSH", 6}, {"RDSM", 6},
+    {"REBA", 6}, {"RECL", 6}, {"REEY", 6}, {"REKE", 6}, {"RENG", 6}, {"REOT", 6},
+    {"RERW", 6}, {"RESM", 6}, {"RESY", 6}, {"REXI", 6}, {"RILL", 6}, {"RINM", 6},
+    {"RINO", 6}, {"RITC", 6}, {"RKAR", 6}, {"RKAU", 6}, {"RKMU", 6}, {"RKNO", 6},
+    {"RKSH", 6}, {"RKSM", 6}, {"RLEV", 6}, {"RLWW", 6}, {"RLYF", 6}, {"RLYP", 6},
+    {"RMDI", 6}, {"RMME", 6}, {"RMMO", 6}, {"RNCO", 6}, {"RNEX", 6}, {"RNIT", 6},
+    {"RNSA", 6}, {"ROBI", 6}, {"ROBJ", 6}, {"ROCK", 6}, {"ROFG", 6}, {"ROFH", 6},
+    {"ROIN", 6}, {"ROMG", 6}, {"RONW", 6}, {"RORN", 6}, {"RORY", 6}, {"RPDF", 6},
+    {"RPOP", 6}, {"RRIC", 6}, {"RRUS", 6}, {"RSGE", 6}, {"RSSH", 6}, {"RSTG", 6},
+    {"RSTY", 6}, {"RTCA", 6}, {"RTHB", 6}, {"RTNA", 6}, {"RTOL", 6}, {"RTSM", 6},
+    {"RTWA", 6}, {"RTYH", 6}, {"RTYI", 6}, {"RUEA", 6}, {"RUMB", 6}, {"RVIV", 6},
+    {"RXML", 6}, {"RYAC", 6}, {"RYDE", 6}, {"RYGO", 6}, {"SADR", 6}, {"SANT", 6},
+    {"SATF", 6}, {"SATL", 6}, {"SAYS", 6}, {"SBEN", 6}, {"SBEO", 6}, {"SBYD", 6},
+    {"SBYE", 6}, {"SBYI", 6}, {"SBYU", 6}, {"SCCO", 6}, {"SCUS", 6}, {"SDIA", 6},
+    {"SDOT", 6}, {"SEDC", 6}, {"SELA", 6}, {"SESD", 6}, {"SESN", 6}, {"SETG", 6},
+    {"SFEA", 6}, {"SFIG", 6}, {"SFLA", 6}, {"SFSF", 6}, {"SFTP", 6}, {"SGML", 6},
+    {"SHAK", 6}, {"SHME", 6}, {"SHOM", 6}, {"SHVI", 6}, {"SHWI", 6}, {"SINU", 6},
+    {"SITF", 6}, {"SITP", 6}, {"SIXI", 6}, {"SKNO", 6}, {"SLOS", 6}, {"SLYE", 6},
+    {"SMAC", 6}, {"SMOK", 6}, {"SMOO", 6}, {"SNET", 6}, {"SNTK", 6}, {"SOAG", 6},
+    {"SOGE", 6}, {"SOGO", 6}, {"SOIL", 6}, {"SOMI", 6}, {"SOMO", 6}, {"SONU", 6},
+    {"SOPR", 6}, {"SPAP", 6}, {"SPOP", 6}, {"SSCI", 6}, {"SSEM", 6}, {"SSEX", 6},
+    {"SSFU", 6}, {"SSUN", 6}, {"STBA", 6}, {"STES", 6}, {"STGO", 6}, {"STQU", 6},
+    {"STRC", 6}, {"STSG", 6}, {"STYE", 6}, {"SUBC", 6}, {"SUES", 6}, {"SUMP", 6},
+    {"SUNR", 6}, {"SURV", 6}, {"SUST", 6}, {"SWEA", 6}, {"SXYZ", 6}, {"SYMP", 6},
+    {"TABK", 6}, {"TABV", 6}, {"TAFE", 6}, {"TAGG", 6}, {"TAGW", 6}, {"TAMA", 6},
+    {"TARC", 6}, {"TARD", 6}, {"TASK", 6}, {"TASY", 6}, {"TATH", 6}, {"TBAR", 6},
+    {"TBEH", 6}, {"TBIT", 6}, {"TBLA", 6}, {"TBOA", 6}, {"TBRI", 6}, {"TCHY", 6},
+    {"TDEC", 6}, {"TDEN", 6}, {"TDIA", 6}, {"TEAU", 6}, {"TEBL", 6}, {"TEEY", 6},
+    {"TEGR", 6}, {"TEIG", 6}, {"TELA", 6}, {"TENP", 6}, {"TETI", 6}, {"TEVA", 6},
+    {"TFEA", 6}, {"TFUL", 6}, {"THAU", 6}, {"THDA", 6}, {"THFE", 6}, {"THLO", 6},
+    {"THOI", 6}, {"TIDO", 6}, {"TIET", 6}, {"TIFO", 6}, {"TIIR", 6}, {"TIMM", 6},
+    {"TINR", 6}, {"TIRR", 6}, {"TITN", 6}, {"TITO", 6}, {"TLIT", 6}, {"TLOS", 6},
+    {"TLYC", 6}, {"TMLP", 6}, {"TOAH", 6}, {"TOAM", 6}, {"TOAW", 6}, {"TOFH", 6},
+    {"TOIL", 6}, {"TOLA", 6}, {"TOLD", 6}, {"TOMS", 6}, {"TONN", 6}, {"TONS", 6},
+    {"TORG", 6}, {"TPOW", 6}, {"TPSF", 6}, {"TQBE", 6}, {"TRAM", 6}, {"TRAV", 6},
+    {"TREI", 6}, {"TRGE", 6}, {"TRLH", 6}, {"TRLK", 6}, {"TRWD", 6}, {"TRYD", 6},
+    {"TRYU", 6}, {"TSAU", 6}, {"TSBL", 6}, {"TSCE", 6}, {"TSCH", 6}, {"TSEQ", 6},
+    {"TSIG", 6}, {"TSQU", 6}, {"TSSC", 6}, {"TSSP", 6}, {"TTOJ", 6}, {"TTRY", 6},
+    {"TTWE", 6}, {"TTWI", 6}, {"TUBE", 6}, {"TUPA", 6}, {"TUPF", 6}, {"TUSU", 6},
+    {"TWOH", 6}, {"TXTG", 6}, {"TYBU", 6}, {"TYGO", 6}, {"UBAR", 6}, {"UBMI", 6},
+    {"UCTM", 6}, {"UCTO", 6}, {"UDEV", 6}, {"UDGE", 6}, {"UEAS", 6}, {"UEBU", 6},
+    {"UEDE", 6}, {"UEEX", 6}, {"UEND", 6}, {"UEPR", 6}, {"UESE", 6}, {"UESI", 6},
+    {"UEVI", 6}, {"UEYO", 6}, {"UFFF", 6}, {"UFIR", 6}, {"UIFY", 6}, {"UIND", 6},
+    {"UINI", 6}, {"UITS", 6}, {"ULBU", 6}, {"ULEG", 6}, {"ULET", 6}, {"ULLR", 6},
+    {"ULSE", 6}, {"ULTC", 6}, {"ULTE", 6}, {"ULTM", 6}, {"ULUP", 6}, {"UMEA", 6},
+    {"UMNE", 6}, {"UMNI", 6}, {"UMSW", 6}, {"UNAC", 6}, {"UNEC", 6}, {"UNOR", 6},
+    {"UNOT", 6}, {"UNSA", 6}, {"UNST", 6}, {"UNTN", 6}, {"UORA", 6}, {"UORT", 6},
+    {"UOTH", 6}, {"UPIF", 6}, {"UPIL", 6}, {"UPSA", 6}, {"UPUB", 6}, {"URAB", 6},
+    {"UREE", 6}, {"URFO", 6}, {"URNC", 6}, {"URNN", 6}, {"USCA", 6}, {"USDE", 6},
+    {"USDO", 6}, {"USPU", 6}, {"USST", 6}, {"UTAM", 6}, {"UTAP", 6}, {"UTFU", 6},
+    {"UTLE", 6}, {"UUMA", 6}, {"VATE", 6}, {"VEAM", 6}, {"VEBA", 6}, {"VECA", 6},
+    {"VEDS", 6}, {"VEHA", 6}, {"VENB", 6}, {"VETA", 6}, {"VEXA", 6}, {"VIVE", 6},
+    {"WAPP", 6}, {"WATR", 6}, {"WAYE", 6}, {"WAYR", 6}, {"WAYU", 6}, {"WBRO", 6},
+    {"WDWI", 6}, {"WEDA", 6}, {"WEDO", 6}, {"WERA", 6}, {"WERV", 6}, {"WESP", 6},
+    {"WHEL", 6}, {"WHOE", 6}, {"WHOR", 6}, {"WIFA", 6}, {"WINC", 6}, {"WINM", 6},
+    {"WNAT", 6}, {"WNET", 6}, {"WOMA", 6}, {"WOME", 6}, {"WONA", 6}, {"WOPL", 6},
+    {"WOTX", 6}, {"WSBU", 6}, {"WSMA", 6}, {"WSVI", 6}, {"WTER", 6}, {"WTOG", 6},
+    {"WTOS", 6}, {"WTWO", 6}, {"WVAL", 6}, {"XCOL", 6}, {"XEDI", 6}, {"XENA", 6},
+    {"XIDE", 6}, {"XTLO", 6}, {"XTOR", 6}, {"XTPR", 6}, {"XTSB", 6}, {"XTSF", 6},
+    {"XTSP", 6}, {"XTSU", 6}, {"XTTI", 6}, {"XYCA", 6}, {"XYSP", 6}, {"XYZA", 6},
+    {"XYZI", 6}, {"XYZS", 6}, {"YALE", 6}, {"YALR", 6}, {"YAMO", 6}, {"YAPA", 6},
+    {"YAPR", 6}, {"YASU", 6}, {"YBEN", 6}, {"YBLU", 6}, {"YBYI", 6}, {"YBYP", 6},
+    {"YDIM", 6}, {"YEDA", 6}, {"YEDT", 6}, {"YEGL", 6}, {"YENC", 6}, {"YERI", 6},
+    {"YESA", 6}, {"YESC", 6}, {"YESP", 6}, {"YETB", 6}, {"YEWH", 6}, {"YEXH", 6},
+    {"YFIX", 6}, {"YFUL", 6}, {"YHOT", 6}, {"YIDE", 6}, {"YINN", 6}, {"YINP", 6},
+    {"YINR", 6}, {"YISD", 6}, {"YISP", 6}, {"YMIS", 6}, {"YNET", 6}, {"YOBT", 6},
+    {"YOFW", 6}, {"YONA", 6}, {"YONI", 6}, {"YONY", 6}, {"YORV", 6}, {"YPAS", 6},
+    {"YPEU", 6}, {"YPEY", 6}, {"YRAT", 6}, {"YSDE", 6}, {"YSEX", 6}, {"YSSE", 6},
+    {"YSSO", 6}, {"YSYO", 6}, {"YTAG", 6}, {"YTRY", 6}, {"YUSR", 6}, {"YVAL", 6},
+    {"YZIN", 6}, {"ZEST", 6}, {"AARI", 5}, {"AARM", 5}, {"AART", 5}, {"ABCL", 5},
+    {"ABCT", 5}, {"ABIG", 5}, {"ABUR", 5}, {"ABWH", 5}, {"ACEG", 5}, {"ACHB", 5},
+    {"ACHN", 5}, {"ACKM", 5}, {"ACLA", 5}, {"ADDW", 5}, {"ADDY", 5}, {"ADEL", 5},
+    {"ADFI", 5}, {"ADFO", 5}, {"ADHE", 5}, {"ADMA", 5}, {"ADMO", 5}, {"ADRE", 5},
+    {"ADTE", 5}, {"ADUP", 5}, {"AEVE", 5}, {"AFLU", 5}, {"AGRO", 5}, {"AGTO", 5},
+    {"AHIS", 5}, {"AHOR", 5}, {"AIDU", 5}, {"AILQ", 5}, {"AIMO", 5}, {"AIRU", 5},
+    {"AIST", 5}, {"AITH", 5}, {"AITW", 5}, {"AJSO", 5}, {"AJUM", 5}, {"AKEL", 5},
+    {"ALAW", 5}, {"ALFB", 5}, {"ALFE", 5}, {"ALFF", 5}, {"ALGR", 5}, {"ALLQ", 5},
+    {"ALNA", 5}, {"ALOA", 5}, {"ALSS", 5}, {"AMMA", 5}, {"AMOT", 5}, {"AMPR", 5},
+    {"AMSU", 5}, {"AMVE", 5}, {"ANGR", 5}, {"ANOL", 5}, {"ANSS", 5}, {"ANSV", 5},
+    {"ANWI", 5}, {"ANWR", 5}, {"ANYU", 5}, {"AORP", 5}, {"APEC", 5}, {"APIC", 5},
+    {"APTU", 5}, {"ARAF", 5}, {"ARDH", 5}, {"ARDU", 5}, {"ARHE", 5}, {"ARHO", 5},
+    {"ARKG", 5}, {"ARNT", 5}, {"ARNY", 5}, {"AROP", 5}, {"ARPO", 5}, {"ARSF", 5},
+    {"ARSS", 5}, {"ARSW", 5}, {"ARWE", 5}, {"ASEH", 5}, {"ASEV", 5}, {"ASHU", 5},
+    {"ASKE", 5}, {"ASKI", 5}, {"ASKS", 5}, {"ASOC", 5}, {"ASOP", 5}, {"ASSL", 5},
+    {"ASUF", 5}, {"ASWR", 5}, {"ASYS", 5}, {"ATAU", 5}, {"ATCE", 5}, {"ATFA", 5},
+    {"ATGO", 5}, {"ATHN", 5}, {"ATHS", 5}, {"ATHU", 5}, {"ATHW", 5}, {"ATOS", 5},
+    {"ATPE", 5}, {"ATVA", 5}, {"AVEV", 5}, {"AWHE", 5}, {"AWPR", 5}, {"AWSU", 5},
+    {"AXCA", 5}, {"AXIN", 5}, {"AXOF", 5}, {"AYAC", 5}, {"AYAF", 5}, {"AYBR", 5},
+    {"AYCR", 5}, {"AYEL", 5}, {"AYSG", 5}, {"BABB", 5}, {"BABO", 5}, {"BALA", 5},
+    {"BBBB", 5}, {"BCLE", 5}, {"BCON", 5}, {"BCUR", 5}, {"BDID", 5}, {"BEAF", 5},
+    {"BEDD", 5}, {"BEDR", 5}, {"BEFE", 5}, {"BEGU", 5}, {"BERU", 5}, {"BESC", 5},
+    {"BGIV", 5}, {"BINR", 5}, {"BLEG", 5}, {"BMIT", 5}, {"BNOW", 5}, {"BOIL", 5},
+    {"BOSE", 5}, {"BOWI", 5}, {"BRAO", 5}, {"BSAS", 5}, {"BUTG", 5}, {"BWHE", 5},
+    {"BYDR", 5}, {"BYFA", 5}, {"BYFO", 5}, {"BYHI", 5}, {"BYNA", 5}, {"BYVE", 5},
+    {"CALU", 5}, {"CAMP", 5}, {"CAPT", 5}, {"CBAN", 5}, {"CBIN", 5}, {"CCAS", 5},
+    {"CCOD", 5}, {"CDEF", 5}, {"CEAM", 5}, {"CEBA", 5}, {"CEDN", 5}, {"CEDP", 5},
+    {"CEDU", 5}, {"CEEV", 5}, {"CEHI", 5}, {"CELA", 5}, {"CELT", 5}, {"CEPE", 5},
+    {"CESG", 5}, {"CESN", 5}, {"CESU", 5}, {"CEUS", 5}, {"CEVE", 5}, {"CFAN", 5},
+    {"CHBI", 5}, {"CHBU", 5}, {"CHGE", 5}, {"CHGI", 5}, {"CHIH", 5}, {"CHIM", 5},
+    {"CHOL", 5}, {"CHOX", 5}, {"CHRA", 5}, {"CHXI", 5}, {"CIDA", 5}, {"CIDF", 5},
+    {"CIDM", 5}, {"CINO", 5}, {"CKAD", 5}, {"CKCL", 5}, {"CKFA", 5}, {"CKIS", 5},
+    {"CKRI", 5}, {"CKSF", 5}, {"CKVI", 5}, {"CLEM", 5}, {"CLYA", 5}, {"CMDE", 5},
+    {"CMDL", 5}, {"CMDS", 5}, {"CMDT", 5}, {"CPAT", 5}, {"CPLU", 5}, {"CPOS", 5},
+    {"CPRE", 5}, {"CROO", 5}, {"CSET", 5}, {"CSTY", 5}, {"CTOT", 5}, {"CTRA", 5},
+    {"CTSC", 5}, {"CTSS", 5}, {"CTVI", 5}, {"CUMB", 5}, {"CYLI", 5}, {"DABI", 5},
+    {"DADV", 5}, {"DALW", 5}, {"DAXI", 5}, {"DAYT", 5}, {"DBEP", 5}, {"DBRO", 5},
+    {"DBUR", 5}, {"DBYG", 5}, {"DCLI", 5}, {"DCOU", 5}, {"DDIG", 5}, {"DDSI", 5},
+    {"DDUR", 5}, {"DEAI", 5}, {"DEDN", 5}, {"DEGA", 5}, {"DEOT", 5}, {"DEWE", 5},
+    {"DFDE", 5}, {"DFIS", 5}, {"DGED", 5}, {"DGME", 5}, {"DGOI", 5}, {"DGRA", 5},
+    {"DIDC", 5}, {"DIDI", 5}, {"DIDL", 5}, {"DIDW", 5}, {"DIFP", 5}, {"DIFS", 5},
+    {"DIFW", 5}, {"DIHA", 5}, {"DINH", 5}, {"DIOH", 5}, {"DIPP", 5}, {"DIRO", 5},
+    {"DISQ", 5}, {"DITN", 5}, {"DITP", 5}, {"DITR", 5}, {"DITU", 5}, {"DKEE", 5},
+    {"DKEL", 5}, {"DLAR", 5}, {"DLAT", 5}, {"DLUM", 5}, {"DLYE", 5}, {"DNET", 5},
+    {"DNTH", 5}, {"DOAL", 5}, {"DOLD", 5}, {"DOMS", 5}, {"DOPA", 5}, {"DORH", 5},
+    {"DORL", 5}, {"DOST", 5}, {"DOWE", 5}, {"DPAL", 5}, {"DPEL", 5}, {"DPOL", 5},
+    {"DREU", 5}, {"DREV", 5}, {"DSAG", 5}, {"DSCH", 5}, {"DSIL", 5}, {"DSKE", 5},
+    {"DSOC", 5}, {"DSOW", 5}, {"DSPL", 5}, {"DTEM", 5}, {"DTHF", 5}, {"DUET", 5},
+    {"DUNM", 5}, {"DUPA", 5}, {"DVIR", 5}, {"DVOL", 5}, {"DWDE", 5}, {"DWHY", 5},
+    {"DYCO", 5}, {"DYWI", 5}, {"EACL", 5}, {"EADJ", 5}, {"EADR", 5}, {"EADW", 5},
+    {"EAFR", 5}, {"EAGI", 5}, {"EAGL", 5}, {"EAHE", 5}, {"EAKU", 5}, {"EAMT", 5},
+    {"EANC", 5}, {"EANL", 5}, {"EATF", 5}, {"EATV", 5}, {"EATY", 5}, {"EBUN", 5},
+    {"ECAP", 5}, {"ECAT", 5}, {"ECAV", 5}, {"ECTD", 5}, {"ECVI", 5}, {"EDAY", 5},
+    {"EDFL", 5}, {"EDGL", 5}, {"EDIP", 5}, {"EDPU", 5}, {"EDSA", 5}, {"EDTR", 5},
+    {"EECT", 5}, {"EEEN", 5}, {"EEGR", 5}, {"EEHE", 5}, {"EEKE", 5}, {"EEKU", 5},
+    {"EEPD", 5}, {"EERI", 5}, {"EESM", 5}, {"EETB", 5}, {"EFEL", 5}, {"EFGA", 5},
+    {"EFIB", 5}, {"EFLI", 5}, {"EFLO", 5}, {"EFLY", 5}, {"EFON", 5}, {"EFTI", 5},
+    {"EFTW", 5}, {"EFUS", 5}, {"EGWH", 5}, {"EHEM", 5}, {"EHLS", 5}, {"EHTH", 5},
+    {"EIFC", 5}, {"EIGA", 5}, {"EILE", 5}, {"EINQ", 5}, {"EIUN", 5}, {"EJOB", 5},
+    {"EJUD", 5}, {"EKEP", 5}, {"ELAB", 5}, {"ELDB", 5}, {"ELDS", 5}, {"ELFB", 5},
+    {"ELLR", 5}, {"ELPU", 5}, {"EMEE", 5}, {"EMEV", 5}, {"EMSP", 5}, {"EMWE", 5},
+    {"EMWO", 5}, {"ENAV", 5}, {"ENDL", 5}, {"ENGR", 5}, {"ENNU", 5}, {"ENTK", 5},
+    {"ENUP", 5}, {"ENUV", 5}, {"ENYY", 5}, {"EOBV", 5}, {"EOCC", 5}, {"EOCO", 5},
+    {"EPHR", 5}, {"EPIP", 5}, {"EPSA", 5}, {"EPST", 5}, {"EQCO", 5}, {"ERAU", 5},
+    {"ERDF", 5}, {"ERHI", 5}, {"ERMM", 5}, {"ERNC", 5}, {"ERNY", 5}, {"EROC", 5},
+    {"EROL", 5}, {"ERPH", 5}, {"ESAH", 5}, {"ESCB", 5}, {"ESCK", 5}, {"ESFL", 5},
+    {"ESFT", 5}, {"ESIH", 5}, {"ESKE", 5}, {"ESOE", 5}, {"ESSV", 5}, {"ESTG", 5},
+    {"ESVO", 5}, {"ETAU", 5}, {"ETCW", 5}, {"ETDE", 5}, {"ETEV", 5}, {"ETEW", 5},
+    {"ETOV", 5}, {"ETSU", 5}, {"EUNC", 5}, {"EUNF", 5}, {"EWAC", 5}, {"EWDA", 5},
+    {"EWEH", 5}, {"EWFO", 5}, {"EWNA", 5}, {"EWNE", 5}, {"EWPO", 5}, {"EWTO", 5},
+    {"EWUS", 5}, {"EXAN", 5}, {"EXCU", 5}, {"EXFO", 5}, {"EXUB", 5}, {"EXWI", 5},
+    {"EYAW", 5}, {"EYEO", 5}, {"EYFO", 5}, {"EYKN", 5}, {"EYSC", 5}, {"EYWH", 5},
+    {"FADA", 5}, {"FAFA", 5}, {"FAIT", 5}, {"FALO", 5}, {"FAPL", 5}, {"FAPO", 5},
+    {"FARO", 5}, {"FASC", 5}, {"FDIF", 5}, {"FDIR", 5}, {"FDOW", 5}, {"FEEL", 5},
+    {"FELA", 5}, {"FERH", 5}, {"FEWO", 5}, {"FEWW", 5}, {"FEXE", 5}, {"FFAN", 5},
+    {"FFFF", 5}, {"FFMO", 5}, {"FFVI", 5}, {"FHAV", 5}, {"FIGO", 5}, {"FISL", 5},
+    {"FLAS", 5}, {"FLED", 5}, {"FLEG", 5}, {"FLES", 5}, {"FMAK", 5}, {"FNIT", 5},
+    {"FNON", 5}, {"FOAN", 5}, {"FOBL", 5}, {"FOOA", 5}, {"FOOF", 5}, {"FOTX", 5},
+    {"FPAP", 5}, {"FQUI", 5}, {"FROT", 5}, {"FSPI", 5}, {"FTIN", 5}, {"FTON", 5},
+    {"FTOO", 5}, {"FTOT", 5}, {"FTTO", 5}, {"FULM", 5}, {"FUND", 5}, {"FVIS", 5},
+    {"FYAL", 5}, {"GAFU", 5}, {"GAGE", 5}, {"GAGL", 5}, {"GALC", 5}, {"GAME", 5},
+    {"GASC", 5}, {"GASE", 5}, {"GASH", 5}, {"GASW", 5}, {"GAVE", 5}, {"GBEA", 5},
+    {"GBEI", 5}, {"GBYA", 5}, {"GCIR", 5}, {"GDOC", 5}, {"GDOE", 5}, {"GDON", 5},
+    {"GEAC", 5}, {"GECA", 5}, {"GEEX", 5}, {"GEFA", 5}, {"GELO", 5}, {"GESP", 5},
+    {"GFAR", 5}, {"GFLA", 5}, {"GGEN", 5}, {"GGIV", 5}, {"GHAR", 5}, {"GHES", 5},
+    {"GHFO", 5}, {"GHLY", 5}, {"GHOU", 5}, {"GICO", 5}, {"GINH", 5}, {"GINQ", 5},
+    {"GISN", 5}, {"GISU", 5}, {"GLEK", 5}, {"GLER", 5}, {"GMAK", 5}, {"GMOV", 5},
+    {"GMUL", 5}, {"GNSI", 5}, {"GOFC", 5}, {"GOFL", 5}, {"GOFR", 5}, {"GOPA", 5},
+    {"GPOR", 5}, {"GQIS", 5}, {"GRUL", 5}, {"GSAB", 5}, {"GSAP", 5}, {"GSCT", 5},
+    {"GSIF", 5}, {"GSIT", 5}, {"GSME", 5}, {"GSMO", 5}, {"GSMU", 5}, {"GSOL", 5},
+    {"GSON", 5}, {"GSOP", 5}, {"GSSE", 5}, {"GSSO", 5}, {"GSSU", 5}, {"GTOL", 5},
+    {"GTOS", 5}, {"GTOU", 5}, {"GUEA", 5}, {"GUIP", 5}, {"GUIU", 5}, {"GUIY", 5},
+    {"GWHO", 5}, {"GYEL", 5}, {"GZIP", 5}, {"HACA", 5}, {"HAGA", 5}, {"HAKE", 5},
+    {"HAME", 5}, {"HANH", 5}, {"HANP", 5}, {"HAPL", 5}, {"HAPO", 5}, {"HCRO", 5},
+    {"HDEN", 5}, {"HDOE", 5}, {"HECC", 5}, {"HEGA", 5}, {"HEGC", 5}, {"HEHT", 5},
+    {"HEHY", 5}, {"HEJU", 5}, {"HEMH", 5}, {"HEMN", 5}, {"HEWD", 5}, {"HGEN", 5},
+    {"HGIV", 5}, {"HGOT", 5}, {"HHIS", 5}, {"HIMS", 5}, {"HIMW", 5}, {"HINO", 5},
+    {"HINV", 5}, {"HION", 5}, {"HITD", 5}, {"HITR", 5}, {"HJKL", 5}, {"HJUS", 5},
+    {"HNON", 5}, {"HNOR", 5}, {"HOFW", 5}, {"HOHL", 5}, {"HOIL", 5}, {"HOMS", 5},
+    {"HORC", 5}, {"HORF", 5}, {"HOTI", 5}, {"HOTS", 5}, {"HOWO", 5}, {"HOWR", 5},
+    {"HOWU", 5}, {"HOXF", 5}, {"HREC", 5}, {"HREL", 5}, {"HSIN", 5}, {"HSTO", 5},
+    {"HTAK", 5}, {"HTCT", 5}, {"HTGO", 5}, {"HTHP", 5}, {"HTHU", 5}, {"HTIP", 5},
+    {"HTOK", 5}, {"HTOO", 5}, {"HTOU", 5}, {"HUGE", 5}, {"HUMO", 5}, {"HUPO", 5},
+    {"HUSB", 5}, {"HUSL", 5}, {"HUSP", 5}, {"HUSS", 5}, {"HWAY", 5}, {"HYEL", 5},
+    {"IATH", 5}, {"IBER", 5}, {"ICAC", 5}, {"ICAR", 5}, {"ICAU", 5}, {"ICCH", 5},
+    {"ICEC", 5}, {"ICKB", 5}, {"ICKV", 5}, {"ICPE", 5}, {"ICPL", 5}, {"ICPR", 5},
+    {"ICTO", 5}, {"IDCA", 5}, {"IDCI", 5}, {"IDEH", 5}, {"IDLO", 5}, {"IDRE", 5},
+    {"IDSO", 5}, {"IDSW", 5}, {"IDUN", 5}, {"IDYO", 5}, {"IEDC", 5}, {"IEIN", 5},
+    {"IERE", 5}, {"IFAD", 5}, {"IFAR", 5}, {"IFET", 5}, {"IFFT", 5}, {"IFFU", 5},
+    {"IFMA", 5}, {"IFPR", 5}, {"IGBU", 5}, {"IGOW", 5}, {"IGWH", 5}, {"IIIP", 5},
+    {"IINA", 5}, {"IIPR", 5}, {"IKEG", 5}, {"IKEV", 5}, {"ILLY", 5}, {"ILME", 5},
+    {"ILQU", 5}, {"ILYP", 5}, {"IMLI", 5}, {"IMMO", 5}, {"IMNA", 5}, {"IMSR", 5},
+    {"IMUL", 5}, {"INBA", 5}, {"INBI", 5}, {"INCM", 5}, {"INGJ", 5}, {"INGZ", 5},
+    {"INPI", 5}, {"INTP", 5}, {"IORL", 5}, {"IORO", 5}, {"IPSE", 5}, {"IPTE", 5},
+    {"IPWH", 5}, {"IRBY", 5}, {"IREF", 5}, {"IRIM", 5}, {"IRMS", 5}, {"IROP", 5},
+    {"IRWO", 5}, {"ISFE", 5}, {"ISFL", 5}, {"ISHG", 5}, {"ISHN", 5}, {"ISIR", 5},
+    {"ISMG", 5}, {"ISMV", 5}, {"ISOL", 5}, {"ISOV", 5}, {"ISSL", 5}, {"ISSM", 5},
+    {"ITAM", 5}, {"ITBO", 5}, {"ITCL", 5}, {"ITEH", 5}, {"ITEU", 5}, {"ITFU", 5},
+    {"ITIM", 5}, {"ITOB", 5}, {"ITOT", 5}, {"ITRO", 5}, {"ITTW", 5}, {"ITUM", 5},
+    {"ITYD", 5}, {"ITYY", 5}, {"IUMO", 5}, {"IUSD", 5}, {"IUST", 5}, {"IVIS", 5},
+    {"IVPR", 5}, {"IVTH", 5}, {"IWIT", 5}, {"IXDT", 5}, {"IXHO", 5}, {"IXIF", 5},
+    {"IXSY", 5}, {"IXVI", 5}, {"IXYO", 5}, {"IZEV", 5}, {"JCOM", 5}, {"JMOV", 5},
+    {"JOBJ", 5}, {"KADD", 5}, {"KBOD", 5}, {"KCAN", 5}, {"KEAD", 5}, {"KEAF", 5},
+    {"KEAT", 5}, {"KEBU", 5}, {"KELF", 5}, {"KEOB", 5}, {"KEON", 5}, {"KEOR", 5},
+    {"KEPA", 5}, {"KERC", 5}, {"KERN", 5}, {"KESL", 5}, {"KEWA", 5}, {"KGRE", 5},
+    {"KINP", 5}, {"KMAN", 5}, {"KOBS", 5}, {"KONA", 5}, {"KONT", 5}, {"KORD", 5},
+    {"KRUN", 5}, {"KSAC", 5}, {"KSAL", 5}, {"KSBY", 5}, {"KSES", 5}, {"KSET", 5},
+    {"KSHA", 5}, {"KSRE", 5}, {"KSWE", 5}, {"KTHR", 5}, {"KTOS", 5}, {"KTOU", 5},
+    {"KWAY", 5}, {"KWIL", 5}, {"LAFU", 5}, {"LALL", 5}, {"LARH", 5}, {"LARN", 5},
+    {"LAWP", 5}, {"LAYD", 5}, {"LBYA", 5}, {"LCHE", 5}, {"LCIR", 5}, {"LCOU", 5},
+    {"LCRE", 5}, {"LDAP", 5}, {"LDFA", 5}, {"LDOI", 5}, {"LDRA", 5}, {"LDSF", 5},
+    {"LDTE", 5}, {"LEEA", 5}, {"LEGL", 5}, {"LEGV", 5}, {"LEMK", 5}, {"LEMT", 5},
+    {"LEOU", 5}, {"LERC", 5}, {"LERG", 5}, {"LERM", 5}, {"LESG", 5}, {"LETV", 5},
+    {"LEUP", 5}, {"LFAD", 5}, {"LFAP", 5}, {"LFIS", 5}, {"LFLO", 5}, {"LFOU", 5},
+    {"LGIV", 5}, {"LGRA", 5}, {"LIDS", 5}, {"LIEI", 5}, {"LIFE", 5}, {"LIMP", 5},
+    {"LINL", 5}, {"LIPS", 5}, {"LIUM", 5}, {"LKIN", 5}, {"LLBL", 5}, {"LLCL", 5},
+    {"LLGI", 5}, {"LLIA", 5}, {"LLSS", 5}, {"LLSY", 5}, {"LMAR", 5}, {"LMAY", 5},
+    {"LMES", 5}, {"LNEV", 5}, {"LOGR", 5}, {"LOND", 5}, {"LORL", 5}, {"LORM", 5},
+    {"LOWP", 5}, {"LPIN", 5}, {"LPMA", 5}, {"LPUS", 5}, {"LPUT", 5}, {"LREQ", 5},
+    {"LRET", 5}, {"LRIS", 5}, {"LRRE", 5}, {"LSAB", 5}, {"LSAS", 5}, {"LSCA", 5},
+    {"LSDO", 5}, {"LSEP", 5}, {"LSEW", 5}, {"LSMA", 5}, {"LSOY", 5}, {"LSPR", 5},
+    {"LSTY", 5}, {"LSUS", 5}, {"LTAG", 5}, {"LTFI", 5}, {"LTIL", 5}, {"LTOB", 5},
+    {"LTOH", 5}, {"LTOM", 5}, {"LTRE", 5}, {"LTSD", 5}, {"LTSF", 5}, {"LTWO", 5},
+    {"LTYO", 5}, {"LUGM", 5}, {"LUMS", 5}, {"LUPY", 5}, {"LVIN", 5}, {"LVIO", 5},
+    {"LWID", 5}, {"LYAB", 5}, {"LYAG", 5}, {"LYFA", 5}, {"LYLA", 5}, {"LYLE", 5},
+    {"LYME", 5}, {"LYMI", 5}, {"LYRA", 5}, {"LYSH", 5}, {"LYWE", 5}, {"MAGA", 5},
+    {"MAHE", 5}, {"MALG", 5}, {"MAPM", 5}, {"MAPO", 5}, {"MAPV", 5}, {"MARC", 5},
+    {"MARV", 5}, {"MATU", 5}, {"MATY", 5}, {"MBES", 5}, {"MBLA", 5}, {"MBLI", 5},
+    {"MBLY", 5}, {"MBOD", 5}, {"MBOO", 5}, {"MBYW", 5}, {"MCHE", 5}, {"MCTR", 5},
+    {"MDEF", 5}, {"MDES", 5}, {"MDFI", 5}, {"MDOI", 5}, {"MEAF", 5}, {"MEBY", 5},
+    {"MEDR", 5}, {"MEDS", 5}, {"MEFL", 5}, {"MEHE", 5}, {"MEKE", 5}, {"MELO", 5},
+    {"MEMI", 5}, {"MESN", 5}, {"MHER", 5}, {"MICO", 5}, {"MINN", 5}, {"MIZE", 5},
+    {"MKEY", 5}, {"MKSE", 5}, {"MLIK", 5}, {"MMOV", 5}, {"MMUT", 5}, {"MOFP", 5},
+    {"MONO", 5}, {"MONW", 5}, {"MOUR", 5}, {"MPEL", 5}, {"MPFI", 5}, {"MPTH", 5},
+    {"MQUI", 5}, {"MRIG", 5}, {"MSBU", 5}, {"MSEA", 5}, {"MSFI", 5}, {"MSIS", 5},
+    {"MSMA", 5}, {"MSOA", 5}, {"MSOT", 5}, {"MSPR", 5}, {"MSUP", 5}, {"MSVI", 5},
+    {"MTOL", 5}, {"MTOP", 5}, {"MTOW", 5}, {"MTRA", 5}, {"MUME", 5}, {"MUMV", 5},
+    {"MUNT", 5}, {"MVAL", 5}, {"MWID", 5}, {"NABS", 5}, {"NACR", 5}, {"NADO", 5},
+    {"NAFE", 5}, {"NALG", 5}, {"NALM", 5}, {"NALR", 5}, {"NANC", 5}, {"NAPE", 5},
+    {"NASM", 5}, {"NATL", 5}, {"NAXI", 5}, {"NBEO", 5}, {"NCGR", 5}, {"NCHW", 5},
+    {"NCUN", 5}, {"NDAA", 5}, {"NDCB", 5}, {"NDCI", 5}, {"NDSR", 5}, {"NDUR", 5},
+    {"NDUT", 5}, {"NEAU", 5}, {"NEDD", 5}, {"NEFE", 5}, {"NEGM", 5}, {"NEHU", 5},
+    {"NEMI", 5}, {"NENF", 5}, {"NESG", 5}, {"NESN", 5}, {"NETC", 5}, {"NETY", 5},
+    {"NFIV", 5}, {"NFOI", 5}, {"NGAA", 5}, {"NGGO", 5}, {"NGSV", 5}, {"NIMM", 5},
+    {"NINN", 5}, {"NINR", 5}, {"NINW", 5}, {"NISL", 5}, {"NIXW", 5}, {"NIXY", 5},
+    {"NLIB", 5}, {"NLOC", 5}, {"NLON", 5}, {"NLOS", 5}, {"NMEC", 5}, {"NMIG", 5},
+    {"NOCA", 5}, {"NODI", 5}, {"NOFG", 5}, {"NOFR", 5}, {"NOIN", 5}, {"NONM", 5},
+    {"NONO", 5}, {"NONU", 5}, {"NOOR", 5}, {"NORU", 5}, {"NOWD", 5}, {"NRAT", 5},
+    {"NSAG", 5}, {"NSAW", 5}, {"NSBO", 5}, {"NSFU", 5}, {"NSOV", 5}, {"NSSP", 5},
+    {"NSVI", 5}, {"NTAF", 5}, {"NTAM", 5}, {"NTBA", 5}, {"NTCU", 5}, {"NTEA", 5},
+    {"NTPU", 5}, {"NTRU", 5}, {"NTSK", 5}, {"NTUR", 5}, {"NTYC", 5}, {"NTYT", 5},
+    {"NUFI", 5}, {"NUOP", 5}, {"NUPP", 5}, {"NUSH", 5}, {"NUVI", 5}, {"NXPR", 5},
+    {"NYBE", 5}, {"NYDA", 5}, {"NYEN", 5}, {"NYGI", 5}, {"NYOP", 5}, {"NYVI", 5},
+    {"NYYO", 5}, {"NZIP", 5}, {"OACT", 5}, {"OADW", 5}, {"OAGI", 5}, {"OALW", 5},
+    {"OAPA", 5}, {"OASB", 5}, {"OASC", 5}, {"OATR", 5}, {"OBGE", 5}, {"OBIN", 5},
+    {"OBJO", 5}, {"OBOD", 5}, {"OBOT", 5}, {"OBSB", 5}, {"OCCA", 5}, {"OCED", 5},
+    {"OCKC", 5}, {"OCKR", 5}, {"OCNO", 5}, {"ODAN", 5}, {"ODER", 5}, {"ODOB", 5},
+    {"ODON", 5}, {"ODRE", 5}, {"ODVI", 5}, {"ODWA", 5}, {"ODWI", 5}, {"OEAS", 5},
+    {"OENA", 5}, {"OESR", 5}, {"OFAH", 5}, {"OFCL", 5}, {"OFIX", 5}, {"OFJU", 5},
+    {"OFMI", 5}, {"OFNI", 5}, {"OFOO", 5}, {"OFRI", 5}, {"OGLO", 5}, {"OHNS", 5},
+    {"OHOT", 5}, {"OIDI", 5}, {"OIFI", 5}, {"OILE", 5}, {"OILS", 5}, {"OISE", 5},
+    {"OJUS", 5}, {"OKIS", 5}, {"OKSO", 5}, {"OKTO", 5}, {"OLDW", 5}, {"OLEC", 5},
+    {"OLOF", 5}, {"OMDI", 5}, {"OMHE", 5}, {"OMHI", 5}, {"OMLE", 5}, {"ONCI", 5},
+    {"ONCT", 5}, {"ONEG", 5}, {"ONEQ", 5}, {"ONFE", 5}, {"ONLO", 5}, {"ONMI", 5},
+    {"ONPL", 5}, {"ONTK", 5}, {"OODD", 5}, {"OODN", 5}, {"OOKV", 5}, {"OOLD", 5},
+    {"OOLT", 5}, {"OOMB", 5}, {"OONI", 5}, {"OONS", 5}, {"OOPS", 5}, {"OORW", 5},
+    {"OOTF", 5}, {"OOVI", 5}, {"OPEA", 5}, {"OPEE", 5}, {"OPTY", 5}, {"OPWH", 5},
+    {"ORCT", 5}, {"ORDD", 5}, {"ORIC", 5}, {"ORKD", 5}, {"ORKG", 5}, {"ORKH", 5},
+    {"ORKV", 5}, {"ORMP", 5}, {"ORRO", 5}, {"ORSB", 5}, {"ORSD", 5}, {"ORYJ", 5},
+    {"ORYR", 5}, {"OSFI", 5}, {"OSPL", 5}, {"OSSL", 5}, {"OSTH", 5}, {"OTAV", 5},
+    {"OTEM", 5}, {"OTFA", 5}, {"OTHB", 5}, {"OTME", 5}, {"OTOI", 5}, {"OTOO", 5},
+    {"OTRU", 5}, {"OTTW", 5}, {"OUAG", 5}, {"OUCU", 5}, {"OUGO", 5}, {"OULU", 5},
+    {"OURY", 5}, {"OUTV", 5}, {"OWAY", 5}, {"OWCA", 5}, {"OWEL", 5}, {"OWEX", 5},
+    {"OWKE", 5}, {"OWOP", 5}, {"OWPA", 5}, {"OWTI", 5}, {"OZER", 5}, {"PABL", 5},
+    {"PARG", 5}, {"PASC", 5}, {"PBET", 5}, {"PDOI", 5}, {"PEAS", 5}, {"PEBE", 5},
+    {"PEDK", 5}, {"PEIT", 5}, {"PENO", 5}, {"PEON", 5}, {"PERU", 5}, {"PESI", 5},
+    {"PESU", 5}, {"PESW", 5}, {"PFIN", 5}, {"PFTP", 5}, {"PGRE", 5}, {"PHAS", 5},
+    {"PLAS", 5}, {"PLEG", 5}, {"PLIF", 5}, {"PLOC", 5}, {"PLYE", 5}, {"PLYO", 5},
+    {"PMOV", 5}, {"POFA", 5}, {"PONL", 5}, {"PONM", 5}, {"POTT", 5}, {"PPDA", 5},
+    {"PPRE", 5}, {"PRIL", 5}, {"PSAR", 5}, {"PSEA", 5}, {"PTAB", 5}, {"PTCA", 5},
+    {"PTIM", 5}, {"PTNO", 5}, {"PTOG", 5}, {"PTOL", 5}, {"PTSF", 5}, {"PTUR", 5},
+    {"PTVI", 5}, {"PTWA", 5}, {"PTYC", 5}, {"PTYP", 5}, {"PTYW", 5}, {"PUPC", 5},
+    {"PUPF", 5}, {"PURE", 5}, {"PWDH", 5}, {"QARG", 5}, {"QRTS", 5}, {"QSOT", 5},
+    {"QUEB", 5}, {"QUEE", 5}, {"QUIE", 5}, {"RABI", 5}, {"RAGI", 5}, {"RAIF", 5},
+    {"RAIT", 5}, {"RALN", 5}, {"RAMH", 5}, {"RAMP", 5}, {"RAOR", 5}, {"RAPE", 5},
+    {"RAQU", 5}, {"RASY", 5}, {"RBEE", 5}, {"RBIN", 5}, {"RBYW", 5}, {"RCIF", 5},
+    {"RCTH", 5}, {"RDAG", 5}, {"RDEP", 5}, {"RDEV", 5}, {"RDME", 5}, {"RDMI", 5},
+    {"RDNO", 5}, {"RDOP", 5}, {"RDSP", 5}, {"RDSV", 5}, {"RDUS", 5}, {"REEG", 5},
+    {"REGL", 5}, {"REIC", 5}, {"REJU", 5}, {"RELT", 5}, {"REMS", 5}, {"RENF", 5},
+    {"RENU", 5}, {"REPC", 5}, {"RETV", 5}, {"RGEE", 5}, {"RGEI", 5}, {"RGOI", 5},
+    {"RGOP", 5}, {"RGRO", 5}, {"RGST", 5}, {"RHAD", 5}, {"RICH", 5}, {"RIFN", 5},
+    {"RIKI", 5}, {"RIMI", 5}, {"RINB", 5}, {"RINK", 5}, {"RINY", 5}, {"RIPL", 5},
+    {"RISF", 5}, {"RITD", 5}, {"RIUS", 5}, {"RKES", 5}, {"RKET", 5}, {"RKFI", 5},
+    {"RKHA", 5}, {"RKIF", 5}, {"RKVI", 5}, {"RLRR", 5}, {"RLYC", 5}, {"RLYD", 5},
+    {"RLYY", 5}, {"RMCA", 5}, {"RMDO", 5}, {"RMDT", 5}, {"RMEE", 5}, {"RMIF", 5},
+    {"RMOM", 5}, {"RMSP", 5}, {"RMSS", 5}, {"RMSU", 5}, {"RMUC", 5}, {"RNDT", 5},
+    {"RNEI", 5}, {"RNEL", 5}, {"RNLI", 5}, {"ROCU", 5}, {"ROFD", 5}, {"ROLW", 5},
+    {"ROOK", 5}, {"RORH", 5}, {"ROWK", 5}, {"ROWV", 5}, {"RRUB", 5}, {"RSAB", 5},
+    {"RSAY", 5}, {"RSFA", 5}, {"RSIG", 5}, {"RSIZ", 5}, {"RSNE", 5}, {"RSOB", 5},
+    {"RSSI", 5}, {"RSVA", 5}, {"RSWO", 5}, {"RSWR", 5}, {"RSYE", 5}, {"RTAP", 5},
+    {"RTAU", 5}, {"RTIA", 5}, {"RTSQ", 5}, {"RTSV", 5}, {"RTSY", 5}, {"RTUS", 5},
+    {"RTYA", 5}, {"RTYC", 5}, {"RTYF", 5}, {"RTYM", 5}, {"RUMM", 5}, {"RUMW", 5},
+    {"RUPA", 5}, {"RUSS", 5}, {"RUST", 5}, {"RVAN", 5}, {"RVIR", 5}, {"RWEW", 5},
+    {"RWRO", 5}, {"RXID", 5}, {"RYAM", 5}, {"RYAT", 5}, {"RYED", 5}, {"RYJU", 5},
+    {"RYLE", 5}, {"RYNU", 5}, {"RYRI", 5}, {"RYSP", 5}, {"RYWE", 5}, {"RYWO", 5},
+    {"SAAN", 5}, {"SACH", 5}, {"SADO", 5}, {"SAEV", 5}, {"SAGL", 5}, {"SAPL", 5},
+    {"SAWI", 5}, {"SBER", 5}, {"SCIE", 5}, {"SCRN", 5}, {"SDIG", 5}, {"SDOA", 5},
+    {"SEAW", 5}, {"SEBI", 5}, {"SEDD", 5}, {"SEDN", 5}, {"SEEG", 5}, {"SEEP", 5},
+    {"SEEU", 5}, {"SEGL", 5}, {"SEIG", 5}, {"SEIM", 5}, {"SEMP", 5}, {"SEMU", 5},
+    {"SENU", 5}, {"SERL", 5}, {"SESV", 5}, {"SEUP", 5}, {"SEXI", 5}, {"SFEE", 5},
+    {"SFEW", 5}, {"SFNE", 5}, {"SFRI", 5}, {"SFYB", 5}, {"SFYS", 5}, {"SFYT", 5},
+    {"SGOI", 5}, {"SHBE", 5}, {"SHDB", 5}, {"SHDT", 5}, {"SHET", 5}, {"SHPU", 5},
+    {"SHUS", 5}, {"SICI", 5}, {"SICS", 5}, {"SIDS", 5}, {"SIFD", 5}, {"SIMU", 5},
+    {"SINH", 5}, {"SINQ", 5}, {"SIPL", 5}, {"SIWO", 5}, {"SKIL", 5}, {"SMAS", 5},
+    {"SMDH", 5}, {"SMDI", 5}, {"SMEL", 5}, {"SMHA", 5}, {"SMHI", 5}, {"SMPL", 5},
+    {"SMRE", 5}, {"SMSE", 5}, {"SMUL", 5}, {"SMUT", 5}, {"SNIC", 5}, {"SNOA", 5},
+    {"SNOC", 5}, {"SNOF", 5}, {"SNOM", 5}, {"SNTT", 5}, {"SNTU", 5}, {"SOCC", 5},
+    {"SOCL", 5}, {"SOCT", 5}, {"SOEX", 5}, {"SONC", 5}, {"SOPL", 5}, {"SORV", 5},
+    {"SOSM", 5}, {"SOUL", 5}, {"SOWI", 5}, {"SPAM", 5}, {"SPOU", 5}, {"SPQR", 5},
+    {"SQUD", 5}, {"SRUL", 5}, {"SSAC", 5}, {"SSAP", 5}, {"SSDB", 5}, {"SSGR", 5},
+    {"SSIX", 5}, {"SSKI", 5}, {"SSST", 5}, {"SSTE", 5}, {"STEB", 5}, {"STEE", 5},
+    {"STGL", 5}, {"STLE", 5}, {"STLO", 5}, {"STPU", 5}, {"STRP", 5}, {"STSF", 5},
+    {"STTR", 5}, {"SUBP", 5}, {"SUNB", 5}, {"SURP", 5}, {"SVIR", 5}, {"SWEI", 5},
+    {"SWPO", 5}, {"SYTH", 5}, {"SZER", 5}, {"TAAN", 5}, {"TABN", 5}, {"TACB", 5},
+    {"TADE", 5}, {"TAFF", 5}, {"TAFU", 5}, {"TAGL", 5}, {"TAMI", 5}, {"TANU", 5},
+    {"TAPO", 5}, {"TARB", 5}, {"TARW", 5}, {"TASB", 5}, {"TASG", 5}, {"TASO", 5},
+    {"TATM", 5}, {"TAUS", 5}, {"TAWA", 5}, {"TAWH", 5}, {"TAXA", 5}, {"TAYS", 5},
+    {"TCHD", 5}, {"TCHP", 5}, {"TCHU", 5}, {"TCRO", 5}, {"TCTA", 5}, {"TCUS", 5},
+    {"TDAT", 5}, {"TDEV", 5}, {"TDIG", 5}, {"TDIO", 5}, {"TDIV", 5}, {"TECI", 5},
+    {"TECR", 5}, {"TEES", 5}, {"TEHO", 5}, {"TELO", 5}, {"TELS", 5}, {"TENH", 5},
+    {"TESM", 5}, {"TEUS", 5}, {"TFIG", 5}, {"TFRU", 5}, {"TGNU", 5}, {"TGOA", 5},
+    {"TGVI", 5}, {"THAI", 5}, {"THBU", 5}, {"THBY", 5}, {"THCU", 5}, {"THGE", 5},
+    {"THHI", 5}, {"THID", 5}, {"THIM", 5}, {"THNE", 5}, {"THSH", 5}, {"THWO", 5},
+    {"TIAN", 5}, {"TIFF", 5}, {"TIIS", 5}, {"TILS", 5}, {"TIRU", 5}, {"TISQ", 5},
+    {"TLEV", 5}, {"TLYL", 5}, {"TMOI", 5}, {"TMPD", 5}, {"TMUL", 5}, {"TMYS", 5},
+    {"TNET", 5}, {"TNOM", 5}, {"TOBY", 5}, {"TOEQ", 5}, {"TOIG", 5}, {"TONB", 5},
+    {"TOND", 5}, {"TONW", 5}, {"TONY", 5}, {"TOOC", 5}, {"TOOW", 5}, {"TOPV", 5},
+    {"TOWE", 5}, {"TPAN", 5}, {"TPLE", 5}, {"TQSH", 5}, {"TRAB", 5}, {"TREN", 5},
+    {"TRLB", 5}, {"TRLZ", 5}, {"TRRI", 5}, {"TRWC", 5}, {"TRWH", 5}, {"TRWP", 5},
+    {"TRYW", 5}, {"TSAG", 5}, {"TSAW", 5}, {"TSIL", 5}, {"TSOG", 5}, {"TSOI", 5},
+    {"TSTY", 5}, {"TUEO", 5}, {"TVIR", 5}, {"TWIS", 5}, {"TWRA", 5}, {"TYAS", 5},
+    {"TYBY", 5}, {"TYEX", 5}, {"TYOB", 5}, {"TYON", 5}, {"TYTI", 5}, {"UACC", 5},
+    {"UBMA", 5}, {"UBME", 5}, {"UBPR", 5}, {"UCEI", 5}, {"UCTA", 5}, {"UCTT", 5},
+    {"UDGM", 5}, {"UEAF", 5}, {"UEDO", 5}, {"UEDT", 5}, {"UEIT", 5}, {"UELE", 5},
+    {"UELO", 5}, {"UENO", 5}, {"UESC", 5}, {"UEWA", 5}, {"UFIL", 5}, {"UGHB", 5},
+    {"UGHL", 5}, {"UGMA", 5}, {"UIDA", 5}, {"UIDM", 5}, {"UIUS", 5}, {"UIVI", 5},
+    {"UIYO", 5}, {"UJUM", 5}, {"UKNL", 5}, {"ULEF", 5}, {"ULLB", 5}, {"ULLF", 5},
+    {"ULLS", 5}, {"ULTB", 5}, {"ULTY", 5}, {"ULVI", 5}, {"UMAR", 5}, {"UMAS", 5},
+    {"UMBU", 5}, {"UMBY", 5}, {"UMED", 5}, {"UMIF", 5}, {"UMOU", 5}, {"UMSB", 5},
+    {"UMVA", 5}, {"UNAB", 5}, {"UNAM", 5}, {"UNAS", 5}, {"UNCU", 5}, {"UNDV", 5},
+    {"UNEN", 5}, {"UNEV", 5}, {"UNSC", 5}, {"UNSU", 5}, {"UNZI", 5}, {"UOFF", 5},
+    {"UORI", 5}, {"UOTA", 5}, {"UPAR", 5}, {"UPAT", 5}, {"UPCO", 5}, {"UPFO", 5},
+    {"UPHA", 5}, {"UPST", 5}, {"UPTI", 5}, {"URAR", 5}, {"URBU", 5}, {"URCA", 5},
+    {"URDB", 5}, {"UREH", 5}, {"UREX", 5}, {"URKE", 5}, {"UROB", 5}, {"URRO", 5},
+    {"URUN", 5}, {"URYS", 5}, {"USAC", 5}, {"USAE", 5}, {"USAG", 5}, {"USBU", 5},
+    {"USCR", 5}, {"USIS", 5}, {"USNE", 5}, {"USPL", 5}, {"USPO", 5}, {"UTBU", 5},
+    {"UTEY", 5}, {"UTIM", 5}, {"UTOA", 5}, {"UTSY", 5}, {"UTTA", 5}, {"UTUP", 5},
+    {"UVIM", 5}, {"VALA", 5}, {"VARC", 5}, {"VARG", 5}, {"VART", 5}, {"VCOL", 5},
+    {"VCOM", 5}, {"VEBY", 5}, {"VEDL", 5}, {"VEDM", 5}, {"VEIF", 5}, {"VELA", 5},
+    {"VELE", 5}, {"VEMB", 5}, {"VERH", 5}, {"VESN", 5}, {"VETR", 5}, {"VETY", 5},
+    {"VEXT", 5}, {"VICO", 5}, {"VITA", 5}, {"VPRO", 5}, {"WACO", 5}, {"WAYM", 5},
+    {"WAYP", 5}, {"WBET", 5}, {"WBYT", 5}, {"WDHO", 5}, {"WDOY", 5}, {"WEAL", 5},
+    {"WEEK", 5}, {"WELF", 5}, {"WERB", 5}, {"WEXA", 5}, {"WHAV", 5}, {"WHOP", 5},
+    {"WINA", 5}, {"WINI", 5}, {"WINN", 5}, {"WINP", 5}, {"WINV", 5}, {"WKEY", 5},
+    {"WLOO", 5}, {"WNAM", 5}, {"WNED", 5}, {"WNEQ", 5}, {"WNMA", 5}, {"WNRE", 5},
+    {"WOEQ", 5}, {"WOLE", 5}, {"WOPO", 5}, {"WOTO", 5}, {"WOWO", 5}, {"WPOP", 5},
+    {"WSAS", 5}, {"WSCR", 5}, {"WSED", 5}, {"WSHA", 5}, {"WSIF", 5}, {"WSIT", 5},
+    {"WSLE", 5}, {"WSOT", 5}, {"WSSP", 5}, {"WSSY", 5}, {"WSUP", 5}, {"WTIT", 5},
+    {"WTOE", 5}, {"WTOV", 5}, {"WWAS", 5}, {"WWOR", 5}, {"WWTH", 5}, {"XCAS", 5},
+    {"XCUS", 5}, {"XINF", 5}, {"XISW", 5}, {"XLET", 5}, {"XNUM", 5}, {"XORA", 5},
+    {"XORC", 5}, {"XSTR", 5}, {"XSYS", 5}, {"XTAR", 5}, {"XTBY", 5}, {"XTCL", 5},
+    {"XTLA", 5}, {"XTPL", 5}, {"XTSH", 5}, {"XTUA", 5}, {"XTUN", 5}, {"XUBE", 5},
+    {"XVII", 5}, {"XWHI", 5}, {"XWIT", 5}, {"YADI", 5}, {"YAGA", 5}, {"YANE", 5},
+    {"YANI", 5}, {"YARO", 5}, {"YASE", 5}, {"YBRE", 5}, {"YCHE", 5}, {"YCIR", 5},
+    {"YCOH", 5}, {"YDAT", 5}, {"YDEC", 5}, {"YDID", 5}, {"YDOC", 5}, {"YEAS", 5},
+    {"YEBE", 5}, {"YEDW", 5}, {"YEFO", 5}, {"YEME", 5}, {"YESE", 5}, {"YEST", 5},
+    {"YETD", 5}, {"YFAR", 5}, {"YGRI", 5}, {"YHAN", 5}, {"YISE", 5}, {"YISS", 5},
+    {"YITB", 5}, {"YJUM", 5}, {"YKEE", 5}, {"YKEY", 5}, {"YMEE", 5}, {"YMPT", 5},
+    {"YNCM", 5}, {"YNEC", 5}, {"YNON", 5}, {"YOFB", 5}, {"YOFD", 5}, {"YOFP", 5},
+    {"YORP", 5}, {"YPEX", 5}, {"YPTE", 5}, {"YRAN", 5}, {"YRIN", 5}, {"YSAB", 5},
+    {"YSAP", 5}, {"YSDO", 5}, {"YSEM", 5}, {"YSFE", 5}, {"YSIG", 5}, {"YSKI", 5},
+    {"YSOA", 5}, {"YSYS", 5}, {"YTEN", 5}, {"YTOY", 5}, {"YTRU", 5}, {"YWRI", 5},
+    {"ZEDB", 5}, {"ZEDL", 5}, {"ZESE", 5}, {"ZIPT", 5}, {"ZTHE", 5}, {"AABB", 4},
+    {"AABO", 4}, {"AADD", 4}, {"AALS", 4}, {"AANY", 4}, {"AARB", 4}, {"AARS", 4},
+    {"ABMA", 4}, {"ABNO", 4}, {"ABVI", 4}, {"ACEK", 4}, {"ACEU", 4}, {"ACKD", 4},
+    {"ACKY", 4}, {"ACOC", 4}, {"ACTC", 4}, {"ACTN", 4}, {"ACTR", 4}, {"ACUT", 4},
+    {"ACWH", 4}, {"ADAF", 4}, {"ADDL", 4}, {"ADEV", 4}, {"ADFR", 4}, {"ADLY", 4},
+    {"ADRO", 4}, {"ADSC", 4}, {"ADSE", 4}, {"ADSU", 4}, {"ADUR", 4}, {"ADWH", 4},
+    {"ADYA", 4}, {"ADYF", 4}, {"ADYO", 4}, {"ADYP", 4}, {"ADYR", 4}, {"ADYU", 4},
+    {"AFAC", 4}, {"AFEA", 4}, {"AFIN", 4}, {"AFUR", 4}, {"AGTA", 4}, {"AGUI", 4},
+    {"AGWI", 4}, {"AHEX", 4}, {"AIDA", 4}, {"AILL", 4}, {"AIMA", 4}, {"AIMP", 4},
+    {"AIRP", 4}, {"AISA", 4}, {"AKEH", 4}, {"AKFO", 4}, {"AKNE", 4}, {"ALAB", 4},
+    {"ALCR", 4}, {"ALCU", 4}, {"ALEB", 4}, {"ALEF", 4}, {"ALEW", 4}, {"ALGO", 4},
+    {"ALLK", 4}, {"ALRU", 4}, {"ALSM", 4}, {"ALSW", 4}, {"ALTB", 4}, {"ALTM", 4},
+    {"ALTP", 4}, {"ALUC", 4}, {"ALWE", 4}, {"AMAK", 4}, {"AMEJ", 4}, {"AMIG", 4},
+    {"AMOV", 4}, {"AMPA", 4}, {"AMSG", 4}, {"ANCL", 4}, {"ANCR", 4}, {"ANFR", 4},
+    {"ANHE", 4}, {"ANIR", 4}, {"ANKC", 4}, {"ANKE", 4}, {"ANMS", 4}, {"ANSU", 4},
+    {"ANTM", 4}, {"ANXT", 4}, {"AOFC", 4}, {"AOFN", 4}, {"APCA", 4}, {"APCH", 4},
+    {"APEE", 4}, {"APHE", 4}, {"APIT", 4}, {"APMO", 4}, {"APOF", 4}, {"APOL", 4},
+    {"APSB", 4}, {"APSN", 4}, {"APSW", 4}, {"APSY", 4}, {"ARCP", 4}, {"ARDR", 4},
+    {"AREQ", 4}, {"ARGL", 4}, {"ARNU", 4}, {"ARPA", 4}, {"ARPR", 4}, {"ARSM", 4},
+    {"ARTD", 4}, {"ARTG", 4}, {"ARUP", 4}, {"ARWR", 4}, {"ASAG", 4}, {"ASAV", 4},
+    {"ASHW", 4}, {"ASIA", 4}, {"ASKF", 4}, {"ASNA", 4}, {"ASNT", 4}, {"ASOV", 4},
+    {"ASRT", 4}, {"ASUN", 4}, {"ATAA", 4}, {"ATAM", 4}, {"ATBI", 4}, {"ATFR", 4},
+    {"ATHB", 4}, {"ATHC", 4}, {"ATHP", 4}, {"ATID", 4}, {"ATKE", 4}, {"ATNA", 4},
+    {"ATOC", 4}, {"ATOI", 4}, {"ATOM", 4}, {"ATPI", 4}, {"ATSF", 4}, {"ATSG", 4},
+    {"ATSM", 4}, {"ATXV", 4}, {"AUTI", 4}, {"AVIS", 4}, {"AWAL", 4}, {"AWNB", 4},
+    {"AWNU", 4}, {"AWSA", 4}, {"AXAN", 4}, {"AXEL", 4}, {"AXID", 4}, {"AXLI", 4},
+    {"AXME", 4}, {"AXRW", 4}, {"AXVI", 4}, {"AYAW", 4}, {"AYCA", 4}, {"AYEC", 4},
+    {"AYME", 4}, {"AYOT", 4}, {"AYPO", 4}, {"AYTE", 4}, {"BABA", 4}, {"BADL", 4},
+    {"BALM", 4}, {"BALO", 4}, {"BANK", 4}, {"BANY", 4}, {"BARC", 4}, {"BARY", 4},
+    {"BBCC", 4}, {"BBIN", 4}, {"BCDE", 4}, {"BCMA", 4}, {"BCOM", 4}, {"BCTH", 4},
+    {"BDOE", 4}, {"BEBI", 4}, {"BEBO", 4}, {"BEBY", 4}, {"BECR", 4}, {"BEDW", 4},
+    {"BEES", 4}, {"BEEV", 4}, {"BEFR", 4}, {"BEGE", 4}, {"BELL", 4}, {"BENI", 4},
+    {"BERX", 4}, {"BESW", 4}, {"BETC", 4}, {"BEVA", 4}, {"BFTP", 4}, {"BHCJ", 4},
+    {"BIDC", 4}, {"BIEP", 4}, {"BIGA", 4}, {"BIGT", 4}, {"BITD", 4}, {"BLAD", 4},
+    {"BLYD", 4}, {"BLYO", 4}, {"BLYU", 4}, {"BLYW", 4}, {"BMAI", 4}, {"BMOV", 4},
+    {"BPRO", 4}, {"BRAS", 4}, {"BRET", 4}, {"BSBY", 4}, {"BSCO", 4}, {"BSIF", 4},
+    {"BSKE", 4}, {"BSTR", 4}, {"BTHA", 4}, {"BTUS", 4}, {"BULK", 4}, {"BUNI", 4},
+    {"BUSE", 4}, {"BYAF", 4}, {"BYAV", 4}, {"BYAW", 4}, {"BYHA", 4}, {"BYJA", 4},
+    {"BYMY", 4}, {"BYOB", 4}, {"BYRA", 4}, {"BYRU", 4}, {"BYSY", 4}, {"BYTA", 4},
+    {"BYTO", 4}, {"BYWI", 4}, {"BYWO", 4}, {"CABI", 4}, {"CALN", 4}, {"CARL", 4},
+    {"CASL", 4}, {"CAUT", 4}, {"CAVO", 4}, {"CBYS", 4}, {"CCBY", 4}, {"CCOP", 4},
+    {"CCUP", 4}, {"CDET", 4}, {"CDVI", 4}, {"CEAX", 4}, {"CEIG", 4}, {"CEMT", 4},
+    {"CEQU", 4}, {"CESJ", 4}, {"CESR", 4}, {"CGRO", 4}, {"CHCI", 4}, {"CHEA", 4},
+    {"CHFL", 4}, {"CHID", 4}, {"CHIP", 4}, {"CHOE", 4}, {"CHOY", 4}, {"CHPE", 4},
+    {"CHPO", 4}, {"CHQU", 4}, {"CHSI", 4}, {"CHSM", 4}, {"CHTA", 4}, {"CHUP", 4},
+    {"CIDV", 4}, {"CIFT", 4}, {"CIOF", 4}, {"CISO", 4}, {"CISS", 4}, {"CKAT", 4},
+    {"CKCH", 4}, {"CKCI", 4}, {"CKEY", 4}, {"CKMA", 4}, {"CMCH", 4}, {"CMDA", 4},
+    {"CMDP", 4}, {"CNAS", 4}, {"CNEX", 4}, {"CNOT", 4}, {"COAT", 4}, {"COCK", 4},
+    {"CONG", 4}, {"CONJ", 4}, {"CPPS", 4}, {"CRAC", 4}, {"CREM", 4}, {"CRIM", 4},
+    {"CRNL", 4}, {"CRNO", 4}, {"CSCO", 4}, {"CSFO", 4}, {"CSHO", 4}, {"CSWP", 4},
+    {"CTAB", 4}, {"CTAF", 4}, {"CTAU", 4}, {"CTBO", 4}, {"CTDO", 4}, {"CTES", 4},
+    {"CTEX", 4}, {"CTNO", 4}, {"CTOA", 4}, {"CTOG", 4}, {"CTOO", 4}, {"CTSL", 4},
+    {"CTSM", 4}, {"CTSW", 4}, {"CTUO", 4}, {"CUMA", 4}, {"CUOA", 4}, {"CUOT", 4},
+    {"CVER", 4}, {"CWAY", 4}, {"CWIT", 4}, {"CYAN", 4}, {"CYOF", 4}, {"DABA", 4},
+    {"DABB", 4}, {"DAFO", 4}, {"DAGL", 4}, {"DALE", 4}, {"DAMI", 4}, {"DAPL", 4},
+    {"DAPT", 4}, {"DARA", 4}, {"DARO", 4}, {"DASK", 4}, {"DASO", 4}, {"DATG", 4},
+    {"DATN", 4}, {"DATR", 4}, {"DBDE", 4}, {"DBPE", 4}, {"DBYH", 4}, {"DCEA", 4},
+    {"DCLA", 4}, {"DCUR", 4}, {"DCWO", 4}, {"DDCO", 4}, {"DDFI", 4}, {"DDFR", 4},
+    {"DDIC", 4}, {"DDOU", 4}, {"DDSO", 4}, {"DDWD", 4}, {"DEAG", 4}, {"DEDH", 4},
+    {"DEDV", 4}, {"DEEV", 4}, {"DEEX", 4}, {"DEFF", 4}, {"DEFM", 4}, {"DEFT", 4},
+    {"DELT", 4}, {"DENI", 4}, {"DESF", 4}, {"DESH", 4}, {"DETR", 4}, {"DFAN", 4},
+    {"DFEE", 4}, {"DFUR", 4}, {"DGEN", 4}, {"DGLO", 4}, {"DGOO", 4}, {"DHET", 4},
+    {"DHIT", 4}, {"DHOR", 4}, {"DIDY", 4}, {"DIED", 4}, {"DIFB", 4}, {"DIFC", 4},
+    {"DIFH", 4}, {"DIFL", 4}, {"DINU", 4}, {"DIRR", 4}, {"DISL", 4}, {"DISV", 4},
+    {"DITG", 4}, {"DKNO", 4}, {"DLER", 4}, {"DLIT", 4}, {"DLYR", 4}, {"DMAC", 4},
+    {"DMEA", 4}, {"DMES", 4}, {"DMIG", 4}, {"DMIS", 4}, {"DNOB", 4}, {"DNOO", 4},
+    {"DOBO", 4}, {"DOEX", 4}, {"DOFU", 4}, {"DOOT", 4}, {"DORB", 4}, {"DORY", 4},
+    {"DOSE", 4}, {"DOSY", 4}, {"DPAC", 4}, {"DRAG", 4}, {"DRAT", 4}, {"DROU", 4},
+    {"DSAB", 4}, {"DSAF", 4}, {"DSEM", 4}, {"DSEQ", 4}, {"DSGE", 4}, {"DSLE", 4},
+    {"DSNE", 4}, {"DSOD", 4}, {"DSOH", 4}, {"DSOP", 4}, {"DSUL", 4}, {"DSWA", 4},
+    {"DSWO", 4}, {"DTHN", 4}, {"DTOY", 4}, {"DTRI", 4}, {"DTTH", 4}, {"DULU", 4},
+    {"DUPT", 4}, {"DUST", 4}, {"DUTI", 4}, {"DVEG", 4}, {"DWTH", 4}, {"DYAC", 4},
+    {"DYCA", 4}, {"DYIT", 4}, {"DYNE", 4}, {"DYUS", 4}, {"EADH", 4}, {"EAFL", 4},
+    {"EAGE", 4}, {"EAKC", 4}, {"EAKF", 4}, {"EAKR", 4}, {"EALF", 4}, {"EAMR", 4},
+    {"EANW", 4}, {"EANX", 4}, {"EAPI", 4}, {"EARH", 4}, {"EARM", 4}, {"EARV", 4},
+    {"EASD", 4}, {"EATQ", 4}, {"EAXR", 4}, {"EAYO", 4}, {"EBAN", 4}, {"EBGI", 4},
+    {"EBOU", 4}, {"EBSI", 4}, {"EBSK", 4}, {"EBUS", 4}, {"EBYV", 4}, {"ECKY", 4},
+    {"ECMA", 4}, {"ECMD", 4}, {"ECOI", 4}, {"EDEI", 4}, {"EDGN", 4}, {"EDMI", 4},
+    {"EDQU", 4}, {"EDSF", 4}, {"EDTU", 4}, {"EEAD", 4}, {"EEAT", 4}, {"EEAU", 4},
+    {"EECA", 4}, {"EECL", 4}, {"EEDU", 4}, {"EEKC", 4}, {"EEKS", 4}, {"EENQ", 4},
+    {"EEOT", 4}, {"EEPB", 4}, {"EEPC", 4}, {"EEPO", 4}, {"EEPV", 4}, {"EESP", 4},
+    {"EETC", 4}, {"EEVA", 4}, {"EEWA", 4}, {"EEWR", 4}, {"EEXM", 4}, {"EFAD", 4},
+    {"EFEW", 4}, {"EFIC", 4}, {"EFMI", 4}, {"EFSH", 4}, {"EFST", 4}, {"EFTV", 4},
+    {"EGAP", 4}, {"EGOE", 4}, {"EGON", 4}, {"EHEN", 4}, {"EHJK", 4}, {"EHMA", 4},
+    {"EIDO", 4}, {"EIDX", 4}, {"EIFV", 4}, {"EIIN", 4}, {"EIPR", 4}, {"EJAN", 4},
+    {"EJCO", 4}, {"EJUM", 4}, {"EKAG", 4}, {"EKCH", 4}, {"ELAP", 4}, {"ELDO", 4},
+    {"ELDP", 4}, {"ELED", 4}, {"ELIF", 4}, {"ELIV", 4}, {"ELLN", 4}, {"ELOR", 4},
+    {"ELPD", 4}, {"ELPR", 4}, {"ELPV", 4}, {"ELSA", 4}, {"ELYV", 4}, {"ELYX", 4},
+    {"EMDT", 4}, {"EMEF", 4}, {"EMEX", 4}, {"EMFI", 4}, {"EMHA", 4}, {"EMLE", 4},
+    {"EMOF", 4}, {"EMOZ", 4}, {"EMPF", 4}, {"EMSR", 4}, {"EMTT", 4}, {"ENBR", 4},
+    {"ENDK", 4}, {"ENIH", 4}, {"ENIU", 4}, {"ENIW", 4}, {"ENMU", 4}, {"ENND", 4},
+    {"ENOI", 4}, {"ENPE", 4}, {"ENPL", 4}, {"ENRA", 4}, {"ENRO", 4}, {"ENRU", 4},
+    {"ENSD", 4}, {"ENUL", 4}, {"EOFK", 4}, {"EOME", 4}, {"EONY", 4}, {"EPLI", 4},
+    {"EPOF", 4}, {"EPPR", 4}, {"EPSC", 4}, {"EPSE", 4}, {"EPTM", 4}, {"EPVI", 4},
+    {"EQRE", 4}, {"ERDP", 4}, {"ERGV", 4}, {"ERIH", 4}, {"ERIR", 4}, {"ERJU", 4},
+    {"ERLP", 4}, {"ERMD", 4}, {"ERMR", 4}, {"ERMW", 4}, {"ERNL", 4}, {"EROA", 4},
+    {"ERQU", 4}, {"ERSG", 4}, {"ERUB", 4}, {"ERXI", 4}, {"ESCF", 4}, {"ESCS", 4},
+    {"ESFE", 4}, {"ESGL", 4}, {"ESIA", 4}, {"ESOS", 4}, {"ESPT", 4}, {"ESRU", 4},
+    {"ESTQ", 4}, {"ESYE", 4}, {"ETCP", 4}, {"ETCR", 4}, {"ETIG", 4}, {"ETLE", 4},
+    {"ETMP", 4}, {"ETNU", 4}, {"ETSD", 4}, {"ETSL", 4}, {"ETTT", 4}, {"EUCO", 4},
+    {"EUDO", 4}, {"EULT", 4}, {"EUNS", 4}, {"EUPW", 4}, {"EUTM", 4}, {"EVAI", 4},
+    {"EVCO", 4}, {"EVDE", 4}, {"EVOI", 4}, {"EWEB", 4}, {"EWES", 4}, {"EWGE", 4},
+    {"EWSE", 4}, {"EWSY", 4}, {"EWWH", 4}, {"EXEN", 4}, {"EXTX", 4}, {"EYAG", 4},
+    {"EYDE", 4}, {"EYEM", 4}, {"EYFL", 4}, {"EYGO", 4}, {"EYGR", 4}, {"EYMI", 4},
+    {"EYMO", 4}, {"EYOP", 4}, {"EYSS", 4}, {"EYSW", 4}, {"EYSY", 4}, {"EZIP", 4},
+    {"FABC", 4}, {"FABR", 4}, {"FANH", 4}, {"FAQU", 4}, {"FARI", 4}, {"FASI", 4},
+    {"FASU", 4}, {"FATR", 4}, {"FAVI", 4}, {"FBUF", 4}, {"FBYE", 4}, {"FCAL", 4},
+    {"FCLE", 4}, {"FDEN", 4}, {"FDER", 4}, {"FDIC", 4}, {"FDIV", 4}, {"FEDI", 4},
+    {"FEED", 4}, {"FENC", 4}, {"FEWA", 4}, {"FEWP", 4}, {"FEWS", 4}, {"FFAG", 4},
+    {"FFGG", 4}, {"FFIS", 4}, {"FFMC", 4}, {"FFOO", 4}, {"FFRM", 4}, {"FFTO", 4},
+    {"FFUS", 4}, {"FGLO", 4}, {"FGOO", 4}, {"FHAN", 4}, {"FHEL", 4}, {"FHET", 4},
+    {"FICM", 4}, {"FICO", 4}, {"FIGH", 4}, {"FIGL", 4}, {"FIRO", 4}, {"FISH", 4},
+    {"FITU", 4}, {"FIXA", 4}, {"FMAD", 4}, {"FMCH", 4}, {"FMET", 4}, {"FMIN", 4},
+    {"FMOS", 4}, {"FNEX", 4}, {"FNOW", 4}, {"FOPA", 4}, {"FOPE", 4}, {"FOSE", 4},
+    {"FPHI", 4}, {"FPLA", 4}, {"FRMU", 4}, {"FROA", 4}, {"FRUB", 4}, {"FSIG", 4},
+    {"FSOL", 4}, {"FTAG", 4}, {"FTAM", 4}, {"FTEC", 4}, {"FTIT", 4}, {"FTKE", 4},
+    {"FTOD", 4}, {"FTOR", 4}, {"FTOS", 4}, {"FTRI", 4}, {"FTVI", 4}, {"FTWH", 4},
+    {"FTYC", 4}, {"FULD", 4}, {"FULU", 4}, {"FUZZ", 4}, {"FVAP", 4}, {"FVIC", 4},
+    {"FWEC", 4}, {"FYES", 4}, {"FYWH", 4}, {"GAAC", 4}, {"GABB", 4}, {"GAHE", 4},
+    {"GALS", 4}, {"GALT", 4}, {"GAPH", 4}, {"GARA", 4}, {"GARC", 4}, {"GARG", 4},
+    {"GARL", 4}, {"GASA", 4}, {"GASB", 4}, {"GASU", 4}, {"GATL", 4}, {"GAVA", 4},
+    {"GBEC", 4}, {"GBLO", 4}, {"GBOT", 4}, {"GBYS", 4}, {"GCOA", 4}, {"GDEL", 4},
+    {"GDIG", 4}, {"GDOW", 4}, {"GEAG", 4}, {"GEAR", 4}, {"GEAW", 4}, {"GEDP", 4},
+    {"GEEA", 4}, {"GEFI", 4}, {"GEFU", 4}, {"GEGE", 4}, {"GEGR", 4}, {"GEHA", 4},
+    {"GELA", 4}, {"GELE", 4}, {"GEMI", 4}, {"GEMO", 4}, {"GENI", 4}, {"GEOP", 4},
+    {"GEOV", 4}, {"GERY", 4}, {"GESD", 4}, {"GESN", 4}, {"GETD", 4}, {"GETU", 4},
+    {"GEWO", 4}, {"GFUL", 4}, {"GGGT", 4}, {"GHAT", 4}, {"GHIF", 4}, {"GHNO", 4},
+    {"GHNU", 4}, {"GHOF", 4}, {"GHOL", 4}, {"GHON", 4}, {"GHSE", 4}, {"GINR", 4},
+    {"GISD", 4}, {"GISI", 4}, {"GITF", 4}, {"GITH", 4}, {"GITP", 4}, {"GITU", 4},
+    {"GJAV", 4}, {"GLEN", 4}, {"GLEU", 4}, {"GLOW", 4}, {"GLYC", 4}, {"GLYI", 4},
+    {"GLYM", 4}, {"GNEG", 4}, {"GNSS", 4}, {"GOCC", 4}, {"GODO", 4}, {"GONW", 4},
+    {"GORL", 4}, {"GORM", 4}, {"GORO", 4}, {"GOTT", 4}, {"GOVI", 4}, {"GPAS", 4},
+    {"GPEE", 4}, {"GPLC", 4}, {"GPLF", 4}, {"GPLR", 4}, {"GPOI", 4}, {"GRCO", 4},
+    {"GREM", 4}, {"GRIT", 4}, {"GSAA", 4}, {"GSAT", 4}, {"GSBY", 4}, {"GSDO", 4},
+    {"GSES", 4}, {"GSHE", 4}, {"GSRE", 4}, {"GSSA", 4}, {"GTHU", 4}, {"GTOB", 4},
+    {"GUIA", 4}, {"GUIC", 4}, {"GUIN", 4}, {"GUPT", 4}, {"GUPW", 4}, {"GUTF", 4},
+    {"GVAL", 4}, {"GWER", 4}, {"GYBE", 4}, {"HAAZ", 4}, {"HABL", 4}, {"HABS", 4},
+    {"HACK", 4}, {"HADE", 4}, {"HAFI", 4}, {"HAFU", 4}, {"HALE", 4}, {"HALM", 4},
+    {"HANM", 4}, {"HANQ", 4}, {"HAQU", 4}, {"HARM", 4}, {"HASL", 4}, {"HAUS", 4},
+    {"HAWR", 4}, {"HBAC", 4}, {"HBEC", 4}, {"HBEE", 4}, {"HBOU", 4}, {"HBYA", 4},
+    {"HBYI", 4}, {"HCAM", 4}, {"HCLA", 4}, {"HCLO", 4}, {"HCUR", 4}, {"HDEF", 4},
+    {"HDEL", 4}, {"HDIG", 4}, {"HDIL", 4}, {"HDTH", 4}, {"HEDC", 4}, {"HEDD", 4},
+    {"HEFT", 4}, {"HEGQ", 4}, {"HEHL", 4}, {"HEHU", 4}, {"HEIA", 4}, {"HEJC", 4},
+    {"HEMG", 4}, {"HEOD", 4}, {"HEQC", 4}, {"HEQR", 4}, {"HEUA", 4}, {"HEUC", 4},
+    {"HEUL", 4}, {"HEUR", 4}, {"HEUT", 4}, {"HEXD", 4}, {"HEXE", 4}, {"HEXF", 4},
+    {"HEXT", 4}, {"HEXW", 4}, {"HEXX", 4}, {"HEYI", 4}, {"HFOU", 4}, {"HFUT", 4},
+    {"HICO", 4}, {"HIEF", 4}, {"HIFI", 4}, {"HIPC", 4}, {"HIRE", 4}, {"HISJ", 4},
+    {"HISQ", 4}, {"HITC", 4}, {"HITM", 4}, {"HITN", 4}, {"HITU", 4}, {"HLIB", 4},
+    {"HLOC", 4}, {"HMAI", 4}, {"HMIL", 4}, {"HMOV", 4}, {"HNIC", 4}, {"HOAE", 4},
+    {"HOAL", 4}, {"HOFH", 4}, {"HOMY", 4}, {"HOOT", 4}, {"HORG", 4}, {"HOTB", 4},
+    {"HOTW", 4}, {"HOYO", 4}, {"HPAN", 4}, {"HPER", 4}, {"HRAR", 4}, {"HREP", 4},
+    {"HRIT", 4}, {"HSFO", 4}, {"HSPE", 4}, {"HSTH", 4}, {"HTCH", 4}, {"HTCL", 4},
+    {"HTEL", 4}, {"HTFI", 4}, {"HTFR", 4}, {"HTMU", 4}, {"HTOC", 4}, {"HTOE", 4},
+    {"HTOS", 4}, {"HTSD", 4}, {"HTVA", 4}, {"HTYP", 4}, {"HURW", 4}, {"HUTI", 4},
+    {"HWEN", 4}, {"HXIF", 4}, {"HYAN", 4}, {"HYIN", 4}, {"IALG", 4}, {"IALU", 4},
+    {"IAUT", 4}, {"IBFT", 4}, {"ICAS", 4}, {"ICDI", 4}, {"ICKG", 4}, {"ICKR", 4},
+    {"ICKY", 4}, {"ICMA", 4}, {"ICME", 4}, {"ICOV", 4}, {"ICSO", 4}, {"ICUM", 4},
+    {"ICWA", 4}, {"IDAL", 4}, {"IDFT", 4}, {"IDGL", 4}, {"IDHE", 4}, {"IDKE", 4},
+    {"IDLI", 4}, {"IDSU", 4}, {"IDTY", 4}, {"IEDR", 4}, {"IEDY", 4}, {"IEWN", 4},
+    {"IFAC", 4}, {"IFAM", 4}, {"IFAU", 4}, {"IFBL", 4}, {"IFEI", 4}, {"IFEW", 4},
+    {"IFFF", 4}, {"IFFP", 4}, {"IFFR", 4}, {"IFFW", 4}, {"IFNU", 4}, {"IFSE", 4},
+    {"IFUS", 4}, {"IFYD", 4}, {"IGCA", 4}, {"IGHB", 4}, {"IGLE", 4}, {"IGND", 4},
+    {"IGOO", 4}, {"IGOV", 4}, {"IGSE", 4}, {"IIII", 4}, {"IIIN", 4}, {"IINS", 4},
+    {"IIRE", 4}, {"IIRR", 4}, {"IIWI", 4}, {"IKEH", 4}, {"IKEQ", 4}, {"ILDE", 4},
+    {"ILIG", 4}, {"ILLV", 4}, {"ILMO", 4}, {"ILSO", 4}, {"ILTY", 4}, {"ILYD", 4},
+    {"ILYI", 4}, {"IMEE", 4}, {"IMEU", 4}, {"IMOV", 4}, {"IMSF", 4}, {"IMSL", 4},
+    {"INAQ", 4}, {"INCW", 4}, {"INKA", 4}, {"INKN", 4}, {"INND", 4}, {"INNR", 4},
+    {"INOL", 4}, {"INSD", 4}, {"INTG", 4}, {"INWO", 4}, {"IOLI", 4}, {"IOMS", 4},
+    {"IOOF", 4}, {"IORS", 4}, {"IPAR", 4}, {"IPCO", 4}, {"IPEA", 4}, {"IPPR", 4},
+    {"IPTB", 4}, {"IRBI", 4}, {"IRCI", 4}, {"IRDT", 4}, {"IREO", 4}, {"IRMT", 4},
+    {"IROF", 4}, {"IRPL", 4}, {"IRRO", 4}, {"IRRT", 4}, {"IRSQ", 4}, {"IRUN", 4},
+    {"ISAX", 4}, {"ISBI", 4}, {"ISBR", 4}, {"ISEU", 4}, {"ISHV", 4}, {"ISID", 4},
+    {"ISIG", 4}, {"ISIL", 4}, {"ISMC", 4}, {"ISNU", 4}, {"ISPI", 4}, {"ISSW", 4},
+    {"ITEG", 4}, {"ITHQ", 4}, {"ITLA", 4}, {"ITPL", 4}, {"ITPU", 4}, {"ITRU", 4},
+    {"ITYH", 4}, {"ITYN", 4}, {"ITYU", 4}, {"IUMD", 4}, {"IUSB", 4}, {"IVAN", 4},
+    {"IVIL", 4}, {"IWEN", 4}, {"IXCH", 4}, {"IXTI", 4}, {"IXTY", 4}, {"JAME", 4},
+    {"JOBA", 4}, {"JOBT", 4}, {"JUPI", 4}, {"KABL", 4}, {"KALS", 4}, {"KATA", 4},
+    {"KAUT", 4}, {"KAWO", 4}, {"KBAC", 4}, {"KBEC", 4}, {"KDIS", 4}, {"KEBE", 4},
+    {"KEBY", 4}, {"KEDS", 4}, {"KEHA", 4}, {"KELO", 4}, {"KENF", 4}, {"KENL", 4},
+    {"KEOF", 4}, {"KERO", 4}, {"KERW", 4}, {"KETC", 4}, {"KEYF", 4}, {"KEYV", 4},
+    {"KEYY", 4}, {"KFAN", 4}, {"KGET", 4}, {"KHER", 4}, {"KIPE", 4}, {"KIPP", 4},
+    {"KIPW", 4}, {"KISC", 4}, {"KISM", 4}, {"KISS", 4}, {"KIST", 4}, {"KLMN", 4},
+    {"KLYM", 4}, {"KLYR", 4}, {"KOFL", 4}, {"KONM", 4}, {"KONW", 4}, {"KORO", 4},
+    {"KOTH", 4}, {"KPAT", 4}, {"KPRE", 4}, {"KRED", 4}, {"KSBE", 4}, {"KSBU", 4},
+    {"KSEE", 4}, {"KSFI", 4}, {"KSMO", 4}, {"KSSO", 4}, {"KSSU", 4}, {"KTEX", 4},
+    {"KTHU", 4}, {"KTOI", 4}, {"KTOM", 4}, {"KTOO", 4}, {"KTOP", 4}, {"KUPA", 4},
+    {"KUSI", 4}, {"KWIS", 4}, {"LADE", 4}, {"LAFA", 4}, {"LALI", 4}, {"LASF", 4},
+    {"LAWA", 4}, {"LAWN", 4}, {"LAYF", 4}, {"LAYP", 4}, {"LBLA", 4}, {"LBRE", 4},
+    {"LBUB", 4}, {"LCAN", 4}, {"LCLO", 4}, {"LCOV", 4}, {"LDCR", 4}, {"LDEG", 4},
+    {"LDIG", 4}, {"LDIT", 4}, {"LDOP", 4}, {"LDSM", 4}, {"LDUP", 4}, {"LDYO", 4},
+    {"LEAM", 4}, {"LEAX", 4}, {"LEAY", 4}, {"LEBH", 4}, {"LECL", 4}, {"LEDR", 4},
+    {"LEDY", 4}, {"LEEF", 4}, {"LEEP", 4}, {"LEEQ", 4}, {"LEEV", 4}, {"LEFF", 4},
+    {"LEFL", 4}, {"LEGM", 4}, {"LEID", 4}, {"LELU", 4}, {"LEMP", 4}, {"LEOB", 4},
+    {"LERV", 4}, {"LESR", 4}, {"LFAC", 4}, {"LFBU", 4}, {"LFIR", 4}, {"LFIX", 4},
+    {"LFMA", 4}, {"LFRI", 4}, {"LGEM", 4}, {"LHIG", 4}, {"LIBE", 4}, {"LIBF", 4},
+    {"LICW", 4}, {"LIET", 4}, {"LINU", 4}, {"LISM", 4}, {"LIZA", 4}, {"LJUS", 4},
+    {"LLAW", 4}, {"LLAY", 4}, {"LLBI", 4}, {"LLDR", 4}, {"LLFR", 4}, {"LLIB", 4},
+    {"LLIM", 4}, {"LLKE", 4}, {"LLMI", 4}, {"LLMY", 4}, {"LLOG", 4}, {"LLRO", 4},
+    {"LLVA", 4}, {"LLWE", 4}, {"LMNO", 4}, {"LNET", 4}, {"LNEX", 4}, {"LNON", 4},
+    {"LOCT", 4}, {"LOGW", 4}, {"LONS", 4}, {"LORR", 4}, {"LOTF", 4}, {"LOTS", 4},
+    {"LPHE", 4}, {"LPSU", 4}, {"LPVI", 4}, {"LSAC", 4}, {"LSEF", 4}, {"LSEG", 4},
+    {"LSIF", 4}, {"LSIS", 4}, {"LSWH", 4}, {"LTBE", 4}, {"LTBY", 4}, {"LTEN", 4},
+    {"LTHR", 4}, {"LTIA", 4}, {"LTLI", 4}, {"LTLO", 4}, {"LTME", 4}, {"LTPL", 4},
+    {"LTQU", 4}, {"LTSH", 4}, {"LTUR", 4}, {"LTVI", 4}, {"LTYC", 4}, {"LUCK", 4},
+    {"LUGJ", 4}, {"LUNT", 4}, {"LUSO", 4}, {"LVAN", 4}, {"LVEO", 4}, {"LYAU", 4},
+    {"LYBA", 4}, {"LYEQ", 4}, {"LYGE", 4}, {"LYHE", 4}, {"LYIL", 4}, {"LYNU", 4},
+    {"LYSW", 4}, {"LYTA", 4}, {"MACT", 4}, {"MADI", 4}, {"MALW", 4}, {"MANR", 4},
+    {"MAPD", 4}, {"MAPG", 4}, {"MARG", 4}, {"MASA", 4}, {"MASK", 4}, {"MASY", 4},
+    {"MAXM", 4}, {"MAYG", 4}, {"MAYL", 4}, {"MBAC", 4}, {"MBAL", 4}, {"MBEE", 4},
+    {"MBEP", 4}, {"MCCO", 4}, {"MCIS", 4}, {"MCLE", 4}, {"MDAT", 4}, {"MDCP", 4},
+    {"MDEN", 4}, {"MDLI", 4}, {"MEBO", 4}, {"MEDF", 4}, {"MEDM", 4}, {"MEDP", 4},
+    {"MEDW", 4}, {"MEFE", 4}, {"MEFT", 4}, {"MEFU", 4}, {"MEGI", 4}, {"MEPU", 4},
+    {"METT", 4}, {"METW", 4}, {"METY", 4}, {"MEUN", 4}, {"MEYE", 4}, {"MFIR", 4},
+    {"MFUN", 4}, {"MGRA", 4}, {"MHAD", 4}, {"MHEN", 4}, {"MHIK", 4}, {"MHIS", 4},
+    {"MICA", 4}, {"MIGA", 4}, {"MINH", 4}, {"MINP", 4}, {"MINW", 4}, {"MIRR", 4},
+    {"MISL", 4}, {"MISU", 4}, {"MITB", 4}, {"MITD", 4}, {"MITF", 4}, {"MITR", 4},
+    {"MIXW", 4}, {"MLFI", 4}, {"MLIN", 4}, {"MLIS", 4}, {"MLOO", 4}, {"MLYA", 4},
+    {"MMAD", 4}, {"MMCC", 4}, {"MMCI", 4}, {"MMIG", 4}, {"MMIX", 4}, {"MMOR", 4},
+    {"MMOS", 4}, {"MMOT", 4}, {"MNBE", 4}, {"MNEP", 4}, {"MNIC", 4}, {"MNNU", 4},
+    {"MNON", 4}, {"MNWH", 4}, {"MOFI", 4}, {"MOFO", 4}, {"MOFU", 4}, {"MORC", 4},
+    {"MOUG", 4}, {"MOVA", 4}, {"MPHN", 4}, {"MPTE", 4}, {"MPTF", 4}, {"MREG", 4},
+    {"MREP", 4}, {"MSBY", 4}, {"MSDI", 4}, {"MSEN", 4}, {"MSFR", 4}, {"MSGG", 4},
+    {"MSGR", 4}, {"MSID", 4}, {"MSNA", 4}, {"MSOU", 4}, {"MSPA", 4}, {"MSST", 4},
+    {"MSSU", 4}, {"MSUS", 4}, {"MTTH", 4}, {"MVEI", 4}, {"MVIS", 4}, {"MWAI", 4},
+    {"MYDE", 4}, {"NACL", 4}, {"NAFA", 4}, {"NAFL", 4}, {"NAMO", 4}, {"NANN", 4},
+    {"NAPH", 4}, {"NAPI", 4}, {"NASB", 4}, {"NAUN", 4}, {"NBAB", 4}, {"NBEV", 4},
+    {"NBIN", 4}, {"NBYB", 4}, {"NBYI", 4}, {"NBYJ", 4}, {"NCEU", 4}, {"NCLE", 4},
+    {"NCPA", 4}, {"NCRA", 4}, {"NCRO", 4}, {"NCSW", 4}, {"NCTB", 4}, {"NCTR", 4},
+    {"NCUM", 4}, {"NCWI", 4}, {"NDBC", 4}, {"NDBD", 4}, {"NDBP", 4}, {"NDCD", 4},
+    {"NDCE", 4}, {"NDCM", 4}, {"NDEB", 4}, {"NDIH", 4}, {"NDJP", 4}, {"NDNI", 4},
+    {"NDOL", 4}, {"NDVO", 4}, {"NDYA", 4}, {"NDZR", 4}, {"NEBL", 4}, {"NECL", 4},
+    {"NECN", 4}, {"NEDP", 4}, {"NEDU", 4}, {"NEER", 4}, {"NELY", 4}, {"NENA", 4},
+    {"NENG", 4}, {"NEOB", 4}, {"NEPH", 4}, {"NEPO", 4}, {"NERF", 4}, {"NETL", 4},
+    {"NETT", 4}, {"NEVA", 4}, {"NFAL", 4}, {"NGBR", 4}, {"NGCR", 4}, {"NGOC", 4},
+    {"NGOV", 4}, {"NGTI", 4}, {"NGTU", 4}, {"NGUE", 4}, {"NGUT", 4}, {"NHEX", 4},
+    {"NHIG", 4}, {"NHIT", 4}, {"NHOL", 4}, {"NICD", 4}, {"NICK", 4}, {"NIFB", 4},
+    {"NIGH", 4}, {"NIMB", 4}, {"NINM", 4}, {"NIXC", 4}, {"NJOI", 4}, {"NKAW", 4},
+    {"NKCH", 4}, {"NKIT", 4}, {"NKOR", 4}, {"NKSO", 4}, {"NKST", 4}, {"NLAR", 4},
+    {"NLEA", 4}, {"NLYV", 4}, {"NMAI", 4}, {"NNAN", 4}, {"NNDI", 4}, {"NNDO", 4},
+    {"NNEE", 4}, {"NNIC", 4}, {"NNOM", 4}, {"NNOO", 4}, {"NNOU", 4}, {"NOAR", 4},
+    {"NOBA", 4}, {"NOCL", 4}, {"NOCT", 4}, {"NOEF", 4}, {"NOFB", 4}, {"NOGR", 4},
+    {"NOND", 4}, {"NOSP", 4}, {"NOWG", 4}, {"NPIE", 4}, {"NPIT", 4}, {"NPOP", 4},
+    {"NRFO", 4}, {"NRGV", 4}, {"NROU", 4}, {"NRRE", 4}, {"NSAI", 4}, {"NSAU", 4},
+    {"NSBA", 4}, {"NSGR", 4}, {"NSII", 4}, {"NSLE", 4}, {"NSOB", 4}, {"NSOY", 4},
+    {"NSTF", 4}, {"NSXN", 4}, {"NTAO", 4}, {"NTCS", 4}, {"NTEC", 4}, {"NTEG", 4},
+    {"NTEM", 4}, {"NTGO", 4}, {"NTHL", 4}, {"NTMI", 4}, {"NTMY", 4}, {"NTNA", 4},
+    {"NTOH", 4}, {"NTQB", 4}, {"NTSQ", 4}, {"NTTI", 4}, {"NTTW", 4}, {"NTYB", 4},
+    {"NTYK", 4}, {"NUEE", 4}, {"NUEL", 4}, {"NUFO", 4}, {"NUNC", 4}, {"NUNP", 4},
+    {"NUSO", 4}, {"NUSW", 4}, {"NUTI", 4}, {"NXTE", 4}, {"NXWI", 4}, {"NYBU", 4},
+    {"NYFR", 4}, {"NYLE", 4}, {"NYLO", 4}, {"NYNA", 4}, {"NYOR", 4}, {"NYTR", 4},
+    {"NYTW", 4}, {"NYVA", 4}, {"NYWI", 4}, {"OABA", 4}, {"OAFA", 4}, {"OAGA", 4},
+    {"OALE", 4}, {"OANA", 4}, {"OANI", 4}, {"OANU", 4}, {"OAPR", 4}, {"OASA", 4},
+    {"OASU", 4}, {"OBJS", 4}, {"OBLA", 4}, {"OBRI", 4}, {"OBSA", 4}, {"OBTU", 4},
+    {"OBYL", 4}, {"OCEN", 4}, {"OCIO", 4}, {"OCIR", 4}, {"OCKE", 4}, {"OCKY", 4},
+    {"OCNA", 4}, {"OCRY", 4}, {"OCST", 4}, {"ODAS", 4}, {"ODBU", 4}, {"ODBY", 4},
+    {"ODEX", 4}, {"ODFA", 4}, {"ODIG", 4}, {"ODIL", 4}, {"ODIM", 4}, {"ODOL", 4},
+    {"ODOR", 4}, {"ODSH", 4}, {"ODYL", 4}, {"ODYN", 4}, {"OEFF", 4}, {"OEME", 4},
+    {"OEMI", 4}, {"OENC", 4}, {"OENF", 4}, {"OESB", 4}, {"OFAQ", 4}, {"OFBA", 4},
+    {"OFCT", 4}, {"OFED", 4}, {"OFEE", 4}, {"OFER", 4}, {"OFIF", 4}, {"OGAN", 4},
+    {"OGOF", 4}, {"OGYB", 4}, {"OGYO", 4}, {"OHES", 4}, {"OHIM", 4}, {"OIAN", 4},
+    {"OIDE", 4}, {"OIDR", 4}, {"OILI", 4}, {"OILY", 4}, {"OIMA", 4}, {"OITC", 4},
+    {"OITG", 4}, {"OKIH", 4}, {"OKOB", 4}, {"OKOR", 4}, {"OKST", 4}, {"OKVI", 4},
+    {"OLDP", 4}, {"OLEH", 4}, {"OLIA", 4}, {"OLIQ", 4}, {"OLTI", 4}, {"OMAB", 4},
+    {"OMAV", 4}, {"OMBW", 4}, {"OMEK", 4}, {"OMEQ", 4}, {"OMFI", 4}, {"OMGR", 4},
+    {"OMIZ", 4}, {"OMPH", 4}, {"OMSE", 4}, {"OMSG", 4}, {"OMUS", 4}, {"OMVE", 4},
+    {"ONAA", 4}, {"ONAX", 4}, {"ONBI", 4}, {"ONGB", 4}, {"ONMY", 4}, {"ONOV", 4},
+    {"ONPO", 4}, {"ONPY", 4}, {"ONTD", 4}, {"ONXI", 4}, {"ONXP", 4}, {"OOCH", 4},
+    {"OODG", 4}, {"OOFA", 4}, {"OOFB", 4}, {"OOIL", 4}, {"OOLV", 4}, {"OOMI", 4},
+    {"OOON", 4}, {"OORD", 4}, {"OORI", 4}, {"OORO", 4}, {"OOSM", 4}, {"OOTT", 4},
+    {"OPEW", 4}, {"OPOL", 4}, {"OPRA", 4}, {"OPSP", 4}, {"OPVA", 4}, {"OPXV", 4},
+    {"OPYP", 4}, {"OPYW", 4}, {"ORAQ", 4}, {"ORAV", 4}, {"ORCC", 4}, {"ORDN", 4},
+    {"ORGI", 4}, {"ORGT", 4}, {"ORIA", 4}, {"OROM", 4}, {"OROW", 4}, {"ORSV", 4},
+    {"OSAN", 4}, {"OSFO", 4}, {"OSKI", 4}, {"OSOT", 4}, {"OSOU", 4}, {"OSPO", 4},
+    {"OSQR", 4}, {"OSSP", 4}, {"OSTG", 4}, {"OSUF", 4}, {"OSUP", 4}, {"OSWA", 4},
+    {"OTAF", 4}, {"OTAR", 4}, {"OTBA", 4}, {"OTBR", 4}, {"OTEU", 4}, {"OTFL", 4},
+    {"OTHL", 4}, {"OTKN", 4}, {"OTOD", 4}, {"OTOJ", 4}, {"OTOV", 4}, {"OTPA", 4},
+    {"OTSW", 4}, {"OTTI", 4}, {"OTUP", 4}, {"OTVA", 4}, {"OTVI", 4}, {"OUAH", 4},
+    {"OUAW", 4}, {"OUCE", 4}, {"OUCL", 4}, {"OUHI", 4}, {"OUPH", 4}, {"OUQU", 4},
+    {"OUSG", 4}, {"OUSN", 4}, {"OUTK", 4}, {"OUYA", 4}, {"OVEH", 4}, {"OVEL", 4},
+    {"OWAF", 4}, {"OWCF", 4}, {"OWCM", 4}, {"OWCS", 4}, {"OWDA", 4}, {"OWDW", 4},
+    {"OWFI", 4}, {"OWLA", 4}, {"OWNP", 4}, {"OWNV", 4}, {"OWSG", 4}, {"OWSN", 4},
+    {"OWTA", 4}, {"OWWT", 4}, {"OXFO", 4}, {"OYOD", 4}, {"PABO", 4}, {"PAFI", 4},
+    {"PALP", 4}, {"PALS", 4}, {"PARC", 4}, {"PARO", 4}, {"PAUT", 4}, {"PAYM", 4},
+    {"PBUT", 4}, {"PCHO", 4}, {"PCOP", 4}, {"PEES", 4}, {"PEFU", 4}, {"PENB", 4},
+    {"PENP", 4}, {"PENW", 4}, {"PENY", 4}, {"PESL", 4}, {"PESS", 4}, {"PEWI", 4},
+    {"PEXT", 4}, {"PGET", 4}, {"PHAA", 4}, {"PHAN", 4}, {"PHRI", 4}, {"PHSE", 4},
+    {"PHYT", 4}, {"PINI", 4}, {"PISA", 4}, {"PLFO", 4}, {"PLIK", 4}, {"PLRE", 4},
+    {"PODS", 4}, {"POLE", 4}, {"PONB", 4}, {"PONH", 4}, {"PONP", 4}, {"PORO", 4},
+    {"POTB", 4}, {"POVE", 4}, {"PPAN", 4}, {"PPAT", 4}, {"PREH", 4}, {"PRGN", 4},
+    {"PRGO", 4}, {"PRIG", 4}, {"PRVI", 4}, {"PSAS", 4}, {"PSBE", 4}, {"PSCA", 4},
+    {"PSES", 4}, {"PSEU", 4}, {"PSIT", 4}, {"PSPA", 4}, {"PSRE", 4}, {"PSWH", 4},
+    {"PTAR", 4}, {"PTDO", 4}, {"PTFA", 4}, {"PTHU", 4}, {"PTIE", 4}, {"PTMA", 4},
+    {"PTMP", 4}, {"PTOI", 4}, {"PTON", 4}, {"PTOW", 4}, {"PTPR", 4}, {"PTPT", 4},
+    {"PUPA", 4}, {"PUPW", 4}, {"PUTP", 4}, {"PVAL", 4}, {"PVIO", 4}, {"PXVI", 4},
+    {"PYAL", 4}, {"PYIT", 4}, {"PYWI", 4}, {"QALL", 4}, {"QBET", 4}, {"QIST", 4},
+    {"QREG", 4}, {"QRTI", 4}, {"QRTR", 4}, {"QUAD", 4}, {"QUEA", 4}, {"QUEF", 4},
+    {"QUEP", 4}, {"QUIU", 4}, {"QWHE", 4}, {"RACL", 4}, {"RADA", 4}, {"RAFF", 4},
+    {"RAFR", 4}, {"RAIS", 4}, {"RAML", 4}, {"RANU", 4}, {"RAPB", 4}, {"RARC", 4},
+    {"RARO", 4}, {"RASU", 4}, {"RATP", 4}, {"RAYM", 4}, {"RBAN", 4}, {"RBEM", 4},
+    {"RBEN", 4}, {"RBER", 4}, {"RBES", 4}, {"RBTH", 4}, {"RBYD", 4}, {"RBYF", 4},
+    {"RBYH", 4}, {"RCAM", 4}, {"RCAR", 4}, {"RCEE", 4}, {"RCEM", 4}, {"RCEY", 4},
+    {"RCHB", 4}, {"RCHW", 4}, {"RCMA", 4}, {"RCYO", 4}, {"RDAB", 4}, {"RDFI", 4},
+    {"RDHE", 4}, {"RDOT", 4}, {"RDPO", 4}, {"RDSG", 4}, {"RDSL", 4}, {"REEB", 4},
+    {"REEH", 4}, {"REFT", 4}, {"REHO", 4}, {"REID", 4}, {"REIR", 4}, {"RENS", 4},
+    {"RESB", 4}, {"RESF", 4}, {"RESK", 4}, {"REVC", 4}, {"REXH", 4}, {"RFAR", 4},
+    {"RFUT", 4}, {"RGDO", 4}, {"RGEB", 4}, {"RGEC", 4}, {"RGIF", 4}, {"RGOE", 4},
+    {"RGOT", 4}, {"RGSO", 4}, {"RGTH", 4}, {"RHIN", 4}, {"RICI", 4}, {"RICO", 4},
+    {"RIDI", 4}, {"RIDO", 4}, {"RIDX", 4}, {"RIFE", 4}, {"RIHA", 4}, {"RIIT", 4},
+    {"RILT", 4}, {"RINU", 4}, {"RIOD", 4}, {"RION", 4}, {"RISB", 4}, {"RISG", 4},
+    {"RITF", 4}, {"RIZA", 4}, {"RJUM", 4}, {"RKAL", 4}, {"RKBY", 4}, {"RKGO", 4},
+    {"RKGR", 4}, {"RKRU", 4}, {"RKSD", 4}, {"RKSY", 4}, {"RLOA", 4}, {"RLOT", 4},
+    {"RLPC", 4}, {"RLVC", 4}, {"RLVO", 4}, {"RLVU", 4}, {"RLWC", 4}, {"RLWI", 4},
+    {"RLWK", 4}, {"RMAB", 4}, {"RMAD", 4}, {"RMDA", 4}, {"RMDU", 4}, {"RMEC", 4},
+    {"RMFO", 4}, {"RMID", 4}, {"RMMC", 4}, {"RMUL", 4}, {"RNAB", 4}, {"RNAG", 4},
+    {"RNDO", 4}, {"RNES", 4}, {"RNNU", 4}, {"RNSS", 4}, {"RNSW", 4}, {"RNTY", 4},
+    {"RNWH", 4}, {"RNWI", 4}, {"ROAB", 4}, {"ROCS", 4}, {"ROFR", 4}, {"ROFV", 4},
+    {"ROLE", 4}, {"RORE", 4}, {"RORR", 4}, {"ROSA", 4}, {"ROWB", 4}, {"ROWD", 4},
+    {"ROWF", 4}, {"ROWM", 4}, {"ROYO", 4}, {"RPHN", 4}, {"RQUA", 4}, {"RRAT", 4},
+    {"RREQ", 4}, {"RRTO", 4}, {"RSDA", 4}, {"RSEF", 4}, {"RSEH", 4}, {"RSFE", 4},
+    {"RSGR", 4}, {"RSIH", 4}, {"RSIL", 4}, {"RSLY", 4}, {"RSME", 4}, {"RSNA", 4},
+    {"RSOS", 4}, {"RSOW", 4}, {"RSPL", 4}, {"RSPO", 4}, {"RSPQ", 4}, {"RSSA", 4},
+    {"RSWA", 4}, {"RTAG", 4}, {"RTBU", 4}, {"RTEL", 4}, {"RTHY", 4}, {"RTME", 4},
+    {"RTRR", 4}, {"RTRU", 4}, {"RTRY", 4}, {"RTSC", 4}, {"RTSH", 4}, {"RTSN", 4},
+    {"RTSR", 4}, {"RTSU", 4}, {"RTYB", 4}, {"RUDE", 4}, {"RUEO", 4}, {"RUET", 4},
+    {"RUMF", 4}, {"RUNF", 4}, {"RVAB", 4}, {"RVIS", 4}, {"RWBR", 4}, {"RXST", 4},
+    {"RYAR", 4}, {"RYBO", 4}, {"RYDA", 4}, {"RYET", 4}, {"RYHO", 4}, {"RYIM", 4},
+    {"RYLA", 4}, {"RYPL", 4}, {"SAAL", 4}, {"SABU", 4}, {"SACI", 4}, {"SAKE", 4},
+    {"SALG", 4}, {"SAMU", 4}, {"SAPU", 4}, {"SAQU", 4}, {"SAUS", 4}, {"SAYA", 4},
+    {"SAYE", 4}, {"SAYO", 4}, {"SBLO", 4}, {"SBOR", 4}, {"SBYB", 4}, {"SBYF", 4},
+    {"SBYL", 4}, {"SCEM", 4}, {"SCKE", 4}, {"SCOD", 4}, {"SDEA", 4}, {"SDEM", 4},
+    {"SDIL", 4}, {"SDIM", 4}, {"SDOD", 4}, {"SDTH", 4}, {"SDUR", 4}, {"SEAA", 4},
+    {"SEAI", 4}, {"SEBS", 4}, {"SEFL", 4}, {"SEGO", 4}, {"SEHI", 4}, {"SEHY", 4},
+    {"SELU", 4}, {"SENI", 4}, {"SEOU", 4}, {"SEPT", 4}, {"SERB", 4}, {"SERN", 4},
+    {"SEUD", 4}, {"SFAI", 4}, {"SFIX", 4}, {"SFOC", 4}, {"SFON", 4}, {"SFUR", 4},
+    {"SGGE", 4}, {"SGNO", 4}, {"SGWH", 4}, {"SHDS", 4}, {"SHFI", 4}, {"SHGR", 4},
+    {"SHIO", 4}, {"SHLI", 4}, {"SHNE", 4}, {"SHOF", 4}, {"SHPR", 4}, {"SHRI", 4},
+    {"SHST", 4}, {"SHVE", 4}, {"SICR", 4}, {"SICT", 4}, {"SIDO", 4}, {"SIFC", 4},
+    {"SIII", 4}, {"SILK", 4}, {"SIRR", 4}, {"SITG", 4}, {"SITL", 4}, {"SIXA", 4},
+    {"SJOB", 4}, {"SKFO", 4}, {"SKYC", 4}, {"SLAY", 4}, {"SLEE", 4}, {"SLYW", 4},
+    {"SMDE", 4}, {"SMGR", 4}, {"SMMA", 4}, {"SMSB", 4}, {"SMSH", 4}, {"SMSM", 4},
+    {"SMUP", 4}, {"SMWE", 4}, {"SMYO", 4}, {"SNAT", 4}, {"SNEI", 4}, {"SNIN", 4},
+    {"SNOP", 4}, {"SNTD", 4}, {"SNTF", 4}, {"SOAC", 4}, {"SOAT", 4}, {"SOAV", 4},
+    {"SODE", 4}, {"SONN", 4}, {"SORJ", 4}, {"SOSH", 4}, {"SOWR", 4}, {"SPEE", 4},
+    {"SPET", 4}, {"SPOL", 4}, {"SROO", 4}, {"SROU", 4}, {"SSAY", 4}, {"SSDT", 4},
+    {"SSHI", 4}, {"SSIZ", 4}, {"SSMU", 4}, {"SSOH", 4}, {"SSSH", 4}, {"STAM", 4},
+    {"STCI", 4}, {"STCL", 4}, {"STCU", 4}, {"STEW", 4}, {"STFA", 4}, {"STOJ", 4},
+    {"STRL", 4}, {"STRS", 4}, {"STSB", 4}, {"STXT", 4}, {"SUAN", 4}, {"SUED", 4},
+    {"SUNE", 4}, {"SUPA", 4}, {"SUPG", 4}, {"SUPW", 4}, {"SVAN", 4}, {"SVOL", 4},
+    {"SWON", 4}, {"SWST", 4}, {"SXCO", 4}, {"SXNU", 4}, {"SYNI", 4}, {"SYOY", 4},
+    {"TAAR", 4}, {"TABU", 4}, {"TAFA", 4}, {"TAGB", 4}, {"TAHO", 4}, {"TAOF", 4},
+    {"TATP", 4}, {"TATV", 4}, {"TAUB", 4}, {"TAXB", 4}, {"TAXT", 4}, {"TBRO", 4},
+    {"TBYD", 4}, {"TBYE", 4}, {"TBYF", 4}, {"TBYO", 4}, {"TBYV", 4}, {"TCEL", 4},
+    {"TCEN", 4}, {"TCHN", 4}, {"TCIN", 4}, {"TCOH", 4}, {"TCST", 4}, {"TDOO", 4},
+    {"TDOU", 4}, {"TEBA", 4}, {"TEBI", 4}, {"TECL", 4}, {"TEGO", 4}, {"TEHE", 4},
+    {"TEKE", 4}, {"TEMV", 4}, {"TENM", 4}, {"TEOT", 4}, {"TERK", 4}, {"TESD", 4},
+    {"TESL", 4}, {"TESQ", 4}, {"TETC", 4}, {"TEXH", 4}, {"TFAN", 4}, {"TFIT", 4},
+    {"TFON", 4}, {"TGEO", 4}, {"TGRA", 4}, {"THAH", 4}, {"THAQ", 4}, {"THCI", 4},
+    {"THGL", 4}, {"THHA", 4}, {"THHE", 4}, {"THMU", 4}, {"THMY", 4}, {"THOV", 4},
+    {"THPI", 4}, {"THQU", 4}, {"THSM", 4}, {"THTR", 4}, {"TIAU", 4}, {"TICC", 4},
+    {"TIFN", 4}, {"TIFS", 4}, {"TIII", 4}, {"TINB", 4}, {"TIOF", 4}, {"TIOO", 4},
+    {"TIRO", 4}, {"TIVP", 4}, {"TIWR", 4}, {"TJUM", 4}, {"TLAR", 4}, {"TMAJ", 4},
+    {"TMEE", 4}, {"TMLF", 4}, {"TNEV", 4}, {"TNOF", 4}, {"TOCN", 4}, {"TODR", 4},
+    {"TOHE", 4}, {"TOHT", 4}, {"TOIA", 4}, {"TOMW", 4}, {"TONG", 4}, {"TOOA", 4},
+    {"TOPD", 4}, {"TOPH", 4}, {"TOSQ", 4}, {"TOZE", 4}, {"TPEN", 4}, {"TPEO", 4},
+    {"TPOL", 4}, {"TPOP", 4}, {"TPTA", 4}, {"TPTH", 4}, {"TQAN", 4}, {"TRID", 4},
+    {"TRIF", 4}, {"TRST", 4}, {"TRTR", 4}, {"TRWB", 4}, {"TRYR", 4}, {"TSAD", 4},
+    {"TSCI", 4}, {"TSCL", 4}, {"TSFA", 4}, {"TSGE", 4}, {"TSGI", 4}, {"TSJU", 4},
+    {"TSME", 4}, {"TSMU", 4}, {"TSOC", 4}, {"TSOD", 4}, {"TSUL", 4}, {"TSVA", 4},
+    {"TSWS", 4}, {"TTPV", 4}, {"TTRU", 4}, {"TTYD", 4}, {"TUEI", 4}, {"TUME", 4},
+    {"TUOU", 4}, {"TUPP", 4}, {"TUPV", 4}, {"TUSC", 4}, {"TUST", 4}, {"TWOK", 4},
+    {"TWOV", 4}, {"TXTD", 4}, {"TXTP", 4}, {"TXYW", 4}, {"TYAT", 4}, {"TYCA", 4},
+    {"TYDE", 4}, {"TYES", 4}, {"TYKE", 4}, {"TYOT", 4}, {"TYSE", 4}, {"TYTE", 4},
+    {"TYTR", 4}, {"TYYO", 4}, {"UACT", 4}, {"UAGR", 4}, {"UAHI", 4}, {"UALK", 4},
+    {"UALN", 4}, {"UBBI", 4}, {"UBEC", 4}, {"UBET", 4}, {"UCAL", 4}, {"UCEW", 4},
+    {"UCHQ", 4}, {"UCHU", 4}, {"UCHV", 4}, {"UCUR", 4}, {"UDEE", 4}, {"UDOA", 4},
+    {"UDOB", 4}, {"UDOI", 4}, {"UEFR", 4}, {"UEIF", 4}, {"UESF", 4}, {"UEXI", 4},
+    {"UEYE", 4}, {"UFFV", 4}, {"UFWR", 4}, {"UGHC", 4}, {"UGHE", 4}, {"UGHG", 4},
+    {"UGHV", 4}, {"UGJA", 4}, {"UGLY", 4}, {"UIDI", 4}, {"UIET", 4}, {"UIIN", 4},
+    {"UINF", 4}, {"UIUM", 4}, {"ULDV", 4}, {"ULFI", 4}, {"ULSI", 4}, {"ULTP", 4},
+    {"ULTQ", 4}, {"ULTW", 4}, {"ULWI", 4}, {"UMAB", 4}, {"UMAC", 4}, {"UMCO", 4},
+    {"UMDO", 4}, {"UMEE", 4}, {"UMEY", 4}, {"UMHO", 4}, {"UMNA", 4}, {"UMNC", 4},
+    {"UMNN", 4}, {"UMRE", 4}, {"UNBU", 4}, {"UNMI", 4}, {"UNON", 4}, {"UNPL", 4},
+    {"UNPR", 4}, {"UNSB", 4}, {"UORY", 4}, {"UPAD", 4}, {"UPDI", 4}, {"UPEX", 4},
+    {"UPHE", 4}, {"UPSC", 4}, {"UPSE", 4}, {"UPSY", 4}, {"UQUI", 4}, {"URCI", 4},
+    {"URDF", 4}, {"UREU", 4}, {"URHA", 4}, {"URHO", 4}, {"URIO", 4}, {"URIT", 4},
+    {"URME", 4}, {"URMI", 4}, {"URON", 4}, {"URSQ", 4}, {"URSV", 4}, {"URTI", 4},
+    {"URTS", 4}, {"URYE", 4}, {"USAA", 4}, {"USAF", 4}, {"USAL", 4}, {"USAT", 4},
+    {"USAV", 4}, {"USCT", 4}, {"USFU", 4}, {"USGO", 4}, {"USGW", 4}, {"USHA", 4},
+    {"USHI", 4}, {"USIC", 4}, {"USMI", 4}, {"USMO", 4}, {"USOB", 4}, {"USRE", 4},
+    {"USTN", 4}, {"UTAD", 4}, {"UTAG", 4}, {"UTAI", 4}, {"UTAQ", 4}, {"UTAV", 4},
+    {"UTBO", 4}, {"UTEH", 4}, {"UTEU", 4}, {"UTKE", 4}, {"UTME", 4}, {"UTOG", 4},
+    {"UTOP", 4}, {"UTOU", 4}, {"UTSH", 4}, {"UTSS", 4}, {"UTTR", 4}, {"UTTX", 4},
+    {"UTUN", 4}, {"UUMB", 4}, {"UUMW", 4}, {"UYAN", 4}, {"UZZY", 4}, {"VAIM", 4},
+    {"VCTR", 4}, {"VDEV", 4}, {"VDTH", 4}, {"VECR", 4}, {"VEDH", 4}, {"VEFU", 4},
+    {"VELL", 4}, {"VELS", 4}, {"VENF", 4}, {"VENU", 4}, {"VEOV", 4}, {"VEWA", 4},
+    {"VEXP", 4}, {"VFRO", 4}, {"VIIT", 4}, {"VINC", 4}, {"VINP", 4}, {"VITH", 4},
+    {"VOCO", 4}, {"VSPL", 4}, {"VVER", 4}, {"VYOU", 4}, {"WANO", 4}, {"WAUT", 4},
+    {"WAYC", 4}, {"WAYV", 4}, {"WBAC", 4}, {"WBOT", 4}, {"WBYR", 4}, {"WCAN", 4},
+    {"WCFO", 4}, {"WCMD", 4}, {"WCOP", 4}, {"WCOR", 4}, {"WCSH", 4}, {"WCTH", 4},
+    {"WELC", 4}, {"WEMP", 4}, {"WERD", 4}, {"WERG", 4}, {"WERL", 4}, {"WESA", 4},
+    {"WESE", 4}, {"WESO", 4}, {"WEWO", 4}, {"WFLA", 4}, {"WHYA", 4}, {"WHYD", 4},
+    {"WHYI", 4}, {"WIDF", 4}, {"WINL", 4}, {"WISM", 4}, {"WLIB", 4}, {"WLIS", 4},
+    {"WLYA", 4}, {"WMAP", 4}, {"WNME", 4}, {"WNOR", 4}, {"WNOT", 4}, {"WNSE", 4},
+    {"WNSO", 4}, {"WNST", 4}, {"WNWI", 4}, {"WOAL", 4}, {"WOAR", 4}, {"WOFA", 4},
+    {"WOGO", 4}, {"WOIT", 4}, {"WOPT", 4}, {"WORB", 4}, {"WORM", 4}, {"WORS", 4},
+    {"WOSI", 4}, {"WOSP", 4}, {"WOUT", 4}, {"WOWA", 4}, {"WRES", 4}, {"WSAL", 4},
+    {"WSDE", 4}, {"WSEA", 4}, {"WSEN", 4}, {"WSEP", 4}, {"WSES", 4}, {"WSMO", 4},
+    {"WSOP", 4}, {"WSPL", 4}, {"WSPR", 4}, {"WSRE", 4}, {"WSTS", 4}, {"WSUS", 4},
+    {"WSVE", 4}, {"WSYN", 4}, {"WTHO", 4}, {"WTHU", 4}, {"WTOF", 4}, {"WTOM", 4},
+    {"WUPO", 4}, {"WVIS", 4}, {"WWAR", 4}, {"WWRI", 4}, {"WWVI", 4}, {"WWWV", 4},
+    {"XDAN", 4}, {"XELE", 4}, {"XIBL", 4}, {"XIFI", 4}, {"XIFY", 4}, {"XINS", 4},
+    {"XINT", 4}, {"XISB", 4}, {"XISI", 4}, {"XITS", 4}, {"XLIS", 4}, {"XOFF", 4},
+    {"XOFT", 4}, {"XTAA", 4}, {"XTAC", 4}, {"XTAG", 4}, {"XTAL", 4}, {"XTCR", 4},
+    {"XTCT", 4}, {"XTDA", 4}, {"XTGR", 4}, {"XTLE", 4}, {"XTOT", 4}, {"XTSL", 4},
+    {"XTSW", 4}, {"XTYP", 4}, {"YACI", 4}, {"YACQ", 4}, {"YAFE", 4}, {"YAGE", 4},
+    {"YAMI", 4}, {"YANS", 4}, {"YASF", 4}, {"YATH", 4}, {"YATI", 4}, {"YBEB", 4},
+    {"YBYA", 4}, {"YBYR", 4}, {"YBYW", 4}, {"YCAS", 4}, {"YCLI", 4}, {"YCRO", 4},
+    {"YCTR", 4}, {"YDEN", 4}, {"YDOT", 4}, {"YDRA", 4}, {"YECH", 4}, {"YEDU", 4},
+    {"YEIN", 4}, {"YERR", 4}, {"YESF", 4}, {"YESI", 4}, {"YESN", 4}, {"YETN", 4},
+    {"YEVA", 4}, {"YEXA", 4}, {"YFLU", 4}, {"YFRI", 4}, {"YHIN", 4}, {"YIFA", 4},
+    {"YIRR", 4}, {"YISB", 4}, {"YISH", 4}, {"YISO", 4}, {"YISV", 4}, {"YITE", 4},
+    {"YITM", 4}, {"YJAM", 4}, {"YLAR", 4}, {"YLAY", 4}, {"YLIF", 4}, {"YLOC", 4},
+    {"YLOS", 4}, {"YMEM", 4}, {"YNAT", 4}, {"YNCC", 4}, {"YNCG", 4}, {"YNCO", 4},
+    {"YNEI", 4}, {"YNOR", 4}, {"YODY", 4}, {"YONC", 4}, {"YONW", 4}, {"YOPE", 4},
+    {"YORR", 4}, {"YOUQ", 4}, {"YOYO", 4}, {"YPLU", 4}, {"YRAR", 4}, {"YREI", 4},
+    {"YSAC", 4}, {"YSAY", 4}, {"YSBU", 4}, {"YSEV", 4}, {"YSGO", 4}, {"YSLO", 4},
+    {"YSMU", 4}, {"YSOP", 4}, {"YSPH", 4}, {"YTIL", 4}, {"YTIN", 4}, {"YTOH", 4},
+    {"YTOK", 4}, {"YTOV", 4}, {"YVIO", 4}, {"ZAND", 4}, {"ZATE", 4}, {"ZEAN", 4},
+    {"ZEDA", 4}, {"ZEDP", 4}, {"ZESA", 4}, {"ZESY", 4}, {"ZSTA", 4}, {"AAAA", 3},
+    {"AAAB", 3}, {"AAAN", 3}, {"AACN", 3}, {"AARA", 3}, {"AARU", 3}, {"AARW", 3},
+    {"ABAS", 3}, {"ABBA", 3}, {"ABBC", 3}, {"ABCO", 3}, {"ABED", 3}, {"ABFO", 3},
+    {"ABGR", 3}, {"ABOD", 3}, {"ABON", 3}, {"ABOP", 3}, {"ABRA", 3}, {"ABSW", 3},
+    {"ABTO", 3}, {"ABUB", 3}, {"ABUI", 3}, {"ABWT", 3}, {"ABYS", 3}, {"ABYT", 3},
+    {"ACAL", 3}, {"ACAP", 3}, {"ACBD", 3}, {"ACDC", 3}, {"ACHY", 3}, {"ACKV", 3},
+    {"ACNE", 3}, {"ACOS", 3}, {"ACTH", 3}, {"ADAL", 3}, {"ADAM", 3}, {"ADBL", 3},
+    {"ADCH", 3}, {"ADEX", 3}, {"ADFT", 3}, {"ADHT", 3}, {"ADOP", 3}, {"ADSI", 3},
+    {"ADTW", 3}, {"ADUN", 3}, {"ADYB", 3}, {"ADYM", 3}, {"AEAN", 3}, {"AFAN", 3},
+    {"AFET", 3}, {"AFGO", 3}, {"AFLO", 3}, {"AFUT", 3}, {"AGCO", 3}, {"AGFI", 3},
+    {"AGOT", 3}, {"AGSE", 3}, {"AGSS", 3}, {"AGTE", 3}, {"AGWR", 3}, {"AHAR", 3},
+    {"AHUN", 3}, {"AIDC", 3}, {"AIDD", 3}, {"AIDH", 3}, {"AILO", 3}, {"AILY", 3},
+    {"AIMR", 3}, {"AINZ", 3}, {"AIRC", 3}, {"AIRL", 3}, {"AISE", 3}, {"AISI", 3},
+    {"AISS", 3}, {"AKAL", 3}, {"AKAN", 3}, {"AKEG", 3}, {"AKNO", 3}, {"AKON", 3},
+    {"AKRE", 3}, {"AKSA", 3}, {"AKSI", 3}, {"AKUS", 3}, {"ALAL", 3}, {"ALBA", 3},
+    {"ALEH", 3}, {"ALEY", 3}, {"ALHA", 3}, {"ALOS", 3}, {"ALOU", 3}, {"ALRO", 3},
+    {"ALTW", 3}, {"ALUM", 3}, {"ALUN", 3}, {"AMAB", 3}, {"AMAL", 3}, {"AMFR", 3},
+    {"AMHA", 3}, {"AMMN", 3}, {"AMOM", 3}, {"AMPH", 3}, {"AMSM", 3}, {"AMSV", 3},
+    {"AMUL", 3}, {"AMUT", 3}, {"ANAW", 3}, {"ANCU", 3}, {"ANEF", 3}, {"ANEL", 3},
+    {"ANEP", 3}, {"ANGV", 3}, {"ANLA", 3}, {"ANLI", 3}, {"ANOI", 3}, {"ANOW", 3},
+    {"ANPL", 3}, {"ANTG", 3}, {"ANVE", 3}, {"ANWE", 3}, {"ANYH", 3}, {"AONT", 3},
+    {"AORC", 3}, {"APBS", 3}, {"APEM", 3}, {"APEN", 3}, {"APEO", 3}, {"APGQ", 3},
+    {"APHD", 3}, {"APHG", 3}, {"APHP", 3}, {"APLE", 3}, {"APLO", 3}, {"APRV", 3},
+    {"APSF", 3}, {"APYO", 3}, {"ARAU", 3}, {"ARBZ", 3}, {"ARCI", 3}, {"ARCL", 3},
+    {"ARCT", 3}, {"ARGD", 3}, {"ARGO", 3}, {"ARKP", 3}, {"ARKW", 3}, {"ARLO", 3},
+    {"ARMI", 3}, {"ARNR", 3}, {"AROY", 3}, {"ARPE", 3}, {"ARSC", 3}, {"ARTX", 3},
+    {"ARYK", 3}, {"ASBA", 3}, {"ASBO", 3}, {"ASDA", 3}, {"ASHF", 3}, {"ASHV", 3},
+    {"ASIK", 3}, {"ASIR", 3}, {"ASIW", 3}, {"ASIX", 3}, {"ASJA", 3}, {"ASMY", 3},
+    {"ASPH", 3}, {"ASSN", 3}, {"ASTN", 3}, {"ASTY", 3}, {"ASUC", 3}, {"ASVA", 3},
+    {"ATAH", 3}, {"ATBU", 3}, {"ATCI", 3}, {"ATCL", 3}, {"ATDA", 3}, {"ATIA", 3},
+    {"ATIH", 3}, {"ATIR", 3}, {"ATJA", 3}, {"ATJU", 3}, {"ATKA", 3}, {"ATOA", 3},
+    {"ATOV", 3}, {"ATOZ", 3}, {"ATQF", 3}, {"ATSB", 3}, {"ATTY", 3}, {"ATYA", 3},
+    {"ATYE", 3}, {"AUNM", 3}, {"AVIB", 3}, {"AVOC", 3}, {"AWAM", 3}, {"AWAT", 3},
+    {"AWFO", 3}, {"AWFU", 3}, {"AWIL", 3}, {"AWIS", 3}, {"AWNT", 3}, {"AWYO", 3},
+    {"AXCV", 3}, {"AYDE", 3}, {"AYFA", 3}, {"AYGE", 3}, {"AYLE", 3}, {"AYNE", 3},
+    {"AYOB", 3}, {"AYOM", 3}, {"AYSR", 3}, {"AYSV", 3}, {"AYSY", 3}, {"AYTR", 3},
+    {"AYTY", 3}, {"AYUN", 3}, {"AZAN", 3}, {"AZAZ", 3}, {"AZER", 3}, {"BARN", 3},
+    {"BARU", 3}, {"BATC", 3}, {"BATT", 3}, {"BBAB", 3}, {"BBBA", 3}, {"BBBC", 3},
+    {"BBET", 3}, {"BBUT", 3}, {"BCBE", 3}, {"BCDI", 3}, {"BCIS", 3}, {"BCWH", 3},
+    {"BDEL", 3}, {"BDIV", 3}, {"BDON", 3}, {"BEAA", 3}, {"BEBL", 3}, {"BEEF", 3},
+    {"BEEI", 3}, {"BEIG", 3}, {"BEIS", 3}, {"BEIT", 3}, {"BEJU", 3}, {"BEKE", 3},
+    {"BEKN", 3}, {"BENN", 3}, {"BEOR", 3}, {"BERL", 3}, {"BERR", 3}, {"BEUP", 3},
+    {"BEWA", 3}, {"BEXI", 3}, {"BEYE", 3}, {"BFUN", 3}, {"BGRE", 3}, {"BHAN", 3},
+    {"BIDA", 3}, {"BISD", 3}, {"BITV", 3}, {"BLYG", 3}, {"BLYM", 3}, {"BLYP", 3},
+    {"BLYY", 3}, {"BNOT", 3}, {"BNRE", 3}, {"BOPT", 3}, {"BORE", 3}, {"BOUR", 3},
+    {"BOWE", 3}, {"BOWN", 3}, {"BOWT", 3}, {"BOYL", 3}, {"BPAT", 3}, {"BREP", 3},
+    {"BRIT", 3}, {"BSAR", 3}, {"BSDE", 3}, {"BSID", 3}, {"BSIT", 3}, {"BSOF", 3},
+    {"BSPL", 3}, {"BSWI", 3}, {"BTAG", 3}, {"BTED", 3}, {"BTHI", 3}, {"BURS", 3},
+    {"BVAR", 3}, {"BWAS", 3}, {"BWHI", 3}, {"BWIN", 3}, {"BYAU", 3}, {"BYBU", 3},
+    {"BYCH", 3}, {"BYCL", 3}, {"BYEN", 3}, {"BYEQ", 3}, {"BYIR", 3}, {"BYMR", 3},
+    {"BYWA", 3}, {"BZIP", 3}, {"CANQ", 3}, {"CAUG", 3}, {"CBEI", 3}, {"CBYT", 3},
+    {"CCCO", 3}, {"CCTR", 3}, {"CDAR", 3}, {"CDIN", 3}, {"CDIR", 3}, {"CEAE", 3},
+    {"CECI", 3}, {"CEDF", 3}, {"CEDG", 3}, {"CEDL", 3}, {"CEEQ", 3}, {"CEFU", 3},
+    {"CEGE", 3}, {"CEGI", 3}, {"CEGO", 3}, {"CEHA", 3}, {"CEJP", 3}, {"CENE", 3},
+    {"CEOT", 3}, {"CEXT", 3}, {"CFLA", 3}, {"CFOL", 3}, {"CHAU", 3}, {"CHBA", 3},
+    {"CHCR", 3}, {"CHIC", 3}, {"CHIG", 3}, {"CHLA", 3}, {"CHNI", 3}, {"CHOV", 3},
+    {"CHSC", 3}, {"CHSP", 3}, {"CHYE", 3}, {"CIDC", 3}, {"CIDK", 3}, {"CIDL", 3},
+    {"CIDO", 3}, {"CIDT", 3}, {"CIET", 3}, {"CIIW", 3}, {"CINC", 3}, {"CISC", 3},
+    {"CISU", 3}, {"CITG", 3}, {"CITP", 3}, {"CIZE", 3}, {"CJDK", 3}, {"CKAB", 3},
+    {"CKAR", 3}, {"CKAS", 3}, {"CKBY", 3}, {"CKES", 3}, {"CKHA", 3}, {"CKLO", 3},
+    {"CKOB", 3}, {"CKUS", 3}, {"CKVE", 3}, {"CLEC", 3}, {"CLIB", 3}, {"CLIE", 3},
+    {"CMAN", 3}, {"CMDD", 3}, {"CMDR", 3}, {"CMEN", 3}, {"CMOD", 3}, {"CNAM", 3},
+    {"CNTI", 3}, {"CNTW", 3}, {"CNUM", 3}, {"COFT", 3}, {"COLC", 3}, {"COLT", 3},
+    {"COOL", 3}, {"CORS", 3}, {"CORU", 3}, {"COSI", 3}, {"CPAI", 3}, {"CPAN", 3},
+    {"CPTM", 3}, {"CRAP", 3}, {"CREC", 3}, {"CRED", 3}, {"CREN", 3}, {"CRKJ", 3},
+    {"CSAS", 3}, {"CSBO", 3}, {"CSIN", 3}, {"CSOT", 3}, {"CTAP", 3}, {"CTBU", 3},
+    {"CTDI", 3}, {"CTGR", 3}, {"CTIM", 3}, {"CTNA", 3}, {"CTOC", 3}, {"CTPA", 3},
+    {"CTSB", 3}, {"CTWA", 3}, {"CUNI", 3}, {"CUSI", 3}, {"CVOI", 3}, {"CVSC", 3},
+    {"CYVI", 3}, {"DABC", 3}, {"DACA", 3}, {"DACH", 3}, {"DAGE", 3}, {"DAGO", 3},
+    {"DAKI", 3}, {"DALC", 3}, {"DALR", 3}, {"DALT", 3}, {"DANT", 3}, {"DASL", 3},
+    {"DASV", 3}, {"DATF", 3}, {"DATP", 3}, {"DATS", 3}, {"DAVO", 3}, {"DAWI", 3},
+    {"DAYA", 3}, {"DAYI", 3}, {"DBAN", 3}, {"DBIG", 3}, {"DBIT", 3}, {"DBOA", 3},
+    {"DBUN", 3}, {"DBYX", 3}, {"DCHO", 3}, {"DCOA", 3}, {"DCUS", 3}, {"DDAF", 3},
+    {"DDAM", 3}, {"DDCA", 3}, {"DDLI", 3}, {"DDLO", 3}, {"DDNU", 3}, {"DDOR", 3},
+    {"DDOS", 3}, {"DDPL", 3}, {"DDSA", 3}, {"DDST", 3}, {"DEAW", 3}, {"DECM", 3},
+    {"DEDG", 3}, {"DEEA", 3}, {"DEED", 3}, {"DEEI", 3}, {"DEFV", 3}, {"DEGN", 3},
+    {"DEGO", 3}, {"DEHA", 3}, {"DEHI", 3}, {"DEIH", 3}, {"DEKE", 3}, {"DELC", 3},
+    {"DELK", 3}, {"DEMI", 3}, {"DEPN", 3}, {"DESD", 3}, {"DESK", 3}, {"DESM", 3},
+    {"DETW", 3}, {"DEXS", 3}, {"DFIB", 3}, {"DFLU", 3}, {"DFNA", 3}, {"DFPR", 3},
+    {"DFRA", 3}, {"DGEA", 3}, {"DGEB", 3}, {"DGNU", 3}, {"DGOT", 3}, {"DGTO", 3},
+    {"DHAN", 3}, {"DHID", 3}, {"DHTH", 3}, {"DHTM", 3}, {"DIAB", 3}, {"DIDS", 3},
+    {"DIFD", 3}, {"DIFG", 3}, {"DIFR", 3}, {"DIGN", 3}, {"DIRD", 3}, {"DIRF", 3},
+    {"DIXO", 3}, {"DJPG", 3}, {"DLAY", 3}, {"DLOW", 3}, {"DMAI", 3}, {"DMAS", 3},
+    {"DMER", 3}, {"DMID", 3}, {"DMOF", 3}, {"DMSW", 3}, {"DNAT", 3}, {"DNEV", 3},
+    {"DNIN", 3}, {"DNTD", 3}, {"DNTW", 3}, {"DOCC", 3}, {"DOCT", 3}, {"DODI", 3},
+    {"DOEA", 3}, {"DOHE", 3}, {"DOLI", 3}, {"DOND", 3}, {"DONS", 3}, {"DONU", 3},
+    {"DORF", 3}, {"DORV", 3}, {"DOSM", 3}, {"DOTA", 3}, {"DOTC", 3}, {"DOUP", 3},
+    {"DOUS", 3}, {"DOVA", 3}, {"DOWR", 3}, {"DPIE", 3}, {"DPTH", 3}, {"DPTW", 3},
+    {"DPWD", 3}, {"DRIE", 3}, {"DROO", 3}, {"DRYA", 3}, {"DSAC", 3}, {"DSAV", 3},
+    {"DSBA", 3}, {"DSGR", 3}, {"DSIG", 3}, {"DSLA", 3}, {"DSMI", 3}, {"DSOS", 3},
+    {"DSPU", 3}, {"DSSA", 3}, {"DSSU", 3}, {"DSTE", 3}, {"DSTU", 3}, {"DSUD", 3},
+    {"DSVA", 3}, {"DTAG", 3}, {"DTAN", 3}, {"DTHD", 3}, {"DTHY", 3}, {"DTOQ", 3},
+    {"DTRO", 3}, {"DTUE", 3}, {"DULC", 3}, {"DUMB", 3}, {"DUMH", 3}, {"DUTC", 3},
+    {"DVIV", 3}, {"DWRO", 3}, {"DYAR", 3}, {"DYEN", 3}, {"DYES", 3}, {"DYLO", 3},
+    {"DYME", 3}, {"DYPR", 3}, {"EAAA", 3}, {"EACP", 3}, {"EACR", 3}, {"EAEN", 3},
+    {"EAFA", 3}, {"EAFG", 3}, {"EAGB", 3}, {"EAGU", 3}, {"EAIF", 3}, {"EAKB", 3},
+    {"EAKH", 3}, {"EAKP", 3}, {"EALB", 3}, {"EAMP", 3}, {"EAMW", 3}, {"EANB", 3},
+    {"EANM", 3}, {"EASN", 3}, {"EATC", 3}, {"EAYS", 3}, {"EBCO", 3}, {"EBED", 3},
+    {"EBEP", 3}, {"EBIE", 3}, {"EBLE", 3}, {"EBMA", 3}, {"EBOF", 3}, {"EBOL", 3},
+    {"EBSE", 3}, {"EBUI", 3}, {"EBWI", 3}, {"EBYF", 3}, {"EBYH", 3}, {"EBYN", 3},
+    {"ECCH", 3}, {"ECDT", 3}, {"ECEC", 3}, {"ECFI", 3}, {"ECHI", 3}, {"ECKC", 3},
+    {"ECKP", 3}, {"ECLU", 3}, {"ECNE", 3}, {"ECRI", 3}, {"ECRK", 3}, {"ECRT", 3},
+    {"ECST", 3}, {"ECUM", 3}, {"ECYO", 3}, {"EDAI", 3}, {"EDAK", 3}, {"EDCL", 3},
+    {"EDCR", 3}, {"EDCT", 3}, {"EDCU", 3}, {"EDDA", 3}, {"EDDU", 3}, {"EDEB", 3},
+    {"EDEO", 3}, {"EDFT", 3}, {"EDGD", 3}, {"EDHT", 3}, {"EDOO", 3}, {"EDOS", 3},
+    {"EDSL", 3}, {"EDUE", 3}, {"EDWR", 3}, {"EEAF", 3}, {"EEDR", 3}, {"EEFL", 3},
+    {"EEFU", 3}, {"EEGE", 3}, {"EEHO", 3}, {"EEKB", 3}, {"EEKX", 3}, {"EEMB", 3},
+    {"EENN", 3}, {"EEPL", 3}, {"EEPM", 3}, {"EEPW", 3}, {"EERS", 3}, {"EESU", 3},
+    {"EETE", 3}, {"EETS", 3}, {"EETX", 3}, {"EEUN", 3}, {"EEUP", 3}, {"EEWO", 3},
+    {"EFAM", 3}, {"EFBE", 3}, {"EFFI", 3}, {"EFFL", 3}, {"EFGH", 3}, {"EFGR", 3},
+    {"EFIV", 3}, {"EFMA", 3}, {"EFNA", 3}, {"EFNO", 3}, {"EFTK", 3}, {"EFTR", 3},
+    {"EFTZ", 3}, {"EFVI", 3}, {"EGCT", 3}, {"EGEX", 3}, {"EGFI", 3}, {"EGGG", 3},
+    {"EGIA", 3}, {"EGIT", 3}, {"EGNA", 3}, {"EGNO", 3}, {"EGOT", 3}, {"EGQI", 3},
+    {"EGQO", 3}, {"EGRC", 3}, {"EGSO", 3}, {"EGTH", 3}, {"EGUN", 3}, {"EGZI", 3},
+    {"EHAP", 3}, {"EHAT", 3}, {"EHEC", 3}, {"EHIM", 3}, {"EHOS", 3}, {"EICT", 3},
+    {"EIFE", 3}, {"EIFH", 3}, {"EIFL", 3}, {"EIFS", 3}, {"EIKN", 3}, {"EIME", 3},
+    {"EIOB", 3}, {"EISQ", 3}, {"EISY", 3}, {"EITK", 3}, {"EITV", 3}, {"EJPR", 3},
+    {"EJUL", 3}, {"EJUR", 3}, {"EKDA", 3}, {"EKLG", 3}, {"EKPH", 3}, {"EKTA", 3},
+    {"EKUX", 3}, {"ELDC", 3}, {"ELDE", 3}, {"ELFD", 3}, {"ELFE", 3}, {"ELFH", 3},
+    {"ELFP", 3}, {"ELHI", 3}, {"ELKE", 3}, {"ELLK", 3}, {"ELLY", 3}, {"ELMA", 3},
+    {"ELOT", 3}, {"ELSD", 3}, {"ELSG", 3}, {"ELSM", 3}, {"EMAJ", 3}, {"EMCT", 3},
+    {"EMHO", 3}, {"EMIM", 3}, {"EMKD", 3}, {"EMKV", 3}, {"EMOB", 3}, {"EMOI", 3},
+    {"EMRA", 3}, {"EMSM", 3}, {"EMTI", 3}, {"EMUN", 3}, {"EMYL", 3}, {"ENCU", 3},
+    {"ENEG", 3}, {"ENFE", 3}, {"ENFU", 3}, {"ENGE", 3}, {"ENHU", 3}, {"ENIA", 3},
+    {"ENID", 3}, {"ENIR", 3}, {"ENIV", 3}, {"ENJU", 3}, {"ENNY", 3}, {"ENPI", 3},
+    {"ENSQ", 3}, {"ENUW", 3}, {"ENVA", 3}, {"EOCT", 3}, {"EODD", 3}, {"EOGR", 3},
+    {"EOMI", 3}, {"EONI", 3}, {"EONS", 3}, {"EONW", 3}, {"EPAN", 3}, {"EPAY", 3},
+    {"EPBL", 3}, {"EPLE", 3}, {"EPME", 3}, {"EPNG", 3}, {"EPPU", 3}, {"EPSF", 3},
+    {"EPSW", 3}, {"EPUS", 3}, {"EPYT", 3}, {"ERCC", 3}, {"ERDD", 3}, {"ERDM", 3},
+    {"ERDU", 3}, {"ERFF", 3}, {"ERIP", 3}, {"ERLF", 3}, {"ERMC", 3}, {"ERMF", 3},
+    {"ERMX", 3}, {"ERNB", 3}, {"ERNH", 3}, {"ERNR", 3}, {"EROV", 3}, {"ERPI", 3},
+    {"ERSQ", 3}, {"ERTB", 3}, {"ERTX", 3}, {"ERXS", 3}, {"ERXX", 3}, {"ERYQ", 3},
+    {"ERYV", 3}, {"ESAA", 3}, {"ESAE", 3}, {"ESBC", 3}, {"ESBO", 3}, {"ESDR", 3},
+    {"ESDU", 3}, {"ESEU", 3}, {"ESFU", 3}, {"ESHU", 3}, {"ESIO", 3}, {"ESKN", 3},
+    {"ESLY", 3}, {"ESMD", 3}, {"ESNA", 3}, {"ESNU", 3}, {"ESOG", 3}, {"ESPU", 3},
+    {"ESVE", 3}, {"ESWP", 3}, {"ESXY", 3}, {"ETBR", 3}, {"ETCC", 3}, {"ETCD", 3},
+    {"ETCE", 3}, {"ETCS", 3}, {"ETEH", 3}, {"ETFL", 3}, {"ETFX", 3}, {"ETGR", 3},
+    {"ETHL", 3}, {"ETHW", 3}, {"ETID", 3}, {"ETKE", 3}, {"ETNE", 3}, {"ETOK", 3},
+    {"ETPE", 3}, {"ETSK", 3}, {"ETSP", 3}, {"ETSQ", 3}, {"ETSR", 3}, {"ETTR", 3},
+    {"ETTW", 3}, {"ETUB", 3}, {"ETVA", 3}, {"EUAR", 3}, {"EUNN", 3}, {"EUNP", 3},
+    {"EUSA", 3}, {"EVEH", 3}, {"EVEI", 3}, {"EVIN", 3}, {"EWAU", 3}, {"EWBY", 3},
+    {"EWDW", 3}, {"EWEC", 3}, {"EWEU", 3}, {"EWNI", 3}, {"EWSA", 3}, {"EWSH", 3},
+    {"EWSI", 3}, {"EWSM", 3}, {"EWSO", 3}, {"EWWO", 3}, {"EWYO", 3}, {"EXAR", 3},
+    {"EXGR", 3}, {"EXLE", 3}, {"EXPI", 3}, {"EYAD", 3}, {"EYAS", 3}, {"EYCR", 3},
+    {"EYEX", 3}, {"EYNE", 3}, {"EYPA", 3}, {"EYSP", 3}, {"EYUS", 3}, {"EYYO", 3},
+    {"EZER", 3}, {"EZOT", 3}, {"FABE", 3}, {"FAFR", 3}, {"FAGR", 3}, {"FAHI", 3},
+    {"FAMU", 3}, {"FARD", 3}, {"FARW", 3}, {"FASY", 3}, {"FAUS", 3}, {"FBAC", 3},
+    {"FBAR", 3}, {"FBEA", 3}, {"FBET", 3}, {"FBIT", 3}, {"FBLA", 3}, {"FBLO", 3},
+    {"FBRO", 3}, {"FBUS", 3}, {"FCAM", 3}, {"FCCO", 3}, {"FCHO", 3}, {"FCOR", 3},
+    {"FCTR", 3}, {"FDES", 3}, {"FDOC", 3}, {"FEBR", 3}, {"FEME", 3}, {"FENT", 3},
+    {"FERG", 3}, {"FEWG", 3}, {"FEWH", 3}, {"FFAL", 3}, {"FFBI", 3}, {"FFDO", 3},
+    {"FFEE", 3}, {"FFIF", 3}, {"FFOP", 3}, {"FFVA", 3}, {"FFWH", 3}, {"FGFO", 3},
+    {"FGOD", 3}, {"FHEO", 3}, {"FICN", 3}, {"FIEL", 3}, {"FIFC", 3}, {"FIGC", 3},
+    {"FIGN", 3}, {"FILI", 3}, {"FIMA", 3}, {"FINO", 3}, {"FISA", 3}, {"FISD", 3},
+    {"FISM", 3}, {"FITL", 3}, {"FITM", 3}, {"FIXC", 3}, {"FIXS", 3}, {"FJUP", 3},
+    {"FKNO", 3}, {"FLAW", 3}, {"FLET", 3}, {"FLIE", 3}, {"FLUE", 3}, {"FLUV", 3},
+    {"FMEN", 3}, {"FMYO", 3}, {"FNRG", 3}, {"FOAB", 3}, {"FOFA", 3}, {"FOFO", 3},
+    {"FOFW", 3}, {"FOFY", 3}, {"FOGO", 3}, {"FOOI", 3}, {"FOOP", 3}, {"FOOV", 3},
+    {"FORK", 3}, {"FORX", 3}, {"FOVI", 3}, {"FPAC", 3}, {"FPEE", 3}, {"FPHY", 3},
+    {"FPIX", 3}, {"FPOR", 3}, {"FPUT", 3}, {"FREG", 3}, {"FREP", 3}, {"FSEA", 3},
+    {"FSEE", 3}, {"FSHE", 3}, {"FSHO", 3}, {"FSIL", 3}, {"FSLE", 3}, {"FSUI", 3},
+    {"FTEE", 3}, {"FTHD", 3}, {"FTHU", 3}, {"FTIS", 3}, {"FTOA", 3}, {"FTOB", 3},
+    {"FTOG", 3}, {"FTPF", 3}, {"FTPR", 3}, {"FTUP", 3}, {"FULS", 3}, {"FURI", 3},
+    {"FUSR", 3}, {"FVAL", 3}, {"FWES", 3}, {"FXYZ", 3}, {"FYAF", 3}, {"FYDI", 3},
+    {"FYON", 3}, {"GABU", 3}, {"GACD", 3}, {"GACP", 3}, {"GACR", 3}, {"GADI", 3},
+    {"GAFO", 3}, {"GAGR", 3}, {"GALF", 3}, {"GAMO", 3}, {"GANU", 3}, {"GAPT", 3},
+    {"GAPU", 3}, {"GARI", 3}, {"GASL", 3}, {"GASM", 3}, {"GASN", 3}, {"GAWI", 3},
+    {"GBLU", 3}, {"GBRE", 3}, {"GBUF", 3}, {"GBYP", 3}, {"GCRE", 3}, {"GCUR", 3},
+    {"GDEN", 3}, {"GDES", 3}, {"GDEV", 3}, {"GDIV", 3}, {"GDOT", 3}, {"GDRI", 3},
+    {"GEAD", 3}, {"GEAM", 3}, {"GECY", 3}, {"GEDU", 3}, {"GEFE", 3}, {"GEFF", 3},
+    {"GEGO", 3}, {"GEHO", 3}, {"GENA", 3}, {"GEOC", 3}, {"GEOG", 3}, {"GEOM", 3},
+    {"GERM", 3}, {"GERN", 3}, {"GESG", 3}, {"GESQ", 3}, {"GETJ", 3}, {"GEUP", 3},
+    {"GEXI", 3}, {"GFAI", 3}, {"GFIG", 3}, {"GFIT", 3}, {"GFOU", 3}, {"GGGH", 3},
+    {"GGTO", 3}, {"GHAC", 3}, {"GHAF", 3}, {"GHAV", 3}, {"GHEA", 3}, {"GHGO", 3},
+    {"GHOM", 3}, {"GHOT", 3}, {"GHST", 3}, {"GHTZ", 3}, {"GHVI", 3}, {"GHYP", 3},
+    {"GIHA", 3}, {"GISC", 3}, {"GISE", 3}, {"GISO", 3}, {"GISS", 3}, {"GITB", 3},
+    {"GITC", 3}, {"GKNO", 3}, {"GLEF", 3}, {"GLIB", 3}, {"GLOO", 3}, {"GLYD", 3},
+    {"GLYL", 3}, {"GLYS", 3}, {"GMAY", 3}, {"GMOU", 3}, {"GMSG", 3}, {"GNEA", 3},
+    {"GNIS", 3}, {"GNMA", 3}, {"GNON", 3}, {"GNST", 3}, {"GNUN", 3}, {"GODH", 3},
+    {"GOFD", 3}, {"GOFI", 3}, {"GONB", 3}, {"GONC", 3}, {"GONF", 3}, {"GONY", 3},
+    {"GOOR", 3}, {"GORA", 3}, {"GORF", 3}, {"GORG", 3}, {"GORI", 3}, {"GOWH", 3},
+    {"GPAG", 3}, {"GPLP", 3}, {"GPOS", 3}, {"GPOU", 3}, {"GQOP", 3}, {"GQTH", 3},
+    {"GRAR", 3}, {"GREC", 3}, {"GSAD", 3}, {"GSKE", 3}, {"GSLE", 3}, {"GSLI", 3},
+    {"GSLO", 3}, {"GSMY", 3}, {"GSPL", 3}, {"GSTI", 3}, {"GSTT", 3}, {"GSVI", 3},
+    {"GSWO", 3}, {"GTAK", 3}, {"GTES", 3}, {"GTIN", 3}, {"GTOV", 3}, {"GUIG", 3},
+    {"GULU", 3}, {"GURA", 3}, {"GVIO", 3}, {"GWAY", 3}, {"GWOU", 3}, {"GXCF", 3},
+    {"HABU", 3}, {"HACC", 3}, {"HACH", 3}, {"HACT", 3}, {"HADR", 3}, {"HAFE", 3},
+    {"HAHE", 3}, {"HAKI", 3}, {"HAMI", 3}, {"HAPU", 3}, {"HASK", 3}, {"HASR", 3},
+    {"HAUG", 3}, {"HAUT", 3}, {"HBEA", 3}, {"HBIG", 3}, {"HBIN", 3}, {"HBOR", 3},
+    {"HBUF", 3}, {"HBYC", 3}, {"HCAR", 3}, {"HCFI", 3}, {"HCIC", 3}, {"HCRI", 3},
+    {"HDAT", 3}, {"HDBY", 3}, {"HDEP", 3}, {"HDIV", 3}, {"HDMA", 3}, {"HDRA", 3},
+    {"HDUN", 3}, {"HEAQ", 3}, {"HECF", 3}, {"HEFC", 3}, {"HEGT", 3}, {"HEGZ", 3},
+    {"HEHJ", 3}, {"HEII", 3}, {"HEKI", 3}, {"HEMK", 3}, {"HENJ", 3}, {"HENQ", 3},
+    {"HEOA", 3}, {"HEOV", 3}, {"HEVO", 3}, {"HEXH", 3}, {"HEYL", 3}, {"HEYU", 3},
+    {"HEZI", 3}, {"HFAR", 3}, {"HFIN", 3}, {"HFIR", 3}, {"HGLO", 3}, {"HGOE", 3},
+    {"HHAR", 3}, {"HHIG", 3}, {"HHYP", 3}, {"HIFA", 3}, {"HIMP", 3}, {"HIPR", 3},
+    {"HIPS", 3}, {"HIPW", 3}, {"HITP", 3}, {"HLAN", 3}, {"HLIS", 3}, {"HLIT", 3},
+    {"HLOO", 3}, {"HLYC", 3}, {"HMOS", 3}, {"HMUL", 3}, {"HMYN", 3}, {"HNAM", 3},
+    {"HNES", 3}, {"HNEX", 3}, {"HNOI", 3}, {"HNSO", 3}, {"HOAR", 3}, {"HOBJ", 3},
+    {"HOBU", 3}, {"HODA", 3}, {"HODF", 3}, {"HODW", 3}, {"HOFE", 3}, {"HOGM", 3},
+    {"HOOK", 3}, {"HOPL", 3}, {"HOPO", 3}, {"HORM", 3}, {"HOTO", 3}, {"HOWB", 3},
+    {"HPEN", 3}, {"HPLU", 3}, {"HQUE", 3}, {"HRAN", 3}, {"HREM", 3}, {"HRUN", 3},
+    {"HSCA", 3}, {"HSER", 3}, {"HSIX", 3}, {"HSIZ", 3}, {"HSOA", 3}, {"HSOL", 3},
+    {"HSOO", 3}, {"HSSE", 3}, {"HSUL", 3}, {"HTBA", 3}, {"HTEE", 3}, {"HTIF", 3},
+    {"HTIR", 3}, {"HTOD", 3}, {"HTSS", 3}, {"HTUS", 3}, {"HTVE", 3}, {"HURA", 3},
+    {"HURB", 3}, {"HURI", 3}, {"HURP", 3}, {"HUSK", 3}, {"HUSV", 3}, {"HUTT", 3},
+    {"HVAN", 3}, {"HVAP", 3}, {"HWHA", 3}, {"HWHO", 3}, {"HWID", 3}, {"HWRI", 3},
+    {"HXCO", 3}, {"HXTH", 3}, {"HYYO", 3}, {"IAAS", 3}, {"IACO", 3}, {"IADD", 3},
+    {"IAFT", 3}, {"IALY", 3}, {"IAMN", 3}, {"IARE", 3}, {"IARW", 3}, {"IBEA", 3},
+    {"ICDE", 3}, {"ICEH", 3}, {"ICEQ", 3}, {"ICIZ", 3}, {"ICKD", 3}, {"ICNA", 3},
+    {"ICPO", 3}, {"ICRE", 3}, {"ICSF", 3}, {"ICTA", 3}, {"ICTS", 3}, {"ICTW", 3},
+    {"IDAP", 3}, {"IDAS", 3}, {"IDEX", 3}, {"IDFR", 3}, {"IDIF", 3}, {"IDNE", 3},
+    {"IDPE", 3}, {"IDUS", 3}, {"IDVA", 3}, {"IDWA", 3}, {"IDWR", 3}, {"IDXC", 3},
+    {"IDXI", 3}, {"IEDD", 3}, {"IEDH", 3}, {"IEDN", 3}, {"IEDU", 3}, {"IEPR", 3},
+    {"IERB", 3}, {"IERC", 3}, {"IERF", 3}, {"IERN", 3}, {"IERO", 3}, {"IERR", 3},
+    {"IEWC", 3}, {"IEWG", 3}, {"IEWV", 3}, {"IFBU", 3}, {"IFEF", 3}, {"IFFS", 3},
+    {"IFFV", 3}, {"IFID", 3}, {"IFIL", 3}, {"IFIR", 3}, {"IFIS", 3}, {"IFIX", 3},
+    {"IFKN", 3}, {"IFRA", 3}, {"IFSL", 3}, {"IFSY", 3}, {"IFTO", 3}, {"IFTR", 3},
+    {"IFUN", 3}, {"IFWH", 3}, {"IFWR", 3}, {"IGAS", 3}, {"IGHA", 3}, {"IGIF", 3},
+    {"IGSO", 3}, {"IGUI", 3}, {"IIAN", 3}, {"IIIB", 3}, {"IIIF", 3}, {"IILE", 3},
+    {"IINC", 3}, {"IISE", 3}, {"IKAN", 3}, {"ILCO", 3}, {"ILFI", 3}, {"ILIA", 3},
+    {"ILIS", 3}, {"ILMA", 3}, {"ILNO", 3}, {"ILOL", 3}, {"ILSN", 3}, {"ILSU", 3},
+    {"ILSW", 3}, {"ILYK", 3}, {"ILYR", 3}, {"IMBE", 3}, {"IMBS", 3}, {"IMCL", 3},
+    {"IMCM", 3}, {"IMEG", 3}, {"IMFU", 3}, {"IMGE", 3}, {"IMGL", 3}, {"IMHE", 3},
+    {"IMLO", 3}, {"IMMK", 3}, {"IMRI", 3}, {"IMSH", 3}, {"IMSS", 3}, {"IMSU", 3},
+    {"IMTY", 3}, {"IMWE", 3}, {"INBL", 3}, {"INDD", 3}, {"INDL", 3}, {"INFT", 3},
+    {"INGX", 3}, {"INHA", 3}, {"INID", 3}, {"INII", 3}, {"INLA", 3}, {"INLP", 3},
+    {"INMU", 3}, {"INRG", 3}, {"INRV", 3}, {"INSL", 3}, {"INSQ", 3}, {"INTX", 3},
+    {"INTZ", 3}, {"INUX", 3}, {"INZE", 3}, {"IOHF", 3}, {"IOLD", 3}, {"IOLP", 3},
+    {"IONQ", 3}, {"IORD", 3}, {"IPDE", 3}, {"IPEN", 3}, {"IPSM", 3}, {"IPSO", 3},
+    {"IQUA", 3}, {"IRAB", 3}, {"IRDL", 3}, {"IRDR", 3}, {"IREB", 3}, {"IRGO", 3},
+    {"IRGR", 3}, {"IRHA", 3}, {"IRMB", 3}, {"IRNE", 3}, {"IRNO", 3}, {"IRSH", 3},
+    {"IRSM", 3}, {"IRSY", 3}, {"ISAK", 3}, {"ISDA", 3}, {"ISEW", 3}, {"ISHS", 3},
+    {"ISIC", 3}, {"ISKO", 3}, {"ISKS", 3}, {"ISKT", 3}, {"ISOK", 3}, {"ISOW", 3},
+    {"ISRO", 3}, {"ISTP", 3}, {"ISVU", 3}, {"ISYA", 3}, {"ITAK", 3}, {"ITAV", 3},
+    {"ITBI", 3}, {"ITFF", 3}, {"ITGL", 3}, {"ITGN", 3}, {"ITGR", 3}, {"ITHK", 3},
+    {"ITKN", 3}, {"ITMY", 3}, {"ITOD", 3}, {"ITOP", 3}, {"ITQU", 3}, {"ITRY", 3},
+    {"ITSG", 3}, {"ITUR", 3}, {"ITWR", 3}, {"IUMR", 3}, {"IUMU", 3}, {"IUND", 3},
+    {"IUNM", 3}, {"IUSA", 3}, {"IUSI", 3}, {"IUSO", 3}, {"IUSR", 3}, {"IVIA", 3},
+    {"IWHI", 3}, {"IWIL", 3}, {"IXAR", 3}, {"IXCO", 3}, {"IXDO", 3}, {"IXIS", 3},
+    {"IXON", 3}, {"IXRE", 3}, {"IXTO", 3}, {"IXWH", 3}, {"IZEW", 3}, {"IZTH", 3},
+    {"JACK", 3}, {"JKLK", 3}, {"JOBG", 3}, {"JORA", 3}, {"JPGO", 3}, {"JPRE", 3},
+    {"JTHI", 3}, {"JUDI", 3}, {"JULV", 3}, {"JYOU", 3}, {"KABG", 3}, {"KABO", 3},
+    {"KAIN", 3}, {"KALL", 3}, {"KANO", 3}, {"KANY", 3}, {"KAPP", 3}, {"KBEN", 3},
+    {"KBLU", 3}, {"KBYT", 3}, {"KCHT", 3}, {"KCLO", 3}, {"KDAY", 3}, {"KDEA", 3},
+    {"KEAV", 3}, {"KEBR", 3}, {"KEDF", 3}, {"KEDN", 3}, {"KEDP", 3}, {"KEEF", 3},
+    {"KEGR", 3}, {"KEHO", 3}, {"KELA", 3}, {"KEMI", 3}, {"KEPL", 3}, {"KERB", 3},
+    {"KERU", 3}, {"KESH", 3}, {"KESN", 3}, {"KETY", 3}, {"KEXA", 3}, {"KEYU", 3},
+    {"KGOO", 3}, {"KGOV", 3}, {"KHEL", 3}, {"KIES", 3}, {"KIFC", 3}, {"KIFI", 3},
+    {"KIHA", 3}, {"KINF", 3}, {"KINV", 3}, {"KIPN", 3}, {"KIPS", 3}, {"KIPT", 3},
+    {"KISD", 3}, {"KISI", 3}, {"KISN", 3}, {"KITW", 3}, {"KLKE", 3}, {"KLOA", 3},
+    {"KLYA", 3}, {"KLYC", 3}, {"KLYU", 3}, {"KMOR", 3}, {"KNAM", 3}, {"KOFM", 3},
+    {"KONI", 3}, {"KONL", 3}, {"KORC", 3}, {"KORU", 3}, {"KPAR", 3}, {"KPLA", 3},
+    {"KPOS", 3}, {"KQRL", 3}, {"KREF", 3}, {"KREP", 3}, {"KREV", 3}, {"KSDI", 3},
+    {"KSEL", 3}, {"KSIM", 3}, {"KSIS", 3}, {"KSMA", 3}, {"KSOM", 3}, {"KSSE", 3},
+    {"KSTI", 3}, {"KSUP", 3}, {"KSVE", 3}, {"KSWA", 3}, {"KTAN", 3}, {"KTOB", 3},
+    {"KUNT", 3}, {"KUPE", 3}, {"KUPH", 3}, {"KUPI", 3}, {"KVES", 3}, {"KWER", 3},
+    {"KWHA", 3}, {"KWHY", 3}, {"KWIN", 3}, {"KWRI", 3}, {"KYCO", 3}, {"LADV", 3},
+    {"LAGF", 3}, {"LAMP", 3}, {"LAPS", 3}, {"LARW", 3}, {"LASC", 3}, {"LAVA", 3},
+    {"LBEW", 3}, {"LBIG", 3}, {"LBYD", 3}, {"LBYM", 3}, {"LCHR", 3}, {"LCHS", 3},
+    {"LCIN", 3}, {"LCLE", 3}, {"LCTE", 3}, {"LDAC", 3}, {"LDAF", 3}, {"LDAG", 3},
+    {"LDBU", 3}, {"LDEA", 3}, {"LDGI", 3}, {"LDNT", 3}, {"LDOF", 3}, {"LDOR", 3},
+    {"LDOS", 3}, {"LDSS", 3}, {"LDTY", 3}, {"LDWR", 3}, {"LEDL", 3}, {"LEDM", 3},
+    {"LEEI", 3}, {"LEFE", 3}, {"LEGS", 3}, {"LEHT", 3}, {"LEIC", 3}, {"LEIG", 3},
+    {"LEJU", 3}, {"LELB", 3}, {"LELL", 3}, {"LERB", 3}, {"LERK", 3}, {"LERR", 3},
+    {"LFAF", 3}, {"LFBE", 3}, {"LFEX", 3}, {"LFHO", 3}, {"LFIT", 3}, {"LFLA", 3},
+    {"LFPL", 3}, {"LFSO", 3}, {"LGLA", 3}, {"LGOB", 3}, {"LGTH", 3}, {"LHOW", 3},
+    {"LHYP", 3}, {"LIAR", 3}, {"LICH", 3}, {"LICP", 3}, {"LIDU", 3}, {"LIEN", 3},
+    {"LIFI", 3}, {"LIKI", 3}, {"LINW", 3}, {"LISI", 3}, {"LISN", 3}, {"LISO", 3},
+    {"LISP", 3}, {"LISS", 3}, {"LITD", 3}, {"LITM", 3}, {"LKAN", 3}, {"LKEE", 3},
+    {"LLAG", 3}, {"LLAV", 3}, {"LLBR", 3}, {"LLDT", 3}, {"LLFL", 3}, {"LLKI", 3},
+    {"LLMU", 3}, {"LMAD", 3}, {"LMUC", 3}, {"LMUS", 3}, {"LNAT", 3}, {"LOBF", 3},
+    {"LOBP", 3}, {"LOBS", 3}, {"LOCO", 3}, {"LOFL", 3}, {"LOFO", 3}, {"LOGA", 3},
+    {"LOGN", 3}, {"LOGO", 3}, {"LOLI", 3}, {"LONI", 3}, {"LONW", 3}, {"LORF", 3},
+    {"LOUT", 3}, {"LOWH", 3}, {"LOWU", 3}, {"LOWV", 3}, {"LOYO", 3}, {"LPAS", 3},
+    {"LPDI", 3}, {"LPFT", 3}, {"LPGR", 3}, {"LPIC", 3}, {"LPOF", 3}, {"LPOU", 3},
+    {"LPSO", 3}, {"LPST", 3}, {"LPTA", 3}, {"LPTE", 3}, {"LPWH", 3}, {"LRSM", 3},
+    {"LRUL", 3}, {"LSAL", 3}, {"LSAM", 3}, {"LSAV", 3}, {"LSCO", 3}, {"LSDI", 3},
+    {"LSEO", 3}, {"LSGE", 3}, {"LSIV", 3}, {"LSIZ", 3}, {"LSNO", 3}, {"LSSU", 3},
+    {"LSSY", 3}, {"LTEM", 3}, {"LTHU", 3}, {"LTMA", 3}, {"LTPE", 3}, {"LTRI", 3},
+    {"LTSE", 3}, {"LUMP", 3}, {"LUSC", 3}, {"LUSS", 3}, {"LUVI", 3}, {"LVAL", 3},
+    {"LVCT", 3}, {"LVEG", 3}, {"LVEI", 3}, {"LWAR", 3}, {"LWHA", 3}, {"LWHO", 3},
+    {"LWRO", 3}, {"LXCO", 3}, {"LYAM", 3}, {"LYBO", 3}, {"LYCR", 3}, {"LYDU", 3},
+    {"LYEI", 3}, {"LYEM", 3}, {"LYES", 3}, {"LYHI", 3}, {"LYID", 3}, {"LYLU", 3},
+    {"LYPO", 3}, {"LYRU", 3}, {"LYTU", 3}, {"LYVO", 3}, {"LYXY", 3}, {"MAAN", 3},
+    {"MACA", 3}, {"MACF", 3}, {"MACI", 3}, {"MAHI", 3}, {"MALE", 3}, {"MALP", 3},
+    {"MALU", 3}, {"MANG", 3}, {"MAPH", 3}, {"MAPW", 3}, {"MARB", 3}, {"MATM", 3},
+    {"MAVI", 3}, {"MAXL", 3}, {"MBBE", 3}, {"MBGB", 3}, {"MBIS", 3}, {"MBLO", 3},
+    {"MBOF", 3}, {"MBTH", 3}, {"MBWA", 3}, {"MBYA", 3}, {"MCAL", 3}, {"MCAP", 3},
+    {"MCAR", 3}, {"MCMD", 3}, {"MCOD", 3}, {"MCUR", 3}, {"MDET", 3}, {"MDEX", 3},
+    {"MDIV", 3}, {"MDON", 3}, {"MDOS", 3}, {"MDSA", 3}, {"MDUM", 3}, {"MDUR", 3},
+    {"MEAB", 3}, {"MEAD", 3}, {"MEAW", 3}, {"MEBL", 3}, {"MECI", 3}, {"MEDB", 3},
+    {"MEDU", 3}, {"MEFA", 3}, {"MEHI", 3}, {"MELS", 3}, {"MERD", 3}, {"MERR", 3},
+    {"MERY", 3}, {"MEUP", 3}, {"MEWE", 3}, {"MEXH", 3}, {"MEXI", 3}, {"MFTO", 3},
+    {"MGLO", 3}, {"MHAV", 3}, {"MHEL", 3}, {"MIDS", 3}, {"MIFC", 3}, {"MILI", 3},
+    {"MILY", 3}, {"MINM", 3}, {"MISB", 3}, {"MISP", 3}, {"MKEE", 3}, {"MLEG", 3},
+    {"MLFO", 3}, {"MLUS", 3}, {"MMKD", 3}, {"MMOU", 3}, {"MMSV", 3}, {"MNCO", 3},
+    {"MNIN", 3}, {"MNIS", 3}, {"MNST", 3}, {"MNTO", 3}, {"MOCO", 3}, {"MOFM", 3},
+    {"MORB", 3}, {"MORI", 3}, {"MORP", 3}, {"MOUT", 3}, {"MPBE", 3}, {"MPED", 3},
+    {"MPFU", 3}, {"MPHI", 3}, {"MPNO", 3}, {"MPOI", 3}, {"MPTA", 3}, {"MPVI", 3},
+    {"MRBO", 3}, {"MRCT", 3}, {"MSAU", 3}, {"MSFN", 3}, {"MSHI", 3}, {"MSIM", 3},
+    {"MSJU", 3}, {"MSRC", 3}, {"MSSH", 3}, {"MSUF", 3}, {"MSVN", 3}, {"MSWO", 3},
+    {"MTAN", 3}, {"MTAR", 3}, {"MTIN", 3}, {"MTRI", 3}, {"MTWH", 3}, {"MUMN", 3},
+    {"MUNL", 3}, {"MXTE", 3}, {"MYNA", 3}, {"MYTA", 3}, {"NAAB", 3}, {"NAAN", 3},
+    {"NADR", 3}, {"NAFR", 3}, {"NAPL", 3}, {"NART", 3}, {"NASG", 3}, {"NBEJ", 3},
+    {"NBEW", 3}, {"NBIT", 3}, {"NBLI", 3}, {"NBRI", 3}, {"NBRO", 3}, {"NBYM", 3},
+    {"NBYV", 3}, {"NCCC", 3}, {"NCCO", 3}, {"NCEJ", 3}, {"NCEX", 3}, {"NCHP", 3},
+    {"NCIF", 3}, {"NCIL", 3}, {"NCIS", 3}, {"NCPR", 3}, {"NCSO", 3}, {"NCSU", 3},
+    {"NCTS", 3}, {"NCTW", 3}, {"NCUS", 3}, {"NCVI", 3}, {"NCVO", 3}, {"NCVS", 3},
+    {"NCWH", 3}, {"NCYA", 3}, {"NCYO", 3}, {"NCYT", 3}, {"NDCF", 3}, {"NDDF", 3},
+    {"NDDU", 3}, {"NDDW", 3}, {"NDEQ", 3}, {"NDFB", 3}, {"NDGM", 3}, {"NDJT", 3},
+    {"NDLM", 3}, {"NDMY", 3}, {"NDOV", 3}, {"NDPI", 3}, {"NDQS", 3}, {"NDTS", 3},
+    {"NDTX", 3}, {"NDVS", 3}, {"NDXI", 3}, {"NDXS", 3}, {"NECC", 3}, {"NEDG", 3},
+    {"NEDN", 3}, {"NEHO", 3}, {"NEKE", 3}, {"NEKN", 3}, {"NEOP", 3}, {"NEOT", 3},
+    {"NEPE", 3}, {"NERD", 3}, {"NERP", 3}, {"NEWN", 3}, {"NEXY", 3}, {"NEYA", 3},
+    {"NEYT", 3}, {"NFAC", 3}, {"NFAR", 3}, {"NFEE", 3}, {"NFLU", 3}, {"NFOV", 3},
+    {"NFTH", 3}, {"NFTP", 3}, {"NFUR", 3}, {"NGAH", 3}, {"NGDA", 3}, {"NGDR", 3},
+    {"NGEH", 3}, {"NGFE", 3}, {"NGFL", 3}, {"NGGI", 3}, {"NGIH", 3}, {"NGKN", 3},
+    {"NGNU", 3}, {"NGOL", 3}, {"NGXC", 3}, {"NGXX", 3}, {"NGYE", 3}, {"NHEI", 3},
+    {"NHOM", 3}, {"NIAA", 3}, {"NIAL", 3}, {"NIAN", 3}, {"NICF", 3}, {"NIDI", 3},
+    {"NIDX", 3}, {"NIFK", 3}, {"NIGN", 3}, {"NINL", 3}, {"NITH", 3}, {"NIVI", 3},
+    {"NKEE", 3}, {"NKFO", 3}, {"NKNA", 3}, {"NKSF", 3}, {"NKSI", 3}, {"NLAN", 3},
+    {"NLAT", 3}, {"NLAY", 3}, {"NLOW", 3}, {"NLPR", 3}, {"NLTW", 3}, {"NLYG", 3},
+    {"NLYK", 3}, {"NLYP", 3}, {"NMAC", 3}, {"NMSD", 3}, {"NMUC", 3}, {"NMUL", 3},
+    {"NNOC", 3}, {"NNON", 3}, {"NNOV", 3}, {"NNVT", 3}, {"NOAD", 3}, {"NOCC", 3},
+    {"NODE", 3}, {"NOIL", 3}, {"NOIS", 3}, {"NOLE", 3}, {"NOMI", 3}, {"NONG", 3},
+    {"NONW", 3}, {"NOON", 3}, {"NOVI", 3}, {"NOWK", 3}, {"NOYE", 3}, {"NPOI", 3},
+    {"NRAR", 3}, {"NRCO", 3}, {"NREV", 3}, {"NRIS", 3}, {"NROW", 3}, {"NRSH", 3},
+    {"NSBL", 3}, {"NSMN", 3}, {"NSNR", 3}, {"NSOA", 3}, {"NSOS", 3}, {"NSTW", 3},
+    {"NSWR", 3}, {"NSXC", 3}, {"NSXS", 3}, {"NSXY", 3}, {"NSYS", 3}, {"NTAD", 3},
+    {"NTAW", 3}, {"NTCI", 3}, {"NTCR", 3}, {"NTDD", 3}, {"NTEV", 3}, {"NTFY", 3},
+    {"NTGI", 3}, {"NTHF", 3}, {"NTHP", 3}, {"NTHS", 3}, {"NTOK", 3}, {"NTOY", 3},
+    {"NTQA", 3}, {"NTTR", 3}, {"NTYI", 3}, {"NUAN", 3}, {"NUMS", 3}, {"NUNO", 3},
+    {"NUNU", 3}, {"NUPD", 3}, {"NUSP", 3}, {"NUSY", 3}, {"NUTR", 3}, {"NUWI", 3},
+    {"NVAP", 3}, {"NVIN", 3}, {"NWEA", 3}, {"NWEU", 3}, {"NWID", 3}, {"NXCO", 3},
+    {"NXIN", 3}, {"NXST", 3}, {"NYCA", 3}, {"NYFE", 3}, {"NYIE", 3}, {"NYIM", 3},
+    {"NYPU", 3}, {"NYSA", 3}, {"NYST", 3}, {"NZER", 3}, {"OABI", 3}, {"OACU", 3},
+    {"OADJ", 3}, {"OADL", 3}, {"OADO", 3}, {"OAFE", 3}, {"OAFO", 3}, {"OAFR", 3},
+    {"OAHA", 3}, {"OAMI", 3}, {"OATC", 3}, {"OATE", 3}, {"OATO", 3}, {"OAVE", 3},
+    {"OAVI", 3}, {"OAWI", 3}, {"OBEY", 3}, {"OBII", 3}, {"OBPA", 3}, {"OBTE", 3},
+    {"OBUB", 3}, {"OBYP", 3}, {"OBYS", 3}, {"OCFI", 3}, {"OCKB", 3}, {"OCKN", 3},
+    {"OCLA", 3}, {"OCLI", 3}, {"OCTV", 3}, {"ODAT", 3}, {"ODDE", 3}, {"ODDI", 3},
+    {"ODDN", 3}, {"ODEH", 3}, {"ODEJ", 3}, {"ODGE", 3}, {"ODGR", 3}, {"ODHA", 3},
+    {"ODNO", 3}, {"ODOE", 3}, {"ODOO", 3}, {"ODRA", 3}, {"ODSO", 3}, {"ODSP", 3},
+    {"ODYD", 3}, {"ODYF", 3}, {"OEAR", 3}, {"OEIG", 3}, {"OEOF", 3}, {"OESF", 3},
+    {"OESU", 3}, {"OESY", 3}, {"OFAJ", 3}, {"OFCC", 3}, {"OFCR", 3}, {"OFFB", 3},
+    {"OFFY", 3}, {"OFHU", 3}, {"OFIM", 3}, {"OFLU", 3}, {"OFNE", 3}, {"OFOC", 3},
+    {"OFOG", 3}, {"OFPI", 3}, {"OFWE", 3}, {"OGAR", 3}, {"OGER", 3}, {"OGGE", 3},
+    {"OGOH", 3}, {"OGOU", 3}, {"OGTH", 3}, {"OGWH", 3}, {"OHAP", 3}, {"OHOR", 3},
+    {"OHTM", 3}, {"OIDF", 3}, {"OIDW", 3}, {"OILA", 3}, {"OINL", 3}, {"OINN", 3},
+    {"OINO", 3}, {"OITL", 3}, {"OITM", 3}, {"OKBU", 3}, {"OKDE", 3}, {"OKGO", 3},
+    {"OKIF", 3}, {"OKIT", 3}, {"OKNI", 3}, {"OKSM", 3}, {"OKSS", 3}, {"OKWE", 3},
+    {"OKYO", 3}, {"OLDU", 3}, {"OLDY", 3}, {"OLEU", 3}, {"OLIU", 3}, {"OLIV", 3},
+    {"OLLF", 3}, {"OLLS", 3}, {"OLME", 3}, {"OLOV", 3}, {"OLPO", 3}, {"OLSH", 3},
+    {"OLSM", 3}, {"OLSO", 3}, {"OLST", 3}, {"OLUN", 3}, {"OMBB", 3}, {"OMBU", 3},
+    {"OMBY", 3}, {"OMCU", 3}, {"OMDE", 3}, {"OMEJ", 3}, {"OMEU", 3}, {"OMEY", 3},
+    {"OMFT", 3}, {"OMIF", 3}, {"OMIX", 3}, {"OMRU", 3}, {"OMSC", 3}, {"OMSP", 3},
+    {"OMTW", 3}, {"OMTY", 3}, {"ONDG", 3}, {"ONDV", 3}, {"ONFA", 3}, {"ONGD", 3},
+    {"ONGY", 3}, {"ONHI", 3}, {"ONIH", 3}, {"ONIM", 3}, {"ONIR", 3}, {"ONKF", 3},
+    {"ONND", 3}, {"ONOC", 3}, {"ONRU", 3}, {"ONSQ", 3}, {"ONTG", 3}, {"ONTY", 3},
+    {"ONUP", 3}, {"ONXC", 3}, {"ONYW", 3}, {"OOBV", 3}, {"OODC", 3}, {"OOFF", 3},
+    {"OOKG", 3}, {"OOLO", 3}, {"OOMF", 3}, {"OONC", 3}, {"OONH", 3}, {"OOPA", 3},
+    {"OOPO", 3}, {"OOPP", 3}, {"OORS", 3}, {"OOTN", 3}, {"OOUR", 3}, {"OOVO", 3},
+    {"OOYO", 3}, {"OPAD", 3}, {"OPAF", 3}, {"OPAZ", 3}, {"OPDI", 3}, {"OPDO", 3},
+    {"OPEF", 3}, {"OPIF", 3}, {"OPIV", 3}, {"OPOI", 3}, {"OPVT", 3}, {"OPYS", 3},
+    {"OPYV", 3}, {"OPYY", 3}, {"OQSO", 3}, {"ORCF", 3}, {"ORCS", 3}, {"ORGM", 3},
+    {"ORGP", 3}, {"ORGU", 3}, {"ORHU", 3}, {"ORJA", 3}, {"ORJU", 3}, {"ORNU", 3},
+    {"ORSG", 3}, {"ORSN", 3}, {"ORTV", 3}, {"ORUT", 3}, {"OSEG", 3}, {"OSPI", 3},
+    {"OSSA", 3}, {"OSSR", 3}, {"OSTM", 3}, {"OSUI", 3}, {"OTEO", 3}, {"OTEY", 3},
+    {"OTGI", 3}, {"OTHF", 3}, {"OTHM", 3}, {"OTID", 3}, {"OTKE", 3}, {"OTMI", 3},
+    {"OTOE", 3}, {"OTOM", 3}, {"OTOW", 3}, {"OTQU", 3}, {"OTRO", 3}, {"OTSH", 3},
+    {"OUAP", 3}, {"OUGR", 3}, {"OUHE", 3}, {"OUHO", 3}, {"OUNM", 3}, {"OUPP", 3},
+    {"OUSY", 3}, {"OVAN", 3}, {"OVEV", 3}, {"OVOL", 3}, {"OWAC", 3}, {"OWBA", 3},
+    {"OWCR", 3}, {"OWEA", 3}, {"OWFA", 3}, {"OWFE", 3}, {"OWFL", 3}, {"OWGN", 3},
+    {"OWGP", 3}, {"OWIP", 3}, {"OWNH", 3}, {"OWNK", 3}, {"OWNY", 3}, {"OWOB", 3},
+    {"OWWO", 3}, {"OWWR", 3}, {"OWZH", 3}, {"OWZL", 3}, {"OYIN", 3}, {"OYLE", 3},
+    {"PABI", 3}, {"PADD", 3}, {"PAMS", 3}, {"PASE", 3}, {"PAUS", 3}, {"PBLU", 3},
+    {"PBST", 3}, {"PCHA", 3}, {"PCLE", 3}, {"PCOU", 3}, {"PDAN", 3}, {"PDEF", 3},
+    {"PDFD", 3}, {"PDFP", 3}, {"PDIS", 3}, {"PEAF", 3}, {"PEAH", 3}, {"PEFI", 3},
+    {"PEGC", 3}, {"PEGQ", 3}, {"PEHE", 3}, {"PELI", 3}, {"PEMP", 3}, {"PENN", 3},
+    {"PERN", 3}, {"PERR", 3}, {"PESB", 3}, {"PESF", 3}, {"PESM", 3}, {"PESP", 3},
+    {"PETA", 3}, {"PETI", 3}, {"PETR", 3}, {"PETY", 3}, {"PEXP", 3}, {"PFOI", 3},
+    {"PFRO", 3}, {"PFUR", 3}, {"PGOP", 3}, {"PHDI", 3}, {"PHEB", 3}, {"PHIR", 3},
+    {"PHIS", 3}, {"PHSH", 3}, {"PHST", 3}, {"PHTH", 3}, {"PHYA", 3}, {"PHYW", 3},
+    {"PIER", 3}, {"PIFT", 3}, {"PIII", 3}, {"PIIT", 3}, {"PISI", 3}, {"PITH", 3},
+    {"PLOA", 3}, {"PLPR", 3}, {"PLUM", 3}, {"PLYF", 3}, {"PLYL", 3}, {"PLYS", 3},
+    {"PLYU", 3}, {"PNET", 3}, {"PNGX", 3}, {"PNON", 3}, {"PNOT", 3}, {"PNOW", 3},
+    {"PODV", 3}, {"POFF", 3}, {"PONC", 3}, {"PONF", 3}, {"POSF", 3}, {"POTE", 3},
+    {"PREG", 3}, {"PROS", 3}, {"PRUD", 3}, {"PSBA", 3}, {"PSME", 3}, {"PSNO", 3},
+    {"PSON", 3}, {"PSOT", 3}, {"PSOV", 3}, {"PSUM", 3}, {"PSVI", 3}, {"PSWI", 3},
+    {"PTBE", 3}, {"PTDI", 3}, {"PTFU", 3}, {"PTGE", 3}, {"PTHS", 3}, {"PTLA", 3},
+    {"PTLI", 3}, {"PTNE", 3}, {"PTOC", 3}, {"PTOO", 3}, {"PTOU", 3}, {"PTSS", 3},
+    {"PTSV", 3}, {"PTWE", 3}, {"PTWO", 3}, {"PTYT", 3}, {"PUBV", 3}, {"PUPG", 3},
+    {"PUSR", 3}, {"PUTG", 3}, {"PUTU", 3}, {"PUTW", 3}, {"PVIS", 3}, {"PVTH", 3},
+    {"PWAS", 3}, {"PWDE", 3}, {"PXIF", 3}, {"PXPA", 3}, {"PYAC", 3}, {"PYIF", 3},
+    {"PYME", 3}, {"PYRE", 3}, {"PYYO", 3}, {"QFRO", 3}, {"QNGQ", 3}, {"QOPE", 3},
+    {"QRLO", 3}, {"QTHI", 3}, {"QUER", 3}, {"RACQ", 3}, {"RAMG", 3}, {"RAPT", 3},
+    {"RARA", 3}, {"RASK", 3}, {"RATR", 3}, {"RATS", 3}, {"RATU", 3}, {"RAWM", 3},
+    {"RAYE", 3}, {"RBAR", 3}, {"RBAS", 3}, {"RBEG", 3}, {"RBLE", 3}, {"RBOY", 3},
+    {"RBPR", 3}, {"RBUL", 3}, {"RBYL", 3}, {"RBYO", 3}, {"RBYU", 3}, {"RCAL", 3},
+    {"RCCO", 3}, {"RCFO", 3}, {"RCHM", 3}, {"RCOA", 3}, {"RCOH", 3}, {"RCRA", 3},
+    {"RCSA", 3}, {"RCSI", 3}, {"RDAP", 3}, {"RDAY", 3}, {"RDBA", 3}, {"RDBL", 3},
+    {"RDBR", 3}, {"RDBU", 3}, {"RDHA", 3}, {"RDOA", 3}, {"RDOI", 3}, {"RDSN", 3},
+    {"RDSR", 3}, {"RDTE", 3}, {"RDUP", 3}, {"RDVI", 3}, {"RDXS", 3}, {"RDXT", 3},
+    {"REAO", 3}, {"REBI", 3}, {"REGH", 3}, {"REHT", 3}, {"RERS", 3}, {"RETC", 3},
+    {"REVB", 3}, {"REVS", 3}, {"REVT", 3}, {"REWV", 3}, {"REXT", 3}, {"REXY", 3},
+    {"REYW", 3}, {"RFAV", 3}, {"RFEW", 3}, {"RFLA", 3}, {"RFRI", 3}, {"RGEU", 3},
+    {"RGEY", 3}, {"RGIS", 3}, {"RGNM", 3}, {"RGPU", 3}, {"RGSD", 3}, {"RGSF", 3},
+    {"RGSK", 3}, {"RGSN", 3}, {"RHAR", 3}, {"RHIG", 3}, {"RHON", 3}, {"RHOU", 3},
+    {"RHUM", 3}, {"RHYP", 3}, {"RIAG", 3}, {"RIER", 3}, {"RIFS", 3}, {"RIII", 3},
+    {"RIMB", 3}, {"RIRO", 3}, {"RISL", 3}, {"RITU", 3}, {"RIZI", 3}, {"RJOH", 3},
+    {"RJUS", 3}, {"RKCA", 3}, {"RKDO", 3}, {"RKII", 3}, {"RKIT", 3}, {"RKSN", 3},
+    {"RKWR", 3}, {"RLAP", 3}, {"RLBR", 3}, {"RLCI", 3}, {"RLCW", 3}, {"RLDB", 3},
+    {"RLFO", 3}, {"RLJU", 3}, {"RLNA", 3}, {"RLOF", 3}, {"RLOG", 3}, {"RLOY", 3},
+    {"RLPW", 3}, {"RLRT", 3}, {"RLTA", 3}, {"RLTC", 3}, {"RLTH", 3}, {"RLTO", 3},
+    {"RLVD", 3}, {"RLVI", 3}, {"RLVX", 3}, {"RLWL", 3}, {"RLYR", 3}, {"RMEX", 3},
+    {"RMPR", 3}, {"RMSF", 3}, {"RMXT", 3}, {"RNAS", 3}, {"RNAV", 3}, {"RNEE", 3},
+    {"RNEG", 3}, {"RNEN", 3}, {"RNME", 3}, {"RNNO", 3}, {"RNOA", 3}, {"RNOC", 3},
+    {"RNOL", 3}, {"RNOP", 3}, {"RNRE", 3}, {"RNSB", 3}, {"RNSF", 3}, {"RNSR", 3},
+    {"RNSY", 3}, {"ROCC", 3}, {"ROCT", 3}, {"ROFB", 3}, {"ROFM", 3}, {"ROFP", 3},
+    {"ROFU", 3}, {"ROLM", 3}, {"ROMQ", 3}, {"ROMU", 3}, {"RONB", 3}, {"RONP", 3},
+    {"ROPH", 3}, {"ROPW", 3}, {"ROSI", 3}, {"ROST", 3}, {"ROTX", 3}, {"ROWA", 3},
+    {"ROWH", 3}, {"ROWL", 3}, {"ROWT", 3}, {"ROWW", 3}, {"RPAC", 3}, {"RPEL", 3},
+    {"RPOW", 3}, {"RPRA", 3}, {"RRYC", 3}, {"RRYI", 3}, {"RSAM", 3}, {"RSAV", 3},
+    {"RSFU", 3}, {"RSIC", 3}, {"RSIV", 3}, {"RSMM", 3}, {"RSNU", 3}, {"RSOO", 3},
+    {"RSSG", 3}, {"RSSP", 3}, {"RSSQ", 3}, {"RSSY", 3}, {"RSUA", 3}, {"RSUF", 3},
+    {"RSUI", 3}, {"RTAF", 3}, {"RTDI", 3}, {"RTEA", 3}, {"RTEM", 3}, {"RTFA", 3},
+    {"RTFU", 3}, {"RTHW", 3}, {"RTJU", 3}, {"RTKE", 3}, {"RTLO", 3}, {"RTMP", 3},
+    {"RTNE", 3}, {"RTOJ", 3}, {"RTOK", 3}, {"RTOV", 3}, {"RTSG", 3}, {"RTSK", 3},
+    {"RTSL", 3}, {"RTUT", 3}, {"RTYE", 3}, {"RUEB", 3}, {"RUEC", 3}, {"RUEM", 3},
+    {"RUNO", 3}, {"RUPD", 3}, {"RUSC", 3}, {"RVAD", 3}, {"RVDT", 3}, {"RVEN", 3},
+    {"RWDI", 3}, {"RWES", 3}, {"RWET", 3}, {"RWID", 3}, {"RXXX", 3}, {"RYCH", 3},
+    {"RYCI", 3}, {"RYCR", 3}, {"RYEN", 3}, {"RYES", 3}, {"RYFL", 3}, {"RYIE", 3},
+    {"RYKE", 3}, {"RYMI", 3}, {"RYMK", 3}, {"RYNI", 3}, {"RYPU", 3}, {"RYQU", 3},
+    {"RYSY", 3}, {"RYTA", 3}, {"RYUP", 3}, {"RYVA", 3}, {"SABE", 3}, {"SABS", 3},
+    {"SACE", 3}, {"SACK", 3}, {"SAEA", 3}, {"SAKI", 3}, {"SAPT", 3}, {"SATD", 3},
+    {"SATK", 3}, {"SATP", 3}, {"SATS", 3}, {"SATU", 3}, {"SATY", 3}, {"SAUG", 3},
+    {"SBAR", 3}, {"SBCA", 3}, {"SBOL", 3}, {"SBOM", 3}, {"SBOU", 3}, {"SBOW", 3},
+    {"SCBA", 3}, {"SCBE", 3}, {"SCCH", 3}, {"SCFI", 3}, {"SCLI", 3}, {"SCLU", 3},
+    {"SCNO", 3}, {"SCTA", 3}, {"SDAR", 3}, {"SDBE", 3}, {"SDOM", 3}, {"SDUL", 3},
+    {"SEAE", 3}, {"SECE", 3}, {"SEEQ", 3}, {"SEEY", 3}, {"SEFE", 3}, {"SEGF", 3},
+    {"SEGM", 3}, {"SEGT", 3}, {"SEGV", 3}, {"SEIL", 3}, {"SEIP", 3}, {"SEKE", 3},
+    {"SEPH", 3}, {"SERF", 3}, {"SERU", 3}, {"SETK", 3}, {"SFAT", 3}, {"SFIF", 3},
+    {"SFUM", 3}, {"SFUT", 3}, {"SGOL", 3}, {"SGUI", 3}, {"SGVI", 3}, {"SHBU", 3},
+    {"SHDF", 3}, {"SHDL", 3}, {"SHDM", 3}, {"SHDO", 3}, {"SHDU", 3}, {"SHDW", 3},
+    {"SHFO", 3}, {"SHID", 3}, {"SHLE", 3}, {"SHMI", 3}, {"SHOO", 3}, {"SHSO", 3},
+    {"SHUN", 3}, {"SHYE", 3}, {"SICW", 3}, {"SIDN", 3}, {"SIES", 3}, {"SIFE", 3},
+    {"SIKN", 3}, {"SILM", 3}, {"SIOB", 3}, {"SIPR", 3}, {"SISJ", 3}, {"SIUS", 3},
+    {"SIXC", 3}, {"SIXD", 3}, {"SKED", 3}, {"SKEL", 3}, {"SKIE", 3}, {"SKIS", 3},
+    {"SKNQ", 3}, {"SKTO", 3}, {"SKVI", 3}, {"SLAI", 3}, {"SLAR", 3}, {"SLID", 3},
+    {"SLYU", 3}, {"SMCA", 3}, {"SMEC", 3}, {"SMFR", 3}, {"SMHE", 3}, {"SMMS", 3},
+    {"SMMU", 3}, {"SMOZ", 3}, {"SMSF", 3}, {"SMSL", 3}, {"SMSN", 3}, {"SMSU", 3},
+    {"SMUN", 3}, {"SMVE", 3}, {"SNAN", 3}, {"SNOL", 3}, {"SNRS", 3}, {"SNTE", 3},
+    {"SNTG", 3}, {"SNTL", 3}, {"SNTO", 3}, {"SNTP", 3}, {"SOAB", 3}, {"SOAR", 3},
+    {"SOBR", 3}, {"SOBT", 3}, {"SOBV", 3}, {"SODA", 3}, {"SOEA", 3}, {"SOFJ", 3},
+    {"SONY", 3}, {"SOOT", 3}, {"SOPP", 3}, {"SOQU", 3}, {"SORN", 3}, {"SORQ", 3},
+    {"SOTR", 3}, {"SOUP", 3}, {"SOVI", 3}, {"SOWE", 3}, {"SPTI", 3}, {"SQRL", 3},
+    {"SRCM", 3}, {"SRET", 3}, {"SSAK", 3}, {"SSAM", 3}, {"SSEQ", 3}, {"SSFI", 3},
+    {"SSGM", 3}, {"SSIA", 3}, {"SSLA", 3}, {"SSLU", 3}, {"SSME", 3}, {"SSOD", 3},
+    {"SSPH", 3}, {"SSPO", 3}, {"SSSE", 3}, {"SSSI", 3}, {"SSSP", 3}, {"SSVE", 3},
+    {"STAU", 3}, {"STFE", 3}, {"STFU", 3}, {"STGR", 3}, {"STIA", 3}, {"STIG", 3},
+    {"STMI", 3}, {"STRG", 3}, {"STSD", 3}, {"STSM", 3}, {"STSW", 3}, {"SUBE", 3},
+    {"SUBU", 3}, {"SUCS", 3}, {"SUNK", 3}, {"SUPI", 3}, {"SUTF", 3}, {"SVIZ", 3},
+    {"SVNN", 3}, {"SVOR", 3}, {"SWEC", 3}, {"SWED", 3}, {"SWEM", 3}, {"SWEP", 3},
+    {"SWET", 3}, {"SXST", 3}, {"SYAN", 3}, {"SYND", 3}, {"SYNS", 3}, {"TAAP", 3},
+    {"TABB", 3}, {"TABD", 3}, {"TADA", 3}, {"TADO", 3}, {"TAFO", 3}, {"TAGI", 3},
+    {"TAHE", 3}, {"TAIS", 3}, {"TALD", 3}, {"TALF", 3}, {"TAMU", 3}, {"TANH", 3},
+    {"TANM", 3}, {"TARN", 3}, {"TARU", 3}, {"TASD", 3}, {"TATQ", 3}, {"TATY", 3},
+    {"TAVI", 3}, {"TAWO", 3}, {"TAXD", 3}, {"TBDI", 3}, {"TBIN", 3}, {"TBOR", 3},
+    {"TBYH", 3}, {"TBYL", 3}, {"TCER", 3}, {"TCFO", 3}, {"TCHL", 3}, {"TCNO", 3},
+    {"TCWI", 3}, {"TDEA", 3}, {"TDEB", 3}, {"TDOA", 3}, {"TDOI", 3}, {"TECC", 3},
+    {"TEEA", 3}, {"TEEL", 3}, {"TEGE", 3}, {"TEGL", 3}, {"TEID", 3}, {"TEMH", 3},
+    {"TEMN", 3}, {"TENG", 3}, {"TENN", 3}, {"TENR", 3}, {"TEPE", 3}, {"TEPM", 3},
+    {"TEPY", 3}, {"TERQ", 3}, {"TESN", 3}, {"TESX", 3}, {"TETA", 3}, {"TETM", 3},
+    {"TETU", 3}, {"TFAC", 3}, {"TFEW", 3}, {"TFIX", 3}, {"TFOC", 3}, {"TFUT", 3},
+    {"TFXY", 3}, {"TFYE", 3}, {"TGAR", 3}, {"TGOD", 3}, {"TGOV", 3}, {"THCF", 3},
+    {"THFA", 3}, {"THFU", 3}, {"THGG", 3}, {"THGO", 3}, {"THGT", 3}, {"THGU", 3},
+    {"THJU", 3}, {"THLA", 3}, {"THLS", 3}, {"THLY", 3}, {"THMI", 3}, {"THMK", 3},
+    {"THMT", 3}, {"THNI", 3}, {"THNU", 3}, {"THOM", 3}, {"THPE", 3}, {"THQC", 3},
+    {"THRA", 3}, {"THSB", 3}, {"THSC", 3}, {"THSF", 3}, {"THUA", 3}, {"THWR", 3},
+    {"THXT", 3}, {"THZR", 3}, {"TIAB", 3}, {"TICT", 3}, {"TIDE", 3}, {"TIFU", 3},
+    {"TIIP", 3}, {"TILD", 3}, {"TILF", 3}, {"TILO", 3}, {"TIMI", 3}, {"TIOB", 3},
+    {"TIPS", 3}, {"TIWA", 3}, {"TJUD", 3}, {"TKAN", 3}, {"TLAY", 3}, {"TLEU", 3},
+    {"TLIQ", 3}, {"TLUC", 3}, {"TLYE", 3}, {"TLYY", 3}, {"TMLV", 3}, {"TMON", 3},
+    {"TMPN", 3}, {"TMPV", 3}, {"TMSW", 3}, {"TMUT", 3}, {"TNOB", 3}, {"TNOI", 3},
+    {"TOCI", 3}, {"TOEI", 3}, {"TOET", 3}, {"TOEV", 3}, {"TOIF", 3}, {"TOIS", 3},
+    {"TOJO", 3}, {"TOMC", 3}, {"TOOY", 3}, {"TOQS", 3}, {"TOUP", 3}, {"TPAC", 3},
+    {"TPAG", 3}, {"TPAI", 3}, {"TPAP", 3}, {"TPET", 3}, {"TPFT", 3}, {"TPON", 3},
+    {"TPQR", 3}, {"TQTH", 3}, {"TRAF", 3}, {"TRAW", 3}, {"TRCH", 3}, {"TREV", 3},
+    {"TRIP", 3}, {"TRIS", 3}, {"TRLJ", 3}, {"TROM", 3}, {"TROP", 3}, {"TROT", 3},
+    {"TRPA", 3}, {"TRWI", 3}, {"TRYS", 3}, {"TSEI", 3}, {"TSGL", 3}, {"TSGM", 3},
+    {"TSMI", 3}, {"TSNU", 3}, {"TSOB", 3}, {"TSOO", 3}, {"TSPH", 3}, {"TSPI", 3},
+    {"TSSM", 3}, {"TSTW", 3}, {"TTAN", 3}, {"TTIL", 3}, {"TTRE", 3}, {"TTRG", 3},
+    {"TTYN", 3}, {"TTYO", 3}, {"TTYW", 3}, {"TUEM", 3}, {"TUES", 3}, {"TUIT", 3},
+    {"TUMO", 3}, {"TUNM", 3}, {"TUSG", 3}, {"TVIE", 3}, {"TWAI", 3}, {"TWEF", 3},
+    {"TWEG", 3}, {"TWEI", 3}, {"TWOY", 3}, {"TWRO", 3}, {"TXAN", 3}, {"TXTH", 3},
+    {"TYAC", 3}, {"TYAL", 3}, {"TYCH", 3}, {"TYCL", 3}, {"TYNO", 3}, {"TYSA", 3},
+    {"TYSI", 3}, {"TYTY", 3}, {"TYUN", 3}, {"TYWE", 3}, {"UADI", 3}, {"UAIN", 3},
+    {"UANO", 3}, {"UAPE", 3}, {"UARG", 3}, {"UARI", 3}, {"UARY", 3}, {"UAST", 3},
+    {"UAVE", 3}, {"UAWO", 3}, {"UBBD", 3}, {"UBEG", 3}, {"UBES", 3}, {"UBEX", 3},
+    {"UBRI", 3}, {"UBSI", 3}, {"UBUN", 3}, {"UBVI", 3}, {"UBYA", 3}, {"UBYF", 3},
+    {"UCEM", 3}, {"UCEY", 3}, {"UCKY", 3}, {"UCLI", 3}, {"UCOP", 3}, {"UCSB", 3},
+    {"UDIC", 3}, {"UDSB", 3}, {"UDSO", 3}, {"UEAP", 3}, {"UEBI", 3}, {"UECA", 3},
+    {"UECR", 3}, {"UEDF", 3}, {"UENE", 3}, {"UENU", 3}, {"UEOU", 3}, {"UEPL", 3},
+    {"UEPO", 3}, {"UERI", 3}, {"UETY", 3}, {"UEVE", 3}, {"UEWE", 3}, {"UEXA", 3},
+    {"UFFT", 3}, {"UFNR", 3}, {"UFOL", 3}, {"UFWI", 3}, {"UGHU", 3}, {"UGHZ", 3},
+    {"UGUS", 3}, {"UHER", 3}, {"UHOW", 3}, {"UICO", 3}, {"UIFO", 3}, {"UIGU", 3},
+    {"UILD", 3}, {"UIPR", 3}, {"UISE", 3}, {"UIST", 3}, {"UISU", 3}, {"UITW", 3},
+    {"ULCI", 3}, {"ULCO", 3}, {"ULDK", 3}, {"ULFE", 3}, {"ULLD", 3}, {"ULLH", 3},
+    {"ULNE", 3}, {"ULNO", 3}, {"ULOF", 3}, {"ULON", 3}, {"ULTU", 3}, {"ULWA", 3},
+    {"ULYA", 3}, {"ULYP", 3}, {"ULYS", 3}, {"UMAT", 3}, {"UMEI", 3}, {"UMEL", 3},
+    {"UMFO", 3}, {"UMFR", 3}, {"UMMI", 3}, {"UMNM", 3}, {"UMPA", 3}, {"UMPL", 3},
+    {"UMSM", 3}, {"UMSU", 3}, {"UMWE", 3}, {"UNCV", 3}, {"UNIO", 3}, {"UNIS", 3},
+    {"UNOU", 3}, {"UNTD", 3}, {"UNTL", 3}, {"UPAB", 3}, {"UPAF", 3}, {"UPAL", 3},
+    {"UPED", 3}, {"UPGE", 3}, {"UPID", 3}, {"UPKE", 3}, {"UPLO", 3}, {"UPMO", 3},
+    {"UPOP", 3}, {"UPOS", 3}, {"UPPR", 3}, {"UPTS", 3}, {"UPUS", 3}, {"UPWH", 3},
+    {"UPXI", 3}, {"UPXP", 3}, {"URAI", 3}, {"URBT", 3}, {"URCU", 3}, {"URFE", 3},
+    {"URFU", 3}, {"URGR", 3}, {"URHE", 3}, {"URIF", 3}, {"URIU", 3}, {"URLE", 3},
+    {"URLS", 3}, {"URMA", 3}, {"URMU", 3}, {"URNF", 3}, {"URNO", 3}, {"URNW", 3},
+    {"URTJ", 3}, {"URUS", 3}, {"URYB", 3}, {"URYO", 3}, {"USCI", 3}, {"USDI", 3},
+    {"USDU", 3}, {"USFR", 3}, {"USGA", 3}, {"USGE", 3}, {"USIB", 3}, {"USIL", 3},
+    {"USKE", 3}, {"USVI", 3}, {"UTAK", 3}, {"UTEE", 3}, {"UTEF", 3}, {"UTEG", 3},
+    {"UTEJ", 3}, {"UTFL", 3}, {"UTFS", 3}, {"UTFT", 3}, {"UTGE", 3}, {"UTGI", 3},
+    {"UTGO", 3}, {"UTGR", 3}, {"UTMI", 3}, {"UTMU", 3}, {"UTOE", 3}, {"UTOH", 3},
+    {"UTSP", 3}, {"UTSV", 3}, {"UTWO", 3}, {"UVIA", 3}, {"UWON", 3}, {"VADE", 3},
+    {"VALB", 3}, {"VALF", 3}, {"VARR", 3}, {"VAST", 3}, {"VDAN", 3}, {"VEAG", 3},
+    {"VECE", 3}, {"VECP", 3}, {"VEDD", 3}, {"VEDR", 3}, {"VEDY", 3}, {"VEEI", 3},
+    {"VEFA", 3}, {"VEGL", 3}, {"VEGO", 3}, {"VEHO", 3}, {"VEIC", 3}, {"VELF", 3},
+    {"VELH", 3}, {"VELM", 3}, {"VELU", 3}, {"VEND", 3}, {"VENR", 3}, {"VEOB", 3},
+    {"VEOT", 3}, {"VEPU", 3}, {"VESG", 3}, {"VESL", 3}, {"VEWR", 3}, {"VEXF", 3},
+    {"VEXG", 3}, {"VIAA", 3}, {"VIAL", 3}, {"VIDA", 3}, {"VIGO", 3}, {"VIMX", 3},
+    {"VIPR", 3}, {"VIZT", 3}, {"VMAP", 3}, {"VNNV", 3}, {"VNOR", 3}, {"VORI", 3},
+    {"VORT", 3}, {"VWIL", 3}, {"WALT", 3}, {"WAMO", 3}, {"WAPA", 3}, {"WART", 3},
+    {"WATA", 3}, {"WAYL", 3}, {"WAYN", 3}, {"WBEE", 3}, {"WBEL", 3}, {"WCCO", 3},
+    {"WCRO", 3}, {"WDEF", 3}, {"WDET", 3}, {"WDOE", 3}, {"WDOI", 3}, {"WDOT", 3},
+    {"WEDG", 3}, {"WEDS", 3}, {"WEET", 3}, {"WELO", 3}, {"WEME", 3}, {"WEMU", 3},
+    {"WEPR", 3}, {"WERM", 3}, {"WERW", 3}, {"WEWE", 3}, {"WEXE", 3}, {"WFEL", 3},
+    {"WFIR", 3}, {"WFUL", 3}, {"WGPR", 3}, {"WHOA", 3}, {"WHOT", 3}, {"WHYB", 3},
+    {"WHYS", 3}, {"WICO", 3}, {"WIFS", 3}, {"WIFW", 3}, {"WINO", 3}, {"WINR", 3},
+    {"WIPL", 3}, {"WITA", 3}, {"WITT", 3}, {"WJUM", 3}, {"WKNO", 3}, {"WLAY", 3},
+    {"WLIC", 3}, {"WLYT", 3}, {"WNAW", 3}, {"WNBE", 3}, {"WNBY", 3}, {"WNFO", 3},
+    {"WNHA", 3}, {"WNIT", 3}, {"WNOW", 3}, {"WNPR", 3}, {"WNVI", 3}, {"WNWH", 3},
+    {"WNYO", 3}, {"WOBO", 3}, {"WOCA", 3}, {"WOCF", 3}, {"WOCR", 3}, {"WOEX", 3},
+    {"WOFE", 3}, {"WOHA", 3}, {"WOLO", 3}, {"WONO", 3}, {"WOOP", 3}, {"WOPE", 3},
+    {"WORN", 3}, {"WOSE", 3}, {"WOSU", 3}, {"WOTW", 3}, {"WOTY", 3}, {"WOWH", 3},
+    {"WOYO", 3}, {"WPLU", 3}, {"WPOI", 3}, {"WPOR", 3}, {"WREM", 3}, {"WREV", 3},
+    {"WRIN", 3}, {"WSDO", 3}, {"WSEX", 3}, {"WSHE", 3}, {"WSNO", 3}, {"WSOR", 3},
+    {"WSSI", 3}, {"WSSO", 3}, {"WSUI", 3}, {"WTHR", 3}, {"WTON", 3}, {"WTOO", 3},
+    {"WTOR", 3}, {"WUPI", 3}, {"WUSI", 3}, {"WZHW", 3}, {"WZLW", 3}, {"XARG", 3},
+    {"XARI", 3}, {"XCEN", 3}, {"XCFA", 3}, {"XCLE", 3}, {"XCON", 3}, {"XCOU", 3},
+    {"XCVI", 3}, {"XDEA", 3}, {"XDIR", 3}, {"XDTH", 3}, {"XESO", 3}, {"XFOL", 3},
+    {"XFRE", 3}, {"XHAS", 3}, {"XHER", 3}, {"XHOM", 3}, {"XIDS", 3}, {"XIFC", 3},
+    {"XINP", 3}, {"XITT", 3}, {"XMLF", 3}, {"XMLU", 3}, {"XPRO", 3}, {"XPRS", 3},
+    {"XPRT", 3}, {"XREA", 3}, {"XRWI", 3}, {"XSEA", 3}, {"XTDI", 3}, {"XTDO", 3},
+    {"XTES", 3}, {"XTFU", 3}, {"XTGE", 3}, {"XTHL", 3}, {"XTSC", 3}, {"XTSG", 3},
+    {"XTSM", 3}, {"XTSR", 3}, {"XTSY", 3}, {"XTTA", 3}, {"XTTW", 3}, {"XTYE", 3},
+    {"XUSE", 3}, {"XVIN", 3}, {"XVOR", 3}, {"XWIL", 3}, {"XXTH", 3}, {"XXXS", 3},
+    {"XXXT", 3}, {"XYZM", 3}, {"XYZO", 3}, {"XYZT", 3}, {"YABE", 3}, {"YADE", 3},
+    {"YAGI", 3}, {"YAMA", 3}, {"YAME", 3}, {"YANG", 3}, {"YAPT", 3}, {"YAQU", 3},
+    {"YARA", 3}, {"YARC", 3}, {"YASO", 3}, {"YASR", 3}, {"YASW", 3}, {"YATL", 3},
+    {"YAVI", 3}, {"YBAD", 3}, {"YBEV", 3}, {"YBEW", 3}, {"YBIT", 3}, {"YBUB", 3},
+    {"YBUF", 3}, {"YBYC", 3}, {"YBYD", 3}, {"YBYO", 3}, {"YBYY", 3}, {"YCEA", 3},
+    {"YCER", 3}, {"YCLA", 3}, {"YCLO", 3}, {"YCOD", 3}, {"YCOI", 3}, {"YCUR", 3},
+    {"YDOS", 3}, {"YDRO", 3}, {"YEBU", 3}, {"YEDF", 3}, {"YEDO", 3}, {"YEFR", 3},
+    {"YEIS", 3}, {"YEIT", 3}, {"YEMI", 3}, {"YEMP", 3}, {"YENA", 3}, {"YEOF", 3},
+    {"YESO", 3}, {"YETM", 3}, {"YETP", 3}, {"YETY", 3}, {"YFIV", 3}, {"YFLO", 3},
+    {"YFOO", 3}, {"YHID", 3}, {"YINI", 3}, {"YINL", 3}, {"YIRO", 3}, {"YISC", 3},
+    {"YISF", 3}, {"YISW", 3}, {"YITH", 3}, {"YITN", 3}, {"YLAI", 3}, {"YLAS", 3},
+    {"YLEC", 3}, {"YLEG", 3}, {"YLEN", 3}, {"YLOA", 3}, {"YLUM", 3}, {"YMEC", 3},
+    {"YMKD", 3}, {"YNAK", 3}, {"YNDE", 3}, {"YNID", 3}, {"YOCC", 3}, {"YOFE", 3},
+    {"YOFV", 3}, {"YOMI", 3}, {"YORU", 3}, {"YPAI", 3}, {"YPEK", 3}, {"YPEZ", 3},
+    {"YPOP", 3}, {"YPRU", 3}, {"YQUI", 3}, {"YREG", 3}, {"YROU", 3}, {"YRUB", 3},
+    {"YSAL", 3}, {"YSCH", 3}, {"YSLE", 3}, {"YSMI", 3}, {"YSNE", 3}, {"YSNO", 3},
+    {"YSRE", 3}, {"YSUN", 3}, {"YTEO", 3}, {"YTIT", 3}, {"YTRI", 3}, {"YUNT", 3},
+    {"YUPT", 3}, {"YVIT", 3}, {"YXYZ", 3}, {"YYAN", 3}, {"YZAC", 3}, {"YZME", 3},
+    {"YZOR", 3}, {"YZSE", 3}, {"YZST", 3}, {"ZACC", 3}, {"ZCOM", 3}, {"ZEDS", 3},
+    {"ZEIT", 3}, {"ZESW", 3}, {"ZETO", 3}, {"ZEVA", 3}, {"ZEWI", 3}, {"ZFAL", 3},
+    {"ZHSC", 3}, {"ZHWI", 3}, {"ZINA", 3}, {"ZINP", 3}, {"ZLSC", 3}, {"ZLWI", 3},
+    {"ZMEA", 3}, {"ZORC", 3}, {"ZOTO", 3}, {"ZRAN", 3}, {"ZSET", 3}, {"ZTHI", 3},
+    {"AABA", 2}, {"AAGE", 2}, {"AALL", 2}, {"AAPP", 2}, {"AARF", 2}, {"AARG", 2},
+    {"AARN", 2}, {"AASA", 2}, {"AASW", 2}, {"AAUM", 2}, {"AAZU", 2}, {"ABAD", 2},
+    {"ABAF", 2}, {"ABAR", 2}, {"ABAT", 2}, {"ABBE", 2}, {"ABBS", 2}, {"ABCF", 2},
+    {"ABCM", 2}, {"ABDO", 2}, {"ABEE", 2}, {"ABMO", 2}, {"ABOM", 2}, {"ABSD", 2},
+    {"ABSU", 2}, {"ABTY", 2}, {"ABUS", 2}, {"ABUT", 2}, {"ABVA", 2}, {"ABXV", 2},
+    {"ACAD", 2}, {"ACAS", 2}, {"ACAU", 2}, {"ACCA", 2}, {"ACCR", 2}, {"ACDB", 2},
+    {"ACEH", 2}, {"ACEQ", 2}, {"ACEV", 2}, {"ACFO", 2}, {"ACHG", 2}, {"ACLI", 2},
+    {"ACLU", 2}, {"ACTB", 2}, {"ACTF", 2}, {"ACTW", 2}, {"ACUR", 2}, {"ACYF", 2},
+    {"ACYV", 2}, {"ADAD", 2}, {"ADBC", 2}, {"ADCA", 2}, {"ADDD", 2}, {"ADDJ", 2},
+    {"ADDK", 2}, {"ADDQ", 2}, {"ADEP", 2}, {"ADEQ", 2}, {"ADFU", 2}, {"ADIG", 2},
+    {"ADIM", 2}, {"ADIV", 2}, {"ADLO", 2}, {"ADOB", 2}, {"ADOS", 2}, {"ADPA", 2},
+    {"ADPL", 2}, {"ADRY", 2}, {"ADSH", 2}, {"ADSP", 2}, {"ADWE", 2}, {"ADXY", 2},
+    {"ADYC", 2}, {"ADYL", 2}, {"AECH", 2}, {"AEVA", 2}, {"AEXA", 2}, {"AFAF", 2},
+    {"AFON", 2}, {"AFRA", 2}, {"AGAU", 2}, {"AGCA", 2}, {"AGDA", 2}, {"AGDO", 2},
+    {"AGFL", 2}, {"AGFO", 2}, {"AGFR", 2}, {"AGFU", 2}, {"AGGE", 2}, {"AGIF", 2},
+    {"AGIS", 2}, {"AGOA", 2}, {"AGOF", 2}, {"AGON", 2}, {"AGSD", 2}, {"AGSR", 2},
+    {"AGSW", 2}, {"AGSY", 2}, {"AHAN", 2}, {"AHAS", 2}, {"AHID", 2}, {"AHIL", 2},
+    {"AHYP", 2}, {"AIDB", 2}, {"AIDM", 2}, {"AIDP", 2}, {"AIDW", 2}, {"AIFT", 2},
+    {"AIFY", 2}, {"AILF", 2}, {"AILN", 2}, {"AILP", 2}, {"AINJ", 2}, {"AIRN", 2},
+    {"AIRY", 2}, {"AITF", 2}, {"AITO", 2}, {"AIYO", 2}, {"AJUS", 2}, {"AKAM", 2},
+    {"AKAT", 2}, {"AKCA", 2}, {"AKEX", 2}, {"AKHE", 2}, {"AKIT", 2}, {"AKPR", 2},
+    {"AKTE", 2}, {"AKYO", 2}, {"ALEI", 2}, {"ALEL", 2}, {"ALFD", 2}, {"ALGA", 2},
+    {"ALJU", 2}, {"ALKN", 2}, {"ALOV", 2}, {"ALPI", 2}, {"ALQU", 2}, {"ALSV", 2},
+    {"ALTD", 2}, {"ALTF", 2}, {"ALTL", 2}, {"ALTU", 2}, {"ALTX", 2}, {"AMAD", 2},
+    {"AMAX", 2}, {"AMBA", 2}, {"AMBY", 2}, {"AMCD", 2}, {"AMGN", 2}, {"AMHO", 2},
+    {"AMIR", 2}, {"AMLA", 2}, {"AMNE", 2}, {"AMOO", 2}, {"AMOZ", 2}, {"AMPE", 2},
+    {"AMPF", 2}, {"AMPO", 2}, {"AMSF", 2}, {"AMTX", 2}, {"ANAI", 2}, {"ANAQ", 2},
+    {"ANBR", 2}, {"ANBU", 2}, {"ANEE", 2}, {"ANEG", 2}, {"ANGD", 2}, {"ANGY", 2},
+    {"ANHI", 2}, {"ANHY", 2}, {"ANJO", 2}, {"ANKB", 2}, {"ANKF", 2}, {"ANKM", 2},
+    {"ANKW", 2}, {"ANLY", 2}, {"ANMI", 2}, {"ANRG", 2}, {"ANRU", 2}, {"ANRV", 2},
+    {"ANSB", 2}, {"ANSG", 2}, {"ANTN", 2}, {"ANTV", 2}, {"ANTX", 2}, {"ANUF", 2},
+    {"ANXW", 2}, {"ANYY", 2}, {"AOFL", 2}, {"AOFP", 2}, {"AONE", 2}, {"AORG", 2},
+    {"AOSB", 2}, {"APAA", 2}, {"APAN", 2}, {"APAU", 2}, {"APCU", 2}, {"APDD", 2},
+    {"APDO", 2}, {"APEG", 2}, {"APET", 2}, {"APEX", 2}, {"APFC", 2}, {"APFG", 2},
+    {"APFN", 2}, {"APHF", 2}, {"APHM", 2}, {"APHN", 2}, {"APHO", 2}, {"APLI", 2},
+    {"APNE", 2}, {"APOW", 2}, {"APQG", 2}, {"APSA", 2}, {"APSD", 2}, {"APSO", 2},
+    {"APSP", 2}, {"APSR", 2}, {"APSS", 2}, {"APTA", 2}, {"APWH", 2}, {"APWI", 2},
+    {"ARAA", 2}, {"ARAD", 2}, {"ARBU", 2}, {"AREJ", 2}, {"ARFA", 2}, {"ARFU", 2},
+    {"ARGG", 2}, {"ARGV", 2}, {"ARKV", 2}, {"ARLA", 2}, {"ARMD", 2}, {"ARMS", 2},
+    {"ARND", 2}, {"AROI", 2}, {"ARPH", 2}, {"ARPL", 2}, {"ARSG", 2}, {"ARSH", 2},
+    {"ARSN", 2}, {"ARSR", 2}, {"ARSY", 2}, {"ARUL", 2}, {"ARWO", 2}, {"ARXF", 2},
+    {"ARYZ", 2}, {"ASAH", 2}, {"ASAK", 2}, {"ASCU", 2}, {"ASDR", 2}, {"ASEG", 2},
+    {"ASGL", 2}, {"ASHL", 2}, {"ASHM", 2}, {"ASHP", 2}, {"ASHS", 2}, {"ASHY", 2},
+    {"ASJU", 2}, {"ASKN", 2}, {"ASKV", 2}, {"ASMI", 2}, {"ASMS", 2}, {"ASOI", 2},
+    {"ASQU", 2}, {"ASRO", 2}, {"ASTG", 2}, {"ASTK", 2}, {"ASTV", 2}, {"ASUD", 2},
+    {"ASUM", 2}, {"ASWO", 2}, {"ASYH", 2}, {"ASYI", 2}, {"ASYV", 2}, {"ASYW", 2},
+    {"ATAQ", 2}, {"ATAW", 2}, {"ATBA", 2}, {"ATDF", 2}, {"ATEU", 2}, {"ATFE", 2},
+    {"ATGI", 2}, {"ATGL", 2}, {"ATHG", 2}, {"ATHL", 2}, {"ATHY", 2}, {"ATIW", 2},
+    {"ATOL", 2}, {"ATOU", 2}, {"ATPW", 2}, {"ATQA", 2}, {"ATRW", 2}, {"ATSK", 2},
+    {"ATTQ", 2}, {"ATTT", 2}, {"ATUP", 2}, {"ATVW", 2}, {"ATYI", 2}, {"AUGU", 2},
+    {"AUMA", 2}, {"AUNC", 2}, {"AVAN", 2}, {"AVAP", 2}, {"AVAT", 2}, {"AVEJ", 2},
+    {"AVIR", 2}, {"AVTH", 2}, {"AWBY", 2}, {"AWEA", 2}, {"AWEB", 2}, {"AWED", 2},
+    {"AWME", 2}, {"AWNA", 2}, {"AWNC", 2}, {"AWON", 2}, {"AWSP", 2}, {"AWTW", 2},
+    {"AXBL", 2}, {"AXBU", 2}, {"AXBX", 2}, {"AXDI", 2}, {"AXES", 2}, {"AXHE", 2},
+    {"AXIF", 2}, {"AXII", 2}, {"AXLE", 2}, {"AXNO", 2}, {"AXON", 2}, {"AXTH", 2},
+    {"AXTO", 2}, {"AXXX", 2}, {"AXYO", 2}, {"AYBO", 2}, {"AYCE", 2}, {"AYCL", 2},
+    {"AYEM", 2}, {"AYFG", 2}, {"AYGI", 2}, {"AYGR", 2}, {"AYHE", 2}, {"AYHI", 2},
+    {"AYKN", 2}, {"AYLO", 2}, {"AYMN", 2}, {"AYON", 2}, {"AYOP", 2}, {"AYPA", 2},
+    {"AYPT", 2}, {"AYRA", 2}, {"AYSK", 2}, {"AYSL", 2}, {"AYTA", 2}, {"AYUP", 2},
+    {"AZAS", 2}, {"AZNO", 2}, {"AZUR", 2}, {"BADD", 2}, {"BADI", 2}, {"BADW", 2},
+    {"BALF", 2}, {"BALT", 2}, {"BANG", 2}, {"BARG", 2}, {"BARL", 2}, {"BARV", 2},
+    {"BARW", 2}, {"BASA", 2}, {"BASS", 2}, {"BBAN", 2}, {"BBBE", 2}, {"BBCA", 2},
+    {"BBDO", 2}, {"BBEC", 2}, {"BBED", 2}, {"BBEI", 2}, {"BBSB", 2}, {"BBST", 2},
+    {"BCAL", 2}, {"BCAR", 2}, {"BCCC", 2}, {"BCDA", 2}, {"BCDM", 2}, {"BCLA", 2},
+    {"BCLI", 2}, {"BCOU", 2}, {"BCRE", 2}, {"BDAT", 2}, {"BDCO", 2}, {"BDES", 2},
+    {"BDIN", 2}, {"BDTH", 2}, {"BEAU", 2}, {"BEBA", 2}, {"BEDS", 2}, {"BEEL", 2},
+    {"BEEM", 2}, {"BEER", 2}, {"BEFU", 2}, {"BEIF", 2}, {"BEJO", 2}, {"BEME", 2},
+    {"BEOT", 2}, {"BEOV", 2}, {"BEQU", 2}, {"BERH", 2}, {"BESK", 2}, {"BETE", 2},
+    {"BEUR", 2}, {"BEWO", 2}, {"BEXE", 2}, {"BFRO", 2}, {"BGBA", 2}, {"BHEX", 2},
+    {"BICU", 2}, {"BIGU", 2}, {"BIII", 2}, {"BINS", 2}, {"BINT", 2}, {"BINX", 2},
+    {"BIRD", 2}, {"BISA", 2}, {"BIST", 2}, {"BITL", 2}, {"BITR", 2}, {"BJAC", 2},
+    {"BJOI", 2}, {"BLAS", 2}, {"BLEK", 2}, {"BLOO", 2}, {"BLUR", 2}, {"BLYF", 2},
+    {"BLYN", 2}, {"BMYF", 2}, {"BOMU", 2}, {"BONA", 2}, {"BONE", 2}, {"BORC", 2},
+    {"BOWB", 2}, {"BOXY", 2}, {"BPRE", 2}, {"BPRI", 2}, {"BRAA", 2}, {"BRAF", 2},
+    {"BRAW", 2}, {"BREG", 2}, {"BREQ", 2}, {"BRIF", 2}, {"BRTH", 2}, {"BRUA", 2},
+    {"BSAT", 2}, {"BSBA", 2}, {"BSBE", 2}, {"BSET", 2}, {"BSHA", 2}, {"BSIM", 2},
+    {"BSOM", 2}, {"BSOR", 2}, {"BSOT", 2}, {"BSSE", 2}, {"BSWE", 2}, {"BSWR", 2},
+    {"BTER", 2}, {"BTES", 2}, {"BTFU", 2}, {"BTOC", 2}, {"BTYP", 2}, {"BUFV", 2},
+    {"BUGB", 2}, {"BUGC", 2}, {"BUTK", 2}, {"BUTR", 2}, {"BWIT", 2}, {"BWTH", 2},
+    {"BXAS", 2}, {"BXVO", 2}, {"BYAI", 2}, {"BYBL", 2}, {"BYBO", 2}, {"BYCR", 2},
+    {"BYDO", 2}, {"BYEM", 2}, {"BYEP", 2}, {"BYER", 2}, {"BYFL", 2}, {"BYGE", 2},
+    {"BYGI", 2}, {"BYHU", 2}, {"BYOV", 2}, {"BYPL", 2}, {"BYPO", 2}, {"BYRO", 2},
+    {"BYSC", 2}, {"BYUN", 2}, {"BYWE", 2}, {"CAAN", 2}, {"CABC", 2}, {"CACO", 2},
+    {"CADD", 2}, {"CAGA", 2}, {"CALR", 2}, {"CALX", 2}, {"CANK", 2}, {"CANY", 2},
+    {"CAPP", 2}, {"CARG", 2}, {"CART", 2}, {"CATN", 2}, {"CAYI", 2}, {"CAYS", 2},
+    {"CBAT", 2}, {"CBBE", 2}, {"CBDI", 2}, {"CBEC", 2}, {"CBEE", 2}, {"CBET", 2},
+    {"CBIS", 2}, {"CBSH", 2}, {"CCAN", 2}, {"CCCD", 2}, {"CCCH", 2}, {"CCDD", 2},
+    {"CCDP", 2}, {"CCGW", 2}, {"CCHE", 2}, {"CCOL", 2}, {"CCOS", 2}, {"CCRE", 2},
+    {"CCTO", 2}, {"CDDD", 2}, {"CDEG", 2}, {"CDMA", 2}, {"CDOR", 2}, {"CDPR", 2},
+    {"CDPW", 2}, {"CDRE", 2}, {"CDTH", 2}, {"CEAG", 2}, {"CEBC", 2}, {"CEBL", 2},
+    {"CECD", 2}, {"CECR", 2}, {"CECT", 2}, {"CEDC", 2}, {"CEDH", 2}, {"CEEN", 2},
+    {"CEER", 2}, {"CEHO", 2}, {"CEIC", 2}, {"CEIH", 2}, {"CEIK", 2}, {"CEIL", 2},
+    {"CEIM", 2}, {"CEMB", 2}, {"CEMR", 2}, {"CENU", 2}, {"CEOB", 2}, {"CEPA", 2},
+    {"CERV", 2}, {"CESK", 2}, {"CESQ", 2}, {"CETI", 2}, {"CETW", 2}, {"CETY", 2},
+    {"CEUP", 2}, {"CEXE", 2}, {"CFEA", 2}, {"CFIR", 2}, {"CFIX", 2}, {"CFUN", 2},
+    {"CGET", 2}, {"CGIV", 2}, {"CGWA", 2}, {"CHAA", 2}, {"CHAO", 2}, {"CHAV", 2},
+    {"CHDR", 2}, {"CHEF", 2}, {"CHEI", 2}, {"CHEO", 2}, {"CHIA", 2}, {"CHIR", 2},
+    {"CHOK", 2}, {"CHOQ", 2}, {"CHOW", 2}, {"CHPU", 2}, {"CHQF", 2}, {"CHSL", 2},
+    {"CHTQ", 2}, {"CHTR", 2}, {"CHTY", 2}, {"CHUN", 2}, {"CHXC", 2}, {"CHXF", 2},
+    {"CHXL", 2}, {"CHXW", 2}, {"CIAR", 2}, {"CIDW", 2}, {"CIFD", 2}, {"CILL", 2},
+    {"CINA", 2}, {"CISR", 2}, {"CITR", 2}, {"CITS", 2}, {"CITW", 2}, {"CIVI", 2},
+    {"CIWH", 2}, {"CKAP", 2}, {"CKBL", 2}, {"CKCR", 2}, {"CKEN", 2}, {"CKEX", 2},
+    {"CKFR", 2}, {"CKGE", 2}, {"CKLE", 2}, {"CKME", 2}, {"CKOI", 2}, {"CKPL", 2},
+    {"CKPO", 2}, {"CKPR", 2}, {"CKSC", 2}, {"CKSD", 2}, {"CKSS", 2}, {"CKTE", 2},
+    {"CKTI", 2}, {"CKTR", 2}, {"CKUN", 2}, {"CKYT", 2}, {"CLAM", 2}, {"CLEG", 2},
+    {"CLEP", 2}, {"CLER", 2}, {"CLEX", 2}, {"CLON", 2}, {"CMAK", 2}, {"CMAP", 2},
+    {"CMDG", 2}, {"CMDH", 2}, {"CMDI", 2}, {"CMDW", 2}, {"CMIN", 2}, {"CMSW", 2},
+    {"CNAN", 2}, {"CNGC", 2}, {"CNOR", 2}, {"CNTL", 2}, {"CNTT", 2}, {"COCA", 2},
+    {"COFA", 2}, {"COMT", 2}, {"COPT", 2}, {"CORI", 2}, {"COSC", 2}, {"COUP", 2},
+    {"CPLA", 2}, {"CPOA", 2}, {"CPOO", 2}, {"CPOP", 2}, {"CPRI", 2}, {"CPUS", 2},
+    {"CPVI", 2}, {"CPWD", 2}, {"CPWI", 2}, {"CQNG", 2}, {"CRAN", 2}, {"CRBE", 2},
+    {"CRCH", 2}, {"CRCR", 2}, {"CRDE", 2}, {"CRIG", 2}, {"CRIN", 2}, {"CRIS", 2},
+    {"CRTO", 2}, {"CRUP", 2}, {"CSAN", 2}, {"CSAT", 2}, {"CSAV", 2}, {"CSEE", 2},
+    {"CSHS", 2}, {"CSOR", 2}, {"CSOU", 2}, {"CSTR", 2}, {"CSWH", 2}, {"CTAK", 2},
+    {"CTAM", 2}, {"CTCA", 2}, {"CTDE", 2}, {"CTEA", 2}, {"CTEN", 2}, {"CTMI", 2},
+    {"CTMP", 2}, {"CTOB", 2}, {"CTOD", 2}, {"CTOE", 2}, {"CTSD", 2}, {"CTSJ", 2},
+    {"CTTA", 2}, {"CTTX", 2}, {"CTUN", 2}, {"CTYE", 2}, {"CUMM", 2}, {"CUOI", 2},
+    {"CUOW", 2}, {"CUPI", 2}, {"CUPY", 2}, {"CURD", 2}, {"CURF", 2}, {"CURW", 2},
+    {"CUSA", 2}, {"CUSB", 2}, {"CUTB", 2}, {"CUTC", 2}, {"CUTF", 2}, {"CUTM", 2},
+    {"CWBE", 2}, {"CWER", 2}, {"CWIK", 2}, {"CWRI", 2}, {"CWTU", 2}, {"CYCL", 2},
+    {"CYFU", 2}, {"CYTE", 2}, {"CYWA", 2}, {"DAAU", 2}, {"DABE", 2}, {"DABS", 2},
+    {"DACE", 2}, {"DACL", 2}, {"DADU", 2}, {"DAES", 2}, {"DAFA", 2}, {"DAGD", 2},
+    {"DAGI", 2}, {"DAHI", 2}, {"DAIS", 2}, {"DALP", 2}, {"DASD", 2}, {"DASX", 2},
+    {"DATB", 2}, {"DATQ", 2}, {"DATX", 2}, {"DAUG", 2}, {"DAUS", 2}, {"DAVA", 2},
+    {"DAVE", 2}, {"DAVI", 2}, {"DAWT", 2}, {"DAYO", 2}, {"DAYY", 2}, {"DBBE", 2},
+    {"DBCA", 2}, {"DBRA", 2}, {"DBSE", 2}, {"DBUB", 2}, {"DBWI", 2}, {"DCAP", 2},
+    {"DCBB", 2}, {"DCCO", 2}, {"DCEN", 2}, {"DCFO", 2}, {"DCHF", 2}, {"DCIN", 2},
+    {"DCMA", 2}, {"DCTO", 2}, {"DDAU", 2}, {"DDEX", 2}, {"DDFO", 2}, {"DDID", 2},
+    {"DDIM", 2}, {"DDJU", 2}, {"DDKE", 2}, {"DDMO", 2}, {"DDOB", 2}, {"DDOO", 2},
+    {"DDPA", 2}, {"DDQA", 2}, {"DDRO", 2}, {"DDRY", 2}, {"DDTE", 2}, {"DDWE", 2},
+    {"DDWI", 2}, {"DDYN", 2}, {"DEAJ", 2}, {"DEBR", 2}, {"DEDD", 2}, {"DEDP", 2},
+    {"DEDR", 2}, {"DEEE", 2}, {"DEES", 2}, {"DEET", 2}, {"DEFD", 2}, {"DEFU", 2},
+    {"DEGI", 2}, {"DEGT", 2}, {"DEHE", 2}, {"DEHO", 2}, {"DEII", 2}, {"DEIU", 2},
+    {"DELD", 2}, {"DELO", 2}, {"DELS", 2}, {"DEMR", 2}, {"DENG", 2}, {"DENH", 2},
+    {"DEOB", 2}, {"DERG", 2}, {"DERQ", 2}, {"DESG", 2}, {"DEUP", 2}, {"DEVA", 2},
+    {"DEVD", 2}, {"DFEA", 2}, {"DFEW", 2}, {"DFFI", 2}, {"DFIF", 2}, {"DFIV", 2},
+    {"DFOO", 2}, {"DFTH", 2}, {"DFUM", 2}, {"DGBE", 2}, {"DGCT", 2}, {"DGDE", 2},
+    {"DGEI", 2}, {"DGEW", 2}, {"DGGD", 2}, {"DGLW", 2}, {"DGMT", 2}, {"DGUI", 2},
+    {"DGVI", 2}, {"DGWH", 2}, {"DHAD", 2}, {"DHAP", 2}, {"DHAR", 2}, {"DHAT", 2},
+    {"DHTT", 2}, {"DICI", 2}, {"DIDB", 2}, {"DIDH", 2}, {"DIDO", 2}, {"DIDU", 2},
+    {"DIFM", 2}, {"DIGA", 2}, {"DILI", 2}, {"DINX", 2}, {"DIPR", 2}, {"DIRI", 2},
+    {"DIRN", 2}, {"DIRP", 2}, {"DIRS", 2}, {"DISY", 2}, {"DIVF", 2}, {"DIXH", 2},
+    {"DJAN", 2}, {"DJOB", 2}, {"DJTO", 2}, {"DKIN", 2}, {"DLEL", 2}, {"DLFO", 2},
+    {"DLON", 2}, {"DLTA", 2}, {"DLUC", 2}, {"DLYA", 2}, {"DLYB", 2}, {"DLYC", 2},
+    {"DLYG", 2}, {"DMAG", 2}, {"DMEC", 2}, {"DMNT", 2}, {"DMNW", 2}, {"DMON", 2},
+    {"DMOO", 2}, {"DNIT", 2}, {"DNOA", 2}, {"DNOC", 2}, {"DNOL", 2}, {"DNOM", 2},
+    {"DNOS", 2}, {"DNTF", 2}, {"DNTT", 2}, {"DOAT", 2}, {"DOBE", 2}, {"DOBL", 2},
+    {"DOCD", 2}, {"DOCH", 2}, {"DOCN", 2}, {"DODE", 2}, {"DOED", 2}, {"DOFG", 2},
+    {"DOFY", 2}, {"DOHO", 2}, {"DOMH", 2}, {"DOQU", 2}, {"DORG", 2}, {"DORK", 2},
+    {"DORW", 2}, {"DOSC", 2}, {"DOSL", 2}, {"DOTI", 2}, {"DOTS", 2}, {"DOUG", 2},
+    {"DOUN", 2}, {"DOUR", 2}, {"DOVI", 2}, {"DOZI", 2}, {"DPBE", 2}, {"DPIC", 2},
+    {"DPIT", 2}, {"DPOF", 2}, {"DPOR", 2}, {"DPTT", 2}, {"DQAN", 2}, {"DQAR", 2},
+    {"DQRS", 2}, {"DQSO", 2}, {"DRAC", 2}, {"DRAI", 2}, {"DRAS", 2}, {"DRIC", 2},
+    {"DRUL", 2}, {"DSAD", 2}, {"DSAM", 2}, {"DSAW", 2}, {"DSAY", 2}, {"DSBO", 2},
+    {"DSCI", 2}, {"DSCL", 2}, {"DSDE", 2}, {"DSDW", 2}, {"DSES", 2}, {"DSGL", 2},
+    {"DSIP", 2}, {"DSJU", 2}, {"DSKI", 2}, {"DSNA", 2}, {"DSOV", 2}, {"DSSI", 2},
+    {"DSSP", 2}, {"DSSY", 2}, {"DSUG", 2}, {"DSVE", 2}, {"DSXA", 2}, {"DTAL", 2},
+    {"DTES", 2}, {"DTHV", 2}, {"DTIN", 2}, {"DTOV", 2}, {"DTOX", 2}, {"DTRE", 2},
+    {"DTSO", 2}, {"DTWE", 2}, {"DTXT", 2}, {"DULA", 2}, {"DULY", 2}, {"DUNE", 2},
+    {"DUNF", 2}, {"DUPD", 2}, {"DUPI", 2}, {"DUPP", 2}, {"DUTY", 2}, {"DVCO", 2},
+    {"DVEN", 2}, {"DVES", 2}, {"DVIG", 2}, {"DWAL", 2}, {"DWCO", 2}, {"DWEC", 2},
+    {"DWEH", 2}, {"DWON", 2}, {"DWTO", 2}, {"DXBL", 2}, {"DXCN", 2}, {"DXIN", 2},
+    {"DYAT", 2}, {"DYIF", 2}, {"DYIL", 2}, {"DYKN", 2}, {"DYLE", 2}, {"DYNA", 2},
+    {"DYON", 2}, {"DYSO", 2}, {"DYTY", 2}, {"DYWA", 2}, {"DZCC", 2}, {"DZRT", 2},
+    {"EAAB", 2}, {"EABM", 2}, {"EACB", 2}, {"EACK", 2}, {"EADG", 2}, {"EADX", 2},
+    {"EAEX", 2}, {"EAGW", 2}, {"EAHI", 2}, {"EAHO", 2}, {"EAIM", 2}, {"EAJS", 2},
+    {"EAJU", 2}, {"EAKL", 2}, {"EALD", 2}, {"EAMY", 2}, {"EANH", 2}, {"EARP", 2},
+    {"EASG", 2}, {"EASJ", 2}, {"EASK", 2}, {"EASR", 2}, {"EASV", 2}, {"EAXV", 2},
+    {"EBEU", 2}, {"EBHW", 2}, {"EBNR", 2}, {"EBRU", 2}, {"EBSA", 2}, {"EBSB", 2},
+    {"EBSO", 2}, {"EBST", 2}, {"EBTH", 2}, {"EBVI", 2}, {"EBWE", 2}, {"EBYU", 2},
+    {"ECAC", 2}, {"ECCB", 2}, {"ECDC", 2}, {"ECDP", 2}, {"ECEA", 2}, {"ECEM", 2},
+    {"ECFL", 2}, {"ECHY", 2}, {"ECME", 2}, {"ECNO", 2}, {"ECOH", 2}, {"ECRD", 2},
+    {"ECSC", 2}, {"ECSU", 2}, {"ECTN", 2}, {"ECUS", 2}, {"ECWC", 2}, {"ECWH", 2},
+    {"ECYL", 2}, {"EDAA", 2}, {"EDAQ", 2}, {"EDAV", 2}, {"EDAX", 2}, {"EDBI", 2},
+    {"EDCI", 2}, {"EDDD", 2}, {"EDDR", 2}, {"EDDT", 2}, {"EDEW", 2}, {"EDFE", 2},
+    {"EDJU", 2}, {"EDNI", 2}, {"EDNT", 2}, {"EDOG", 2}, {"EDRU", 2}, {"EDSD", 2},
+    {"EDWC", 2}, {"EDXB", 2}, {"EEBA", 2}, {"EEBL", 2}, {"EEBU", 2}, {"EECI", 2},
+    {"EECU", 2}, {"EEDL", 2}, {"EEDP", 2}, {"EEDW", 2}, {"EEEC", 2}, {"EEEF", 2},
+    {"EEEI", 2}, {"EEEM", 2}, {"EEEV", 2}, {"EEFA", 2}, {"EEGA", 2}, {"EEGH", 2},
+    {"EEGW", 2}, {"EEHA", 2}, {"EEHY", 2}, {"EEIC", 2}, {"EEIR", 2}, {"EEKM", 2},
+    {"EEKO", 2}, {"EEKR", 2}, {"EEKY", 2}, {"EELO", 2}, {"EENK", 2}, {"EEPU", 2},
+    {"EERO", 2}, {"EEZE", 2}, {"EFCF", 2}, {"EFDE", 2}, {"EFEB", 2}, {"EFEX", 2},
+    {"EFFF", 2}, {"EFFG", 2}, {"EFFM", 2}, {"EFFU", 2}, {"EFGC", 2}, {"EFGM", 2},
+    {"EFIE", 2}, {"EFIS", 2}, {"EFOT", 2}, {"EFSN", 2}, {"EFTB", 2}, {"EFTD", 2},
+    {"EFTF", 2}, {"EFTU", 2}, {"EFUM", 2}, {"EGAV", 2}, {"EGCV", 2}, {"EGGI", 2},
+    {"EGIR", 2}, {"EGLE", 2}, {"EGME", 2}, {"EGMO", 2}, {"EGMT", 2}, {"EGOU", 2},
+    {"EGPA", 2}, {"EGQG", 2}, {"EGTC", 2}, {"EGTY", 2}, {"EGUO", 2}, {"EHEB", 2},
+    {"EHEX", 2}, {"EHOT", 2}, {"EHRO", 2}, {"EHTE", 2}, {"EHTO", 2}, {"EIAN", 2},
+    {"EIBI", 2}, {"EICA", 2}, {"EIDI", 2}, {"EIFF", 2}, {"EIFN", 2}, {"EIFW", 2},
+    {"EIIF", 2}, {"EIIS", 2}, {"EINH", 2}, {"EINU", 2}, {"EIPL", 2}, {"EIRQ", 2},
+    {"EITG", 2}, {"EIVA", 2}, {"EIVD", 2}, {"EJOH", 2}, {"EKEG", 2}, {"EKEX", 2},
+    {"EKGE", 2}, {"EKIG", 2}, {"EKIL", 2}, {"EKLE", 2}, {"EKPW", 2}, {"EKSA", 2},
+    {"EKYX", 2}, {"ELAL", 2}, {"ELBL", 2}, {"ELBO", 2}, {"ELDN", 2}, {"ELFL", 2},
+    {"ELFR", 2}, {"ELFS", 2}, {"ELFU", 2}, {"ELIU", 2}, {"ELJU", 2}, {"ELLL", 2},
+    {"ELLQ", 2}, {"ELLX", 2}, {"ELNO", 2}, {"ELOD", 2}, {"ELPB", 2}, {"ELRE", 2},
+    {"ELSB", 2}, {"ELSC", 2}, {"ELSV", 2}, {"ELWH", 2}, {"ELWI", 2}, {"ELYY", 2},
+    {"EMAF", 2}, {"EMAV", 2}, {"EMAW", 2}, {"EMBA", 2}, {"EMCI", 2}, {"EMCN", 2},
+    {"EMDU", 2}, {"EMDV", 2}, {"EMEI", 2}, {"EMEL", 2}, {"EMEP", 2}, {"EMEY", 2},
+    {"EMFU", 2}, {"EMGO", 2}, {"EMGR", 2}, {"EMHE", 2}, {"EMKS", 2}, {"EMMU", 2},
+    {"EMNA", 2}, {"EMOM", 2}, {"EMOP", 2}, {"EMPA", 2}, {"EMPN", 2}, {"EMPR", 2},
+    {"EMSH", 2}, {"EMSJ", 2}, {"EMSN", 2}, {"EMSV", 2}, {"EMVE", 2}, {"EMWA", 2},
+    {"ENAG", 2}, {"ENAQ", 2}, {"ENAU", 2}, {"ENAY", 2}, {"ENBA", 2}, {"ENCT", 2},
+    {"ENDG", 2}, {"ENDY", 2}, {"ENEL", 2}, {"ENEM", 2}, {"ENEQ", 2}, {"ENFL", 2},
+    {"ENGA", 2}, {"ENGU", 2}, {"ENHO", 2}, {"ENIG", 2}, {"ENIP", 2}, {"ENJO", 2},
+    {"ENKE", 2}, {"ENOA", 2}, {"ENOD", 2}, {"ENPP", 2}, {"ENQI", 2}, {"ENTJ", 2},
+    {"ENTX", 2}, {"ENUD", 2}, {"ENYI", 2}, {"ENYU", 2}, {"EOAR", 2}, {"EOCU", 2},
+    {"EOES", 2}, {"EOFX", 2}, {"EOIN", 2}, {"EONG", 2}, {"EONM", 2}, {"EONP", 2},
+    {"EONR", 2}, {"EOPI", 2}, {"EOST", 2}, {"EOTO", 2}, {"EOUA", 2}, {"EOYT", 2},
+    {"EPDA", 2}, {"EPDI", 2}, {"EPED", 2}, {"EPGR", 2}, {"EPHP", 2}, {"EPIG", 2},
+    {"EPMA", 2}, {"EPON", 2}, {"EPQU", 2}, {"EPSB", 2}, {"EPSO", 2}, {"EPSS", 2},
+    {"EPTP", 2}, {"EPTU", 2}, {"EPWA", 2}, {"EPWD", 2}, {"EPWH", 2}, {"EPYO", 2},
+    {"EQST", 2}, {"EQUD", 2}, {"ERAA", 2}, {"ERAV", 2}, {"ERBI", 2}, {"ERDR", 2},
+    {"ERFH", 2}, {"ERFT", 2}, {"ERID", 2}, {"ERIU", 2}, {"ERIZ", 2}, {"ERLS", 2},
+    {"ERLU", 2}, {"ERLV", 2}, {"ERMB", 2}, {"ERMN", 2}, {"ERMY", 2}, {"ERNN", 2},
+    {"EROM", 2}, {"EROS", 2}, {"ERQP", 2}, {"ERTD", 2}, {"ERTK", 2}, {"ERVF", 2},
+    {"ESAX", 2}, {"ESBI", 2}, {"ESBM", 2}, {"ESCN", 2}, {"ESCU", 2}, {"ESEK", 2},
+    {"ESEY", 2}, {"ESFF", 2}, {"ESGO", 2}, {"ESHL", 2}, {"ESHP", 2}, {"ESIP", 2},
+    {"ESJO", 2}, {"ESKL", 2}, {"ESKT", 2}, {"ESNR", 2}, {"ESOC", 2}, {"ESOW", 2},
+    {"ESOY", 2}, {"ESPG", 2}, {"ESPS", 2}, {"ESRC", 2}, {"ESRI", 2}, {"ESSG", 2},
+    {"ESSJ", 2}, {"ESSQ", 2}, {"ETAH", 2}, {"ETAM", 2}, {"ETBC", 2}, {"ETBD", 2},
+    {"ETCB", 2}, {"ETCG", 2}, {"ETCV", 2}, {"ETEB", 2}, {"ETEG", 2}, {"ETEK", 2},
+    {"ETEP", 2}, {"ETEU", 2}, {"ETFC", 2}, {"ETFP", 2}, {"ETGC", 2}, {"ETGM", 2},
+    {"ETGO", 2}, {"ETHB", 2}, {"ETHN", 2}, {"ETHS", 2}, {"ETJO", 2}, {"ETMU", 2},
+    {"ETNA", 2}, {"ETNI", 2}, {"ETNR", 2}, {"ETPI", 2}, {"ETQF", 2}, {"ETTK", 2},
+    {"ETUI", 2}, {"ETVC", 2}, {"ETVE", 2}, {"ETYA", 2}, {"EUAN", 2}, {"EUNA", 2},
+    {"EUPK", 2}, {"EUPN", 2}, {"EURG", 2}, {"EURO", 2}, {"EUTO", 2}, {"EVAA", 2},
+    {"EVAS", 2}, {"EVEA", 2}, {"EVEO", 2}, {"EVFR", 2}, {"EVIV", 2}, {"EVLN", 2},
+    {"EVMA", 2}, {"EVNO", 2}, {"EVOT", 2}, {"EVSY", 2}, {"EVTE", 2}, {"EVTO", 2},
+    {"EVTX", 2}, {"EVUL", 2}, {"EVVE", 2}, {"EVWN", 2}, {"EVXY", 2}, {"EWAF", 2},
+    {"EWBI", 2}, {"EWCA", 2}, {"EWCT", 2}, {"EWDE", 2}, {"EWDO", 2}, {"EWEF", 2},
+    {"EWET", 2}, {"EWFL", 2}, {"EWFU", 2}, {"EWGU", 2}, {"EWIP", 2}, {"EWLY", 2},
+    {"EWNO", 2}, {"EWOP", 2}, {"EWPA", 2}, {"EWPL", 2}, {"EWSP", 2}, {"EWSW", 2},
+    {"EWTI", 2}, {"EWTW", 2}, {"EWWA", 2}, {"EXDI", 2}, {"EXEI", 2}, {"EXES", 2},
+    {"EXGL", 2}, {"EXLI", 2}, {"EXOB", 2}, {"EXPM", 2}, {"EXRM", 2}, {"EXSE", 2},
+    {"EXST", 2}, {"EXYO", 2}, {"EYAB", 2}, {"EYAF", 2}, {"EYAT", 2}, {"EYBU", 2},
+    {"EYCE", 2}, {"EYCH", 2}, {"EYEH", 2}, {"EYEP", 2}, {"EYFI", 2}, {"EYGE", 2},
+    {"EYJU", 2}, {"EYLE", 2}, {"EYLO", 2}, {"EYSD", 2}, {"EYSL", 2}, {"EYSM", 2},
+    {"EYUN", 2}, {"EYVE", 2}, {"EZZC", 2}, {"FABI", 2}, {"FABY", 2}, {"FACL", 2},
+    {"FACS", 2}, {"FACU", 2}, {"FADR", 2}, {"FADU", 2}, {"FAFF", 2}, {"FAFL", 2},
+    {"FAFT", 2}, {"FAGI", 2}, {"FAGL", 2}, {"FAHA", 2}, {"FAJU", 2}, {"FALE", 2},
+    {"FALT", 2}, {"FALU", 2}, {"FANM", 2}, {"FANU", 2}, {"FAPE", 2}, {"FAPY", 2},
+    {"FARF", 2}, {"FARM", 2}, {"FARR", 2}, {"FARS", 2}, {"FASM", 2}, {"FATO", 2},
+    {"FATU", 2}, {"FATY", 2}, {"FAWE", 2}, {"FAYE", 2}, {"FBEC", 2}, {"FBEL", 2},
+    {"FBUB", 2}, {"FCHE", 2}, {"FCIN", 2}, {"FCNT", 2}, {"FCRE", 2}, {"FDEE", 2},
+    {"FDEL", 2}, {"FDID", 2}, {"FDOE", 2}, {"FDOI", 2}, {"FDON", 2}, {"FDTH", 2},
+    {"FEEC", 2}, {"FEEE", 2}, {"FEEI", 2}, {"FEER", 2}, {"FEES", 2}, {"FEFF", 2},
+    {"FELE", 2}, {"FENF", 2}, {"FENS", 2}, {"FEOF", 2}, {"FESC", 2}, {"FETO", 2},
+    {"FEWD", 2}, {"FEWF", 2}, {"FEWR", 2}, {"FEXC", 2}, {"FFBU", 2}, {"FFBY", 2},
+    {"FFCO", 2}, {"FFEA", 2}, {"FFFG", 2}, {"FFIG", 2}, {"FFIT", 2}, {"FFIV", 2},
+    {"FFIX", 2}, {"FFMA", 2}, {"FFNE", 2}, {"FFOC", 2}, {"FFPA", 2}, {"FFSP", 2},
+    {"FFUR", 2}, {"FGAR", 2}, {"FGEN", 2}, {"FGGA", 2}, {"FGGG", 2}, {"FGGR", 2},
+    {"FGIN", 2}, {"FGIV", 2}, {"FGMU", 2}, {"FGUN", 2}, {"FHAI", 2}, {"FHAR", 2},
+    {"FHEA", 2}, {"FHID", 2}, {"FIFA", 2}, {"FIFS", 2}, {"FIGF", 2}, {"FIGM", 2},
+    {"FIGP", 2}, {"FIIN", 2}, {"FISE", 2}, {"FISF", 2}, {"FISS", 2}, {"FIXF", 2},
+    {"FIXH", 2}, {"FJUS", 2}, {"FLIK", 2}, {"FLIT", 2}, {"FLOG", 2}, {"FLON", 2},
+    {"FLUC", 2}, {"FLUO", 2}, {"FLYM", 2}, {"FMAL", 2}, {"FMAY", 2}, {"FMBE", 2},
+    {"FMEA", 2}, {"FMIC", 2}, {"FMIL", 2}, {"FMIX", 2}, {"FNEI", 2}, {"FNOP", 2},
+    {"FNOR", 2}, {"FNOU", 2}, {"FNRR", 2}, {"FOCA", 2}, {"FOCO", 2}, {"FOEW", 2},
+    {"FOFE", 2}, {"FOLI", 2}, {"FOOW", 2}, {"FORJ", 2}, {"FORQ", 2}, {"FOST", 2},
+    {"FOTA", 2}, {"FOTE", 2}, {"FOTM", 2}, {"FOWI", 2}, {"FPAI", 2}, {"FPAS", 2},
+    {"FPEN", 2}, {"FPEO", 2}, {"FPHN", 2}, {"FPOP", 2}, {"FREN", 2}, {"FROB", 2},
+    {"FROW", 2}, {"FSCA", 2}, {"FSIM", 2}, {"FSMA", 2}, {"FSNR", 2}, {"FSOT", 2},
+    {"FSTH", 2}, {"FSTO", 2}, {"FSUP", 2}, {"FSWI", 2}, {"FTAS", 2}, {"FTCM", 2},
+    {"FTCT", 2}, {"FTCU", 2}, {"FTDE", 2}, {"FTDO", 2}, {"FTFI", 2}, {"FTHS", 2},
+    {"FTLE", 2}, {"FTMA", 2}, {"FTNE", 2}, {"FTNO", 2}, {"FTOH", 2}, {"FTOM", 2},
+    {"FTOP", 2}, {"FTOU", 2}, {"FTOW", 2}, {"FTRO", 2}, {"FTSR", 2}, {"FTVE", 2},
+    {"FTZL", 2}, {"FULP", 2}, {"FURN", 2}, {"FVIZ", 2}, {"FVOL", 2}, {"FWAS", 2},
+    {"FWEW", 2}, {"FWOO", 2}, {"FYAB", 2}, {"FYAD", 2}, {"FYAW", 2}, {"FYHO", 2},
+    {"FYMO", 2}, {"FYTO", 2}, {"FYWI", 2}, {"GAAB", 2}, {"GABI", 2}, {"GACA", 2},
+    {"GAMU", 2}, {"GANH", 2}, {"GARP", 2}, {"GASV", 2}, {"GATB", 2}, {"GAUG", 2},
+    {"GAWH", 2}, {"GAXV", 2}, {"GBAS", 2}, {"GBEL", 2}, {"GBLA", 2}, {"GBOU", 2},
+    {"GBRO", 2}, {"GCAL", 2}, {"GCAR", 2}, {"GCCG", 2}, {"GCFI", 2}, {"GCGA", 2},
+    {"GCRO", 2}, {"GCVI", 2}, {"GDAN", 2}, {"GDAR", 2}, {"GDEC", 2}, {"GDEG", 2},
+    {"GDIL", 2}, {"GDOS", 2}, {"GDTO", 2}, {"GEAU", 2}, {"GEBA", 2}, {"GEBC", 2},
+    {"GEBO", 2}, {"GEBR", 2}, {"GEBW", 2}, {"GECC", 2}, {"GECS", 2}, {"GECU", 2},
+    {"GEDH", 2}, {"GEDN", 2}, {"GEEG", 2}, {"GEIG", 2}, {"GEIL", 2}, {"GEMS", 2},
+    {"GENG", 2}, {"GENR", 2}, {"GEPE", 2}, {"GEPL", 2}, {"GERC", 2}, {"GERH", 2},
+    {"GERU", 2}, {"GESJ", 2}, {"GESR", 2}, {"GESV", 2}, {"GEYW", 2}, {"GFAC", 2},
+    {"GFAL", 2}, {"GFEE", 2}, {"GFIN", 2}, {"GFIX", 2}, {"GFON", 2}, {"GFUR", 2},
+    {"GFUT", 2}, {"GGAA", 2}, {"GGAN", 2}, {"GGDE", 2}, {"GGED", 2}, {"GGGQ", 2},
+    {"GGHH", 2}, {"GGOE", 2}, {"GGOT", 2}, {"GGQG", 2}, {"GGRM", 2}, {"GHAD", 2},
+    {"GHBE", 2}, {"GHCR", 2}, {"GHHA", 2}, {"GHHH", 2}, {"GHIH", 2}, {"GHJU", 2},
+    {"GHLE", 2}, {"GHSP", 2}, {"GHTK", 2}, {"GHUS", 2}, {"GHWA", 2}, {"GHWI", 2},
+    {"GIAI", 2}, {"GICS", 2}, {"GIFA", 2}, {"GIFE", 2}, {"GIFF", 2}, {"GIFN", 2},
+    {"GIFW", 2}, {"GIIN", 2}, {"GIMM", 2}, {"GIRL", 2}, {"GISB", 2}, {"GISF", 2},
+    {"GISL", 2}, {"GISM", 2}, {"GISP", 2}, {"GISW", 2}, {"GITD", 2}, {"GITL", 2},
+    {"GITR", 2}, {"GJUS", 2}, {"GLEE", 2}, {"GLEV", 2}, {"GLIA", 2}, {"GLIT", 2},
+    {"GLON", 2}, {"GLWH", 2}, {"GLYP", 2}, {"GLYW", 2}, {"GMIG", 2}, {"GMPL", 2},
+    {"GMTH", 2}, {"GMTO", 2}, {"GMYE", 2}, {"GMYT", 2}, {"GNAF", 2}, {"GNAS", 2},
+    {"GNBE", 2}, {"GNDT", 2}, {"GNGE", 2}, {"GNLI", 2}, {"GNME", 2}, {"GNOP", 2},
+    {"GNPL", 2}, {"GNUS", 2}, {"GOAB", 2}, {"GOAS", 2}, {"GOBE", 2}, {"GODI", 2},
+    {"GOFB", 2}, {"GOFN", 2}, {"GOFU", 2}, {"GOFY", 2}, {"GONH", 2}, {"GOOF", 2},
+    {"GOPE", 2}, {"GORB", 2}, {"GORT", 2}, {"GORY", 2}, {"GOSE", 2}, {"GOSO", 2},
+    {"GOTS", 2}, {"GOTW", 2}, {"GOUP", 2}, {"GOUR", 2}, {"GOUS", 2}, {"GPLH", 2},
+    {"GPLI", 2}, {"GPLS", 2}, {"GPLT", 2}, {"GPLW", 2}, {"GPLY", 2}, {"GPRI", 2},
+    {"GQAN", 2}, {"GQAP", 2}, {"GQGG", 2}, {"GQJT", 2}, {"GQTO", 2}, {"GRAB", 2},
+    {"GRAI", 2}, {"GRIM", 2}, {"GRUB", 2}, {"GRUN", 2}, {"GSBU", 2}, {"GSDI", 2},
+    {"GSEA", 2}, {"GSEP", 2}, {"GSEX", 2}, {"GSFA", 2}, {"GSGR", 2}, {"GSHO", 2},
+    {"GSID", 2}, {"GSIL", 2}, {"GSOA", 2}, {"GSOV", 2}, {"GSTY", 2}, {"GSUN", 2},
+    {"GSVA", 2}, {"GSYE", 2}, {"GTAS", 2}, {"GTCO", 2}, {"GTHF", 2}, {"GTHP", 2},
+    {"GTHY", 2}, {"GTIL", 2}, {"GTIM", 2}, {"GTOH", 2}, {"GTRA", 2}, {"GTRI", 2},
+    {"GTRY", 2}, {"GTUR", 2}, {"GTXT", 2}, {"GUGU", 2}, {"GUIB", 2}, {"GUIE", 2},
+    {"GUMA", 2}, {"GUOP", 2}, {"GUPD", 2}, {"GURI", 2}, {"GUST", 2}, {"GUWS", 2},
+    {"GVIS", 2}, {"GWAL", 2}, {"GWEA", 2}, {"GXGR", 2}, {"GXXX", 2}, {"GYAN", 2},
+    {"GYEX", 2}, {"GZER", 2}, {"GZOA", 2}, {"HABA", 2}, {"HACI", 2}, {"HACL", 2},
+    {"HADC", 2}, {"HAFL", 2}, {"HAFO", 2}, {"HAGL", 2}, {"HALT", 2}, {"HALW", 2},
+    {"HANK", 2}, {"HANL", 2}, {"HANR", 2}, {"HAOS", 2}, {"HARN", 2}, {"HARO", 2},
+    {"HARV", 2}, {"HARY", 2}, {"HASV", 2}, {"HATJ", 2}, {"HAWA", 2}, {"HAWI", 2},
+    {"HAXI", 2}, {"HBED", 2}, {"HBEN", 2}, {"HBEP", 2}, {"HBOW", 2}, {"HBRE", 2},
+    {"HBTH", 2}, {"HBUB", 2}, {"HBYD", 2}, {"HCAL", 2}, {"HCER", 2}, {"HCHE", 2},
+    {"HCID", 2}, {"HCJD", 2}, {"HCOD", 2}, {"HCOR", 2}, {"HCRN", 2}, {"HCUT", 2},
+    {"HDAS", 2}, {"HDEC", 2}, {"HDEE", 2}, {"HDEG", 2}, {"HDER", 2}, {"HDFR", 2},
+    {"HDGL", 2}, {"HDIC", 2}, {"HDID", 2}, {"HDLO", 2}, {"HDOW", 2}, {"HDRO", 2},
+    {"HDSU", 2}, {"HDWH", 2}, {"HEBC", 2}, {"HEBF", 2}, {"HEBN", 2}, {"HECD", 2},
+    {"HEDG", 2}, {"HEDS", 2}, {"HEDV", 2}, {"HEEE", 2}, {"HEEO", 2}, {"HEFM", 2},
+    {"HEFS", 2}, {"HEGF", 2}, {"HEGJ", 2}, {"HEGM", 2}, {"HEGS", 2}, {"HEIL", 2},
+    {"HEIO", 2}, {"HEJA", 2}, {"HELS", 2}, {"HEOM", 2}, {"HETF", 2}, {"HETT", 2},
+    {"HETX", 2}, {"HEVU", 2}, {"HEZZ", 2}, {"HFAC", 2}, {"HFAI", 2}, {"HFAS", 2},
+    {"HFEE", 2}, {"HFLA", 2}, {"HFRI", 2}, {"HFUL", 2}, {"HFUZ", 2}, {"HGAN", 2},
+    {"HGGA", 2}, {"HGOO", 2}, {"HGTH", 2}, {"HGUI", 2}, {"HGVI", 2}, {"HHHI", 2},
+    {"HHII", 2}, {"HHIN", 2}, {"HHOM", 2}, {"HHOW", 2}, {"HIAL", 2}, {"HIAN", 2},
+    {"HIFO", 2}, {"HIFS", 2}, {"HIGR", 2}, {"HIHE", 2}, {"HIII", 2}, {"HIJO", 2},
+    {"HIKA", 2}, {"HIKK", 2}, {"HILI", 2}, {"HILL", 2}, {"HIME", 2}, {"HIMI", 2},
+    {"HINM", 2}, {"HINR", 2}, {"HINY", 2}, {"HIUS", 2}, {"HJKI", 2}, {"HJYO", 2},
+    {"HKEE", 2}, {"HKNO", 2}, {"HLEA", 2}, {"HLEF", 2}, {"HLID", 2}, {"HLIE", 2},
+    {"HLIM", 2}, {"HLNO", 2}, {"HLOG", 2}, {"HLTI", 2}, {"HLYW", 2}, {"HMAJ", 2},
+    {"HMEM", 2}, {"HMER", 2}, {"HMIC", 2}, {"HMOF", 2}, {"HMTO", 2}, {"HNEA", 2},
+    {"HNER", 2}, {"HNHE", 2}, {"HNOA", 2}, {"HNOC", 2}, {"HOAU", 2}, {"HOBE", 2},
+    {"HOBL", 2}, {"HOCA", 2}, {"HOCH", 2}, {"HODD", 2}, {"HODE", 2}, {"HODM", 2},
+    {"HODP", 2}, {"HODY", 2}, {"HOEN", 2}, {"HOES", 2}, {"HOFS", 2}, {"HOFV", 2},
+    {"HOGE", 2}, {"HOGG", 2}, {"HOIN", 2}, {"HOKE", 2}, {"HONP", 2}, {"HOQA", 2},
+    {"HORB", 2}, {"HORH", 2}, {"HORN", 2}, {"HORP", 2}, {"HORR", 2}, {"HORU", 2},
+    {"HOSO", 2}, {"HOTE", 2}, {"HOUK", 2}, {"HOWG", 2}, {"HPAP", 2}, {"HPIE", 2},
+    {"HPIT", 2}, {"HPOS", 2}, {"HQCW", 2}, {"HQUA", 2}, {"HQUI", 2}, {"HRAS", 2},
+    {"HROO", 2}, {"HROT", 2}, {"HSAF", 2}, {"HSAL", 2}, {"HSAP", 2}, {"HSBY", 2},
+    {"HSEA", 2}, {"HSEL", 2}, {"HSEN", 2}, {"HSEP", 2}, {"HSIM", 2}, {"HSLE", 2},
+    {"HSMO", 2}, {"HSNO", 2}, {"HSOI", 2}, {"HSPA", 2}, {"HSPH", 2}, {"HSPL", 2},
+    {"HSPR", 2}, {"HSUF", 2}, {"HSUP", 2}, {"HSUR", 2}, {"HSWH", 2}, {"HTAF", 2},
+    {"HTAG", 2}, {"HTAM", 2}, {"HTAW", 2}, {"HTCM", 2}, {"HTCU", 2}, {"HTEQ", 2},
+    {"HTEV", 2}, {"HTFM", 2}, {"HTGE", 2}, {"HTHS", 2}, {"HTIL", 2}, {"HTMN", 2},
+    {"HTNI", 2}, {"HTNT", 2}, {"HTOV", 2}, {"HTPL", 2}, {"HTPO", 2}, {"HTPQ", 2},
+    {"HTPT", 2}, {"HTRO", 2}, {"HTSK", 2}, {"HTSL", 2}, {"HTSY", 2}, {"HTTE", 2},
+    {"HTTI", 2}, {"HTXT", 2}, {"HTYO", 2}, {"HTZH", 2}, {"HUAN", 2}, {"HURN", 2},
+    {"HURR", 2}, {"HURS", 2}, {"HUSG", 2}, {"HUTB", 2}, {"HUTO", 2}, {"HVIB", 2},
+    {"HWEE", 2}, {"HWEL", 2}, {"HWEM", 2}, {"HWES", 2}, {"HWYO", 2}, {"HXFO", 2},
+    {"HXLI", 2}, {"HXPA", 2}, {"HXPR", 2}, {"HXWH", 2}, {"HXXD", 2}, {"HYAT", 2},
+    {"HYBL", 2}, {"HYDO", 2}, {"HYEA", 2}, {"HYNO", 2}, {"HYSU", 2}, {"IAAN", 2},
+    {"IACC", 2}, {"IAFO", 2}, {"IAGE", 2}, {"IAIS", 2}, {"IALN", 2}, {"IALV", 2},
+    {"IANL", 2}, {"IAOF", 2}, {"IAWH", 2}, {"IAWI", 2}, {"IBCA", 2}, {"IBEX", 2},
+    {"IBMY", 2}, {"IBYT", 2}, {"ICBY", 2}, {"ICEE", 2}, {"ICEK", 2}, {"ICFE", 2},
+    {"ICFU", 2}, {"ICID", 2}, {"ICKH", 2}, {"ICKM", 2}, {"ICLA", 2}, {"ICNU", 2},
+    {"ICOF", 2}, {"ICOR", 2}, {"ICRU", 2}, {"ICSI", 2}, {"ICTD", 2}, {"ICTM", 2},
+    {"ICUN", 2}, {"ICUR", 2}, {"ICVI", 2}, {"ICWE", 2}, {"ICWO", 2}, {"IDAB", 2},
+    {"IDAR", 2}, {"IDAU", 2}, {"IDBO", 2}, {"IDBR", 2}, {"IDBU", 2}, {"IDBY", 2},
+    {"IDDA", 2}, {"IDEP", 2}, {"IDEU", 2}, {"IDFL", 2}, {"IDFU", 2}, {"IDGO", 2},
+    {"IDHA", 2}, {"IDIS", 2}, {"IDIV", 2}, {"IDLY", 2}, {"IDMI", 2}, {"IDOB", 2},
+    {"IDOT", 2}, {"IDRI", 2}, {"IDSC", 2}, {"IDSH", 2}, {"IDSI", 2}, {"IDSY", 2},
+    {"IDTA", 2}, {"IDVE", 2}, {"IDXB", 2}, {"IDXN", 2}, {"IERL", 2}, {"IERY", 2},
+    {"IESG", 2}, {"IESQ", 2}, {"IEWM", 2}, {"IEWP", 2}, {"IEXA", 2}, {"IFBO", 2},
+    {"IFBY", 2}, {"IFDU", 2}, {"IFEB", 2}, {"IFEO", 2}, {"IFEV", 2}, {"IFFC", 2},
+    {"IFGL", 2}, {"IFNR", 2}, {"IFPE", 2}, {"IFPU", 2}, {"IFSP", 2}, {"IFTC", 2},
+    {"IFTL", 2}, {"IFTU", 2}, {"IFWA", 2}, {"IFYB", 2}, {"IFYE", 2}, {"IFYF", 2},
+    {"IFYH", 2}, {"IFYV", 2}, {"IGAC", 2}, {"IGAR", 2}, {"IGAX", 2}, {"IGCO", 2},
+    {"IGFA", 2}, {"IGHI", 2}, {"IGHM", 2}, {"IGNB", 2}, {"IGNF", 2}, {"IGNG", 2},
+    {"IGNL", 2}, {"IGNM", 2}, {"IGNP", 2}, {"IGOF", 2}, {"IGOR", 2}, {"IGTA", 2},
+    {"IGTO", 2}, {"IGUP", 2}, {"IGWI", 2}, {"IHER", 2}, {"IIBE", 2}, {"IIFO", 2},
+    {"IIFT", 2}, {"IIFY", 2}, {"IIIA", 2}, {"IIIJ", 2}, {"IIJJ", 2}, {"IIPA", 2},
+    {"IIST", 2}, {"IITE", 2}, {"IJJJ", 2}, {"IJOH", 2}, {"IKEJ", 2}, {"IKIT", 2},
+    {"IKKH", 2}, {"IKLM", 2}, {"IKNO", 2}, {"ILAI", 2}, {"ILBE", 2}, {"ILBY", 2},
+    {"ILDI", 2}, {"ILDU", 2}, {"ILEJ", 2}, {"ILEK", 2}, {"ILEQ", 2}, {"ILIZ", 2},
+    {"ILKS", 2}, {"ILMK", 2}, {"ILOO", 2}, {"ILOV", 2}, {"ILPR", 2}, {"ILSB", 2},
+    {"ILSC", 2}, {"ILSD", 2}, {"ILSF", 2}, {"ILWH", 2}, {"ILYC", 2}, {"ILYE", 2},
+    {"ILYL", 2}, {"ILYM", 2}, {"IMAK", 2}, {"IMBD", 2}, {"IMBI", 2}, {"IMBR", 2},
+    {"IMBU", 2}, {"IMBY", 2}, {"IMGV", 2}, {"IMJU", 2}, {"IMLA", 2}, {"IMOP", 2},
+    {"IMOT", 2}, {"IMRH", 2}, {"IMRT", 2}, {"IMRV", 2}, {"IMSM", 2}, {"IMSN", 2},
+    {"IMSV", 2}, {"IMTE", 2}, {"IMWR", 2}, {"IMZI", 2}, {"INAH", 2}, {"INAI", 2},
+    {"INAX", 2}, {"INCD", 2}, {"INDC", 2}, {"INDG", 2}, {"INIO", 2}, {"INIU", 2},
+    {"INKC", 2}, {"INKD", 2}, {"INKH", 2}, {"INKL", 2}, {"INKX", 2}, {"INMY", 2},
+    {"INOV", 2}, {"INOW", 2}, {"INPG", 2}, {"INPH", 2}, {"INPX", 2}, {"INSR", 2},
+    {"INTD", 2}, {"INTV", 2}, {"INUP", 2}, {"INWE", 2}, {"INXY", 2}, {"IODO", 2},
+    {"IOFF", 2}, {"IOFI", 2}, {"IOHI", 2}, {"IOHT", 2}, {"IOLM", 2}, {"IOLR", 2},
+    {"IOLS", 2}, {"IOLT", 2}, {"IOMI", 2}, {"IORC", 2}, {"IORF", 2}, {"IORM", 2},
+    {"IORR", 2}, {"IORW", 2}, {"IOTH", 2}, {"IPEB", 2}, {"IPEO", 2}, {"IPES", 2},
+    {"IPLI", 2}, {"IPNL", 2}, {"IPOC", 2}, {"IPOL", 2}, {"IPPA", 2}, {"IPPL", 2},
+    {"IPRI", 2}, {"IPTD", 2}, {"IPTG", 2}, {"IPUN", 2}, {"IPUS", 2}, {"IPUT", 2},
+    {"IPWI", 2}, {"IRAX", 2}, {"IRCH", 2}, {"IRCR", 2}, {"IRDD", 2}, {"IREG", 2},
+    {"IRFE", 2}, {"IRLS", 2}, {"IRLY", 2}, {"IRMC", 2}, {"IRML", 2}, {"IRMU", 2},
+    {"IRMW", 2}, {"IROB", 2}, {"IROU", 2}, {"IRPU", 2}, {"IRQU", 2}, {"IRRA", 2},
+    {"IRSA", 2}, {"IRTC", 2}, {"IRYI", 2}, {"ISAI", 2}, {"ISAQ", 2}, {"ISAY", 2},
+    {"ISCC", 2}, {"ISCD", 2}, {"ISCF", 2}, {"ISCI", 2}, {"ISEG", 2}, {"ISEP", 2},
+    {"ISGA", 2}, {"ISGV", 2}, {"ISJO", 2}, {"ISKD", 2}, {"ISKN", 2}, {"ISKW", 2},
+    {"ISMN", 2}, {"ISMY", 2}, {"ISNI", 2}, {"ISOC", 2}, {"ISRQ", 2}, {"ISTV", 2},
+    {"ISZE", 2}, {"ITAA", 2}, {"ITAH", 2}, {"ITBT", 2}, {"ITIH", 2}, {"ITJU", 2},
+    {"ITOG", 2}, {"ITOL", 2}, {"ITOV", 2}, {"ITRA", 2}, {"ITSK", 2}, {"ITSQ", 2},
+    {"ITTX", 2}, {"ITYL", 2}, {"IUMF", 2}, {"IVFO", 2}, {"IWRI", 2}, {"IWRO", 2},
+    {"IXDC", 2}, {"IXDD", 2}, {"IXDF", 2}, {"IXDP", 2}, {"IXMO", 2}, {"IXMS", 2},
+    {"IXNL", 2}, {"IXOF", 2}, {"IXPA", 2}, {"IXPR", 2}, {"IXRI", 2}, {"IXSE", 2},
+    {"IXTE", 2}, {"IXUS", 2}, {"IXWO", 2}, {"IZEF", 2}, {"IZEG", 2}, {"IZEN", 2},
+    {"IZEY", 2}, {"JAPA", 2}, {"JBJA", 2}, {"JBYA", 2}, {"JDKE", 2}, {"JJTE", 2},
+    {"JKIS", 2}, {"JOBI", 2}, {"JOBO", 2}, {"JONE", 2}, {"JORE", 2}, {"JTAG", 2},
+    {"JTEX", 2}, {"JTHE", 2}, {"JUNC", 2}, {"JURY", 2}, {"KACO", 2}, {"KADE", 2},
+    {"KAGA", 2}, {"KAGI", 2}, {"KAGR", 2}, {"KALO", 2}, {"KAMO", 2}, {"KANE", 2},
+    {"KASD", 2}, {"KASW", 2}, {"KAUS", 2}, {"KBET", 2}, {"KBLA", 2}, {"KBYL", 2},
+    {"KCOP", 2}, {"KCOR", 2}, {"KDEL", 2}, {"KDER", 2}, {"KDES", 2}, {"KDET", 2},
+    {"KDON", 2}, {"KDOO", 2}, {"KDOW", 2}, {"KDUR", 2}, {"KEAH", 2}, {"KEBI", 2},
+    {"KECT", 2}, {"KEDB", 2}, {"KEDC", 2}, {"KEED", 2}, {"KEEV", 2}, {"KEFE", 2},
+    {"KEGL", 2}, {"KEGW", 2}, {"KEIF", 2}, {"KEIS", 2}, {"KEJA", 2}, {"KELE", 2},
+    {"KENU", 2}, {"KENW", 2}, {"KEPO", 2}, {"KERF", 2}, {"KERG", 2}, {"KERM", 2},
+    {"KESF", 2}, {"KESP", 2}, {"KESW", 2}, {"KETW", 2}, {"KEWR", 2}, {"KEXE", 2},
+    {"KEXT", 2}, {"KEYL", 2}, {"KEYN", 2}, {"KEYP", 2}, {"KFAS", 2}, {"KFIR", 2},
+    {"KFUR", 2}, {"KGRA", 2}, {"KHPA", 2}, {"KIGR", 2}, {"KIIN", 2}, {"KINM", 2},
+    {"KINR", 2}, {"KIPA", 2}, {"KIPD", 2}, {"KISH", 2}, {"KISU", 2}, {"KITE", 2},
+    {"KITH", 2}, {"KITL", 2}, {"KITU", 2}, {"KJUS", 2}, {"KKNO", 2}, {"KLAW", 2},
+    {"KLYJ", 2}, {"KLYL", 2}, {"KLYP", 2}, {"KLYS", 2}, {"KLYW", 2}, {"KMAD", 2},
+    {"KMAK", 2}, {"KMAP", 2}, {"KMAT", 2}, {"KMEN", 2}, {"KMOV", 2}, {"KNED", 2},
+    {"KNLE", 2}, {"KNLT", 2}, {"KNOB", 2}, {"KNQC", 2}, {"KOCC", 2}, {"KOFC", 2},
+    {"KORB", 2}, {"KORF", 2}, {"KORI", 2}, {"KORR", 2}, {"KORV", 2}, {"KPAN", 2},
+    {"KPAS", 2}, {"KQUI", 2}, {"KREL", 2}, {"KRES", 2}, {"KRIG", 2}, {"KSAD", 2},
+    {"KSAP", 2}, {"KSAZ", 2}, {"KSBO", 2}, {"KSCR", 2}, {"KSDE", 2}, {"KSFE", 2},
+    {"KSHO", 2}, {"KSNI", 2}, {"KSNO", 2}, {"KSOA", 2}, {"KSPL", 2}, {"KSSH", 2},
+    {"KSST", 2}, {"KSSY", 2}, {"KSTR", 2}, {"KSUC", 2}, {"KSUG", 2}, {"KSUN", 2},
+    {"KTAB", 2}, {"KTHO", 2}, {"KTIC", 2}, {"KTOA", 2}, {"KTOH", 2}, {"KTOL", 2},
+    {"KTRA", 2}, {"KTWO", 2}, {"KUNL", 2}, {"KUPD", 2}, {"KUPW", 2}, {"KUXW", 2},
+    {"KVER", 2}, {"KVIO", 2}, {"KWEL", 2}, {"LAAN", 2}, {"LABE", 2}, {"LABI", 2},
+    {"LAGE", 2}, {"LAGM", 2}, {"LAGN", 2}, {"LALO", 2}, {"LALR", 2}, {"LALT", 2},
+    {"LALU", 2}, {"LAOR", 2}, {"LAPA", 2}, {"LAPI", 2}, {"LAPR", 2}, {"LASD", 2},
+    {"LASN", 2}, {"LASU", 2}, {"LASV", 2}, {"LATU", 2}, {"LAUN", 2}, {"LAWY", 2},
+    {"LAYM", 2}, {"LAYU", 2}, {"LBEK", 2}, {"LBEV", 2}, {"LBOR", 2}, {"LBRI", 2},
+    {"LBYH", 2}, {"LCAR", 2}, {"LCAT", 2}, {"LCFI", 2}, {"LCHC", 2}, {"LCHG", 2},
+    {"LCHO", 2}, {"LCIV", 2}, {"LCTH", 2}, {"LCUL", 2}, {"LCWI", 2}, {"LDBR", 2},
+    {"LDEC", 2}, {"LDGE", 2}, {"LDGO", 2}, {"LDHI", 2}, {"LDHO", 2}, {"LDIC", 2},
+    {"LDIL", 2}, {"LDJU", 2}, {"LDKN", 2}, {"LDMY", 2}, {"LDOM", 2}, {"LDPL", 2},
+    {"LDPO", 2}, {"LDRO", 2}, {"LDRU", 2}, {"LDSB", 2}, {"LDSP", 2}, {"LDSY", 2},
+    {"LDUN", 2}, {"LEAA", 2}, {"LEAQ", 2}, {"LECU", 2}, {"LEDN", 2}, {"LEDP", 2},
+    {"LEEG", 2}, {"LEFM", 2}, {"LEGO", 2}, {"LEGU", 2}, {"LEHM", 2}, {"LEIB", 2},
+    {"LEIO", 2}, {"LEIU", 2}, {"LELF", 2}, {"LELR", 2}, {"LENL", 2}, {"LENN", 2},
+    {"LEOV", 2}, {"LEPW", 2}, {"LERL", 2}, {"LESJ", 2}, {"LESK", 2}, {"LETN", 2},
+    {"LEXL", 2}, {"LEXU", 2}, {"LEXX", 2}, {"LEYW", 2}, {"LFAB", 2}, {"LFAI", 2},
+    {"LFAM", 2}, {"LFAT", 2}, {"LFAW", 2}, {"LFBY", 2}, {"LFDI", 2}, {"LFDO", 2},
+    {"LFFE", 2}, {"LFFF", 2}, {"LFMB", 2}, {"LFME", 2}, {"LFON", 2}, {"LFRA", 2},
+    {"LFSE", 2}, {"LFST", 2}, {"LFVI", 2}, {"LGAG", 2}, {"LGEN", 2}, {"LGNU", 2},
+    {"LGOE", 2}, {"LGOV", 2}, {"LGPL", 2}, {"LGUI", 2}, {"LHAL", 2}, {"LHAR", 2},
+    {"LHER", 2}, {"LHIL", 2}, {"LHOL", 2}, {"LHOS", 2}, {"LHTM", 2}, {"LIAM", 2},
+    {"LIAT", 2}, {"LIBC", 2}, {"LIBH", 2}, {"LIBM", 2}, {"LICC", 2}, {"LIDL", 2},
+    {"LIDN", 2}, {"LIDT", 2}, {"LIDV", 2}, {"LIEX", 2}, {"LIHA", 2}, {"LIIS", 2},
+    {"LILL", 2}, {"LINF", 2}, {"LINJ", 2}, {"LINM", 2}, {"LINN", 2}, {"LINO", 2},
+    {"LINQ", 2}, {"LION", 2}, {"LIPP", 2}, {"LISD", 2}, {"LISE", 2}, {"LISW", 2},
+    {"LITL", 2}, {"LITN", 2}, {"LITR", 2}, {"LIVI", 2}, {"LJOB", 2}, {"LJSO", 2},
+    {"LJTA", 2}, {"LKED", 2}, {"LLAO", 2}, {"LLCE", 2}, {"LLCF", 2}, {"LLCI", 2},
+    {"LLCR", 2}, {"LLCY", 2}, {"LLDA", 2}, {"LLEF", 2}, {"LLGL", 2}, {"LLHI", 2},
+    {"LLHY", 2}, {"LLIE", 2}, {"LLIO", 2}, {"LLIP", 2}, {"LLJO", 2}, {"LLNR", 2},
+    {"LLOA", 2}, {"LLPI", 2}, {"LLRA", 2}, {"LLSD", 2}, {"LLSL", 2}, {"LLXQ", 2},
+    {"LLYJ", 2}, {"LMAG", 2}, {"LMAI", 2}, {"LMEC", 2}, {"LMEH", 2}, {"LMIG", 2},
+    {"LMIN", 2}, {"LMKA", 2}, {"LMOC", 2}, {"LMOP", 2}, {"LNAN", 2}, {"LNRI", 2},
+    {"LOAB", 2}, {"LOAS", 2}, {"LOBI", 2}, {"LOCL", 2}, {"LODG", 2}, {"LOFC", 2},
+    {"LOFW", 2}, {"LOGT", 2}, {"LONO", 2}, {"LOOD", 2}, {"LOOS", 2}, {"LOPR", 2},
+    {"LORB", 2}, {"LORH", 2}, {"LORU", 2}, {"LOTA", 2}, {"LOTL", 2}, {"LOUS", 2},
+    {"LPAB", 2}, {"LPAN", 2}, {"LPAP", 2}, {"LPCP", 2}, {"LPET", 2}, {"LPEV", 2},
+    {"LPGO", 2}, {"LPGT", 2}, {"LPIE", 2}, {"LPIF", 2}, {"LPIT", 2}, {"LPLI", 2},
+    {"LPME", 2}, {"LPNE", 2}, {"LPOD", 2}, {"LPOW", 2}, {"LPRR", 2}, {"LPSC", 2},
+    {"LRAN", 2}, {"LREG", 2}, {"LRUB", 2}, {"LRVT", 2}, {"LSAT", 2}, {"LSBY", 2},
+    {"LSEB", 2}, {"LSFR", 2}, {"LSHE", 2}, {"LSIL", 2}, {"LSLI", 2}, {"LSMO", 2},
+    {"LSMU", 2}, {"LSNE", 2}, {"LSOV", 2}, {"LSPI", 2}, {"LSSO", 2}, {"LSSP", 2},
+    {"LSST", 2}, {"LSTW", 2}, {"LSUM", 2}, {"LSUN", 2}, {"LSWR", 2}, {"LSYS", 2},
+    {"LTAS", 2}, {"LTCA", 2}, {"LTDI", 2}, {"LTES", 2}, {"LTFO", 2}, {"LTGE", 2},
+    {"LTMP", 2}, {"LTOD", 2}, {"LTOJ", 2}, {"LTON", 2}, {"LTOU", 2}, {"LTOY", 2},
+    {"LTSM", 2}, {"LTUN", 2}, {"LTWA", 2}, {"LTWH", 2}, {"LTWI", 2}, {"LTXT", 2},
+    {"LUAE", 2}, {"LUMH", 2}, {"LUMM", 2}, {"LUMO", 2}, {"LUMR", 2}, {"LUSM", 2},
+    {"LUSP", 2}, {"LUTO", 2}, {"LVDI", 2}, {"LVEA", 2}, {"LVIB", 2}, {"LVOI", 2},
+    {"LVXF", 2}, {"LVYO", 2}, {"LWCO", 2}, {"LWCT", 2}, {"LWEA", 2}, {"LWEI", 2},
+    {"LWFI", 2}, {"LWHM", 2}, {"LWJM", 2}, {"LWLM", 2}, {"LXQU", 2}, {"LYCE", 2},
+    {"LYEA", 2}, {"LYEL", 2}, {"LYFU", 2}, {"LYGU", 2}, {"LYIR", 2}, {"LYNR", 2},
+    {"LYOC", 2}, {"LYOP", 2}, {"LYOT", 2}, {"LYSA", 2}, {"MADD", 2}, {"MADM", 2},
+    {"MAIS", 2}, {"MALB", 2}, {"MALH", 2}, {"MAMO", 2}, {"MANB", 2}, {"MAPE", 2},
+    {"MAPQ", 2}, {"MASD", 2}, {"MASM", 2}, {"MAUG", 2}, {"MAWA", 2}, {"MAYK", 2},
+    {"MBDA", 2}, {"MBEA", 2}, {"MBEH", 2}, {"MBIG", 2}, {"MBNO", 2}, {"MBOR", 2},
+    {"MBRE", 2}, {"MBSO", 2}, {"MBST", 2}, {"MBUF", 2}, {"MBYI", 2}, {"MBYM", 2},
+    {"MBYP", 2}, {"MCAU", 2}, {"MCNG", 2}, {"MCQN", 2}, {"MDAN", 2}, {"MDCH", 2},
+    {"MDCO", 2}, {"MDDI", 2}, {"MDEC", 2}, {"MDEG", 2}, {"MDHE", 2}, {"MDIL", 2},
+    {"MDIN", 2}, {"MDOF", 2}, {"MDPO", 2}, {"MDVE", 2}, {"MEAG", 2}, {"MEAU", 2},
+    {"MEAV", 2}, {"MECD", 2}, {"MECL", 2}, {"MECU", 2}, {"MEDD", 2}, {"MEDY", 2},
+    {"MEEA", 2}, {"MEED", 2}, {"MEEF", 2}, {"MEEG", 2}, {"MEEQ", 2}, {"MEEV", 2},
+    {"MEFF", 2}, {"MEFG", 2}, {"MEGL", 2}, {"MELL", 2}, {"MEMY", 2}, {"MENW", 2},
+    {"MERL", 2}, {"MERW", 2}, {"METU", 2}, {"MEWR", 2}, {"MFAL", 2}, {"MFOU", 2},
+    {"MGEO", 2}, {"MGIV", 2}, {"MGNO", 2}, {"MGOE", 2}, {"MGVI", 2}, {"MHAC", 2},
+    {"MHAR", 2}, {"MHIM", 2}, {"MHJK", 2}, {"MIDW", 2}, {"MIER", 2}, {"MIMA", 2},
+    {"MIMM", 2}, {"MINY", 2}, {"MITC", 2}, {"MITY", 2}, {"MIXO", 2}, {"MIXR", 2},
+    {"MJUM", 2}, {"MKAN", 2}, {"MLAN", 2}, {"MLES", 2}, {"MLGN", 2}, {"MLIC", 2},
+    {"MLIG", 2}, {"MLUM", 2}, {"MLVI", 2}, {"MMCA", 2}, {"MMCH", 2}, {"MMIR", 2},
+    {"MMNT", 2}, {"MMOA", 2}, {"MMSW", 2}, {"MMTO", 2}, {"MNAL", 2}, {"MNDI", 2},
+    {"MNEA", 2}, {"MNEM", 2}, {"MNEW", 2}, {"MNMO", 2}, {"MNOP", 2}, {"MNRE", 2},
+    {"MNSA", 2}, {"MNSO", 2}, {"MNYO", 2}, {"MOAK", 2}, {"MOAN", 2}, {"MOBS", 2},
+    {"MODA", 2}, {"MOFG", 2}, {"MOFH", 2}, {"MOFV", 2}, {"MOLT", 2}, {"MONK", 2},
+    {"MONM", 2}, {"MONP", 2}, {"MONU", 2}, {"MOPA", 2}, {"MOPE", 2}, {"MORD", 2},
+    {"MORL", 2}, {"MORM", 2}, {"MORO", 2}, {"MPDO", 2}, {"MPDR", 2}, {"MPFR", 2},
+    {"MPLC", 2}, {"MPNA", 2}, {"MPNE", 2}, {"MPSB", 2}, {"MPTB", 2}, {"MPTD", 2},
+    {"MPTG", 2}, {"MQAN", 2}, {"MRAN", 2}, {"MRCA", 2}, {"MRED", 2}, {"MREL", 2},
+    {"MRES", 2}, {"MRET", 2}, {"MRFU", 2}, {"MRHA", 2}, {"MRHE", 2}, {"MRHO", 2},
+    {"MRNO", 2}, {"MRTZ", 2}, {"MRVI", 2}, {"MSAP", 2}, {"MSAW", 2}, {"MSES", 2},
+    {"MSEX", 2}, {"MSFT", 2}, {"MSHE", 2}, {"MSIT", 2}, {"MSLE", 2}, {"MSMI", 2},
+    {"MSOW", 2}, {"MSPL", 2}, {"MSSY", 2}, {"MSTV", 2}, {"MSUI", 2}, {"MSUN", 2},
+    {"MSVC", 2}, {"MSWA", 2}, {"MSYP", 2}, {"MTAB", 2}, {"MTER", 2}, {"MTIS", 2},
+    {"MTTO", 2}, {"MTXT", 2}, {"MULA", 2}, {"MUMD", 2}, {"MUTF", 2}, {"MVIT", 2},
+    {"MVTH", 2}, {"MWEH", 2}, {"MWEN", 2}, {"MWEW", 2}, {"MWON", 2}, {"MWRI", 2},
+    {"MYCO", 2}, {"MYFU", 2}, {"MYGV", 2}, {"MYSY", 2}, {"MYWI", 2}, {"MZIP", 2},
+    {"NABC", 2}, {"NABU", 2}, {"NACA", 2}, {"NADE", 2}, {"NAFF", 2}, {"NAGO", 2},
+    {"NAIT", 2}, {"NALJ", 2}, {"NALN", 2}, {"NANH", 2}, {"NANS", 2}, {"NAPO", 2},
+    {"NASK", 2}, {"NASN", 2}, {"NATG", 2}, {"NATR", 2}, {"NATW", 2}, {"NBAR", 2},
+    {"NBDC", 2}, {"NBEK", 2}, {"NBEY", 2}, {"NBLO", 2}, {"NBOU", 2}, {"NBYC", 2},
+    {"NBYF", 2}, {"NBYG", 2}, {"NBYW", 2}, {"NCFI", 2}, {"NCHD", 2}, {"NCHV", 2},
+    {"NCIA", 2}, {"NCLA", 2}, {"NCMD", 2}, {"NCMO", 2}, {"NCPT", 2}, {"NCUT", 2},
+    {"NCVE", 2}, {"NCYF", 2}, {"NCYU", 2}, {"NCYW", 2}, {"NDAX", 2}, {"NDBS", 2},
+    {"NDBW", 2}, {"NDCC", 2}, {"NDCP", 2}, {"NDCW", 2}, {"NDCY", 2}, {"NDDY", 2},
+    {"NDEE", 2}, {"NDGA", 2}, {"NDGC", 2}, {"NDGW", 2}, {"NDHJ", 2}, {"NDHS", 2},
+    {"NDHT", 2}, {"NDHU", 2}, {"NDIO", 2}, {"NDKI", 2}, {"NDLF", 2}, {"NDLT", 2},
+    {"NDMB", 2}, {"NDMS", 2}, {"NDMT", 2}, {"NDOO", 2}, {"NDOY", 2}, {"NDPB", 2},
+    {"NDPH", 2}, {"NDPP", 2}, {"NDQR", 2}, {"NDSJ", 2}, {"NDWT", 2}, {"NDXP", 2},
+    {"NDYI", 2}, {"NDYW", 2}, {"NDZC", 2}, {"NDZL", 2}, {"NDZM", 2}, {"NDZT", 2},
+    {"NEAA", 2}, {"NEAD", 2}, {"NEAK", 2}, {"NEAW", 2}, {"NEBC", 2}, {"NEBI", 2},
+    {"NEBO", 2}, {"NECF", 2}, {"NECK", 2}, {"NECS", 2}, {"NECU", 2}, {"NEEF", 2},
+    {"NEES", 2}, {"NEEV", 2}, {"NEFA", 2}, {"NEFG", 2}, {"NEFT", 2}, {"NEGG", 2},
+    {"NEGQ", 2}, {"NEGR", 2}, {"NEGT", 2}, {"NEHE", 2}, {"NEIM", 2}, {"NEJO", 2},
+    {"NELL", 2}, {"NELS", 2}, {"NELU", 2}, {"NELW", 2}, {"NEMN", 2}, {"NENV", 2},
+    {"NEOY", 2}, {"NEOZ", 2}, {"NEPI", 2}, {"NEQS", 2}, {"NERH", 2}, {"NERL", 2},
+    {"NERY", 2}, {"NESK", 2}, {"NETM", 2}, {"NETP", 2}, {"NETU", 2}, {"NEVL", 2},
+    {"NEWU", 2}, {"NEXR", 2}, {"NEXX", 2}, {"NFAI", 2}, {"NFAN", 2}, {"NFAV", 2},
+    {"NFEB", 2}, {"NFIF", 2}, {"NFIX", 2}, {"NFLO", 2}, {"NFOC", 2}, {"NFOW", 2},
+    {"NFRA", 2}, {"NFUT", 2}, {"NGAO", 2}, {"NGAZ", 2}, {"NGBS", 2}, {"NGCF", 2},
+    {"NGCG", 2}, {"NGCS", 2}, {"NGDD", 2}, {"NGDT", 2}, {"NGEG", 2}, {"NGGQ", 2},
+    {"NGHI", 2}, {"NGHY", 2}, {"NGIA", 2}, {"NGIC", 2}, {"NGII", 2}, {"NGIW", 2},
+    {"NGJS", 2}, {"NGJU", 2}, {"NGMS", 2}, {"NGMY", 2}, {"NGNN", 2}, {"NGQE", 2},
+    {"NGSR", 2}, {"NGTX", 2}, {"NGVO", 2}, {"NGYA", 2}, {"NGZE", 2}, {"NGZO", 2},
+    {"NHEN", 2}, {"NHET", 2}, {"NHEW", 2}, {"NHHY", 2}, {"NHOR", 2}, {"NHOT", 2},
+    {"NHOU", 2}, {"NHYP", 2}, {"NIAW", 2}, {"NICM", 2}, {"NICV", 2}, {"NIDG", 2},
+    {"NIDT", 2}, {"NIFW", 2}, {"NINY", 2}, {"NIPR", 2}, {"NIRE", 2}, {"NIRI", 2},
+    {"NITG", 2}, {"NITN", 2}, {"NITP", 2}, {"NITV", 2}, {"NIUM", 2}, {"NIWA", 2},
+    {"NIWE", 2}, {"NIXD", 2}, {"NIXM", 2}, {"NIXN", 2}, {"NIXP", 2}, {"NIXU", 2},
+    {"NJEC", 2}, {"NJOY", 2}, {"NJUR", 2}, {"NKBU", 2}, {"NKDE", 2}, {"NKFI", 2},
+    {"NKHE", 2}, {"NKIS", 2}, {"NKMA", 2}, {"NKTW", 2}, {"NKWH", 2}, {"NLAW", 2},
+    {"NLCH", 2}, {"NLDO", 2}, {"NLEC", 2}, {"NLIT", 2}, {"NLLI", 2}, {"NLTO", 2},
+    {"NMAG", 2}, {"NMAS", 2}, {"NMEM", 2}, {"NMES", 2}, {"NMOU", 2}, {"NMYS", 2},
+    {"NMYW", 2}, {"NNDA", 2}, {"NNED", 2}, {"NNEI", 2}, {"NNEN", 2}, {"NNET", 2},
+    {"NNIS", 2}, {"NNOB", 2}, {"NNOL", 2}, {"NNOY", 2}, {"NNRG", 2}, {"NOBI", 2},
+    {"NOBO", 2}, {"NOBV", 2}, {"NOCI", 2}, {"NODO", 2}, {"NOEX", 2}, {"NOFN", 2},
+    {"NOFU", 2}, {"NOHC", 2}, {"NOHL", 2}, {"NOIG", 2}, {"NONY", 2}, {"NOPL", 2},
+    {"NOPQ", 2}, {"NORN", 2}, {"NORY", 2}, {"NOSW", 2}, {"NOTQ", 2}, {"NOWJ", 2},
+    {"NOYI", 2}, {"NPGR", 2}, {"NPHI", 2}, {"NPIX", 2}, {"NPNQ", 2}, {"NPPU", 2},
+    {"NPRA", 2}, {"NPTH", 2}, {"NPYT", 2}, {"NQCA", 2}, {"NQIS", 2}, {"NQNR", 2},
+    {"NRAD", 2}, {"NRFR", 2}, {"NROM", 2}, {"NRUS", 2}, {"NRWE", 2}, {"NSAA", 2},
+    {"NSAY", 2}, {"NSBR", 2}, {"NSCB", 2}, {"NSCC", 2}, {"NSCE", 2}, {"NSDA", 2},
+    {"NSFL", 2}, {"NSGL", 2}, {"NSGO", 2}, {"NSIL", 2}, {"NSIV", 2}, {"NSIZ", 2},
+    {"NSKI", 2}, {"NSMU", 2}, {"NSNI", 2}, {"NSOH", 2}, {"NSOI", 2}, {"NSRU", 2},
+    {"NSSK", 2}, {"NSSY", 2}, {"NSTB", 2}, {"NSTC", 2}, {"NSTS", 2}, {"NSUF", 2},
+    {"NSWO", 2}, {"NSXL", 2}, {"NSXT", 2}, {"NSYE", 2}, {"NTAV", 2}, {"NTCE", 2},
+    {"NTCF", 2}, {"NTDA", 2}, {"NTEF", 2}, {"NTFA", 2}, {"NTHT", 2}, {"NTIH", 2},
+    {"NTIP", 2}, {"NTIW", 2}, {"NTKI", 2}, {"NTLH", 2}, {"NTOJ", 2}, {"NTOQ", 2},
+    {"NTQT", 2}, {"NTSV", 2}, {"NTUT", 2}, {"NUAP", 2}, {"NUBE", 2}, {"NUEB", 2},
+    {"NUEC", 2}, {"NUEO", 2}, {"NUEP", 2}, {"NUEW", 2}, {"NUEX", 2}, {"NUFA", 2},
+    {"NUIF", 2}, {"NULA", 2}, {"NUMA", 2}, {"NUMI", 2}, {"NUNF", 2}, {"NUOF", 2},
+    {"NUON", 2}, {"NUOT", 2}, {"NUPA", 2}, {"NVAN", 2}, {"NVCO", 2}, {"NVES", 2},
+    {"NVII", 2}, {"NWAN", 2}, {"NWAY", 2}, {"NWEH", 2}, {"NWEM", 2}, {"NWRA", 2},
+    {"NXLI", 2}, {"NXXD", 2}, {"NXYZ", 2}, {"NYAM", 2}, {"NYAU", 2}, {"NYCU", 2},
+    {"NYDO", 2}, {"NYER", 2}, {"NYES", 2}, {"NYHO", 2}, {"NYIR", 2}, {"NYMI", 2},
+    {"NYSC", 2}, {"NYSI", 2}, {"NYSL", 2}, {"NYSY", 2}, {"OABU", 2}, {"OACE", 2},
+    {"OACL", 2}, {"OADB", 2}, {"OADC", 2}, {"OADP", 2}, {"OAEC", 2}, {"OAEN", 2},
+    {"OAFF", 2}, {"OAFL", 2}, {"OAHI", 2}, {"OAJS", 2}, {"OAMA", 2}, {"OAMO", 2},
+    {"OANG", 2}, {"OAPI", 2}, {"OAPL", 2}, {"OASF", 2}, {"OASH", 2}, {"OASO", 2},
+    {"OASW", 2}, {"OATH", 2}, {"OATL", 2}, {"OATY", 2}, {"OAVT", 2}, {"OAWO", 2},
+    {"OBFR", 2}, {"OBFU", 2}, {"OBIG", 2}, {"OBIT", 2}, {"OBOF", 2}, {"OBOR", 2},
+    {"OBOW", 2}, {"OBSP", 2}, {"OBUF", 2}, {"OBUI", 2}, {"OBYA", 2}, {"OCCO", 2},
+    {"OCDI", 2}, {"OCHD", 2}, {"OCIE", 2}, {"OCIN", 2}, {"OCIW", 2}, {"OCKF", 2},
+    {"OCKH", 2}, {"OCKU", 2}, {"OCOD", 2}, {"OCTW", 2}, {"OCUL", 2}, {"ODAL", 2},
+    {"ODCH", 2}, {"ODDA", 2}, {"ODEK", 2}, {"ODIV", 2}, {"ODJO", 2}, {"ODNE", 2},
+    {"ODOC", 2}, {"ODPR", 2}, {"ODQU", 2}, {"ODSA", 2}, {"ODSF", 2}, {"ODST", 2},
+    {"ODSY", 2}, {"ODYE", 2}, {"ODYH", 2}, {"ODYR", 2}, {"OEMP", 2}, {"OESE", 2},
+    {"OESH", 2}, {"OESM", 2}, {"OETH", 2}, {"OEVI", 2}, {"OEWH", 2}, {"OEXM", 2},
+    {"OFAY", 2}, {"OFCE", 2}, {"OFEF", 2}, {"OFEM", 2}, {"OFFN", 2}, {"OFGE", 2},
+    {"OFGI", 2}, {"OFGU", 2}, {"OFID", 2}, {"OFOF", 2}, {"OFSM", 2}, {"OFSN", 2},
+    {"OFSW", 2}, {"OFTC", 2}, {"OFTV", 2}, {"OFUL", 2}, {"OFUM", 2}, {"OFVO", 2},
+    {"OGAI", 2}, {"OGAT", 2}, {"OGNO", 2}, {"OGOD", 2}, {"OGOL", 2}, {"OGSA", 2},
+    {"OGUU", 2}, {"OHCR", 2}, {"OHFI", 2}, {"OHIN", 2}, {"OHIT", 2}, {"OHLN", 2},
+    {"OHLS", 2}, {"OHLT", 2}, {"OHNH", 2}, {"OHTH", 2}, {"OIDC", 2}, {"OIDG", 2},
+    {"OIDU", 2}, {"OIFA", 2}, {"OIFO", 2}, {"OILB", 2}, {"OILC", 2}, {"OILL", 2},
+    {"OISL", 2}, {"OISU", 2}, {"OITN", 2}, {"OITP", 2}, {"OITU", 2}, {"OITV", 2},
+    {"OJTA", 2}, {"OJUD", 2}, {"OKAB", 2}, {"OKAL", 2}, {"OKAP", 2}, {"OKBA", 2},
+    {"OKBY", 2}, {"OKEA", 2}, {"OKEI", 2}, {"OKEY", 2}, {"OKHE", 2}, {"OKON", 2},
+    {"OKSA", 2}, {"OKSB", 2}, {"OKSE", 2}, {"OKSI", 2}, {"OKSN", 2}, {"OKSR", 2},
+    {"OKSU", 2}, {"OKSV", 2}, {"OLCH", 2}, {"OLDH", 2}, {"OLDZ", 2}, {"OLFL", 2},
+    {"OLFO", 2}, {"OLHO", 2}, {"OLIE", 2}, {"OLLH", 2}, {"OLLL", 2}, {"OLLR", 2},
+    {"OLOW", 2}, {"OLRE", 2}, {"OLSF", 2}, {"OLSI", 2}, {"OLSS", 2}, {"OLTE", 2},
+    {"OLTO", 2}, {"OMBT", 2}, {"OMDT", 2}, {"OMFO", 2}, {"OMHA", 2}, {"OMID", 2},
+    {"OMLA", 2}, {"OMLU", 2}, {"OMNE", 2}, {"OMQU", 2}, {"OMSD", 2}, {"OMTA", 2},
+    {"OMUT", 2}, {"ONAI", 2}, {"ONBD", 2}, {"ONCU", 2}, {"ONCW", 2}, {"ONDK", 2},
+    {"ONDY", 2}, {"ONGK", 2}, {"ONGN", 2}, {"ONGP", 2}, {"ONIO", 2}, {"ONIU", 2},
+    {"ONJE", 2}, {"ONJO", 2}, {"ONOM", 2}, {"ONPI", 2}, {"ONQU", 2}, {"ONXL", 2},
+    {"ONXS", 2}, {"ONYT", 2}, {"OOBT", 2}, {"OOBU", 2}, {"OOCO", 2}, {"OODH", 2},
+    {"OODJ", 2}, {"OODP", 2}, {"OODQ", 2}, {"OODV", 2}, {"OOEA", 2}, {"OOFE", 2},
+    {"OOFW", 2}, {"OOIF", 2}, {"OOIM", 2}, {"OOKH", 2}, {"OOKP", 2}, {"OOLF", 2},
+    {"OOLH", 2}, {"OONU", 2}, {"OONW", 2}, {"OOOB", 2}, {"OORH", 2}, {"OORP", 2},
+    {"OORR", 2}, {"OOSI", 2}, {"OOST", 2}, {"OOTA", 2}, {"OOTD", 2}, {"OOTI", 2},
+    {"OOTM", 2}, {"OOUS", 2}, {"OPAI", 2}, {"OPBU", 2}, {"OPCH", 2}, {"OPCO", 2},
+    {"OPEB", 2}, {"OPEC", 2}, {"OPEI", 2}, {"OPFI", 2}, {"OPIX", 2}, {"OPMO", 2},
+    {"OPON", 2}, {"OPOT", 2}, {"OPOU", 2}, {"OPOV", 2}, {"OPPL", 2}, {"OPQR", 2},
+    {"OPSE", 2}, {"OPSH", 2}, {"OPSU", 2}, {"OPSV", 2}, {"OPSW", 2}, {"OPTA", 2},
+    {"OPTE", 2}, {"OPTN", 2}, {"OPTT", 2}, {"OPUB", 2}, {"OQAR", 2}, {"ORAZ", 2},
+    {"ORBF", 2}, {"ORBP", 2}, {"ORCM", 2}, {"ORCW", 2}, {"ORDG", 2}, {"OREK", 2},
+    {"ORGN", 2}, {"ORIV", 2}, {"ORJO", 2}, {"ORKK", 2}, {"ORMB", 2}, {"ORMH", 2},
+    {"ORNR", 2}, {"OROC", 2}, {"ORRM", 2}, {"ORXT", 2}, {"ORYD", 2}, {"ORYG", 2},
+    {"OSAR", 2}, {"OSCA", 2}, {"OSCM", 2}, {"OSDE", 2}, {"OSEH", 2}, {"OSHT", 2},
+    {"OSID", 2}, {"OSLI", 2}, {"OSOB", 2}, {"OSOE", 2}, {"OSOL", 2}, {"OSSF", 2},
+    {"OSSN", 2}, {"OSUE", 2}, {"OSUS", 2}, {"OTAU", 2}, {"OTAW", 2}, {"OTBL", 2},
+    {"OTCR", 2}, {"OTEH", 2}, {"OTIR", 2}, {"OTIS", 2}, {"OTLG", 2}, {"OTMP", 2},
+    {"OTOL", 2}, {"OTPL", 2}, {"OTTA", 2}, {"OTYO", 2}, {"OUAT", 2}, {"OUAV", 2},
+    {"OUEI", 2}, {"OUFA", 2}, {"OUGI", 2}, {"OULA", 2}, {"OUNF", 2}, {"OUNP", 2},
+    {"OUOP", 2}, {"OUPD", 2}, {"OUPV", 2}, {"OUPW", 2}, {"OUTQ", 2}, {"OUTX", 2},
+    {"OVAB", 2}, {"OVEX", 2}, {"OVIC", 2}, {"OWAD", 2}, {"OWAI", 2}, {"OWAM", 2},
+    {"OWAU", 2}, {"OWBR", 2}, {"OWCI", 2}, {"OWCL", 2}, {"OWDT", 2}, {"OWEC", 2},
+    {"OWEN", 2}, {"OWET", 2}, {"OWEW", 2}, {"OWIC", 2}, {"OWJU", 2}, {"OWKN", 2},
+    {"OWND", 2}, {"OWNG", 2}, {"OWOT", 2}, {"OWTW", 2}, {"OWUN", 2}, {"OWYE", 2},
+    {"OXCO", 2}, {"OXIM", 2}, {"OXYO", 2}, {"OYON", 2}, {"OYTH", 2}, {"PABB", 2},
+    {"PACO", 2}, {"PAFT", 2}, {"PALC", 2}, {"PALI", 2}, {"PALO", 2}, {"PANA", 2},
+    {"PAPP", 2}, {"PAUN", 2}, {"PAYC", 2}, {"PAZA", 2}, {"PBAR", 2}, {"PBEI", 2},
+    {"PBYA", 2}, {"PCAS", 2}, {"PCEN", 2}, {"PCLO", 2}, {"PCPO", 2}, {"PCRE", 2},
+    {"PCTA", 2}, {"PDEL", 2}, {"PDES", 2}, {"PDIF", 2}, {"PDIN", 2}, {"PDRA", 2},
+    {"PDTH", 2}, {"PEAL", 2}, {"PEAM", 2}, {"PEAU", 2}, {"PEAY", 2}, {"PECA", 2},
+    {"PEDD", 2}, {"PEDF", 2}, {"PEDU", 2}, {"PEEX", 2}, {"PEHA", 2}, {"PEIA", 2},
+    {"PELS", 2}, {"PEMO", 2}, {"PENC", 2}, {"PENM", 2}, {"PESE", 2}, {"PESJ", 2},
+    {"PETO", 2}, {"PEUS", 2}, {"PEUT", 2}, {"PEVA", 2}, {"PEWA", 2}, {"PEXC", 2},
+    {"PEXI", 2}, {"PEXX", 2}, {"PFIV", 2}, {"PFNO", 2}, {"PFOL", 2}, {"PGIV", 2},
+    {"PGQQ", 2}, {"PHAC", 2}, {"PHAL", 2}, {"PHFO", 2}, {"PHGE", 2}, {"PHIA", 2},
+    {"PHIG", 2}, {"PHOF", 2}, {"PHOR", 2}, {"PHPL", 2}, {"PHPO", 2}, {"PHRA", 2},
+    {"PHSD", 2}, {"PHSN", 2}, {"PHSS", 2}, {"PHSW", 2}, {"PHTO", 2}, {"PHYF", 2},
+    {"PHYI", 2}, {"PHYO", 2}, {"PIFH", 2}, {"PIGC", 2}, {"PILO", 2}, {"PINC", 2},
+    {"PINM", 2}, {"PINP", 2}, {"PIRA", 2}, {"PIRE", 2}, {"PISC", 2}, {"PISO", 2},
+    {"PISS", 2}, {"PISU", 2}, {"PITF", 2}, {"PITL", 2}, {"PITT", 2}, {"PIVT", 2},
+    {"PJUS", 2}, {"PLCA", 2}, {"PLCL", 2}, {"PLCO", 2}, {"PLHT", 2}, {"PLSE", 2},
+    {"PLTO", 2}, {"PLWI", 2}, {"PLYN", 2}, {"PMAD", 2}, {"PMAT", 2}, {"PMOR", 2},
+    {"PMOS", 2}, {"PMTH", 2}, {"PNES", 2}, {"PNEW", 2}, {"PNEX", 2}, {"PNQN", 2},
+    {"PNUM", 2}, {"POCO", 2}, {"POFI", 2}, {"POFM", 2}, {"POFR", 2}, {"POFW", 2},
+    {"POFY", 2}, {"POIL", 2}, {"POLA", 2}, {"PONG", 2}, {"PONN", 2}, {"PONV", 2},
+    {"POOP", 2}, {"POPA", 2}, {"POPS", 2}, {"PORD", 2}, {"PORG", 2}, {"PORI", 2},
+    {"POSD", 2}, {"POSM", 2}, {"POSP", 2}, {"POWN", 2}, {"PPDB", 2}, {"PPDT", 2},
+    {"PPLA", 2}, {"PPLU", 2}, {"PPRI", 2}, {"PPSE", 2}, {"PPST", 2}, {"PPTH", 2},
+    {"PQGQ", 2}, {"PQTH", 2}, {"PREM", 2}, {"PRGM", 2}, {"PRIZ", 2}, {"PRON", 2},
+    {"PRRT", 2}, {"PRSE", 2}, {"PRTO", 2}, {"PRWI", 2}, {"PSAL", 2}, {"PSAU", 2},
+    {"PSBU", 2}, {"PSCE", 2}, {"PSDI", 2}, {"PSED", 2}, {"PSHO", 2}, {"PSID", 2},
+    {"PSLI", 2}, {"PSLO", 2}, {"PSQT", 2}, {"PSQU", 2}, {"PSSO", 2}, {"PSUP", 2},
+    {"PTAF", 2}, {"PTAT", 2}, {"PTAU", 2}, {"PTBY", 2}, {"PTEC", 2}, {"PTEM", 2},
+    {"PTES", 2}, {"PTHO", 2}, {"PTIB", 2}, {"PTLE", 2}, {"PTMO", 2}, {"PTOB", 2},
+    {"PTOD", 2}, {"PTOE", 2}, {"PTOM", 2}, {"PTPE", 2}, {"PTSC", 2}, {"PTSN", 2},
+    {"PTSR", 2}, {"PTTA", 2}, {"PTTE", 2}, {"PTUN", 2}, {"PTYA", 2}, {"PTYF", 2},
+    {"PTYR", 2}, {"PUPB", 2}, {"PUPD", 2}, {"PUPL", 2}, {"PUPO", 2}, {"PUSI", 2},
+    {"PUTD", 2}, {"PVER", 2}, {"PVIT", 2}, {"PWAT", 2}, {"PWOR", 2}, {"PWRA", 2},
+    {"PXII", 2}, {"PXTH", 2}, {"PYCO", 2}, {"PYCQ", 2}, {"PYEV", 2}, {"PYFO", 2},
+    {"PYIS", 2}, {"PYLI", 2}, {"PYOB", 2}, {"PYPA", 2}, {"PYPR", 2}, {"PYSO", 2},
+    {"PYVI", 2}, {"QAST", 2}, {"QCAN", 2}, {"QCBE", 2}, {"QEFQ", 2}, {"QEXE", 2},
+    {"QFLI", 2}, {"QFOR", 2}, {"QFOU", 2}, {"QGGG", 2}, {"QINS", 2}, {"QJTH", 2},
+    {"QLIE", 2}, {"QPLU", 2}, {"QPRE", 2}, {"QQUI", 2}, {"QRIN", 2}, {"QRSA", 2},
+    {"QSCU", 2}, {"QSTO", 2}, {"QTRV", 2}, {"QUAI", 2}, {"QUID", 2}, {"QUIF", 2},
+    {"QUMA", 2}, {"QVIM", 2}, {"QWHA", 2}, {"QYOU", 2}, {"RAAA", 2}, {"RAAN", 2},
+    {"RABT", 2}, {"RACA", 2}, {"RACI", 2}, {"RADM", 2}, {"RADV", 2}, {"RAGS", 2},
+    {"RAGU", 2}, {"RAHI", 2}, {"RAKE", 2}, {"RALG", 2}, {"RALH", 2}, {"RALV", 2},
+    {"RANX", 2}, {"RAPV", 2}, {"RAPW", 2}, {"RART", 2}, {"RASF", 2}, {"RASN", 2},
+    {"RATB", 2}, {"RATM", 2}, {"RATN", 2}, {"RATW", 2}, {"RAUN", 2}, {"RAUS", 2},
+    {"RAVO", 2}, {"RAWB", 2}, {"RAWR", 2}, {"RAXI", 2}, {"RAYD", 2}, {"RAYG", 2},
+    {"RAYN", 2}, {"RAYR", 2}, {"RAZA", 2}, {"RBEY", 2}, {"RBFO", 2}, {"RBIC", 2},
+    {"RBOA", 2}, {"RBRI", 2}, {"RBSA", 2}, {"RBSC", 2}, {"RBUN", 2}, {"RBYB", 2},
+    {"RBYE", 2}, {"RBYM", 2}, {"RBYV", 2}, {"RCAC", 2}, {"RCCB", 2}, {"RCHN", 2},
+    {"RCHQ", 2}, {"RCHU", 2}, {"RCMS", 2}, {"RCOI", 2}, {"RCOS", 2}, {"RCPA", 2},
+    {"RCPU", 2}, {"RCRO", 2}, {"RCST", 2}, {"RCSW", 2}, {"RCTA", 2}, {"RCVI", 2},
+    {"RCWH", 2}, {"RCWI", 2}, {"RCWT", 2}, {"RDAD", 2}, {"RDAF", 2}, {"RDAL", 2},
+    {"RDAX", 2}, {"RDCP", 2}, {"RDCT", 2}, {"RDCW", 2}, {"RDDR", 2}, {"RDEE", 2},
+    {"RDGR", 2}, {"RDHD", 2}, {"RDHI", 2}, {"RDIG", 2}, {"RDIV", 2}, {"RDLO", 2},
+    {"RDNA", 2}, {"RDOM", 2}, {"RDRE", 2}, {"RDSX", 2}, {"RDTY", 2}, {"RDUR", 2},
+    {"RDUT", 2}, {"REAA", 2}, {"REAH", 2}, {"REAQ", 2}, {"REBN", 2}, {"REEZ", 2},
+    {"REFY", 2}, {"REHY", 2}, {"REIH", 2}, {"REIU", 2}, {"REJO", 2}, {"REKN", 2},
+    {"REMT", 2}, {"RENI", 2}, {"RENV", 2}, {"REOC", 2}, {"RERC", 2}, {"RERF", 2},
+    {"RERM", 2}, {"RESD", 2}, {"RESL", 2}, {"RESN", 2}, {"RETS", 2}, {"REVD", 2},
+    {"REVF", 2}, {"REVW", 2}, {"REWB", 2}, {"REWM", 2}, {"REXU", 2}, {"REYC", 2},
+    {"REYI", 2}, {"REYT", 2}, {"RFAL", 2}, {"RFAS", 2}, {"RFFO", 2}, {"RFIB", 2},
+    {"RFIF", 2}, {"RFIX", 2}, {"RFLU", 2}, {"RFON", 2}, {"RFRA", 2}, {"RFUS", 2},
+    {"RGCC", 2}, {"RGGE", 2}, {"RGMA", 2}, {"RGMP", 2}, {"RGNE", 2}, {"RGNO", 2},
+    {"RGOL", 2}, {"RGOO", 2}, {"RGRM", 2}, {"RGSA", 2}, {"RGTI", 2}, {"RHEH", 2},
+    {"RHEX", 2}, {"RHOO", 2}, {"RHOS", 2}, {"RHUN", 2}, {"RIAF", 2}, {"RIAO", 2},
+    {"RIBD", 2}, {"RIBL", 2}, {"RIDA", 2}, {"RIFB", 2}, {"RIFF", 2}, {"RIFL", 2},
+    {"RIFV", 2}, {"RIFW", 2}, {"RIIA", 2}, {"RIIL", 2}, {"RIMT", 2}, {"RINH", 2},
+    {"RINL", 2}, {"RISJ", 2}, {"RISV", 2}, {"RITL", 2}, {"RITV", 2}, {"RJAV", 2},
+    {"RKAB", 2}, {"RKAC", 2}, {"RKAD", 2}, {"RKAT", 2}, {"RKBE", 2}, {"RKBL", 2},
+    {"RKBO", 2}, {"RKCI", 2}, {"RKDU", 2}, {"RKFU", 2}, {"RKKN", 2}, {"RKLA", 2},
+    {"RKLE", 2}, {"RKOC", 2}, {"RKOT", 2}, {"RKSR", 2}, {"RKSV", 2}, {"RKWE", 2},
+    {"RLAI", 2}, {"RLAR", 2}, {"RLAW", 2}, {"RLAY", 2}, {"RLDF", 2}, {"RLDM", 2},
+    {"RLDS", 2}, {"RLDT", 2}, {"RLFA", 2}, {"RLFI", 2}, {"RLFT", 2}, {"RLGT", 2},
+    {"RLHT", 2}, {"RLII", 2}, {"RLIQ", 2}, {"RLIV", 2}, {"RLLN", 2}, {"RLLO", 2},
+    {"RLNO", 2}, {"RLPA", 2}, {"RLPO", 2}, {"RLPS", 2}, {"RLPT", 2}, {"RLPV", 2},
+    {"RLRV", 2}, {"RLSH", 2}, {"RLUA", 2}, {"RLUC", 2}, {"RLUM", 2}, {"RLUT", 2},
+    {"RLVA", 2}, {"RLVE", 2}, {"RLVY", 2}, {"RLWB", 2}, {"RLWF", 2}, {"RLWH", 2},
+    {"RLWJ", 2}, {"RLYG", 2}, {"RLYH", 2}, {"RLYM", 2}, {"RLZT", 2}, {"RMAG", 2},
+    {"RMAM", 2}, {"RMAU", 2}, {"RMBY", 2}, {"RMEL", 2}, {"RMEM", 2}, {"RMFG", 2},
+    {"RMFR", 2}, {"RMHO", 2}, {"RMIC", 2}, {"RMLE", 2}, {"RMLI", 2}, {"RMMU", 2},
+    {"RMNB", 2}, {"RMOU", 2}, {"RMQU", 2}, {"RMRF", 2}, {"RMSR", 2}, {"RMTO", 2},
+    {"RMYE", 2}, {"RNAC", 2}, {"RNAR", 2}, {"RNBU", 2}, {"RNBY", 2}, {"RNCA", 2},
+    {"RNDA", 2}, {"RNEC", 2}, {"RNEY", 2}, {"RNFR", 2}, {"RNHO", 2}, {"RNIG", 2},
+    {"RNLT", 2}, {"RNMO", 2}, {"RNNE", 2}, {"RNOH", 2}, {"RNOM", 2}, {"RNRC", 2},
+    {"RNRI", 2}, {"RNSH", 2}, {"RNSL", 2}, {"RNSM", 2}, {"RNSO", 2}, {"RNTX", 2},
+    {"RNUS", 2}, {"RNVA", 2}, {"ROBT", 2}, {"ROBV", 2}, {"ROBY", 2}, {"RODE", 2},
+    {"ROFK", 2}, {"ROGI", 2}, {"ROGM", 2}, {"ROJS", 2}, {"ROJT", 2}, {"ROLD", 2},
+    {"ROLF", 2}, {"ROLI", 2}, {"RONF", 2}, {"RONS", 2}, {"ROOR", 2}, {"ROPD", 2},
+    {"ROPF", 2}, {"ROSH", 2}, {"ROTA", 2}, {"ROTI", 2}, {"ROTR", 2}, {"ROTT", 2},
+    {"ROVD", 2}, {"ROXI", 2}, {"ROYI", 2}, {"RPAI", 2}, {"RPEE", 2}, {"RPEO", 2},
+    {"RPHI", 2}, {"RPIC", 2}, {"RPLI", 2}, {"RPNO", 2}, {"RPTA", 2}, {"RPTF", 2},
+    {"RPTI", 2}, {"RPTP", 2}, {"RQPL", 2}, {"RRAW", 2}, {"RREJ", 2}, {"RRIA", 2},
+    {"RRIB", 2}, {"RRIT", 2}, {"RRMU", 2}, {"RROD", 2}, {"RRTE", 2}, {"RRYO", 2},
+    {"RRYT", 2}, {"RRYU", 2}, {"RSAF", 2}, {"RSBL", 2}, {"RSCB", 2}, {"RSCS", 2},
+    {"RSCT", 2}, {"RSEI", 2}, {"RSEQ", 2}, {"RSEW", 2}, {"RSIB", 2}, {"RSLO", 2},
+    {"RSOG", 2}, {"RSOP", 2}, {"RSPU", 2}, {"RSRA", 2}, {"RSTX", 2}, {"RSUE", 2},
+    {"RSVE", 2}, {"RTAD", 2}, {"RTBL", 2}, {"RTCD", 2}, {"RTCR", 2}, {"RTEQ", 2},
+    {"RTGE", 2}, {"RTHM", 2}, {"RTIV", 2}, {"RTPR", 2}, {"RTSD", 2}, {"RTTA", 2},
+    {"RTTI", 2}, {"RTTY", 2}, {"RTUI", 2}, {"RTWR", 2}, {"RTYG", 2}, {"RTZI", 2},
+    {"RUAR", 2}, {"RUBR", 2}, {"RUCK", 2}, {"RUEP", 2}, {"RULI", 2}, {"RUNB", 2},
+    {"RUNK", 2}, {"RUNU", 2}, {"RUNV", 2}, {"RUNY", 2}, {"RUPL", 2}, {"RUPP", 2},
+    {"RUPW", 2}, {"RUSA", 2}, {"RUTM", 2}, {"RVAC", 2}, {"RVDA", 2}, {"RVEM", 2},
+    {"RVEW", 2}, {"RVFR", 2}, {"RVIL", 2}, {"RVOI", 2}, {"RVTH", 2}, {"RVTO", 2},
+    {"RWCR", 2}, {"RWCT", 2}, {"RWEA", 2}, {"RWEC", 2}, {"RWEH", 2}, {"RWEI", 2},
+    {"RWEL", 2}, {"RWEM", 2}, {"RWFI", 2}, {"RWHY", 2}, {"RWPP", 2}, {"RWSE", 2},
+    {"RWTH", 2}, {"RXTE", 2}, {"RXTH", 2}, {"RXVI", 2}, {"RXWH", 2}, {"RYAF", 2},
+    {"RYCE", 2}, {"RYCT", 2}, {"RYDB", 2}, {"RYEG", 2}, {"RYER", 2}, {"RYEV", 2},
+    {"RYGP", 2}, {"RYOP", 2}, {"RYOT", 2}, {"RYRR", 2}, {"RYSH", 2}, {"RYSK", 2},
+    {"RYSL", 2}, {"RYSN", 2}, {"RYTM", 2}, {"RYVE", 2}, {"SABM", 2}, {"SABR", 2},
+    {"SACD", 2}, {"SACP", 2}, {"SACQ", 2}, {"SADA", 2}, {"SADM", 2}, {"SAFL", 2},
+    {"SAGD", 2}, {"SAHA", 2}, {"SAHE", 2}, {"SAHI", 2}, {"SAIR", 2}, {"SAIT", 2},
+    {"SAKA", 2}, {"SALC", 2}, {"SAMB", 2}, {"SANF", 2}, {"SANH", 2}, {"SANN", 2},
+    {"SAON", 2}, {"SAPE", 2}, {"SAPH", 2}, {"SAPO", 2}, {"SARC", 2}, {"SARR", 2},
+    {"SART", 2}, {"SASG", 2}, {"SASR", 2}, {"SATG", 2}, {"SATM", 2}, {"SATV", 2},
+    {"SAWB", 2}, {"SAXB", 2}, {"SAYH", 2}, {"SAYN", 2}, {"SBAD", 2}, {"SBEB", 2},
+    {"SBEW", 2}, {"SBME", 2}, {"SBUB", 2}, {"SBUI", 2}, {"SBUR", 2}, {"SBYG", 2},
+    {"SBYN", 2}, {"SCAM", 2}, {"SCDV", 2}, {"SCEL", 2}, {"SCEP", 2}, {"SCFO", 2},
+    {"SCMC", 2}, {"SCOC", 2}, {"SCOS", 2}, {"SCRT", 2}, {"SCRU", 2}, {"SCSE", 2},
+    {"SCSO", 2}, {"SCSS", 2}, {"SCUB", 2}, {"SCUO", 2}, {"SCUT", 2}, {"SDAG", 2},
+    {"SDAW", 2}, {"SDBY", 2}, {"SDEV", 2}, {"SDIN", 2}, {"SDOB", 2}, {"SDOR", 2},
+    {"SDOV", 2}, {"SEAV", 2}, {"SEBG", 2}, {"SECP", 2}, {"SEIA", 2}, {"SEID", 2},
+    {"SEJU", 2}, {"SELD", 2}, {"SELM", 2}, {"SEMS", 2}, {"SEMT", 2}, {"SENL", 2},
+    {"SEOC", 2}, {"SERY", 2}, {"SESK", 2}, {"SESQ", 2}, {"SEUR", 2}, {"SEYT", 2},
+    {"SEYW", 2}, {"SEZD", 2}, {"SEZE", 2}, {"SEZO", 2}, {"SFAC", 2}, {"SFAN", 2},
+    {"SFFI", 2}, {"SFIB", 2}, {"SFTO", 2}, {"SGAN", 2}, {"SGTH", 2}, {"SGTO", 2},
+    {"SHAC", 2}, {"SHAG", 2}, {"SHDG", 2}, {"SHEX", 2}, {"SHIM", 2}, {"SHNO", 2},
+    {"SHOP", 2}, {"SHOT", 2}, {"SHSC", 2}, {"SHSI", 2}, {"SHUG", 2}, {"SHUP", 2},
+    {"SHYP", 2}, {"SICF", 2}, {"SICP", 2}, {"SIDT", 2}, {"SIEN", 2}, {"SIFB", 2},
+    {"SIFN", 2}, {"SIFP", 2}, {"SIGA", 2}, {"SIIN", 2}, {"SIMO", 2}, {"SINK", 2},
+    {"SIRO", 2}, {"SISG", 2}, {"SISK", 2}, {"SISY", 2}, {"SIWE", 2}, {"SIXH", 2},
+    {"SIXM", 2}, {"SIXO", 2}, {"SIXP", 2}, {"SIXR", 2}, {"SIXW", 2}, {"SIZI", 2},
+    {"SJAN", 2}, {"SJOI", 2}, {"SKDO", 2}, {"SKIF", 2}, {"SKOF", 2}, {"SKST", 2},
+    {"SKSW", 2}, {"SKSY", 2}, {"SKTH", 2}, {"SKWH", 2}, {"SLIE", 2}, {"SLIP", 2},
+    {"SLIQ", 2}, {"SLRS", 2}, {"SLUM", 2}, {"SLYD", 2}, {"SLYF", 2}, {"SLYM", 2},
+    {"SLYO", 2}, {"SMAI", 2}, {"SMBU", 2}, {"SMCO", 2}, {"SMEF", 2}, {"SMEM", 2},
+    {"SMEX", 2}, {"SMGA", 2}, {"SMHJ", 2}, {"SMIC", 2}, {"SMID", 2}, {"SMMC", 2},
+    {"SMME", 2}, {"SMMI", 2}, {"SMMO", 2}, {"SMNA", 2}, {"SMNO", 2}, {"SMOA", 2},
+    {"SMPA", 2}, {"SMTA", 2}, {"SMTR", 2}, {"SMWI", 2}, {"SMYE", 2}, {"SMYN", 2},
+    {"SNEG", 2}, {"SNOB", 2}, {"SNOG", 2}, {"SNOO", 2}, {"SNPN", 2}, {"SNRA", 2},
+    {"SOAK", 2}, {"SOAM", 2}, {"SOAU", 2}, {"SOBU", 2}, {"SOEN", 2}, {"SOEO", 2},
+    {"SOKB", 2}, {"SOKY", 2}, {"SOLT", 2}, {"SONF", 2}, {"SONV", 2}, {"SOOD", 2},
+    {"SOPA", 2}, {"SOSU", 2}, {"SOTA", 2}, {"SOTE", 2}, {"SOTY", 2}, {"SOWA", 2},
+    {"SPGE", 2}, {"SPIN", 2}, {"SPSQ", 2}, {"SPTH", 2}, {"SQAN", 2}, {"SQTH", 2},
+    {"SQTR", 2}, {"SQWI", 2}, {"SRAT", 2}, {"SRCP", 2}, {"SREN", 2}, {"SREV", 2},
+    {"SRNO", 2}, {"SRTH", 2}, {"SSAB", 2}, {"SSAW", 2}, {"SSBL", 2}, {"SSCE", 2},
+    {"SSCU", 2}, {"SSDA", 2}, {"SSIC", 2}, {"SSJA", 2}, {"SSMI", 2}, {"SSNO", 2},
+    {"SSOP", 2}, {"SSOQ", 2}, {"SSOS", 2}, {"SSOV", 2}, {"SSOY", 2}, {"SSPI", 2},
+    {"SSPT", 2}, {"SSQU", 2}, {"SSRO", 2}, {"SSTU", 2}, {"SSTY", 2}, {"SSVI", 2},
+    {"SSVT", 2}, {"SSVU", 2}, {"SSYE", 2}, {"SSYG", 2}, {"SSYT", 2}, {"STAV", 2},
+    {"STAX", 2}, {"STBL", 2}, {"STBR", 2}, {"STCF", 2}, {"STCP", 2}, {"STDH", 2},
+    {"STDL", 2}, {"STDU", 2}, {"STEQ", 2}, {"STFL", 2}, {"STGA", 2}, {"STGN", 2},
+    {"STIE", 2}, {"STJU", 2}, {"STKN", 2}, {"STOQ", 2}, {"STRD", 2}, {"STRF", 2},
+    {"STRN", 2}, {"STRT", 2}, {"STRW", 2}, {"STSQ", 2}, {"STUD", 2}, {"STUX", 2},
+    {"STVE", 2}, {"STWR", 2}, {"STXB", 2}, {"SUBA", 2}, {"SUCK", 2}, {"SUEF", 2},
+    {"SUEI", 2}, {"SUGL", 2}, {"SUIN", 2}, {"SUKN", 2}, {"SUMS", 2}, {"SUNO", 2},
+    {"SUNP", 2}, {"SUNU", 2}, {"SUNW", 2}, {"SUPV", 2}, {"SUSC", 2}, {"SUSN", 2},
+    {"SVEH", 2}, {"SVIB", 2}, {"SVIC", 2}, {"SWAL", 2}, {"SWAR", 2}, {"SWEF", 2},
+    {"SWEH", 2}, {"SWEU", 2}, {"SWNE", 2}, {"SWPF", 2}, {"SWRA", 2}, {"SXAN", 2},
+    {"SXDE", 2}, {"SXLI", 2}, {"SXTO", 2}, {"SYES", 2}, {"SYGO", 2}, {"SYHE", 2},
+    {"SYPT", 2}, {"SYRU", 2}, {"SYVI", 2}, {"TABF", 2}, {"TABM", 2}, {"TACF", 2},
+    {"TACI", 2}, {"TAEX", 2}, {"TAFR", 2}, {"TAJO", 2}, {"TALU", 2}, {"TAMP", 2},
+    {"TAPI", 2}, {"TARX", 2}, {"TASL", 2}, {"TASN", 2}, {"TASR", 2}, {"TASU", 2},
+    {"TATR", 2}, {"TATS", 2}, {"TAXL", 2}, {"TAXN", 2}, {"TAXW", 2}, {"TAXY", 2},
+    {"TAYO", 2}, {"TBAK", 2}, {"TBAL", 2}, {"TBAN", 2}, {"TBCU", 2}, {"TBEV", 2},
+    {"TBIG", 2}, {"TBLI", 2}, {"TBOX", 2}, {"TBUN", 2}, {"TBVI", 2}, {"TBYB", 2},
+    {"TBYN", 2}, {"TBYU", 2}, {"TCAB", 2}, {"TCBU", 2}, {"TCBY", 2}, {"TCDE", 2},
+    {"TCFI", 2}, {"TCGE", 2}, {"TCHH", 2}, {"TCHV", 2}, {"TCIS", 2}, {"TCIT", 2},
+    {"TCLI", 2}, {"TCLU", 2}, {"TCNE", 2}, {"TCOA", 2}, {"TCOS", 2}, {"TCPO", 2},
+    {"TCPP", 2}, {"TCPW", 2}, {"TCRI", 2}, {"TCRT", 2}, {"TCSE", 2}, {"TCTO", 2},
+    {"TCUN", 2}, {"TDAR", 2}, {"TDAY", 2}, {"TDDI", 2}, {"TDDO", 2}, {"TDEE", 2},
+    {"TDIN", 2}, {"TDLI", 2}, {"TDOV", 2}, {"TDUP", 2}, {"TEBT", 2}, {"TECA", 2},
+    {"TECE", 2}, {"TEDX", 2}, {"TEEC", 2}, {"TEED", 2}, {"TEEP", 2}, {"TEFA", 2},
+    {"TEFG", 2}, {"TEFT", 2}, {"TEGF", 2}, {"TEHA", 2}, {"TEHR", 2}, {"TEIL", 2},
+    {"TEIM", 2}, {"TEJU", 2}, {"TEMR", 2}, {"TEOL", 2}, {"TEOU", 2}, {"TEOV", 2},
+    {"TEPI", 2}, {"TEPU", 2}, {"TETY", 2}, {"TEWC", 2}, {"TEWE", 2}, {"TFCO", 2},
+    {"TFER", 2}, {"TFFM", 2}, {"TFIE", 2}, {"TFLU", 2}, {"TFPE", 2}, {"TFSE", 2},
+    {"TFTE", 2}, {"TFTO", 2}, {"TGCO", 2}, {"TGEX", 2}, {"TGOB", 2}, {"TGOL", 2},
+    {"TGSM", 2}, {"THAK", 2}, {"THAX", 2}, {"THAY", 2}, {"THBI", 2}, {"THBT", 2},
+    {"THDD", 2}, {"THDO", 2}, {"THDR", 2}, {"THGQ", 2}, {"THGV", 2}, {"THHO", 2},
+    {"THIJ", 2}, {"THIO", 2}, {"THJY", 2}, {"THNA", 2}, {"THPL", 2}, {"THRT", 2},
+    {"THSS", 2}, {"THSW", 2}, {"THSY", 2}, {"THTM", 2}, {"THTN", 2}, {"THUB", 2},
+    {"THVO", 2}, {"THWE", 2}, {"THWY", 2}, {"THXC", 2}, {"THXP", 2}, {"THXX", 2},
+    {"THYE", 2}, {"THZC", 2}, {"THZO", 2}, {"TIAD", 2}, {"TIBI", 2}, {"TICD", 2},
+    {"TICF", 2}, {"TICW", 2}, {"TIDA", 2}, {"TIDG", 2}, {"TIEN", 2}, {"TIER", 2},
+    {"TIFE", 2}, {"TIHE", 2}, {"TILB", 2}, {"TILN", 2}, {"TILW", 2}, {"TIMS", 2},
+    {"TIOT", 2}, {"TIRI", 2}, {"TISJ", 2}, {"TISY", 2}, {"TITG", 2}, {"TITK", 2},
+    {"TITP", 2}, {"TIVA", 2}, {"TJAN", 2}, {"TJOB", 2}, {"TJUR", 2}, {"TKER", 2},
+    {"TLEX", 2}, {"TLGP", 2}, {"TLOG", 2}, {"TLYJ", 2}, {"TLYN", 2}, {"TMAC", 2},
+    {"TMEC", 2}, {"TMLG", 2}, {"TMNA", 2}, {"TMOA", 2}, {"TMPE", 2}, {"TMPF", 2},
+    {"TMPL", 2}, {"TMPT", 2}, {"TNAN", 2}, {"TNAR", 2}, {"TNIG", 2}, {"TNIN", 2},
+    {"TNOA", 2}, {"TNOO", 2}, {"TNOU", 2}, {"TNRF", 2}, {"TNTH", 2}, {"TOAJ", 2},
+    {"TOBV", 2}, {"TOBX", 2}, {"TOCU", 2}, {"TOEF", 2}, {"TOES", 2}, {"TOFQ", 2},
+    {"TOID", 2}, {"TOMN", 2}, {"TONR", 2}, {"TOOE", 2}, {"TOPJ", 2}, {"TOQC", 2},
+    {"TOSK", 2}, {"TOTQ", 2}, {"TOTS", 2}, {"TOWI", 2}, {"TOXC", 2}, {"TPCT", 2},
+    {"TPIC", 2}, {"TPIG", 2}, {"TPMO", 2}, {"TPOR", 2}, {"TPPA", 2}, {"TPTI", 2},
+    {"TPTP", 2}, {"TPUS", 2}, {"TPWI", 2}, {"TQFL", 2}, {"TQFO", 2}, {"TQFR", 2},
+    {"TQIN", 2}, {"TQIS", 2}, {"TQLI", 2}, {"TQWH", 2}, {"TRAH", 2}, {"TRCO", 2},
+    {"TREB", 2}, {"TRLQ", 2}, {"TRNR", 2}, {"TRUS", 2}, {"TRVA", 2}, {"TRWA", 2},
+    {"TRWM", 2}, {"TRWO", 2}, {"TRWS", 2}, {"TRWT", 2}, {"TRWV", 2}, {"TRYC", 2},
+    {"TRYG", 2}, {"TSBC", 2}, {"TSCT", 2}, {"TSEF", 2}, {"TSEG", 2}, {"TSFF", 2},
+    {"TSFL", 2}, {"TSFU", 2}, {"TSGN", 2}, {"TSHS", 2}, {"TSIH", 2}, {"TSKE", 2},
+    {"TSKN", 2}, {"TSKY", 2}, {"TSLA", 2}, {"TSNI", 2}, {"TSOA", 2}, {"TSOK", 2},
+    {"TSOS", 2}, {"TSQA", 2}, {"TSRQ", 2}, {"TSSA", 2}, {"TSSL", 2}, {"TSWA", 2},
+    {"TSWP", 2}, {"TSYE", 2}, {"TTAI", 2}, {"TTAS", 2}, {"TTEA", 2}, {"TTIR", 2},
+    {"TTIS", 2}, {"TTIT", 2}, {"TTMP", 2}, {"TTOQ", 2}, {"TTOX", 2}, {"TTPC", 2},
+    {"TTPP", 2}, {"TTTH", 2}, {"TTTI", 2}, {"TTTO", 2}, {"TTWH", 2}, {"TTYC", 2},
+    {"TTYE", 2}, {"TTYS", 2}, {"TUCO", 2}, {"TUEA", 2}, {"TUEL", 2}, {"TUIN", 2},
+    {"TUMA", 2}, {"TUNN", 2}, {"TUNP", 2}, {"TUPY", 2}, {"TVCO", 2}, {"TVEL", 2},
+    {"TVIB", 2}, {"TVOI", 2}, {"TVWI", 2}, {"TWAL", 2}, {"TWAV", 2}, {"TWEH", 2},
+    {"TWEM", 2}, {"TWPR", 2}, {"TXBL", 2}, {"TXCO", 2}, {"TXOF", 2}, {"TXVE", 2},
+    {"TXWH", 2}, {"TXYA", 2}, {"TXYF", 2}, {"TXYI", 2}, {"TYAD", 2}, {"TYAG", 2},
+    {"TYAU", 2}, {"TYBA", 2}, {"TYEA", 2}, {"TYEM", 2}, {"TYGR", 2}, {"TYHE", 2},
+    {"TYID", 2}, {"TYME", 2}, {"TYMU", 2}, {"TYNE", 2}, {"TYNU", 2}, {"TYPO", 2},
+    {"TYPU", 2}, {"TYSN", 2}, {"TYSO", 2}, {"TYUP", 2}, {"TYWA", 2}, {"TZER", 2},
+    {"TZHS", 2}, {"TZIP", 2}, {"TZLS", 2}, {"UADR", 2}, {"UANY", 2}, {"UAPR", 2},
+    {"UATT", 2}, {"UAVO", 2}, {"UBBE", 2}, {"UBCL", 2}, {"UBCM", 2}, {"UBCO", 2},
+    {"UBDO", 2}, {"UBEO", 2}, {"UBJO", 2}, {"UBTF", 2}, {"UBYM", 2}, {"UBYS", 2},
+    {"UCAT", 2}, {"UCEB", 2}, {"UCEC", 2}, {"UCEF", 2}, {"UCER", 2}, {"UCHY", 2},
+    {"UCKI", 2}, {"UCKO", 2}, {"UCLO", 2}, {"UCTD", 2}, {"UCTE", 2}, {"UCTH", 2},
+    {"UCTW", 2}, {"UDEB", 2}, {"UDEY", 2}, {"UDIR", 2}, {"UDOH", 2}, {"UDOS", 2},
+    {"UDSA", 2}, {"UDSF", 2}, {"UEAG", 2}, {"UEEV", 2}, {"UEFI", 2}, {"UEGE", 2},
+    {"UEKE", 2}, {"UEPE", 2}, {"UESB", 2}, {"UESH", 2}, {"UESL", 2}, {"UESP", 2},
+    {"UESY", 2}, {"UETC", 2}, {"UETR", 2}, {"UEUS", 2}, {"UFAC", 2}, {"UFAI", 2},
+    {"UFFB", 2}, {"UFFO", 2}, {"UFFY", 2}, {"UFLO", 2}, {"UFOU", 2}, {"UFVA", 2},
+    {"UGHD", 2}, {"UGHH", 2}, {"UGHJ", 2}, {"UGHR", 2}, {"UGIS", 2}, {"UGIV", 2},
+    {"UGOB", 2}, {"UGRA", 2}, {"UGSC", 2}, {"UGVI", 2}, {"UHAD", 2}, {"UHIT", 2},
+    {"UIDN", 2}, {"UIDT", 2}, {"UIDW", 2}, {"UIEV", 2}, {"UIFG", 2}, {"UIFI", 2},
+    {"UIFT", 2}, {"UIME", 2}, {"UIOF", 2}, {"UISR", 2}, {"UITV", 2}, {"ULCA", 2},
+    {"ULDJ", 2}, {"ULDY", 2}, {"ULEH", 2}, {"ULEV", 2}, {"ULEX", 2}, {"ULIC", 2},
+    {"ULIT", 2}, {"ULKA", 2}, {"ULLJ", 2}, {"ULLV", 2}, {"ULLW", 2}, {"ULME", 2},
+    {"ULMO", 2}, {"ULOA", 2}, {"ULOO", 2}, {"ULOP", 2}, {"ULOR", 2}, {"ULOU", 2},
+    {"ULTG", 2}, {"ULYD", 2}, {"UMAI", 2}, {"UMDU", 2}, {"UMGE", 2}, {"UMGR", 2},
+    {"UMIC", 2}, {"UMIE", 2}, {"UMLE", 2}, {"UMME", 2}, {"UMMN", 2}, {"UMMU", 2},
+    {"UMND", 2}, {"UMNW", 2}, {"UMNY", 2}, {"UMPE", 2}, {"UMPN", 2}, {"UMPW", 2},
+    {"UMRN", 2}, {"UMSC", 2}, {"UMSG", 2}, {"UMSS", 2}, {"UMSY", 2}, {"UMTI", 2},
+    {"UMUN", 2}, {"UMVI", 2}, {"UMWO", 2}, {"UNBE", 2}, {"UNBY", 2}, {"UNCB", 2},
+    {"UNED", 2}, {"UNFA", 2}, {"UNFI", 2}, {"UNGE", 2}, {"UNNA", 2}, {"UNNE", 2},
+    {"UNNO", 2}, {"UNOL", 2}, {"UNPE", 2}, {"UNSE", 2}, {"UNTF", 2}, {"UNTG", 2},
+    {"UNTP", 2}, {"UNTU", 2}, {"UNVE", 2}, {"UNWH", 2}, {"UNWO", 2}, {"UNYO", 2},
+    {"UOAN", 2}, {"UONE", 2}, {"UOPT", 2}, {"UORC", 2}, {"UORP", 2}, {"UOWI", 2},
+    {"UPAU", 2}, {"UPAW", 2}, {"UPBE", 2}, {"UPBY", 2}, {"UPCE", 2}, {"UPCL", 2},
+    {"UPEV", 2}, {"UPIE", 2}, {"UPMA", 2}, {"UPNI", 2}, {"UPSL", 2}, {"UPSO", 2},
+    {"UPSR", 2}, {"UPSS", 2}, {"UPTT", 2}, {"UPUT", 2}, {"URBI", 2}, {"URBL", 2},
+    {"URBR", 2}, {"UREG", 2}, {"UREQ", 2}, {"URIE", 2}, {"URNM", 2}, {"URNR", 2},
+    {"URNV", 2}, {"UROU", 2}, {"URSG", 2}, {"URTA", 2}, {"URWE", 2}, {"URYR", 2},
+    {"USAB", 2}, {"USAM", 2}, {"USCE", 2}, {"USEJ", 2}, {"USEQ", 2}, {"USFA", 2},
+    {"USHT", 2}, {"USLE", 2}, {"USMU", 2}, {"USOI", 2}, {"USRX", 2}, {"USTY", 2},
+    {"USUN", 2}, {"USUP", 2}, {"USVA", 2}, {"USWO", 2}, {"UTAU", 2}, {"UTAW", 2},
+    {"UTCL", 2}, {"UTEB", 2}, {"UTEQ", 2}, {"UTGL", 2}, {"UTIC", 2}, {"UTIP", 2},
+    {"UTKN", 2}, {"UTOB", 2}, {"UTOQ", 2}, {"UTOV", 2}, {"UTOW", 2}, {"UTPO", 2},
+    {"UTQU", 2}, {"UTSC", 2}, {"UTSW", 2}, {"UTVE", 2}, {"UTWR", 2}, {"UUMT", 2},
+    {"UUNE", 2}, {"UWAI", 2}, {"UWRO", 2}, {"UWSE", 2}, {"UXWI", 2}, {"VALP", 2},
+    {"VALT", 2}, {"VARL", 2}, {"VARO", 2}, {"VARV", 2}, {"VATH", 2}, {"VBYT", 2},
+    {"VCON", 2}, {"VDBY", 2}, {"VDIG", 2}, {"VEAU", 2}, {"VEBG", 2}, {"VECS", 2},
+    {"VECU", 2}, {"VECV", 2}, {"VEDU", 2}, {"VEDV", 2}, {"VEEQ", 2}, {"VEJU", 2},
+    {"VELD", 2}, {"VEOP", 2}, {"VERQ", 2}, {"VESH", 2}, {"VEVA", 2}, {"VEXI", 2},
+    {"VEYC", 2}, {"VEYV", 2}, {"VEYW", 2}, {"VFOR", 2}, {"VGET", 2}, {"VIAN", 2},
+    {"VIDC", 2}, {"VILE", 2}, {"VILI", 2}, {"VILL", 2}, {"VIMJ", 2}, {"VIMZ", 2},
+    {"VINE", 2}, {"VJJT", 2}, {"VLIN", 2}, {"VLNU", 2}, {"VMOV", 2}, {"VMSS", 2},
+    {"VORA", 2}, {"VORO", 2}, {"VOTE", 2}, {"VRIG", 2}, {"VSCH", 2}, {"VSYN", 2},
+    {"VTEH", 2}, {"VTOE", 2}, {"VTOI", 2}, {"VUNM", 2}, {"VWHI", 2}, {"VWNA", 2},
+    {"VXYZ", 2}, {"WADD", 2}, {"WAFE", 2}, {"WAFI", 2}, {"WAGA", 2}, {"WALA", 2},
+    {"WALK", 2}, {"WANA", 2}, {"WANE", 2}, {"WANY", 2}, {"WAPC", 2}, {"WAPE", 2},
+    {"WAPI", 2}, {"WAPN", 2}, {"WAPR", 2}, {"WARG", 2}, {"WATG", 2}, {"WAYD", 2},
+    {"WBEG", 2}, {"WBIG", 2}, {"WBOD", 2}, {"WBOR", 2}, {"WBUF", 2}, {"WBYN", 2},
+    {"WBYS", 2}, {"WCIN", 2}, {"WCLO", 2}, {"WDAB", 2}, {"WDAN", 2}, {"WDEN", 2},
+    {"WDIC", 2}, {"WDIF", 2}, {"WDIN", 2}, {"WDIS", 2}, {"WDON", 2}, {"WDOW", 2},
+    {"WEAD", 2}, {"WEBR", 2}, {"WEDD", 2}, {"WEDE", 2}, {"WEDM", 2}, {"WEDW", 2},
+    {"WEGA", 2}, {"WEGO", 2}, {"WELS", 2}, {"WEOF", 2}, {"WERN", 2}, {"WESU", 2},
+    {"WEXP", 2}, {"WEXT", 2}, {"WFAR", 2}, {"WFIV", 2}, {"WGRO", 2}, {"WGUI", 2},
+    {"WHAS", 2}, {"WHEI", 2}, {"WHMO", 2}, {"WHOD", 2}, {"WHOI", 2}, {"WHYN", 2},
+    {"WHYY", 2}, {"WIDO", 2}, {"WIDW", 2}, {"WIFO", 2}, {"WIKI", 2}, {"WINF", 2},
+    {"WINH", 2}, {"WINK", 2}, {"WINW", 2}, {"WIPO", 2}, {"WISB", 2}, {"WISC", 2},
+    {"WISD", 2}, {"WISV", 2}, {"WISY", 2}, {"WITE", 2}, {"WJMO", 2}, {"WLIK", 2},
+    {"WLMO", 2}, {"WLOC", 2}, {"WLYS", 2}, {"WMAD", 2}, {"WMKV", 2}, {"WMOT", 2},
+    {"WNAB", 2}, {"WNBA", 2}, {"WNCR", 2}, {"WNDI", 2}, {"WNFU", 2}, {"WNIF", 2},
+    {"WNKE", 2}, {"WNMO", 2}, {"WNOC", 2}, {"WNOG", 2}, {"WNOS", 2}, {"WNRF", 2},
+    {"WNRU", 2}, {"WNSA", 2}, {"WNSC", 2}, {"WNSU", 2}, {"WNTR", 2}, {"WNUM", 2},
+    {"WNUS", 2}, {"WNWE", 2}, {"WOAS", 2}, {"WOBA", 2}, {"WOBS", 2}, {"WOBU", 2},
+    {"WOCI", 2}, {"WOFC", 2}, {"WOFW", 2}, {"WOIS", 2}, {"WOKI", 2}, {"WOKN", 2},
+    {"WOLA", 2}, {"WONU", 2}, {"WOON", 2}, {"WOPI", 2}, {"WORO", 2}, {"WOSH", 2},
+    {"WOSY", 2}, {"WOTR", 2}, {"WOUG", 2}, {"WOVE", 2}, {"WPAL", 2}, {"WPAT", 2},
+    {"WPAY", 2}, {"WPFI", 2}, {"WPOW", 2}, {"WPPE", 2}, {"WPTO", 2}, {"WRAY", 2},
+    {"WRID", 2}, {"WSAF", 2}, {"WSAP", 2}, {"WSBO", 2}, {"WSBY", 2}, {"WSCA", 2},
+    {"WSDI", 2}, {"WSEL", 2}, {"WSEM", 2}, {"WSGU", 2}, {"WSIS", 2}, {"WSME", 2},
+    {"WSNE", 2}, {"WSOB", 2}, {"WSPE", 2}, {"WSRA", 2}, {"WSST", 2}, {"WSSU", 2},
+    {"WSTI", 2}, {"WSTR", 2}, {"WSUB", 2}, {"WTIM", 2}, {"WTOB", 2}, {"WTOI", 2},
+    {"WTOY", 2}, {"WTUT", 2}, {"WUSR", 2}, {"WVIE", 2}, {"WWAP", 2}, {"WWEC", 2},
+    {"WWEL", 2}, {"WWHO", 2}, {"WWID", 2}, {"WWWA", 2}, {"WWWM", 2}, {"XALL", 2},
+    {"XANY", 2}, {"XAST", 2}, {"XBUF", 2}, {"XBUT", 2}, {"XBXB", 2}, {"XBYT", 2},
+    {"XCHE", 2}, {"XCLA", 2}, {"XDAR", 2}, {"XDBU", 2}, {"XDCO", 2}, {"XDDO", 2},
+    {"XDEG", 2}, {"XDFO", 2}, {"XDIF", 2}, {"XDIG", 2}, {"XDOF", 2}, {"XDPA", 2},
+    {"XDSE", 2}, {"XDTO", 2}, {"XECP", 2}, {"XEDB", 2}, {"XEDC", 2}, {"XEDE", 2},
+    {"XEDM", 2}, {"XEDN", 2}, {"XEIA", 2}, {"XEND", 2}, {"XENO", 2}, {"XESC", 2},
+    {"XEST", 2}, {"XEXP", 2}, {"XFIR", 2}, {"XFOE", 2}, {"XFUN", 2}, {"XGLA", 2},
+    {"XHOW", 2}, {"XIII", 2}, {"XIMA", 2}, {"XINO", 2}, {"XISM", 2}, {"XISP", 2},
+    {"XISU", 2}, {"XITY", 2}, {"XLEN", 2}, {"XLJT", 2}, {"XMAX", 2}, {"XMEM", 2},
+    {"XMEN", 2}, {"XMSW", 2}, {"XNAM", 2}, {"XNEX", 2}, {"XNOT", 2}, {"XOBJ", 2},
+    {"XONE", 2}, {"XORE", 2}, {"XPEN", 2}, {"XPIR", 2}, {"XPON", 2}, {"XPRM", 2},
+    {"XQUO", 2}, {"XRIN", 2}, {"XRMU", 2}, {"XTAP", 2}, {"XTAU", 2}, {"XTBR", 2},
+    {"XTCI", 2}, {"XTDE", 2}, {"XTEE", 2}, {"XTEM", 2}, {"XTHM", 2}, {"XTHP", 2},
+    {"XTHR", 2}, {"XTHS", 2}, {"XTIE", 2}, {"XTIM", 2}, {"XTIW", 2}, {"XTKE", 2},
+    {"XTME", 2}, {"XTOC", 2}, {"XTOP", 2}, {"XTRI", 2}, {"XTTM", 2}, {"XTUC", 2},
+    {"XTWA", 2}, {"XVER", 2}, {"XXAN", 2}, {"XXDE", 2}, {"XXDR", 2}, {"XXLI", 2},
+    {"XXSE", 2}, {"XXXA", 2}, {"XXXD", 2}, {"XXXL", 2}, {"XYFO", 2}, {"XYIN", 2},
+    {"XYTH", 2}, {"XYWH", 2}, {"YABU", 2}, {"YACH", 2}, {"YADO", 2}, {"YADV", 2},
+    {"YAFA", 2}, {"YAFI", 2}, {"YAHE", 2}, {"YAIN", 2}, {"YAIR", 2}, {"YALA", 2},
+    {"YALW", 2}, {"YAMU", 2}, {"YANC", 2}, {"YANU", 2}, {"YASC", 2}, {"YASL", 2},
+    {"YASM", 2}, {"YATE", 2}, {"YATG", 2}, {"YATW", 2}, {"YATX", 2}, {"YAUG", 2},
+    {"YAWR", 2}, {"YBAS", 2}, {"YBLO", 2}, {"YBUR", 2}, {"YBYB", 2}, {"YBYG", 2},
+    {"YBYM", 2}, {"YCAP", 2}, {"YCAR", 2}, {"YCOR", 2}, {"YCUT", 2}, {"YDBY", 2},
+    {"YDEE", 2}, {"YDTO", 2}, {"YDUE", 2}, {"YDUN", 2}, {"YEAC", 2}, {"YEAL", 2},
+    {"YEAT", 2}, {"YEDD", 2}, {"YEDH", 2}, {"YEDS", 2}, {"YEFF", 2}, {"YEIG", 2},
+    {"YELA", 2}, {"YELO", 2}, {"YENO", 2}, {"YEOR", 2}, {"YEPI", 2}, {"YESM", 2},
+    {"YESU", 2}, {"YETE", 2}, {"YETL", 2}, {"YETV", 2}, {"YFEA", 2}, {"YFEI", 2},
+    {"YFIT", 2}, {"YFLA", 2}, {"YFUM", 2}, {"YGOI", 2}, {"YGOL", 2}, {"YGOT", 2},
+    {"YGPL", 2}, {"YGVI", 2}, {"YHAL", 2}, {"YHEL", 2}, {"YHIG", 2}, {"YICO", 2},
+    {"YIFR", 2}, {"YIFW", 2}, {"YIMA", 2}, {"YINE", 2}, {"YINM", 2}, {"YINW", 2},
+    {"YINY", 2}, {"YISK", 2}, {"YISL", 2}, {"YITC", 2}, {"YITD", 2}, {"YITP", 2},
+    {"YITR", 2}, {"YJUD", 2}, {"YKHP", 2}, {"YLAN", 2}, {"YLEH", 2}, {"YLEV", 2},
+    {"YLIE", 2}, {"YLIM", 2}, {"YLUC", 2}, {"YMAG", 2}, {"YMAI", 2}, {"YMAR", 2},
+    {"YMES", 2}, {"YMIG", 2}, {"YMOO", 2}, {"YMRH", 2}, {"YNCI", 2}, {"YNEX", 2},
+    {"YNSY", 2}, {"YOFG", 2}, {"YOLD", 2}, {"YOPA", 2}, {"YORE", 2}, {"YORH", 2},
+    {"YORY", 2}, {"YOUV", 2}, {"YPTA", 2}, {"YPTT", 2}, {"YRAD", 2}, {"YREN", 2},
+    {"YRRE", 2}, {"YRUP", 2}, {"YSAO", 2}, {"YSAV", 2}, {"YSHI", 2}, {"YSIL", 2},
+    {"YSIR", 2}, {"YSLI", 2}, {"YSNA", 2}, {"YSOL", 2}, {"YSPO", 2}, {"YSQU", 2},
+    {"YSSU", 2}, {"YSUK", 2}, {"YSUR", 2}, {"YSVE", 2}, {"YTAN", 2}, {"YTEC", 2},
+    {"YTEP", 2}, {"YTIS", 2}, {"YTMP", 2}, {"YUNE", 2}, {"YUPA", 2}, {"YVAC", 2},
+    {"YVIC", 2}, {"YVOL", 2}, {"YWET", 2}, {"YWID", 2}, {"YWRO", 2}, {"YXAN", 2},
+    {"YYET", 2}, {"YYNA", 2}, {"YZAU", 2}, {"YZTH", 2}, {"ZCTO", 2}, {"ZEGE", 2},
+    {"ZEIS", 2}, {"ZESC", 2}, {"ZESO", 2}, {"ZESU", 2}, {"ZESV", 2}, {"ZEVE", 2},
+    {"ZEYO", 2}, {"ZFIS", 2}, {"ZIFY", 2}, {"ZIPB", 2}, {"ZIPU", 2}, {"ZITO", 2},
+    {"ZMTH", 2}, {"ZMTO", 2}, {"ZNOT", 2}, {"ZOAN", 2}, {"ZOOM", 2}, {"ZRTH", 2},
+    {"ZSHA", 2}, {"ZTOT", 2}, {"ZURE", 2}, {"ZWHI", 2}, {"ZWIT", 2}, {"ZYMA", 2},
+    {"ZYOU", 2}, {"ZZCO", 2}, {"ZZYM", 2},
+};
+
+const std::size_t ENGLISH_QUADGRAM_COUNT = sizeof(ENGLISH_QUADGRAMS) / sizeof(ENGLISH_QUADGRAMS[0]);
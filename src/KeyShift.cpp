@@ -0,0 +1,214 @@
+/*****************************************************************************
+ * File: KeyShift.cpp
+ *
+ * Description: See KeyShift.h
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#include "KeyShift.h"
+
+// STL includes
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// Project includes
+#include "CommonUtils.h"
+#include "Scorer.h"
+#include "ShiftKernel.h"
+
+namespace {
+
+const int ALPHABET_LENGTH = 26;
+
+// Fewest letters per column for its frequencies to mean anything
+const std::size_t MIN_COLUMN_LETTERS = 4;
+
+// Fewest letters worth starting worker threads for; scoring the periods of a
+// shorter text takes less time than starting a thread
+const std::size_t PARALLEL_LETTERS = 1 << 16;
+
+// Periods whose index of coincidence is within this fraction of the best are
+// taken as multiples of the key length
+const double PERIOD_TOLERANCE = 0.9;
+
+} // namespace
+
+// Shift each alphabetic character of the encrypted string by the 
+// corresponding character in the key, and return the decrypted string.
+std::string keyShiftDecrypt(std::string_view encrypted, std::string_view key)
+{
+    std::string decrypted;
+    keyShiftDecrypt(encrypted, key, decrypted);
+    return decrypted;
+}
+
+void keyShiftDecrypt(std::string_view encrypted, std::string_view key, std::string& decrypted)
+{
+    decrypted.assign(encrypted.begin(), encrypted.end());
+
+    thread_local std::vector<unsigned char> shifts;
+    keyShifts(key, shifts);
+
+    // Shift each letter, keeping its case, by the next key character;
+    // whitespace and punctuation do not use up a key character
+    shiftLettersKeyed(&decrypted[0], decrypted.length(), shifts.data(), shifts.size());
+}
+
+void keyShifts(std::string_view key, std::vector<unsigned char>& shifts)
+{
+    // Subtracting a key character is the same as adding its complement
+    shifts.clear();
+    for (const char c : key) {
+        const char lower = static_cast<char>(c | 0x20);
+        if (lower >= 'a' && lower <= 'z') {
+            shifts.push_back(static_cast<unsigned char>((ALPHABET_LENGTH - (lower - 'a')) % ALPHABET_LENGTH));
+        }
+    }
+}
+
+std::vector<KeyTrial> dictionaryAttack(std::string_view encrypted, const std::vector<std::string_view>& keys,
+                                      const Scorer& scorer, std::size_t count, unsigned int jobs)
+{
+    // Scores of the best keys, by index into keys. Each worker keeps its own
+    // heap with the worst of its best on top.
+    typedef std::pair<double, std::size_t> Trial;
+    const auto better = [](const Trial& a, const Trial& b) {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    };
+
+    ThreadPool pool(jobs);
+    const std::size_t workers = pool.size();
+    const std::size_t chunk = (keys.size() + workers - 1) / workers;
+    std::vector<std::vector<Trial>> best(workers);
+    if (count > 0) {
+        for (std::size_t worker = 0; worker < workers; worker++) {
+            pool.submit([&, worker] {
+                // Decrypt every key into the same buffer
+                std::string buffer;
+                std::vector<unsigned char> shifts;
+                auto& heap = best[worker];
+                const std::size_t end = std::min(keys.size(), (worker + 1) * chunk);
+                for (std::size_t i = worker * chunk; i < end; i++) {
+                    keyShifts(keys[i], shifts);
+                    if (shifts.empty()) {
+                        continue;
+                    }
+                    buffer.assign(encrypted.begin(), encrypted.end());
+                    shiftLettersKeyed(&buffer[0], buffer.length(), shifts.data(), shifts.size());
+
+                    const Trial trial(scorer.score(buffer), i);
+                    if (heap.size() < count) {
+                        heap.push_back(trial);
+                        std::push_heap(heap.begin(), heap.end(), better);
+                    }
+                    else if (better(trial, heap.front())) {
+                        std::pop_heap(heap.begin(), heap.end(), better);
+                        heap.back() = trial;
+                        std::push_heap(heap.begin(), heap.end(), better);
+                    }
+                }
+            });
+        }
+        pool.wait();
+    }
+
+    // Merge the workers' best, best first; ties go to the earlier key
+    std::vector<Trial> merged;
+    for (const auto& heap : best) {
+        merged.insert(merged.end(), heap.begin(), heap.end());
+    }
+    std::sort(merged.begin(), merged.end(), better);
+    merged.resize(std::min(merged.size(), count));
+
+    std::vector<KeyTrial> results;
+    for (const auto& trial : merged) {
+        results.push_back(KeyTrial{std::string(keys[trial.second]), trial.first});
+    }
+    return results;
+}
+
+double indexOfCoincidence(const std::vector<unsigned char>& letters, unsigned int period)
+{
+    double total = 0.;
+    for (unsigned int column = 0; column < period; column++) {
+        std::size_t counts[ALPHABET_LENGTH] = {};
+        std::size_t size = 0;
+        for (std::size_t i = column; i < letters.size(); i += period) {
+            counts[letters[i]]++;
+            size++;
+        }
+
+        if (size > 1) {
+            double pairs = 0.;
+            for (const auto count : counts) {
+                pairs += static_cast<double>(count) * (count - 1);
+            }
+            total += pairs / (static_cast<double>(size) * (size - 1));
+        }
+    }
+    return total / period;
+}
+
+std::string recoverKey(std::string_view encrypted, unsigned int maxPeriod, unsigned int jobs)
+{
+    // The letters of the cypher text as 0-25; nothing else uses up a key
+    // character
+    std::vector<unsigned char> letters;
+    letters.reserve(encrypted.size());
+    for (const char c : encrypted) {
+        const char lower = static_cast<char>(c | 0x20);
+        if (lower >= 'a' && lower <= 'z') {
+            letters.push_back(static_cast<unsigned char>(lower - 'a'));
+        }
+    }
+
+    // Only try periods that leave enough letters in every column
+    const unsigned int periods = static_cast<unsigned int>(
+        std::min<std::size_t>(maxPeriod, letters.size() / MIN_COLUMN_LETTERS));
+    if (periods == 0) {
+        return std::string();
+    }
+
+    // Score every period, across workers only for long texts
+    std::vector<double> coincidence(periods + 1, 0.);
+    const unsigned int workers = std::min(jobs ? jobs : std::thread::hardware_concurrency(), periods);
+    if (workers <= 1 || letters.size() < PARALLEL_LETTERS) {
+        for (unsigned int period = 1; period <= periods; period++) {
+            coincidence[period] = indexOfCoincidence(letters, period);
+        }
+    }
+    else {
+        ThreadPool pool(workers);
+        for (unsigned int period = 1; period <= periods; period++) {
+            pool.submit([&letters, &coincidence, period] {
+                coincidence[period] = indexOfCoincidence(letters, period);
+            });
+        }
+        pool.wait();
+    }
+
+    // Multiples of the key length score as well as the key length itself, so
+    // take the shortest period close to the best
+    const double best = *std::max_element(coincidence.begin(), coincidence.end());
+    unsigned int keyLength = 1;
+    while (coincidence[keyLength] < best * PERIOD_TOLERANCE) {
+        keyLength++;
+    }
+
+    // Each column is a Caesar cypher; the shift that makes it most like
+    // English undoes that key character
+    std::string key(keyLength, 'a');
+    std::string column;
+    for (unsigned int position = 0; position < keyLength; position++) {
+        column.clear();
+        for (std::size_t i = position; i < letters.size(); i += keyLength) {
+            column.push_back(static_cast<char>('a' + letters[i]));
+        }
+        key[position] = static_cast<char>('a' + (ALPHABET_LENGTH - bestShift(column)) % ALPHABET_LENGTH);
+    }
+    return key;
+}
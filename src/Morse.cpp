@@ -0,0 +1,78 @@
+/*****************************************************************************
+ * File: Morse.cpp
+ *
+ * Description: See Morse.h
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#include "Morse.h"
+
+// Lookup the encoded text (dashes '-' and dots '.') and return the decoded
+// character
+char morse2char(std::string_view in)
+{
+    unsigned int code = MORSE_ROOT;
+    for (const char element : in) {
+        code = morseStep(code, element == '-');
+    }
+    return morseChar(code);
+}
+
+// Decode a Morse code message. Dashes are written '0', dots '1', letters are
+// separated by '-' and words by ' '. Unknown codes decode to '*'.
+void decodeMorse(std::string_view morseMessage, std::string& output)
+{
+    output.clear();
+
+    // Tree index of the dots and dashes read so far of the current letter
+    unsigned int code = MORSE_ROOT;
+
+    // For each encoded character
+    for (const char element : morseMessage) {
+        // Dashes ('0') and dots ('1') step down the tree without branching on
+        // which it is
+        if (element == '0' || element == '1') {
+            code = morseStep(code, element == '0');
+            continue;
+        }
+
+        switch (element) {
+
+            // If space
+            case ' ':
+                // Decode whatever is left of the letter
+                if (code != MORSE_ROOT) {
+                    output.push_back(morseChar(code));
+                }
+                code = MORSE_ROOT;
+                output.push_back(' ');
+                break;
+
+            // If letter separator, decode the Morse encoded character
+            case '-':
+                output.push_back(morseChar(code));
+                code = MORSE_ROOT;
+                break;
+
+            default:
+                code = MORSE_ROOT;
+                output.push_back('*');
+                break;
+        }
+    }
+
+    // Decode whatever is left of the letter
+    if (code != MORSE_ROOT) {
+        output.push_back(morseChar(code));
+    }
+}
+
+std::string decodeMorse(std::string_view morseMessage)
+{
+    std::string output;
+    decodeMorse(morseMessage, output);
+    return output;
+}
@@ -0,0 +1,303 @@
+/*****************************************************************************
+ * File: MorseSegmenter.cpp
+ *
+ * Description: See MorseSegmenter.h
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#include "MorseSegmenter.h"
+
+// STL includes
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+// Project includes
+#include "Morse.h"
+
+namespace {
+
+const int ALPHABET_LENGTH = 26;
+const int BIGRAMS = ALPHABET_LENGTH * ALPHABET_LENGTH;
+const int TRIGRAMS = BIGRAMS * ALPHABET_LENGTH;
+const int QUADGRAMS = TRIGRAMS * ALPHABET_LENGTH;
+
+// Letters a-z have codes of at most four dots and dashes
+const int LONGEST_LETTER = 4;
+
+// Weight of each order's own estimate against the next lower order's
+const double INTERPOLATION = 0.7;
+
+// log10 cost of every letter decoded, so splitting a code into more, shorter
+// letters is not preferred just because common letters have short codes;
+// and log10 bonus for each word found in the dictionary. Tuned on sample
+// sentences with the built-in and a larger quadgram model.
+const double LETTER_COST = 0.5;
+const double WORD_BONUS = 4.;
+
+// Fill next[context * 26 + letter] with the interpolated probability of the
+// letter after the context, from counts of (context, letter) and the lower
+// order probability of the letter after the context's last letters
+void conditional(const std::vector<double>& counts, const std::vector<double>& lower, int lowerContexts,
+                 std::vector<double>& next)
+{
+    const std::size_t contexts = counts.size() / ALPHABET_LENGTH;
+    next.assign(counts.size(), 0.);
+    for (std::size_t context = 0; context < contexts; context++) {
+        double total = 0.;
+        for (int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+            total += counts[context * ALPHABET_LENGTH + letter];
+        }
+
+        const std::size_t shorter = context % lowerContexts;
+        for (int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+            const double backoff = lower[shorter * ALPHABET_LENGTH + letter];
+            next[context * ALPHABET_LENGTH + letter] = (total > 0.)
+                ? INTERPOLATION * counts[context * ALPHABET_LENGTH + letter] / total + (1. - INTERPOLATION) * backoff
+                : backoff;
+        }
+    }
+}
+
+std::vector<float> toLog10(const std::vector<double>& probabilities)
+{
+    std::vector<float> logs(probabilities.size());
+    for (std::size_t i = 0; i < probabilities.size(); i++) {
+        logs[i] = static_cast<float>(std::log10(probabilities[i]));
+    }
+    return logs;
+}
+
+struct Candidate {
+    double score;
+    unsigned int context;   // last three letters in base 26
+    unsigned int order;     // letters of context known, at most 3
+    int parent;
+    char character;         // 0 when the step decodes nothing
+};
+
+} // namespace
+
+// Bonus for a decoding whose last word, ending at node, is in the dictionary
+double MorseSegmenter::wordBonus(const std::vector<Node>& nodes, int node) const
+{
+    std::string word;
+    for (; node >= 0 && nodes[node].character != ' '; node = nodes[node].parent) {
+        if (nodes[node].character != 0) {
+            word.push_back(nodes[node].character);
+        }
+    }
+    std::reverse(word.begin(), word.end());
+    return (!word.empty() && m_dictionary.contains(word)) ? WORD_BONUS : 0.;
+}
+
+MorseSegmenter::MorseSegmenter(const QuadgramScorer& quadgrams, const Dictionary& dictionary,
+                               std::size_t beamWidth)
+    : m_dictionary(dictionary), m_beamWidth(std::max<std::size_t>(beamWidth, 1))
+{
+    // Relative quadgram counts; the floor given to unseen quadgrams is not a
+    // count, so it is left out of the lower orders
+    const auto& logProbs = quadgrams.logProbs();
+    const float floor = *std::min_element(logProbs.begin(), logProbs.end());
+    std::vector<double> counts4(QUADGRAMS, 0.);
+    std::vector<double> counts3(TRIGRAMS, 0.);
+    for (int quadgram = 0; quadgram < QUADGRAMS; quadgram++) {
+        if (logProbs[quadgram] > floor) {
+            counts4[quadgram] = std::pow(10., logProbs[quadgram]);
+            counts3[quadgram % TRIGRAMS] += counts4[quadgram];
+        }
+    }
+    std::vector<double> counts2(BIGRAMS, 0.);
+    for (int trigram = 0; trigram < TRIGRAMS; trigram++) {
+        counts2[trigram % BIGRAMS] += counts3[trigram];
+    }
+    std::vector<double> counts1(ALPHABET_LENGTH, 0.);
+    double total = 0.;
+    for (int bigram = 0; bigram < BIGRAMS; bigram++) {
+        counts1[bigram % ALPHABET_LENGTH] += counts2[bigram];
+        total += counts2[bigram];
+    }
+
+    // Single letters get a little of every count so none is impossible
+    std::vector<double> next1(ALPHABET_LENGTH);
+    const double smoothing = 0.01 * total / ALPHABET_LENGTH;
+    for (int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+        next1[letter] = (counts1[letter] + smoothing) / (total + smoothing * ALPHABET_LENGTH);
+    }
+
+    std::vector<double> next2;
+    std::vector<double> next3;
+    std::vector<double> next4;
+    conditional(counts2, next1, 1, next2);
+    conditional(counts3, next2, ALPHABET_LENGTH, next3);
+    conditional(counts4, next3, BIGRAMS, next4);
+
+    m_next1 = toLog10(next1);
+    m_next2 = toLog10(next2);
+    m_next3 = toLog10(next3);
+    m_next4 = toLog10(next4);
+}
+
+std::unique_ptr<MorseSegmenter> MorseSegmenter::fromOptions(const Options& options)
+{
+    // Load a larger word list if one is given
+    std::unique_ptr<Dictionary> wordList;
+    if (!Dictionary::fromOption(options, "-d", wordList)) {
+        return nullptr;
+    }
+
+    // Load quadgram counts if given
+    std::unique_ptr<QuadgramScorer> quadgrams;
+    if (!QuadgramScorer::fromOption(options, "-q", quadgrams)) {
+        return nullptr;
+    }
+
+    std::size_t beamWidth = 64;
+    const auto beamOption = options.find("-b");
+    if (beamOption != options.end()) {
+        const int width = std::atoi(beamOption->second.c_str());
+        if (width <= 0) {
+            std::cout << "Invalid beam width \"" << beamOption->second << "\". Use a positive number." << std::endl;
+            return nullptr;
+        }
+        beamWidth = static_cast<std::size_t>(width);
+    }
+
+    std::unique_ptr<MorseSegmenter> segmenter(new MorseSegmenter(quadgrams ? *quadgrams : QuadgramScorer::builtin(),
+                                                                 wordList ? *wordList : Dictionary::builtin(),
+                                                                 beamWidth));
+    segmenter->m_wordList = std::move(wordList);
+    return segmenter;
+}
+
+std::string MorseSegmenter::segment(std::string_view morseMessage) const
+{
+    const std::size_t length = morseMessage.size();
+
+    // Candidates waiting at each position, and the chains of those kept
+    std::vector<std::vector<Candidate>> pending(length + 1);
+    std::vector<Node> nodes;
+    pending[0].push_back(Candidate{0., 0, 0, -1, 0});
+
+    // The candidates kept at the current position, and their nodes
+    std::vector<int> beam;
+    std::vector<Candidate> kept;
+
+    // Per letter context (and order), the last position it was seen at, as a
+    // count of positions the thread has searched, and its slot there. Reused
+    // across messages, so nothing is cleared per message.
+    thread_local std::vector<std::size_t> stamps(TRIGRAMS * 4, 0);
+    thread_local std::vector<std::size_t> slots(TRIGRAMS * 4, 0);
+    thread_local std::size_t searched = 0;
+
+    int best = -1;
+    for (std::size_t position = 0; position <= length; position++) {
+        auto& waiting = pending[position];
+        if (waiting.empty()) {
+            continue;
+        }
+
+        // Keep the best candidate for each letter context, found through a
+        // table of the slot each context was last given at this position, then
+        // the best of those up to the beam width
+        const std::size_t stamp = ++searched;
+        std::size_t unique = 0;
+        for (const auto& candidate : waiting) {
+            const std::size_t state = candidate.context * 4 + candidate.order;
+            if (stamps[state] != stamp) {
+                stamps[state] = stamp;
+                slots[state] = unique;
+                waiting[unique++] = candidate;
+            }
+            else if (candidate.score > waiting[slots[state]].score) {
+                waiting[slots[state]] = candidate;
+            }
+        }
+        waiting.resize(unique);
+        const std::size_t width = std::min(waiting.size(), m_beamWidth);
+        std::nth_element(waiting.begin(), waiting.begin() + (width - 1), waiting.end(),
+                         [](const Candidate& a, const Candidate& b) {
+            return a.score > b.score;
+        });
+
+        kept.assign(waiting.begin(), waiting.begin() + width);
+        beam.clear();
+        for (const auto& candidate : kept) {
+            beam.push_back(static_cast<int>(nodes.size()));
+            nodes.push_back(Node{candidate.parent, candidate.character});
+        }
+        std::vector<Candidate>().swap(waiting);
+
+        if (position == length) {
+            // Score the last word, then take the best
+            double bestScore = 0.;
+            for (std::size_t i = 0; i < kept.size(); i++) {
+                const double score = kept[i].score + wordBonus(nodes, beam[i]);
+                if (best < 0 || score > bestScore) {
+                    best = beam[i];
+                    bestScore = score;
+                }
+            }
+            break;
+        }
+
+        const char element = morseMessage[position];
+        if (element == '0' || element == '1') {
+            // Each letter whose code starts here, in order of length
+            unsigned int code = MORSE_ROOT;
+            for (std::size_t end = position; end < length && end - position < LONGEST_LETTER; end++) {
+                if (morseMessage[end] != '0' && morseMessage[end] != '1') {
+                    break;
+                }
+                code = morseStep(code, morseMessage[end] == '0');
+                const char letter = morseChar(code);
+                if (letter < 'a' || letter > 'z') {
+                    continue;
+                }
+
+                const unsigned int index = letter - 'a';
+                for (std::size_t i = 0; i < kept.size(); i++) {
+                    const auto& from = kept[i];
+                    const unsigned int context = from.context * ALPHABET_LENGTH + index;
+                    float logProb;
+                    switch (from.order) {
+                        case 0:  logProb = m_next1[index]; break;
+                        case 1:  logProb = m_next2[context % BIGRAMS]; break;
+                        case 2:  logProb = m_next3[context % TRIGRAMS]; break;
+                        default: logProb = m_next4[context % QUADGRAMS]; break;
+                    }
+                    pending[end + 1].push_back(Candidate{from.score + logProb - LETTER_COST, context % TRIGRAMS,
+                                                         std::min(from.order + 1, 3u), beam[i], letter});
+                }
+            }
+        }
+        else {
+            // Letter separators decode nothing, word gaps to a space and
+            // anything else to '*'
+            const char character = (element == '-') ? 0 : (element == ' ') ? ' ' : '*';
+            for (std::size_t i = 0; i < kept.size(); i++) {
+                auto next = kept[i];
+                next.parent = beam[i];
+                next.character = character;
+                if (element == ' ') {
+                    next.score += wordBonus(nodes, beam[i]);
+                }
+                pending[position + 1].push_back(next);
+            }
+        }
+    }
+
+    // Follow the best chain back to the start
+    std::string decoded;
+    for (int node = best; node >= 0; node = nodes[node].parent) {
+        if (nodes[node].character != 0) {
+            decoded.push_back(nodes[node].character);
+        }
+    }
+    std::reverse(decoded.begin(), decoded.end());
+    return decoded;
+}
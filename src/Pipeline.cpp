@@ -0,0 +1,218 @@
+/*****************************************************************************
+ * File: Pipeline.cpp
+ *
+ * Description: See Pipeline.h
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#include "Pipeline.h"
+
+// STL includes
+#include <functional>
+#include <iostream>
+#include <map>
+
+// Project includes
+#include "Caesar.h"
+#include "KeyShift.h"
+#include "Morse.h"
+#include "MorseSegmenter.h"
+#include "Radix.h"
+#include "ShiftKernel.h"
+#include "Substitution.h"
+
+namespace {
+
+// Stage for a decoder that needs no settings
+class DecoderStage : public Stage
+{
+public:
+    typedef void (*Decoder)(std::string_view, std::string&);
+
+    explicit DecoderStage(Decoder decoder) : m_decoder(decoder) {}
+
+    // Decode into a buffer kept by the thread and swap it with the message,
+    // so the message's old buffer is reused for the next one
+    void process(std::vector<std::string>& batch) const override
+    {
+        thread_local std::string decoded;
+        for (auto& message : batch) {
+            m_decoder(message, decoded);
+            message.swap(decoded);
+        }
+    }
+
+private:
+    Decoder m_decoder;
+};
+
+class CaesarStage : public Stage
+{
+public:
+    explicit CaesarStage(std::unique_ptr<CaesarSolver> solver) : m_solver(std::move(solver)) {}
+
+    void process(std::vector<std::string>& batch) const override
+    {
+        for (auto& message : batch) {
+            message = m_solver->solve(message);
+        }
+    }
+
+private:
+    std::unique_ptr<CaesarSolver> m_solver;
+};
+
+class MorseSegmentStage : public Stage
+{
+public:
+    explicit MorseSegmentStage(std::unique_ptr<MorseSegmenter> segmenter) : m_segmenter(std::move(segmenter)) {}
+
+    void process(std::vector<std::string>& batch) const override
+    {
+        for (auto& message : batch) {
+            message = m_segmenter->segment(message);
+        }
+    }
+
+private:
+    std::unique_ptr<MorseSegmenter> m_segmenter;
+};
+
+class KeyShiftStage : public Stage
+{
+public:
+    // An empty key is recovered from each message
+    explicit KeyShiftStage(const std::string& key) : m_key(key) {}
+
+    void process(std::vector<std::string>& batch) const override
+    {
+        for (auto& message : batch) {
+            // Batches already run in parallel, so each key search uses one thread
+            message = keyShiftDecrypt(message, m_key.empty() ? recoverKey(message, 20, 1) : m_key);
+        }
+    }
+
+private:
+    std::string m_key;
+};
+
+// Letters through a fixed substitution, in place
+class SubstitutionStage : public Stage
+{
+public:
+    explicit SubstitutionStage(const Substitution& substitution) : m_substitution(substitution) {}
+
+    void process(std::vector<std::string>& batch) const override
+    {
+        for (auto& message : batch) {
+            substituteLetters(&message[0], message.size(), m_substitution);
+        }
+    }
+
+private:
+    Substitution m_substitution;
+};
+
+typedef std::function<std::unique_ptr<Stage>(const Options&)> StageFactory;
+
+std::unique_ptr<Stage> makeDecoder(DecoderStage::Decoder decoder)
+{
+    return std::unique_ptr<Stage>(new DecoderStage(decoder));
+}
+
+// Every stage a pipeline can use, by name
+const std::map<std::string, StageFactory>& stageRegistry()
+{
+    static const std::map<std::string, StageFactory> registry = {
+        {"morse", [](const Options&) { return makeDecoder(decodeMorse); }},
+        {"morseseg", [](const Options& options) {
+            auto segmenter = MorseSegmenter::fromOptions(options);
+            return segmenter ? std::unique_ptr<Stage>(new MorseSegmentStage(std::move(segmenter))) : nullptr;
+        }},
+        {"hex", [](const Options&) { return makeDecoder(decodeHex); }},
+        {"oct", [](const Options&) { return makeDecoder(decodeOct); }},
+        {"ascii", [](const Options&) { return makeDecoder(decodeAscii); }},
+        {"caesar", [](const Options& options) {
+            auto solver = CaesarSolver::fromOptions(options);
+            return solver ? std::unique_ptr<Stage>(new CaesarStage(std::move(solver))) : nullptr;
+        }},
+        {"keyshift", [](const Options& options) {
+            const auto key = options.find("-k");
+            return std::unique_ptr<Stage>(new KeyShiftStage(key != options.end() ? key->second : std::string()));
+        }},
+        {"atbash", [](const Options&) { return std::unique_ptr<Stage>(new SubstitutionStage(ATBASH)); }},
+        {"substitute", [](const Options& options) {
+            const auto alphabet = options.find("-a");
+            Substitution decryption;
+            if (alphabet == options.end() || !substitutionFromKey(alphabet->second, decryption)) {
+                std::cout << "The substitute stage needs the cypher alphabet, the 26 letters each used once; add \"-a <alphabet>\"." << std::endl;
+                return std::unique_ptr<Stage>();
+            }
+            return std::unique_ptr<Stage>(new SubstitutionStage(decryption));
+        }},
+    };
+    return registry;
+}
+
+} // namespace
+
+std::unique_ptr<Pipeline> Pipeline::fromSpec(const std::string& spec, const Options& options)
+{
+    constexpr SeparatorSet COMMA(",");
+
+    std::unique_ptr<Pipeline> pipeline(new Pipeline());
+    for (const auto name : Tokens(spec, COMMA)) {
+        const auto factory = stageRegistry().find(std::string(name));
+        if (factory == stageRegistry().end()) {
+            std::cout << "Unknown pipeline stage \"" << name << "\". Use " << stageNames() << "." << std::endl;
+            return nullptr;
+        }
+
+        auto stage = factory->second(options);
+        if (!stage) {
+            return nullptr;
+        }
+        pipeline->m_stages.push_back(std::move(stage));
+    }
+
+    if (pipeline->m_stages.empty()) {
+        std::cout << "The pipeline has no stages. Use " << stageNames() << "." << std::endl;
+        return nullptr;
+    }
+
+    return pipeline;
+}
+
+std::string Pipeline::stageNames()
+{
+    std::string names;
+    for (const auto& entry : stageRegistry()) {
+        names += (names.empty() ? "" : ", ") + entry.first;
+    }
+    return names;
+}
+
+// Run the batch through each stage in turn
+void Pipeline::process(const std::vector<std::string_view>& lines, std::vector<std::string>& results) const
+{
+    // Work in the result strings, reusing their capacity
+    results.resize(lines.size());
+    for (std::size_t i = 0; i < lines.size(); i++) {
+        results[i].assign(lines[i]);
+    }
+    for (const auto& stage : m_stages) {
+        stage->process(results);
+    }
+}
+
+std::string Pipeline::solve(std::string_view message) const
+{
+    std::vector<std::string> batch(1, std::string(message));
+    for (const auto& stage : m_stages) {
+        stage->process(batch);
+    }
+    return batch.front();
+}
@@ -0,0 +1,307 @@
+/*****************************************************************************
+ * File: Radix.cpp
+ *
+ * Description: See Radix.h
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#include "Radix.h"
+
+// STL includes
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// Project includes
+#include "CommonUtils.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define RADIX_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Separators between the codes of each kind of message
+constexpr SeparatorSet CODE_SEPARATORS(", \r\n");
+constexpr SeparatorSet ASCII_SEPARATORS(" \r\n");
+
+#ifdef RADIX_X86
+
+// With vector instructions, a hex message is first classified a block of
+// bytes at a time into two bitmaps, one bit per byte: separators, and bytes
+// that are neither a separator nor a digit of the base. Tokens are then found
+// by scanning the bitmaps for set and clear bits, runs of two digit codes are
+// converted 16 at a time, and other codes one at a time straight into the
+// output. The bitmaps are reused by each thread, so nothing is allocated per
+// token. Octal and decimal codes vary in width and gain nothing from the
+// bitmaps; they, and the scalar level, walk the tokens with Tokens.
+struct Bitmaps {
+    std::vector<std::uint64_t> separators;
+    std::vector<std::uint64_t> invalid;
+};
+
+template<unsigned int BASE>
+void classifyScalar(const char* text, std::size_t begin, std::size_t length,
+                    const SeparatorSet& separators, Bitmaps& bitmaps)
+{
+    for (std::size_t i = begin; i < length; i++) {
+        const std::uint64_t bit = std::uint64_t(1) << (i % 64);
+        if (separators.contains(text[i])) {
+            bitmaps.separators[i / 64] |= bit;
+        }
+        else if (DIGIT_VALUES[static_cast<unsigned char>(text[i])] >= BASE) {
+            bitmaps.invalid[i / 64] |= bit;
+        }
+    }
+}
+
+// Index of the first set bit at or after from, or length if there is none
+std::size_t nextSet(const std::vector<std::uint64_t>& bits, std::size_t from, std::size_t length)
+{
+    std::size_t word = from / 64;
+    std::uint64_t value = bits[word] & (~std::uint64_t(0) << (from % 64));
+    while (value == 0) {
+        if (++word >= bits.size()) {
+            return length;
+        }
+        value = bits[word];
+    }
+    return std::min(length, word * 64 + __builtin_ctzll(value));
+}
+
+// Index of the first clear bit at or after from, or length if there is none
+std::size_t nextClear(const std::vector<std::uint64_t>& bits, std::size_t from, std::size_t length)
+{
+    std::size_t word = from / 64;
+    std::uint64_t value = ~bits[word] & (~std::uint64_t(0) << (from % 64));
+    while (value == 0) {
+        if (++word >= bits.size()) {
+            return length;
+        }
+        value = ~bits[word];
+    }
+    return std::min(length, word * 64 + __builtin_ctzll(value));
+}
+
+// The 48 bits starting at from; the caller makes sure they are in the text
+std::uint64_t bits48(const std::vector<std::uint64_t>& bits, std::size_t from)
+{
+    const std::size_t word = from / 64;
+    const std::size_t shift = from % 64;
+    std::uint64_t value = bits[word] >> shift;
+    if (shift > 16) {
+        value |= bits[word + 1] << (64 - shift);
+    }
+    return value & ((std::uint64_t(1) << 48) - 1);
+}
+
+// Separator bits of a run of 16 two digit hex codes, each followed by one
+// separator: "4A 75 6E ..."
+const std::uint64_t HEX_RUN_SEPARATORS = 0x924924924924;
+const std::size_t HEX_RUN_BYTES = 48;
+
+// Mask of the bytes of c that are in [low, low + count)
+__attribute__((target("sse2")))
+inline __m128i inRangeSse2(__m128i c, char low, int count)
+{
+    const __m128i biased = _mm_add_epi8(c, _mm_set1_epi8(static_cast<char>(0x80 - low)));
+    return _mm_cmplt_epi8(biased, _mm_set1_epi8(static_cast<char>(-128 + count)));
+}
+
+template<unsigned int BASE>
+__attribute__((target("sse2")))
+void classifySse2(const char* text, std::size_t length, const SeparatorSet& separators, Bitmaps& bitmaps)
+{
+    const bool commas = separators.contains(',');
+    const __m128i comma = commas ? _mm_set1_epi8(',') : _mm_set1_epi8(' ');
+    std::size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        const __m128i separator = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(c, comma)),
+            _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(c, _mm_set1_epi8('\n'))));
+        __m128i digit = inRangeSse2(c, '0', BASE < 10 ? BASE : 10);
+        if (BASE == 16) {
+            digit = _mm_or_si128(digit, inRangeSse2(_mm_or_si128(c, _mm_set1_epi8(0x20)), 'a', 6));
+        }
+        const std::uint64_t shift = i % 64;
+        bitmaps.separators[i / 64] |= std::uint64_t(_mm_movemask_epi8(separator)) << shift;
+        bitmaps.invalid[i / 64] |= std::uint64_t(_mm_movemask_epi8(_mm_andnot_si128(_mm_or_si128(separator, digit),
+                                                                                     _mm_set1_epi8(-1)))) << shift;
+    }
+    classifyScalar<BASE>(text, i, length, separators, bitmaps);
+}
+
+__attribute__((target("avx2")))
+inline __m256i inRangeAvx2(__m256i c, char low, int count)
+{
+    const __m256i biased = _mm256_add_epi8(c, _mm256_set1_epi8(static_cast<char>(0x80 - low)));
+    return _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + count)), biased);
+}
+
+template<unsigned int BASE>
+__attribute__((target("avx2")))
+void classifyAvx2(const char* text, std::size_t length, const SeparatorSet& separators, Bitmaps& bitmaps)
+{
+    const bool commas = separators.contains(',');
+    const __m256i comma = commas ? _mm256_set1_epi8(',') : _mm256_set1_epi8(' ');
+    std::size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+        const __m256i separator = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(c, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(c, comma)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(c, _mm256_set1_epi8('\r')), _mm256_cmpeq_epi8(c, _mm256_set1_epi8('\n'))));
+        __m256i digit = inRangeAvx2(c, '0', BASE < 10 ? BASE : 10);
+        if (BASE == 16) {
+            digit = _mm256_or_si256(digit, inRangeAvx2(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), 'a', 6));
+        }
+        const std::uint64_t shift = i % 64;
+        const std::uint32_t separatorMask = static_cast<std::uint32_t>(_mm256_movemask_epi8(separator));
+        const std::uint32_t digitMask = static_cast<std::uint32_t>(_mm256_movemask_epi8(digit));
+        bitmaps.separators[i / 64] |= std::uint64_t(separatorMask) << shift;
+        bitmaps.invalid[i / 64] |= std::uint64_t(~(separatorMask | digitMask)) << shift;
+    }
+    classifyScalar<BASE>(text, i, length, separators, bitmaps);
+}
+
+// Shuffle masks gathering the first (high) and second (low) digit of each of
+// the 16 codes of a hex run from each of its three 16-byte blocks
+struct HexRunMasks {
+    alignas(16) char high[3][16];
+    alignas(16) char low[3][16];
+};
+
+constexpr HexRunMasks makeHexRunMasks()
+{
+    HexRunMasks masks{};
+    for (int block = 0; block < 3; block++) {
+        for (int code = 0; code < 16; code++) {
+            const int high = code * 3 - block * 16;
+            const int low = high + 1;
+            masks.high[block][code] = static_cast<char>((high >= 0 && high < 16) ? high : 0x80);
+            masks.low[block][code] = static_cast<char>((low >= 0 && low < 16) ? low : 0x80);
+        }
+    }
+    return masks;
+}
+
+constexpr HexRunMasks HEX_RUN_MASKS = makeHexRunMasks();
+
+// Value of each hex digit character: letters have bit 0x40 set and a low
+// nibble 9 short of their value
+__attribute__((target("ssse3")))
+inline __m128i hexDigitValues(__m128i c)
+{
+    const __m128i letter = _mm_cmpeq_epi8(_mm_and_si128(c, _mm_set1_epi8(0x40)), _mm_set1_epi8(0x40));
+    return _mm_add_epi8(_mm_and_si128(c, _mm_set1_epi8(0x0F)), _mm_and_si128(letter, _mm_set1_epi8(9)));
+}
+
+// Decode a run of 16 two digit hex codes (48 bytes) into 16 characters
+__attribute__((target("ssse3")))
+void decodeHexRunSsse3(const char* run, char* out)
+{
+    __m128i high = _mm_setzero_si128();
+    __m128i low = _mm_setzero_si128();
+    for (int block = 0; block < 3; block++) {
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(run + block * 16));
+        high = _mm_or_si128(high, _mm_shuffle_epi8(c, _mm_load_si128(reinterpret_cast<const __m128i*>(HEX_RUN_MASKS.high[block]))));
+        low = _mm_or_si128(low, _mm_shuffle_epi8(c, _mm_load_si128(reinterpret_cast<const __m128i*>(HEX_RUN_MASKS.low[block]))));
+    }
+
+    // Each high value is below 16, so shifting the 16-bit lanes keeps it in its byte
+    const __m128i value = _mm_or_si128(_mm_slli_epi16(hexDigitValues(high), 4), hexDigitValues(low));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), value);
+}
+
+#endif // RADIX_X86
+
+// Decode every token of the message into out, replacing its contents
+template<unsigned int BASE>
+void decodeTokens(std::string_view message, const SeparatorSet& separators, std::string& out)
+{
+    out.clear();
+
+#ifdef RADIX_X86
+    const auto level = simdLevel();
+    const std::size_t length = message.size();
+    if (BASE == 16 && level != SIMD_SCALAR && hasSsse3() && length > 0) {
+        thread_local Bitmaps bitmaps;
+        const std::size_t words = (length + 63) / 64;
+        bitmaps.separators.assign(words, 0);
+        bitmaps.invalid.assign(words, 0);
+        if (level == SIMD_AVX2) {
+            classifyAvx2<BASE>(message.data(), length, separators, bitmaps);
+        }
+        else {
+            classifySse2<BASE>(message.data(), length, separators, bitmaps);
+        }
+
+        std::size_t next = 0;
+        while ((next = nextClear(bitmaps.separators, next, length)) < length) {
+            // Convert whole runs of two digit hex codes at once
+            if (next + HEX_RUN_BYTES <= length &&
+                bits48(bitmaps.separators, next) == HEX_RUN_SEPARATORS && bits48(bitmaps.invalid, next) == 0) {
+                const auto size = out.size();
+                out.resize(size + 16);
+                decodeHexRunSsse3(message.data() + next, &out[size]);
+                next += HEX_RUN_BYTES;
+                continue;
+            }
+
+            const std::size_t end = nextSet(bitmaps.separators, next, length);
+            out.push_back(radix2char<BASE>(message.substr(next, end - next)));
+            next = end;
+        }
+        return;
+    }
+#endif
+
+    for (const auto token : Tokens(message, separators)) {
+        out.push_back(radix2char<BASE>(token));
+    }
+}
+
+} // namespace
+
+// Hex code solver for a given string.
+void decodeHex(std::string_view hexMessage, std::string& decoded)
+{
+    decodeTokens<16>(hexMessage, CODE_SEPARATORS, decoded);
+}
+
+std::string decodeHex(std::string_view hexMessage)
+{
+    std::string decoded;
+    decodeHex(hexMessage, decoded);
+    return decoded;
+}
+
+// Octal code solver for a given string.
+void decodeOct(std::string_view octMessage, std::string& decoded)
+{
+    decodeTokens<8>(octMessage, CODE_SEPARATORS, decoded);
+}
+
+std::string decodeOct(std::string_view octMessage)
+{
+    std::string decoded;
+    decodeOct(octMessage, decoded);
+    return decoded;
+}
+
+// Ascii code solver for a given string.
+void decodeAscii(std::string_view asciiMessage, std::string& decoded)
+{
+    decodeTokens<10>(asciiMessage, ASCII_SEPARATORS, decoded);
+}
+
+std::string decodeAscii(std::string_view asciiMessage)
+{
+    std::string decoded;
+    decodeAscii(asciiMessage, decoded);
+    return decoded;
+}
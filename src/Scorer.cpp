@@ -0,0 +1,378 @@
+/*****************************************************************************
+ * File: Scorer.cpp
+ *
+ * Description: See Scorer.h
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#include "Scorer.h"
+
+// STL includes
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// Project includes
+#include "CommonUtils.h"
+#include "EnglishQuadgrams.h"
+#include "Substitution.h"
+
+namespace {
+
+const int ALPHABET_LENGTH = 26;
+const int QUADGRAMS = ALPHABET_LENGTH * ALPHABET_LENGTH * ALPHABET_LENGTH * ALPHABET_LENGTH;
+
+// English letter frequencies in percent, a to z
+constexpr std::array<double, ALPHABET_LENGTH> ENGLISH_PERCENT = {{
+    8.167, 1.492, 2.782, 4.253, 12.702, 2.228, 2.015, 6.094, 6.966, 0.153,
+    0.772, 4.025, 2.406, 6.749, 7.507, 1.929, 0.095, 5.987, 6.327, 9.056,
+    2.758, 0.978, 2.360, 0.150, 1.974, 0.074}};
+
+// Map a byte to its letter index 0-25, folding case, or -1 for non-letters
+constexpr std::array<signed char, 256> makeLetterIndex()
+{
+    std::array<signed char, 256> table = {};
+    for (int c = 0; c < 256; c++) {
+        table[c] = -1;
+    }
+    for (int i = 0; i < ALPHABET_LENGTH; i++) {
+        table['a' + i] = static_cast<signed char>(i);
+        table['A' + i] = static_cast<signed char>(i);
+    }
+    return table;
+}
+constexpr std::array<signed char, 256> LETTER_INDEX = makeLetterIndex();
+
+inline int letterIndex(const char c)
+{
+    return LETTER_INDEX[static_cast<unsigned char>(c)];
+}
+
+// Return if the character is punctuation, i.e. neither a letter nor a digit
+inline bool isPunctuation(const char c)
+{
+    return letterIndex(c) < 0 && !(c >= '0' && c <= '9');
+}
+
+// Characters that separate words
+constexpr SeparatorSet WHITESPACE(" \n\r\t\f\v");
+
+// Index of four letters in base 26, first letter most significant, or -1 if
+// the text is not four letters
+int quadgramIndex(std::string_view quad)
+{
+    if (quad.size() != 4) {
+        return -1;
+    }
+    int quadgram = 0;
+    for (const char c : quad) {
+        const int index = letterIndex(c);
+        if (index < 0) {
+            return -1;
+        }
+        quadgram = quadgram * ALPHABET_LENGTH + index;
+    }
+    return quadgram;
+}
+
+// Chi-squared statistic of letter counts against English after adding shift
+// to every letter, i.e. with letter i counted as letter i + shift
+double chiSquared(const std::array<int, ALPHABET_LENGTH>& counts, int letters, int shift)
+{
+    const auto& english = englishFrequencies();
+    double chiSquared = 0.;
+    for (int i = 0; i < ALPHABET_LENGTH; i++) {
+        const double expected = english[i] * letters;
+        const double difference = counts[(i - shift + ALPHABET_LENGTH) % ALPHABET_LENGTH] - expected;
+        chiSquared += difference * difference / expected;
+    }
+    return chiSquared;
+}
+
+} // namespace
+
+const std::array<double, 26>& englishFrequencies()
+{
+    static const std::array<double, 26> frequencies = [] {
+        std::array<double, 26> fractions;
+        double total = 0.;
+        for (const auto percent : ENGLISH_PERCENT) {
+            total += percent;
+        }
+        for (int i = 0; i < ALPHABET_LENGTH; i++) {
+            fractions[i] = ENGLISH_PERCENT[i] / total;
+        }
+        return fractions;
+    }();
+    return frequencies;
+}
+
+std::array<double, 26> shiftLikelihoods(std::string_view text)
+{
+    // English log frequencies, a to z
+    static const std::array<double, ALPHABET_LENGTH> logFrequencies = [] {
+        std::array<double, ALPHABET_LENGTH> logs;
+        const auto& english = englishFrequencies();
+        for (int i = 0; i < ALPHABET_LENGTH; i++) {
+            logs[i] = std::log(english[i]);
+        }
+        return logs;
+    }();
+
+    std::array<int, ALPHABET_LENGTH> histogram = {};
+    for (const char c : text) {
+        const int index = letterIndex(c);
+        if (index >= 0) {
+            histogram[index]++;
+        }
+    }
+
+    // Log-likelihood of the text decrypted with each shift
+    std::array<double, ALPHABET_LENGTH> likelihoods;
+    for (int shift = 0; shift < ALPHABET_LENGTH; shift++) {
+        double score = 0.;
+        for (int i = 0; i < ALPHABET_LENGTH; i++) {
+            score += histogram[i] * logFrequencies[(i + shift) % ALPHABET_LENGTH];
+        }
+        likelihoods[shift] = score;
+    }
+    return likelihoods;
+}
+
+int bestShift(std::string_view text)
+{
+    const auto likelihoods = shiftLikelihoods(text);
+    return static_cast<int>(std::max_element(likelihoods.begin(), likelihoods.end()) - likelihoods.begin());
+}
+
+void Scorer::scoreShifts(std::string_view text, std::array<double, 26>& scores) const
+{
+    thread_local std::string shifted;
+    for (unsigned int shift = 0; shift < ALPHABET_LENGTH; shift++) {
+        const auto& table = ROTATIONS[shift].table;
+        shifted.resize(text.size());
+        for (std::size_t i = 0; i < text.size(); i++) {
+            shifted[i] = static_cast<char>(table[static_cast<unsigned char>(text[i])]);
+        }
+        scores[shift] = score(shifted);
+    }
+}
+
+double WordScorer::score(std::string_view text) const
+{
+    int words = 0;
+    int found = 0;
+
+    for (auto word : Tokens(text, WHITESPACE)) {
+        // Trim punctuation from either end
+        while (!word.empty() && isPunctuation(word.front())) {
+            word.remove_prefix(1);
+        }
+        while (!word.empty() && isPunctuation(word.back())) {
+            word.remove_suffix(1);
+        }
+
+        if (!word.empty()) {
+            words++;
+            if (m_dictionary.contains(word)) {
+                found++;
+            }
+        }
+    }
+
+    // Normalize the final score
+    return (words > 0) ? static_cast<double>(found) / words : 0.;
+}
+
+double ChiSquaredScorer::score(std::string_view text) const
+{
+    std::array<int, ALPHABET_LENGTH> counts = {};
+    int letters = 0;
+    for (const char c : text) {
+        const int index = letterIndex(c);
+        if (index >= 0) {
+            counts[index]++;
+            letters++;
+        }
+    }
+
+    if (letters == 0) {
+        return 0.;
+    }
+    return -chiSquared(counts, letters, 0);
+}
+
+void ChiSquaredScorer::scoreShifts(std::string_view text, std::array<double, 26>& scores) const
+{
+    std::array<int, ALPHABET_LENGTH> counts = {};
+    int letters = 0;
+    for (const char c : text) {
+        const int index = letterIndex(c);
+        if (index >= 0) {
+            counts[index]++;
+            letters++;
+        }
+    }
+
+    for (int shift = 0; shift < ALPHABET_LENGTH; shift++) {
+        scores[shift] = (letters > 0) ? -chiSquared(counts, letters, shift) : 0.;
+    }
+}
+
+const QuadgramScorer& QuadgramScorer::builtin()
+{
+    static const QuadgramScorer scorer = [] {
+        std::vector<double> counts(QUADGRAMS, 0.);
+        for (std::size_t i = 0; i < ENGLISH_QUADGRAM_COUNT; i++) {
+            const int quadgram = quadgramIndex(ENGLISH_QUADGRAMS[i].quadgram);
+            if (quadgram >= 0) {
+                counts[quadgram] += ENGLISH_QUADGRAMS[i].count;
+            }
+        }
+        return QuadgramScorer(counts);
+    }();
+    return scorer;
+}
+
+std::unique_ptr<QuadgramScorer> QuadgramScorer::fromFile(const std::string& filePath)
+{
+    std::ifstream inFile(filePath);
+    if (!inFile.is_open()) {
+        return nullptr;
+    }
+
+    std::vector<double> counts(QUADGRAMS, 0.);
+    bool valid = false;
+    std::string line;
+    while (std::getline(inFile, line)) {
+        std::istringstream fields(line);
+        std::string quad;
+        double count = 0.;
+        if (!(fields >> quad >> count) || count <= 0.) {
+            continue;
+        }
+
+        const int quadgram = quadgramIndex(quad);
+        if (quadgram >= 0) {
+            counts[quadgram] += count;
+            valid = true;
+        }
+    }
+
+    if (!valid) {
+        return nullptr;
+    }
+    return std::unique_ptr<QuadgramScorer>(new QuadgramScorer(counts));
+}
+
+bool QuadgramScorer::fromOption(const Options& options, const std::string& flag, std::unique_ptr<QuadgramScorer>& quadgrams)
+{
+    quadgrams.reset();
+    const auto quadgramFile = options.find(flag);
+    if (quadgramFile == options.end()) {
+        return true;
+    }
+
+    quadgrams = fromFile(quadgramFile->second);
+    if (!quadgrams) {
+        std::cout << "Unable to read quadgrams from \"" << quadgramFile->second << "\". Please check your inputs and try again." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+QuadgramScorer::QuadgramScorer(const std::vector<double>& counts)
+{
+    double total = 0.;
+    for (const auto count : counts) {
+        total += count;
+    }
+
+    // Quadgrams never seen get a floor well below the rarest seen one
+    const float floor = static_cast<float>(std::log10(0.01 / total));
+    auto logProbs = std::make_shared<std::vector<float>>(counts.size(), floor);
+    for (std::size_t i = 0; i < counts.size(); i++) {
+        if (counts[i] > 0.) {
+            (*logProbs)[i] = static_cast<float>(std::log10(counts[i] / total));
+        }
+    }
+    m_logProbs = logProbs;
+}
+
+double QuadgramScorer::score(std::string_view text) const
+{
+    const float* logProbs = m_logProbs->data();
+    double total = 0.;
+    int quadgram = 0;
+    int letters = 0;
+    for (const char c : text) {
+        const int index = letterIndex(c);
+        if (index < 0) {
+            continue;
+        }
+        quadgram = (quadgram * ALPHABET_LENGTH + index) % QUADGRAMS;
+        if (++letters >= 4) {
+            total += logProbs[quadgram];
+        }
+    }
+
+    // Too short for a single quadgram; nothing to tell candidates apart
+    if (letters < 4) {
+        return 0.;
+    }
+    return total / (letters - 3);
+}
+
+void QuadgramScorer::scoreShifts(std::string_view text, std::array<double, 26>& scores) const
+{
+    thread_local std::vector<unsigned char> indices;
+    indices.clear();
+    for (const char c : text) {
+        const int index = letterIndex(c);
+        if (index >= 0) {
+            indices.push_back(static_cast<unsigned char>(index));
+        }
+    }
+
+    // Too short for a single quadgram; nothing to tell candidates apart
+    if (indices.size() < 4) {
+        scores.fill(0.);
+        return;
+    }
+
+    // Sum in the same order as score() so each shift scores exactly the same
+    const float* logProbs = m_logProbs->data();
+    for (int shift = 0; shift < ALPHABET_LENGTH; shift++) {
+        double total = 0.;
+        int quadgram = 0;
+        int letters = 0;
+        for (const unsigned char index : indices) {
+            const int shifted = (index + shift < ALPHABET_LENGTH) ? index + shift : index + shift - ALPHABET_LENGTH;
+            quadgram = (quadgram * ALPHABET_LENGTH + shifted) % QUADGRAMS;
+            if (++letters >= 4) {
+                total += logProbs[quadgram];
+            }
+        }
+        scores[shift] = total / (letters - 3);
+    }
+}
+
+std::unique_ptr<Scorer> makeScorer(const std::string& name, const Dictionary& dictionary,
+                                   const QuadgramScorer& quadgrams)
+{
+    if (name == "words") {
+        return std::unique_ptr<Scorer>(new WordScorer(dictionary));
+    }
+    else if (name == "chi") {
+        return std::unique_ptr<Scorer>(new ChiSquaredScorer());
+    }
+    else if (name == "quad") {
+        return std::unique_ptr<Scorer>(new QuadgramScorer(quadgrams));
+    }
+    return nullptr;
+}
@@ -0,0 +1,363 @@
+/*****************************************************************************
+ * File: ShiftKernel.cpp
+ *
+ * Description: See ShiftKernel.h
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#include "ShiftKernel.h"
+
+// STL includes
+#include <vector>
+
+// Project includes
+#include "CommonUtils.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SHIFT_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+const int ALPHABET_LENGTH = 26;
+
+// Scalar kernels, also used for the tail of the vector kernels
+inline bool isAlpha(const char c)
+{
+    const char lower = static_cast<char>(c | 0x20);
+    return (lower >= 'a' && lower <= 'z');
+}
+
+// Every byte through the translation table
+void substituteLettersScalar(char* data, std::size_t length, const Substitution& substitution)
+{
+    const auto& table = substitution.table;
+    for (std::size_t i = 0; i < length; i++) {
+        data[i] = static_cast<char>(table[static_cast<unsigned char>(data[i])]);
+    }
+}
+
+void shiftLettersScalar(char* data, std::size_t length, unsigned int shift)
+{
+    substituteLettersScalar(data, length, ROTATIONS[shift]);
+}
+
+std::size_t shiftLettersKeyedScalar(char* data, std::size_t length,
+                                    const unsigned char* keyShifts, std::size_t keyLength,
+                                    std::size_t keyIndex)
+{
+    for (std::size_t i = 0; i < length; i++) {
+        if (isAlpha(data[i])) {
+            data[i] = static_cast<char>(ROTATIONS[keyShifts[keyIndex]].table[static_cast<unsigned char>(data[i])]);
+            if (++keyIndex == keyLength) {
+                keyIndex = 0;
+            }
+        }
+    }
+    return keyIndex;
+}
+
+#ifdef SHIFT_KERNEL_X86
+
+// The vector kernels fold case by setting bit 0x20, classify letters by
+// biasing 'a'-'z' to the bottom of the signed byte range, add the shift, and
+// subtract 26 wherever the folded sum passed 'z'. Only 'A'-'Z' and 'a'-'z'
+// fold into 'a'-'z', so every other byte is left alone.
+
+__attribute__((target("sse2")))
+inline __m128i lettersSse2(__m128i lower)
+{
+    const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80 - 'a'));
+    const __m128i limit = _mm_set1_epi8(static_cast<char>(-128 + ALPHABET_LENGTH));
+    return _mm_cmplt_epi8(_mm_add_epi8(lower, bias), limit);
+}
+
+__attribute__((target("sse2")))
+inline __m128i shiftBlockSse2(__m128i c, __m128i lower, __m128i alpha, __m128i shift)
+{
+    const __m128i pastZ = _mm_set1_epi8('z' + 1);
+    const __m128i wrap = _mm_set1_epi8(ALPHABET_LENGTH);
+
+    const __m128i letterShift = _mm_and_si128(alpha, shift);
+    const __m128i folded = _mm_add_epi8(lower, letterShift);
+    const __m128i over = _mm_and_si128(alpha, _mm_cmpeq_epi8(_mm_max_epu8(folded, pastZ), folded));
+    return _mm_sub_epi8(_mm_add_epi8(c, letterShift), _mm_and_si128(over, wrap));
+}
+
+__attribute__((target("sse2")))
+void shiftLettersSse2(char* data, std::size_t length, unsigned int shift)
+{
+    const __m128i shiftVec = _mm_set1_epi8(static_cast<char>(shift));
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    std::size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i* block = reinterpret_cast<__m128i*>(data + i);
+        const __m128i c = _mm_loadu_si128(block);
+        const __m128i lower = _mm_or_si128(c, caseBit);
+        _mm_storeu_si128(block, shiftBlockSse2(c, lower, lettersSse2(lower), shiftVec));
+    }
+    shiftLettersScalar(data + i, length - i, shift);
+}
+
+__attribute__((target("avx2")))
+void shiftLettersAvx2(char* data, std::size_t length, unsigned int shift)
+{
+    const __m256i bias = _mm256_set1_epi8(static_cast<char>(0x80 - 'a'));
+    const __m256i limit = _mm256_set1_epi8(static_cast<char>(-128 + ALPHABET_LENGTH));
+    const __m256i pastZ = _mm256_set1_epi8('z' + 1);
+    const __m256i wrap = _mm256_set1_epi8(ALPHABET_LENGTH);
+    const __m256i shiftVec = _mm256_set1_epi8(static_cast<char>(shift));
+    const __m256i caseBit = _mm256_set1_epi8(0x20);
+
+    std::size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i* block = reinterpret_cast<__m256i*>(data + i);
+        const __m256i c = _mm256_loadu_si256(block);
+        const __m256i lower = _mm256_or_si256(c, caseBit);
+        const __m256i alpha = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(lower, bias));
+        const __m256i letterShift = _mm256_and_si256(alpha, shiftVec);
+        const __m256i folded = _mm256_add_epi8(lower, letterShift);
+        const __m256i over = _mm256_and_si256(alpha, _mm256_cmpeq_epi8(_mm256_max_epu8(folded, pastZ), folded));
+        _mm256_storeu_si256(block, _mm256_sub_epi8(_mm256_add_epi8(c, letterShift), _mm256_and_si256(over, wrap)));
+    }
+    shiftLettersSse2(data + i, length - i, shift);
+}
+
+// The keyed kernels number the letters of each 16-byte lane with an in-lane
+// prefix sum, then gather each letter's key shift with a byte shuffle from a
+// 16-byte window of the key starting at the lane's first key index. The
+// window buffer holds the key repeated so any start index has 16 bytes after
+// it. pshufb needs SSSE3, which every AVX2 CPU has; SSE2-only CPUs use the
+// scalar kernel (see hasSsse3()).
+
+// Key shifts repeated to keyLength + 16 bytes, reused by the calling thread
+const unsigned char* keyWindow(const unsigned char* keyShifts, std::size_t keyLength)
+{
+    thread_local std::vector<unsigned char> window;
+    window.resize(keyLength + 16);
+    for (std::size_t i = 0; i < window.size(); i++) {
+        window[i] = keyShifts[i % keyLength];
+    }
+    return window.data();
+}
+
+__attribute__((target("ssse3")))
+inline __m128i prefixLetters(__m128i ones)
+{
+    // Inclusive prefix sum within the lane, then exclusive
+    __m128i sum = _mm_add_epi8(ones, _mm_slli_si128(ones, 1));
+    sum = _mm_add_epi8(sum, _mm_slli_si128(sum, 2));
+    sum = _mm_add_epi8(sum, _mm_slli_si128(sum, 4));
+    sum = _mm_add_epi8(sum, _mm_slli_si128(sum, 8));
+    return _mm_sub_epi8(sum, ones);
+}
+
+__attribute__((target("ssse3")))
+std::size_t shiftLettersKeyedSsse3(char* data, std::size_t length,
+                                   const unsigned char* keyShifts, std::size_t keyLength,
+                                   std::size_t keyIndex)
+{
+    const unsigned char* window = keyWindow(keyShifts, keyLength);
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    const __m128i one = _mm_set1_epi8(1);
+
+    std::size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i* block = reinterpret_cast<__m128i*>(data + i);
+        const __m128i c = _mm_loadu_si128(block);
+        const __m128i lower = _mm_or_si128(c, caseBit);
+        const __m128i alpha = lettersSse2(lower);
+        const __m128i index = prefixLetters(_mm_and_si128(alpha, one));
+        const __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(window + keyIndex));
+        const __m128i shift = _mm_shuffle_epi8(keys, index);
+        _mm_storeu_si128(block, shiftBlockSse2(c, lower, alpha, shift));
+
+        keyIndex = (keyIndex + __builtin_popcount(_mm_movemask_epi8(alpha))) % keyLength;
+    }
+    return shiftLettersKeyedScalar(data + i, length - i, keyShifts, keyLength, keyIndex);
+}
+
+__attribute__((target("avx2")))
+std::size_t shiftLettersKeyedAvx2(char* data, std::size_t length,
+                                  const unsigned char* keyShifts, std::size_t keyLength,
+                                  std::size_t keyIndex)
+{
+    const unsigned char* window = keyWindow(keyShifts, keyLength);
+    const __m256i bias = _mm256_set1_epi8(static_cast<char>(0x80 - 'a'));
+    const __m256i limit = _mm256_set1_epi8(static_cast<char>(-128 + ALPHABET_LENGTH));
+    const __m256i pastZ = _mm256_set1_epi8('z' + 1);
+    const __m256i wrap = _mm256_set1_epi8(ALPHABET_LENGTH);
+    const __m256i one = _mm256_set1_epi8(1);
+    const __m256i caseBit = _mm256_set1_epi8(0x20);
+
+    std::size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i* block = reinterpret_cast<__m256i*>(data + i);
+        const __m256i c = _mm256_loadu_si256(block);
+        const __m256i lower = _mm256_or_si256(c, caseBit);
+        const __m256i alpha = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(lower, bias));
+        const unsigned int letters = static_cast<unsigned int>(_mm256_movemask_epi8(alpha));
+
+        // Number the letters within each 16-byte lane
+        const __m256i ones = _mm256_and_si256(alpha, one);
+        __m256i sum = _mm256_add_epi8(ones, _mm256_slli_si256(ones, 1));
+        sum = _mm256_add_epi8(sum, _mm256_slli_si256(sum, 2));
+        sum = _mm256_add_epi8(sum, _mm256_slli_si256(sum, 4));
+        sum = _mm256_add_epi8(sum, _mm256_slli_si256(sum, 8));
+        const __m256i index = _mm256_sub_epi8(sum, ones);
+
+        // The upper lane's key starts after the lower lane's letters
+        const std::size_t upperIndex = (keyIndex + __builtin_popcount(letters & 0xFFFF)) % keyLength;
+        const __m256i keys = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(window + keyIndex))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(window + upperIndex)), 1);
+        const __m256i shift = _mm256_and_si256(alpha, _mm256_shuffle_epi8(keys, index));
+
+        const __m256i folded = _mm256_add_epi8(lower, shift);
+        const __m256i over = _mm256_and_si256(alpha, _mm256_cmpeq_epi8(_mm256_max_epu8(folded, pastZ), folded));
+        _mm256_storeu_si256(block, _mm256_sub_epi8(_mm256_add_epi8(c, shift), _mm256_and_si256(over, wrap)));
+
+        keyIndex = (upperIndex + __builtin_popcount(letters >> 16)) % keyLength;
+    }
+    return shiftLettersKeyedScalar(data + i, length - i, keyShifts, keyLength, keyIndex);
+}
+
+// The substitution kernels look each letter's index (0-25) up in the letter
+// map with two byte shuffles, one per 16-entry half: pshufb zeroes bytes
+// whose index has the top bit set, so the upper half only answers for 16-25.
+// The mapped letter takes the case bit of the original.
+
+__attribute__((target("ssse3")))
+void substituteLettersSsse3(char* data, std::size_t length, const Substitution& substitution)
+{
+    const __m128i lowHalf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(substitution.letters.data()));
+    const __m128i highHalf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(substitution.letters.data() + 16));
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    const __m128i lowerA = _mm_set1_epi8('a');
+    const __m128i upperA = _mm_set1_epi8('A');
+    const __m128i sixteen = _mm_set1_epi8(16);
+    const __m128i fifteen = _mm_set1_epi8(15);
+
+    std::size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i* block = reinterpret_cast<__m128i*>(data + i);
+        const __m128i c = _mm_loadu_si128(block);
+        const __m128i lower = _mm_or_si128(c, caseBit);
+        const __m128i alpha = lettersSse2(lower);
+        const __m128i index = _mm_sub_epi8(lower, lowerA);
+
+        const __m128i high = _mm_cmpgt_epi8(index, fifteen);
+        const __m128i mapped = _mm_or_si128(_mm_andnot_si128(high, _mm_shuffle_epi8(lowHalf, index)),
+                                            _mm_shuffle_epi8(highHalf, _mm_sub_epi8(index, sixteen)));
+        const __m128i letter = _mm_or_si128(_mm_add_epi8(mapped, upperA), _mm_and_si128(c, caseBit));
+        _mm_storeu_si128(block, _mm_or_si128(_mm_and_si128(alpha, letter), _mm_andnot_si128(alpha, c)));
+    }
+    substituteLettersScalar(data + i, length - i, substitution);
+}
+
+__attribute__((target("avx2")))
+void substituteLettersAvx2(char* data, std::size_t length, const Substitution& substitution)
+{
+    const __m256i lowHalf = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(substitution.letters.data())));
+    const __m256i highHalf = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(substitution.letters.data() + 16)));
+    const __m256i bias = _mm256_set1_epi8(static_cast<char>(0x80 - 'a'));
+    const __m256i limit = _mm256_set1_epi8(static_cast<char>(-128 + ALPHABET_LENGTH));
+    const __m256i caseBit = _mm256_set1_epi8(0x20);
+    const __m256i lowerA = _mm256_set1_epi8('a');
+    const __m256i upperA = _mm256_set1_epi8('A');
+    const __m256i sixteen = _mm256_set1_epi8(16);
+    const __m256i fifteen = _mm256_set1_epi8(15);
+
+    std::size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i* block = reinterpret_cast<__m256i*>(data + i);
+        const __m256i c = _mm256_loadu_si256(block);
+        const __m256i lower = _mm256_or_si256(c, caseBit);
+        const __m256i alpha = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(lower, bias));
+        const __m256i index = _mm256_sub_epi8(lower, lowerA);
+
+        const __m256i high = _mm256_cmpgt_epi8(index, fifteen);
+        const __m256i mapped = _mm256_or_si256(_mm256_andnot_si256(high, _mm256_shuffle_epi8(lowHalf, index)),
+                                               _mm256_shuffle_epi8(highHalf, _mm256_sub_epi8(index, sixteen)));
+        const __m256i letter = _mm256_or_si256(_mm256_add_epi8(mapped, upperA), _mm256_and_si256(c, caseBit));
+        _mm256_storeu_si256(block, _mm256_blendv_epi8(c, letter, alpha));
+    }
+    substituteLettersSsse3(data + i, length - i, substitution);
+}
+
+#endif // SHIFT_KERNEL_X86
+
+} // namespace
+
+void shiftLetters(char* data, std::size_t length, unsigned int shift)
+{
+    shift %= ALPHABET_LENGTH;
+    if (shift == 0) {
+        return;
+    }
+
+#ifdef SHIFT_KERNEL_X86
+    switch (simdLevel()) {
+        case SIMD_AVX2:
+            shiftLettersAvx2(data, length, shift);
+            return;
+        case SIMD_SSE2:
+            shiftLettersSse2(data, length, shift);
+            return;
+        default:
+            break;
+    }
+#endif
+    shiftLettersScalar(data, length, shift);
+}
+
+std::size_t shiftLettersKeyed(char* data, std::size_t length,
+                              const unsigned char* keyShifts, std::size_t keyLength,
+                              std::size_t keyIndex)
+{
+    if (keyLength == 0) {
+        return 0;
+    }
+    keyIndex %= keyLength;
+
+#ifdef SHIFT_KERNEL_X86
+    switch (simdLevel()) {
+        case SIMD_AVX2:
+            return shiftLettersKeyedAvx2(data, length, keyShifts, keyLength, keyIndex);
+        case SIMD_SSE2:
+            if (hasSsse3()) {
+                return shiftLettersKeyedSsse3(data, length, keyShifts, keyLength, keyIndex);
+            }
+            break;
+        default:
+            break;
+    }
+#endif
+    return shiftLettersKeyedScalar(data, length, keyShifts, keyLength, keyIndex);
+}
+
+void substituteLetters(char* data, std::size_t length, const Substitution& substitution)
+{
+#ifdef SHIFT_KERNEL_X86
+    switch (simdLevel()) {
+        case SIMD_AVX2:
+            substituteLettersAvx2(data, length, substitution);
+            return;
+        case SIMD_SSE2:
+            if (hasSsse3()) {
+                substituteLettersSsse3(data, length, substitution);
+                return;
+            }
+            break;
+        default:
+            break;
+    }
+#endif
+    substituteLettersScalar(data, length, substitution);
+}
@@ -0,0 +1,44 @@
+/*****************************************************************************
+ * File: Substitution.cpp
+ *
+ * Description: See Substitution.h
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#include "Substitution.h"
+
+bool substitutionFromKey(std::string_view key, Substitution& decryption)
+{
+    if (key.size() != SUBSTITUTION_LETTERS) {
+        return false;
+    }
+
+    // Encryption maps plain letter i to the key's letter i; each key letter
+    // must be used once
+    std::array<unsigned char, SUBSTITUTION_LETTERS> encryption{};
+    std::array<bool, SUBSTITUTION_LETTERS> used{};
+    for (unsigned int letter = 0; letter < SUBSTITUTION_LETTERS; letter++) {
+        const char lower = static_cast<char>(key[letter] | 0x20);
+        if (lower < 'a' || lower > 'z' || used[lower - 'a']) {
+            return false;
+        }
+        used[lower - 'a'] = true;
+        encryption[letter] = static_cast<unsigned char>(lower - 'a');
+    }
+
+    decryption = invertSubstitution(makeSubstitution(encryption));
+    return true;
+}
+
+std::string substitutionKey(const Substitution& decryption)
+{
+    // Plain letter i is the decryption of the cypher letter that maps to it
+    std::string key(SUBSTITUTION_LETTERS, 'a');
+    for (unsigned int letter = 0; letter < SUBSTITUTION_LETTERS; letter++) {
+        key[decryption.letters[letter]] = static_cast<char>('a' + letter);
+    }
+    return key;
+}
@@ -0,0 +1,296 @@
+/*****************************************************************************
+ * File: SubstitutionSolver.cpp
+ *
+ * Description: See SubstitutionSolver.h
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+#include "SubstitutionSolver.h"
+
+// STL includes
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Project includes
+#include "ShiftKernel.h"
+
+namespace {
+
+const int ALPHABET_LENGTH = 26;
+
+// Plain letter of each cypher letter
+typedef std::array<unsigned char, ALPHABET_LENGTH> Key;
+
+// The letters of a cypher text and, for each cypher letter, the quadgrams it
+// appears in, so a swap of two letters of the key rescores only those
+class QuadgramIndex
+{
+public:
+    QuadgramIndex(std::string_view cypherText, const QuadgramScorer& quadgrams)
+        : m_logProbs(quadgrams.logProbs().data())
+    {
+        for (const char c : cypherText) {
+            const char lower = static_cast<char>(c | 0x20);
+            if (lower >= 'a' && lower <= 'z') {
+                m_letters.push_back(static_cast<unsigned char>(lower - 'a'));
+            }
+        }
+        const std::size_t count = (m_letters.size() >= 4) ? m_letters.size() - 3 : 0;
+
+        // Letters of each quadgram as a bit mask, then the quadgrams of each
+        // letter, each listed once
+        m_masks.resize(count);
+        std::array<std::uint32_t, ALPHABET_LENGTH + 1> sizes = {};
+        for (std::size_t position = 0; position < count; position++) {
+            std::uint32_t mask = 0;
+            for (std::size_t i = 0; i < 4; i++) {
+                mask |= 1u << m_letters[position + i];
+            }
+            m_masks[position] = mask;
+            for (int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+                sizes[letter + 1] += (mask >> letter) & 1;
+            }
+        }
+        std::partial_sum(sizes.begin(), sizes.end(), m_starts.begin());
+        m_positions.resize(m_starts[ALPHABET_LENGTH]);
+        auto next = m_starts;
+        for (std::size_t position = 0; position < count; position++) {
+            for (int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+                if ((m_masks[position] >> letter) & 1) {
+                    m_positions[next[letter]++] = static_cast<std::uint32_t>(position);
+                }
+            }
+        }
+    }
+
+    std::size_t quadgrams() const { return m_masks.size(); }
+
+    bool contains(int letter) const { return m_starts[letter + 1] > m_starts[letter]; }
+
+    // Score of every quadgram under the key, and their total
+    double score(const Key& key, std::vector<float>& scores) const
+    {
+        scores.resize(quadgrams());
+        double total = 0.;
+        for (std::size_t position = 0; position < scores.size(); position++) {
+            scores[position] = quadgramScore(key, position);
+            total += scores[position];
+        }
+        return total;
+    }
+
+    // Change in the total score from swapping the plain letters of cypher
+    // letters a and b, given the current score of every quadgram. The new
+    // scores of the quadgrams that change are left in changed.
+    double swapDelta(Key& key, int a, int b, const std::vector<float>& scores,
+                     std::vector<std::pair<std::uint32_t, float>>& changed) const
+    {
+        std::swap(key[a], key[b]);
+        changed.clear();
+        double delta = 0.;
+        for (std::uint32_t i = m_starts[a]; i < m_starts[a + 1]; i++) {
+            delta += rescore(key, m_positions[i], scores, changed);
+        }
+        for (std::uint32_t i = m_starts[b]; i < m_starts[b + 1]; i++) {
+            // Quadgrams with both letters were already rescored
+            if (!((m_masks[m_positions[i]] >> a) & 1)) {
+                delta += rescore(key, m_positions[i], scores, changed);
+            }
+        }
+        std::swap(key[a], key[b]);
+        return delta;
+    }
+
+private:
+    float quadgramScore(const Key& key, std::size_t position) const
+    {
+        const unsigned char* letters = &m_letters[position];
+        const unsigned int quadgram = ((key[letters[0]] * ALPHABET_LENGTH + key[letters[1]]) * ALPHABET_LENGTH
+                                       + key[letters[2]]) * ALPHABET_LENGTH + key[letters[3]];
+        return m_logProbs[quadgram];
+    }
+
+    double rescore(const Key& key, std::uint32_t position, const std::vector<float>& scores,
+                   std::vector<std::pair<std::uint32_t, float>>& changed) const
+    {
+        const float score = quadgramScore(key, position);
+        changed.emplace_back(position, score);
+        return static_cast<double>(score) - scores[position];
+    }
+
+    const float* m_logProbs;
+    std::vector<unsigned char> m_letters;
+    std::vector<std::uint32_t> m_masks;
+    std::array<std::uint32_t, ALPHABET_LENGTH + 1> m_starts = {};
+    std::vector<std::uint32_t> m_positions;
+};
+
+// Kicks given to a climbed key, and the random swaps in each
+const int PERTURBATIONS = 30;
+const int PERTURBATION_SWAPS = 3;
+
+// Swap pairs of letters while that improves the score, until no single swap
+// does. scores holds the score of every quadgram under the key.
+void ascend(const QuadgramIndex& index, Key& key, std::vector<float>& scores,
+            std::vector<std::pair<std::uint32_t, float>>& changed)
+{
+    bool improved = true;
+    while (improved) {
+        improved = false;
+        for (int a = 0; a < ALPHABET_LENGTH; a++) {
+            for (int b = a + 1; b < ALPHABET_LENGTH; b++) {
+                // Swapping two letters the text does not use changes nothing
+                if (!index.contains(a) && !index.contains(b)) {
+                    continue;
+                }
+                if (index.swapDelta(key, a, b, scores, changed) > 1e-6) {
+                    std::swap(key[a], key[b]);
+                    for (const auto& update : changed) {
+                        scores[update.first] = update.second;
+                    }
+                    improved = true;
+                }
+            }
+        }
+    }
+}
+
+// Climb from a random key to a local best, then repeatedly kick it with a few
+// random swaps and climb again, keeping the result when it scores higher.
+// Returns the total score of the key.
+double climb(const QuadgramIndex& index, std::uint32_t seed, Key& key)
+{
+    std::mt19937 random(seed);
+    std::iota(key.begin(), key.end(), 0);
+    std::shuffle(key.begin(), key.end(), random);
+
+    std::vector<float> scores;
+    std::vector<std::pair<std::uint32_t, float>> changed;
+    index.score(key, scores);
+    ascend(index, key, scores, changed);
+    double best = index.score(key, scores);
+
+    std::uniform_int_distribution<int> letter(0, ALPHABET_LENGTH - 1);
+    Key kicked;
+    for (int perturbation = 0; perturbation < PERTURBATIONS; perturbation++) {
+        kicked = key;
+        for (int swap = 0; swap < PERTURBATION_SWAPS; swap++) {
+            std::swap(kicked[letter(random)], kicked[letter(random)]);
+        }
+        index.score(kicked, scores);
+        ascend(index, kicked, scores, changed);
+
+        // Rescore from scratch so equal keys get exactly equal scores
+        const double score = index.score(kicked, scores);
+        if (score > best) {
+            best = score;
+            key = kicked;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+SubstitutionSolver::SubstitutionSolver(const QuadgramScorer& quadgrams, unsigned int maxRestarts,
+                                       unsigned int agreement, unsigned int jobs)
+    : m_quadgrams(quadgrams),
+      m_maxRestarts(std::max(maxRestarts, 1u)),
+      m_agreement(std::max(agreement, 1u)),
+      m_pool(new ThreadPool(std::min(jobs ? jobs : std::thread::hardware_concurrency(), m_maxRestarts))),
+      m_solving(new std::mutex)
+{
+}
+
+std::unique_ptr<SubstitutionSolver> SubstitutionSolver::fromOptions(const Options& options)
+{
+    // Load quadgram counts if given
+    std::unique_ptr<QuadgramScorer> quadgrams;
+    if (!QuadgramScorer::fromOption(options, "-q", quadgrams)) {
+        return nullptr;
+    }
+
+    unsigned int counts[2] = {100, 3};
+    const char* flags[2] = {"-r", "-c"};
+    for (int i = 0; i < 2; i++) {
+        const auto option = options.find(flags[i]);
+        if (option != options.end()) {
+            const int value = std::atoi(option->second.c_str());
+            if (value <= 0) {
+                std::cout << "Invalid count \"" << option->second << "\" for " << flags[i] << ". Use a positive number." << std::endl;
+                return nullptr;
+            }
+            counts[i] = static_cast<unsigned int>(value);
+        }
+    }
+
+    std::unique_ptr<SubstitutionSolver> solver(new SubstitutionSolver(quadgrams ? *quadgrams : QuadgramScorer::builtin(),
+                                                                      counts[0], counts[1], jobsOption(options)));
+    solver->m_quadgramFile = std::move(quadgrams);
+    return solver;
+}
+
+SubstitutionSolution SubstitutionSolver::solve(std::string_view cypherText) const
+{
+    const QuadgramIndex index(cypherText, m_quadgrams);
+
+    SubstitutionSolution solution{ROTATIONS[0], std::string(cypherText), 0., 0, 0};
+    if (index.quadgrams() == 0) {
+        return solution;
+    }
+
+    // Run restarts across the workers until enough agree on the best key or
+    // all have run. Restart r always starts from the same key, seeded by r.
+    Key bestKey;
+    double bestScore = 0.;
+    std::mutex mutex;
+    std::atomic<unsigned int> nextRestart(0);
+    std::atomic<bool> done(false);
+    {
+        std::lock_guard<std::mutex> solving(*m_solving);
+        for (unsigned int worker = 0; worker < m_pool->size(); worker++) {
+            m_pool->submit([&] {
+                Key key;
+                while (!done) {
+                    const unsigned int restart = nextRestart++;
+                    if (restart >= m_maxRestarts) {
+                        break;
+                    }
+                    const double score = climb(index, restart, key);
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    solution.restarts++;
+                    if (solution.restarts == 1 || score > bestScore) {
+                        bestKey = key;
+                        bestScore = score;
+                        solution.agreeing = 1;
+                    }
+                    else if (score == bestScore) {
+                        solution.agreeing++;
+                    }
+                    if (solution.agreeing >= m_agreement) {
+                        done = true;
+                    }
+                }
+            });
+        }
+        m_pool->wait();
+    }
+
+    solution.decryption = makeSubstitution(bestKey);
+    solution.score = bestScore / index.quadgrams();
+    substituteLetters(&solution.text[0], solution.text.size(), solution.decryption);
+    return solution;
+}
@@ -10,110 +10,63 @@
  ****************************************************************************/
 
 // STL includes
-#include <map>
 #include <string>
+#include <string_view>
 #include <iostream>
-#include <future>
-#include <vector>
-#include <fstream>
-
-// Boost includes
-#include <boost/algorithm/string.hpp>
 
 // Project includes
+#include "Caesar.h"
 #include "CommonUtils.h"
+#include "Radix.h"
 
-// Lookup the encoded text and return the decoded character
-char ascii2char(const std::string& in)
+// Solve the decoded message as Caesar cypher text in the same process, and
+// return the decoded message and its solution for printing.
+std::string caesarSolve(const CaesarSolver& caesar, const std::string& decoded)
 {
-    int retVal = 0;
-    int power = 0;
-    auto cstr = in.c_str();
-    
-    for(int i = in.size() - 1; i >= 0; i--, power++) {
-        const int val = cstr[i] - '0';
-        // If the character is an integer, add the value. Skip 0 (shortcut)
-        if(val > 0 && val < 10)
-            retVal += val * pow(10, power);
-    }
-    
-    return (char)retVal;
-}
-
-// Ascii code solver for a given string.
-std::string stringSolver(const std::string& asciiMessage)
-{
-    // Tokenize the encoded message
-    std::vector<std::string> tokens;
-    boost::split(tokens, asciiMessage, boost::is_any_of(" \r\n"), boost::token_compress_on);
-    std::vector<char> ret(tokens.size());
-    ret.clear();
-    for (auto tok : tokens) {
-        if(!tok.empty())
-            ret.push_back(ascii2char(tok));
-    }
-    return std::string(&ret[0], ret.size() * sizeof(char));
+    return "Solving cyphertext '" + decoded + "'.\n" + caesar.solve(decoded);
 }
 
 // Ascii code solver for a file containing encoded text, one message per line.
-void fileSolver(const std::string& filePath)
+void fileSolver(const CaesarSolver& caesar, const std::string& filePath, unsigned int jobs)
 {
-    std::vector<std::string> messages;
-    
-    // Read in the strings
-    std::ifstream inFile(filePath);
-    if (inFile.is_open()) {
-        std::string line;
-        while ( std::getline(inFile, line) ) {
-            messages.push_back(line);
-        }
-        inFile.close();
-    } else {
-        std::cout << "Unable to open file \"" << filePath << "\". Please check your inputs and try again." << std::endl; 
-    }
-    
-    // Decode each message
-    std::vector<std::future<std::array<std::string, 2>>> futures;
-    for (auto message : messages) {
-        futures.push_back(std::async(std::launch::async, [](std::string encoded) {
-            std::array<std::string, 2> result;
-            result[0] = encoded;
-            result[1] = stringSolver(encoded);
-            return result;
-        }, message));
-    }
-
-    // Print out the original message and the best decoded message
-    for (auto &f : futures) {
-        auto temp = f.get();
-        //std::cout << temp[0] << std::endl << temp[1] << std::endl << std::endl;
-        std::cout << "Solving cyphertext '" << temp[1] << "'." << std::endl;
-        std::string systemString("bin/caesarSolver.exe -s \"" + temp[1] + "\"");
-        system(systemString.c_str());
-    }
+    // Decode each message and solve the result as Caesar cypher text as it is
+    // read, across the worker pool, then print them in input order
+    solveFile(filePath, [&caesar](std::string_view encoded) {
+        // Decode into a buffer reused by the worker for each line
+        thread_local std::string decoded;
+        decodeAscii(encoded, decoded);
+        return caesarSolve(caesar, decoded);
+    }, [](std::string_view, const std::string& solved) {
+        std::cout << solved << std::endl;
+    }, jobs);
 }
 
 int main(int argc, char* argv[])
 {
     // Parse input arguments
     std::string out;
-    auto command = parseCLI(argc, argv, out);
+    Options options;
+    auto command = parseCLI(argc, argv, out, options);
+
+    // Decoded messages are solved as Caesar cypher text; set up its scoring
+    const auto caesar = CaesarSolver::fromOptions(options);
+    if (!caesar) {
+        return 1;
+    }
     
     switch (command) {
     
         // If file is passed, read file 
         case SOLVE_FILE:
             std::cout << "Solving cyphertext in file '" << out << "'." << std::endl;
-            fileSolver(out);
+            fileSolver(*caesar, out, jobsOption(options));
             break;
             
         // If text is passed, solve the text    
         case SOLVE_STRING:
         {
             std::cout << "Solving cyphertext '" << out << "'." << std::endl;
-            auto temp = stringSolver(out);
-            std::string systemString("bin/caesarSolver.exe -s \"" + temp + "\"");
-            system(systemString.c_str());
+            std::cout << caesarSolve(*caesar, decodeAscii(out)) << std::endl;
             break;
         }
         
@@ -0,0 +1,168 @@
+/*****************************************************************************
+ * File: ghostSolver.cpp
+ *
+ * Description: Solve messages encoded in one or more layers by running them
+ *              through a chain of decoding stages, for example hex code
+ *              hiding a Caesar cypher:
+ *
+ *              ghostSolver --pipeline hex,caesar -f messages.txt
+ *
+ *              Stages: morse, morseseg (Morse with missing letter
+ *              separators; -d, -q, -b), hex, oct, ascii, caesar (-m, -d, -q
+ *              as for caesarSolver), keyshift (-k <key>, or found from
+ *              each message without one), atbash and substitute (-a
+ *              <cypher alphabet>). -j sets the number of worker threads for
+ *              files, and --cache <entries> solves each distinct line of a
+ *              file once.
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+
+// STL includes
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Project includes
+#include "CommonUtils.h"
+#include "Pipeline.h"
+#include "ResultCache.h"
+
+void displayHelp()
+{
+    std::cout << "Usage: ghostSolver --pipeline <stage,stage,...> [options] -f <file> | -s <string>" << std::endl;
+    std::cout << "Stages: " << Pipeline::stageNames() << std::endl;
+}
+
+// The pipeline spec and stage options, as the pipeline's ID in cache keys
+std::string pipelineId(const Options& options)
+{
+    std::string id = "ghost";
+    for (const auto& option : options) {
+        if (option.first != "-j" && option.first != "--cache") {
+            id += ' ' + option.first + ' ' + option.second;
+        }
+    }
+    return id;
+}
+
+// Run each message of a file, one per line, through the pipeline a chunk of
+// lines at a time, and print the original and decoded messages in order. With
+// a cache, only the lines not already cached go through the pipeline. Stages
+// such as hex and ascii decode case-sensitively, so lines are cached as
+// given.
+void fileSolver(const Pipeline& pipeline, const std::string& filePath, unsigned int jobs,
+                ResultCache<std::string>* cache, const std::string& id)
+{
+    solveFileBatches(filePath, [&pipeline, cache, &id](const std::vector<std::string_view>& lines, std::vector<std::string>& results) {
+        if (!cache) {
+            pipeline.process(lines, results);
+            return;
+        }
+
+        // Lines missing from the cache are solved once per chunk, however
+        // often they repeat within it. Each repeat counts as a hit.
+        thread_local std::string key;
+        thread_local std::unordered_map<std::string_view, std::size_t> pending;
+        thread_local std::vector<std::pair<std::size_t, std::size_t>> missed;
+        thread_local std::vector<std::string_view> misses;
+        thread_local std::vector<std::string> solved;
+        pending.clear();
+        missed.clear();
+        misses.clear();
+        std::size_t repeats = 0;
+        for (std::size_t i = 0; i < lines.size(); i++) {
+            const auto found = pending.find(lines[i]);
+            if (found != pending.end()) {
+                missed.emplace_back(i, found->second);
+                repeats++;
+                continue;
+            }
+            resultCacheKey(id, lines[i], false, key);
+            if (!cache->find(key, results[i])) {
+                pending.emplace(lines[i], misses.size());
+                missed.emplace_back(i, misses.size());
+                misses.push_back(lines[i]);
+            }
+        }
+        cache->addHits(repeats);
+        if (misses.empty()) {
+            return;
+        }
+
+        pipeline.process(misses, solved);
+        for (std::size_t i = 0; i < misses.size(); i++) {
+            resultCacheKey(id, misses[i], false, key);
+            cache->insert(key, solved[i]);
+        }
+        for (const auto& miss : missed) {
+            results[miss.first] = solved[miss.second];
+        }
+    }, [](std::string_view encoded, const std::string& decoded) {
+        std::cout << encoded << std::endl << decoded << std::endl << std::endl;
+    }, jobs);
+}
+
+int main(int argc, char* argv[])
+{
+    // Parse input arguments
+    std::string out;
+    Options options;
+    auto command = parseCLI(argc, argv, out, options);
+
+    const auto spec = options.find("--pipeline");
+    if (command == UNDEFINED || spec == options.end()) {
+        displayHelp();
+        return 1;
+    }
+
+    // Build the chain of stages
+    const auto pipeline = Pipeline::fromSpec(spec->second, options);
+    if (!pipeline) {
+        return 1;
+    }
+
+    // "--cache <entries>" solves each distinct line of a file only once
+    std::unique_ptr<ResultCache<std::string>> cache;
+    const auto cacheOption = options.find("--cache");
+    if (cacheOption != options.end()) {
+        const int value = std::atoi(cacheOption->second.c_str());
+        if (value <= 0) {
+            std::cout << "Invalid cache size \"" << cacheOption->second << "\". Use a positive number." << std::endl;
+            return 1;
+        }
+        cache.reset(new ResultCache<std::string>(static_cast<std::size_t>(value)));
+    }
+
+    switch (command) {
+
+        // If file is passed, read file
+        case SOLVE_FILE:
+            std::cout << "Solving messages in file '" << out << "' with pipeline '" << spec->second << "'." << std::endl;
+            fileSolver(*pipeline, out, jobsOption(options), cache.get(), pipelineId(options));
+            if (cache) {
+                std::cout << "Result cache: " << cache->hits() << " hits, " << cache->misses() << " misses." << std::endl;
+            }
+            break;
+
+        // If text is passed, solve the text
+        case SOLVE_STRING:
+            std::cout << "Solving message '" << out << "' with pipeline '" << spec->second << "'." << std::endl;
+            std::cout << pipeline->solve(out) << std::endl;
+            break;
+
+        case UNDEFINED:
+        default:
+            break;
+    }
+
+    return 0;
+}
@@ -2,7 +2,9 @@
  * File: keyShiftCypher.cpp
  *
  * Description: Take an encrypted text string, shift it by the input key, and
- *              print the decrypted string.
+ *              print the decrypted string. Without a key, the key is found
+ *              from the text first, or each word of a word list is tried as
+ *              the key.
  *
  * Author: Tim Troxler
  *
@@ -11,77 +13,123 @@
  ****************************************************************************/
 
 // STL includes
+#include <cstdlib>
 #include <string>
 #include <iostream>
+#include <vector>
 
-// Boost includes
-#include <boost/algorithm/string.hpp>
+// Project includes
+#include "CommonUtils.h"
+#include "KeyShift.h"
+#include "Scorer.h"
 
-static const int ALPHABET_LENGTH = 26;
-
-// Return if the character is in the alphabet or not
-// True if a-z
-// False all others
-inline bool isAlpha(const char c)
+// Decrypt with the key, finding it from the cyphertext first if empty, and
+// display the result
+int keySolver(const std::string& encrypted, std::string key)
 {
-    return (c >= 'a' && c <= 'z');
+    if (key.empty()) {
+        key = recoverKey(encrypted);
+        if (key.empty()) {
+            std::cout << "Cyphertext '" << encrypted << "' is too short to find the key." << std::endl;
+            return 1;
+        }
+        std::cout << "Recovered key '" << key << "'." << std::endl;
+    }
+
+    std::cout << "Solving cyphertext '" << encrypted << "' with key '" << key << "'." << std::endl;
+    std::cout << keyShiftDecrypt(encrypted, key) << std::endl;
+    return 0;
 }
 
-// Shift each alphabetic character of the encrypted string by the 
-// corresponding character in the key, and return the decrypted string.
-std::string solver(const std::string encrypted, const std::string key)
+// Try every word in the word list as the key, list the best scoring keys by
+// quadgram score, and decrypt with the best
+int dictionarySolver(const std::string& encrypted, const std::string& wordFile, const Options& options)
 {
-    // Convert to lowercase for simplicity
-    auto decrypted = encrypted;
-    std::transform(decrypted.begin(), decrypted.end(), decrypted.begin(), ::tolower);
+    constexpr SeparatorSet WHITESPACE(" \n\r\t\f\v");
 
-    const int keylength = key.length();
-    
-    // Keep track of any whitespace or punctuation
-    int ignoreChars = 0;
-    
-    // For each encrypted character...
-    for(unsigned int cryptIdx = 0; cryptIdx < decrypted.length(); cryptIdx++) {
-        auto c = decrypted.at(cryptIdx);
-        
-        // If in the lowercase alphabet...
-        if(isAlpha(c)) {
-        
-            // Find the corresponding index in the key string
-            const int keyIdx = (cryptIdx - ignoreChars) % keylength;
-            
-            // Shift the encrypted character by the key; wrap within the size 
-            // of the alphabet
-            auto temp = ((c - key.at(keyIdx)) % ALPHABET_LENGTH);
-            if(temp < 0) {
-                temp += ALPHABET_LENGTH;
-            }
-            
-            // Convert back to lowercase text
-            decrypted[cryptIdx] = temp + 'a';
-        } else {
-            ignoreChars++;
+    MappedFile words(wordFile);
+    if (!words.isOpen()) {
+        std::cout << "Unable to open word list \"" << wordFile << "\". Please check your inputs and try again." << std::endl;
+        return 1;
+    }
+    std::vector<std::string_view> keys;
+    for (auto word : Tokens(words.view(), WHITESPACE)) {
+        keys.push_back(word);
+    }
+
+    // Load quadgram counts if given
+    std::unique_ptr<QuadgramScorer> quadgrams;
+    if (!QuadgramScorer::fromOption(options, "-q", quadgrams)) {
+        return 1;
+    }
+
+    std::size_t count = 10;
+    const auto countOption = options.find("-n");
+    if (countOption != options.end()) {
+        const int value = std::atoi(countOption->second.c_str());
+        if (value <= 0) {
+            std::cout << "Invalid key count \"" << countOption->second << "\". Use a positive number." << std::endl;
+            return 1;
         }
+        count = static_cast<std::size_t>(value);
     }
-    
-    return decrypted;
+
+    std::cout << "Trying " << keys.size() << " keys from '" << wordFile << "'." << std::endl;
+    const auto best = dictionaryAttack(encrypted, keys, quadgrams ? *quadgrams : QuadgramScorer::builtin(),
+                                       count, jobsOption(options));
+    if (best.empty()) {
+        std::cout << "No usable keys in '" << wordFile << "'." << std::endl;
+        return 1;
+    }
+    for (const auto& trial : best) {
+        std::cout << "  " << trial.key << " " << trial.score << std::endl;
+    }
+    return keySolver(encrypted, best.front().key);
 }
 
 int main(int argc, char* argv[])
 {    
-    // Very simple validation - require the 2 input strings
-    // To do - any error handling
-    if (argc != 3) {
-        std::cout << "This program requires two strings as input:" << std::endl;
-        std::cout << "keyShiftCypher.exe \"encrypted string\" \"keystring\"" << std::endl;
+    // Flags: the cyphertext as "-s <string>" or "-f <file>", then "-k <key>",
+    // "-w <word list>" (with "-n <count>", "-q <counts>", "-j <count>"), or
+    // neither to find the key
+    if (argc > 1 && argv[1][0] == '-') {
+        std::string out;
+        Options options;
+        const auto command = parseCLI(argc, argv, out, options);
+
+        std::string encrypted;
+        if (command == SOLVE_STRING) {
+            encrypted = out;
+        }
+        else if (command == SOLVE_FILE) {
+            MappedFile file(out);
+            if (!file.isOpen()) {
+                std::cout << "Unable to open \"" << out << "\". Please check your inputs and try again." << std::endl;
+                return 1;
+            }
+            encrypted = std::string(file.view());
+        }
+        else {
+            std::cout << "keyShiftCypher.exe -s \"encrypted string\" | -f file [-k key | -w wordlist [-n count]]" << std::endl;
+            return 1;
+        }
+
+        const auto wordFile = options.find("-w");
+        if (wordFile != options.end()) {
+            return dictionarySolver(encrypted, wordFile->second, options);
+        }
+        const auto key = options.find("-k");
+        return keySolver(encrypted, key != options.end() ? key->second : std::string());
+    }
+
+    // Very simple validation - require the encrypted string, and optionally
+    // the key
+    if (argc != 2 && argc != 3) {
+        std::cout << "This program requires the encrypted string, and the key if known:" << std::endl;
+        std::cout << "keyShiftCypher.exe \"encrypted string\" [\"keystring\"]" << std::endl;
+        return 1;
     }
     
-    // Decrypt and display
-    auto encrypted = std::string(argv[1]);
-    auto key = std::string(argv[2]);
-    std::cout << "Solving cyphertext '" << encrypted << "' with key '" << key << "'." << std::endl;
-    auto decrypted = solver(encrypted, key);
-    std::cout << decrypted << std::endl;
-    
-    return 0;
+    // Without a key, find it from the cyphertext
+    return keySolver(std::string(argv[1]), (argc == 3) ? std::string(argv[2]) : std::string());
 }
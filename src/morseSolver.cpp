@@ -10,190 +10,66 @@
  ****************************************************************************/
 
 // STL includes
-#include <map>
 #include <string>
+#include <string_view>
 #include <iostream>
-#include <future>
-#include <vector>
-#include <fstream>
 
 // Project includes
 #include "CommonUtils.h"
+#include "Morse.h"
+#include "MorseSegmenter.h"
 
-// Lookup the encoded text and return the decoded character
-char morse2char(std::string in)
+// Decode a message, splitting it into letters with the segmenter if given
+std::string stringSolver(const MorseSegmenter* segmenter, std::string_view encoded)
 {
-    static std::map<std::string, char> morse = {{".-",'a'},
-                {"-...",'b'},
-                {"-.-.",'c'},
-                {"-..",'d'},
-                {".",'e'},
-                {"..-.",'f'},
-                {"--.",'g'},
-                {"....",'h'},
-                {"..",'i'},
-                {".---",'j'},
-                {"-.-",'k'},
-                {".-..",'l'},
-                {"--",'m'},
-                {"-.",'n'},
-                {"---",'o'},
-                {".--.",'p'},
-                {"--.-",'q'},
-                {".-.",'r'},
-                {"...",'s'},
-                {"-",'t'},
-                {"..-",'u'},
-                {"...-",'v'},
-                {".--",'w'},
-                {"-..-",'x'},
-                {"-.--",'y'},
-                {"--..",'z'},
-                {"-----",'0'},
-                {".----",'1'},
-                {"..---",'2'},
-                {"...--",'3'},
-                {"....-",'4'},
-                {".....",'5'},
-                {"-....",'6'},
-                {"--...",'7'},
-                {"---..",'8'},
-                {"----.",'9'},
-                {".-.-.-",'.'},
-                {"--..--",','},
-                {"..--..",'?'},
-                {".----.",'\''},
-                {"-.-.--",'!'},
-                {"-..-.",'/'},
-                {"-.--.",'('},
-                {"-.--.-",')'},
-                {".-...",'&'},
-                {"---...",':'},
-                {"-.-.-.",';'},
-                {"-...-",'='},
-                {".-.-.",'+'},
-                {"-....-",'-'},
-                {"..--.-",'_'},
-                {".-..-.",'"'},
-                {"...-..-",'$'},
-                {".--.-.",'@'}};
-                
-    if(morse.find(in) != morse.end()) {
-        return morse.at(in);
-    } else {
-        return '*';
-    }
-}
-
-// Morse code solver for a given string.
-std::string stringSolver(std::string& morseMessage)
-{
-    std::string output("");
-    std::string buffer("");
-    
-    auto msg = morseMessage.c_str();
-    auto length = morseMessage.size();
-    
-    // For each encoded character
-    for(unsigned int i = 0; i < length; i++) {
-        switch(msg[i]) {
-        
-            // If a dash
-            case '0':
-                buffer += "-";
-                break;
-                
-            // If dot
-            case '1':
-                buffer += ".";
-                break;
-
-            // If space
-            case ' ':
-                // Decode whatever is left in the buffer
-                if(!buffer.empty()) {
-                    output += morse2char(buffer);
-                }
-                buffer.clear();
-                output += " ";
-                break;
-                
-            // If letter separator, decode the Morse encoded character
-            case '-':
-                output += morse2char(buffer);
-                buffer.clear();
-                break;
-                
-            default:
-                //std::cout << "Unknown character '" << msg[i] << "'." << std::endl;
-                buffer.clear();
-                output += "*";
-                break;
-        }
-    }
-    
-    // Decode whatever is left in the buffer
-    if(!buffer.empty()) {
-        output += morse2char(buffer);
-    }
-    
-    // Return the shifted string that is most like English
-    return output;
+    return segmenter ? segmenter->segment(encoded) : decodeMorse(encoded);
 }
 
 // Morse code solver for a file containing encoded text, one message per line.
-void fileSolver(const std::string& filePath)
+void fileSolver(const MorseSegmenter* segmenter, const std::string& filePath, unsigned int jobs)
 {
-    std::vector<std::string> messages;
-    
-    // Read in the strings
-    std::ifstream inFile(filePath);
-    if (inFile.is_open()) {
-        std::string line;
-        while ( std::getline(inFile, line) ) {
-            messages.push_back(line);
-        }
-        inFile.close();
-    } else {
-        std::cout << "Unable to open file \"" << filePath << "\". Please check your inputs and try again." << std::endl; 
-    }
-    
-    // Decode each message
-    std::vector<std::future<std::array<std::string, 2>>> futures;
-    for (auto message : messages) {
-        futures.push_back(std::async(std::launch::async, [](std::string encoded) {
-            std::array<std::string, 2> result;
-            result[0] = encoded;
-            result[1] = stringSolver(encoded);
-            return result;
-        }, message));
-    }
-
-    // Print out the original message and the best decoded message
-    for (auto &f : futures) {
-        auto temp = f.get();
-        std::cout << temp[0] << std::endl << temp[1] << std::endl << std::endl;
-    }
+    // Decode each message as it is read, across the worker pool, then print out
+    // the original message and the decoded message in input order
+    solveFile(filePath, [segmenter](std::string_view encoded) {
+        return stringSolver(segmenter, encoded);
+    }, [](std::string_view encoded, const std::string& decoded) {
+        std::cout << encoded << std::endl << decoded << std::endl << std::endl;
+    }, jobs);
 }
 
 int main(int argc, char* argv[])
 {
     // Parse input arguments
     std::string out;
-    auto command = parseCLI(argc, argv, out);
+    Options options;
+    auto command = parseCLI(argc, argv, out, options);
+
+    // "-m segment" decodes messages with missing letter separators
+    std::unique_ptr<MorseSegmenter> segmenter;
+    const auto method = options.find("-m");
+    if (method != options.end()) {
+        if (method->second != "segment") {
+            std::cout << "Unknown decoding method \"" << method->second << "\". Use segment." << std::endl;
+            return 1;
+        }
+        segmenter = MorseSegmenter::fromOptions(options);
+        if (!segmenter) {
+            return 1;
+        }
+    }
     
     switch (command) {
     
         // If file is passed, read file 
         case SOLVE_FILE:
             std::cout << "Solving cyphertext in file '" << out << "'." << std::endl;
-            fileSolver(out);
+            fileSolver(segmenter.get(), out, jobsOption(options));
             break;
             
         // If text is passed, solve the text    
         case SOLVE_STRING:
             std::cout << "Solving cyphertext '" << out << "'." << std::endl;
-            std::cout << stringSolver(out) << std::endl;;
+            std::cout << stringSolver(segmenter.get(), out) << std::endl;
             break;
             
         // Invalid CLI params; display help text
@@ -0,0 +1,84 @@
+/*****************************************************************************
+ * File: substitutionSolver.cpp
+ *
+ * Description: Program to solve general substitution cypher strings, where
+ *              each letter stands for another with no fixed shift, by hill
+ *              climbing over keys with random restarts across all cores.
+ *
+ *              substitutionSolver [-q quadgrams] [-r restarts] [-c agree]
+ *                                 [-j jobs] -f file|-s string
+ *
+ * Author: Tim Troxler
+ *
+ * Created: 10/17/2026
+ *
+ ****************************************************************************/
+
+// STL includes
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+// Project includes
+#include "CommonUtils.h"
+#include "SubstitutionSolver.h"
+
+// Solve a cypher string and describe the key found with the decrypted text
+std::string stringSolver(const SubstitutionSolver& solver, std::string_view encrypted)
+{
+    const auto solution = solver.solve(encrypted);
+    std::ostringstream described;
+    described << "Key '" << substitutionKey(solution.decryption) << "', score " << solution.score
+              << ", found by " << solution.agreeing << " of " << solution.restarts << " restarts." << std::endl
+              << solution.text;
+    return described.str();
+}
+
+// Substitution solver for a file containing cypher text, one cypher per line.
+void fileSolver(const SubstitutionSolver& solver, const std::string& filePath)
+{
+    // Each line's restarts already use every core, so solve the lines one at
+    // a time, printing the original text and the solution
+    solveFile(filePath, [&solver](std::string_view encrypted) {
+        return stringSolver(solver, encrypted);
+    }, [](std::string_view encrypted, const std::string& decrypted) {
+        std::cout << encrypted << std::endl << decrypted << std::endl << std::endl;
+    }, 1);
+}
+
+int main(int argc, char* argv[])
+{
+    // Parse input arguments
+    std::string out;
+    Options options;
+    auto command = parseCLI(argc, argv, out, options);
+
+    const auto solver = SubstitutionSolver::fromOptions(options);
+    if (!solver) {
+        return 1;
+    }
+
+    switch (command) {
+
+        // If file is passed, read file
+        case SOLVE_FILE:
+            std::cout << "Solving cyphertext in file '" << out << "'." << std::endl;
+            fileSolver(*solver, out);
+            break;
+
+        // If text is passed, solve the text
+        case SOLVE_STRING:
+            std::cout << "Solving cyphertext '" << out << "'." << std::endl;
+            std::cout << stringSolver(*solver, out) << std::endl;
+            break;
+
+        // Invalid CLI params; display help text
+        case UNDEFINED:
+        default:
+            std::cout << "substitutionSolver [-q quadgrams] [-r restarts] [-c agree] [-j jobs] -f file|-s string" << std::endl;
+            break;
+    }
+
+    return 0;
+}